@@ -17,6 +17,22 @@ function(kernel_src_copy)
   set(multiValueArgs IMPL_DIR)
   cmake_parse_arguments(KNCPY "" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
   add_custom_target(${KNCPY_TARGET})
+  # 公共kernel头文件（如multi_tensor_apply.h）拷贝到${KNCPY_DST_DIR}/common，算子通过"../common/xxx.h"引用
+  set(COMMON_KERNEL_DIR ${CMAKE_SOURCE_DIR}/common/inc/op_kernel)
+  if(EXISTS ${COMMON_KERNEL_DIR} AND NOT TARGET common_kernel_src_copy)
+    add_custom_target(
+      common_kernel_src_copy
+      COMMAND
+        ${CMAKE_COMMAND} -E make_directory ${KNCPY_DST_DIR}/common
+      COMMAND
+        bash -c "find ${COMMON_KERNEL_DIR} -mindepth 1 -maxdepth 1 -exec cp -r {} ${KNCPY_DST_DIR}/common \\;"
+      VERBATIM
+      )
+    add_dependencies(${KNCPY_TARGET} common_kernel_src_copy)
+    if(ENABLE_PACKAGE)
+      install(DIRECTORY ${COMMON_KERNEL_DIR}/ DESTINATION ${IMPL_INSTALL_DIR}/common)
+    endif()
+  endif()
   foreach(OP_DIR ${KNCPY_IMPL_DIR})
     get_filename_component(OP_NAME ${OP_DIR} NAME)
     message(STATUS "start copy kernel file: ${OP_NAME} to ${KNCPY_DST_DIR}")
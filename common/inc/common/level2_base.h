@@ -13,6 +13,7 @@
 #define LEVEL2_BASE_H_MATH
 
 #include "common/op_api_def.h"
+#include "common/level2_executor_cache.h"
 #include "aclnn/aclnn_base.h"
 
 #ifdef __cplusplus
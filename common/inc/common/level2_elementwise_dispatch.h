@@ -0,0 +1,234 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file level2_elementwise_dispatch.h
+ * \brief 双输入elementwise类aclnn接口的构图路径选择表
+ *
+ * 每次调用只计算一次 (输入连续性, 推导类型下各tensor是否需要Cast) 组成的紧凑签名，
+ * 再从预先生成的路径表中取出需要执行的Contiguous/Cast步骤，跳过对稠密输入的Contiguous
+ * 以及dtype已一致时的Cast调用。广播类别不影响构图步骤，不参与查表，仅与路径一起计数，
+ * 便于观察实际走到的回退路径。
+ */
+
+#ifndef LEVEL2_ELEMENTWISE_DISPATCH_H_MATH
+#define LEVEL2_ELEMENTWISE_DISPATCH_H_MATH
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include "aclnn/aclnn_base.h"
+#include "aclnn_kernels/cast.h"
+#include "aclnn_kernels/contiguous.h"
+#include "opdev/common_types.h"
+#include "opdev/op_executor.h"
+#include "opdev/shape_utils.h"
+#include "opdev/tensor_view_utils.h"
+
+namespace op {
+enum class ElementwiseBroadcast : uint8_t {
+    SAME_SHAPE = 0,   // self与other形状一致
+    OTHER_SCALAR = 1, // other只有一个元素
+    SELF_SCALAR = 2,  // self只有一个元素
+    GENERAL = 3       // 一般广播
+};
+
+enum class ElementwisePath : uint8_t {
+    DIRECT = 0,          // 输入稠密且dtype一致，直接调用计算kernel
+    CAST = 1,            // 仅需Cast
+    CONTIGUOUS = 2,      // 仅需Contiguous
+    CONTIGUOUS_CAST = 3  // Contiguous与Cast都需要
+};
+
+constexpr size_t ELEMENTWISE_BROADCAST_NUM = 4;
+constexpr size_t ELEMENTWISE_PATH_NUM = 4;
+
+// 构图步骤位
+constexpr uint32_t ELEMENTWISE_STEP_CONTIGUOUS_SELF = 1U << 0;
+constexpr uint32_t ELEMENTWISE_STEP_CONTIGUOUS_OTHER = 1U << 1;
+constexpr uint32_t ELEMENTWISE_STEP_CAST_SELF = 1U << 2;
+constexpr uint32_t ELEMENTWISE_STEP_CAST_OTHER = 1U << 3;
+constexpr uint32_t ELEMENTWISE_STEP_CAST_OUT = 1U << 4;
+
+// Cast掩码位
+constexpr uint8_t ELEMENTWISE_CAST_MASK_SELF = 1U << 0;
+constexpr uint8_t ELEMENTWISE_CAST_MASK_OTHER = 1U << 1;
+constexpr uint8_t ELEMENTWISE_CAST_MASK_OUT = 1U << 2;
+
+// 签名各字段位宽：非稠密掩码2位（self/other），Cast掩码3位（self/other/out）
+constexpr uint32_t ELEMENTWISE_STRIDED_BITS = 2;
+constexpr uint32_t ELEMENTWISE_CAST_BITS = 3;
+constexpr size_t ELEMENTWISE_PLAN_TABLE_SIZE = 1U << (ELEMENTWISE_STRIDED_BITS + ELEMENTWISE_CAST_BITS);
+
+struct ElementwiseSignature {
+    DataType promoteType = DataType::DT_UNDEFINED;
+    ElementwiseBroadcast broadcast = ElementwiseBroadcast::GENERAL; // 仅用于计数
+    uint8_t stridedMask = 0; // bit0: self非稠密，bit1: other非稠密
+    uint8_t castMask = 0;    // bit0: self需Cast，bit1: other需Cast，bit2: kernel结果需Cast回out类型
+
+    // 计算kernel直接接受混合dtype输入时，输入侧无需Cast，仅保留输出侧的Cast需求
+    void SkipInputCast()
+    {
+        castMask &= ELEMENTWISE_CAST_MASK_OUT;
+    }
+
+    uint32_t Key() const
+    {
+        return (static_cast<uint32_t>(stridedMask) << ELEMENTWISE_CAST_BITS) | static_cast<uint32_t>(castMask);
+    }
+};
+
+struct ElementwisePlan {
+    uint32_t steps;
+    ElementwisePath path;
+
+    bool Has(uint32_t step) const
+    {
+        return (steps & step) != 0;
+    }
+};
+
+struct ElementwiseDispatchStats {
+    std::array<uint64_t, ELEMENTWISE_PATH_NUM> path;
+    std::array<uint64_t, ELEMENTWISE_BROADCAST_NUM> broadcast;
+};
+
+class ElementwiseDispatcher {
+public:
+    /**
+     * 稠密输入：连续、无偏移且storage与view元素数一致，此时Contiguous不会产生任何拷贝，可直接跳过。
+     * 仅满足IsContiguous但带偏移或storage更大的输入仍交给Contiguous处理。
+     */
+    static bool IsDense(const aclTensor* tensor)
+    {
+        return IsContiguous(tensor) && tensor->GetViewOffset() == 0 &&
+               tensor->GetStorageShape().GetShapeSize() == tensor->GetViewShape().GetShapeSize();
+    }
+
+    static ElementwiseSignature Classify(
+        const aclTensor* self, const aclTensor* other, const aclTensor* out, DataType promoteType)
+    {
+        return Classify(self, other, out, promoteType, promoteType);
+    }
+
+    // resultType为计算kernel的输出类型，比较类算子为DT_BOOL，其余为推导类型
+    static ElementwiseSignature Classify(
+        const aclTensor* self, const aclTensor* other, const aclTensor* out, DataType promoteType,
+        DataType resultType)
+    {
+        ElementwiseSignature sig;
+        sig.promoteType = promoteType;
+        const auto& selfShape = self->GetViewShape();
+        const auto& otherShape = other->GetViewShape();
+        if (selfShape == otherShape) {
+            sig.broadcast = ElementwiseBroadcast::SAME_SHAPE;
+        } else if (otherShape.GetShapeSize() == 1) {
+            sig.broadcast = ElementwiseBroadcast::OTHER_SCALAR;
+        } else if (selfShape.GetShapeSize() == 1) {
+            sig.broadcast = ElementwiseBroadcast::SELF_SCALAR;
+        } else {
+            sig.broadcast = ElementwiseBroadcast::GENERAL;
+        }
+        sig.stridedMask = static_cast<uint8_t>((IsDense(self) ? 0U : 1U) | (IsDense(other) ? 0U : 2U));
+        sig.castMask = static_cast<uint8_t>(
+            (self->GetDataType() != promoteType ? ELEMENTWISE_CAST_MASK_SELF : 0U) |
+            (other->GetDataType() != promoteType ? ELEMENTWISE_CAST_MASK_OTHER : 0U) |
+            (out->GetDataType() != resultType ? ELEMENTWISE_CAST_MASK_OUT : 0U));
+        return sig;
+    }
+
+    static const ElementwisePlan& Select(const ElementwiseSignature& sig)
+    {
+        const ElementwisePlan& plan = PlanTable()[sig.Key()];
+        PathCounter()[static_cast<size_t>(plan.path)].fetch_add(1, std::memory_order_relaxed);
+        BroadcastCounter()[static_cast<size_t>(sig.broadcast)].fetch_add(1, std::memory_order_relaxed);
+        return plan;
+    }
+
+    // 按路径表准备一个输入：需要时Contiguous，再按需Cast到推导类型
+    static const aclTensor* PrepareInput(
+        const aclTensor* input, const ElementwisePlan& plan, uint32_t contiguousStep, uint32_t castStep,
+        DataType dtype, aclOpExecutor* executor)
+    {
+        const aclTensor* res = input;
+        if (plan.Has(contiguousStep)) {
+            res = l0op::Contiguous(res, executor);
+        }
+        if (res != nullptr && plan.Has(castStep)) {
+            res = l0op::Cast(res, dtype, executor);
+        }
+        return res;
+    }
+
+    static ElementwiseDispatchStats GetStats()
+    {
+        ElementwiseDispatchStats stats;
+        for (size_t i = 0; i < ELEMENTWISE_PATH_NUM; i++) {
+            stats.path[i] = PathCounter()[i].load(std::memory_order_relaxed);
+        }
+        for (size_t i = 0; i < ELEMENTWISE_BROADCAST_NUM; i++) {
+            stats.broadcast[i] = BroadcastCounter()[i].load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+    static void ResetStats()
+    {
+        for (auto& counter : PathCounter()) {
+            counter.store(0, std::memory_order_relaxed);
+        }
+        for (auto& counter : BroadcastCounter()) {
+            counter.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    static const std::array<ElementwisePlan, ELEMENTWISE_PLAN_TABLE_SIZE>& PlanTable()
+    {
+        static const std::array<ElementwisePlan, ELEMENTWISE_PLAN_TABLE_SIZE> table = []() {
+            std::array<ElementwisePlan, ELEMENTWISE_PLAN_TABLE_SIZE> res{};
+            for (uint32_t key = 0; key < ELEMENTWISE_PLAN_TABLE_SIZE; key++) {
+                uint32_t castMask = key & ((1U << ELEMENTWISE_CAST_BITS) - 1U);
+                uint32_t stridedMask = (key >> ELEMENTWISE_CAST_BITS) & ((1U << ELEMENTWISE_STRIDED_BITS) - 1U);
+                uint32_t steps = 0;
+                steps |= (stridedMask & 1U) != 0 ? ELEMENTWISE_STEP_CONTIGUOUS_SELF : 0U;
+                steps |= (stridedMask & 2U) != 0 ? ELEMENTWISE_STEP_CONTIGUOUS_OTHER : 0U;
+                steps |= (castMask & ELEMENTWISE_CAST_MASK_SELF) != 0 ? ELEMENTWISE_STEP_CAST_SELF : 0U;
+                steps |= (castMask & ELEMENTWISE_CAST_MASK_OTHER) != 0 ? ELEMENTWISE_STEP_CAST_OTHER : 0U;
+                steps |= (castMask & ELEMENTWISE_CAST_MASK_OUT) != 0 ? ELEMENTWISE_STEP_CAST_OUT : 0U;
+                // 结果Cast回out类型属于输出侧，不影响输入路径分类
+                bool needContiguous = stridedMask != 0;
+                bool needCast = (castMask & (ELEMENTWISE_CAST_MASK_SELF | ELEMENTWISE_CAST_MASK_OTHER)) != 0;
+                ElementwisePath path = needContiguous ?
+                                           (needCast ? ElementwisePath::CONTIGUOUS_CAST : ElementwisePath::CONTIGUOUS) :
+                                           (needCast ? ElementwisePath::CAST : ElementwisePath::DIRECT);
+                res[key] = {steps, path};
+            }
+            return res;
+        }();
+        return table;
+    }
+
+    static std::array<std::atomic<uint64_t>, ELEMENTWISE_PATH_NUM>& PathCounter()
+    {
+        static std::array<std::atomic<uint64_t>, ELEMENTWISE_PATH_NUM> counter{};
+        return counter;
+    }
+
+    static std::array<std::atomic<uint64_t>, ELEMENTWISE_BROADCAST_NUM>& BroadcastCounter()
+    {
+        static std::array<std::atomic<uint64_t>, ELEMENTWISE_BROADCAST_NUM> counter{};
+        return counter;
+    }
+};
+} // namespace op
+
+#endif // LEVEL2_ELEMENTWISE_DISPATCH_H_MATH
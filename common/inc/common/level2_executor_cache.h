@@ -0,0 +1,390 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file level2_executor_cache.h
+ * \brief aclnn两段式接口的执行器复用缓存
+ *
+ * 以 (算子名, 各tensor的dtype/format/shape/stride/offset, 标量值, 属性) 作为签名，
+ * 命中时直接返回已构图完成的可复用执行器和workspace大小，仅刷新输入输出tensor地址，
+ * 跳过CheckParams、类型推导以及Contiguous/Cast/ViewCopy等L0构图过程。
+ *
+ * 使用约束：
+ * 1. 缓存默认关闭，通过环境变量 ACLNN_EXECUTOR_CACHE=1 开启；
+ * 2. 命中返回的执行器为可复用执行器，调用者不能对其调用aclDestroyAclOpExecutor，由缓存负责释放；
+ * 3. 缓存为进程级单例，由互斥锁保护，第一段、第二段接口可以在不同线程调用；
+ * 4. 执行器返回给调用者后到第二段接口下发前处于占用状态，占用状态记录在该执行器的缓存项上，占用期间相同签名的调用
+ *    不命中，按完整流程构建独立执行器，避免后一次调用改写前一次尚未下发的地址。第二段接口需调用MarkLaunched解除占用；
+ * 5. 缓存项在LRU淘汰时释放，其余缓存项在进程退出析构单例时释放。单例在首次调用算子接口时构造，晚于runtime的静态
+ *    对象，因此先于runtime析构。
+ */
+
+#ifndef LEVEL2_EXECUTOR_CACHE_H_MATH
+#define LEVEL2_EXECUTOR_CACHE_H_MATH
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "aclnn/aclnn_base.h"
+#include "opdev/common_types.h"
+#include "opdev/op_log.h"
+
+namespace op {
+constexpr size_t EXECUTOR_CACHE_MAX_ENTRIES = 64;
+constexpr uint64_t EXECUTOR_CACHE_HASH_PRIME = 0x100000001b3ULL;
+constexpr uint64_t EXECUTOR_CACHE_HASH_BASIS = 0xcbf29ce484222325ULL;
+constexpr int64_t EXECUTOR_CACHE_NULL_TAG = -1;
+
+struct ExecutorCacheStats {
+    uint64_t hit;
+    uint64_t miss;
+    uint64_t evict;
+    uint64_t busy; // 命中但执行器尚未下发而按未命中处理的次数，已计入miss
+};
+
+/**
+ * 执行器签名：按顺序追加参与构图决策的全部信息，逐字比较保证不会因哈希碰撞误命中。
+ */
+class ExecutorSignature {
+public:
+    explicit ExecutorSignature(const char* opName)
+    {
+        for (const char* p = opName; p != nullptr && *p != '\0'; ++p) {
+            Push(static_cast<int64_t>(*p));
+        }
+    }
+
+    ExecutorSignature& Append(const aclTensor* tensor)
+    {
+        if (tensor == nullptr) {
+            Push(EXECUTOR_CACHE_NULL_TAG);
+            return *this;
+        }
+        Push(static_cast<int64_t>(tensor->GetDataType()));
+        Push(static_cast<int64_t>(tensor->GetViewFormat()));
+        Push(static_cast<int64_t>(tensor->GetStorageFormat()));
+        AppendShape(tensor->GetViewShape());
+        AppendShape(tensor->GetStorageShape());
+        const auto& strides = tensor->GetViewStrides();
+        Push(static_cast<int64_t>(strides.size()));
+        for (size_t i = 0; i < strides.size(); i++) {
+            Push(strides[i]);
+        }
+        Push(tensor->GetViewOffset());
+        return *this;
+    }
+
+    ExecutorSignature& Append(const aclScalar* scalar)
+    {
+        if (scalar == nullptr) {
+            Push(EXECUTOR_CACHE_NULL_TAG);
+            return *this;
+        }
+        // 标量值会在构图阶段被固化到执行器中（如Axpy的alpha），因此按值参与签名
+        Push(static_cast<int64_t>(scalar->GetDataType()));
+        double value = scalar->ToDouble();
+        int64_t bits = 0;
+        static_assert(sizeof(bits) == sizeof(value), "double must be 64 bits");
+        std::memcpy(&bits, &value, sizeof(bits));
+        Push(bits);
+        return *this;
+    }
+
+    ExecutorSignature& AppendAttr(int64_t attr)
+    {
+        Push(attr);
+        return *this;
+    }
+
+    uint64_t Hash() const
+    {
+        return hash_;
+    }
+
+    bool operator==(const ExecutorSignature& other) const
+    {
+        return hash_ == other.hash_ && words_ == other.words_;
+    }
+
+private:
+    void Push(int64_t word)
+    {
+        words_.push_back(word);
+        hash_ = (hash_ ^ static_cast<uint64_t>(word)) * EXECUTOR_CACHE_HASH_PRIME;
+    }
+
+    void AppendShape(const op::Shape& shape)
+    {
+        Push(static_cast<int64_t>(shape.GetDimNum()));
+        for (size_t i = 0; i < shape.GetDimNum(); i++) {
+            Push(shape.GetDim(i));
+        }
+    }
+
+    std::vector<int64_t> words_;
+    uint64_t hash_ = EXECUTOR_CACHE_HASH_BASIS;
+};
+
+struct ExecutorSignatureHash {
+    std::size_t operator()(const ExecutorSignature& sig) const
+    {
+        return static_cast<std::size_t>(sig.Hash());
+    }
+};
+
+class ExecutorCache {
+public:
+    static bool IsEnabled()
+    {
+        int32_t state = EnabledState().load(std::memory_order_relaxed);
+        if (state < 0) {
+            const char* env = std::getenv("ACLNN_EXECUTOR_CACHE");
+            state = (env != nullptr && std::strcmp(env, "1") == 0) ? 1 : 0;
+            EnabledState().store(state, std::memory_order_relaxed);
+        }
+        return state == 1;
+    }
+
+    // 覆盖ACLNN_EXECUTOR_CACHE的设置，供UT开关缓存
+    static void SetEnabled(bool enabled)
+    {
+        EnabledState().store(enabled ? 1 : 0, std::memory_order_relaxed);
+    }
+
+    static ExecutorCache& GetInstance()
+    {
+        static ExecutorCache instance;
+        return instance;
+    }
+
+    static ExecutorCacheStats GetStats()
+    {
+        return {HitCounter().load(std::memory_order_relaxed), MissCounter().load(std::memory_order_relaxed),
+                EvictCounter().load(std::memory_order_relaxed), BusyCounter().load(std::memory_order_relaxed)};
+    }
+
+    static void ResetStats()
+    {
+        HitCounter().store(0, std::memory_order_relaxed);
+        MissCounter().store(0, std::memory_order_relaxed);
+        EvictCounter().store(0, std::memory_order_relaxed);
+        BusyCounter().store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * 查找缓存，命中时按L2接口的输入/输出顺序刷新tensor地址。
+     * inputs/outputs中的nullptr表示该位置不是tensor（如标量参数），跳过但保留序号。
+     */
+    bool Lookup(
+        const ExecutorSignature& sig, const std::vector<const aclTensor*>& inputs,
+        const std::vector<const aclTensor*>& outputs, uint64_t* workspaceSize, aclOpExecutor** executor)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(sig);
+        if (it == entries_.end()) {
+            MissCounter().fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        if (it->second.inFlight) {
+            // 上次返回的执行器尚未下发，不能改写其地址
+            BusyCounter().fetch_add(1, std::memory_order_relaxed);
+            MissCounter().fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        aclOpExecutor* cached = it->second.executor;
+        if (!RebindAddr(cached, inputs, outputs, it->second.boundAddrs)) {
+            // 地址刷新失败时丢弃该项，退回完整构图流程
+            Evict(it);
+            MissCounter().fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        lru_.splice(lru_.begin(), lru_, it->second.lruPos);
+        it->second.inFlight = true;
+        HitCounter().fetch_add(1, std::memory_order_relaxed);
+        *workspaceSize = it->second.workspaceSize;
+        *executor = cached;
+        return true;
+    }
+
+    void Insert(ExecutorSignature&& sig, uint64_t workspaceSize, aclOpExecutor* executor)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (executor == nullptr || entries_.find(sig) != entries_.end()) {
+            return;
+        }
+        if (aclSetAclOpExecutorRepeatable(executor) != ACLNN_SUCCESS) {
+            OP_LOGW("Set executor repeatable failed, skip executor cache.");
+            return;
+        }
+        if (entries_.size() >= EXECUTOR_CACHE_MAX_ENTRIES && !EvictLeastRecent()) {
+            // 缓存项均处于占用状态，本次执行器按普通执行器交给调用者
+            return;
+        }
+        lru_.push_front(sig);
+        Entry entry = {executor, workspaceSize, lru_.begin(), true, {}};
+        entries_.emplace(std::move(sig), entry);
+    }
+
+    // 第二段接口下发后调用，解除执行器占用，可与Lookup不在同一线程；executor不在缓存中时不做处理
+    void MarkLaunched(const aclOpExecutor* executor)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& item : entries_) {
+            if (item.second.executor == executor) {
+                item.second.inFlight = false;
+                return;
+            }
+        }
+    }
+
+    // 最近一次命中时刷新的地址，按inputs、outputs顺序排列，供UT校验
+    bool GetBoundAddrs(const aclOpExecutor* executor, std::vector<const void*>& addrs) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& item : entries_) {
+            if (item.second.executor == executor) {
+                addrs = item.second.boundAddrs;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t Size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return entries_.size();
+    }
+
+    // 释放全部缓存项，需在已返回的执行器下发后调用，供UT在用例间重置缓存
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& item : entries_) {
+            aclDestroyAclOpExecutor(item.second.executor);
+        }
+        entries_.clear();
+        lru_.clear();
+    }
+
+private:
+    struct Entry {
+        aclOpExecutor* executor;
+        uint64_t workspaceSize;
+        std::list<ExecutorSignature>::iterator lruPos;
+        bool inFlight;
+        std::vector<const void*> boundAddrs;
+    };
+    using EntryMap = std::unordered_map<ExecutorSignature, Entry, ExecutorSignatureHash>;
+
+    ExecutorCache() = default;
+    ~ExecutorCache()
+    {
+        // 进程退出时释放仍在缓存中的执行器
+        for (auto& item : entries_) {
+            aclDestroyAclOpExecutor(item.second.executor);
+        }
+    }
+    ExecutorCache(const ExecutorCache&) = delete;
+    ExecutorCache& operator=(const ExecutorCache&) = delete;
+
+    static bool RebindAddr(
+        aclOpExecutor* executor, const std::vector<const aclTensor*>& inputs,
+        const std::vector<const aclTensor*>& outputs, std::vector<const void*>& boundAddrs)
+    {
+        boundAddrs.clear();
+        for (size_t i = 0; i < inputs.size(); i++) {
+            if (inputs[i] == nullptr) {
+                continue;
+            }
+            auto tensor = const_cast<aclTensor*>(inputs[i]);
+            if (aclSetInputTensorAddr(executor, i, tensor, tensor->GetStorageAddr()) != ACLNN_SUCCESS) {
+                return false;
+            }
+            boundAddrs.push_back(tensor->GetStorageAddr());
+        }
+        for (size_t i = 0; i < outputs.size(); i++) {
+            if (outputs[i] == nullptr) {
+                continue;
+            }
+            auto tensor = const_cast<aclTensor*>(outputs[i]);
+            if (aclSetOutputTensorAddr(executor, i, tensor, tensor->GetStorageAddr()) != ACLNN_SUCCESS) {
+                return false;
+            }
+            boundAddrs.push_back(tensor->GetStorageAddr());
+        }
+        return true;
+    }
+
+    // 从最久未用的一端找第一个未占用的缓存项淘汰，占用中的执行器仍被调用者持有，不能释放
+    bool EvictLeastRecent()
+    {
+        for (auto pos = lru_.rbegin(); pos != lru_.rend(); ++pos) {
+            auto victim = entries_.find(*pos);
+            if (victim != entries_.end() && !victim->second.inFlight) {
+                Evict(victim);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Evict(EntryMap::iterator it)
+    {
+        aclDestroyAclOpExecutor(it->second.executor);
+        lru_.erase(it->second.lruPos);
+        entries_.erase(it);
+        EvictCounter().fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static std::atomic<uint64_t>& HitCounter()
+    {
+        static std::atomic<uint64_t> counter{0};
+        return counter;
+    }
+
+    static std::atomic<uint64_t>& MissCounter()
+    {
+        static std::atomic<uint64_t> counter{0};
+        return counter;
+    }
+
+    static std::atomic<uint64_t>& EvictCounter()
+    {
+        static std::atomic<uint64_t> counter{0};
+        return counter;
+    }
+
+    static std::atomic<uint64_t>& BusyCounter()
+    {
+        static std::atomic<uint64_t> counter{0};
+        return counter;
+    }
+
+    // -1表示尚未读取环境变量
+    static std::atomic<int32_t>& EnabledState()
+    {
+        static std::atomic<int32_t> state{-1};
+        return state;
+    }
+
+    mutable std::mutex mutex_;
+    std::list<ExecutorSignature> lru_;
+    EntryMap entries_;
+};
+} // namespace op
+
+#endif // LEVEL2_EXECUTOR_CACHE_H_MATH
@@ -0,0 +1,142 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file elewise_dag_fusion.h
+ * \brief Composition of arch35 elementwise DAGs from reusable fragments, so a chain of ops becomes one kernel.
+ *
+ * A fragment is a type that maps its upstream node to a new node:
+ *   template <typename In> using Apply = Bind<Vec::Xxx<...>, In, ...>;
+ * Chain<Node, F1, F2, ...> applies the fragments in order, FragSeq<F1, F2, ...> packs a chain into a single
+ * fragment, and FusedUnaryDag<InT, OutT, F1, F2, ...> wraps a chain between CopyIn and CopyOut into an OpDag that
+ * ElewiseBaseTiling::DoTiling and the elementwise kernel schedule consume as one kernel, e.g.
+ *   FusedUnaryDag<half, uint8_t, UpcastFrag<half>, AbsFrag<float>, IsFiniteMaskFrag<float>, MaskToBoolFrag>::OpDag
+ * is cast -> abs -> compare -> select -> copy out without any intermediate tensor in GM.
+ * Every op shares the fragments below, new ops should add their fragments here instead of spelling out Binds.
+ * Header shared by host tiling (through common/inc) and kernel (through ../common).
+ */
+#ifndef ELEWISE_DAG_FUSION_H
+#define ELEWISE_DAG_FUSION_H
+
+#include "atvoss/util/dag.h"
+#include "atvoss/util/vec.h"
+#include "atvoss/util/placeholder.h"
+
+#ifndef INFINITY
+#define INFINITY (__builtin_inff())
+#endif
+
+namespace ElewiseDagFusion {
+using namespace Ops::Base;
+
+constexpr int32_t CAST_MODE_NONE = 0;
+constexpr int32_t CAST_MODE_RINT = 1;
+constexpr int32_t CMP_MODE_LT = 0;
+constexpr int32_t CMP_MODE_GT = 1;
+constexpr int32_t CMP_MODE_EQ = 2;
+constexpr int32_t SEL_MODE_TS = 1; // tensor scalar mode
+constexpr float DAG_CONST_INF = INFINITY;
+
+template <typename Node, typename... Frags>
+struct ChainImpl {
+    using Type = Node;
+};
+
+template <typename Node, typename Frag, typename... Rest>
+struct ChainImpl<Node, Frag, Rest...> {
+    using Type = typename ChainImpl<typename Frag::template Apply<Node>, Rest...>::Type;
+};
+
+// Node with the fragments applied from left to right.
+template <typename Node, typename... Frags>
+using Chain = typename ChainImpl<Node, Frags...>::Type;
+
+// A chain of fragments used as one fragment.
+template <typename... Frags>
+struct FragSeq {
+    template <typename In>
+    using Apply = Chain<In, Frags...>;
+};
+
+// ---------------------------------------------------------------------------------------------------------------
+// Fragment registry
+// ---------------------------------------------------------------------------------------------------------------
+// y = cast<To>(x)
+template <typename To, typename From, int32_t MODE = CAST_MODE_NONE>
+struct CastFrag {
+    template <typename In>
+    using Apply = Bind<Vec::Cast<To, From, MODE>, In>;
+};
+
+// Cast the input into the compute type, float by default.
+template <typename U, typename T = float>
+using UpcastFrag = CastFrag<T, U, CAST_MODE_NONE>;
+
+// Round the compute type back to the output type.
+template <typename U, typename T = float>
+using DowncastFrag = CastFrag<U, T, CAST_MODE_RINT>;
+
+// y = |x|
+template <typename T>
+struct AbsFrag {
+    template <typename In>
+    using Apply = Bind<Vec::Abs<T>, In>;
+};
+
+// mask = x CMP rhs, rhs is a constant made by MAKE_CONST
+template <typename T, int32_t CMP_MODE, typename ConstRhs>
+struct CompareConstFrag {
+    template <typename In>
+    using Apply = Bind<Vec::Compare<uint8_t, T, CMP_MODE>, In, ConstRhs>;
+};
+
+template <typename T>
+struct InfConst {
+    using Type = MAKE_CONST(T, DAG_CONST_INF);
+};
+
+// mask = |x| < inf, the input is expected to be |x|
+template <typename T>
+using IsFiniteMaskFrag = CompareConstFrag<T, CMP_MODE_LT, typename InfConst<T>::Type>;
+
+// mask = |x| == inf, the input is expected to be |x|
+template <typename T>
+using IsInfMaskFrag = CompareConstFrag<T, CMP_MODE_EQ, typename InfConst<T>::Type>;
+
+// bool(uint8) = mask ? 1 : 0
+struct MaskToBoolFrag {
+    using ConstOne = MAKE_CONST(uint8_t, 1);
+    using ConstZero = MAKE_CONST(uint8_t, 0);
+    using Ones = Bind<Vec::Duplicate<uint8_t>, ConstOne>;
+    template <typename In>
+    using Apply = Bind<Vec::Select<uint8_t, uint8_t, SEL_MODE_TS>, In, Ones, ConstZero>;
+};
+
+// |cast<T>(x)|, the common prefix of the float classification ops
+template <typename U, typename T = float>
+using UpcastAbsFrag = FragSeq<UpcastFrag<U, T>, AbsFrag<T>>;
+
+// ---------------------------------------------------------------------------------------------------------------
+// Fused DAG
+// ---------------------------------------------------------------------------------------------------------------
+// One input, one output: CopyIn -> fragments -> CopyOut as a single schedulable DAG.
+template <typename InT, typename OutT, typename... Frags>
+struct FusedUnaryDag {
+    using OpCopyIn = Bind<Vec::CopyIn<InT>, Placeholder::In0<InT>>;
+    using OpCompute = Chain<OpCopyIn, Frags...>;
+    using OpCopyOut = Bind<Vec::CopyOut<OutT>, Placeholder::Out0<OutT>, OpCompute>;
+    using Outputs = Elems<OpCopyOut>;
+    using MemCfg = MemOptCfg<MemLevel::LEVEL_2>;
+    using OpDag = DAGSch<Outputs, void, MemCfg>;
+};
+} // namespace ElewiseDagFusion
+
+#endif // ELEWISE_DAG_FUSION_H
@@ -0,0 +1,264 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file multi_tensor_apply.h
+ * \brief Shared kernel skeleton applying one elementwise functor over whole tensor lists in a single launch.
+ *
+ * The core split comes from Ops::Math::OpTiling::SplitTensorListToCores, so the tiling data must provide:
+ *   maxProcCount, scalar, tensorDataCountList, tensorStartList, tensorEndList,
+ *   tensorStartOffsetList, tensorEndOffsetList.
+ * A functor provides:
+ *   static constexpr int32_t INPUT_NUM;  // number of input lists read, 1 ~ MTA_MAX_INPUT_NUM
+ *   static __aicore__ inline void Compute(const LocalTensor<float>& dst, const LocalTensor<float> (&src)[N],
+ *       const LocalTensor<float>& tmp, float scalar, uint32_t count);
+ * A functor may instead declare ARG_NUM (1 ~ MTA_MAX_ARG_NUM) to take per-tensor arguments: Init is then given an
+ * args address holding ARG_NUM floats per tensor, the tiling data needs no scalar, and Compute receives
+ *       const float (&args)[MTA_MAX_ARG_NUM]
+ * in place of the scalar, so different tensors of one launch can run different computations.
+ * Computation is done in float, float16/bfloat16 inputs are cast in and rounded back on the way out.
+ */
+#ifndef MULTI_TENSOR_APPLY_H
+#define MULTI_TENSOR_APPLY_H
+
+#include "kernel_operator.h"
+
+namespace MultiTensorApply {
+
+using namespace AscendC;
+constexpr int32_t MTA_BUFFER_NUM = 2;
+constexpr uint32_t MTA_BYTE_BLOCK = 32;
+constexpr int32_t MTA_MAX_INPUT_NUM = 3;
+constexpr int32_t MTA_MAX_ARG_NUM = 4;
+
+template <typename... Ts>
+struct MtaVoid {
+    using type = void;
+};
+
+// Number of per-tensor arguments of a functor, 0 when it uses the tiling scalar.
+template <typename Functor, typename = void>
+struct MtaFunctorArgNum {
+    static constexpr int32_t value = 0;
+};
+
+template <typename Functor>
+struct MtaFunctorArgNum<Functor, typename MtaVoid<decltype(Functor::ARG_NUM)>::type> {
+    static constexpr int32_t value = Functor::ARG_NUM;
+};
+
+template <typename T>
+__aicore__ inline __gm__ T* GetTensorAddr(GM_ADDR tensorListPtr, uint16_t index)
+{
+    __gm__ uint64_t* dataAddr = reinterpret_cast<__gm__ uint64_t*>(tensorListPtr);
+    uint64_t tensorPtrOffset = *dataAddr; // The offset of the data address from the first address.
+    // Moving 3 bits to the right means dividing by sizeof(uint64 t).
+    __gm__ uint64_t* tensorPtr = dataAddr + (tensorPtrOffset >> 3);
+    return reinterpret_cast<__gm__ T*>(*(tensorPtr + index));
+}
+
+template <typename T, typename Functor, typename TilingData>
+class MultiTensorApplyND {
+public:
+    __aicore__ inline MultiTensorApplyND(){};
+    __aicore__ inline void Init(
+        GM_ADDR x1, GM_ADDR x2, GM_ADDR x3, GM_ADDR y, const TilingData* __restrict tilingData,
+        GM_ADDR args = nullptr);
+    __aicore__ inline void Process();
+
+private:
+    template <typename T1, typename T2>
+    __aicore__ inline T1 CeilAlignA2B(T1 a, T2 b)
+    {
+        return T1(b == 0 ? a : (a + b - 1) / b * b);
+    };
+
+    __aicore__ inline void ParseTilingData();
+    __aicore__ inline void SingleTensorProcess(uint16_t tensorIndex, int64_t cursorStart, int64_t dataCount);
+    __aicore__ inline void CopyIn(int64_t offset, uint32_t dataCount);
+    __aicore__ inline void Compute(uint32_t dataCount);
+    __aicore__ inline void CopyOut(int64_t offset, uint32_t dataCount);
+
+private:
+    static constexpr int32_t INPUT_NUM = Functor::INPUT_NUM;
+    static constexpr int32_t ARG_NUM = MtaFunctorArgNum<Functor>::value;
+    static constexpr bool IS_FLOAT = IsSameType<T, float>::value;
+
+    TPipe pipe;
+    TQue<QuePosition::VECIN, MTA_BUFFER_NUM> copyInQueue;
+    TQue<QuePosition::VECOUT, MTA_BUFFER_NUM> copyOutQueue;
+    TBuf<QuePosition::VECCALC> calcBuf;
+    GM_ADDR inListPtr[MTA_MAX_INPUT_NUM] = {nullptr};
+    GM_ADDR outListPtr = nullptr;
+    GlobalTensor<T> inGM[MTA_MAX_INPUT_NUM];
+    GlobalTensor<T> outGM;
+    GlobalTensor<float> argsGM;
+    float tensorArgs[MTA_MAX_ARG_NUM] = {0.0f};
+    int64_t blockIdx = 0;
+    int32_t perBlockCount = 0;
+
+    // tiling params
+    const TilingData* __restrict tilingDataInClass = nullptr;
+    uint32_t maxProcCount = 0;
+    float scalar = 0.0f;
+    const int64_t* __restrict tensorDataCountList = nullptr;
+    uint16_t tensorStart = 0;
+    uint16_t tensorEnd = 0;
+    int64_t tensorStartOffset = 0;
+    int64_t tensorEndOffset = 0;
+};
+
+template <typename T, typename Functor, typename TilingData>
+__aicore__ inline void MultiTensorApplyND<T, Functor, TilingData>::Init(
+    GM_ADDR x1, GM_ADDR x2, GM_ADDR x3, GM_ADDR y, const TilingData* __restrict tilingData, GM_ADDR args)
+{
+    static_assert(INPUT_NUM > 0 && INPUT_NUM <= MTA_MAX_INPUT_NUM, "functor input num out of range");
+    static_assert(ARG_NUM >= 0 && ARG_NUM <= MTA_MAX_ARG_NUM, "functor arg num out of range");
+    tilingDataInClass = tilingData;
+    blockIdx = GetBlockIdx();
+    inListPtr[0] = x1;
+    inListPtr[1] = x2;
+    inListPtr[2] = x3;
+    outListPtr = y;
+    if constexpr (ARG_NUM > 0) {
+        argsGM.SetGlobalBuffer(reinterpret_cast<__gm__ float*>(args));
+    }
+    ParseTilingData();
+    perBlockCount = MTA_BYTE_BLOCK / sizeof(T);
+
+    pipe.InitBuffer(copyInQueue, MTA_BUFFER_NUM, INPUT_NUM * maxProcCount * sizeof(T));
+    pipe.InitBuffer(copyOutQueue, MTA_BUFFER_NUM, maxProcCount * sizeof(T));
+    if constexpr (IS_FLOAT) {
+        pipe.InitBuffer(calcBuf, maxProcCount * sizeof(float));
+    } else {
+        // float copies of every input, the float result and the functor scratch.
+        pipe.InitBuffer(calcBuf, (INPUT_NUM + 2) * maxProcCount * sizeof(float));
+    }
+}
+
+template <typename T, typename Functor, typename TilingData>
+__aicore__ inline void MultiTensorApplyND<T, Functor, TilingData>::ParseTilingData()
+{
+    maxProcCount = tilingDataInClass->maxProcCount;
+    if constexpr (ARG_NUM == 0) {
+        scalar = tilingDataInClass->scalar;
+    }
+    tensorDataCountList = tilingDataInClass->tensorDataCountList;
+    tensorStart = tilingDataInClass->tensorStartList[blockIdx];
+    tensorEnd = tilingDataInClass->tensorEndList[blockIdx];
+    tensorStartOffset = tilingDataInClass->tensorStartOffsetList[blockIdx];
+    tensorEndOffset = tilingDataInClass->tensorEndOffsetList[blockIdx];
+}
+
+template <typename T, typename Functor, typename TilingData>
+__aicore__ inline void MultiTensorApplyND<T, Functor, TilingData>::Process()
+{
+    for (uint16_t i = tensorStart; i <= tensorEnd; i++) {
+        int64_t cursorStart = 0;
+        int64_t cursorEnd = tensorDataCountList[i] - 1;
+        if (i == tensorStart) {
+            cursorStart = tensorStartOffset;
+        }
+        if (i == tensorEnd && tensorEndOffset < cursorEnd) {
+            cursorEnd = tensorEndOffset;
+        }
+        if (cursorEnd < cursorStart) {
+            continue;
+        }
+        SingleTensorProcess(i, cursorStart, cursorEnd - cursorStart + 1);
+    }
+}
+
+template <typename T, typename Functor, typename TilingData>
+__aicore__ inline void MultiTensorApplyND<T, Functor, TilingData>::SingleTensorProcess(
+    uint16_t tensorIndex, int64_t cursorStart, int64_t dataCount)
+{
+    for (int32_t k = 0; k < INPUT_NUM; k++) {
+        inGM[k].SetGlobalBuffer(GetTensorAddr<T>(inListPtr[k], tensorIndex) + cursorStart);
+    }
+    outGM.SetGlobalBuffer(GetTensorAddr<T>(outListPtr, tensorIndex) + cursorStart);
+    if constexpr (ARG_NUM > 0) {
+        for (int32_t k = 0; k < ARG_NUM; k++) {
+            tensorArgs[k] = argsGM.GetValue(static_cast<uint64_t>(tensorIndex) * ARG_NUM + k);
+        }
+    }
+
+    int64_t copyTimes = (dataCount + maxProcCount - 1) / maxProcCount;
+    for (int64_t i = 0; i < copyTimes; i++) {
+        uint32_t tempCount = maxProcCount;
+        if (i + 1 == copyTimes && dataCount % maxProcCount) {
+            tempCount = dataCount % maxProcCount;
+        }
+        CopyIn(i * maxProcCount, tempCount);
+        Compute(tempCount);
+        CopyOut(i * maxProcCount, tempCount);
+    }
+}
+
+template <typename T, typename Functor, typename TilingData>
+__aicore__ inline void MultiTensorApplyND<T, Functor, TilingData>::CopyIn(int64_t offset, uint32_t dataCount)
+{
+    LocalTensor<T> copyInLT = copyInQueue.AllocTensor<T>();
+    DataCopyExtParams copyParams = {1, static_cast<uint32_t>(dataCount * sizeof(T)), 0, 0, 0};
+    DataCopyPadExtParams<T> padParams = {true, 0, 0, 0};
+    padParams.rightPadding = CeilAlignA2B(dataCount, perBlockCount) - dataCount;
+    for (int32_t k = 0; k < INPUT_NUM; k++) {
+        DataCopyPad(copyInLT[k * maxProcCount], inGM[k][offset], copyParams, padParams);
+    }
+    copyInQueue.EnQue(copyInLT);
+}
+
+template <typename T, typename Functor, typename TilingData>
+__aicore__ inline void MultiTensorApplyND<T, Functor, TilingData>::Compute(uint32_t dataCount)
+{
+    LocalTensor<T> computeInLT = copyInQueue.DeQue<T>();
+    LocalTensor<T> computeOutLT = copyOutQueue.AllocTensor<T>();
+    uint32_t alignedCount = CeilAlignA2B(dataCount, perBlockCount);
+    LocalTensor<float> srcLT[INPUT_NUM];
+    if constexpr (IS_FLOAT) {
+        for (int32_t k = 0; k < INPUT_NUM; k++) {
+            srcLT[k] = computeInLT[k * maxProcCount];
+        }
+        if constexpr (ARG_NUM > 0) {
+            Functor::Compute(computeOutLT, srcLT, calcBuf.Get<float>(), tensorArgs, alignedCount);
+        } else {
+            Functor::Compute(computeOutLT, srcLT, calcBuf.Get<float>(), scalar, alignedCount);
+        }
+    } else {
+        LocalTensor<float> calcLT = calcBuf.Get<float>();
+        for (int32_t k = 0; k < INPUT_NUM; k++) {
+            srcLT[k] = calcLT[k * maxProcCount];
+            Cast(srcLT[k], computeInLT[k * maxProcCount], RoundMode::CAST_NONE, alignedCount);
+        }
+        LocalTensor<float> dstLT = calcLT[INPUT_NUM * maxProcCount];
+        if constexpr (ARG_NUM > 0) {
+            Functor::Compute(dstLT, srcLT, calcLT[(INPUT_NUM + 1) * maxProcCount], tensorArgs, alignedCount);
+        } else {
+            Functor::Compute(dstLT, srcLT, calcLT[(INPUT_NUM + 1) * maxProcCount], scalar, alignedCount);
+        }
+        Cast(computeOutLT, dstLT, RoundMode::CAST_RINT, alignedCount);
+    }
+    copyInQueue.FreeTensor(computeInLT);
+    copyOutQueue.EnQue(computeOutLT);
+}
+
+template <typename T, typename Functor, typename TilingData>
+__aicore__ inline void MultiTensorApplyND<T, Functor, TilingData>::CopyOut(int64_t offset, uint32_t dataCount)
+{
+    LocalTensor<T> copyOutLT = copyOutQueue.DeQue<T>();
+    DataCopyExtParams copyParams = {1, static_cast<uint32_t>(dataCount * sizeof(T)), 0, 0, 0};
+    DataCopyPad(outGM[offset], copyOutLT, copyParams);
+    copyOutQueue.FreeTensor(copyOutLT);
+}
+
+} // namespace MultiTensorApply
+
+#endif // MULTI_TENSOR_APPLY_H
@@ -0,0 +1,52 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file elewise_dag_tiling.h
+ * \brief Single tiling entry for an elementwise DAG instantiated per input dtype, see op_kernel/elewise_dag_fusion.h.
+ */
+
+#pragma once
+
+#include "elewise/elewise_tiling.h"
+#include "graph/types.h"
+
+namespace Ops {
+namespace Math {
+namespace OpTiling {
+/**
+ * Run ElewiseBaseTiling::DoTiling on DagOf<U>, U being the kernel type of inputDtype (float16, bfloat16 or float).
+ * DagOf maps the input type to an OpDag, e.g. template <typename U> using XxxOpDag = typename XxxDag<U>::OpDag.
+ * apiBuffer: extra UB reserved for the ascend api, 0 to use the DoTiling default.
+ * Returns GRAPH_FAILED for other dtypes or when the base tiling fails.
+ */
+template <template <typename> class DagOf>
+ge::graphStatus DoElewiseDagTiling(
+    Ops::Base::ElewiseBaseTiling& baseTiling, Ops::Base::EleBaseTilingDataV2& tilingData, ge::DataType inputDtype,
+    int64_t apiBuffer = 0)
+{
+    if (inputDtype == ge::DT_FLOAT16) {
+        return apiBuffer > 0 ? baseTiling.DoTiling<DagOf<half>>(tilingData, apiBuffer) :
+                               baseTiling.DoTiling<DagOf<half>>(tilingData);
+    }
+    if (inputDtype == ge::DT_BF16) {
+        return apiBuffer > 0 ? baseTiling.DoTiling<DagOf<bfloat16_t>>(tilingData, apiBuffer) :
+                               baseTiling.DoTiling<DagOf<bfloat16_t>>(tilingData);
+    }
+    if (inputDtype == ge::DT_FLOAT) {
+        return apiBuffer > 0 ? baseTiling.DoTiling<DagOf<float>>(tilingData, apiBuffer) :
+                               baseTiling.DoTiling<DagOf<float>>(tilingData);
+    }
+    return ge::GRAPH_FAILED;
+}
+} // namespace OpTiling
+} // namespace Math
+} // namespace Ops
@@ -0,0 +1,47 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file multi_tensor_apply_tiling.h
+ * \brief Splitting of a dynamic tensor list across cores, shared by the tensor list ops.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace Ops {
+namespace Math {
+namespace OpTiling {
+// Fixed cost of starting a tensor segment on a core (address fetch, first MTE2 latency), counted in bytes.
+constexpr int64_t TENSOR_SEGMENT_OVERHEAD_BYTES = 8192;
+
+struct TensorListSplitInfo {
+    uint16_t* tensorStartList = nullptr;
+    uint16_t* tensorEndList = nullptr;
+    int64_t* tensorStartOffsetList = nullptr;
+    int64_t* tensorEndOffsetList = nullptr;
+};
+
+/**
+ * Split a tensor list across cores by bytes plus a fixed cost per tensor segment: large tensors are split across
+ * cores and runs of small tensors are packed onto one core. Each core gets the inclusive range
+ * [tensorStartList[i]:tensorStartOffsetList[i], tensorEndList[i]:tensorEndOffsetList[i]] in elements.
+ * alignedCountList: element count of every tensor aligned up to blockElements.
+ * needCoreNum: upper bound of cores to use.
+ * Returns the number of cores actually used.
+ */
+uint32_t SplitTensorListToCores(
+    const int64_t* alignedCountList, int32_t tensorCount, int32_t dtypeSize, int32_t blockElements,
+    uint32_t needCoreNum, TensorListSplitInfo& splitInfo);
+} // namespace OpTiling
+} // namespace Math
+} // namespace Ops
@@ -0,0 +1,91 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file multi_tensor_apply_tiling.cpp
+ * \brief
+ */
+
+#include <algorithm>
+#include "tiling_base/multi_tensor_apply_tiling.h"
+
+namespace Ops {
+namespace Math {
+namespace OpTiling {
+constexpr int64_t MIN_SEGMENTS_PER_CORE = 2;
+
+uint32_t SplitTensorListToCores(
+    const int64_t* alignedCountList, int32_t tensorCount, int32_t dtypeSize, int32_t blockElements,
+    uint32_t needCoreNum, TensorListSplitInfo& splitInfo)
+{
+    if (alignedCountList == nullptr || tensorCount <= 0 || dtypeSize <= 0 || blockElements <= 0 ||
+        needCoreNum == 0) {
+        return 0;
+    }
+    int64_t totalCount = 0;
+    for (int32_t i = 0; i < tensorCount; i++) {
+        totalCount += alignedCountList[i];
+    }
+    int64_t segmentCost = std::max(TENSOR_SEGMENT_OVERHEAD_BYTES / dtypeSize, int64_t(blockElements));
+    int64_t totalCost = totalCount + segmentCost * tensorCount;
+    // Every core should get at least two segments worth of work, otherwise the setup cost dominates.
+    needCoreNum = uint32_t(
+        std::max(std::min(int64_t(needCoreNum), totalCost / (MIN_SEGMENTS_PER_CORE * segmentCost)), int64_t(1)));
+    // Each cut inside a tensor adds one more segment.
+    int64_t perCoreCost =
+        (totalCost + segmentCost * (int64_t(needCoreNum) - 1) + int64_t(needCoreNum) - 1) / int64_t(needCoreNum);
+
+    uint16_t coreIndex = 0;
+    int64_t coreCost = 0;
+    splitInfo.tensorStartList[coreIndex] = 0;
+    splitInfo.tensorStartOffsetList[coreIndex] = 0;
+    for (uint16_t i = 0; i < tensorCount; i++) {
+        int64_t cursorPos = (splitInfo.tensorStartList[coreIndex] == i) ? splitInfo.tensorStartOffsetList[coreIndex] : 0;
+        while (cursorPos < alignedCountList[i]) {
+            int64_t remainCount = alignedCountList[i] - cursorPos;
+            coreCost += segmentCost;
+            bool isLastCore = (coreIndex + 1U == needCoreNum);
+            if (isLastCore || coreCost + remainCount < perCoreCost) {
+                coreCost += remainCount;
+                cursorPos = alignedCountList[i];
+                break;
+            }
+            // The current core is full inside this tensor, take at least one block and cut.
+            int64_t takeCount = std::max(perCoreCost - coreCost, int64_t(1));
+            takeCount = (takeCount + blockElements - 1) / blockElements * blockElements;
+            takeCount = std::min(takeCount, remainCount);
+            cursorPos += takeCount;
+            splitInfo.tensorEndList[coreIndex] = i;
+            splitInfo.tensorEndOffsetList[coreIndex] = cursorPos - 1;
+            coreCost = 0;
+            if (i + 1 == tensorCount && cursorPos == alignedCountList[i]) {
+                break;
+            }
+            coreIndex++;
+            if (cursorPos < alignedCountList[i]) {
+                splitInfo.tensorStartList[coreIndex] = i;
+                splitInfo.tensorStartOffsetList[coreIndex] = cursorPos;
+            } else {
+                splitInfo.tensorStartList[coreIndex] = i + 1;
+                splitInfo.tensorStartOffsetList[coreIndex] = 0;
+            }
+        }
+    }
+    if (coreCost != 0) {
+        splitInfo.tensorEndList[coreIndex] = tensorCount - 1;
+        splitInfo.tensorEndOffsetList[coreIndex] = alignedCountList[tensorCount - 1] - 1;
+    }
+    // Packing small tensors may leave trailing cores without work.
+    return uint32_t(coreIndex) + 1U;
+}
+} // namespace OpTiling
+} // namespace Math
+} // namespace Ops
@@ -0,0 +1,326 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file col2im_tiling.cpp
+ * \brief
+ */
+#include <algorithm>
+#include "col2im_tiling.h"
+#include "log/log.h"
+#include "register/op_def_registry.h"
+#include "tiling_base/tiling_templates_registry.h"
+#include "platform/platform_info.h"
+
+namespace optiling {
+constexpr int32_t X_INPUT_INDEX = 0;
+constexpr int32_t Y_OUTPUT_INDEX = 0;
+constexpr size_t KERNEL_SIZE_ATTR_INDEX = 0;
+constexpr size_t DILATION_ATTR_INDEX = 1;
+constexpr size_t PADDING_ATTR_INDEX = 2;
+constexpr size_t STRIDE_ATTR_INDEX = 3;
+constexpr size_t DIM_NUM_3D = 3;
+constexpr size_t DIM_NUM_4D = 4;
+constexpr size_t ARRAY_SIZE_2 = 2;
+constexpr uint32_t BYTE_BLOCK = 32;
+constexpr uint32_t FLOAT_BYTES = 4;
+constexpr uint32_t INT32_BYTES = 4;
+constexpr uint32_t HALF_NUM = 2;
+constexpr uint32_t RESERVED_UB = 1024;
+constexpr uint64_t MAX_BLOCK_COUNT = 4095; // DataCopyPad单次搬运的最大行数
+constexpr uint64_t MAX_STRIDE_BYTES = 0xFFFFFFFFUL;
+
+struct Col2imDtypeKey {
+    ge::DataType dtype;
+    uint64_t tilingKey;
+};
+
+static const Col2imDtypeKey DTYPE_KEYS[] = {
+    {ge::DT_FLOAT, 1},
+    {ge::DT_FLOAT16, 2},
+    {ge::DT_BF16, 3},
+};
+
+static inline uint64_t CeilDiv(uint64_t a, uint64_t b)
+{
+    return b == 0 ? a : (a + b - 1) / b;
+}
+
+static inline uint64_t CeilAlign(uint64_t a, uint64_t b)
+{
+    return CeilDiv(a, b) * b;
+}
+
+// 长度为1时H/W共用同一个值
+static bool GetPairAttr(
+    const gert::RuntimeAttrs* attrs, size_t index, int64_t defaultValue, int64_t& valueH, int64_t& valueW)
+{
+    const gert::TypedContinuousVector<int64_t>* list = attrs->GetListInt(index);
+    if (list == nullptr || list->GetSize() == 0) {
+        valueH = defaultValue;
+        valueW = defaultValue;
+        return true;
+    }
+    if (list->GetSize() != 1 && list->GetSize() != ARRAY_SIZE_2) {
+        return false;
+    }
+    valueH = list->GetData()[0];
+    valueW = list->GetData()[list->GetSize() - 1];
+    return true;
+}
+
+static ge::graphStatus GetAttrParams(gert::TilingContext* context, Col2imTilingData& tilingData)
+{
+    const gert::RuntimeAttrs* attrs = context->GetAttrs();
+    OP_CHECK_NULL_WITH_CONTEXT(context, attrs);
+    const gert::TypedContinuousVector<int64_t>* kernelSize = attrs->GetListInt(KERNEL_SIZE_ATTR_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, kernelSize);
+    OP_CHECK_IF(
+        kernelSize->GetSize() != ARRAY_SIZE_2,
+        OP_LOGE(context->GetNodeName(), "kernel_size should have 2 elements."), return ge::GRAPH_FAILED);
+    int64_t dilationH = 1;
+    int64_t dilationW = 1;
+    int64_t padH = 0;
+    int64_t padW = 0;
+    int64_t strideH = 1;
+    int64_t strideW = 1;
+    OP_CHECK_IF(
+        !GetPairAttr(attrs, DILATION_ATTR_INDEX, 1, dilationH, dilationW) ||
+            !GetPairAttr(attrs, PADDING_ATTR_INDEX, 0, padH, padW) ||
+            !GetPairAttr(attrs, STRIDE_ATTR_INDEX, 1, strideH, strideW),
+        OP_LOGE(context->GetNodeName(), "dilation, padding or stride size is invalid."), return ge::GRAPH_FAILED);
+    int64_t kernelH = kernelSize->GetData()[0];
+    int64_t kernelW = kernelSize->GetData()[1];
+    OP_CHECK_IF(
+        kernelH <= 0 || kernelW <= 0 || strideH <= 0 || strideW <= 0 || dilationH <= 0 || dilationW <= 0,
+        OP_LOGE(context->GetNodeName(), "kernel_size, stride and dilation should be positive."),
+        return ge::GRAPH_FAILED);
+    OP_CHECK_IF(
+        padH < 0 || padW < 0, OP_LOGE(context->GetNodeName(), "padding should not be negative."),
+        return ge::GRAPH_FAILED);
+    tilingData.set_kernelH(kernelH);
+    tilingData.set_kernelW(kernelW);
+    tilingData.set_strideH(strideH);
+    tilingData.set_strideW(strideW);
+    tilingData.set_dilationH(dilationH);
+    tilingData.set_dilationW(dilationW);
+    tilingData.set_padH(padH);
+    tilingData.set_padW(padW);
+    return ge::GRAPH_SUCCESS;
+}
+
+// 输出为[N, C, H, W]或[C, H, W]，输入为与之对应的[N, C * kh * kw, L]、[N, C, kh * kw, L]或[C * kh * kw, L]
+static ge::graphStatus GetShapeParams(gert::TilingContext* context, Col2imTilingData& tilingData)
+{
+    auto xShape = context->GetInputShape(X_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, xShape);
+    auto yShape = context->GetOutputShape(Y_OUTPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, yShape);
+    const gert::Shape& outShape = yShape->GetStorageShape();
+    size_t dimNum = outShape.GetDimNum();
+    OP_CHECK_IF(
+        dimNum != DIM_NUM_3D && dimNum != DIM_NUM_4D, OP_LOGE(context->GetNodeName(), "y should be 3D or 4D."),
+        return ge::GRAPH_FAILED);
+    int64_t batch = dimNum == DIM_NUM_4D ? outShape.GetDim(0) : 1;
+    int64_t channel = outShape.GetDim(dimNum - 3);
+    int64_t outH = outShape.GetDim(dimNum - 2);
+    int64_t outW = outShape.GetDim(dimNum - 1);
+    OP_CHECK_IF(
+        batch <= 0 || channel <= 0 || outH <= 0 || outW <= 0,
+        OP_LOGE(context->GetNodeName(), "y should not be empty."), return ge::GRAPH_FAILED);
+
+    int64_t kernelH = tilingData.get_kernelH();
+    int64_t kernelW = tilingData.get_kernelW();
+    int64_t spanH = outH + 2 * tilingData.get_padH() - (tilingData.get_dilationH() * (kernelH - 1) + 1);
+    int64_t spanW = outW + 2 * tilingData.get_padW() - (tilingData.get_dilationW() * (kernelW - 1) + 1);
+    OP_CHECK_IF(
+        spanH < 0 || spanW < 0, OP_LOGE(context->GetNodeName(), "kernel is larger than padded output."),
+        return ge::GRAPH_FAILED);
+    int64_t colH = spanH / tilingData.get_strideH() + 1;
+    int64_t colW = spanW / tilingData.get_strideW() + 1;
+
+    const gert::Shape& inShape = xShape->GetStorageShape();
+    size_t inDimNum = inShape.GetDimNum();
+    bool dimMatch = dimNum == DIM_NUM_4D ? (inDimNum == DIM_NUM_3D || inDimNum == DIM_NUM_4D) :
+                                           inDimNum == ARRAY_SIZE_2;
+    int64_t expectSize = batch * channel * kernelH * kernelW * colH * colW;
+    OP_CHECK_IF(
+        !dimMatch || inShape.GetDim(inDimNum - 1) != colH * colW || inShape.GetShapeSize() != expectSize,
+        OP_LOGE(
+            context->GetNodeName(), "x should hold [%ld, %ld, %ld] elements.", batch, channel * kernelH * kernelW,
+            colH * colW),
+        return ge::GRAPH_FAILED);
+
+    tilingData.set_batch(batch);
+    tilingData.set_channel(channel);
+    tilingData.set_outH(outH);
+    tilingData.set_outW(outW);
+    tilingData.set_colH(colH);
+    tilingData.set_colW(colW);
+    return ge::GRAPH_SUCCESS;
+}
+
+static bool CalcTilingData(uint32_t typeSize, uint32_t coreNum, uint32_t ubSize, Col2imTilingData& tilingData)
+{
+    uint64_t alignNum = BYTE_BLOCK / typeSize;
+    uint64_t batch = tilingData.get_batch();
+    uint64_t channel = tilingData.get_channel();
+    uint64_t outH = tilingData.get_outH();
+    uint64_t outW = tilingData.get_outW();
+    uint64_t colH = tilingData.get_colH();
+    uint64_t colW = tilingData.get_colW();
+    uint64_t kernelH = tilingData.get_kernelH();
+    uint64_t kernelW = tilingData.get_kernelW();
+    uint64_t kernelNum = kernelH * kernelW;
+    OP_CHECK_IF(
+        outH * outW * typeSize > MAX_STRIDE_BYTES || colH * colW * typeSize > MAX_STRIDE_BYTES,
+        OP_LOGE("Col2im", "row is too large."), return false);
+
+    // 滑窗行末尾的零元素作为越界或不整除位置的Gather目标
+    uint64_t colWAlign = CeilAlign(colW + 1, alignNum);
+    uint64_t wAlign = CeilAlign(outW, alignNum);
+    uint64_t kernelSpanH = (kernelH - 1) * tilingData.get_dilationH();
+    auto colHOf = [&](uint64_t hFactor) {
+        return std::min(colH, (hFactor - 1 + kernelSpanH) / tilingData.get_strideH() + 1);
+    };
+    // 每通道：滑窗数据、各kj的Gather偏移表、Gather结果、fp32累加区，低精度另需fp32转换与输出转换区
+    uint64_t castBytes = typeSize == FLOAT_BYTES ? 0 : FLOAT_BYTES;
+    uint64_t outBytes = typeSize == FLOAT_BYTES ? 0 : typeSize;
+    auto perChannelOf = [&](uint64_t hFactor) {
+        return kernelNum * colHOf(hFactor) * colWAlign * typeSize + kernelW * wAlign * INT32_BYTES +
+               wAlign * (typeSize + castBytes) + hFactor * wAlign * (FLOAT_BYTES + outBytes);
+    };
+
+    uint64_t hFactor = outH;
+    while (colHOf(hFactor) > MAX_BLOCK_COUNT || RESERVED_UB + perChannelOf(hFactor) > ubSize) {
+        if (hFactor == 1) {
+            return false;
+        }
+        hFactor = CeilDiv(hFactor, HALF_NUM);
+    }
+    uint64_t cFactor = std::min({channel, (ubSize - RESERVED_UB) / perChannelOf(hFactor), MAX_BLOCK_COUNT});
+
+    // 单元数不足核数时先减小通道块，仍不足再切输出行
+    uint64_t hBlocks = CeilDiv(outH, hFactor);
+    uint64_t cBlocks = CeilDiv(channel, cFactor);
+    if (batch * cBlocks * hBlocks < coreNum) {
+        cFactor = std::min(cFactor, CeilDiv(channel, CeilDiv(coreNum, batch * hBlocks)));
+        cBlocks = CeilDiv(channel, cFactor);
+    }
+    if (batch * cBlocks * hBlocks < coreNum) {
+        hFactor = std::min(hFactor, CeilDiv(outH, CeilDiv(coreNum, batch * cBlocks)));
+        hBlocks = CeilDiv(outH, hFactor);
+    }
+    uint64_t unitNum = batch * cBlocks * hBlocks;
+    uint64_t usedCoreNum = std::max<uint64_t>(1, std::min<uint64_t>(coreNum, unitNum));
+    tilingData.set_unitsPerCore(unitNum / usedCoreNum);
+    tilingData.set_tailUnits(unitNum % usedCoreNum);
+    tilingData.set_cFactor(static_cast<uint32_t>(cFactor));
+    tilingData.set_hFactor(static_cast<uint32_t>(hFactor));
+    tilingData.set_colHFactor(static_cast<uint32_t>(colHOf(hFactor)));
+    tilingData.set_colWAlign(static_cast<uint32_t>(colWAlign));
+    tilingData.set_wAlign(static_cast<uint32_t>(wAlign));
+    tilingData.set_usedCoreNum(static_cast<uint32_t>(usedCoreNum));
+    return true;
+}
+
+static void PrintTilingData(gert::TilingContext* context, Col2imTilingData& tilingData)
+{
+    const ge::char_t* nodeName = context->GetNodeName();
+    OP_LOGD(nodeName, "unitsPerCore: %lu", tilingData.get_unitsPerCore());
+    OP_LOGD(nodeName, "tailUnits: %lu", tilingData.get_tailUnits());
+    OP_LOGD(
+        nodeName, "y shape: [%ld, %ld, %ld, %ld]", tilingData.get_batch(), tilingData.get_channel(),
+        tilingData.get_outH(), tilingData.get_outW());
+    OP_LOGD(nodeName, "colH: %ld, colW: %ld", tilingData.get_colH(), tilingData.get_colW());
+    OP_LOGD(nodeName, "kernel: [%ld, %ld]", tilingData.get_kernelH(), tilingData.get_kernelW());
+    OP_LOGD(nodeName, "stride: [%ld, %ld]", tilingData.get_strideH(), tilingData.get_strideW());
+    OP_LOGD(nodeName, "dilation: [%ld, %ld]", tilingData.get_dilationH(), tilingData.get_dilationW());
+    OP_LOGD(nodeName, "padding: [%ld, %ld]", tilingData.get_padH(), tilingData.get_padW());
+    OP_LOGD(nodeName, "cFactor: %u", tilingData.get_cFactor());
+    OP_LOGD(nodeName, "hFactor: %u", tilingData.get_hFactor());
+    OP_LOGD(nodeName, "colHFactor: %u", tilingData.get_colHFactor());
+    OP_LOGD(nodeName, "colWAlign: %u", tilingData.get_colWAlign());
+    OP_LOGD(nodeName, "wAlign: %u", tilingData.get_wAlign());
+    OP_LOGD(nodeName, "usedCoreNum: %u", tilingData.get_usedCoreNum());
+}
+
+static ge::graphStatus Tiling4Col2im(gert::TilingContext* context)
+{
+    OP_LOGI(context->GetNodeName(), "Col2im tiling starts running");
+    auto compileInfo = reinterpret_cast<const Col2imCompileInfo*>(context->GetCompileInfo());
+    OP_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    OP_CHECK_IF(
+        compileInfo->vectorCoreNum <= 0 || compileInfo->ubByteSize <= RESERVED_UB,
+        OP_LOGE(context->GetNodeName(), "Failed to get core num or ub size."), return ge::GRAPH_FAILED);
+
+    auto xDesc = context->GetInputDesc(X_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, xDesc);
+    auto yDesc = context->GetOutputDesc(Y_OUTPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, yDesc);
+    ge::DataType dtype = xDesc->GetDataType();
+    OP_CHECK_IF(
+        yDesc->GetDataType() != dtype, OP_LOGE(context->GetNodeName(), "x and y should have the same dtype."),
+        return ge::GRAPH_FAILED);
+    uint64_t tilingKey = 0;
+    for (const auto& item : DTYPE_KEYS) {
+        if (item.dtype == dtype) {
+            tilingKey = item.tilingKey;
+        }
+    }
+    OP_CHECK_IF(
+        tilingKey == 0, OP_LOGE(context->GetNodeName(), "dtype is not supported."), return ge::GRAPH_FAILED);
+
+    Col2imTilingData tilingData;
+    OP_CHECK_IF(
+        GetAttrParams(context, tilingData) != ge::GRAPH_SUCCESS ||
+            GetShapeParams(context, tilingData) != ge::GRAPH_SUCCESS,
+        OP_LOGE(context->GetNodeName(), "get col2im params failed."), return ge::GRAPH_FAILED);
+    OP_CHECK_IF(
+        !CalcTilingData(
+            ge::GetSizeByDataType(dtype), compileInfo->vectorCoreNum, compileInfo->ubByteSize, tilingData),
+        OP_LOGE(context->GetNodeName(), "ub space is not enough, please check input."), return ge::GRAPH_FAILED);
+
+    context->SetTilingKey(tilingKey);
+    context->SetBlockDim(tilingData.get_usedCoreNum());
+    size_t* workspaces = context->GetWorkspaceSizes(1);
+    workspaces[0] = compileInfo->sysWorkspaceByteSize;
+    tilingData.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tilingData.GetDataSize());
+    PrintTilingData(context, tilingData);
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus TilingPrepare4Col2im(gert::TilingParseContext* context)
+{
+    auto compileInfo = context->GetCompiledInfo<Col2imCompileInfo>();
+    OP_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    auto platformInfo = context->GetPlatformInfo();
+    OP_CHECK_NULL_WITH_CONTEXT(context, platformInfo);
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(platformInfo);
+    compileInfo->vectorCoreNum = ascendcPlatform.GetCoreNumAiv();
+    OP_CHECK_IF(
+        (compileInfo->vectorCoreNum <= 0), OP_LOGE(context->GetNodeName(), "No vector core available."),
+        return ge::GRAPH_FAILED);
+    uint64_t ubByteSize;
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ubByteSize);
+    compileInfo->ubByteSize = ubByteSize;
+    OP_CHECK_IF(
+        (compileInfo->ubByteSize <= 0), OP_LOGE(context->GetNodeName(), "Failed to get ub size."),
+        return ge::GRAPH_FAILED);
+    compileInfo->sysWorkspaceByteSize = ascendcPlatform.GetLibApiWorkSpaceSize();
+    return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_OPTILING(Col2im)
+    .Tiling(Tiling4Col2im)
+    .TilingParse<Col2imCompileInfo>(TilingPrepare4Col2im);
+} // namespace optiling
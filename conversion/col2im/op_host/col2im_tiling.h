@@ -0,0 +1,54 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file col2im_tiling.h
+ * \brief
+ */
+#ifndef OPS_BUILT_IN_OP_TILING_RUNTIME_COL2IM_H_
+#define OPS_BUILT_IN_OP_TILING_RUNTIME_COL2IM_H_
+
+#include "register/tilingdata_base.h"
+
+namespace optiling {
+BEGIN_TILING_DATA_DEF(Col2imTilingData)
+TILING_DATA_FIELD_DEF(uint64_t, unitsPerCore); // 每核处理的(batch, 通道块, 输出行块)单元数
+TILING_DATA_FIELD_DEF(uint64_t, tailUnits);    // 前tailUnits个核多处理一个单元
+TILING_DATA_FIELD_DEF(int64_t, batch);
+TILING_DATA_FIELD_DEF(int64_t, channel);
+TILING_DATA_FIELD_DEF(int64_t, outH);
+TILING_DATA_FIELD_DEF(int64_t, outW);
+TILING_DATA_FIELD_DEF(int64_t, colH);          // 滑窗在H方向的个数
+TILING_DATA_FIELD_DEF(int64_t, colW);          // 滑窗在W方向的个数
+TILING_DATA_FIELD_DEF(int64_t, kernelH);
+TILING_DATA_FIELD_DEF(int64_t, kernelW);
+TILING_DATA_FIELD_DEF(int64_t, strideH);
+TILING_DATA_FIELD_DEF(int64_t, strideW);
+TILING_DATA_FIELD_DEF(int64_t, dilationH);
+TILING_DATA_FIELD_DEF(int64_t, dilationW);
+TILING_DATA_FIELD_DEF(int64_t, padH);
+TILING_DATA_FIELD_DEF(int64_t, padW);
+TILING_DATA_FIELD_DEF(uint32_t, cFactor);      // 每个单元处理的通道数
+TILING_DATA_FIELD_DEF(uint32_t, hFactor);      // 每个单元处理的输出行数
+TILING_DATA_FIELD_DEF(uint32_t, colHFactor);   // 一个单元最多用到的滑窗行数
+TILING_DATA_FIELD_DEF(uint32_t, colWAlign);    // 每个滑窗行在UB中的长度，末尾至少留一个零元素
+TILING_DATA_FIELD_DEF(uint32_t, wAlign);       // 输出行按32B对齐后的长度
+TILING_DATA_FIELD_DEF(uint32_t, usedCoreNum);
+END_TILING_DATA_DEF;
+REGISTER_TILING_DATA_CLASS(Col2im, Col2imTilingData)
+
+struct Col2imCompileInfo {
+    uint32_t vectorCoreNum;
+    uint32_t sysWorkspaceByteSize;
+    uint32_t ubByteSize;
+};
+} // namespace optiling
+#endif // OPS_BUILT_IN_OP_TILING_RUNTIME_COL2IM_H_
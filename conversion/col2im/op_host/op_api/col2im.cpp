@@ -0,0 +1,72 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file col2im.cpp
+ * \brief
+ */
+
+#include "col2im.h"
+#include "opdev/data_type_utils.h"
+#include "opdev/format_utils.h"
+#include "opdev/make_op_executor.h"
+#include "opdev/op_def.h"
+#include "opdev/op_dfx.h"
+#include "opdev/op_executor.h"
+#include "opdev/op_log.h"
+#include "opdev/platform.h"
+#include "opdev/shape_utils.h"
+
+using namespace op;
+
+namespace l0op {
+OP_TYPE_REGISTER(Col2im);
+
+static const std::initializer_list<op::DataType> AICORE_DTYPE_SUPPORT_LIST = {
+    DataType::DT_FLOAT, DataType::DT_FLOAT16, DataType::DT_BF16};
+
+bool IsCol2imSupport(const aclTensor* self)
+{
+    SocVersion socVersion = GetCurrentPlatformInfo().GetSocVersion();
+    if (socVersion != SocVersion::ASCEND910B && socVersion != SocVersion::ASCEND910_93) {
+        return false;
+    }
+    return CheckType(self->GetDataType(), AICORE_DTYPE_SUPPORT_LIST);
+}
+
+const aclTensor* Col2im(
+    const aclTensor* self, const aclIntArray* outputSize, const aclIntArray* kernelSize, const aclIntArray* dilation,
+    const aclIntArray* padding, const aclIntArray* stride, aclOpExecutor* executor)
+{
+    L0_DFX(Col2im, self, outputSize, kernelSize, dilation, padding, stride);
+
+    size_t dimNum = self->GetViewShape().GetDimNum();
+    int64_t channel = self->GetViewShape().GetDim(dimNum - 2) / ((*kernelSize)[0] * (*kernelSize)[1]);
+    Shape outShape;
+    if (dimNum == 2) {
+        outShape = {channel, (*outputSize)[0], (*outputSize)[1]};
+    } else {
+        outShape = {self->GetViewShape().GetDim(0), channel, (*outputSize)[0], (*outputSize)[1]};
+    }
+    auto out = executor->AllocTensor(outShape, self->GetDataType(), Format::FORMAT_ND);
+    CHECK_RET(out != nullptr, nullptr);
+    auto outputSizeTensor = executor->ConvertToTensor(outputSize, op::ToOpDataType(ACL_INT32));
+    CHECK_RET(outputSizeTensor != nullptr, nullptr);
+
+    auto ret = ADD_TO_LAUNCHER_LIST_AICORE(
+        Col2im, OP_INPUT(self, outputSizeTensor), OP_OUTPUT(out), OP_ATTR(kernelSize, dilation, padding, stride));
+    if (ret != ACLNN_SUCCESS) {
+        OP_LOGE(ACLNN_ERR_INNER_NULLPTR, "Col2im ADD_TO_LAUNCHER_LIST_AICORE failed.");
+        return nullptr;
+    }
+    return out;
+}
+} // namespace l0op
@@ -0,0 +1,31 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file col2im.h
+ * \brief
+ */
+
+#ifndef OP_API_INC_LEVEL0_COL2IM_H
+#define OP_API_INC_LEVEL0_COL2IM_H
+#include "opdev/op_executor.h"
+
+namespace l0op {
+// 芯片与dtype是否可走Col2im kernel
+bool IsCol2imSupport(const aclTensor* self);
+
+// self为[N, C * kh * kw, L]或[C * kh * kw, L]，outputSize为[H, W]，重叠窗口在kernel内按fp32累加
+const aclTensor* Col2im(
+    const aclTensor* self, const aclIntArray* outputSize, const aclIntArray* kernelSize, const aclIntArray* dilation,
+    const aclIntArray* padding, const aclIntArray* stride, aclOpExecutor* executor);
+} // namespace l0op
+
+#endif // OP_API_INC_LEVEL0_COL2IM_H
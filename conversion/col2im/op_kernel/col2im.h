@@ -0,0 +1,324 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file col2im.h
+ * \brief 按(通道块, 输出行块)切分的Col2im
+ *
+ * 每个输出元素只由一个单元计算，单元内以输出为中心做Gather：对每个输出行、每个(ki, kj)，滑窗行号由标量确定，
+ * W方向的取数位置与单元无关，预先为每个kj构造偏移表，不整除stride或越界的位置指向滑窗行末尾的零元素。
+ * Gather结果转fp32后按固定的(ki, kj)顺序累加，重叠窗口的求和顺序与核数无关，最后一次转换回原dtype写出。
+ */
+#ifndef COL2IM_H
+#define COL2IM_H
+
+#include "kernel_operator.h"
+
+namespace Col2im {
+using namespace AscendC;
+
+constexpr uint32_t BYTE_BLOCK = 32;
+constexpr uint32_t MAX_BLOCK_COUNT = 4095;
+
+template <typename T>
+class Col2imND {
+public:
+    __aicore__ inline Col2imND(){};
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR y, const Col2imTilingData* __restrict tilingData);
+    __aicore__ inline void Process();
+
+private:
+    __aicore__ inline void InitTilingParams(const Col2imTilingData* __restrict tilingData);
+    __aicore__ inline void InitOffsetTable();
+    __aicore__ inline void ProcessUnit(uint64_t unitIdx);
+    __aicore__ inline void LoadCol(
+        int64_t batchIdx, int64_t cStart, uint32_t cCount, int64_t colHStart, uint32_t colHCount);
+    __aicore__ inline void AccumulateRow(uint32_t rowIdx, uint32_t cCount, uint32_t colHIdx, int64_t ki);
+    __aicore__ inline void CopyOut(int64_t batchIdx, int64_t cStart, uint32_t cCount, int64_t hStart, uint32_t hCount);
+
+    template <typename T1>
+    __aicore__ inline T1 CeilDiv(T1 a, T1 b)
+    {
+        return b == 0 ? a : (a + b - 1) / b;
+    }
+
+    template <typename T1>
+    __aicore__ inline T1 CeilAlign(T1 a, T1 b)
+    {
+        return CeilDiv(a, b) * b;
+    }
+
+    template <typename T1>
+    __aicore__ inline T1 Min(T1 a, T1 b)
+    {
+        return a < b ? a : b;
+    }
+
+    template <HardEvent EVENT>
+    __aicore__ inline void SyncFlag()
+    {
+        event_t eventId = static_cast<event_t>(GetTPipePtr()->FetchEventID(EVENT));
+        SetFlag<EVENT>(eventId);
+        WaitFlag<EVENT>(eventId);
+    }
+
+private:
+    TPipe pipe;
+    TBuf<QuePosition::VECCALC> colBuf;
+    TBuf<QuePosition::VECCALC> tableBuf;
+    TBuf<QuePosition::VECCALC> gatherBuf;
+    TBuf<QuePosition::VECCALC> castBuf;
+    TBuf<QuePosition::VECCALC> accBuf;
+    TBuf<QuePosition::VECCALC> outBuf;
+    GlobalTensor<T> xGm;
+    GlobalTensor<T> yGm;
+
+    uint64_t unitStart = 0;
+    uint64_t coreUnitNum = 0;
+    int64_t channel = 0;
+    int64_t outH = 0;
+    int64_t outW = 0;
+    int64_t colH = 0;
+    int64_t colW = 0;
+    int64_t kernelH = 0;
+    int64_t kernelW = 0;
+    int64_t strideH = 1;
+    int64_t strideW = 1;
+    int64_t dilationH = 1;
+    int64_t dilationW = 1;
+    int64_t padH = 0;
+    int64_t padW = 0;
+    int64_t cBlocks = 0;
+    int64_t hBlocks = 0;
+    uint32_t cFactor = 0;
+    uint32_t hFactor = 0;
+    uint32_t colHFactor = 0;
+    uint32_t colWAlign = 0;
+    uint32_t wAlign = 0;
+    uint32_t alignNum = 0;
+};
+
+template <typename T>
+__aicore__ inline void Col2imND<T>::InitTilingParams(const Col2imTilingData* __restrict tilingData)
+{
+    uint64_t blockIdx = GetBlockIdx();
+    uint64_t unitsPerCore = tilingData->unitsPerCore;
+    uint64_t tailUnits = tilingData->tailUnits;
+    coreUnitNum = unitsPerCore + (blockIdx < tailUnits ? 1 : 0);
+    unitStart = blockIdx * unitsPerCore + (blockIdx < tailUnits ? blockIdx : tailUnits);
+    channel = tilingData->channel;
+    outH = tilingData->outH;
+    outW = tilingData->outW;
+    colH = tilingData->colH;
+    colW = tilingData->colW;
+    kernelH = tilingData->kernelH;
+    kernelW = tilingData->kernelW;
+    strideH = tilingData->strideH;
+    strideW = tilingData->strideW;
+    dilationH = tilingData->dilationH;
+    dilationW = tilingData->dilationW;
+    padH = tilingData->padH;
+    padW = tilingData->padW;
+    cFactor = tilingData->cFactor;
+    hFactor = tilingData->hFactor;
+    colHFactor = tilingData->colHFactor;
+    colWAlign = tilingData->colWAlign;
+    wAlign = tilingData->wAlign;
+    alignNum = BYTE_BLOCK / sizeof(T);
+    cBlocks = CeilDiv(channel, static_cast<int64_t>(cFactor));
+    hBlocks = CeilDiv(outH, static_cast<int64_t>(hFactor));
+}
+
+template <typename T>
+__aicore__ inline void Col2imND<T>::Init(GM_ADDR x, GM_ADDR y, const Col2imTilingData* __restrict tilingData)
+{
+    InitTilingParams(tilingData);
+    xGm.SetGlobalBuffer((__gm__ T*)x);
+    yGm.SetGlobalBuffer((__gm__ T*)y);
+
+    uint32_t colBytes = cFactor * kernelH * kernelW * colHFactor * colWAlign * sizeof(T);
+    pipe.InitBuffer(colBuf, colBytes);
+    pipe.InitBuffer(tableBuf, kernelW * cFactor * wAlign * sizeof(int32_t));
+    pipe.InitBuffer(gatherBuf, cFactor * wAlign * sizeof(T));
+    pipe.InitBuffer(accBuf, hFactor * cFactor * wAlign * sizeof(float));
+    if constexpr (!IsSameType<T, float>::value) {
+        pipe.InitBuffer(castBuf, cFactor * wAlign * sizeof(float));
+        pipe.InitBuffer(outBuf, hFactor * cFactor * wAlign * sizeof(T));
+    }
+
+    // 滑窗行末尾的零元素只在这里置零一次，之后搬入只覆盖有效列
+    LocalTensor<int16_t> colLocal = colBuf.Get<int16_t>();
+    Duplicate(colLocal, static_cast<int16_t>(0), colBytes / sizeof(int16_t));
+    InitOffsetTable();
+}
+
+// 输出列w在kj下对应滑窗列(w + padW - kj * dilationW) / strideW，偏移相对于该滑窗行首，通道间隔为一个通道的滑窗数据
+template <typename T>
+__aicore__ inline void Col2imND<T>::InitOffsetTable()
+{
+    LocalTensor<int32_t> tableLocal = tableBuf.Get<int32_t>();
+    int32_t typeSize = static_cast<int32_t>(sizeof(T));
+    for (int64_t kj = 0; kj < kernelW; kj++) {
+        uint32_t tableStart = kj * cFactor * wAlign;
+        for (int64_t w = 0; w < wAlign; w++) {
+            int64_t pos = w + padW - kj * dilationW;
+            int64_t colIdx = pos / strideW;
+            bool valid = w < outW && pos >= 0 && pos % strideW == 0 && colIdx < colW;
+            tableLocal.SetValue(tableStart + w, static_cast<int32_t>(valid ? colIdx : colW) * typeSize);
+        }
+    }
+    SyncFlag<HardEvent::S_V>();
+    int32_t channelBytes = static_cast<int32_t>(kernelH * kernelW * colHFactor * colWAlign) * typeSize;
+    for (int64_t kj = 0; kj < kernelW; kj++) {
+        LocalTensor<int32_t> kjTable = tableLocal[kj * cFactor * wAlign];
+        for (uint32_t c = 1; c < cFactor; c++) {
+            Adds(kjTable[c * wAlign], kjTable, static_cast<int32_t>(c) * channelBytes, wAlign);
+        }
+    }
+    PipeBarrier<PIPE_V>();
+}
+
+template <typename T>
+__aicore__ inline void Col2imND<T>::Process()
+{
+    for (uint64_t i = 0; i < coreUnitNum; i++) {
+        ProcessUnit(unitStart + i);
+    }
+}
+
+template <typename T>
+__aicore__ inline void Col2imND<T>::ProcessUnit(uint64_t unitIdx)
+{
+    int64_t blocksPerBatch = cBlocks * hBlocks;
+    int64_t batchIdx = static_cast<int64_t>(unitIdx) / blocksPerBatch;
+    int64_t rem = static_cast<int64_t>(unitIdx) % blocksPerBatch;
+    int64_t cStart = rem / hBlocks * cFactor;
+    int64_t hStart = rem % hBlocks * hFactor;
+    uint32_t cCount = static_cast<uint32_t>(Min(static_cast<int64_t>(cFactor), channel - cStart));
+    uint32_t hCount = static_cast<uint32_t>(Min(static_cast<int64_t>(hFactor), outH - hStart));
+
+    // 覆盖[hStart, hStart + hCount)的滑窗行范围
+    int64_t lowPos = hStart + padH - (kernelH - 1) * dilationH;
+    int64_t colHStart = lowPos <= 0 ? 0 : CeilDiv(lowPos, strideH);
+    int64_t colHEnd = Min(colH - 1, (hStart + hCount - 1 + padH) / strideH);
+    uint32_t colHCount = colHEnd >= colHStart ? static_cast<uint32_t>(colHEnd - colHStart + 1) : 0;
+
+    // 上一个单元的结果搬出后才能清零累加区
+    SyncFlag<HardEvent::MTE3_V>();
+    LocalTensor<float> accLocal = accBuf.Get<float>();
+    Duplicate(accLocal, 0.0f, hCount * cFactor * wAlign);
+    PipeBarrier<PIPE_V>();
+    if (colHCount > 0) {
+        LoadCol(batchIdx, cStart, cCount, colHStart, colHCount);
+        for (uint32_t row = 0; row < hCount; row++) {
+            for (int64_t ki = 0; ki < kernelH; ki++) {
+                int64_t pos = hStart + row + padH - ki * dilationH;
+                if (pos < 0 || pos % strideH != 0) {
+                    continue;
+                }
+                int64_t colHIdx = pos / strideH;
+                if (colHIdx < colHStart || colHIdx > colHEnd) {
+                    continue;
+                }
+                AccumulateRow(row, cCount, static_cast<uint32_t>(colHIdx - colHStart), ki);
+            }
+        }
+    }
+    CopyOut(batchIdx, cStart, cCount, hStart, hCount);
+}
+
+// 每个(通道, ki, kj)的滑窗数据取[colHStart, colHStart + colHCount)行，每行占colWAlign个元素
+template <typename T>
+__aicore__ inline void Col2imND<T>::LoadCol(
+    int64_t batchIdx, int64_t cStart, uint32_t cCount, int64_t colHStart, uint32_t colHCount)
+{
+    int64_t kernelNum = kernelH * kernelW;
+    int64_t colLen = colH * colW;
+    uint32_t rowNum = cCount * static_cast<uint32_t>(kernelNum);
+    uint32_t dstGap = (colWAlign - CeilAlign(static_cast<uint32_t>(colW), alignNum)) * sizeof(T) / BYTE_BLOCK;
+    DataCopyPadExtParams<T> padParams = {
+        true, 0, static_cast<uint8_t>(CeilAlign(static_cast<uint32_t>(colW), alignNum) - colW), static_cast<T>(0)};
+    uint64_t srcOffset = (batchIdx * channel + cStart) * kernelNum * colLen + colHStart * colW;
+    LocalTensor<T> colLocal = colBuf.Get<T>();
+
+    // 上一个单元的Gather读完后才能覆盖
+    SyncFlag<HardEvent::V_MTE2>();
+    if (colHCount == colH && colHFactor == colH && rowNum * colHCount <= MAX_BLOCK_COUNT) {
+        // 取全部滑窗行时各行在GM和UB上都是等间隔的，一次搬完
+        DataCopyExtParams copyParams = {
+            static_cast<uint16_t>(rowNum * colHCount), static_cast<uint32_t>(colW * sizeof(T)), 0, dstGap, 0};
+        DataCopyPad(colLocal, xGm[srcOffset], copyParams, padParams);
+    } else {
+        DataCopyExtParams copyParams = {
+            static_cast<uint16_t>(colHCount), static_cast<uint32_t>(colW * sizeof(T)), 0, dstGap, 0};
+        for (uint32_t r = 0; r < rowNum; r++) {
+            DataCopyPad(colLocal[r * colHFactor * colWAlign], xGm[srcOffset + r * colLen], copyParams, padParams);
+        }
+    }
+    SyncFlag<HardEvent::MTE2_V>();
+}
+
+// 输出行row在核行ki下对应滑窗行colHIdx，按kj顺序Gather后累加到fp32
+template <typename T>
+__aicore__ inline void Col2imND<T>::AccumulateRow(uint32_t rowIdx, uint32_t cCount, uint32_t colHIdx, int64_t ki)
+{
+    uint32_t count = cCount * wAlign;
+    LocalTensor<float> accRow = accBuf.Get<float>()[rowIdx * cFactor * wAlign];
+    LocalTensor<uint32_t> tableLocal = tableBuf.Get<uint32_t>();
+    LocalTensor<T> gatherLocal = gatherBuf.Get<T>();
+    for (int64_t kj = 0; kj < kernelW; kj++) {
+        uint32_t rowStart = ((ki * kernelW + kj) * colHFactor + colHIdx) * colWAlign;
+        LocalTensor<uint32_t> kjTable = tableLocal[kj * cFactor * wAlign];
+        if constexpr (sizeof(T) == sizeof(half)) {
+            LocalTensor<half> dstHalf = gatherLocal.template ReinterpretCast<half>();
+            LocalTensor<half> srcHalf = colBuf.Get<half>()[rowStart];
+            Gather(dstHalf, srcHalf, kjTable, static_cast<uint32_t>(0), count);
+        } else {
+            LocalTensor<T> srcLocal = colBuf.Get<T>()[rowStart];
+            Gather(gatherLocal, srcLocal, kjTable, static_cast<uint32_t>(0), count);
+        }
+        PipeBarrier<PIPE_V>();
+        if constexpr (IsSameType<T, float>::value) {
+            Add(accRow, accRow, gatherLocal, count);
+        } else {
+            LocalTensor<float> castLocal = castBuf.Get<float>();
+            Cast(castLocal, gatherLocal, RoundMode::CAST_NONE, count);
+            PipeBarrier<PIPE_V>();
+            Add(accRow, accRow, castLocal, count);
+        }
+        PipeBarrier<PIPE_V>();
+    }
+}
+
+template <typename T>
+__aicore__ inline void Col2imND<T>::CopyOut(
+    int64_t batchIdx, int64_t cStart, uint32_t cCount, int64_t hStart, uint32_t hCount)
+{
+    LocalTensor<T> outLocal;
+    if constexpr (IsSameType<T, float>::value) {
+        outLocal = accBuf.Get<float>();
+    } else {
+        outLocal = outBuf.Get<T>();
+        Cast(outLocal, accBuf.Get<float>(), RoundMode::CAST_RINT, hCount * cFactor * wAlign);
+    }
+    SyncFlag<HardEvent::V_MTE3>();
+    // 同一输出行相邻通道在GM上间隔outH * outW个元素
+    DataCopyExtParams copyParams = {
+        static_cast<uint16_t>(cCount), static_cast<uint32_t>(outW * sizeof(T)), 0,
+        static_cast<uint32_t>((outH * outW - outW) * sizeof(T)), 0};
+    for (uint32_t row = 0; row < hCount; row++) {
+        uint64_t dstOffset = ((batchIdx * channel + cStart) * outH + hStart + row) * outW;
+        DataCopyPad(yGm[dstOffset], outLocal[row * cFactor * wAlign], copyParams);
+    }
+}
+} // namespace Col2im
+
+#endif // COL2IM_H
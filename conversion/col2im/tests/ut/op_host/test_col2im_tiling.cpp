@@ -0,0 +1,181 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file test_col2im_tiling.cpp
+ * \brief
+ */
+
+#include <iostream>
+#include <vector>
+#include <gtest/gtest.h>
+#include "../../../op_host/col2im_tiling.h"
+#include "tiling_context_faker.h"
+#include "tiling_case_executor.h"
+
+class Col2imTiling : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        std::cout << "Col2imTiling SetUp" << std::endl;
+    }
+    static void TearDownTestCase()
+    {
+        std::cout << "Col2imTiling TearDown" << std::endl;
+    }
+};
+
+static std::vector<gert::TilingContextPara::OpAttr> BuildAttrs(
+    const std::vector<int64_t>& kernelSize, const std::vector<int64_t>& dilation, const std::vector<int64_t>& padding,
+    const std::vector<int64_t>& stride)
+{
+    return {
+        gert::TilingContextPara::OpAttr(
+            "kernel_size", Ops::Math::AnyValue::CreateFrom<std::vector<int64_t>>(kernelSize)),
+        gert::TilingContextPara::OpAttr("dilation", Ops::Math::AnyValue::CreateFrom<std::vector<int64_t>>(dilation)),
+        gert::TilingContextPara::OpAttr("padding", Ops::Math::AnyValue::CreateFrom<std::vector<int64_t>>(padding)),
+        gert::TilingContextPara::OpAttr("stride", Ops::Math::AnyValue::CreateFrom<std::vector<int64_t>>(stride))};
+}
+
+TEST_F(Col2imTiling, col2im_tiling_float_pad)
+{
+    optiling::Col2imCompileInfo compileInfo = {64, 16777216, 196608};
+    std::vector<int32_t> outputSize = {56, 56};
+    gert::TilingContextPara tilingContextPara(
+        "Col2im",
+        {
+            {{{2, 576, 3136}, {2, 576, 3136}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{2}, {2}}, ge::DT_INT32, ge::FORMAT_ND, true, outputSize.data()},
+        },
+        {
+            {{{2, 64, 56, 56}, {2, 64, 56, 56}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        BuildAttrs({3, 3}, {1, 1}, {1, 1}, {1, 1}), &compileInfo);
+    uint64_t expectTilingKey = 1;
+    std::string expectTilingData =
+        "2 0 2 64 56 56 56 56 3 3 1 1 1 1 1 1 240518168577 274877907000 274877907000 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(Col2imTiling, col2im_tiling_float16_3d_stride)
+{
+    optiling::Col2imCompileInfo compileInfo = {64, 16777216, 196608};
+    std::vector<int32_t> outputSize = {32, 32};
+    gert::TilingContextPara tilingContextPara(
+        "Col2im",
+        {
+            {{{128, 256}, {128, 256}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{2}, {2}}, ge::DT_INT32, ge::FORMAT_ND, true, outputSize.data()},
+        },
+        {
+            {{{32, 32, 32}, {32, 32, 32}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+        },
+        BuildAttrs({2, 2}, {1}, {0}, {2}), &compileInfo);
+    uint64_t expectTilingKey = 2;
+    std::string expectTilingData =
+        "1 0 1 32 32 32 16 16 2 2 2 2 1 1 0 0 68719476737 137438953481 274877906976 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(Col2imTiling, col2im_tiling_bfloat16_4d_input)
+{
+    optiling::Col2imCompileInfo compileInfo = {64, 16777216, 196608};
+    std::vector<int32_t> outputSize = {14, 14};
+    gert::TilingContextPara tilingContextPara(
+        "Col2im",
+        {
+            {{{1, 512, 9, 196}, {1, 512, 9, 196}}, ge::DT_BF16, ge::FORMAT_ND},
+            {{{2}, {2}}, ge::DT_INT32, ge::FORMAT_ND, true, outputSize.data()},
+        },
+        {
+            {{{1, 512, 14, 14}, {1, 512, 14, 14}}, ge::DT_BF16, ge::FORMAT_ND},
+        },
+        BuildAttrs({3, 3}, {1, 1}, {1, 1}, {1, 1}), &compileInfo);
+    uint64_t expectTilingKey = 3;
+    std::string expectTilingData =
+        "1 0 1 512 14 14 14 14 3 3 1 1 1 1 1 1 60129542152 68719476750 274877906960 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(Col2imTiling, col2im_tiling_float_large_channel)
+{
+    optiling::Col2imCompileInfo compileInfo = {64, 16777216, 196608};
+    std::vector<int32_t> outputSize = {7, 7};
+    gert::TilingContextPara tilingContextPara(
+        "Col2im",
+        {
+            {{{8, 9216, 49}, {8, 9216, 49}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{2}, {2}}, ge::DT_INT32, ge::FORMAT_ND, true, outputSize.data()},
+        },
+        {
+            {{{8, 1024, 7, 7}, {8, 1024, 7, 7}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        BuildAttrs({3, 3}, {1, 1}, {1, 1}, {1, 1}), &compileInfo);
+    uint64_t expectTilingKey = 1;
+    std::string expectTilingData =
+        "1 40 8 1024 7 7 7 7 3 3 1 1 1 1 1 1 30064771154 34359738375 274877906952 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(Col2imTiling, col2im_tiling_invalid_kernel_size)
+{
+    optiling::Col2imCompileInfo compileInfo = {64, 16777216, 196608};
+    std::vector<int32_t> outputSize = {8, 8};
+    gert::TilingContextPara tilingContextPara(
+        "Col2im",
+        {
+            {{{1, 108, 36}, {1, 108, 36}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{2}, {2}}, ge::DT_INT32, ge::FORMAT_ND, true, outputSize.data()},
+        },
+        {
+            {{{1, 4, 8, 8}, {1, 4, 8, 8}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        BuildAttrs({3, 3, 3}, {1, 1}, {0, 0}, {1, 1}), &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
+
+TEST_F(Col2imTiling, col2im_tiling_input_shape_mismatch)
+{
+    optiling::Col2imCompileInfo compileInfo = {64, 16777216, 196608};
+    std::vector<int32_t> outputSize = {8, 8};
+    gert::TilingContextPara tilingContextPara(
+        "Col2im",
+        {
+            {{{1, 36, 64}, {1, 36, 64}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{2}, {2}}, ge::DT_INT32, ge::FORMAT_ND, true, outputSize.data()},
+        },
+        {
+            {{{1, 4, 8, 8}, {1, 4, 8, 8}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        BuildAttrs({3, 3}, {1, 1}, {0, 0}, {1, 1}), &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
+
+TEST_F(Col2imTiling, col2im_tiling_dtype_mismatch)
+{
+    optiling::Col2imCompileInfo compileInfo = {64, 16777216, 196608};
+    std::vector<int32_t> outputSize = {8, 8};
+    gert::TilingContextPara tilingContextPara(
+        "Col2im",
+        {
+            {{{1, 36, 36}, {1, 36, 36}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{2}, {2}}, ge::DT_INT32, ge::FORMAT_ND, true, outputSize.data()},
+        },
+        {
+            {{{1, 4, 8, 8}, {1, 4, 8, 8}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        BuildAttrs({3, 3}, {1, 1}, {0, 0}, {1, 1}), &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
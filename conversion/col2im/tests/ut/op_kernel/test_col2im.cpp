@@ -0,0 +1,176 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+/*!
+ * \file test_col2im.cpp
+ * \brief
+ */
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+#include "tikicpulib.h"
+#include "data_utils.h"
+
+using namespace std;
+
+extern "C" __global__ __aicore__ void col2im(
+    GM_ADDR x, GM_ADDR outputSize, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling);
+
+class col2im_test : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        cout << "col2im_test SetUp\n" << endl;
+    }
+    static void TearDownTestCase()
+    {
+        cout << "col2im_test TearDown\n" << endl;
+    }
+};
+
+struct Col2imParam {
+    int64_t batch;
+    int64_t channel;
+    int64_t outH;
+    int64_t outW;
+    int64_t kernel[2];
+    int64_t stride[2];
+    int64_t dilation[2];
+    int64_t padding[2];
+};
+
+static int64_t CeilAlign(int64_t a, int64_t b)
+{
+    return (a + b - 1) / b * b;
+}
+
+// 按指定的通道块、输出行块构造tiling，其余字段与host侧计算方式一致
+static void InitTilingData(
+    Col2imTilingData* tilingData, const Col2imParam& param, int64_t typeSize, uint32_t cFactor, uint32_t hFactor,
+    uint32_t blockDim)
+{
+    int64_t alignNum = 32 / typeSize;
+    int64_t colH =
+        (param.outH + 2 * param.padding[0] - (param.dilation[0] * (param.kernel[0] - 1) + 1)) / param.stride[0] + 1;
+    int64_t colW =
+        (param.outW + 2 * param.padding[1] - (param.dilation[1] * (param.kernel[1] - 1) + 1)) / param.stride[1] + 1;
+    uint64_t unitNum = param.batch * ((param.channel + cFactor - 1) / cFactor) * ((param.outH + hFactor - 1) / hFactor);
+    tilingData->unitsPerCore = unitNum / blockDim;
+    tilingData->tailUnits = unitNum % blockDim;
+    tilingData->batch = param.batch;
+    tilingData->channel = param.channel;
+    tilingData->outH = param.outH;
+    tilingData->outW = param.outW;
+    tilingData->colH = colH;
+    tilingData->colW = colW;
+    tilingData->kernelH = param.kernel[0];
+    tilingData->kernelW = param.kernel[1];
+    tilingData->strideH = param.stride[0];
+    tilingData->strideW = param.stride[1];
+    tilingData->dilationH = param.dilation[0];
+    tilingData->dilationW = param.dilation[1];
+    tilingData->padH = param.padding[0];
+    tilingData->padW = param.padding[1];
+    tilingData->cFactor = cFactor;
+    tilingData->hFactor = hFactor;
+    tilingData->colHFactor =
+        std::min(colH, (hFactor - 1 + (param.kernel[0] - 1) * param.dilation[0]) / param.stride[0] + 1);
+    tilingData->colWAlign = CeilAlign(colW + 1, alignNum);
+    tilingData->wAlign = CeilAlign(param.outW, alignNum);
+    tilingData->usedCoreNum = blockDim;
+}
+
+static vector<float> Col2imRef(const vector<float>& x, const Col2imParam& param, int64_t colH, int64_t colW)
+{
+    int64_t kernelNum = param.kernel[0] * param.kernel[1];
+    vector<float> y(param.batch * param.channel * param.outH * param.outW, 0.0f);
+    for (int64_t n = 0; n < param.batch; n++) {
+        for (int64_t c = 0; c < param.channel; c++) {
+            for (int64_t k = 0; k < kernelNum; k++) {
+                int64_t ki = k / param.kernel[1];
+                int64_t kj = k % param.kernel[1];
+                for (int64_t oh = 0; oh < colH; oh++) {
+                    for (int64_t ow = 0; ow < colW; ow++) {
+                        int64_t h = oh * param.stride[0] - param.padding[0] + ki * param.dilation[0];
+                        int64_t w = ow * param.stride[1] - param.padding[1] + kj * param.dilation[1];
+                        if (h < 0 || h >= param.outH || w < 0 || w >= param.outW) {
+                            continue;
+                        }
+                        y[((n * param.channel + c) * param.outH + h) * param.outW + w] +=
+                            x[((n * param.channel + c) * kernelNum + k) * colH * colW + oh * colW + ow];
+                    }
+                }
+            }
+        }
+    }
+    return y;
+}
+
+static void RunFloatCol2im(const Col2imParam& param, uint32_t cFactor, uint32_t hFactor, uint32_t blockDim)
+{
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(sizeof(Col2imTilingData));
+    Col2imTilingData* tilingData = reinterpret_cast<Col2imTilingData*>(tiling);
+    InitTilingData(tilingData, param, sizeof(float), cFactor, hFactor, blockDim);
+    int64_t colH = tilingData->colH;
+    int64_t colW = tilingData->colW;
+    size_t inSize = param.batch * param.channel * param.kernel[0] * param.kernel[1] * colH * colW;
+    size_t outSize = param.batch * param.channel * param.outH * param.outW;
+    vector<float> xHost(inSize);
+    for (size_t i = 0; i < inSize; i++) {
+        xHost[i] = static_cast<float>(i % 127) * 0.25f - 15.0f;
+    }
+    uint8_t* x = (uint8_t*)AscendC::GmAlloc(inSize * sizeof(float));
+    uint8_t* outputSize = (uint8_t*)AscendC::GmAlloc(2 * sizeof(int32_t));
+    uint8_t* y = (uint8_t*)AscendC::GmAlloc(outSize * sizeof(float));
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(16 * 1024 * 1024);
+    memcpy(x, xHost.data(), inSize * sizeof(float));
+    int32_t sizeHost[2] = {static_cast<int32_t>(param.outH), static_cast<int32_t>(param.outW)};
+    memcpy(outputSize, sizeHost, sizeof(sizeHost));
+
+    ICPU_SET_TILING_KEY(1);
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_RUN_KF(col2im, blockDim, x, outputSize, y, workspace, (uint8_t*)(tilingData));
+
+    vector<float> expect = Col2imRef(xHost, param, colH, colW);
+    float* yOut = reinterpret_cast<float*>(y);
+    for (size_t i = 0; i < outSize; i++) {
+        EXPECT_NEAR(yOut[i], expect[i], 1e-4f * std::max(1.0f, std::fabs(expect[i])));
+    }
+
+    AscendC::GmFree(x);
+    AscendC::GmFree(outputSize);
+    AscendC::GmFree(y);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+}
+
+TEST_F(col2im_test, test_float_pad_whole_plane)
+{
+    Col2imParam param = {2, 3, 7, 9, {3, 3}, {1, 1}, {1, 1}, {1, 1}};
+    RunFloatCol2im(param, 3, 7, 2);
+}
+
+TEST_F(col2im_test, test_float_channel_and_row_blocks)
+{
+    // 通道、输出行都有尾块，W方向步长大于核宽，存在未被覆盖的位置
+    Col2imParam param = {1, 5, 10, 11, {2, 3}, {2, 4}, {2, 1}, {0, 1}};
+    RunFloatCol2im(param, 2, 3, 3);
+}
+
+TEST_F(col2im_test, test_float_dilation_large_pad)
+{
+    Col2imParam param = {3, 2, 13, 6, {4, 2}, {3, 1}, {1, 2}, {3, 2}};
+    RunFloatCol2im(param, 1, 4, 4);
+}
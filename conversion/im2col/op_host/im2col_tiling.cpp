@@ -0,0 +1,363 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file im2col_tiling.cpp
+ * \brief
+ */
+#include <algorithm>
+#include <string>
+#include "im2col_tiling.h"
+#include "log/log.h"
+#include "register/op_def_registry.h"
+#include "tiling_base/tiling_templates_registry.h"
+#include "platform/platform_info.h"
+
+namespace optiling {
+constexpr int32_t X_INPUT_INDEX = 0;
+constexpr int32_t Y_OUTPUT_INDEX = 0;
+constexpr size_t KSIZES_ATTR_INDEX = 0;
+constexpr size_t STRIDES_ATTR_INDEX = 1;
+constexpr size_t DILATIONS_ATTR_INDEX = 2;
+constexpr size_t PADDING_MODE_ATTR_INDEX = 3;
+constexpr size_t PADS_ATTR_INDEX = 4;
+constexpr size_t DIM_NUM_3D = 3;
+constexpr size_t DIM_NUM_4D = 4;
+constexpr size_t ARRAY_SIZE_2 = 2;
+constexpr size_t PADS_SIZE_4 = 4;
+constexpr uint32_t BYTE_BLOCK = 32;
+constexpr uint32_t INT32_BYTES = 4;
+constexpr uint32_t BUFFER_NUM = 2;
+constexpr uint32_t RESERVED_UB = 1024;
+constexpr uint64_t MAX_BLOCK_COUNT = 4095; // DataCopyPad单次搬运的最大行数
+constexpr uint64_t MAX_STRIDE_BYTES = 0xFFFFFFFFUL;
+
+struct Im2colDtypeKey {
+    ge::DataType dtype;
+    uint64_t tilingKey;
+};
+
+static const Im2colDtypeKey DTYPE_KEYS[] = {
+    {ge::DT_FLOAT, 1},
+    {ge::DT_FLOAT16, 2},
+    {ge::DT_BF16, 3},
+};
+
+static inline uint64_t CeilDiv(uint64_t a, uint64_t b)
+{
+    return b == 0 ? a : (a + b - 1) / b;
+}
+
+static inline uint64_t CeilAlign(uint64_t a, uint64_t b)
+{
+    return CeilDiv(a, b) * b;
+}
+
+// 长度为1时H/W共用同一个值
+static bool GetPairAttr(
+    const gert::RuntimeAttrs* attrs, size_t index, int64_t defaultValue, int64_t& valueH, int64_t& valueW)
+{
+    const gert::TypedContinuousVector<int64_t>* list = attrs->GetListInt(index);
+    if (list == nullptr || list->GetSize() == 0) {
+        valueH = defaultValue;
+        valueW = defaultValue;
+        return true;
+    }
+    if (list->GetSize() != 1 && list->GetSize() != ARRAY_SIZE_2) {
+        return false;
+    }
+    valueH = list->GetData()[0];
+    valueW = list->GetData()[list->GetSize() - 1];
+    return true;
+}
+
+// pads支持1个值、[padH, padW]或[top, bottom, left, right]
+static bool GetPadsAttr(const gert::RuntimeAttrs* attrs, int64_t pads[PADS_SIZE_4])
+{
+    const gert::TypedContinuousVector<int64_t>* list = attrs->GetListInt(PADS_ATTR_INDEX);
+    if (list == nullptr || list->GetSize() == 0) {
+        std::fill(pads, pads + PADS_SIZE_4, 0);
+        return true;
+    }
+    const int64_t* data = list->GetData();
+    if (list->GetSize() == 1) {
+        std::fill(pads, pads + PADS_SIZE_4, data[0]);
+    } else if (list->GetSize() == ARRAY_SIZE_2) {
+        pads[0] = data[0];
+        pads[1] = data[0];
+        pads[2] = data[1];
+        pads[3] = data[1];
+    } else if (list->GetSize() == PADS_SIZE_4) {
+        std::copy(data, data + PADS_SIZE_4, pads);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static ge::graphStatus GetAttrParams(
+    gert::TilingContext* context, Im2colTilingData& tilingData, int64_t pads[PADS_SIZE_4])
+{
+    const gert::RuntimeAttrs* attrs = context->GetAttrs();
+    OP_CHECK_NULL_WITH_CONTEXT(context, attrs);
+    const gert::TypedContinuousVector<int64_t>* ksizes = attrs->GetListInt(KSIZES_ATTR_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, ksizes);
+    OP_CHECK_IF(
+        ksizes->GetSize() != ARRAY_SIZE_2, OP_LOGE(context->GetNodeName(), "ksizes should have 2 elements."),
+        return ge::GRAPH_FAILED);
+    int64_t strideH = 1;
+    int64_t strideW = 1;
+    int64_t dilationH = 1;
+    int64_t dilationW = 1;
+    OP_CHECK_IF(
+        !GetPairAttr(attrs, STRIDES_ATTR_INDEX, 1, strideH, strideW) ||
+            !GetPairAttr(attrs, DILATIONS_ATTR_INDEX, 1, dilationH, dilationW) || !GetPadsAttr(attrs, pads),
+        OP_LOGE(context->GetNodeName(), "strides, dilations or pads size is invalid."), return ge::GRAPH_FAILED);
+    const char* paddingMode = attrs->GetAttrPointer<char>(PADDING_MODE_ATTR_INDEX);
+    OP_CHECK_IF(
+        paddingMode != nullptr && std::string(paddingMode) != "CALCULATED",
+        OP_LOGE(context->GetNodeName(), "padding_mode only support CALCULATED, but got %s.", paddingMode),
+        return ge::GRAPH_FAILED);
+
+    int64_t kernelH = ksizes->GetData()[0];
+    int64_t kernelW = ksizes->GetData()[1];
+    OP_CHECK_IF(
+        kernelH <= 0 || kernelW <= 0 || strideH <= 0 || strideW <= 0 || dilationH <= 0 || dilationW <= 0,
+        OP_LOGE(context->GetNodeName(), "ksizes, strides and dilations should be positive."),
+        return ge::GRAPH_FAILED);
+    OP_CHECK_IF(
+        *std::min_element(pads, pads + PADS_SIZE_4) < 0,
+        OP_LOGE(context->GetNodeName(), "pads should not be negative."), return ge::GRAPH_FAILED);
+    tilingData.set_kernelH(kernelH);
+    tilingData.set_kernelW(kernelW);
+    tilingData.set_strideH(strideH);
+    tilingData.set_strideW(strideW);
+    tilingData.set_dilationH(dilationH);
+    tilingData.set_dilationW(dilationW);
+    tilingData.set_padTop(pads[0]);
+    tilingData.set_padLeft(pads[2]);
+    return ge::GRAPH_SUCCESS;
+}
+
+// 输入为[N, C, H, W]或[C, H, W]，输出为[N, C * kh * kw, outH * outW]或[C * kh * kw, outH * outW]
+static ge::graphStatus GetShapeParams(
+    gert::TilingContext* context, Im2colTilingData& tilingData, const int64_t pads[PADS_SIZE_4])
+{
+    auto xShape = context->GetInputShape(X_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, xShape);
+    auto yShape = context->GetOutputShape(Y_OUTPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, yShape);
+    const gert::Shape& inShape = xShape->GetStorageShape();
+    size_t dimNum = inShape.GetDimNum();
+    OP_CHECK_IF(
+        dimNum != DIM_NUM_3D && dimNum != DIM_NUM_4D, OP_LOGE(context->GetNodeName(), "x should be 3D or 4D."),
+        return ge::GRAPH_FAILED);
+    int64_t batch = dimNum == DIM_NUM_4D ? inShape.GetDim(0) : 1;
+    int64_t channel = inShape.GetDim(dimNum - 3);
+    int64_t inH = inShape.GetDim(dimNum - 2);
+    int64_t inW = inShape.GetDim(dimNum - 1);
+    OP_CHECK_IF(
+        batch <= 0 || channel <= 0 || inH <= 0 || inW <= 0,
+        OP_LOGE(context->GetNodeName(), "x should not be empty."), return ge::GRAPH_FAILED);
+
+    int64_t kernelH = tilingData.get_kernelH();
+    int64_t kernelW = tilingData.get_kernelW();
+    int64_t spanH = inH + pads[0] + pads[1] - (tilingData.get_dilationH() * (kernelH - 1) + 1);
+    int64_t spanW = inW + pads[2] + pads[3] - (tilingData.get_dilationW() * (kernelW - 1) + 1);
+    OP_CHECK_IF(
+        spanH < 0 || spanW < 0, OP_LOGE(context->GetNodeName(), "kernel is larger than padded input."),
+        return ge::GRAPH_FAILED);
+    int64_t outH = spanH / tilingData.get_strideH() + 1;
+    int64_t outW = spanW / tilingData.get_strideW() + 1;
+
+    const gert::Shape& outShape = yShape->GetStorageShape();
+    int64_t colNum = channel * kernelH * kernelW;
+    bool shapeMatch = dimNum == DIM_NUM_4D ?
+                          (outShape.GetDimNum() == DIM_NUM_3D && outShape.GetDim(0) == batch &&
+                           outShape.GetDim(1) == colNum && outShape.GetDim(2) == outH * outW) :
+                          (outShape.GetDimNum() == ARRAY_SIZE_2 && outShape.GetDim(0) == colNum &&
+                           outShape.GetDim(1) == outH * outW);
+    OP_CHECK_IF(
+        !shapeMatch,
+        OP_LOGE(context->GetNodeName(), "y shape should be [%ld, %ld, %ld].", batch, colNum, outH * outW),
+        return ge::GRAPH_FAILED);
+
+    tilingData.set_batch(batch);
+    tilingData.set_channel(channel);
+    tilingData.set_inH(inH);
+    tilingData.set_inW(inW);
+    tilingData.set_outH(outH);
+    tilingData.set_outW(outW);
+    return ge::GRAPH_SUCCESS;
+}
+
+static bool CalcTilingData(uint32_t typeSize, uint32_t coreNum, uint32_t ubSize, Im2colTilingData& tilingData)
+{
+    uint64_t alignNum = BYTE_BLOCK / typeSize;
+    uint64_t batch = tilingData.get_batch();
+    uint64_t channel = tilingData.get_channel();
+    uint64_t outH = tilingData.get_outH();
+    uint64_t outW = tilingData.get_outW();
+    uint64_t inW = tilingData.get_inW();
+    uint64_t kernelH = tilingData.get_kernelH();
+    uint64_t kernelW = tilingData.get_kernelW();
+    uint64_t strideH = tilingData.get_strideH();
+    uint64_t padLeft = tilingData.get_padLeft();
+    // 输出按(通道, 卷积核位置)排列，每行outH * outW个元素，GM上相邻通道同一核位置的行间隔kernelH * kernelW行
+    OP_CHECK_IF(
+        kernelH * kernelW * outH * outW * typeSize > MAX_STRIDE_BYTES, OP_LOGE("Im2col", "y row is too large."),
+        return false);
+
+    // UB中每个输入行左侧补齐到32B对齐的pad列，右侧补足最后一个窗口需要的列，Gather偏移不必判断越界
+    uint64_t leftAlign = CeilAlign(padLeft, alignNum);
+    uint64_t needCols =
+        leftAlign - padLeft + (outW - 1) * tilingData.get_strideW() + (kernelW - 1) * tilingData.get_dilationW() + 1;
+    uint64_t bandW = CeilAlign(std::max(leftAlign + inW, needCols), alignNum);
+    uint64_t kernelSpanH = (kernelH - 1) * tilingData.get_dilationH() + 1;
+    auto bandHOf = [&](uint64_t ohFactor) { return (ohFactor - 1) * strideH + kernelSpanH; };
+    auto segAlignOf = [&](uint64_t ohFactor) { return CeilAlign(ohFactor * outW, alignNum); };
+    // 每通道：输入行带、Gather偏移表与加上核位置后的偏移、输出double buffer；另有一段构造偏移表用的临时区
+    auto perChannelOf = [&](uint64_t ohFactor) {
+        return bandHOf(ohFactor) * bandW * typeSize +
+               segAlignOf(ohFactor) * (INT32_BYTES + INT32_BYTES + BUFFER_NUM * typeSize);
+    };
+    auto fixedOf = [&](uint64_t ohFactor) { return RESERVED_UB + segAlignOf(ohFactor) * INT32_BYTES; };
+
+    uint64_t ohFactor = outH;
+    while (bandHOf(ohFactor) > MAX_BLOCK_COUNT || fixedOf(ohFactor) + perChannelOf(ohFactor) > ubSize) {
+        if (ohFactor == 1) {
+            return false;
+        }
+        ohFactor = CeilDiv(ohFactor, BUFFER_NUM);
+    }
+    uint64_t cFactor = std::min({channel, (ubSize - fixedOf(ohFactor)) / perChannelOf(ohFactor), MAX_BLOCK_COUNT});
+
+    // 单元数不足核数时先减小通道块，仍不足再切输出行
+    uint64_t ohBlocks = CeilDiv(outH, ohFactor);
+    uint64_t cBlocks = CeilDiv(channel, cFactor);
+    if (batch * cBlocks * ohBlocks < coreNum) {
+        cFactor = std::min(cFactor, CeilDiv(channel, CeilDiv(coreNum, batch * ohBlocks)));
+        cBlocks = CeilDiv(channel, cFactor);
+    }
+    if (batch * cBlocks * ohBlocks < coreNum) {
+        ohFactor = std::min(ohFactor, CeilDiv(outH, CeilDiv(coreNum, batch * cBlocks)));
+        ohBlocks = CeilDiv(outH, ohFactor);
+    }
+    uint64_t unitNum = batch * cBlocks * ohBlocks;
+    uint64_t usedCoreNum = std::max<uint64_t>(1, std::min<uint64_t>(coreNum, unitNum));
+    tilingData.set_unitsPerCore(unitNum / usedCoreNum);
+    tilingData.set_tailUnits(unitNum % usedCoreNum);
+    tilingData.set_cFactor(static_cast<uint32_t>(cFactor));
+    tilingData.set_ohFactor(static_cast<uint32_t>(ohFactor));
+    tilingData.set_bandH(static_cast<uint32_t>(bandHOf(ohFactor)));
+    tilingData.set_bandW(static_cast<uint32_t>(bandW));
+    tilingData.set_leftAlign(static_cast<uint32_t>(leftAlign));
+    tilingData.set_wAlign(static_cast<uint32_t>(CeilAlign(inW, alignNum)));
+    tilingData.set_segAlign(static_cast<uint32_t>(segAlignOf(ohFactor)));
+    tilingData.set_usedCoreNum(static_cast<uint32_t>(usedCoreNum));
+    return true;
+}
+
+static void PrintTilingData(gert::TilingContext* context, Im2colTilingData& tilingData)
+{
+    const ge::char_t* nodeName = context->GetNodeName();
+    OP_LOGD(nodeName, "unitsPerCore: %lu", tilingData.get_unitsPerCore());
+    OP_LOGD(nodeName, "tailUnits: %lu", tilingData.get_tailUnits());
+    OP_LOGD(
+        nodeName, "x shape: [%ld, %ld, %ld, %ld]", tilingData.get_batch(), tilingData.get_channel(),
+        tilingData.get_inH(), tilingData.get_inW());
+    OP_LOGD(nodeName, "outH: %ld, outW: %ld", tilingData.get_outH(), tilingData.get_outW());
+    OP_LOGD(nodeName, "kernel: [%ld, %ld]", tilingData.get_kernelH(), tilingData.get_kernelW());
+    OP_LOGD(nodeName, "stride: [%ld, %ld]", tilingData.get_strideH(), tilingData.get_strideW());
+    OP_LOGD(nodeName, "dilation: [%ld, %ld]", tilingData.get_dilationH(), tilingData.get_dilationW());
+    OP_LOGD(nodeName, "padTop: %ld, padLeft: %ld", tilingData.get_padTop(), tilingData.get_padLeft());
+    OP_LOGD(nodeName, "cFactor: %u", tilingData.get_cFactor());
+    OP_LOGD(nodeName, "ohFactor: %u", tilingData.get_ohFactor());
+    OP_LOGD(nodeName, "bandH: %u", tilingData.get_bandH());
+    OP_LOGD(nodeName, "bandW: %u", tilingData.get_bandW());
+    OP_LOGD(nodeName, "leftAlign: %u", tilingData.get_leftAlign());
+    OP_LOGD(nodeName, "wAlign: %u", tilingData.get_wAlign());
+    OP_LOGD(nodeName, "segAlign: %u", tilingData.get_segAlign());
+    OP_LOGD(nodeName, "usedCoreNum: %u", tilingData.get_usedCoreNum());
+}
+
+static ge::graphStatus Tiling4Im2col(gert::TilingContext* context)
+{
+    OP_LOGI(context->GetNodeName(), "Im2col tiling starts running");
+    auto compileInfo = reinterpret_cast<const Im2colCompileInfo*>(context->GetCompileInfo());
+    OP_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    OP_CHECK_IF(
+        compileInfo->vectorCoreNum <= 0 || compileInfo->ubByteSize <= RESERVED_UB,
+        OP_LOGE(context->GetNodeName(), "Failed to get core num or ub size."), return ge::GRAPH_FAILED);
+
+    auto xDesc = context->GetInputDesc(X_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, xDesc);
+    auto yDesc = context->GetOutputDesc(Y_OUTPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, yDesc);
+    ge::DataType dtype = xDesc->GetDataType();
+    OP_CHECK_IF(
+        yDesc->GetDataType() != dtype, OP_LOGE(context->GetNodeName(), "x and y should have the same dtype."),
+        return ge::GRAPH_FAILED);
+    uint64_t tilingKey = 0;
+    for (const auto& item : DTYPE_KEYS) {
+        if (item.dtype == dtype) {
+            tilingKey = item.tilingKey;
+        }
+    }
+    OP_CHECK_IF(
+        tilingKey == 0, OP_LOGE(context->GetNodeName(), "dtype is not supported."), return ge::GRAPH_FAILED);
+
+    Im2colTilingData tilingData;
+    int64_t pads[PADS_SIZE_4] = {0};
+    OP_CHECK_IF(
+        GetAttrParams(context, tilingData, pads) != ge::GRAPH_SUCCESS ||
+            GetShapeParams(context, tilingData, pads) != ge::GRAPH_SUCCESS,
+        OP_LOGE(context->GetNodeName(), "get im2col params failed."), return ge::GRAPH_FAILED);
+    OP_CHECK_IF(
+        !CalcTilingData(
+            ge::GetSizeByDataType(dtype), compileInfo->vectorCoreNum, compileInfo->ubByteSize, tilingData),
+        OP_LOGE(context->GetNodeName(), "ub space is not enough, please check input."), return ge::GRAPH_FAILED);
+
+    context->SetTilingKey(tilingKey);
+    context->SetBlockDim(tilingData.get_usedCoreNum());
+    size_t* workspaces = context->GetWorkspaceSizes(1);
+    workspaces[0] = compileInfo->sysWorkspaceByteSize;
+    tilingData.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tilingData.GetDataSize());
+    PrintTilingData(context, tilingData);
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus TilingPrepare4Im2col(gert::TilingParseContext* context)
+{
+    auto compileInfo = context->GetCompiledInfo<Im2colCompileInfo>();
+    OP_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    auto platformInfo = context->GetPlatformInfo();
+    OP_CHECK_NULL_WITH_CONTEXT(context, platformInfo);
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(platformInfo);
+    compileInfo->vectorCoreNum = ascendcPlatform.GetCoreNumAiv();
+    OP_CHECK_IF(
+        (compileInfo->vectorCoreNum <= 0), OP_LOGE(context->GetNodeName(), "No vector core available."),
+        return ge::GRAPH_FAILED);
+    uint64_t ubByteSize;
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ubByteSize);
+    compileInfo->ubByteSize = ubByteSize;
+    OP_CHECK_IF(
+        (compileInfo->ubByteSize <= 0), OP_LOGE(context->GetNodeName(), "Failed to get ub size."),
+        return ge::GRAPH_FAILED);
+    compileInfo->sysWorkspaceByteSize = ascendcPlatform.GetLibApiWorkSpaceSize();
+    return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_OPTILING(Im2col)
+    .Tiling(Tiling4Im2col)
+    .TilingParse<Im2colCompileInfo>(TilingPrepare4Im2col);
+} // namespace optiling
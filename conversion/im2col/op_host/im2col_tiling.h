@@ -0,0 +1,56 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file im2col_tiling.h
+ * \brief
+ */
+#ifndef OPS_BUILT_IN_OP_TILING_RUNTIME_IM2COL_H_
+#define OPS_BUILT_IN_OP_TILING_RUNTIME_IM2COL_H_
+
+#include "register/tilingdata_base.h"
+
+namespace optiling {
+BEGIN_TILING_DATA_DEF(Im2colTilingData)
+TILING_DATA_FIELD_DEF(uint64_t, unitsPerCore); // 每核处理的(batch, 通道块, 输出行块)单元数
+TILING_DATA_FIELD_DEF(uint64_t, tailUnits);    // 前tailUnits个核多处理一个单元
+TILING_DATA_FIELD_DEF(int64_t, batch);
+TILING_DATA_FIELD_DEF(int64_t, channel);
+TILING_DATA_FIELD_DEF(int64_t, inH);
+TILING_DATA_FIELD_DEF(int64_t, inW);
+TILING_DATA_FIELD_DEF(int64_t, outH);
+TILING_DATA_FIELD_DEF(int64_t, outW);
+TILING_DATA_FIELD_DEF(int64_t, kernelH);
+TILING_DATA_FIELD_DEF(int64_t, kernelW);
+TILING_DATA_FIELD_DEF(int64_t, strideH);
+TILING_DATA_FIELD_DEF(int64_t, strideW);
+TILING_DATA_FIELD_DEF(int64_t, dilationH);
+TILING_DATA_FIELD_DEF(int64_t, dilationW);
+TILING_DATA_FIELD_DEF(int64_t, padTop);
+TILING_DATA_FIELD_DEF(int64_t, padLeft);
+TILING_DATA_FIELD_DEF(uint32_t, cFactor);   // 每个单元处理的通道数
+TILING_DATA_FIELD_DEF(uint32_t, ohFactor);  // 每个单元处理的输出行数
+TILING_DATA_FIELD_DEF(uint32_t, bandH);     // 每个通道搬入的输入行数，含上下pad行
+TILING_DATA_FIELD_DEF(uint32_t, bandW);     // 输入行在UB中的行宽，含左右pad列，32B对齐
+TILING_DATA_FIELD_DEF(uint32_t, leftAlign); // 输入数据在UB行内的起始列，不小于padLeft且32B对齐
+TILING_DATA_FIELD_DEF(uint32_t, wAlign);    // 输入行按32B对齐后的长度，对齐部分补零
+TILING_DATA_FIELD_DEF(uint32_t, segAlign);  // 每个输出行段(ohFactor * outW)在UB中的对齐长度
+TILING_DATA_FIELD_DEF(uint32_t, usedCoreNum);
+END_TILING_DATA_DEF;
+REGISTER_TILING_DATA_CLASS(Im2col, Im2colTilingData)
+
+struct Im2colCompileInfo {
+    uint32_t vectorCoreNum;
+    uint32_t sysWorkspaceByteSize;
+    uint32_t ubByteSize;
+};
+} // namespace optiling
+#endif // OPS_BUILT_IN_OP_TILING_RUNTIME_IM2COL_H_
@@ -25,6 +25,7 @@
 #include "opdev/op_log.h"
 #include "opdev/tensor_view_utils.h"
 #include "opdev/shape_utils.h"
+#include "opdev/platform.h"
 
 using namespace op;
 
@@ -217,6 +218,39 @@ static aclnnStatus CheckParams(
     return ACLNN_SUCCESS;
 }
 
+// 仓内Im2col kernel只注册了910B/910_93，可直接处理3维/4维ND输入
+static bool IsIm2colDirectSupport()
+{
+    auto socVersion = GetCurrentPlatformInfo().GetSocVersion();
+    return socVersion == SocVersion::ASCEND910B || socVersion == SocVersion::ASCEND910_93;
+}
+
+// 其余SoC上的内置Im2col只接受4维NCHW输入：3维输入先补batch维并转成NCHW，计算后再还原维度与格式
+static const aclTensor* Im2colWithReFormat(
+    const aclTensor* selfContiguous, const aclIntArray* kernelSize, const aclIntArray* dilation,
+    const aclIntArray* padding, const aclIntArray* stride, const aclTensor* out, aclOpExecutor* executor)
+{
+    bool isNeedSqueeze = (selfContiguous->GetViewShape().GetDimNum() == NEED_SQUEEZE);
+    auto selfUnsqueeze =
+        isNeedSqueeze ? l0op::UnsqueezeNd(selfContiguous, static_cast<int64_t>(0), executor) : selfContiguous;
+    CHECK_RET(selfUnsqueeze != nullptr, nullptr);
+
+    auto selfReFormat = l0op::ReFormat(selfUnsqueeze, op::Format::FORMAT_NCHW);
+    CHECK_RET(selfReFormat != nullptr, nullptr);
+
+    auto im2colOut = l0op::Im2col(selfReFormat, kernelSize, dilation, padding, stride, executor);
+    CHECK_RET(im2colOut != nullptr, nullptr);
+
+    auto outSqueeze = isNeedSqueeze ? l0op::SqueezeNd(im2colOut, static_cast<int64_t>(0), executor) : im2colOut;
+    CHECK_RET(outSqueeze != nullptr, nullptr);
+
+    auto outView = executor->CreateView(outSqueeze, outSqueeze->GetViewShape(), outSqueeze->GetViewOffset());
+    CHECK_RET(outView != nullptr, nullptr);
+    auto outReFormat = l0op::ReFormat(outView, out->GetViewFormat());
+    CHECK_RET(outReFormat != nullptr, nullptr);
+    return l0op::Cast(outReFormat, out->GetDataType(), executor);
+}
+
 aclnnStatus aclnnIm2colGetWorkspaceSize(
     const aclTensor* self, const aclIntArray* kernelSize, const aclIntArray* dilation, const aclIntArray* padding,
     const aclIntArray* stride, const aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor)
@@ -235,35 +269,32 @@ aclnnStatus aclnnIm2colGetWorkspaceSize(
         uniqueExecutor.ReleaseTo(executor);
         return ACLNN_SUCCESS;
     }
-    bool isNeedSqueeze = (self->GetViewShape().GetDimNum() == NEED_SQUEEZE);
-
     // 固定写法，将输入转换成连续的tensor
     auto selfContiguous = l0op::Contiguous(self, uniqueExecutor.get());
     CHECK_RET(selfContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
-    auto selfUnsqueeze = isNeedSqueeze ?
-                             l0op::UnsqueezeNd(selfContiguous, static_cast<int64_t>(0), uniqueExecutor.get()) :
-                             selfContiguous;
-    CHECK_RET(selfUnsqueeze != nullptr, ACLNN_ERR_INNER_NULLPTR);
-
-    auto selfReFormat = l0op::ReFormat(selfUnsqueeze, op::Format::FORMAT_NCHW);
-    CHECK_RET(selfReFormat != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
     FVector<int64_t> padding4d = {(*padding)[0], (*padding)[0], (*padding)[1], (*padding)[1]};
     const aclIntArray* newPadding = uniqueExecutor.get()->AllocIntArray(padding4d.data(), PADDING_SIZE);
 
-    auto im2colOut = l0op::Im2col(selfReFormat, kernelSize, dilation, newPadding, stride, uniqueExecutor.get());
-    CHECK_RET(im2colOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
-
-    auto outSqueeze =
-        isNeedSqueeze ? l0op::SqueezeNd(im2colOut, static_cast<int64_t>(0), uniqueExecutor.get()) : im2colOut;
-    CHECK_RET(outSqueeze != nullptr, ACLNN_ERR_INNER_NULLPTR);
-
-    auto outView =
-        uniqueExecutor.get()->CreateView(outSqueeze, outSqueeze->GetViewShape(), outSqueeze->GetViewOffset());
-    CHECK_RET(outView != nullptr, ACLNN_ERR_INNER_NULLPTR);
-    auto outReFormat = l0op::ReFormat(outView, out->GetViewFormat());
-    CHECK_RET(outReFormat != nullptr, ACLNN_ERR_INNER_NULLPTR);
-    auto outCast = l0op::Cast(outReFormat, out->GetDataType(), uniqueExecutor.get());
+    const aclTensor* outCast = nullptr;
+    if (IsIm2colDirectSupport()) {
+        // kernel直接处理3维/4维输入，out连续且dtype一致时列数据直接写入out
+        if (IsContiguous(out) && out->GetDataType() == self->GetDataType()) {
+            auto im2colOut =
+                l0op::Im2col(selfContiguous, kernelSize, dilation, newPadding, stride, out, uniqueExecutor.get());
+            CHECK_RET(im2colOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+            *workspaceSize = uniqueExecutor->GetWorkspaceSize();
+            uniqueExecutor.ReleaseTo(executor);
+            return ACLNN_SUCCESS;
+        }
+        auto im2colOut =
+            l0op::Im2col(selfContiguous, kernelSize, dilation, newPadding, stride, uniqueExecutor.get());
+        CHECK_RET(im2colOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        outCast = l0op::Cast(im2colOut, out->GetDataType(), uniqueExecutor.get());
+    } else {
+        outCast =
+            Im2colWithReFormat(selfContiguous, kernelSize, dilation, newPadding, stride, out, uniqueExecutor.get());
+    }
     CHECK_RET(outCast != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
     auto viewCopyResult = l0op::ViewCopy(outCast, out, uniqueExecutor.get());
@@ -21,39 +21,54 @@ OP_TYPE_REGISTER(Im2col);
 
 static const string PADDING_MODE = "CALCULATED";
 
+// self为[N, C, H, W]或[C, H, W]，padding为[top, bottom, left, right]
 static bool Im2colInferShape(
     const aclTensor* self, const aclIntArray* kernelSize, const aclIntArray* dilation, const aclIntArray* padding,
     const aclIntArray* stride, op::Shape& outShape)
 {
+    size_t dimNum = self->GetViewShape().GetDimNum();
     int64_t outH =
-        (self->GetViewShape().GetDim(2) + 2 * (*padding)[0] - ((*dilation)[0] * ((*kernelSize)[0] - 1) + 1)) /
+        (self->GetViewShape().GetDim(dimNum - 2) + (*padding)[0] + (*padding)[1] -
+         ((*dilation)[0] * ((*kernelSize)[0] - 1) + 1)) /
             (*stride)[0] +
         1;
     int64_t outW =
-        (self->GetViewShape().GetDim(3) + 2 * (*padding)[2] - ((*dilation)[1] * ((*kernelSize)[1] - 1) + 1)) /
+        (self->GetViewShape().GetDim(dimNum - 1) + (*padding)[2] + (*padding)[3] -
+         ((*dilation)[1] * ((*kernelSize)[1] - 1) + 1)) /
             (*stride)[1] +
         1;
-    outShape = {
-        self->GetViewShape().GetDim(0), self->GetViewShape().GetDim(1) * (*kernelSize)[0] * (*kernelSize)[1],
-        outH * outW};
+    int64_t colNum = self->GetViewShape().GetDim(dimNum - 3) * (*kernelSize)[0] * (*kernelSize)[1];
+    if (dimNum == 3) {
+        outShape = {colNum, outH * outW};
+    } else {
+        outShape = {self->GetViewShape().GetDim(0), colNum, outH * outW};
+    }
     return true;
 }
 
+const aclTensor* Im2col(
+    const aclTensor* self, const aclIntArray* kernelSize, const aclIntArray* dilation, const aclIntArray* padding,
+    const aclIntArray* stride, const aclTensor* out, aclOpExecutor* executor)
+{
+    L0_DFX(Im2col, self, kernelSize, dilation, padding, stride, out);
+    auto ret = ADD_TO_LAUNCHER_LIST_AICORE(
+        Im2col, OP_INPUT(self), OP_OUTPUT(out), OP_ATTR(kernelSize, stride, dilation, PADDING_MODE, padding));
+    OP_CHECK_ADD_TO_LAUNCHER_LIST_AICORE(
+        ret != ACLNN_SUCCESS, return nullptr, "Im2col ADD_TO_LAUNCHER_LIST_AICORE failed.");
+    return out;
+}
+
 const aclTensor* Im2col(
     const aclTensor* self, const aclIntArray* kernelSize, const aclIntArray* dilation, const aclIntArray* padding,
     const aclIntArray* stride, aclOpExecutor* executor)
 {
-    L0_DFX(Im2col, self, kernelSize, dilation, padding, stride);
     op::Shape outShape;
     if (!Im2colInferShape(self, kernelSize, dilation, padding, stride, outShape)) {
         OP_LOGE(ACL_ERROR_INVALID_PARAM, "im2col infer shape failed.");
         return nullptr;
     }
     auto out = executor->AllocTensor(outShape, self->GetDataType(), self->GetViewFormat());
-    auto ret = ADD_TO_LAUNCHER_LIST_AICORE(
-        Im2col, OP_INPUT(self), OP_OUTPUT(out), OP_ATTR(kernelSize, stride, dilation, PADDING_MODE, padding));
-    OP_CHECK_ADD_TO_LAUNCHER_LIST_AICORE(
-        ret != ACLNN_SUCCESS, return nullptr, "Im2col ADD_TO_LAUNCHER_LIST_AICORE failed.");
-    return out;
+    CHECK_RET(out != nullptr, nullptr);
+    return Im2col(self, kernelSize, dilation, padding, stride, out, executor);
 }
 } // namespace l0op
@@ -14,6 +14,11 @@
 #include "opdev/op_executor.h"
 
 namespace l0op {
+// 列数据直接写入out，out需与self同dtype且连续
+const aclTensor* Im2col(
+    const aclTensor* self, const aclIntArray* kernelSize, const aclIntArray* dilation, const aclIntArray* padding,
+    const aclIntArray* stride, const aclTensor* out, aclOpExecutor* executor);
+
 const aclTensor* Im2col(
     const aclTensor* self, const aclIntArray* kernelSize, const aclIntArray* dilation, const aclIntArray* padding,
     const aclIntArray* stride, aclOpExecutor* executor);
@@ -0,0 +1,335 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file im2col.h
+ * \brief 按(通道块, 输出行块)切分的Im2col
+ *
+ * 每个单元把cFactor个通道覆盖ohFactor个输出行所需的输入行带搬入UB，行内左右补pad列、上下越界行置零，
+ * 使每个窗口元素都能由统一的Gather偏移取到。偏移表只与单元内的(通道, 输出位置)有关，各卷积核位置只需
+ * 在表上加一个常量偏移，一次Gather得到cFactor个通道在该核位置的输出行段，再按GM上的行间隔直接写到最终输出。
+ */
+#ifndef IM2COL_H
+#define IM2COL_H
+
+#include "kernel_operator.h"
+
+namespace Im2col {
+using namespace AscendC;
+
+constexpr int32_t BUFFER_NUM = 2;
+constexpr uint32_t BYTE_BLOCK = 32;
+constexpr uint32_t MAX_BLOCK_COUNT = 4095;
+constexpr float HALF_ROUND = 0.5f;
+
+template <typename T>
+class Im2colND {
+public:
+    __aicore__ inline Im2colND(){};
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR y, const Im2colTilingData* __restrict tilingData);
+    __aicore__ inline void Process();
+
+private:
+    __aicore__ inline void InitTilingParams(const Im2colTilingData* __restrict tilingData);
+    __aicore__ inline void InitOffsetTable();
+    __aicore__ inline void ProcessUnit(uint64_t unitIdx);
+    __aicore__ inline void LoadBand(
+        int64_t batchIdx, int64_t cStart, uint32_t cCount, int64_t ohStart, uint32_t ohCount);
+    __aicore__ inline void ZeroRows(uint32_t cCount, uint32_t rowStart, uint32_t rowCount);
+    __aicore__ inline void GatherKernelPos(
+        int64_t batchIdx, int64_t cStart, uint32_t cCount, int64_t ohStart, uint32_t ohCount, int64_t kernelPos);
+
+    template <typename T1>
+    __aicore__ inline T1 CeilDiv(T1 a, T1 b)
+    {
+        return b == 0 ? a : (a + b - 1) / b;
+    }
+
+    template <typename T1>
+    __aicore__ inline T1 CeilAlign(T1 a, T1 b)
+    {
+        return CeilDiv(a, b) * b;
+    }
+
+    template <typename T1>
+    __aicore__ inline T1 Min(T1 a, T1 b)
+    {
+        return a < b ? a : b;
+    }
+
+    template <typename T1>
+    __aicore__ inline T1 Max(T1 a, T1 b)
+    {
+        return a > b ? a : b;
+    }
+
+    template <HardEvent EVENT>
+    __aicore__ inline void SyncFlag()
+    {
+        event_t eventId = static_cast<event_t>(GetTPipePtr()->FetchEventID(EVENT));
+        SetFlag<EVENT>(eventId);
+        WaitFlag<EVENT>(eventId);
+    }
+
+private:
+    TPipe pipe;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> outQueue;
+    TBuf<QuePosition::VECCALC> bandBuf;
+    TBuf<QuePosition::VECCALC> tableBuf;
+    TBuf<QuePosition::VECCALC> offsetBuf;
+    TBuf<QuePosition::VECCALC> tmpBuf;
+    GlobalTensor<T> xGm;
+    GlobalTensor<T> yGm;
+
+    uint64_t unitStart = 0;
+    uint64_t coreUnitNum = 0;
+    int64_t channel = 0;
+    int64_t inH = 0;
+    int64_t inW = 0;
+    int64_t outH = 0;
+    int64_t outW = 0;
+    int64_t kernelH = 0;
+    int64_t kernelW = 0;
+    int64_t strideH = 1;
+    int64_t strideW = 1;
+    int64_t dilationH = 1;
+    int64_t dilationW = 1;
+    int64_t padTop = 0;
+    int64_t padLeft = 0;
+    int64_t cBlocks = 0;
+    int64_t ohBlocks = 0;
+    uint32_t cFactor = 0;
+    uint32_t ohFactor = 0;
+    uint32_t bandH = 0;
+    uint32_t bandW = 0;
+    uint32_t leftAlign = 0;
+    uint32_t wAlign = 0;
+    uint32_t segAlign = 0;
+    uint32_t alignNum = 0;
+};
+
+template <typename T>
+__aicore__ inline void Im2colND<T>::InitTilingParams(const Im2colTilingData* __restrict tilingData)
+{
+    uint64_t blockIdx = GetBlockIdx();
+    uint64_t unitsPerCore = tilingData->unitsPerCore;
+    uint64_t tailUnits = tilingData->tailUnits;
+    coreUnitNum = unitsPerCore + (blockIdx < tailUnits ? 1 : 0);
+    unitStart = blockIdx * unitsPerCore + (blockIdx < tailUnits ? blockIdx : tailUnits);
+    channel = tilingData->channel;
+    inH = tilingData->inH;
+    inW = tilingData->inW;
+    outH = tilingData->outH;
+    outW = tilingData->outW;
+    kernelH = tilingData->kernelH;
+    kernelW = tilingData->kernelW;
+    strideH = tilingData->strideH;
+    strideW = tilingData->strideW;
+    dilationH = tilingData->dilationH;
+    dilationW = tilingData->dilationW;
+    padTop = tilingData->padTop;
+    padLeft = tilingData->padLeft;
+    cFactor = tilingData->cFactor;
+    ohFactor = tilingData->ohFactor;
+    bandH = tilingData->bandH;
+    bandW = tilingData->bandW;
+    leftAlign = tilingData->leftAlign;
+    wAlign = tilingData->wAlign;
+    segAlign = tilingData->segAlign;
+    alignNum = BYTE_BLOCK / sizeof(T);
+    cBlocks = CeilDiv(channel, static_cast<int64_t>(cFactor));
+    ohBlocks = CeilDiv(outH, static_cast<int64_t>(ohFactor));
+}
+
+template <typename T>
+__aicore__ inline void Im2colND<T>::Init(GM_ADDR x, GM_ADDR y, const Im2colTilingData* __restrict tilingData)
+{
+    InitTilingParams(tilingData);
+    xGm.SetGlobalBuffer((__gm__ T*)x);
+    yGm.SetGlobalBuffer((__gm__ T*)y);
+
+    pipe.InitBuffer(bandBuf, cFactor * bandH * bandW * sizeof(T));
+    pipe.InitBuffer(tableBuf, cFactor * segAlign * sizeof(int32_t));
+    pipe.InitBuffer(offsetBuf, cFactor * segAlign * sizeof(int32_t));
+    pipe.InitBuffer(tmpBuf, segAlign * sizeof(int32_t));
+    pipe.InitBuffer(outQueue, BUFFER_NUM, cFactor * segAlign * sizeof(T));
+
+    // pad列只在这里置零一次，之后搬入只覆盖数据列
+    LocalTensor<int16_t> bandLocal = bandBuf.Get<int16_t>();
+    Duplicate(bandLocal, static_cast<int16_t>(0), cFactor * bandH * bandW * sizeof(T) / sizeof(int16_t));
+    InitOffsetTable();
+}
+
+// 单元内第i个输出位置为(ohL, ow) = (i / outW, i % outW)，对应行带内(ohL * strideH, ow * strideW - padLeft)处。
+// 用fp32向下取整求商，对齐尾部的偏移截断到合法范围，Gather读到的值会在搬出时丢弃
+template <typename T>
+__aicore__ inline void Im2colND<T>::InitOffsetTable()
+{
+    LocalTensor<int32_t> tableLocal = tableBuf.Get<int32_t>();
+    LocalTensor<int32_t> offsetLocal = offsetBuf.Get<int32_t>();
+    LocalTensor<float> quotLocal = offsetBuf.Get<float>();
+    LocalTensor<int32_t> idxLocal = tmpBuf.Get<int32_t>();
+    int32_t typeSize = static_cast<int32_t>(sizeof(T));
+    CreateVecIndex(idxLocal, static_cast<int32_t>(0), segAlign);
+    PipeBarrier<PIPE_V>();
+    Cast(quotLocal, idxLocal, RoundMode::CAST_NONE, segAlign);
+    PipeBarrier<PIPE_V>();
+    Adds(quotLocal, quotLocal, HALF_ROUND, segAlign);
+    PipeBarrier<PIPE_V>();
+    Muls(quotLocal, quotLocal, 1.0f / static_cast<float>(outW), segAlign);
+    PipeBarrier<PIPE_V>();
+    Cast(tableLocal, quotLocal, RoundMode::CAST_FLOOR, segAlign);
+    PipeBarrier<PIPE_V>();
+    Muls(offsetLocal, tableLocal, static_cast<int32_t>(outW), segAlign);
+    PipeBarrier<PIPE_V>();
+    Sub(idxLocal, idxLocal, offsetLocal, segAlign);
+    PipeBarrier<PIPE_V>();
+    Muls(tableLocal, tableLocal, static_cast<int32_t>(strideH * bandW) * typeSize, segAlign);
+    Muls(idxLocal, idxLocal, static_cast<int32_t>(strideW) * typeSize, segAlign);
+    PipeBarrier<PIPE_V>();
+    Add(tableLocal, tableLocal, idxLocal, segAlign);
+    PipeBarrier<PIPE_V>();
+    Adds(tableLocal, tableLocal, static_cast<int32_t>(leftAlign - padLeft) * typeSize, segAlign);
+    PipeBarrier<PIPE_V>();
+    int32_t maxOffset =
+        static_cast<int32_t>((ohFactor - 1) * strideH * bandW + (outW - 1) * strideW + leftAlign - padLeft) *
+        typeSize;
+    Mins(tableLocal, tableLocal, maxOffset, segAlign);
+    PipeBarrier<PIPE_V>();
+    int32_t channelBytes = static_cast<int32_t>(bandH * bandW) * typeSize;
+    for (uint32_t c = 1; c < cFactor; c++) {
+        Adds(tableLocal[c * segAlign], tableLocal, static_cast<int32_t>(c) * channelBytes, segAlign);
+    }
+    PipeBarrier<PIPE_V>();
+}
+
+template <typename T>
+__aicore__ inline void Im2colND<T>::Process()
+{
+    for (uint64_t i = 0; i < coreUnitNum; i++) {
+        ProcessUnit(unitStart + i);
+    }
+}
+
+template <typename T>
+__aicore__ inline void Im2colND<T>::ProcessUnit(uint64_t unitIdx)
+{
+    int64_t blocksPerBatch = cBlocks * ohBlocks;
+    int64_t batchIdx = static_cast<int64_t>(unitIdx) / blocksPerBatch;
+    int64_t rem = static_cast<int64_t>(unitIdx) % blocksPerBatch;
+    int64_t cStart = rem / ohBlocks * cFactor;
+    int64_t ohStart = rem % ohBlocks * ohFactor;
+    uint32_t cCount = static_cast<uint32_t>(Min(static_cast<int64_t>(cFactor), channel - cStart));
+    uint32_t ohCount = static_cast<uint32_t>(Min(static_cast<int64_t>(ohFactor), outH - ohStart));
+
+    LoadBand(batchIdx, cStart, cCount, ohStart, ohCount);
+    for (int64_t k = 0; k < kernelH * kernelW; k++) {
+        GatherKernelPos(batchIdx, cStart, cCount, ohStart, ohCount, k);
+    }
+}
+
+template <typename T>
+__aicore__ inline void Im2colND<T>::ZeroRows(uint32_t cCount, uint32_t rowStart, uint32_t rowCount)
+{
+    if (rowCount == 0) {
+        return;
+    }
+    LocalTensor<int16_t> bandLocal = bandBuf.Get<int16_t>();
+    uint32_t scale = sizeof(T) / sizeof(int16_t);
+    for (uint32_t c = 0; c < cCount; c++) {
+        Duplicate(
+            bandLocal[(c * bandH + rowStart) * bandW * scale], static_cast<int16_t>(0), rowCount * bandW * scale);
+    }
+}
+
+// 搬入[ohStart, ohStart + ohCount)输出行对应的输入行，超出输入范围的行置零
+template <typename T>
+__aicore__ inline void Im2colND<T>::LoadBand(
+    int64_t batchIdx, int64_t cStart, uint32_t cCount, int64_t ohStart, uint32_t ohCount)
+{
+    int64_t rowNeed = (ohCount - 1) * strideH + (kernelH - 1) * dilationH + 1;
+    int64_t hBase = ohStart * strideH - padTop;
+    int64_t hStart = Max(hBase, static_cast<int64_t>(0));
+    int64_t hEnd = Max(Min(hBase + rowNeed, inH), hStart);
+    uint32_t rowCount = static_cast<uint32_t>(hEnd - hStart);
+    uint32_t topRows = rowCount == 0 ? static_cast<uint32_t>(rowNeed) : static_cast<uint32_t>(hStart - hBase);
+    uint32_t bottomStart = topRows + rowCount;
+
+    // 上一个单元的Gather读完行带后才能覆盖
+    SyncFlag<HardEvent::V_MTE2>();
+    ZeroRows(cCount, 0, topRows);
+    ZeroRows(cCount, bottomStart, static_cast<uint32_t>(rowNeed) - bottomStart);
+    if (rowCount > 0) {
+        LocalTensor<T> bandLocal = bandBuf.Get<T>();
+        uint32_t dstGap = (bandW - wAlign) * sizeof(T) / BYTE_BLOCK;
+        DataCopyPadExtParams<T> padParams = {true, 0, static_cast<uint8_t>(wAlign - inW), static_cast<T>(0)};
+        uint64_t srcOffset = ((batchIdx * channel + cStart) * inH + hStart) * inW;
+        if (rowCount == inH && rowCount == bandH && cCount * rowCount <= MAX_BLOCK_COUNT) {
+            // 行带恰为整张输入平面时，多个通道的行在GM和UB上都是等间隔的，一次搬完
+            DataCopyExtParams copyParams = {
+                static_cast<uint16_t>(cCount * rowCount), static_cast<uint32_t>(inW * sizeof(T)), 0, dstGap, 0};
+            DataCopyPad(bandLocal[leftAlign], xGm[srcOffset], copyParams, padParams);
+        } else {
+            DataCopyExtParams copyParams = {
+                static_cast<uint16_t>(rowCount), static_cast<uint32_t>(inW * sizeof(T)), 0, dstGap, 0};
+            for (uint32_t c = 0; c < cCount; c++) {
+                DataCopyPad(
+                    bandLocal[(c * bandH + topRows) * bandW + leftAlign], xGm[srcOffset + c * inH * inW], copyParams,
+                    padParams);
+            }
+        }
+    }
+    SyncFlag<HardEvent::MTE2_V>();
+}
+
+// 核位置(ki, kj)的窗口元素位于行带内偏移(ki * dilationH, kj * dilationW)处
+template <typename T>
+__aicore__ inline void Im2colND<T>::GatherKernelPos(
+    int64_t batchIdx, int64_t cStart, uint32_t cCount, int64_t ohStart, uint32_t ohCount, int64_t kernelPos)
+{
+    int64_t ki = kernelPos / kernelW;
+    int64_t kj = kernelPos % kernelW;
+    uint32_t count = cCount * segAlign;
+    LocalTensor<int32_t> tableLocal = tableBuf.Get<int32_t>();
+    LocalTensor<int32_t> offsetLocal = offsetBuf.Get<int32_t>();
+    Adds(
+        offsetLocal, tableLocal, static_cast<int32_t>((ki * dilationH * bandW + kj * dilationW) * sizeof(T)), count);
+    PipeBarrier<PIPE_V>();
+
+    LocalTensor<T> outLocal = outQueue.AllocTensor<T>();
+    LocalTensor<uint32_t> gatherOffset = offsetLocal.template ReinterpretCast<uint32_t>();
+    if constexpr (sizeof(T) == sizeof(half)) {
+        LocalTensor<half> dstHalf = outLocal.template ReinterpretCast<half>();
+        LocalTensor<half> srcHalf = bandBuf.Get<half>();
+        Gather(dstHalf, srcHalf, gatherOffset, static_cast<uint32_t>(0), count);
+    } else {
+        LocalTensor<T> bandLocal = bandBuf.Get<T>();
+        Gather(outLocal, bandLocal, gatherOffset, static_cast<uint32_t>(0), count);
+    }
+    PipeBarrier<PIPE_V>();
+    outQueue.EnQue(outLocal);
+    outLocal = outQueue.DeQue<T>();
+
+    // 同一核位置相邻通道的输出行在GM上间隔kernelH * kernelW行
+    uint32_t segLen = ohCount * static_cast<uint32_t>(outW);
+    uint32_t srcGap = (segAlign - CeilAlign(segLen, alignNum)) * sizeof(T) / BYTE_BLOCK;
+    int64_t kernelNum = kernelH * kernelW;
+    int64_t colLen = outH * outW;
+    DataCopyExtParams copyParams = {
+        static_cast<uint16_t>(cCount), static_cast<uint32_t>(segLen * sizeof(T)), srcGap,
+        static_cast<uint32_t>((kernelNum * colLen - segLen) * sizeof(T)), 0};
+    uint64_t dstOffset = ((batchIdx * channel + cStart) * kernelNum + kernelPos) * colLen + ohStart * outW;
+    DataCopyPad(yGm[dstOffset], outLocal, copyParams);
+    outQueue.FreeTensor(outLocal);
+}
+} // namespace Im2col
+
+#endif // IM2COL_H
@@ -152,6 +152,27 @@ TEST_F(l2_im2col_test, case_dim3_FLOAT)
     EXPECT_EQ(aclRet, ACLNN_ERR_INNER_NULLPTR);
 }
 
+// 910B上3维输入直接下发仓内Im2col kernel，列数据写入连续的out
+TEST_F(l2_im2col_test, ascend910B2_case_dim3_FLOAT_direct_out)
+{
+    auto tensor_desc = TensorDesc({2, 2, 3}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto out_desc = TensorDesc({8, 4}, ACL_FLOAT, ACL_FORMAT_ND);
+    vector<int64_t> kernel = {2, 2};
+    vector<int64_t> dilation = {1, 1};
+    vector<int64_t> padding = {1, 1};
+    vector<int64_t> stride = {2, 2};
+    auto kernel_desc = IntArrayDesc(kernel);
+    auto dilation_desc = IntArrayDesc(dilation);
+    auto padding_desc = IntArrayDesc(padding);
+    auto stride_desc = IntArrayDesc(stride);
+    auto ut = OP_API_UT(
+        aclnnIm2col, INPUT(tensor_desc, kernel_desc, dilation_desc, padding_desc, stride_desc), OUTPUT(out_desc));
+    // SAMPLE: only test GetWorkspaceSize
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
 TEST_F(l2_im2col_test, case_not_contiguous)
 {
     auto tensor_desc = TensorDesc({1, 3, 4}, ACL_FLOAT, ACL_FORMAT_ND, {12, 1, 3}, 0, {1, 4, 3});
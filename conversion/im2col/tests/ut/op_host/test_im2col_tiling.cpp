@@ -0,0 +1,187 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file test_im2col_tiling.cpp
+ * \brief
+ */
+
+#include <iostream>
+#include <vector>
+#include <gtest/gtest.h>
+#include "../../../op_host/im2col_tiling.h"
+#include "tiling_context_faker.h"
+#include "tiling_case_executor.h"
+
+class Im2colTiling : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        std::cout << "Im2colTiling SetUp" << std::endl;
+    }
+    static void TearDownTestCase()
+    {
+        std::cout << "Im2colTiling TearDown" << std::endl;
+    }
+};
+
+static std::vector<gert::TilingContextPara::OpAttr> BuildAttrs(
+    const std::vector<int64_t>& ksizes, const std::vector<int64_t>& strides, const std::vector<int64_t>& dilations,
+    const std::string& paddingMode, const std::vector<int64_t>& pads)
+{
+    return {
+        gert::TilingContextPara::OpAttr("ksizes", Ops::Math::AnyValue::CreateFrom<std::vector<int64_t>>(ksizes)),
+        gert::TilingContextPara::OpAttr("strides", Ops::Math::AnyValue::CreateFrom<std::vector<int64_t>>(strides)),
+        gert::TilingContextPara::OpAttr(
+            "dilations", Ops::Math::AnyValue::CreateFrom<std::vector<int64_t>>(dilations)),
+        gert::TilingContextPara::OpAttr("padding_mode", Ops::Math::AnyValue::CreateFrom<std::string>(paddingMode)),
+        gert::TilingContextPara::OpAttr("pads", Ops::Math::AnyValue::CreateFrom<std::vector<int64_t>>(pads))};
+}
+
+TEST_F(Im2colTiling, im2col_tiling_float_pad)
+{
+    optiling::Im2colCompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "Im2col",
+        {
+            {{{2, 64, 56, 56}, {2, 64, 56, 56}}, ge::DT_FLOAT, ge::FORMAT_NCHW},
+        },
+        {
+            {{{2, 576, 3136}, {2, 576, 3136}}, ge::DT_FLOAT, ge::FORMAT_NCHW},
+        },
+        BuildAttrs({3, 3}, {1, 1}, {1, 1}, "CALCULATED", {1, 1, 1, 1}), &compileInfo);
+    uint64_t expectTilingKey = 1;
+    std::string expectTilingData =
+        "1 0 2 64 56 56 56 56 3 3 1 1 1 1 1 1 240518168578 309237645370 240518168584 274877910080 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(Im2colTiling, im2col_tiling_float16_3d_stride)
+{
+    optiling::Im2colCompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "Im2col",
+        {
+            {{{32, 32, 32}, {32, 32, 32}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+        },
+        {
+            {{{128, 256}, {128, 256}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+        },
+        BuildAttrs({2, 2}, {2, 2}, {1, 1}, "CALCULATED", {0, 0, 0, 0}), &compileInfo);
+    uint64_t expectTilingKey = 2;
+    std::string expectTilingData =
+        "1 0 1 32 32 32 16 16 2 2 2 2 1 1 0 0 34359738369 137438953488 137438953472 274877907072 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(Im2colTiling, im2col_tiling_bfloat16_channel_block)
+{
+    optiling::Im2colCompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "Im2col",
+        {
+            {{{1, 512, 14, 14}, {1, 512, 14, 14}}, ge::DT_BF16, ge::FORMAT_ND},
+        },
+        {
+            {{{1, 4608, 196}, {1, 4608, 196}}, ge::DT_BF16, ge::FORMAT_ND},
+        },
+        BuildAttrs({3, 3}, {1}, {1}, "CALCULATED", {1}), &compileInfo);
+    uint64_t expectTilingKey = 3;
+    std::string expectTilingData =
+        "1 0 1 512 14 14 14 14 3 3 1 1 1 1 1 1 60129542152 137438953488 68719476752 274877907152 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(Im2colTiling, im2col_tiling_float_large_channel)
+{
+    optiling::Im2colCompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "Im2col",
+        {
+            {{{64, 1024, 7, 7}, {64, 1024, 7, 7}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{64, 9216, 49}, {64, 9216, 49}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        BuildAttrs({3, 3}, {1, 1}, {1, 1}, "CALCULATED", {1, 1}), &compileInfo);
+    uint64_t expectTilingKey = 1;
+    std::string expectTilingData =
+        "8 0 64 1024 7 7 7 7 3 3 1 1 1 1 1 1 30064771204 68719476745 34359738376 274877907000 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(Im2colTiling, im2col_tiling_float_dilation)
+{
+    optiling::Im2colCompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "Im2col",
+        {
+            {{{1, 4, 8, 8}, {1, 4, 8, 8}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{1, 36, 16}, {1, 36, 16}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        BuildAttrs({3, 3}, {2, 2}, {2, 2}, "CALCULATED", {2, 2, 2, 2}), &compileInfo);
+    uint64_t expectTilingKey = 1;
+    std::string expectTilingData =
+        "1 0 1 4 8 8 4 4 3 3 2 2 2 2 2 2 4294967297 103079215109 34359738376 68719476744 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(Im2colTiling, im2col_tiling_invalid_padding_mode)
+{
+    optiling::Im2colCompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "Im2col",
+        {
+            {{{1, 4, 8, 8}, {1, 4, 8, 8}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{1, 36, 64}, {1, 36, 64}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        BuildAttrs({3, 3}, {1, 1}, {1, 1}, "SAME", {1, 1, 1, 1}), &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
+
+TEST_F(Im2colTiling, im2col_tiling_invalid_ksizes)
+{
+    optiling::Im2colCompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "Im2col",
+        {
+            {{{1, 4, 8, 8}, {1, 4, 8, 8}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{1, 108, 36}, {1, 108, 36}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        BuildAttrs({3, 3, 3}, {1, 1}, {1, 1}, "CALCULATED", {0}), &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
+
+TEST_F(Im2colTiling, im2col_tiling_output_shape_mismatch)
+{
+    optiling::Im2colCompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "Im2col",
+        {
+            {{{1, 4, 8, 8}, {1, 4, 8, 8}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{1, 36, 64}, {1, 36, 64}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        BuildAttrs({3, 3}, {1, 1}, {1, 1}, "CALCULATED", {0}), &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
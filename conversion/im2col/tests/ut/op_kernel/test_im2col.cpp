@@ -0,0 +1,173 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+/*!
+ * \file test_im2col.cpp
+ * \brief
+ */
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+#include "tikicpulib.h"
+#include "data_utils.h"
+
+using namespace std;
+
+extern "C" __global__ __aicore__ void im2col(GM_ADDR x, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling);
+
+class im2col_test : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        cout << "im2col_test SetUp\n" << endl;
+    }
+    static void TearDownTestCase()
+    {
+        cout << "im2col_test TearDown\n" << endl;
+    }
+};
+
+struct Im2colParam {
+    int64_t batch;
+    int64_t channel;
+    int64_t inH;
+    int64_t inW;
+    int64_t kernel[2];
+    int64_t stride[2];
+    int64_t dilation[2];
+    int64_t pads[4];
+};
+
+static int64_t CeilAlign(int64_t a, int64_t b)
+{
+    return (a + b - 1) / b * b;
+}
+
+// 按指定的通道块、输出行块构造tiling，其余字段与host侧计算方式一致
+static void InitTilingData(
+    Im2colTilingData* tilingData, const Im2colParam& param, int64_t typeSize, uint32_t cFactor, uint32_t ohFactor,
+    uint32_t blockDim)
+{
+    int64_t alignNum = 32 / typeSize;
+    int64_t outH = (param.inH + param.pads[0] + param.pads[1] - (param.dilation[0] * (param.kernel[0] - 1) + 1)) /
+                       param.stride[0] +
+                   1;
+    int64_t outW = (param.inW + param.pads[2] + param.pads[3] - (param.dilation[1] * (param.kernel[1] - 1) + 1)) /
+                       param.stride[1] +
+                   1;
+    int64_t leftAlign = CeilAlign(param.pads[2], alignNum);
+    int64_t needCols =
+        leftAlign - param.pads[2] + (outW - 1) * param.stride[1] + (param.kernel[1] - 1) * param.dilation[1] + 1;
+    uint64_t unitNum = param.batch * ((param.channel + cFactor - 1) / cFactor) * ((outH + ohFactor - 1) / ohFactor);
+    tilingData->unitsPerCore = unitNum / blockDim;
+    tilingData->tailUnits = unitNum % blockDim;
+    tilingData->batch = param.batch;
+    tilingData->channel = param.channel;
+    tilingData->inH = param.inH;
+    tilingData->inW = param.inW;
+    tilingData->outH = outH;
+    tilingData->outW = outW;
+    tilingData->kernelH = param.kernel[0];
+    tilingData->kernelW = param.kernel[1];
+    tilingData->strideH = param.stride[0];
+    tilingData->strideW = param.stride[1];
+    tilingData->dilationH = param.dilation[0];
+    tilingData->dilationW = param.dilation[1];
+    tilingData->padTop = param.pads[0];
+    tilingData->padLeft = param.pads[2];
+    tilingData->cFactor = cFactor;
+    tilingData->ohFactor = ohFactor;
+    tilingData->bandH = (ohFactor - 1) * param.stride[0] + (param.kernel[0] - 1) * param.dilation[0] + 1;
+    tilingData->bandW = CeilAlign(std::max(leftAlign + param.inW, needCols), alignNum);
+    tilingData->leftAlign = leftAlign;
+    tilingData->wAlign = CeilAlign(param.inW, alignNum);
+    tilingData->segAlign = CeilAlign(ohFactor * outW, alignNum);
+    tilingData->usedCoreNum = blockDim;
+}
+
+static vector<float> Im2colRef(const vector<float>& x, const Im2colParam& param, int64_t outH, int64_t outW)
+{
+    int64_t kernelNum = param.kernel[0] * param.kernel[1];
+    vector<float> y(param.batch * param.channel * kernelNum * outH * outW, 0.0f);
+    for (int64_t n = 0; n < param.batch; n++) {
+        for (int64_t c = 0; c < param.channel; c++) {
+            for (int64_t k = 0; k < kernelNum; k++) {
+                int64_t ki = k / param.kernel[1];
+                int64_t kj = k % param.kernel[1];
+                for (int64_t oh = 0; oh < outH; oh++) {
+                    for (int64_t ow = 0; ow < outW; ow++) {
+                        int64_t h = oh * param.stride[0] - param.pads[0] + ki * param.dilation[0];
+                        int64_t w = ow * param.stride[1] - param.pads[2] + kj * param.dilation[1];
+                        if (h < 0 || h >= param.inH || w < 0 || w >= param.inW) {
+                            continue;
+                        }
+                        y[((n * param.channel + c) * kernelNum + k) * outH * outW + oh * outW + ow] =
+                            x[((n * param.channel + c) * param.inH + h) * param.inW + w];
+                    }
+                }
+            }
+        }
+    }
+    return y;
+}
+
+static void RunFloatIm2col(const Im2colParam& param, uint32_t cFactor, uint32_t ohFactor, uint32_t blockDim)
+{
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(sizeof(Im2colTilingData));
+    Im2colTilingData* tilingData = reinterpret_cast<Im2colTilingData*>(tiling);
+    InitTilingData(tilingData, param, sizeof(float), cFactor, ohFactor, blockDim);
+    int64_t outH = tilingData->outH;
+    int64_t outW = tilingData->outW;
+    size_t inSize = param.batch * param.channel * param.inH * param.inW;
+    size_t outSize = param.batch * param.channel * param.kernel[0] * param.kernel[1] * outH * outW;
+    vector<float> xHost(inSize);
+    for (size_t i = 0; i < inSize; i++) {
+        xHost[i] = static_cast<float>(i % 251) * 0.5f - 60.0f;
+    }
+    uint8_t* x = (uint8_t*)AscendC::GmAlloc(inSize * sizeof(float));
+    uint8_t* y = (uint8_t*)AscendC::GmAlloc(outSize * sizeof(float));
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(16 * 1024 * 1024);
+    memcpy(x, xHost.data(), inSize * sizeof(float));
+
+    ICPU_SET_TILING_KEY(1);
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_RUN_KF(im2col, blockDim, x, y, workspace, (uint8_t*)(tilingData));
+
+    vector<float> expect = Im2colRef(xHost, param, outH, outW);
+    EXPECT_EQ(memcmp(y, expect.data(), outSize * sizeof(float)), 0);
+
+    AscendC::GmFree(x);
+    AscendC::GmFree(y);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+}
+
+TEST_F(im2col_test, test_float_pad_whole_plane)
+{
+    Im2colParam param = {2, 3, 7, 9, {3, 3}, {1, 1}, {1, 1}, {1, 1, 1, 1}};
+    RunFloatIm2col(param, 3, 7, 2);
+}
+
+TEST_F(im2col_test, test_float_channel_and_row_blocks)
+{
+    // 通道、输出行都有尾块，上下pad不对称
+    Im2colParam param = {1, 5, 10, 11, {2, 3}, {2, 3}, {2, 1}, {0, 2, 3, 1}};
+    RunFloatIm2col(param, 2, 2, 3);
+}
+
+TEST_F(im2col_test, test_float_dilation_large_pad)
+{
+    Im2colParam param = {3, 2, 13, 6, {4, 2}, {3, 1}, {1, 2}, {4, 4, 0, 5}};
+    RunFloatIm2col(param, 1, 3, 4);
+}
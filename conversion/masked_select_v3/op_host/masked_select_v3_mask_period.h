@@ -0,0 +1,62 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file masked_select_v3_mask_period.h
+ * \brief MaskedSelectV3按周期复用mask的判定，aclnn选择是否省去BroadcastTo与tiling计算maskPeriod共用
+ */
+#ifndef OPS_BUILT_IN_OP_TILING_RUNTIME_MASKED_SELECT_V3_MASK_PERIOD_H
+#define OPS_BUILT_IN_OP_TILING_RUNTIME_MASKED_SELECT_V3_MASK_PERIOD_H
+
+#include <cstdint>
+
+namespace masked_select_v3 {
+// 周期需按256元素对齐；上限取各数据类型下tiling可用UB长度的最小值以内，保证一个周期能整体放入UB
+constexpr uint64_t MASK_PERIOD_ALIGN = 256;
+constexpr uint64_t MASK_PERIOD_MAX = 4096;
+
+// mask去掉前导的1后须与x的尾部各维逐一相等，即mask只在前导维上广播，此时mask按x的元素顺序周期出现
+template <typename ShapeT>
+inline bool IsLeadingBroadcast(const ShapeT& xShape, const ShapeT& maskShape)
+{
+    size_t xDimNum = xShape.GetDimNum();
+    size_t maskDimNum = maskShape.GetDimNum();
+    size_t start = 0;
+    while (start < maskDimNum && maskShape.GetDim(start) == 1) {
+        start++;
+    }
+    size_t validDimNum = maskDimNum - start;
+    if (validDimNum > xDimNum) {
+        return false;
+    }
+    for (size_t i = 0; i < validDimNum; i++) {
+        if (maskShape.GetDim(start + i) != xShape.GetDim(xDimNum - validDimNum + i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// mask为x的前导维广播，且周期满足对齐与长度上限时，kernel可按周期复用mask
+template <typename ShapeT>
+inline bool IsPeriodicMask(const ShapeT& xShape, const ShapeT& maskShape)
+{
+    if (!IsLeadingBroadcast(xShape, maskShape)) {
+        return false;
+    }
+    uint64_t xLength = static_cast<uint64_t>(xShape.GetShapeSize());
+    uint64_t maskLength = static_cast<uint64_t>(maskShape.GetShapeSize());
+    return maskLength != 0u && xLength % maskLength == 0u && maskLength % MASK_PERIOD_ALIGN == 0u &&
+           maskLength <= MASK_PERIOD_MAX;
+}
+} // namespace masked_select_v3
+
+#endif // OPS_BUILT_IN_OP_TILING_RUNTIME_MASKED_SELECT_V3_MASK_PERIOD_H
@@ -17,6 +17,7 @@
 #include "util/math_util.h"
 #include "log/log.h"
 #include "masked_select_v3_tiling.h"
+#include "masked_select_v3_mask_period.h"
 
 namespace {
 constexpr static uint64_t BLOCK_SIZE = 256;
@@ -48,6 +49,8 @@ public:
     void TilingDataPrint();
 
 private:
+    ge::graphStatus InitMaskPeriod(uint64_t ubLength);
+
     MaskedSelectV3TilingData tiling;
 
     gert::TilingContext* tilingContext = nullptr;
@@ -71,11 +74,40 @@ private:
     uint64_t tailLastTileLength = 0;
 
     uint64_t blockDim = 0;
+    uint64_t maskPeriod = 0;
 
     // 求单个元素大小
     uint64_t sizeOfDataType = 1;
     uint64_t dataType = tilingContext->GetInputDesc(0)->GetDataType();
 };
+ge::graphStatus MaskedSelectV3Tiling::InitMaskPeriod(uint64_t ubLength)
+{
+    // mask与x等长时走逐元素mask；mask为x尾轴广播（aclnn未做BroadcastTo）时按周期复用mask
+    const gert::Shape& xShape = tilingContext->GetInputShape(0)->GetStorageShape();
+    const gert::Shape& maskShape = tilingContext->GetInputShape(1)->GetStorageShape();
+    uint64_t maskLength = maskShape.GetShapeSize();
+    if (maskLength == totalLength) {
+        maskPeriod = 0;
+        return ge::GRAPH_SUCCESS;
+    }
+    // 非前导维广播(如x为[B,N,H]、mask为[B,1,H])时mask不是周期出现的，不能按周期复用
+    if (!masked_select_v3::IsLeadingBroadcast(xShape, maskShape)) {
+        OP_LOGE(
+            tilingContext->GetNodeName(), "mask(%zu dims) should only broadcast over leading dims of x(%zu dims).",
+            maskShape.GetDimNum(), xShape.GetDimNum());
+        return ge::GRAPH_FAILED;
+    }
+    // 与aclnn省去BroadcastTo的判定共用同一规则，ubLength为当前数据类型下的兜底校验
+    if (!masked_select_v3::IsPeriodicMask(xShape, maskShape) || maskLength > ubLength) {
+        OP_LOGE(
+            tilingContext->GetNodeName(), "mask length %lu can not be broadcast to x length %lu, ubLength %lu.",
+            maskLength, totalLength, ubLength);
+        return ge::GRAPH_FAILED;
+    }
+    maskPeriod = maskLength;
+    return ge::GRAPH_SUCCESS;
+}
+
 ge::graphStatus MaskedSelectV3Tiling::Init()
 {
     OP_LOGD(tilingContext->GetNodeName(), "Tiling init start.");
@@ -136,24 +168,32 @@ ge::graphStatus MaskedSelectV3Tiling::Init()
     OP_LOGD(tilingContext->GetNodeName(), "totalLength: %lu.", totalLength);
     // ub能放的元素个数
     uint64_t ubLength = ubBlockNum * ALIGN_NUM;
+    if (InitMaskPeriod(ubLength) != ge::GRAPH_SUCCESS) {
+        return ge::GRAPH_FAILED;
+    }
+    // 分核与核内切分都以unitLength为粒度，mask广播时保证每个tile从周期起点开始
+    uint64_t unitLength = (maskPeriod == 0u) ? 1u : maskPeriod;
+    ubLength = ubLength / unitLength * unitLength;
+    uint64_t totalUnits = totalLength / unitLength;
     // block数量
     uint64_t ubNum = (totalLengthAlignedWithBlock + ubLength - 1) / ubLength;
 
     // 运行核数
     blockDim = (ubNum > aivNum) ? aivNum : ubNum;
+    blockDim = (blockDim > totalUnits) ? totalUnits : blockDim;
     tilingContext->SetBlockDim(blockDim);
 
     tilingKey = sizeOfDataType;
     tilingContext->SetTilingKey(tilingKey);
 
     // 切分流程
-    formerNum = totalLength % blockDim;
+    formerNum = totalUnits % blockDim;
     if (formerNum == 0u) {
         formerNum = blockDim;
     }
     tailNum = blockDim - formerNum;
 
-    formerLength = (totalLength + blockDim - 1) / blockDim;
+    formerLength = (totalUnits + blockDim - 1) / blockDim * unitLength;
     formerTileNum = (formerLength + ubLength - 1) / ubLength;
     formerTileLength = ubLength;
     formerLastTileLength = formerLength % ubLength;
@@ -189,6 +229,7 @@ ge::graphStatus MaskedSelectV3Tiling::RunKernelTiling()
     tiling.set_tailtileNum(tailTileNum);
     tiling.set_tailtileLength(tailTileLength);
     tiling.set_taillasttileLength(tailLastTileLength);
+    tiling.set_maskPeriod(maskPeriod);
     tiling.SaveToBuffer(tilingContext->GetRawTilingData()->GetData(), tilingContext->GetRawTilingData()->GetCapacity());
     tilingContext->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
 
@@ -196,7 +237,8 @@ ge::graphStatus MaskedSelectV3Tiling::RunKernelTiling()
     uint32_t sysWorkspaceSize = compileInfo->workSpaceSize;
     size_t* currentWorkspace = tilingContext->GetWorkspaceSizes(
         1); // 通过框架获取workspace的指针，GetWorkspaces入参所需workspace的块数。当前限制使用一块。
-    size_t usrSize = totalLengthAlignedWithBlock * sizeOfDataType + blockDim * 64u;
+    // 各核结果直接写到输出，workspace只需存放每核的选中个数（每核占64B）
+    size_t usrSize = blockDim * 64u;
     OP_LOGD(tilingContext->GetNodeName(), "usrWorkspaceSize: %lu.", usrSize);
     currentWorkspace[0] =
         usrSize + sysWorkspaceSize; // 设置总的workspace的数值大小，总的workspace空间框架来申请并管理。
@@ -218,6 +260,7 @@ void MaskedSelectV3Tiling::TilingDataPrint()
     OP_LOGD(tilingContext->GetNodeName(), "tailTileNum: %lu.", tiling.get_tailtileNum());
     OP_LOGD(tilingContext->GetNodeName(), "tailTileLength: %lu.", tiling.get_tailtileLength());
     OP_LOGD(tilingContext->GetNodeName(), "tailLastTileLength: %lu.", tiling.get_taillasttileLength());
+    OP_LOGD(tilingContext->GetNodeName(), "maskPeriod: %lu.", tiling.get_maskPeriod());
 }
 
 ge::graphStatus TilingForMaskedSelectV3(gert::TilingContext* context)
@@ -36,6 +36,7 @@ TILING_DATA_FIELD_DEF(uint64_t, tailLength);
 TILING_DATA_FIELD_DEF(uint64_t, tailtileNum);
 TILING_DATA_FIELD_DEF(uint64_t, tailtileLength);
 TILING_DATA_FIELD_DEF(uint64_t, taillasttileLength);
+TILING_DATA_FIELD_DEF(uint64_t, maskPeriod); // mask按尾轴广播时的周期长度，0表示mask与x等长
 END_TILING_DATA_DEF;
 
 REGISTER_TILING_DATA_CLASS(MaskedSelectV3, MaskedSelectV3TilingData)
@@ -23,6 +23,7 @@
 #include "opdev/op_log.h"
 #include "opdev/tensor_view_utils.h"
 #include "../../../broadcast_to/op_host/op_api/broadcast_to.h"
+#include "../masked_select_v3_mask_period.h"
 
 using namespace op;
 #ifdef __cplusplus
@@ -174,6 +175,20 @@ static bool IsAiCoreSupport(const aclTensor* self)
     return false;
 }
 
+// mask为self尾部维度的广播（如[H]、[1,H]对[B,S,H]）时，MaskedSelectV3直接按周期读取mask，无需BroadcastTo物化
+static bool IsPeriodicMaskSupport(const aclTensor* self, const aclTensor* mask, const op::Shape& broadcastShape)
+{
+    if (GetCurrentPlatformInfo().GetSocVersion() == SocVersion::ASCEND910_95) {
+        return false;
+    }
+    const op::Shape& selfShape = self->GetViewShape();
+    const op::Shape& maskShape = mask->GetViewShape();
+    if (selfShape != broadcastShape) {
+        return false;
+    }
+    return masked_select_v3::IsPeriodicMask(selfShape, maskShape);
+}
+
 aclnnStatus aclnnMaskedSelectGetWorkspaceSize(
     const aclTensor* self, const aclTensor* mask, aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor)
 {
@@ -220,7 +235,8 @@ aclnnStatus aclnnMaskedSelectGetWorkspaceSize(
         // 判断输入shape不相等需要调用BroadcastTo
         if (self->GetViewShape() != mask->GetViewShape()) {
             op::Shape broadcastShape;
-            if (BroadcastInferShape(self->GetViewShape(), mask->GetViewShape(), broadcastShape)) {
+            if (BroadcastInferShape(self->GetViewShape(), mask->GetViewShape(), broadcastShape) &&
+                !IsPeriodicMaskSupport(self, mask, broadcastShape)) {
                 op::FVector<int64_t, op::MAX_DIM_NUM> broadcastDims = op::ToShapeVector(broadcastShape);
                 auto broadcastShapeArray =
                     uniqueExecutor.get()->AllocIntArray(broadcastDims.data(), broadcastDims.size());
@@ -27,7 +27,7 @@ extern "C" __global__ __aicore__ void masked_select_v3(
             x, mask, y, shapeout, usrWorkspace, tiling_data.formerNum, tiling_data.formerLength,
             tiling_data.formertileNum, tiling_data.formertileLength, tiling_data.formerlasttileLength,
             tiling_data.tailNum, tiling_data.tailLength, tiling_data.tailtileNum, tiling_data.tailtileLength,
-            tiling_data.taillasttileLength);
+            tiling_data.taillasttileLength, tiling_data.maskPeriod);
         op.Process(y, shapeout);
     } else if (TILING_KEY_IS(4)) {
         AscendC::KernelMaskedSelectV3<uint32_t> op;
@@ -35,7 +35,7 @@ extern "C" __global__ __aicore__ void masked_select_v3(
             x, mask, y, shapeout, usrWorkspace, tiling_data.formerNum, tiling_data.formerLength,
             tiling_data.formertileNum, tiling_data.formertileLength, tiling_data.formerlasttileLength,
             tiling_data.tailNum, tiling_data.tailLength, tiling_data.tailtileNum, tiling_data.tailtileLength,
-            tiling_data.taillasttileLength);
+            tiling_data.taillasttileLength, tiling_data.maskPeriod);
         op.Process(y, shapeout);
     } else if (TILING_KEY_IS(2)) {
         AscendC::KernelMaskedSelectV3<uint16_t> op;
@@ -43,7 +43,7 @@ extern "C" __global__ __aicore__ void masked_select_v3(
             x, mask, y, shapeout, usrWorkspace, tiling_data.formerNum, tiling_data.formerLength,
             tiling_data.formertileNum, tiling_data.formertileLength, tiling_data.formerlasttileLength,
             tiling_data.tailNum, tiling_data.tailLength, tiling_data.tailtileNum, tiling_data.tailtileLength,
-            tiling_data.taillasttileLength);
+            tiling_data.taillasttileLength, tiling_data.maskPeriod);
         op.Process(y, shapeout);
     } else if (TILING_KEY_IS(1)) {
         AscendC::KernelMaskedSelectV3<uint8_t> op;
@@ -51,7 +51,7 @@ extern "C" __global__ __aicore__ void masked_select_v3(
             x, mask, y, shapeout, usrWorkspace, tiling_data.formerNum, tiling_data.formerLength,
             tiling_data.formertileNum, tiling_data.formertileLength, tiling_data.formerlasttileLength,
             tiling_data.tailNum, tiling_data.tailLength, tiling_data.tailtileNum, tiling_data.tailtileLength,
-            tiling_data.taillasttileLength);
+            tiling_data.taillasttileLength, tiling_data.maskPeriod);
         op.Process(y, shapeout);
     }
 }
\ No newline at end of file
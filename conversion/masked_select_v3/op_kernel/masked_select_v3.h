@@ -49,6 +49,7 @@ constexpr uint32_t HEAD_BLOCK_SIZE = 64;
 constexpr uint32_t OFFSET_SHIFT_BITS = 3;     // offset偏移量移位输，<<3 等价于 *8
 constexpr uint32_t INT64_LENGTH_IN_INT32 = 2; // INT64 相当于 2个int32长
 constexpr uint32_t GATHER_RESULT_STRIDE = 8;
+constexpr uint32_t UB_BLOCK_SIZE = 32;
 
 template <typename T>
 class KernelMaskedSelectV3 {
@@ -60,12 +61,10 @@ public:
         GM_ADDR x, GM_ADDR mask, GM_ADDR y, GM_ADDR shapeout, GM_ADDR workspace, uint32_t formerNum,
         uint32_t formerLength, uint32_t formertileNum, uint32_t formertileLength, uint32_t formerlasttileLength,
         uint32_t tailNum, uint32_t tailLength, uint32_t tailtileNum, uint32_t tailtileLength,
-        uint32_t taillasttileLength)
+        uint32_t taillasttileLength, uint32_t maskPeriod)
     {
         ASSERT(GetBlockNum() != 0 && "block dim can not be zero!");
         this->blockDim = GetBlockNum();
-        __gm__ T* globalWorkTensor =
-            (__gm__ T*)((__gm__ uint64_t*)workspace + this->blockDim * (HEAD_BLOCK_SIZE / sizeof(uint64_t)));
 
         blockIdx = GetBlockIdx();
         this->formerNum = formerNum;
@@ -79,18 +78,20 @@ public:
         this->tailtileNum = tailtileNum;
         this->tailtileLength = tailtileLength;
         this->taillasttileLength = taillasttileLength;
+        this->maskPeriod = maskPeriod;
 
         if (blockIdx < this->formerNum) { // 分到大块核的处理
             this->tileLength = this->formertileLength / BUFFER_NUM;
             this->lasttileLength = this->formerlasttileLength / BUFFER_NUM;
             this->tileNum = this->formertileNum * BUFFER_NUM;
+            this->blockLength = this->formerLength;
             xGlobal.SetGlobalBuffer((__gm__ T*)x + this->formerLength * blockIdx, this->formerLength);
             maskGlobal.SetGlobalBuffer((__gm__ uint8_t*)mask + this->formerLength * blockIdx, this->formerLength);
-            workGlobal.SetGlobalBuffer(globalWorkTensor + this->formerLength * blockIdx, this->formerLength);
         } else { // 分到小块核的处理，需要处理的数据量比大核少alignNum个
             this->tileLength = this->tailtileLength / BUFFER_NUM;
             this->lasttileLength = this->taillasttileLength / BUFFER_NUM;
             this->tileNum = this->tailtileNum * BUFFER_NUM;
+            this->blockLength = this->tailLength;
 
             xGlobal.SetGlobalBuffer(
                 (__gm__ T*)x + this->formerLength * this->formerNum + this->tailLength * (blockIdx - this->formerNum),
@@ -99,10 +100,10 @@ public:
                 (__gm__ uint8_t*)mask + this->formerLength * this->formerNum +
                     this->tailLength * (blockIdx - this->formerNum),
                 this->tailLength);
-            workGlobal.SetGlobalBuffer(
-                globalWorkTensor + this->formerLength * this->formerNum +
-                    this->tailLength * (blockIdx - this->formerNum),
-                this->tailLength);
+        }
+        if (this->maskPeriod != 0) {
+            // mask沿尾轴广播：各核、各tile均从周期起点开始，只需读取一个周期
+            maskGlobal.SetGlobalBuffer((__gm__ uint8_t*)mask, this->maskPeriod);
         }
         shapeoutGlobal.SetGlobalBuffer((__gm__ uint64_t*)shapeout, SHAPEOUT_SIZE);
         offsetGlobal.SetGlobalBuffer((__gm__ uint64_t*)workspace, blockDim);
@@ -110,7 +111,7 @@ public:
         pipe.InitBuffer(inQueueX, BUFFER_NUM, this->tileLength * sizeof(T));
         pipe.InitBuffer(inQueueMask, BUFFER_NUM, this->tileLength * sizeof(uint8_t));
         pipe.InitBuffer(outQueueY, BUFFER_NUM, this->tileLength * sizeof(T));
-        pipe.InitBuffer(moveQue, BUFFER_NUM, this->tileLength * sizeof(T));
+        pipe.InitBuffer(countsBuf, this->blockDim * UB_BLOCK_SIZE);
 
         if constexpr (IS_8_BYTES_TYPE) {
             pipe.InitBuffer(maskCastBuf, this->tileLength * sizeof(float));
@@ -123,89 +124,130 @@ public:
         if constexpr (IS_1_BYTES_TYPE) {
             pipe.InitBuffer(xCastBuf, this->tileLength * sizeof(half));
             pipe.InitBuffer(yCastBuf, this->tileLength * sizeof(half));
+        } else if constexpr (IS_8_BYTES_TYPE) {
+            pipe.InitBuffer(countBuf, this->tileLength * INT64_LENGTH_IN_INT32 * sizeof(half));
+        } else {
+            pipe.InitBuffer(countBuf, this->tileLength * sizeof(half));
         }
     }
 
     __aicore__ inline void Process(GM_ADDR y, GM_ADDR shapeout)
     {
-        int32_t loopCount = this->tileNum;
-        // GYW 先处理可以整分的。
-        for (int32_t i = 0; i < loopCount; ++i) {
-            CopyIn(i);
-            Compute(i);
-            CopyOut2WorkSpace();
+        // 先只统计本核选中个数，前缀求和得到输出偏移后再把结果直接写到y，选中数据只经过HBM一次
+        if (this->maskPeriod != 0) {
+            LoadPeriodicMask();
+        } else if (this->tileNum == 1) {
+            // 单tile时gather结果可以留在UB中，跨SyncAll后直接写出，x与mask都只读一次
+            CopyIn(0);
+            Compute(0);
+            this->selectedNum = CountFromGather();
+        } else {
+            for (int32_t i = 0; i < this->tileNum; ++i) {
+                CopyInMask(i);
+                CountMask(i);
+            }
         }
         // workspace 写入 offset
-        offsetGlobal.SetValue(blockIdx << OFFSET_SHIFT_BITS, this->outOffset);
+        offsetGlobal.SetValue(blockIdx << OFFSET_SHIFT_BITS, this->selectedNum);
         DataCacheCleanAndInvalid<uint64_t, CacheLine::SINGLE_CACHE_LINE, DcciDst::CACHELINE_OUT>(
             offsetGlobal[blockIdx << OFFSET_SHIFT_BITS]);
         SyncAll();
-        uint64_t ind = 0;
-        for (int32_t i = 0; i < blockIdx; i++) {
-            DataCacheCleanAndInvalid<uint64_t, CacheLine::SINGLE_CACHE_LINE, DcciDst::CACHELINE_OUT>(
-                offsetGlobal[i << OFFSET_SHIFT_BITS]);
-            ind += offsetGlobal.GetValue(i << OFFSET_SHIFT_BITS);
-        }
-
-        yGlobal.SetGlobalBuffer((__gm__ T*)y + ind, this->outOffset);
+        uint64_t ind = GetPrefixOffset();
 
-        // 搬运至GM
-        loopCount = this->outOffset / this->tileLength;
-        int32_t tailLoopLength = this->outOffset % this->tileLength;
-        // GYW 先处理可以整分的。
-        for (int32_t i = 0; i < loopCount; ++i) {
-            CopyInMove(i, this->tileLength);
-            CopyOutMove(i, this->tileLength);
-        }
-        // 剩余不能被整分处理
-        if (tailLoopLength > 0) {
-            CopyInMove(loopCount, tailLoopLength);
-            CopyOutMove(loopCount, tailLoopLength);
+        yGlobal.SetGlobalBuffer((__gm__ T*)y + ind, this->selectedNum);
+        if (this->maskPeriod == 0 && this->tileNum == 1) {
+            CopyOut();
+        } else {
+            for (int32_t i = 0; i < this->tileNum; ++i) {
+                CopyIn(i);
+                Compute(i);
+                CopyOut();
+            }
         }
         if (this->blockIdx == this->blockDim - 1) {
             shapeoutGlobal.SetValue(0, 1);
-            shapeoutGlobal.SetValue(1, ind + this->outOffset);
+            shapeoutGlobal.SetValue(1, ind + this->selectedNum);
         }
     }
 
 private:
-    __aicore__ inline void CopyInMove(int32_t progress, int32_t length)
+    __aicore__ inline uint32_t GetTileLength(int32_t progress)
     {
-        LocalTensor<T> xLocal = moveQue.AllocTensor<T>();
-
-        if constexpr (IS_8_BYTES_TYPE) { // int64 uint64 double
-            DataCopyPadDoubleWord(xLocal, workGlobal[progress * (this->tileLength)], length);
-        } else {
-            DataCopyExtParams copyParams{1, static_cast<uint32_t>(length * sizeof(T)), 0, 0, 0};
-            DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
-            DataCopyPad(xLocal, workGlobal[progress * (this->tileLength)], copyParams, padParams);
+        if (progress == this->tileNum - 1) {
+            // 最后一个block，最后一个tile
+            return this->lasttileLength;
         }
-        moveQue.EnQue(xLocal);
+        return this->tileLength;
     }
 
-    __aicore__ inline void CopyOutMove(int32_t progress, int32_t length)
+    __aicore__ inline uint64_t GetPrefixOffset()
     {
-        LocalTensor<T> yLocal = moveQue.DeQue<T>();
+        if (blockIdx == 0) {
+            return 0;
+        }
+        // 所有低位核的计数一次搬入UB（每核64B间隔，搬入后按32B对齐存放），替代逐个DCCI+标量读GM
+        GlobalTensor<int32_t> countsGlobal;
+        countsGlobal.SetGlobalBuffer(
+            (__gm__ int32_t*)offsetGlobal.GetPhyAddr(), blockIdx * (HEAD_BLOCK_SIZE / sizeof(int32_t)));
+        LocalTensor<int32_t> countsLocal = countsBuf.Get<int32_t>();
+        DataCopyExtParams copyParams{
+            static_cast<uint16_t>(blockIdx), static_cast<uint32_t>(sizeof(uint64_t)),
+            static_cast<uint32_t>(HEAD_BLOCK_SIZE - sizeof(uint64_t)), 0, 0};
+        DataCopyPadExtParams<int32_t> padParams{false, 0, 0, 0};
+        DataCopyPad(countsLocal, countsGlobal, copyParams, padParams);
+        event_t eventIdMte2ToS = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::MTE2_S));
+        SetFlag<HardEvent::MTE2_S>(eventIdMte2ToS);
+        WaitFlag<HardEvent::MTE2_S>(eventIdMte2ToS);
 
-        if constexpr (IS_8_BYTES_TYPE) {
-            DataCopyPadDoubleWord(yGlobal[progress * (this->tileLength)], yLocal, length);
-        } else {
-            DataCopyExtParams copyParams{1, static_cast<uint32_t>(length * sizeof(T)), 0, 0, 0};
-            DataCopyPad(yGlobal[progress * (this->tileLength)], yLocal, copyParams);
+        LocalTensor<uint64_t> counts = countsLocal.template ReinterpretCast<uint64_t>();
+        uint64_t ind = 0;
+        for (uint32_t i = 0; i < blockIdx; i++) {
+            ind += counts.GetValue(i * (UB_BLOCK_SIZE / sizeof(uint64_t)));
         }
-        moveQue.FreeTensor(yLocal);
+        return ind;
+    }
+
+    __aicore__ inline void LoadPeriodicMask()
+    {
+        // 读入一个周期的mask并在UB内倍增复制到tileLength，bitMask整个核内常驻复用
+        LocalTensor<uint8_t> maskLocal = inQueueMask.AllocTensor<uint8_t>();
+        DataCopyExtParams copyParams{1, static_cast<uint32_t>(this->maskPeriod), 0, 0, 0};
+        DataCopyPadExtParams<uint8_t> padParams{false, 0, 0, 0};
+        DataCopyPad(maskLocal, maskGlobal, copyParams, padParams);
+        inQueueMask.EnQue(maskLocal);
+        maskLocal = inQueueMask.DeQue<uint8_t>();
+        for (uint32_t filled = this->maskPeriod; filled < this->tileLength;) {
+            uint32_t copyLength = (filled < this->tileLength - filled) ? filled : (this->tileLength - filled);
+            DataCopy(maskLocal[filled], maskLocal, copyLength);
+            PipeBarrier<PIPE_V>();
+            filled += copyLength;
+        }
+
+        LocalTensor<uint8_t> bitMaskLocal = bitMaskBuf.Get<uint8_t>();
+        GenerateMask(maskLocal, bitMaskLocal, this->tileLength);
+        uint64_t tileSelected = CountSelected(bitMaskLocal, this->tileLength);
+        inQueueMask.FreeTensor(maskLocal);
+        // 每个tile含整数个周期，本核选中个数 = 每周期选中个数 * 周期数
+        this->selectedNum =
+            tileSelected / (this->tileLength / this->maskPeriod) * (this->blockLength / this->maskPeriod);
+    }
+
+    __aicore__ inline void CopyInMask(int32_t progress)
+    {
+        LocalTensor<uint8_t> maskLocal = inQueueMask.AllocTensor<uint8_t>();
+        uint32_t ind = progress * this->tileLength;
+        uint32_t length = GetTileLength(progress);
+        DataCopyExtParams copyParams{1, static_cast<uint32_t>(length), 0, 0, 0};
+        DataCopyPadExtParams<uint8_t> padParams{false, 0, 0, 0};
+        DataCopyPad(maskLocal, maskGlobal[ind], copyParams, padParams);
+        inQueueMask.EnQue(maskLocal);
     }
 
     __aicore__ inline void CopyIn(int32_t progress)
     {
         LocalTensor<T> xLocal = inQueueX.AllocTensor<T>();
-        LocalTensor<uint8_t> maskLocal = inQueueMask.AllocTensor<uint8_t>();
         uint32_t ind = progress * this->tileLength;
-        uint32_t length = this->tileLength;
-        if (progress == this->tileNum - 1) {
-            // 最后一个block，最后一个tile
-            length = this->lasttileLength;
-        }
+        uint32_t length = GetTileLength(progress);
 
         if constexpr (IS_8_BYTES_TYPE) { // int64 uint64 double
             DataCopyPadDoubleWord(xLocal, xGlobal[ind], length);
@@ -214,15 +256,57 @@ private:
             DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
             DataCopyPad(xLocal, xGlobal[ind], copyParams, padParams);
         }
+        inQueueX.EnQue(xLocal);
 
-        {
-            DataCopyExtParams copyParams{1, static_cast<uint32_t>(length), 0, 0, 0};
-            DataCopyPadExtParams<uint8_t> padParams{false, 0, 0, 0};
-            DataCopyPad(maskLocal, maskGlobal[ind], copyParams, padParams);
+        if (this->maskPeriod == 0) {
+            CopyInMask(progress);
         }
+    }
 
-        inQueueX.EnQue(xLocal);
-        inQueueMask.EnQue(maskLocal);
+    __aicore__ inline void CountMask(int32_t progress)
+    {
+        LocalTensor<uint8_t> maskLocal = inQueueMask.DeQue<uint8_t>();
+        LocalTensor<uint8_t> bitMaskLocal = bitMaskBuf.Get<uint8_t>();
+        uint32_t length = GetTileLength(progress);
+        GenerateMask(maskLocal, bitMaskLocal, length);
+        this->selectedNum += CountSelected(bitMaskLocal, length);
+        inQueueMask.FreeTensor(maskLocal);
+    }
+
+    __aicore__ inline uint64_t CountSelected(const LocalTensor<uint8_t>& bitMaskLocal, uint32_t count)
+    {
+        // 以mask的half结果为源做一次GatherMask，rsvdCnt即bitMask中置位个数
+        GatherMaskParams params;
+        params.src0BlockStride = 1;
+        params.repeatTimes = 1;
+        params.src0RepeatStride = GATHER_RESULT_STRIDE;
+        params.src1RepeatStride = 1;
+
+        LocalTensor<half> maskCastLocal = maskCastBuf.Get<half>();
+        LocalTensor<uint16_t> bitMask = bitMaskLocal.ReinterpretCast<uint16_t>();
+        LocalTensor<half> dstLocal;
+        if constexpr (IS_1_BYTES_TYPE) {
+            dstLocal = yCastBuf.Get<half>();
+        } else {
+            dstLocal = countBuf.Get<half>();
+        }
+        uint64_t selected = 0;
+        if constexpr (IS_8_BYTES_TYPE) {
+            GatherMask(dstLocal, maskCastLocal, bitMask, true, count * INT64_LENGTH_IN_INT32, params, selected);
+            return selected / INT64_LENGTH_IN_INT32;
+        } else {
+            GatherMask(dstLocal, maskCastLocal, bitMask, true, count, params, selected);
+            return selected;
+        }
+    }
+
+    __aicore__ inline uint64_t CountFromGather()
+    {
+        if constexpr (IS_8_BYTES_TYPE) {
+            return rsvdCnt / INT64_LENGTH_IN_INT32;
+        } else {
+            return rsvdCnt;
+        }
     }
 
     __aicore__ inline void GenerateMask(const LocalTensor<uint8_t>& mask, LocalTensor<uint8_t>& bitMask, uint32_t count)
@@ -292,20 +376,20 @@ private:
     __aicore__ inline void Compute(int32_t progress)
     {
         LocalTensor<T> xLocal = inQueueX.DeQue<T>();
-        LocalTensor<uint8_t> maskLocal = inQueueMask.DeQue<uint8_t>();
         LocalTensor<T> yLocal = outQueueY.AllocTensor<T>();
         LocalTensor<uint8_t> bitMaskLocal = bitMaskBuf.Get<uint8_t>(); // GYW  DeQue 和 GET区别？
 
-        uint32_t length = this->tileLength;
-        if (progress == this->tileNum - 1) {
-            length = this->lasttileLength;
+        uint32_t length = GetTileLength(progress);
+        if (this->maskPeriod == 0) {
+            LocalTensor<uint8_t> maskLocal = inQueueMask.DeQue<uint8_t>();
+            GenerateMask(maskLocal, bitMaskLocal, length);
+            inQueueMask.FreeTensor(maskLocal);
         }
-        GenerateMask(maskLocal, bitMaskLocal, length);
+        // mask广播时bitMask在LoadPeriodicMask中已生成，tile长度为周期整数倍，可直接复用前length位
         GatherResult(yLocal, xLocal, bitMaskLocal, length);
 
         outQueueY.EnQue<T>(yLocal);
         inQueueX.FreeTensor(xLocal);
-        inQueueMask.FreeTensor(maskLocal);
     }
 
     __aicore__ inline void DataCopyPadDoubleWord(
@@ -336,16 +420,16 @@ private:
         DataCopyPad(dstCastGlobal, srcCastLocal, copyParams);
     }
 
-    __aicore__ inline void CopyOut2WorkSpace()
+    __aicore__ inline void CopyOut()
     {
         LocalTensor<T> yLocal = outQueueY.DeQue<T>();
 
         if constexpr (IS_8_BYTES_TYPE) {
-            DataCopyPadDoubleWord(workGlobal[outOffset], yLocal, rsvdCnt / INT64_LENGTH_IN_INT32);
+            DataCopyPadDoubleWord(yGlobal[outOffset], yLocal, rsvdCnt / INT64_LENGTH_IN_INT32);
             outOffset += rsvdCnt / INT64_LENGTH_IN_INT32;
         } else {
             DataCopyExtParams copyParams{1, static_cast<uint32_t>(rsvdCnt * sizeof(T)), 0, 0, 0};
-            DataCopyPad(workGlobal[outOffset], yLocal, copyParams);
+            DataCopyPad(yGlobal[outOffset], yLocal, copyParams);
             outOffset += rsvdCnt;
         }
 
@@ -358,7 +442,8 @@ private:
     TQue<QuePosition::VECIN, BUFFER_NUM> inQueueMask;
     TQue<QuePosition::VECOUT, BUFFER_NUM> outQueueY;
     TQue<QuePosition::VECOUT, BUFFER_NUM> outQueueDst;
-    TQueBind<QuePosition::VECIN, QuePosition::VECOUT, BUFFER_NUM> moveQue;
+    TBuf<TPosition::VECCALC> countsBuf;
+    TBuf<TPosition::VECCALC> countBuf;
     TBuf<TPosition::VECCALC> maskCastBuf;
     TBuf<TPosition::VECCALC> bitMaskBuf;
     TBuf<TPosition::VECCALC> xCastBuf;
@@ -368,7 +453,6 @@ private:
     GlobalTensor<T> yGlobal;
     GlobalTensor<uint64_t> shapeoutGlobal;
     GlobalTensor<uint8_t> maskGlobal;
-    GlobalTensor<T> workGlobal;
     GlobalTensor<uint64_t> offsetGlobal;
 
     // 输入
@@ -383,13 +467,16 @@ private:
     uint32_t tailtileNum;
     uint32_t tailtileLength;
     uint32_t taillasttileLength;
+    uint32_t maskPeriod;
 
     // 本block/核的
     uint32_t tileNum;
     uint32_t tileLength;
     uint32_t lasttileLength;
+    uint32_t blockLength;
 
     uint64_t rsvdCnt = 0;
+    uint64_t selectedNum = 0;
     uint64_t outOffset = 0;
     uint32_t blockIdx = 0;
 };
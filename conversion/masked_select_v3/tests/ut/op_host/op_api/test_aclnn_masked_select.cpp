@@ -221,6 +221,34 @@ TEST_F(
     EXPECT_EQ(aclRet, ACL_SUCCESS);
 }
 
+TEST_F(l2_masked_select_test, ascend910B2_aclnnMaskedSelect_4_8_1024_float_nd_and_1_1024_bool_nd_periodic_mask)
+{
+    // left input
+    const vector<int64_t>& selfShape = {4, 8, 1024};
+    aclDataType selfDtype = ACL_FLOAT;
+    aclFormat selfFormat = ACL_FORMAT_ND;
+    // right input
+    const vector<int64_t>& maskShape = {1, 1024};
+    vector<bool> boolMask = genRandomBoolVector(maskShape);
+    aclDataType maskDtype = ACL_BOOL;
+    aclFormat maskFormat = ACL_FORMAT_ND;
+    // output
+    int64_t shapeSize = getTrueNumInVector(boolMask) * 4 * 8;
+    const vector<int64_t>& outShape = {sizes(selfShape)};
+    aclDataType outDtype = ACL_FLOAT;
+    aclFormat outFormat = ACL_FORMAT_ND;
+
+    auto selfTensorDesc = TensorDesc(selfShape, selfDtype, selfFormat);
+    auto maskTensorDesc = TensorDesc(maskShape, maskDtype, maskFormat).Value(boolMask);
+    auto outTensorDesc = TensorDesc(outShape, outDtype, outFormat).ValidCount(shapeSize);
+
+    auto ut = OP_API_UT(aclnnMaskedSelect, INPUT(selfTensorDesc, maskTensorDesc), OUTPUT(outTensorDesc));
+    // SAMPLE: only test GetWorkspaceSize
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACL_SUCCESS);
+}
+
 /* 各元素基本类型覆盖用例
  * 维度：1-8维
  * self基本数据类型：FLOAT、FLOAT16、INT32、INT64、INT16、INT8、UINT8、DOUBLE、COMPLEX64、COMPLEX128，BFLOAT16,BOOL
@@ -44,8 +44,8 @@ TEST_F(l2_masked_select_test, aclnnMaskedSelect_base_case_1) {
                                               {{{{8,}, {8,}}, ge::DT_FLOAT, ge::FORMAT_ND},},
                                               &compileInfo);
     uint64_t expectTilingKey = 4;
-    string expectTilingData = "1 8 1 8448 8 0 0 0 0 0 ";
-    std::vector<size_t> expectWorkspaces = {16777536};
+    string expectTilingData = "1 8 1 8448 8 0 0 0 0 0 0 ";
+    std::vector<size_t> expectWorkspaces = {16777280};
     ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
 }
 
@@ -58,8 +58,8 @@ TEST_F(l2_masked_select_test, aclnnMaskedSelect_8_int32_nd_and_8_bool_nd_simple_
                                               {{{{8,}, {8,}}, ge::DT_INT32, ge::FORMAT_ND},},
                                               &compileInfo);
     uint64_t expectTilingKey = 4;
-    string expectTilingData = "1 8 1 8448 8 0 0 0 0 0 ";
-    std::vector<size_t> expectWorkspaces = {16777536};
+    string expectTilingData = "1 8 1 8448 8 0 0 0 0 0 0 ";
+    std::vector<size_t> expectWorkspaces = {16777280};
     ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
 }
 
@@ -72,7 +72,63 @@ TEST_F(l2_masked_select_test, aclnnMaskedSelect_2_4_6_8_10_12_14_16_int64_nd_and
                                               {{{{2, 4, 6, 8, 10, 12, 14, 16}, {2, 4, 6, 8, 10, 12, 14, 16}}, ge::DT_INT64, ge::FORMAT_ND},},
                                               &compileInfo);
     uint64_t expectTilingKey = 8;
-    string expectTilingData = "48 215040 50 4352 1792 0 0 0 0 0 ";
-    std::vector<size_t> expectWorkspaces = {99355648};
+    string expectTilingData = "48 215040 50 4352 1792 0 0 0 0 0 0 ";
+    std::vector<size_t> expectWorkspaces = {16780288};
     ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
-}
\ No newline at end of file
+}
+
+TEST_F(l2_masked_select_test, aclnnMaskedSelect_64_1024_int32_nd_and_1024_bool_nd_broadcast_mask) {
+    optiling::MaskedSelectV3CompileInfo compileInfo = {48, 196608, 16777216, false};
+
+    gert::TilingContextPara tilingContextPara("MaskedSelectV3",
+                                              {{{{64, 1024}, {64, 1024}}, ge::DT_INT32, ge::FORMAT_ND},
+                                               {{{1024,}, {1024,}}, ge::DT_BOOL, ge::FORMAT_ND}},
+                                              {{{{65536,}, {65536,}}, ge::DT_INT32, ge::FORMAT_ND},},
+                                              &compileInfo);
+    uint64_t expectTilingKey = 4;
+    string expectTilingData = "8 8192 1 8192 8192 0 0 0 0 0 1024 ";
+    std::vector<size_t> expectWorkspaces = {16777728};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(l2_masked_select_test, aclnnMaskedSelect_4_100_int32_nd_and_100_bool_nd_unaligned_mask_failed) {
+    optiling::MaskedSelectV3CompileInfo compileInfo = {48, 196608, 16777216, false};
+
+    gert::TilingContextPara tilingContextPara("MaskedSelectV3",
+                                              {{{{4, 100}, {4, 100}}, ge::DT_INT32, ge::FORMAT_ND},
+                                               {{{100,}, {100,}}, ge::DT_BOOL, ge::FORMAT_ND}},
+                                              {{{{400,}, {400,}}, ge::DT_INT32, ge::FORMAT_ND},},
+                                              &compileInfo);
+    uint64_t expectTilingKey = 4;
+    string expectTilingData = "";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(l2_masked_select_test, aclnnMaskedSelect_4_8_1024_int32_nd_and_4_1_1024_bool_nd_middle_broadcast_failed) {
+    optiling::MaskedSelectV3CompileInfo compileInfo = {48, 196608, 16777216, false};
+
+    // mask长度4096按256对齐且整除x的元素个数，但在中间维广播，不是周期出现的
+    gert::TilingContextPara tilingContextPara("MaskedSelectV3",
+                                              {{{{4, 8, 1024}, {4, 8, 1024}}, ge::DT_INT32, ge::FORMAT_ND},
+                                               {{{4, 1, 1024}, {4, 1, 1024}}, ge::DT_BOOL, ge::FORMAT_ND}},
+                                              {{{{32768,}, {32768,}}, ge::DT_INT32, ge::FORMAT_ND},},
+                                              &compileInfo);
+    uint64_t expectTilingKey = 4;
+    string expectTilingData = "";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(l2_masked_select_test, aclnnMaskedSelect_4_8_1024_int32_nd_and_1_1_1024_bool_nd_leading_broadcast) {
+    optiling::MaskedSelectV3CompileInfo compileInfo = {48, 196608, 16777216, false};
+
+    gert::TilingContextPara tilingContextPara("MaskedSelectV3",
+                                              {{{{4, 8, 1024}, {4, 8, 1024}}, ge::DT_INT32, ge::FORMAT_ND},
+                                               {{{1, 1, 1024}, {1, 1, 1024}}, ge::DT_BOOL, ge::FORMAT_ND}},
+                                              {{{{32768,}, {32768,}}, ge::DT_INT32, ge::FORMAT_ND},},
+                                              &compileInfo);
+    TilingInfo tilingInfo;
+    EXPECT_TRUE(ExecuteTiling(tilingContextPara, tilingInfo));
+    EXPECT_EQ(tilingInfo.tilingKey, 4);
+}
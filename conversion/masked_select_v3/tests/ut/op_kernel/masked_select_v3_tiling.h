@@ -28,6 +28,7 @@ struct MaskedSelectV3TilingData {
     uint64_t tailtileNum = 0;
     uint64_t tailtileLength = 0;
     uint64_t taillasttileLength = 0;
+    uint64_t maskPeriod = 0;
 };
 
 #pragma pack()
@@ -51,6 +52,7 @@ struct MaskedSelectV3TilingData {
     (tilingData).tailLength = tilingDataPointer->tailLength;                      \
     (tilingData).tailtileNum = tilingDataPointer->tailtileNum;                    \
     (tilingData).tailtileLength = tilingDataPointer->tailtileLength;              \
-    (tilingData).taillasttileLength = tilingDataPointer->taillasttileLength;
+    (tilingData).taillasttileLength = tilingDataPointer->taillasttileLength;      \
+    (tilingData).maskPeriod = tilingDataPointer->maskPeriod;
 
 #endif // MASKED_SELECT_V3_TILING_H_
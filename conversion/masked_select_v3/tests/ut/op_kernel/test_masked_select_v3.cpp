@@ -77,3 +77,87 @@ TEST_F(MaskedSelectV3Test, masked_select_v3_0_int64)
     AscendC::GmFree(workspace);
     AscendC::GmFree(tiling);
 }
+
+// 运行一次kernel并与逐元素选择的参考结果比较，x按int32填充下标，mask按maskShape周期广播到x
+static void RunMaskedSelectGolden(const vector<int64_t>& xShape, const vector<int64_t>& maskShape)
+{
+    optiling::MaskedSelectV3CompileInfo compileInfo = {48, 196608, 16777216, false};
+    int64_t xNum = 1;
+    for (auto dim : xShape) {
+        xNum *= dim;
+    }
+    int64_t maskNum = 1;
+    for (auto dim : maskShape) {
+        maskNum *= dim;
+    }
+    gert::StorageShape xStorage;
+    gert::StorageShape maskStorage;
+    for (auto dim : xShape) {
+        xStorage.MutableOriginShape().AppendDim(dim);
+        xStorage.MutableStorageShape().AppendDim(dim);
+    }
+    for (auto dim : maskShape) {
+        maskStorage.MutableOriginShape().AppendDim(dim);
+        maskStorage.MutableStorageShape().AppendDim(dim);
+    }
+    gert::TilingContextPara tilingContextPara("MaskedSelectV3",
+                                              {{xStorage, ge::DT_INT32, ge::FORMAT_ND},
+                                               {maskStorage, ge::DT_BOOL, ge::FORMAT_ND}},
+                                              {{{{xNum}, {xNum}}, ge::DT_INT32, ge::FORMAT_ND},},
+                                              &compileInfo);
+    TilingInfo tilingInfo;
+    ASSERT_TRUE(ExecuteTiling(tilingContextPara, tilingInfo));
+
+    uint8_t* x = (uint8_t*)AscendC::GmAlloc(xNum * sizeof(int32_t));
+    uint8_t* mask = (uint8_t*)AscendC::GmAlloc(maskNum * sizeof(bool));
+    uint8_t* y = (uint8_t*)AscendC::GmAlloc(xNum * sizeof(int32_t));
+    uint8_t* shapeOut = (uint8_t*)AscendC::GmAlloc(sizeof(uint64_t) * 2);
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(tilingInfo.workspaceSizes[0]);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(tilingInfo.tilingDataSize);
+    std::memcpy(tiling, tilingInfo.tilingData.get(), tilingInfo.tilingDataSize);
+
+    int32_t* xData = reinterpret_cast<int32_t*>(x);
+    bool* maskData = reinterpret_cast<bool*>(mask);
+    for (int64_t i = 0; i < xNum; i++) {
+        xData[i] = static_cast<int32_t>(i);
+    }
+    for (int64_t i = 0; i < maskNum; i++) {
+        maskData[i] = (i % 3 == 0) || (i % 7 == 1);
+    }
+    vector<int32_t> golden;
+    for (int64_t i = 0; i < xNum; i++) {
+        if (maskData[i % maskNum]) {
+            golden.push_back(xData[i]);
+        }
+    }
+
+    ICPU_SET_TILING_KEY(tilingInfo.tilingKey);
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_RUN_KF(masked_select_v3, tilingInfo.blockNum, x, mask, y, shapeOut, workspace, tiling);
+
+    uint64_t* shapeOutData = reinterpret_cast<uint64_t*>(shapeOut);
+    EXPECT_EQ(shapeOutData[1], golden.size());
+    int32_t* yData = reinterpret_cast<int32_t*>(y);
+    for (size_t i = 0; i < golden.size(); i++) {
+        ASSERT_EQ(yData[i], golden[i]) << "index " << i;
+    }
+
+    AscendC::GmFree(x);
+    AscendC::GmFree(mask);
+    AscendC::GmFree(y);
+    AscendC::GmFree(shapeOut);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+}
+
+// 逐元素mask，多核先计数再按前缀偏移直接写y
+TEST_F(MaskedSelectV3Test, masked_select_v3_count_first_int32_golden)
+{
+    RunMaskedSelectGolden({64, 1024}, {64, 1024});
+}
+
+// mask只在前导维广播，按周期复用mask
+TEST_F(MaskedSelectV3Test, masked_select_v3_mask_period_int32_golden)
+{
+    RunMaskedSelectGolden({64, 1024}, {1, 1024});
+}
@@ -0,0 +1,314 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file pad_grad_fold_tiling.cpp
+ * \brief
+ */
+#include <algorithm>
+#include <map>
+#include <string>
+#include "pad_grad_fold_tiling.h"
+#include "log/log.h"
+#include "register/op_def_registry.h"
+#include "tiling_base/tiling_templates_registry.h"
+#include "platform/platform_info.h"
+
+namespace optiling {
+constexpr int32_t X_INPUT_INDEX = 0;
+constexpr int32_t PADDING_INPUT_INDEX = 1;
+constexpr int32_t Y_OUTPUT_INDEX = 0;
+constexpr size_t MODE_ATTR_INDEX = 0;
+constexpr size_t PADDINGS_CONTIGUOUS_ATTR_INDEX = 1;
+constexpr size_t MAX_DIM_NUM = 8;
+constexpr uint32_t DIM_D = 0;
+constexpr uint32_t DIM_H = 1;
+constexpr uint32_t DIM_W = 2;
+constexpr uint32_t PAIR = 2;
+constexpr uint32_t BYTE_BLOCK = 32;
+constexpr uint32_t FLOAT_BYTES = 4;
+constexpr uint32_t BUFFER_NUM = 2;
+constexpr uint32_t RESERVED_UB = 1024;
+constexpr uint32_t MAX_BORDER_FACTOR = 1024;
+constexpr uint32_t MIN_W_FACTOR = 256;
+
+constexpr uint32_t CONSTANT_MODE = 0;
+constexpr uint32_t REFLECT_MODE = 1;
+constexpr uint32_t EDGE_MODE = 2;
+constexpr uint32_t CIRCULAR_MODE = 3;
+
+constexpr uint64_t FLOAT_TILING_KEY = 1;
+constexpr uint64_t FLOAT16_TILING_KEY = 2;
+constexpr uint64_t BFLOAT16_TILING_KEY = 3;
+
+static const std::map<std::string, uint32_t> PAD_MODE_MAP = {
+    {"constant", CONSTANT_MODE}, {"reflect", REFLECT_MODE}, {"edge", EDGE_MODE}, {"circular", CIRCULAR_MODE}};
+
+struct PadGradFoldParams {
+    ge::DataType dtype;
+    uint32_t mode;
+    uint64_t outerNum;
+    int64_t inShape[PAD_GRAD_FOLD_DIM_NUM];
+    int64_t outShape[PAD_GRAD_FOLD_DIM_NUM];
+    int64_t padBefore[PAD_GRAD_FOLD_DIM_NUM];
+    int64_t padAfter[PAD_GRAD_FOLD_DIM_NUM];
+};
+
+static inline uint64_t CeilDiv(uint64_t a, uint64_t b)
+{
+    return b == 0 ? a : (a + b - 1) / b;
+}
+
+static inline uint64_t CeilAlign(uint64_t a, uint64_t b)
+{
+    return CeilDiv(a, b) * b;
+}
+
+template <typename T>
+static ge::graphStatus GetPaddings(
+    const gert::TilingContext* context, const gert::Tensor* paddingTensor, size_t dimNum, bool paddingsContiguous,
+    int64_t (&before)[MAX_DIM_NUM], int64_t (&after)[MAX_DIM_NUM])
+{
+    const T* paddingValue = paddingTensor->GetData<T>();
+    OP_CHECK_NULL_WITH_CONTEXT(context, paddingValue);
+    OP_CHECK_IF(
+        static_cast<size_t>(paddingTensor->GetShapeSize()) != dimNum * PAIR,
+        OP_LOGE(context->GetNodeName(), "paddings size should be %zu.", dimNum * PAIR), return ge::GRAPH_FAILED);
+    for (size_t i = 0; i < dimNum; i++) {
+        // paddings_contiguous为true时按[begin0, end0, begin1, end1, ...]排布，否则按[begin0, begin1, ..., end0, end1, ...]
+        before[i] = static_cast<int64_t>(paddingsContiguous ? paddingValue[i * PAIR] : paddingValue[i]);
+        after[i] = static_cast<int64_t>(paddingsContiguous ? paddingValue[i * PAIR + 1] : paddingValue[dimNum + i]);
+    }
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus GetInputInfo(gert::TilingContext* context, PadGradFoldParams& params)
+{
+    auto xShape = context->GetInputShape(X_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, xShape);
+    auto yShape = context->GetOutputShape(Y_OUTPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, yShape);
+    const gert::Shape& inShape = xShape->GetStorageShape();
+    const gert::Shape& outShape = yShape->GetStorageShape();
+    size_t dimNum = inShape.GetDimNum();
+    OP_CHECK_IF(
+        dimNum == 0 || dimNum > MAX_DIM_NUM || outShape.GetDimNum() != dimNum,
+        OP_LOGE(context->GetNodeName(), "x should be 1~%zu dims and y should have the same rank.", MAX_DIM_NUM),
+        return ge::GRAPH_FAILED);
+
+    const gert::RuntimeAttrs* attrs = context->GetAttrs();
+    OP_CHECK_NULL_WITH_CONTEXT(context, attrs);
+    const char* modePtr = attrs->GetAttrPointer<char>(MODE_ATTR_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, modePtr);
+    auto modeIter = PAD_MODE_MAP.find(std::string(modePtr));
+    OP_CHECK_IF(
+        modeIter == PAD_MODE_MAP.end(), OP_LOGE(context->GetNodeName(), "%s is not supported.", modePtr),
+        return ge::GRAPH_FAILED);
+    params.mode = modeIter->second;
+    const bool* contiguousPtr = attrs->GetAttrPointer<bool>(PADDINGS_CONTIGUOUS_ATTR_INDEX);
+    bool paddingsContiguous = contiguousPtr == nullptr ? true : *contiguousPtr;
+
+    const gert::Tensor* paddingTensor = context->GetInputTensor(PADDING_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, paddingTensor);
+    int64_t before[MAX_DIM_NUM] = {0};
+    int64_t after[MAX_DIM_NUM] = {0};
+    ge::graphStatus ret = ge::GRAPH_FAILED;
+    if (paddingTensor->GetDataType() == ge::DT_INT32) {
+        ret = GetPaddings<int32_t>(context, paddingTensor, dimNum, paddingsContiguous, before, after);
+    } else if (paddingTensor->GetDataType() == ge::DT_INT64) {
+        ret = GetPaddings<int64_t>(context, paddingTensor, dimNum, paddingsContiguous, before, after);
+    } else {
+        OP_LOGE(context->GetNodeName(), "Only support padding value in INT64 or INT32.");
+    }
+    if (ret != ge::GRAPH_SUCCESS) {
+        return ret;
+    }
+
+    // 最后三维按D/H/W折叠，不足三维时在前面补1；更高维不允许带pad，合并为outer
+    size_t foldStart = dimNum > PAD_GRAD_FOLD_DIM_NUM ? dimNum - PAD_GRAD_FOLD_DIM_NUM : 0;
+    params.outerNum = 1;
+    for (size_t i = 0; i < dimNum; i++) {
+        OP_CHECK_IF(
+            before[i] < 0 || after[i] < 0,
+            OP_LOGE(context->GetNodeName(), "paddings of dim %zu should not be negative.", i), return ge::GRAPH_FAILED);
+        OP_CHECK_IF(
+            outShape.GetDim(i) <= 0 || inShape.GetDim(i) != outShape.GetDim(i) + before[i] + after[i],
+            OP_LOGE(context->GetNodeName(), "Please check input or output shape of dim %zu.", i),
+            return ge::GRAPH_FAILED);
+        if (i < foldStart) {
+            OP_CHECK_IF(
+                before[i] != 0 || after[i] != 0,
+                OP_LOGE(context->GetNodeName(), "Only the last %u dims can be padded.", PAD_GRAD_FOLD_DIM_NUM),
+                return ge::GRAPH_FAILED);
+            params.outerNum *= static_cast<uint64_t>(outShape.GetDim(i));
+        }
+    }
+    size_t padDimNum = dimNum - foldStart;
+    for (size_t k = 0; k < PAD_GRAD_FOLD_DIM_NUM; k++) {
+        size_t fill = PAD_GRAD_FOLD_DIM_NUM - padDimNum;
+        if (k < fill) {
+            params.inShape[k] = 1;
+            params.outShape[k] = 1;
+            params.padBefore[k] = 0;
+            params.padAfter[k] = 0;
+            continue;
+        }
+        size_t i = foldStart + k - fill;
+        params.inShape[k] = inShape.GetDim(i);
+        params.outShape[k] = outShape.GetDim(i);
+        params.padBefore[k] = before[i];
+        params.padAfter[k] = after[i];
+        // reflect要求pad小于原长度，circular要求pad不超过原长度，保证一次折叠即落回输入范围
+        int64_t maxPad = std::max(before[i], after[i]);
+        OP_CHECK_IF(
+            (params.mode == REFLECT_MODE && maxPad >= params.outShape[k]) ||
+                (params.mode == CIRCULAR_MODE && maxPad > params.outShape[k]),
+            OP_LOGE(context->GetNodeName(), "paddings of dim %zu is too large for mode %s.", i, modePtr),
+            return ge::GRAPH_FAILED);
+    }
+    return ge::GRAPH_SUCCESS;
+}
+
+static void CalcTilingData(
+    const PadGradFoldParams& params, uint32_t coreNum, uint32_t ubSize, PadGradFoldTilingData& tilingData)
+{
+    uint32_t typeSize = ge::GetSizeByDataType(params.dtype);
+    uint32_t alignNum = BYTE_BLOCK / typeSize;
+    // fp16/bf16在UB内转成fp32累加
+    uint32_t castBytes = params.dtype == ge::DT_FLOAT ? 0 : FLOAT_BYTES;
+
+    uint64_t borderFactor = 0;
+    if (params.mode != CONSTANT_MODE) {
+        uint64_t maxBorder = static_cast<uint64_t>(std::max(params.padBefore[DIM_W], params.padAfter[DIM_W]));
+        borderFactor = std::min<uint64_t>(CeilAlign(maxBorder, alignNum), MAX_BORDER_FACTOR);
+    }
+    // 边界段多预留一个block用于补零对齐：搬入buffer、cast buffer、反转/累加buffer与Gather偏移buffer，外加求和结果
+    uint64_t borderBytes =
+        borderFactor == 0 ? 0 : (borderFactor + alignNum) * (typeSize + castBytes + FLOAT_BYTES * PAIR) + BYTE_BLOCK;
+    // 输入、输出各double buffer，加上fp32累加buffer和cast buffer
+    uint64_t bytesPerElem = BUFFER_NUM * typeSize * PAIR + FLOAT_BYTES + castBytes;
+    uint64_t wFactor = (ubSize - RESERVED_UB - borderBytes) / bytesPerElem / alignNum * alignNum;
+    uint64_t outW = static_cast<uint64_t>(params.outShape[DIM_W]);
+    wFactor = std::min<uint64_t>(wFactor, CeilAlign(outW, alignNum));
+
+    uint64_t rowNum = params.outerNum * params.outShape[DIM_D] * params.outShape[DIM_H];
+    if (rowNum < coreNum) {
+        // 行数不足核数时沿W方向再切，让每个核都分到数据
+        uint64_t splitNum = CeilDiv(coreNum, rowNum);
+        uint64_t splitFactor = std::max<uint64_t>(MIN_W_FACTOR, CeilAlign(CeilDiv(outW, splitNum), alignNum));
+        wFactor = std::min(wFactor, splitFactor);
+    }
+    uint64_t chunksPerRow = CeilDiv(outW, wFactor);
+    uint64_t unitNum = rowNum * chunksPerRow;
+    uint64_t usedCoreNum = std::min<uint64_t>(coreNum, unitNum);
+
+    tilingData.set_outerNum(params.outerNum);
+    tilingData.set_chunksPerRow(chunksPerRow);
+    tilingData.set_unitsPerCore(unitNum / usedCoreNum);
+    tilingData.set_tailUnits(unitNum % usedCoreNum);
+    tilingData.set_inShape(params.inShape);
+    tilingData.set_outShape(params.outShape);
+    tilingData.set_padBefore(params.padBefore);
+    tilingData.set_padAfter(params.padAfter);
+    tilingData.set_mode(params.mode);
+    tilingData.set_usedCoreNum(static_cast<uint32_t>(usedCoreNum));
+    tilingData.set_wFactor(static_cast<uint32_t>(wFactor));
+    tilingData.set_borderFactor(static_cast<uint32_t>(borderFactor));
+}
+
+static void PrintTilingData(gert::TilingContext* context, PadGradFoldTilingData& tilingData)
+{
+    const ge::char_t* nodeName = context->GetNodeName();
+    OP_LOGD(nodeName, "outerNum: %lu", tilingData.get_outerNum());
+    OP_LOGD(nodeName, "chunksPerRow: %lu", tilingData.get_chunksPerRow());
+    OP_LOGD(nodeName, "unitsPerCore: %lu", tilingData.get_unitsPerCore());
+    OP_LOGD(nodeName, "tailUnits: %lu", tilingData.get_tailUnits());
+    for (uint32_t i = 0; i < PAD_GRAD_FOLD_DIM_NUM; i++) {
+        OP_LOGD(
+            nodeName, "dim %u: inShape %ld, outShape %ld, padBefore %ld, padAfter %ld", i,
+            tilingData.get_inShape()[i], tilingData.get_outShape()[i], tilingData.get_padBefore()[i],
+            tilingData.get_padAfter()[i]);
+    }
+    OP_LOGD(nodeName, "mode: %u", tilingData.get_mode());
+    OP_LOGD(nodeName, "usedCoreNum: %u", tilingData.get_usedCoreNum());
+    OP_LOGD(nodeName, "wFactor: %u", tilingData.get_wFactor());
+    OP_LOGD(nodeName, "borderFactor: %u", tilingData.get_borderFactor());
+}
+
+static ge::graphStatus Tiling4PadGradFold(gert::TilingContext* context)
+{
+    OP_LOGI(context->GetNodeName(), "PadGradFold tiling starts running");
+    auto compileInfo = reinterpret_cast<const PadGradFoldCompileInfo*>(context->GetCompileInfo());
+    OP_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    OP_CHECK_IF(
+        compileInfo->vectorCoreNum <= 0 || compileInfo->ubByteSize <= RESERVED_UB,
+        OP_LOGE(context->GetNodeName(), "Failed to get core num or ub size."), return ge::GRAPH_FAILED);
+
+    auto xDesc = context->GetInputDesc(X_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, xDesc);
+    PadGradFoldParams params;
+    params.dtype = xDesc->GetDataType();
+    uint64_t tilingKey = FLOAT_TILING_KEY;
+    if (params.dtype == ge::DT_FLOAT16) {
+        tilingKey = FLOAT16_TILING_KEY;
+    } else if (params.dtype == ge::DT_BF16) {
+        tilingKey = BFLOAT16_TILING_KEY;
+    } else if (params.dtype != ge::DT_FLOAT) {
+        OP_LOGE(context->GetNodeName(), "the current x dtype is not in dtype support list [bfloat16, float16, float].");
+        return ge::GRAPH_FAILED;
+    }
+    ge::graphStatus ret = GetInputInfo(context, params);
+    if (ret != ge::GRAPH_SUCCESS) {
+        return ret;
+    }
+
+    PadGradFoldTilingData tilingData;
+    CalcTilingData(params, compileInfo->vectorCoreNum, compileInfo->ubByteSize, tilingData);
+    OP_CHECK_IF(
+        tilingData.get_wFactor() == 0, OP_LOGE(context->GetNodeName(), "ub space is not enough, please check input."),
+        return ge::GRAPH_FAILED);
+
+    context->SetTilingKey(tilingKey);
+    context->SetBlockDim(tilingData.get_usedCoreNum());
+    size_t* workspaces = context->GetWorkspaceSizes(1);
+    workspaces[0] = compileInfo->sysWorkspaceByteSize;
+    tilingData.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tilingData.GetDataSize());
+    PrintTilingData(context, tilingData);
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus TilingPrepare4PadGradFold(gert::TilingParseContext* context)
+{
+    auto compileInfo = context->GetCompiledInfo<PadGradFoldCompileInfo>();
+    OP_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    auto platformInfo = context->GetPlatformInfo();
+    OP_CHECK_NULL_WITH_CONTEXT(context, platformInfo);
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(platformInfo);
+    compileInfo->vectorCoreNum = ascendcPlatform.GetCoreNumAiv();
+    OP_CHECK_IF(
+        (compileInfo->vectorCoreNum <= 0), OP_LOGE(context->GetNodeName(), "No vector core available."),
+        return ge::GRAPH_FAILED);
+    uint64_t ubByteSize;
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ubByteSize);
+    compileInfo->ubByteSize = ubByteSize;
+    OP_CHECK_IF(
+        (compileInfo->ubByteSize <= 0), OP_LOGE(context->GetNodeName(), "Failed to get ub size."),
+        return ge::GRAPH_FAILED);
+    compileInfo->sysWorkspaceByteSize = ascendcPlatform.GetLibApiWorkSpaceSize();
+    return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_OPTILING(PadGradFold)
+    .Tiling(Tiling4PadGradFold)
+    .TilingParse<PadGradFoldCompileInfo>(TilingPrepare4PadGradFold)
+    .TilingInputsDataDependency({PADDING_INPUT_INDEX});
+} // namespace optiling
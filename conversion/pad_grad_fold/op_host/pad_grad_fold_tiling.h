@@ -0,0 +1,46 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file pad_grad_fold_tiling.h
+ * \brief
+ */
+#ifndef OPS_BUILT_IN_OP_TILING_RUNTIME_PAD_GRAD_FOLD_H_
+#define OPS_BUILT_IN_OP_TILING_RUNTIME_PAD_GRAD_FOLD_H_
+
+#include "register/tilingdata_base.h"
+
+namespace optiling {
+constexpr uint32_t PAD_GRAD_FOLD_DIM_NUM = 3; // 最多折叠最后三维(D/H/W)，更高维合并为outer
+
+BEGIN_TILING_DATA_DEF(PadGradFoldTilingData)
+TILING_DATA_FIELD_DEF(uint64_t, outerNum);    // 不带pad的前置维度之积
+TILING_DATA_FIELD_DEF(uint64_t, chunksPerRow); // 每个输出行在W方向上切分的块数
+TILING_DATA_FIELD_DEF(uint64_t, unitsPerCore); // 每核处理的(行, W块)单元数
+TILING_DATA_FIELD_DEF(uint64_t, tailUnits);    // 前tailUnits个核多处理一个单元
+TILING_DATA_FIELD_DEF_ARR(int64_t, PAD_GRAD_FOLD_DIM_NUM, inShape);
+TILING_DATA_FIELD_DEF_ARR(int64_t, PAD_GRAD_FOLD_DIM_NUM, outShape);
+TILING_DATA_FIELD_DEF_ARR(int64_t, PAD_GRAD_FOLD_DIM_NUM, padBefore);
+TILING_DATA_FIELD_DEF_ARR(int64_t, PAD_GRAD_FOLD_DIM_NUM, padAfter);
+TILING_DATA_FIELD_DEF(uint32_t, mode);
+TILING_DATA_FIELD_DEF(uint32_t, usedCoreNum);
+TILING_DATA_FIELD_DEF(uint32_t, wFactor);      // 每次处理的输出W元素数
+TILING_DATA_FIELD_DEF(uint32_t, borderFactor); // 每次搬入的W方向边界元素数
+END_TILING_DATA_DEF;
+REGISTER_TILING_DATA_CLASS(PadGradFold, PadGradFoldTilingData)
+
+struct PadGradFoldCompileInfo {
+    uint32_t vectorCoreNum;
+    uint32_t sysWorkspaceByteSize;
+    uint32_t ubByteSize;
+};
+} // namespace optiling
+#endif // OPS_BUILT_IN_OP_TILING_RUNTIME_PAD_GRAD_FOLD_H_
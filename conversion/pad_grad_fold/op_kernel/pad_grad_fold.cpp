@@ -0,0 +1,39 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file pad_grad_fold.cpp
+ * \brief
+ */
+
+#include "kernel_operator.h"
+#include "pad_grad_fold.h"
+
+using namespace PadGradFold;
+
+extern "C" __global__ __aicore__ void pad_grad_fold(
+    GM_ADDR x, GM_ADDR paddings, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling)
+{
+    GET_TILING_DATA(tilingData, tiling);
+    if (TILING_KEY_IS(1)) {
+        PadGradFoldND<float> op;
+        op.Init(x, y, &tilingData);
+        op.Process();
+    } else if (TILING_KEY_IS(2)) {
+        PadGradFoldND<half> op;
+        op.Init(x, y, &tilingData);
+        op.Process();
+    } else if (TILING_KEY_IS(3)) {
+        PadGradFoldND<bfloat16_t> op;
+        op.Init(x, y, &tilingData);
+        op.Process();
+    }
+}
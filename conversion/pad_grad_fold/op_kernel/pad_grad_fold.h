@@ -0,0 +1,396 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file pad_grad_fold.h
+ * \brief 通用pad反向：每种模式表示为填充坐标到输入坐标的折叠映射
+ *
+ * 输出(即正向输入)按行(outer, d, h)与W方向分块组成处理单元，均匀分给各核。
+ * 对每个单元，枚举D/H方向上折叠到该行的梯度行，W方向中间段整段向量累加。
+ * W方向两侧边界段同样以向量方式折叠：circular为连续段平移后相加，reflect为连续段反转(Gather)后相加，
+ * edge为整段ReduceSum后累加到端点。fp16/bf16在UB内以fp32累加后再转回。
+ */
+#ifndef PAD_GRAD_FOLD_H
+#define PAD_GRAD_FOLD_H
+
+#include "kernel_operator.h"
+
+namespace PadGradFold {
+using namespace AscendC;
+
+constexpr int32_t BUFFER_NUM = 2;
+constexpr int32_t DIM_D = 0;
+constexpr int32_t DIM_H = 1;
+constexpr int32_t DIM_W = 2;
+constexpr uint32_t BYTE_BLOCK = 32;
+
+constexpr uint32_t CONSTANT_MODE = 0;
+constexpr uint32_t REFLECT_MODE = 1;
+constexpr uint32_t EDGE_MODE = 2;
+constexpr uint32_t CIRCULAR_MODE = 3;
+
+// 梯度坐标p折叠回输入坐标；constant模式的填充区域不回传梯度，返回-1
+__aicore__ inline int64_t FoldIndex(int64_t p, int64_t len, int64_t padBefore, uint32_t mode)
+{
+    int64_t src = p - padBefore;
+    if (src >= 0 && src < len) {
+        return src;
+    }
+    if (mode == REFLECT_MODE) {
+        return src < 0 ? -src : 2 * (len - 1) - src;
+    }
+    if (mode == EDGE_MODE) {
+        return src < 0 ? 0 : len - 1;
+    }
+    if (mode == CIRCULAR_MODE) {
+        return src < 0 ? src + len : src - len;
+    }
+    return -1;
+}
+
+template <typename T>
+class PadGradFoldND {
+public:
+    __aicore__ inline PadGradFoldND(){};
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR y, const PadGradFoldTilingData* __restrict tilingData);
+    __aicore__ inline void Process();
+
+private:
+    __aicore__ inline void ProcessUnit(uint64_t unit);
+    __aicore__ inline int64_t SourceOf(int32_t dim, int64_t target, int64_t k);
+    __aicore__ inline void AccumulateRow(int64_t rowOffset, int64_t colStart, uint32_t count, bool first);
+    __aicore__ inline void AccumulateBorder(int64_t rowOffset, int64_t segStart, int64_t segLen, int64_t colStart,
+                                            uint32_t count);
+    __aicore__ inline void AccumulateShifted(int64_t rowOffset, int64_t segStart, int64_t segLen, int64_t colStart,
+                                             uint32_t count);
+    __aicore__ inline void AccumulateReversed(int64_t rowOffset, int64_t segStart, int64_t segLen, int64_t colStart,
+                                              uint32_t count);
+    __aicore__ inline void AccumulateEdge(int64_t rowOffset, int64_t segStart, int64_t segLen, int64_t target);
+    __aicore__ inline LocalTensor<float> LoadBorder(LocalTensor<T>& borderLocal, int64_t gmOffset, uint32_t num,
+                                                    uint32_t leftPad, uint32_t rightPad);
+    __aicore__ inline void CopyOut(int64_t offset, uint32_t count);
+
+    template <typename T1>
+    __aicore__ inline T1 CeilAlign(T1 a, T1 b)
+    {
+        return b == 0 ? a : (a + b - 1) / b * b;
+    }
+
+    template <HardEvent EVENT>
+    __aicore__ inline void SyncFlag()
+    {
+        event_t eventId = static_cast<event_t>(GetTPipePtr()->FetchEventID(EVENT));
+        SetFlag<EVENT>(eventId);
+        WaitFlag<EVENT>(eventId);
+    }
+
+private:
+    static constexpr bool IS_FLOAT = IsSameType<T, float>::value;
+
+    TPipe pipe;
+    TQue<QuePosition::VECIN, BUFFER_NUM> inQueue;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> outQueue;
+    TBuf<QuePosition::VECCALC> accBuf;
+    TBuf<QuePosition::VECCALC> castBuf;
+    TQue<QuePosition::VECIN, 1> borderQueue;
+    TBuf<QuePosition::VECCALC> borderCastBuf;
+    TBuf<QuePosition::VECCALC> borderTmpBuf;
+    TBuf<QuePosition::VECCALC> borderIdxBuf;
+    TBuf<QuePosition::VECCALC> borderSumBuf;
+    GlobalTensor<T> xGm;
+    GlobalTensor<T> yGm;
+
+    uint64_t unitStart = 0;
+    uint64_t unitNum = 0;
+    uint64_t chunksPerRow = 0;
+    int64_t inShape[3] = {0};
+    int64_t outShape[3] = {0};
+    int64_t padBefore[3] = {0};
+    int64_t padAfter[3] = {0};
+    int64_t candidateNum[3] = {0};
+    uint32_t mode = 0;
+    uint32_t wFactor = 0;
+    uint32_t borderFactor = 0;
+    uint32_t alignNum = 0;
+};
+
+template <typename T>
+__aicore__ inline void PadGradFoldND<T>::Init(
+    GM_ADDR x, GM_ADDR y, const PadGradFoldTilingData* __restrict tilingData)
+{
+    uint64_t blockIdx = GetBlockIdx();
+    uint64_t unitsPerCore = tilingData->unitsPerCore;
+    uint64_t tailUnits = tilingData->tailUnits;
+    unitNum = unitsPerCore + (blockIdx < tailUnits ? 1 : 0);
+    unitStart = blockIdx * unitsPerCore + (blockIdx < tailUnits ? blockIdx : tailUnits);
+    chunksPerRow = tilingData->chunksPerRow;
+    mode = tilingData->mode;
+    wFactor = tilingData->wFactor;
+    borderFactor = tilingData->borderFactor;
+    alignNum = BYTE_BLOCK / sizeof(T);
+    for (int32_t i = 0; i < DIM_W + 1; i++) {
+        inShape[i] = tilingData->inShape[i];
+        outShape[i] = tilingData->outShape[i];
+        padBefore[i] = tilingData->padBefore[i];
+        padAfter[i] = tilingData->padAfter[i];
+        // 候选梯度坐标：中间段对应的1个，加上两侧所有边界位置
+        candidateNum[i] = mode == CONSTANT_MODE ? 1 : 1 + padBefore[i] + padAfter[i];
+    }
+
+    xGm.SetGlobalBuffer((__gm__ T*)x);
+    yGm.SetGlobalBuffer((__gm__ T*)y);
+    pipe.InitBuffer(inQueue, BUFFER_NUM, wFactor * sizeof(T));
+    pipe.InitBuffer(outQueue, BUFFER_NUM, wFactor * sizeof(T));
+    pipe.InitBuffer(accBuf, wFactor * sizeof(float));
+    if constexpr (!IS_FLOAT) {
+        pipe.InitBuffer(castBuf, wFactor * sizeof(float));
+    }
+    if (borderFactor > 0) {
+        // 边界段搬入时两侧补零到32B对齐，多预留一个block
+        uint32_t borderLen = borderFactor + alignNum;
+        pipe.InitBuffer(borderQueue, 1, borderLen * sizeof(T));
+        if constexpr (!IS_FLOAT) {
+            pipe.InitBuffer(borderCastBuf, borderLen * sizeof(float));
+        }
+        pipe.InitBuffer(borderTmpBuf, borderLen * sizeof(float));
+        pipe.InitBuffer(borderIdxBuf, borderLen * sizeof(int32_t));
+        pipe.InitBuffer(borderSumBuf, BYTE_BLOCK);
+    }
+}
+
+template <typename T>
+__aicore__ inline void PadGradFoldND<T>::Process()
+{
+    for (uint64_t i = 0; i < unitNum; i++) {
+        ProcessUnit(unitStart + i);
+    }
+}
+
+// 第k个候选梯度坐标，若其不折叠到target则返回-1
+template <typename T>
+__aicore__ inline int64_t PadGradFoldND<T>::SourceOf(int32_t dim, int64_t target, int64_t k)
+{
+    if (k == 0) {
+        return target + padBefore[dim];
+    }
+    int64_t p = k <= padBefore[dim] ? k - 1 : outShape[dim] + k - 1;
+    return FoldIndex(p, outShape[dim], padBefore[dim], mode) == target ? p : -1;
+}
+
+template <typename T>
+__aicore__ inline void PadGradFoldND<T>::ProcessUnit(uint64_t unit)
+{
+    int64_t row = static_cast<int64_t>(unit / chunksPerRow);
+    int64_t colStart = static_cast<int64_t>(unit % chunksPerRow) * wFactor;
+    uint32_t count = static_cast<uint32_t>(
+        outShape[DIM_W] - colStart < static_cast<int64_t>(wFactor) ? outShape[DIM_W] - colStart : wFactor);
+    int64_t oh = row % outShape[DIM_H];
+    int64_t od = (row / outShape[DIM_H]) % outShape[DIM_D];
+    int64_t outer = row / outShape[DIM_H] / outShape[DIM_D];
+
+    bool first = true;
+    for (int64_t kd = 0; kd < candidateNum[DIM_D]; kd++) {
+        int64_t pd = SourceOf(DIM_D, od, kd);
+        if (pd < 0) {
+            continue;
+        }
+        for (int64_t kh = 0; kh < candidateNum[DIM_H]; kh++) {
+            int64_t ph = SourceOf(DIM_H, oh, kh);
+            if (ph < 0) {
+                continue;
+            }
+            int64_t rowOffset = ((outer * inShape[DIM_D] + pd) * inShape[DIM_H] + ph) * inShape[DIM_W];
+            AccumulateRow(rowOffset, colStart, count, first);
+            first = false;
+        }
+    }
+    int64_t outOffset = ((outer * outShape[DIM_D] + od) * outShape[DIM_H] + oh) * outShape[DIM_W] + colStart;
+    CopyOut(outOffset, count);
+}
+
+template <typename T>
+__aicore__ inline void PadGradFoldND<T>::AccumulateRow(
+    int64_t rowOffset, int64_t colStart, uint32_t count, bool first)
+{
+    uint32_t alignedCount = CeilAlign(count, alignNum);
+    LocalTensor<T> inLocal = inQueue.AllocTensor<T>();
+    DataCopyExtParams copyParams = {1, static_cast<uint32_t>(count * sizeof(T)), 0, 0, 0};
+    DataCopyPadExtParams<T> padParams = {false, 0, 0, 0};
+    DataCopyPad(inLocal, xGm[rowOffset + padBefore[DIM_W] + colStart], copyParams, padParams);
+    inQueue.EnQue(inLocal);
+    inLocal = inQueue.DeQue<T>();
+
+    LocalTensor<float> accLocal = accBuf.Get<float>();
+    if constexpr (IS_FLOAT) {
+        if (first) {
+            Adds(accLocal, inLocal, 0.0f, alignedCount);
+        } else {
+            Add(accLocal, accLocal, inLocal, alignedCount);
+        }
+    } else {
+        if (first) {
+            Cast(accLocal, inLocal, RoundMode::CAST_NONE, alignedCount);
+        } else {
+            LocalTensor<float> castLocal = castBuf.Get<float>();
+            Cast(castLocal, inLocal, RoundMode::CAST_NONE, alignedCount);
+            Add(accLocal, accLocal, castLocal, alignedCount);
+        }
+    }
+    inQueue.FreeTensor(inLocal);
+
+    if (borderFactor > 0) {
+        AccumulateBorder(rowOffset, 0, padBefore[DIM_W], colStart, count);
+        AccumulateBorder(rowOffset, padBefore[DIM_W] + outShape[DIM_W], padAfter[DIM_W], colStart, count);
+    }
+}
+
+// W方向边界段[segStart, segStart + segLen)按折叠映射累加，只累加落在当前块[colStart, colStart + count)内的部分
+template <typename T>
+__aicore__ inline void PadGradFoldND<T>::AccumulateBorder(
+    int64_t rowOffset, int64_t segStart, int64_t segLen, int64_t colStart, uint32_t count)
+{
+    if (segLen <= 0) {
+        return;
+    }
+    if (mode == CIRCULAR_MODE) {
+        AccumulateShifted(rowOffset, segStart, segLen, colStart, count);
+    } else if (mode == REFLECT_MODE) {
+        AccumulateReversed(rowOffset, segStart, segLen, colStart, count);
+    } else if (mode == EDGE_MODE) {
+        int64_t target = FoldIndex(segStart, outShape[DIM_W], padBefore[DIM_W], mode) - colStart;
+        if (target >= 0 && target < static_cast<int64_t>(count)) {
+            AccumulateEdge(rowOffset, segStart, segLen, target);
+        }
+    }
+}
+
+// 搬入x[gmOffset, gmOffset + num)，左右分别补leftPad、rightPad个0，fp16/bf16转成fp32
+template <typename T>
+__aicore__ inline LocalTensor<float> PadGradFoldND<T>::LoadBorder(
+    LocalTensor<T>& borderLocal, int64_t gmOffset, uint32_t num, uint32_t leftPad, uint32_t rightPad)
+{
+    borderLocal = borderQueue.AllocTensor<T>();
+    DataCopyExtParams copyParams = {1, static_cast<uint32_t>(num * sizeof(T)), 0, 0, 0};
+    DataCopyPadExtParams<T> padParams = {
+        true, static_cast<uint8_t>(leftPad), static_cast<uint8_t>(rightPad), 0};
+    DataCopyPad(borderLocal, xGm[gmOffset], copyParams, padParams);
+    borderQueue.EnQue(borderLocal);
+    borderLocal = borderQueue.DeQue<T>();
+    if constexpr (IS_FLOAT) {
+        return borderLocal;
+    } else {
+        LocalTensor<float> borderFloat = borderCastBuf.Get<float>();
+        Cast(borderFloat, borderLocal, RoundMode::CAST_NONE, leftPad + num + rightPad);
+        return borderFloat;
+    }
+}
+
+// circular：边界段平移到另一侧，目标列连续递增，补零对齐后整段向量相加
+template <typename T>
+__aicore__ inline void PadGradFoldND<T>::AccumulateShifted(
+    int64_t rowOffset, int64_t segStart, int64_t segLen, int64_t colStart, uint32_t count)
+{
+    int64_t shift = FoldIndex(segStart, outShape[DIM_W], padBefore[DIM_W], mode) - segStart;
+    int64_t lo = segStart + shift > colStart ? segStart + shift : colStart;
+    int64_t end = colStart + static_cast<int64_t>(count);
+    int64_t hi = segStart + shift + segLen < end ? segStart + shift + segLen : end;
+    LocalTensor<float> accLocal = accBuf.Get<float>();
+    for (int64_t t = lo; t < hi; t += borderFactor) {
+        uint32_t num = static_cast<uint32_t>(hi - t < static_cast<int64_t>(borderFactor) ? hi - t : borderFactor);
+        uint32_t col = static_cast<uint32_t>(t - colStart);
+        uint32_t leftPad = col % alignNum;
+        uint32_t total = CeilAlign(leftPad + num, alignNum);
+        LocalTensor<T> borderLocal;
+        LocalTensor<float> borderFloat = LoadBorder(borderLocal, rowOffset + t - shift, num, leftPad,
+                                                    total - leftPad - num);
+        Add(accLocal[col - leftPad], accLocal[col - leftPad], borderFloat, total);
+        borderQueue.FreeTensor(borderLocal);
+    }
+}
+
+// reflect：边界段以端点为轴镜像，目标列t对应梯度列axis - t。正向搬入后用Gather反转再整段相加
+template <typename T>
+__aicore__ inline void PadGradFoldND<T>::AccumulateReversed(
+    int64_t rowOffset, int64_t segStart, int64_t segLen, int64_t colStart, uint32_t count)
+{
+    int64_t axis = FoldIndex(segStart, outShape[DIM_W], padBefore[DIM_W], mode) + segStart;
+    int64_t lo = axis - segStart - segLen + 1 > colStart ? axis - segStart - segLen + 1 : colStart;
+    int64_t end = colStart + static_cast<int64_t>(count);
+    int64_t hi = axis - segStart + 1 < end ? axis - segStart + 1 : end;
+    LocalTensor<float> accLocal = accBuf.Get<float>();
+    LocalTensor<float> reversedLocal = borderTmpBuf.Get<float>();
+    LocalTensor<int32_t> idxLocal = borderIdxBuf.Get<int32_t>();
+    for (int64_t t = lo; t < hi; t += borderFactor) {
+        uint32_t num = static_cast<uint32_t>(hi - t < static_cast<int64_t>(borderFactor) ? hi - t : borderFactor);
+        uint32_t col = static_cast<uint32_t>(t - colStart);
+        uint32_t leftPad = col % alignNum;
+        uint32_t total = CeilAlign(leftPad + num, alignNum);
+        // 反转后左侧补零变到右侧，因此搬入时左右补零数互换
+        LocalTensor<T> borderLocal;
+        LocalTensor<float> borderFloat = LoadBorder(borderLocal, rowOffset + axis - t - num + 1, num,
+                                                    total - leftPad - num, leftPad);
+        // 第i个元素取自第total-1-i个元素，Gather偏移以字节计
+        CreateVecIndex(idxLocal, static_cast<int32_t>(0), total);
+        Muls(idxLocal, idxLocal, -static_cast<int32_t>(sizeof(float)), total);
+        Adds(idxLocal, idxLocal, static_cast<int32_t>((total - 1) * sizeof(float)), total);
+        Gather(reversedLocal, borderFloat, idxLocal.ReinterpretCast<uint32_t>(), 0, total);
+        Add(accLocal[col - leftPad], accLocal[col - leftPad], reversedLocal, total);
+        borderQueue.FreeTensor(borderLocal);
+    }
+}
+
+// edge：整段边界都折叠到端点target，分块向量累加后ReduceSum，只在端点做一次标量更新
+template <typename T>
+__aicore__ inline void PadGradFoldND<T>::AccumulateEdge(
+    int64_t rowOffset, int64_t segStart, int64_t segLen, int64_t target)
+{
+    LocalTensor<float> partialLocal = borderTmpBuf.Get<float>();
+    LocalTensor<float> sumLocal = borderSumBuf.Get<float>();
+    LocalTensor<float> workLocal = borderIdxBuf.Get<float>();
+    uint32_t maxTotal = CeilAlign(static_cast<uint32_t>(
+        segLen < static_cast<int64_t>(borderFactor) ? segLen : borderFactor), alignNum);
+    Duplicate(partialLocal, 0.0f, maxTotal);
+    for (int64_t offset = 0; offset < segLen; offset += borderFactor) {
+        uint32_t num = static_cast<uint32_t>(
+            segLen - offset < static_cast<int64_t>(borderFactor) ? segLen - offset : borderFactor);
+        uint32_t total = CeilAlign(num, alignNum);
+        LocalTensor<T> borderLocal;
+        LocalTensor<float> borderFloat = LoadBorder(borderLocal, rowOffset + segStart + offset, num, 0, total - num);
+        Add(partialLocal, partialLocal, borderFloat, total);
+        borderQueue.FreeTensor(borderLocal);
+    }
+    ReduceSum(sumLocal, partialLocal, workLocal, maxTotal);
+    SyncFlag<HardEvent::V_S>();
+    LocalTensor<float> accLocal = accBuf.Get<float>();
+    accLocal.SetValue(target, accLocal.GetValue(target) + sumLocal.GetValue(0));
+    SyncFlag<HardEvent::S_V>();
+}
+
+template <typename T>
+__aicore__ inline void PadGradFoldND<T>::CopyOut(int64_t offset, uint32_t count)
+{
+    uint32_t alignedCount = CeilAlign(count, alignNum);
+    LocalTensor<float> accLocal = accBuf.Get<float>();
+    LocalTensor<T> outLocal = outQueue.AllocTensor<T>();
+    if constexpr (IS_FLOAT) {
+        Adds(outLocal, accLocal, 0.0f, alignedCount);
+    } else {
+        Cast(outLocal, accLocal, RoundMode::CAST_RINT, alignedCount);
+    }
+    outQueue.EnQue(outLocal);
+    outLocal = outQueue.DeQue<T>();
+    DataCopyExtParams copyParams = {1, static_cast<uint32_t>(count * sizeof(T)), 0, 0, 0};
+    DataCopyPad(yGm[offset], outLocal, copyParams);
+    outQueue.FreeTensor(outLocal);
+}
+} // namespace PadGradFold
+
+#endif // PAD_GRAD_FOLD_H
@@ -0,0 +1,148 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file test_pad_grad_fold_tiling.cpp
+ * \brief
+ */
+
+#include <iostream>
+#include <gtest/gtest.h>
+#include "../../../op_host/pad_grad_fold_tiling.h"
+#include "tiling_context_faker.h"
+#include "tiling_case_executor.h"
+
+class PadGradFoldTiling : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        std::cout << "PadGradFoldTiling SetUp" << std::endl;
+    }
+    static void TearDownTestCase()
+    {
+        std::cout << "PadGradFoldTiling TearDown" << std::endl;
+    }
+};
+
+TEST_F(PadGradFoldTiling, pad_grad_fold_tiling_reflect_2d_float)
+{
+    optiling::PadGradFoldCompileInfo compileInfo = {64, 16777216, 196608};
+    std::vector<int64_t> constValue = {0, 0, 0, 0, 1, 1, 2, 2};
+    gert::TilingContextPara tilingContextPara(
+        "PadGradFold",
+        {{{{2, 3, 10, 12}, {2, 3, 10, 12}}, ge::DT_FLOAT, ge::FORMAT_ND},
+         {{{8}, {8}}, ge::DT_INT64, ge::FORMAT_ND, true, constValue.data()}},
+        {
+            {{{2, 3, 8, 8}, {2, 3, 8, 8}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("mode", Ops::Math::AnyValue::CreateFrom<std::string>("reflect")),
+         gert::TilingContextPara::OpAttr("paddings_contiguous", Ops::Math::AnyValue::CreateFrom<bool>(true))},
+        &compileInfo);
+    uint64_t expectTilingKey = 1;
+    std::string expectTilingData = "2 1 1 0 3 10 12 3 8 8 0 1 2 0 1 2 206158430209 34359738376 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(PadGradFoldTiling, pad_grad_fold_tiling_edge_1d_float16_large_w)
+{
+    optiling::PadGradFoldCompileInfo compileInfo = {64, 16777216, 196608};
+    std::vector<int64_t> constValue = {0, 0, 3, 3, 5, 4};
+    gert::TilingContextPara tilingContextPara(
+        "PadGradFold",
+        {{{{4, 70, 3000}, {4, 70, 3000}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+         {{{6}, {6}}, ge::DT_INT64, ge::FORMAT_ND, true, constValue.data()}},
+        {
+            {{{4, 64, 2991}, {4, 64, 2991}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("mode", Ops::Math::AnyValue::CreateFrom<std::string>("edge")),
+         gert::TilingContextPara::OpAttr("paddings_contiguous", Ops::Math::AnyValue::CreateFrom<bool>(true))},
+        &compileInfo);
+    uint64_t expectTilingKey = 2;
+    std::string expectTilingData = "1 1 4 0 4 70 3000 4 64 2991 0 3 5 0 3 4 274877906946 68719479728 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(PadGradFoldTiling, pad_grad_fold_tiling_circular_3d_bfloat16)
+{
+    optiling::PadGradFoldCompileInfo compileInfo = {64, 16777216, 196608};
+    std::vector<int32_t> constValue = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3};
+    gert::TilingContextPara tilingContextPara(
+        "PadGradFold",
+        {{{{1, 2, 6, 7, 9}, {1, 2, 6, 7, 9}}, ge::DT_BF16, ge::FORMAT_ND},
+         {{{10}, {10}}, ge::DT_INT32, ge::FORMAT_ND, true, constValue.data()}},
+        {
+            {{{1, 2, 4, 3, 3}, {1, 2, 4, 3, 3}}, ge::DT_BF16, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("mode", Ops::Math::AnyValue::CreateFrom<std::string>("circular")),
+         gert::TilingContextPara::OpAttr("paddings_contiguous", Ops::Math::AnyValue::CreateFrom<bool>(true))},
+        &compileInfo);
+    uint64_t expectTilingKey = 3;
+    std::string expectTilingData = "2 1 1 0 6 7 9 4 3 3 1 2 3 1 2 3 103079215107 68719476752 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(PadGradFoldTiling, pad_grad_fold_tiling_constant_not_contiguous)
+{
+    optiling::PadGradFoldCompileInfo compileInfo = {64, 16777216, 196608};
+    // [begin0, begin1, begin2, end0, end1, end2]
+    std::vector<int64_t> constValue = {0, 0, 2, 0, 0, 2};
+    gert::TilingContextPara tilingContextPara(
+        "PadGradFold",
+        {{{{8, 16, 20}, {8, 16, 20}}, ge::DT_FLOAT, ge::FORMAT_ND},
+         {{{6}, {6}}, ge::DT_INT64, ge::FORMAT_ND, true, constValue.data()}},
+        {
+            {{{8, 16, 16}, {8, 16, 16}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("mode", Ops::Math::AnyValue::CreateFrom<std::string>("constant")),
+         gert::TilingContextPara::OpAttr("paddings_contiguous", Ops::Math::AnyValue::CreateFrom<bool>(false))},
+        &compileInfo);
+    uint64_t expectTilingKey = 1;
+    std::string expectTilingData = "1 1 2 0 8 16 20 8 16 16 0 0 2 0 0 2 274877906944 16 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(PadGradFoldTiling, pad_grad_fold_tiling_reflect_pad_too_large)
+{
+    optiling::PadGradFoldCompileInfo compileInfo = {64, 16777216, 196608};
+    std::vector<int64_t> constValue = {0, 0, 0, 0, 0, 0, 4, 4};
+    gert::TilingContextPara tilingContextPara(
+        "PadGradFold",
+        {{{{2, 3, 8, 12}, {2, 3, 8, 12}}, ge::DT_FLOAT, ge::FORMAT_ND},
+         {{{8}, {8}}, ge::DT_INT64, ge::FORMAT_ND, true, constValue.data()}},
+        {
+            {{{2, 3, 8, 4}, {2, 3, 8, 4}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("mode", Ops::Math::AnyValue::CreateFrom<std::string>("reflect")),
+         gert::TilingContextPara::OpAttr("paddings_contiguous", Ops::Math::AnyValue::CreateFrom<bool>(true))},
+        &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
+
+TEST_F(PadGradFoldTiling, pad_grad_fold_tiling_invalid_dtype)
+{
+    optiling::PadGradFoldCompileInfo compileInfo = {64, 16777216, 196608};
+    std::vector<int64_t> constValue = {0, 0, 0, 0, 1, 1, 1, 1};
+    gert::TilingContextPara tilingContextPara(
+        "PadGradFold",
+        {{{{1, 1, 30, 30}, {1, 1, 30, 30}}, ge::DT_INT32, ge::FORMAT_ND},
+         {{{8}, {8}}, ge::DT_INT64, ge::FORMAT_ND, true, constValue.data()}},
+        {
+            {{{1, 1, 28, 28}, {1, 1, 28, 28}}, ge::DT_INT32, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("mode", Ops::Math::AnyValue::CreateFrom<std::string>("edge")),
+         gert::TilingContextPara::OpAttr("paddings_contiguous", Ops::Math::AnyValue::CreateFrom<bool>(true))},
+        &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
@@ -0,0 +1,238 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+/*!
+ * \file test_pad_grad_fold.cpp
+ * \brief
+ */
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <vector>
+#include "gtest/gtest.h"
+#include "tikicpulib.h"
+#include "data_utils.h"
+
+using namespace std;
+
+extern "C" __global__ __aicore__ void pad_grad_fold(
+    GM_ADDR x, GM_ADDR paddings, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling);
+
+class pad_grad_fold_test : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        cout << "pad_grad_fold_test SetUp\n" << endl;
+    }
+    static void TearDownTestCase()
+    {
+        cout << "pad_grad_fold_test TearDown\n" << endl;
+    }
+};
+
+TEST_F(pad_grad_fold_test, test_reflect_2d_float)
+{
+    // x: [2, 3, 10, 12], paddings H(1, 1) W(2, 2) -> y: [2, 3, 8, 8]
+    size_t inputNum = 2 * 3 * 10 * 12;
+    size_t outputNum = 2 * 3 * 8 * 8;
+    uint32_t blockDim = 48;
+    uint8_t* x = (uint8_t*)AscendC::GmAlloc(inputNum * sizeof(float));
+    uint8_t* paddings = (uint8_t*)AscendC::GmAlloc(8 * sizeof(int64_t));
+    uint8_t* y = (uint8_t*)AscendC::GmAlloc(outputNum * sizeof(float));
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(16 * 1024 * 1024);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(sizeof(PadGradFoldTilingData));
+
+    float* xData = reinterpret_cast<float*>(x);
+    for (size_t i = 0; i < inputNum; i++) {
+        xData[i] = 1.0f;
+    }
+
+    PadGradFoldTilingData* tilingData = reinterpret_cast<PadGradFoldTilingData*>(tiling);
+    tilingData->outerNum = 2;
+    tilingData->chunksPerRow = 1;
+    tilingData->unitsPerCore = 1;
+    tilingData->tailUnits = 0;
+    int64_t inShape[3] = {3, 10, 12};
+    int64_t outShape[3] = {3, 8, 8};
+    int64_t padBefore[3] = {0, 1, 2};
+    int64_t padAfter[3] = {0, 1, 2};
+    for (int32_t i = 0; i < 3; i++) {
+        tilingData->inShape[i] = inShape[i];
+        tilingData->outShape[i] = outShape[i];
+        tilingData->padBefore[i] = padBefore[i];
+        tilingData->padAfter[i] = padAfter[i];
+    }
+    tilingData->mode = 1;
+    tilingData->usedCoreNum = blockDim;
+    tilingData->wFactor = 8;
+    tilingData->borderFactor = 8;
+
+    ICPU_SET_TILING_KEY(1);
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_RUN_KF(pad_grad_fold, blockDim, x, paddings, y, workspace, (uint8_t*)(tilingData));
+
+    // reflect模式下每个梯度元素恰好回传到一个输入位置，总和守恒
+    float* yData = reinterpret_cast<float*>(y);
+    float sum = 0.0f;
+    for (size_t i = 0; i < outputNum; i++) {
+        sum += yData[i];
+    }
+    EXPECT_FLOAT_EQ(sum, static_cast<float>(inputNum));
+    // 行1列1：H方向来自梯度行2和行0，W方向来自梯度列3和列1
+    EXPECT_FLOAT_EQ(yData[9], 4.0f);
+
+    AscendC::GmFree(x);
+    AscendC::GmFree(paddings);
+    AscendC::GmFree(y);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+}
+
+TEST_F(pad_grad_fold_test, test_edge_1d_float16_chunked)
+{
+    // x: [4, 70, 3000], paddings H(3, 3) W(5, 4) -> y: [4, 64, 2991]，W方向分两块
+    size_t inputNum = 4 * 70 * 3000;
+    size_t outputNum = 4 * 64 * 2991;
+    uint32_t blockDim = 64;
+    uint8_t* x = (uint8_t*)AscendC::GmAlloc(inputNum * sizeof(half));
+    uint8_t* paddings = (uint8_t*)AscendC::GmAlloc(6 * sizeof(int64_t));
+    uint8_t* y = (uint8_t*)AscendC::GmAlloc(outputNum * sizeof(half));
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(16 * 1024 * 1024);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(sizeof(PadGradFoldTilingData));
+
+    PadGradFoldTilingData* tilingData = reinterpret_cast<PadGradFoldTilingData*>(tiling);
+    tilingData->outerNum = 1;
+    tilingData->chunksPerRow = 2;
+    tilingData->unitsPerCore = 8;
+    tilingData->tailUnits = 0;
+    int64_t inShape[3] = {4, 70, 3000};
+    int64_t outShape[3] = {4, 64, 2991};
+    int64_t padBefore[3] = {0, 3, 5};
+    int64_t padAfter[3] = {0, 3, 4};
+    for (int32_t i = 0; i < 3; i++) {
+        tilingData->inShape[i] = inShape[i];
+        tilingData->outShape[i] = outShape[i];
+        tilingData->padBefore[i] = padBefore[i];
+        tilingData->padAfter[i] = padAfter[i];
+    }
+    tilingData->mode = 2;
+    tilingData->usedCoreNum = blockDim;
+    tilingData->wFactor = 1504;
+    tilingData->borderFactor = 16;
+
+    ICPU_SET_TILING_KEY(2);
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_RUN_KF(pad_grad_fold, blockDim, x, paddings, y, workspace, (uint8_t*)(tilingData));
+
+    AscendC::GmFree(x);
+    AscendC::GmFree(paddings);
+    AscendC::GmFree(y);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+}
+
+// 按折叠映射逐元素计算参考结果，只折叠H/W两维
+static int64_t FoldIndexGolden(int64_t p, int64_t len, int64_t padBefore, uint32_t mode)
+{
+    int64_t src = p - padBefore;
+    if (src >= 0 && src < len) {
+        return src;
+    }
+    if (mode == 1) {
+        return src < 0 ? -src : 2 * (len - 1) - src;
+    }
+    if (mode == 2) {
+        return src < 0 ? 0 : len - 1;
+    }
+    return src < 0 ? src + len : src - len;
+}
+
+static void RunFoldGoldenCase(uint32_t mode)
+{
+    // x: [2, 6, 20], paddings H(1, 1) W(3, 2) -> y: [2, 4, 15]，W方向按8切成两块，边界段跨块
+    const int64_t outer = 2;
+    const int64_t inH = 6;
+    const int64_t inW = 20;
+    const int64_t outH = 4;
+    const int64_t outW = 15;
+    size_t inputNum = outer * inH * inW;
+    size_t outputNum = outer * outH * outW;
+    uint32_t blockDim = 16;
+    uint8_t* x = (uint8_t*)AscendC::GmAlloc(inputNum * sizeof(float));
+    uint8_t* paddings = (uint8_t*)AscendC::GmAlloc(6 * sizeof(int64_t));
+    uint8_t* y = (uint8_t*)AscendC::GmAlloc(outputNum * sizeof(float));
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(16 * 1024 * 1024);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(sizeof(PadGradFoldTilingData));
+
+    float* xData = reinterpret_cast<float*>(x);
+    for (size_t i = 0; i < inputNum; i++) {
+        xData[i] = static_cast<float>(i % 17) * 0.25f - 1.0f;
+    }
+
+    PadGradFoldTilingData* tilingData = reinterpret_cast<PadGradFoldTilingData*>(tiling);
+    tilingData->outerNum = outer;
+    tilingData->chunksPerRow = 2;
+    tilingData->unitsPerCore = 1;
+    tilingData->tailUnits = 0;
+    int64_t inShape[3] = {1, inH, inW};
+    int64_t outShape[3] = {1, outH, outW};
+    int64_t padBefore[3] = {0, 1, 3};
+    int64_t padAfter[3] = {0, 1, 2};
+    for (int32_t i = 0; i < 3; i++) {
+        tilingData->inShape[i] = inShape[i];
+        tilingData->outShape[i] = outShape[i];
+        tilingData->padBefore[i] = padBefore[i];
+        tilingData->padAfter[i] = padAfter[i];
+    }
+    tilingData->mode = mode;
+    tilingData->usedCoreNum = blockDim;
+    tilingData->wFactor = 8;
+    tilingData->borderFactor = 8;
+
+    ICPU_SET_TILING_KEY(1);
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_RUN_KF(pad_grad_fold, blockDim, x, paddings, y, workspace, (uint8_t*)(tilingData));
+
+    std::vector<float> golden(outputNum, 0.0f);
+    for (int64_t n = 0; n < outer; n++) {
+        for (int64_t h = 0; h < inH; h++) {
+            for (int64_t w = 0; w < inW; w++) {
+                int64_t oh = FoldIndexGolden(h, outH, padBefore[1], mode);
+                int64_t ow = FoldIndexGolden(w, outW, padBefore[2], mode);
+                golden[(n * outH + oh) * outW + ow] += xData[(n * inH + h) * inW + w];
+            }
+        }
+    }
+    float* yData = reinterpret_cast<float*>(y);
+    for (size_t i = 0; i < outputNum; i++) {
+        EXPECT_NEAR(yData[i], golden[i], 1e-5f) << "mode " << mode << " index " << i;
+    }
+
+    AscendC::GmFree(x);
+    AscendC::GmFree(paddings);
+    AscendC::GmFree(y);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+}
+
+TEST_F(pad_grad_fold_test, test_reflect_2d_float_chunked_golden)
+{
+    RunFoldGoldenCase(1);
+}
+
+TEST_F(pad_grad_fold_test, test_edge_2d_float_chunked_golden)
+{
+    RunFoldGoldenCase(2);
+}
+
+TEST_F(pad_grad_fold_test, test_circular_2d_float_chunked_golden)
+{
+    RunFoldGoldenCase(3);
+}
@@ -9,6 +9,7 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 
+#include <algorithm>
 #include "padv3grad.h"
 #include "opdev/op_log.h"
 #include "opdev/shape_utils.h"
@@ -25,6 +26,7 @@ OP_TYPE_REGISTER(PadV3GradReplicate);
 OP_TYPE_REGISTER(ReflectionPad3dGrad);
 OP_TYPE_REGISTER(PadV3GradReplication);
 OP_TYPE_REGISTER(CircularPadGrad);
+OP_TYPE_REGISTER(PadGradFold);
 
 static const std::initializer_list<op::DataType> AICORE_DTYPE_SUPPORT_LIST = {
     op::DataType::DT_FLOAT16, op::DataType::DT_FLOAT};
@@ -39,6 +41,8 @@ static const std::initializer_list<op::DataType> REPLICATION_3D_AICORE_DTYPE_SUP
     op::DataType::DT_FLOAT16, op::DataType::DT_FLOAT, op::DataType::DT_BF16};
 static const std::initializer_list<op::DataType> CIRCULAR_AICORE_DTYPE_SUPPORT_LIST = {
     op::DataType::DT_FLOAT16, op::DataType::DT_FLOAT, op::DataType::DT_BF16};
+static const std::initializer_list<op::DataType> PAD_GRAD_FOLD_AICORE_DTYPE_SUPPORT_LIST = {
+    op::DataType::DT_FLOAT16, op::DataType::DT_FLOAT, op::DataType::DT_BF16};
 
 static const size_t DIM_3D_SHAPE = 5;
 static const size_t DIM_3D_H_DIM_INDEX = 3;
@@ -55,6 +59,9 @@ static const int64_t FLOAT32_MAX_W = 1500;
 static const int64_t FLOAT16_MAX_H = 950;
 static const int64_t FLOAT16_MAX_W = 3000;
 static const string REPLICATION_PAD_MODE = "edge";
+static const size_t PAD_GRAD_FOLD_MAX_DIM = 8;
+static const size_t PAD_GRAD_FOLD_DIM_NUM = 3;
+static const size_t PAD_GRAD_FOLD_PAIR = 2;
 
 inline static bool IsTbeSupport(const aclTensor* gradOutput)
 {
@@ -132,6 +139,55 @@ inline static bool IsAiCoreSupportReflection3D(const aclTensor* gradOutput, cons
     return true;
 }
 
+inline static bool IsPadGradFoldShapeSupport(
+    const aclTensor* gradOutput, const aclTensor* paddings, const std::string& mode, const bool paddingsContiguous)
+{
+    // 与PadGradFold tiling的校验保持一致，tiling会拒绝的shape提前回退到TBE/AiCpu
+    size_t dimNum = gradOutput->GetViewShape().GetDimNum();
+    if (dimNum == 0 || dimNum > PAD_GRAD_FOLD_MAX_DIM) {
+        return false;
+    }
+    if (paddings == nullptr || paddings->GetDataType() != op::DataType::DT_INT64 ||
+        paddings->GetStorageAddr() == nullptr ||
+        static_cast<size_t>(paddings->GetViewShape().GetShapeSize()) != dimNum * PAD_GRAD_FOLD_PAIR) {
+        return false;
+    }
+    const int64_t* padValue = static_cast<const int64_t*>(paddings->GetStorageAddr());
+    size_t foldStart = dimNum > PAD_GRAD_FOLD_DIM_NUM ? dimNum - PAD_GRAD_FOLD_DIM_NUM : 0;
+    for (size_t i = 0; i < dimNum; i++) {
+        int64_t before = paddingsContiguous ? padValue[i * PAD_GRAD_FOLD_PAIR] : padValue[i];
+        int64_t after = paddingsContiguous ? padValue[i * PAD_GRAD_FOLD_PAIR + 1] : padValue[dimNum + i];
+        int64_t outDim = gradOutput->GetViewShape().GetDim(i) - before - after;
+        if (before < 0 || after < 0 || outDim <= 0) {
+            return false;
+        }
+        // 仅最后三维可以带pad
+        if (i < foldStart && (before != 0 || after != 0)) {
+            return false;
+        }
+        // reflect要求pad小于原长度，保证一次折叠即落回输入范围
+        if (mode == "reflect" && std::max(before, after) >= outDim) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline static bool IsPadGradFoldAicoreSupport(
+    const aclTensor* gradOutput, const aclTensor* paddings, const std::string& mode, const bool paddingsContiguous)
+{
+    // PadGradFold为通用折叠实现，兜住各专用kernel覆盖不到的模式和shape，避免落到AiCpu；circular模式已提前走CircularPadGrad
+    if (mode != "constant" && mode != "reflect" && mode != REPLICATION_PAD_MODE) {
+        return false;
+    }
+    if (!CheckType(gradOutput->GetDataType(), PAD_GRAD_FOLD_AICORE_DTYPE_SUPPORT_LIST) ||
+        (GetCurrentPlatformInfo().GetSocVersion() != SocVersion::ASCEND910B &&
+         GetCurrentPlatformInfo().GetSocVersion() != SocVersion::ASCEND910_93)) {
+        return false;
+    }
+    return IsPadGradFoldShapeSupport(gradOutput, paddings, mode, paddingsContiguous);
+}
+
 inline const aclTensor* PadV3GradAiCore(
     const aclTensor* gradOutput, const aclTensor* paddings, const std::string& mode, const bool paddingsContiguous,
     aclTensor* padV3GradOut, aclOpExecutor* executor)
@@ -209,6 +265,19 @@ inline const aclTensor* CircularPadGradAiCore(
     return padV3GradOut;
 }
 
+inline const aclTensor* PadGradFoldAiCore(
+    const aclTensor* gradOutput, const aclTensor* paddings, const std::string& mode, const bool paddingsContiguous,
+    aclTensor* padV3GradOut, aclOpExecutor* executor)
+{
+    L0_DFX(PadGradFoldAiCore, gradOutput, paddings, mode, paddingsContiguous, padV3GradOut);
+    auto ret = ADD_TO_LAUNCHER_LIST_AICORE(
+        PadGradFold, OP_INPUT(gradOutput, paddings), OP_OUTPUT(padV3GradOut), OP_ATTR(mode, paddingsContiguous));
+    OP_CHECK(
+        ret == ACLNN_SUCCESS, OP_LOGE(ACLNN_ERR_INNER_NULLPTR, "PadGradFoldAiCore ADD_TO_LAUNCHER_LIST_AICORE failed."),
+        return nullptr);
+    return padV3GradOut;
+}
+
 inline const aclTensor* PadV3GradAiCpu(
     const aclTensor* gradOutput, const aclTensor* paddings, const std::string& mode, const bool paddingsContiguous,
     aclTensor* padV3GradOut, aclOpExecutor* executor)
@@ -241,6 +310,8 @@ const aclTensor* PadV3Grad(
         return PadV3GradReplicationAiCore(gradOutput, paddings, padV3GradOut, executor);
     } else if (padFlag && IsAiCoreSupportReflection3D(gradOutput, mode)) {
         return PadV3Grad3DAiCoreReflection(gradOutput, paddings, padV3GradOut, executor);
+    } else if (padFlag && IsPadGradFoldAicoreSupport(gradOutput, paddings, mode, paddingsContiguous)) {
+        return PadGradFoldAiCore(gradOutput, paddings, mode, paddingsContiguous, padV3GradOut, executor);
     } else if (padFlag && IsTbeSupport(gradOutput)) {
         return PadV3GradAiCore(gradOutput, paddings, mode, paddingsContiguous, padV3GradOut, executor);
     } else {
@@ -8,6 +8,10 @@
  * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
  * See LICENSE in the root of the software repository for the full text of the License.
  */
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
 #include "aclnn_trans_matmul_weight.h"
 
 #include "util/math_util.h"
@@ -26,6 +30,7 @@
 #include "aclnn_kernels/contiguous.h"
 #include "aclnn_kernels/transdata.h"
 #include "conversion/tensor_move/op_host/op_api/tensor_move.h"
+#include "conversion/trans_data_nz/op_host/op_api/trans_data_nz.h"
 using namespace op;
 
 static const int MIN_DIM_NUM_ND = 2;
@@ -38,6 +43,82 @@ static const int MIN_INT8_DIM_NUM_ND = 2;
 static const int MAX_INT8_DIM_NUM_ND = 6;
 static const int MIN_FLOAT16_DIM_NUM_ND = 2;
 static const int MAX_FLOAT16_DIM_NUM_ND = 3;  
+
+// host侧NZ打包：以16行的分形条带为单位切分，每个条带内依次写出所有列分形块，
+// 源数据读取范围为16行，目标每次写出连续的16*n0个元素(512B)
+static const int64_t NZ_FRACTAL_ROWS = 16;
+static const int64_t NZ_FRACTAL_BYTES = 32;
+static const int64_t MIN_STRIPES_PER_THREAD = 64;
+
+struct NzPackParams {
+    const uint8_t* src;
+    uint8_t* dst;
+    int64_t m;
+    int64_t n;
+    int64_t alignM;
+    int64_t alignN;
+    int64_t n0;
+    int64_t elemSize;
+    int64_t stripesPerBatch;
+};
+
+void PackNzStripes(const NzPackParams& params, int64_t stripeStart, int64_t stripeEnd)
+{
+    const int64_t blockBytes = params.n0 * params.elemSize;
+    const int64_t srcRowBytes = params.n * params.elemSize;
+    const int64_t colBlockNum = params.alignN / params.n0;
+    const int64_t tailCols = params.n - (colBlockNum - 1) * params.n0;
+    for (int64_t stripe = stripeStart; stripe < stripeEnd; stripe++) {
+        int64_t batch = stripe / params.stripesPerBatch;
+        int64_t rowStart = (stripe % params.stripesPerBatch) * NZ_FRACTAL_ROWS;
+        int64_t validRows = std::min(NZ_FRACTAL_ROWS, params.m - rowStart);
+        const uint8_t* srcStripe = params.src + (batch * params.m + rowStart) * srcRowBytes;
+        uint8_t* dstStripe =
+            params.dst + (batch * params.alignM * params.alignN + rowStart * params.n0) * params.elemSize;
+        for (int64_t colBlock = 0; colBlock < colBlockNum; colBlock++) {
+            // 同一列分形块内的行在NZ中连续存放，列块之间间隔alignM * n0个元素
+            uint8_t* dstBlock = dstStripe + colBlock * params.alignM * blockBytes;
+            int64_t copyBytes = (colBlock == colBlockNum - 1 ? tailCols : params.n0) * params.elemSize;
+            for (int64_t row = 0; row < validRows; row++) {
+                std::memcpy(dstBlock + row * blockBytes, srcStripe + row * srcRowBytes + colBlock * blockBytes,
+                            copyBytes);
+                if (copyBytes < blockBytes) {
+                    std::memset(dstBlock + row * blockBytes + copyBytes, 0, blockBytes - copyBytes);
+                }
+            }
+            if (validRows < NZ_FRACTAL_ROWS) {
+                std::memset(dstBlock + validRows * blockBytes, 0, (NZ_FRACTAL_ROWS - validRows) * blockBytes);
+            }
+        }
+    }
+}
+
+void PackNz(const NzPackParams& params, int64_t batchNum, int64_t threadNum)
+{
+    int64_t stripeNum = batchNum * params.stripesPerBatch;
+    if (threadNum <= 0) {
+        threadNum = std::max(static_cast<int64_t>(std::thread::hardware_concurrency()), static_cast<int64_t>(1));
+    }
+    // 条带数较少时线程创建开销大于收益，保证每个线程至少处理MIN_STRIPES_PER_THREAD个条带
+    threadNum = std::max(std::min(threadNum, stripeNum / MIN_STRIPES_PER_THREAD), static_cast<int64_t>(1));
+    if (threadNum == 1) {
+        PackNzStripes(params, 0, stripeNum);
+        return;
+    }
+    std::vector<std::thread> workers;
+    workers.reserve(threadNum);
+    int64_t stripesPerThread = stripeNum / threadNum;
+    int64_t tailStripes = stripeNum % threadNum;
+    int64_t stripeStart = 0;
+    for (int64_t i = 0; i < threadNum; i++) {
+        int64_t stripeEnd = stripeStart + stripesPerThread + (i < tailStripes ? 1 : 0);
+        workers.emplace_back(PackNzStripes, std::cref(params), stripeStart, stripeEnd);
+        stripeStart = stripeEnd;
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
 }
 
 #ifdef __cplusplus
@@ -52,6 +133,12 @@ static const std::initializer_list<DataType> ASCEND910B_DTYPE_DTYPE_SUPPORT_LIST
 static const std::initializer_list<DataType> ASCEND310P_DTYPE_DTYPE_SUPPORT_LIST = {
     DataType::DT_FLOAT16, DataType::DT_INT8};
 
+static const std::initializer_list<DataType> WEIGHT_LIST_DTYPE_SUPPORT_LIST = {
+    DataType::DT_FLOAT16, DataType::DT_BF16, DataType::DT_INT8, DataType::DT_FLOAT};
+
+static const std::initializer_list<DataType> WEIGHT_LIST_OUT_DTYPE_SUPPORT_LIST = {
+    DataType::DT_FLOAT16, DataType::DT_BF16, DataType::DT_INT8};
+
 static inline const std::initializer_list<DataType>& GetDtypeSupportList()
 {
     if (GetCurrentPlatformInfo().GetSocVersion() == SocVersion::ASCEND910B ||
@@ -72,6 +159,13 @@ static inline bool NeedToCovertToPravateFormat()
     return true;
 }
 
+// Atlas A2/A3上ND->NZ使用仓内的TransDataNz kernel，其余芯片走TransData
+static inline bool IsTransDataNzSupport()
+{
+    SocVersion socVersion = GetCurrentPlatformInfo().GetSocVersion();
+    return socVersion == SocVersion::ASCEND910B || socVersion == SocVersion::ASCEND910_93;
+}
+
 static inline bool CheckShapeDim(const aclIntArray* tensorShape)
 {
     uint64_t dimSize = tensorShape->Size();
@@ -288,8 +382,18 @@ aclnnStatus aclnnTransMatmulWeightGetWorkspaceSize(
             uniqueExecutor.get()->CreateView(mmWeightRef, mmWeightRef->GetViewShape(), mmWeightRef->GetViewOffset());
     }
     CHECK_RET(weightContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
-    // 调用l0算子TransData进行计算，将内部计算格式转换为Nz
-    auto PrivateFormatResult = l0op::TransData(weightContiguous, Format::FORMAT_FRACTAL_NZ, 0, uniqueExecutor.get());
+    // 调用l0算子TransDataNz或TransData进行计算，将内部计算格式转换为Nz
+    const aclTensor* PrivateFormatResult = nullptr;
+    if (IsTransDataNzSupport()) {
+        auto weightList = uniqueExecutor.get()->AllocTensorList(&weightContiguous, 1);
+        CHECK_RET(weightList != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        auto nzList =
+            l0op::TransDataNz(weightList, weightContiguous->GetDataType(), true, uniqueExecutor.get());
+        CHECK_RET(nzList != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        PrivateFormatResult = (*nzList)[0];
+    } else {
+        PrivateFormatResult = l0op::TransData(weightContiguous, Format::FORMAT_FRACTAL_NZ, 0, uniqueExecutor.get());
+    }
     CHECK_RET(PrivateFormatResult != nullptr, ACLNN_ERR_INNER_NULLPTR);
     // 把计算结果写回tensor中
     mmWeightRef->SetOriginalShape(PrivateFormatResult->GetOriginalShape());
@@ -304,6 +408,63 @@ aclnnStatus aclnnTransMatmulWeightGetWorkspaceSize(
     return ACLNN_SUCCESS;
 }
 
+aclnnStatus aclnnTransMatmulWeightOnHost(
+    const aclIntArray* tensorShape, aclDataType dataType, const void* srcData, void* dstData, uint64_t dstSize,
+    int64_t threadNum)
+{
+    // 1. 检查参数是否为空指针
+    OP_CHECK_NULL(tensorShape, return ACLNN_ERR_PARAM_NULLPTR);
+    if (srcData == nullptr || dstData == nullptr) {
+        OP_LOGE(ACLNN_ERR_PARAM_NULLPTR, "srcData and dstData should not be null.");
+        return ACLNN_ERR_PARAM_NULLPTR;
+    }
+
+    // 2. 检查shape与数据类型，打包结果与aclnnTransMatmulWeight在device侧的NZ排布一致
+    CHECK_RET(CheckShapeDimV2(tensorShape), ACLNN_ERR_PARAM_INVALID);
+    CHECK_RET(CheckNonZeroShape(tensorShape), ACLNN_ERR_PARAM_INVALID);
+    int64_t n0 = 0;
+    int64_t elemSize = 0;
+    if (dataType == aclDataType::ACL_FLOAT16 || dataType == aclDataType::ACL_BF16) {
+        n0 = MIN_SIZE_PER_BLOCK_FLOAT16;
+        elemSize = NZ_FRACTAL_BYTES / MIN_SIZE_PER_BLOCK_FLOAT16;
+    } else if (dataType == aclDataType::ACL_INT8) {
+        n0 = MIN_SIZE_PER_BLOCK_INT8;
+        elemSize = NZ_FRACTAL_BYTES / MIN_SIZE_PER_BLOCK_INT8;
+    } else {
+        OP_LOGE(
+            ACLNN_ERR_PARAM_INVALID, "dataType should be FLOAT16, BFLOAT16 or INT8, but got %s.",
+            op::ToString(op::ToOpDataType(dataType)).GetString());
+        return ACLNN_ERR_PARAM_INVALID;
+    }
+
+    // 3. 检查目的内存是否足够
+    uint64_t weightSize = CalculateMatmulWeightSize(tensorShape, dataType);
+    if (dstSize < weightSize * static_cast<uint64_t>(elemSize)) {
+        OP_LOGE(
+            ACLNN_ERR_PARAM_INVALID, "dstSize [%lu] should be no less than %lu bytes.", dstSize,
+            weightSize * static_cast<uint64_t>(elemSize));
+        return ACLNN_ERR_PARAM_INVALID;
+    }
+
+    uint64_t dimSize = tensorShape->Size();
+    int64_t batchNum = 1;
+    for (uint64_t idx = 0; idx + 2 < dimSize; idx++) {
+        batchNum *= (*tensorShape)[idx];
+    }
+    NzPackParams params;
+    params.src = static_cast<const uint8_t*>(srcData);
+    params.dst = static_cast<uint8_t*>(dstData);
+    params.m = (*tensorShape)[dimSize - 2];
+    params.n = (*tensorShape)[dimSize - 1];
+    params.alignM = Ops::Base::CeilAlign(params.m, MIN_SIZE_PER_BLOCK_FLOAT16);
+    params.alignN = Ops::Base::CeilAlign(params.n, n0);
+    params.n0 = n0;
+    params.elemSize = elemSize;
+    params.stripesPerBatch = params.alignM / NZ_FRACTAL_ROWS;
+    PackNz(params, batchNum, threadNum);
+    return ACLNN_SUCCESS;
+}
+
 aclnnStatus aclnnTransMatmulWeight(
     void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, const aclrtStream stream)
 {
@@ -312,6 +473,123 @@ aclnnStatus aclnnTransMatmulWeight(
     return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
 }
 
+static bool CheckWeightListDtype(DataType weightDtype, DataType outDtype)
+{
+    // 类型相同时只做格式转换，fp32权重可在转换中Cast为fp16/bf16
+    if (weightDtype == outDtype) {
+        return true;
+    }
+    return weightDtype == DataType::DT_FLOAT && (outDtype == DataType::DT_FLOAT16 || outDtype == DataType::DT_BF16);
+}
+
+static aclnnStatus CheckWeightListParams(const aclTensorList* weightList, const aclTensorList* mmWeightRefList)
+{
+    // 1. 检查参数是否为空指针
+    OP_CHECK_NULL(weightList, return ACLNN_ERR_PARAM_NULLPTR);
+    OP_CHECK_NULL(mmWeightRefList, return ACLNN_ERR_PARAM_NULLPTR);
+
+    // 2. 批量转换只支持Atlas A2/A3
+    if (!IsTransDataNzSupport()) {
+        OP_LOGE(
+            ACLNN_ERR_RUNTIME_ERROR, "support for %s is not implemented",
+            op::ToString(GetCurrentPlatformInfo().GetSocVersion()).GetString());
+        return ACLNN_ERR_RUNTIME_ERROR;
+    }
+
+    // 3. 检查两个列表的tensor一一对应
+    if (weightList->Size() == 0 || weightList->Size() != mmWeightRefList->Size()) {
+        OP_LOGE(
+            ACLNN_ERR_PARAM_INVALID, "weightList size [%lu] must be positive and equal to mmWeightRefList size [%lu].",
+            weightList->Size(), mmWeightRefList->Size());
+        return ACLNN_ERR_PARAM_INVALID;
+    }
+    auto firstWeight = (*weightList)[0];
+    auto firstOut = (*mmWeightRefList)[0];
+    OP_CHECK_NULL(firstWeight, return ACLNN_ERR_PARAM_NULLPTR);
+    OP_CHECK_NULL(firstOut, return ACLNN_ERR_PARAM_NULLPTR);
+    OP_CHECK_DTYPE_NOT_SUPPORT(firstWeight, WEIGHT_LIST_DTYPE_SUPPORT_LIST, return ACLNN_ERR_PARAM_INVALID);
+    OP_CHECK_DTYPE_NOT_SUPPORT(firstOut, WEIGHT_LIST_OUT_DTYPE_SUPPORT_LIST, return ACLNN_ERR_PARAM_INVALID);
+    if (!CheckWeightListDtype(firstWeight->GetDataType(), firstOut->GetDataType())) {
+        OP_LOGE(
+            ACLNN_ERR_PARAM_INVALID, "weight dtype %s can not be converted to %s.",
+            op::ToString(firstWeight->GetDataType()).GetString(), op::ToString(firstOut->GetDataType()).GetString());
+        return ACLNN_ERR_PARAM_INVALID;
+    }
+
+    for (uint64_t i = 0; i < weightList->Size(); i++) {
+        auto weight = (*weightList)[i];
+        auto out = (*mmWeightRefList)[i];
+        OP_CHECK_NULL(weight, return ACLNN_ERR_PARAM_NULLPTR);
+        OP_CHECK_NULL(out, return ACLNN_ERR_PARAM_NULLPTR);
+        OP_CHECK_DTYPE_NOT_SAME(weight, firstWeight, return ACLNN_ERR_PARAM_INVALID);
+        OP_CHECK_DTYPE_NOT_SAME(out, firstOut, return ACLNN_ERR_PARAM_INVALID);
+        CHECK_RET(CheckFormatValid(weight), ACLNN_ERR_PARAM_INVALID);
+        OP_CHECK_SHAPE_NOT_EQUAL(out, weight, return ACLNN_ERR_PARAM_INVALID);
+        size_t dimNum = weight->GetViewShape().GetDimNum();
+        if (dimNum < MIN_INT8_DIM_NUM_ND || dimNum > MAX_INT8_DIM_NUM_ND) {
+            OP_LOGE(ACLNN_ERR_PARAM_INVALID, "It is expected that weight %lu has 2-6 dimensions, but got %zu.", i, dimNum);
+            return ACLNN_ERR_PARAM_INVALID;
+        }
+    }
+    return ACLNN_SUCCESS;
+}
+
+aclnnStatus aclnnTransMatmulWeightListGetWorkspaceSize(
+    const aclTensorList* weightList, aclTensorList* mmWeightRefList, uint64_t* workspaceSize, aclOpExecutor** executor)
+{
+    OP_CHECK_COMM_INPUT(workspaceSize, executor);
+    L2_DFX_PHASE_1(aclnnTransMatmulWeightList, DFX_IN(weightList), DFX_OUT(mmWeightRefList));
+    // 固定写法，创建OpExecutor
+    auto uniqueExecutor = CREATE_EXECUTOR();
+    CHECK_RET(uniqueExecutor.get() != nullptr, ACLNN_ERR_INNER_CREATE_EXECUTOR);
+
+    // 固定写法，参数检查
+    auto ret = CheckWeightListParams(weightList, mmWeightRefList);
+    CHECK_RET(ret == ACLNN_SUCCESS, ret);
+
+    // 输出直接按NZ排布写入用户tensor，空tensor只刷新格式不参与计算
+    FVector<const aclTensor*> weights;
+    FVector<const aclTensor*> outputs;
+    for (uint64_t i = 0; i < weightList->Size(); i++) {
+        aclTensor* out = (*mmWeightRefList)[i];
+        const op::Shape ndShape = out->GetViewShape();
+        out->SetOriginalShape(ndShape);
+        out->SetStorageShape(l0op::GetNzStorageShape(ndShape, out->GetDataType()));
+        out->SetStorageFormat(Format::FORMAT_FRACTAL_NZ);
+        if (out->IsEmpty()) {
+            continue;
+        }
+        auto weightContiguous = l0op::Contiguous((*weightList)[i], uniqueExecutor.get());
+        CHECK_RET(weightContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        weights.push_back(weightContiguous);
+        outputs.push_back(out);
+    }
+
+    // 整个列表一次下发TransDataNz；超过单次下发上限时按TRANS_DATA_NZ_MAX_TENSOR_NUM分批
+    for (size_t start = 0; start < outputs.size(); start += l0op::TRANS_DATA_NZ_MAX_TENSOR_NUM) {
+        size_t num = std::min(l0op::TRANS_DATA_NZ_MAX_TENSOR_NUM, outputs.size() - start);
+        auto xList = uniqueExecutor.get()->AllocTensorList(weights.data() + start, num);
+        CHECK_RET(xList != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        auto yList = uniqueExecutor.get()->AllocTensorList(outputs.data() + start, num);
+        CHECK_RET(yList != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        auto result = l0op::TransDataNz(xList, yList, true, uniqueExecutor.get());
+        CHECK_RET(result != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    }
+
+    // 固定写法，获取计算过程中需要使用的workspace大小
+    *workspaceSize = uniqueExecutor->GetWorkspaceSize();
+    uniqueExecutor.ReleaseTo(executor);
+    return ACLNN_SUCCESS;
+}
+
+aclnnStatus aclnnTransMatmulWeightList(
+    void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, const aclrtStream stream)
+{
+    L2_DFX_PHASE_2(aclnnTransMatmulWeightList);
+
+    return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+}
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
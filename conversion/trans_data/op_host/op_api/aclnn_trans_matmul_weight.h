@@ -72,6 +72,53 @@ aclnnTransMatmulWeightGetWorkspaceSize(aclTensor* mmWeightRef, uint64_t* workspa
 ACLNN_API aclnnStatus
 aclnnTransMatmulWeight(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream);
 
+/**
+ * @brief aclnnTransMatmulWeightOnHost在host侧将ND格式的matmul weight直接打包为FRACTAL_NZ格式的字节排布，
+ * 结果与aclnnTransMatmulWeight在device侧的转换结果一致，可预先打包落盘后直接拷贝至device，无需device侧转换
+ * @domain aclnn_ops_infer
+ *
+ * @param [in] tensorShape: weight的ND shape，维度为2-6，不允许包含0
+ * @param [in] dataType: weight的数据类型，支持float16,bfloat16,int8
+ * @param [in] srcData: host侧连续的ND数据起址
+ * @param [out] dstData: host侧输出内存起址，按FRACTAL_NZ排布写入，对齐补齐的部分填0
+ * @param [in] dstSize: dstData的字节数，不小于aclnnCalculateMatmulWeightSizeV2返回的元素个数乘以元素字节数
+ * @param [in] threadNum: 打包使用的线程数，小于等于0时使用硬件并发数
+ * @return aclnnStatus: 返回状态码。
+ */
+ACLNN_API aclnnStatus aclnnTransMatmulWeightOnHost(
+    const aclIntArray* tensorShape, aclDataType dataType, const void* srcData, void* dstData, uint64_t dstSize,
+    int64_t threadNum);
+
+/**
+ * @brief aclnnTransMatmulWeightList的第一段接口，根据具体的计算流程，计算workspace大小。
+ * @domain aclnn_ops_infer
+ *
+ * 算子功能：将一组ND格式的matmul weight一次下发转换为FRACTAL_NZ格式，可在转换中将float32权重Cast为float16/bfloat16。
+ *
+ * @param [in] weightList: 待处理的matmul weight列表，格式为ND，数据类型支持float16,bfloat16,int8,float32，
+ * 所有tensor数据类型一致
+ * @param [in] mmWeightRefList: 输出列表，shape与weightList一一对应，数据类型支持float16,bfloat16,int8，
+ * 需按aclnnCalculateMatmulWeightSizeV2申请内存；经过此接口处理后被刷新为FRACTAL_NZ格式
+ * @param [out] workspaceSize: 返回用户需要在npu device侧申请的workspace大小。
+ * @param [out] executor: 返回op执行器，包含算子计算流程。
+ * @return aclnnStatus: 返回状态码。
+ */
+ACLNN_API aclnnStatus aclnnTransMatmulWeightListGetWorkspaceSize(
+    const aclTensorList* weightList, aclTensorList* mmWeightRefList, uint64_t* workspaceSize,
+    aclOpExecutor** executor);
+/**
+ * @brief aclnnTransMatmulWeightList的第二段接口，用于执行计算。
+ *
+ * @param [in] workspace: 在npu device侧申请的workspace内存起址。
+ * @param [in] workspaceSize: 在npu
+ * device侧申请的workspace大小，由第一段接口aclnnTransMatmulWeightListGetWorkspaceSize获取。
+ * @param [in] executor: op执行器，包含了算子计算流程。
+ * @param [in] stream: acl stream流。
+ * @return aclnnStatus: 返回状态码。
+ */
+ACLNN_API aclnnStatus
+aclnnTransMatmulWeightList(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream);
+
 #ifdef __cplusplus
 }
 #endif
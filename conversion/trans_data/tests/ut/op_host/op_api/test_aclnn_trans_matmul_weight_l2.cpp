@@ -202,3 +202,129 @@ TEST_F(l2_trans_matmul_weight_test, ascend310P_test_invalid_shape_dim)
     aclnnStatus aclRet = aclnnCalculateMatmulWeightSizeV2(tensorShape, dataType, &weightSize);
     EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
 }
+
+TEST_F(l2_trans_matmul_weight_test, ascend910B2_test_weight_list_float16)
+{
+    auto weight1Desc = TensorDesc({1024, 4096}, ACL_FLOAT16, ACL_FORMAT_ND);
+    auto weight2Desc = TensorDesc({3, 100, 200}, ACL_FLOAT16, ACL_FORMAT_ND);
+    auto weightList = TensorListDesc({weight1Desc, weight2Desc});
+    auto outList = TensorListDesc({weight1Desc, weight2Desc});
+    auto ut = OP_API_UT(aclnnTransMatmulWeightList, INPUT(weightList), OUTPUT(outList));
+
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+TEST_F(l2_trans_matmul_weight_test, ascend910B2_test_weight_list_float_cast_bfloat16)
+{
+    // fp32权重在转换NZ时融合Cast为bf16
+    auto weightDesc = TensorDesc({4096, 11008}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto outDesc = TensorDesc({4096, 11008}, ACL_BF16, ACL_FORMAT_ND);
+    auto weightList = TensorListDesc(70, weightDesc);
+    auto outList = TensorListDesc(70, outDesc);
+    auto ut = OP_API_UT(aclnnTransMatmulWeightList, INPUT(weightList), OUTPUT(outList));
+
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+TEST_F(l2_trans_matmul_weight_test, ascend910B2_test_weight_list_invalid_cast)
+{
+    auto weightDesc = TensorDesc({64, 64}, ACL_FLOAT16, ACL_FORMAT_ND);
+    auto outDesc = TensorDesc({64, 64}, ACL_INT8, ACL_FORMAT_ND);
+    auto weightList = TensorListDesc(2, weightDesc);
+    auto outList = TensorListDesc(2, outDesc);
+    auto ut = OP_API_UT(aclnnTransMatmulWeightList, INPUT(weightList), OUTPUT(outList));
+
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+TEST_F(l2_trans_matmul_weight_test, ascend910B2_test_weight_list_size_mismatch)
+{
+    auto weightDesc = TensorDesc({64, 64}, ACL_FLOAT16, ACL_FORMAT_ND);
+    auto weightList = TensorListDesc(3, weightDesc);
+    auto outList = TensorListDesc(2, weightDesc);
+    auto ut = OP_API_UT(aclnnTransMatmulWeightList, INPUT(weightList), OUTPUT(outList));
+
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+// 按FRACTAL_NZ定义逐元素计算host打包的期望结果
+template <typename T>
+static vector<T> GetNzGolden(const vector<T>& src, int64_t batch, int64_t m, int64_t n, int64_t n0)
+{
+    int64_t alignM = (m + 15) / 16 * 16;
+    int64_t alignN = (n + n0 - 1) / n0 * n0;
+    vector<T> dst(batch * alignM * alignN, 0);
+    for (int64_t b = 0; b < batch; b++) {
+        for (int64_t i = 0; i < m; i++) {
+            for (int64_t j = 0; j < n; j++) {
+                int64_t dstIdx = b * alignM * alignN + (j / n0) * alignM * n0 + i * n0 + j % n0;
+                dst[dstIdx] = src[(b * m + i) * n + j];
+            }
+        }
+    }
+    return dst;
+}
+
+TEST_F(l2_trans_matmul_weight_test, ascend910B2_test_host_pack_float16_unaligned)
+{
+    vector<int64_t> shapeVec = {2, 37, 50};
+    aclIntArray* tensorShape = aclCreateIntArray(shapeVec.data(), shapeVec.size());
+    vector<uint16_t> src(2 * 37 * 50);
+    for (size_t i = 0; i < src.size(); i++) {
+        src[i] = static_cast<uint16_t>(i + 1);
+    }
+    uint64_t weightSize = 0;
+    aclnnStatus aclRet = aclnnCalculateMatmulWeightSizeV2(tensorShape, ACL_FLOAT16, &weightSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+    vector<uint16_t> dst(weightSize, 0xFFFF);
+    aclRet = aclnnTransMatmulWeightOnHost(
+        tensorShape, ACL_FLOAT16, src.data(), dst.data(), dst.size() * sizeof(uint16_t), 0);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+    EXPECT_EQ(dst, GetNzGolden(src, 2, 37, 50, 16));
+    aclDestroyIntArray(tensorShape);
+}
+
+TEST_F(l2_trans_matmul_weight_test, ascend910B2_test_host_pack_int8_multi_thread)
+{
+    // 条带数足够多时走多线程路径
+    vector<int64_t> shapeVec = {3, 1100, 70};
+    aclIntArray* tensorShape = aclCreateIntArray(shapeVec.data(), shapeVec.size());
+    vector<int8_t> src(3 * 1100 * 70);
+    for (size_t i = 0; i < src.size(); i++) {
+        src[i] = static_cast<int8_t>(i % 127 + 1);
+    }
+    uint64_t weightSize = 0;
+    aclnnStatus aclRet = aclnnCalculateMatmulWeightSizeV2(tensorShape, ACL_INT8, &weightSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+    vector<int8_t> dst(weightSize, -1);
+    aclRet = aclnnTransMatmulWeightOnHost(tensorShape, ACL_INT8, src.data(), dst.data(), dst.size(), 4);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+    EXPECT_EQ(dst, GetNzGolden(src, 3, 1100, 70, 32));
+    aclDestroyIntArray(tensorShape);
+}
+
+TEST_F(l2_trans_matmul_weight_test, ascend910B2_test_host_pack_invalid_param)
+{
+    vector<int64_t> shapeVec = {32, 32};
+    aclIntArray* tensorShape = aclCreateIntArray(shapeVec.data(), shapeVec.size());
+    vector<float> src(32 * 32, 1.0f);
+    vector<float> dst(32 * 32, 0.0f);
+    // float32不支持
+    aclnnStatus aclRet =
+        aclnnTransMatmulWeightOnHost(tensorShape, ACL_FLOAT, src.data(), dst.data(), dst.size() * sizeof(float), 1);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+    // 目的内存不足
+    aclRet = aclnnTransMatmulWeightOnHost(tensorShape, ACL_FLOAT16, src.data(), dst.data(), 16, 1);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+    aclRet = aclnnTransMatmulWeightOnHost(tensorShape, ACL_FLOAT16, nullptr, dst.data(), dst.size(), 1);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_NULLPTR);
+    aclDestroyIntArray(tensorShape);
+}
@@ -0,0 +1,92 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+
+/*!
+ * \file trans_data_nz.cpp
+ * \brief
+ */
+#include "trans_data_nz.h"
+#include "opdev/make_op_executor.h"
+#include "opdev/op_def.h"
+#include "opdev/op_dfx.h"
+#include "opdev/op_executor.h"
+#include "opdev/shape_utils.h"
+
+using namespace op;
+
+namespace l0op {
+OP_TYPE_REGISTER(TransDataNz);
+
+static constexpr int64_t NZ_BLOCK_BYTES = 32;
+static constexpr int64_t NZ_M0 = 16;
+static constexpr size_t ND_MIN_DIM_NUM = 2;
+
+op::Shape GetNzStorageShape(const op::Shape& ndShape, op::DataType dataType)
+{
+    op::Shape nzShape;
+    size_t dimNum = ndShape.GetDimNum();
+    if (dimNum < ND_MIN_DIM_NUM) {
+        return nzShape;
+    }
+    int64_t n0 = NZ_BLOCK_BYTES / static_cast<int64_t>(ge::GetSizeByDataType(dataType));
+    for (size_t i = 0; i < dimNum - ND_MIN_DIM_NUM; i++) {
+        nzShape.AppendDim(ndShape.GetDim(i));
+    }
+    nzShape.AppendDim((ndShape.GetDim(dimNum - 1) + n0 - 1) / n0);
+    nzShape.AppendDim((ndShape.GetDim(dimNum - ND_MIN_DIM_NUM) + NZ_M0 - 1) / NZ_M0);
+    nzShape.AppendDim(NZ_M0);
+    nzShape.AppendDim(n0);
+    return nzShape;
+}
+
+static const aclTensorList* TransDataNzAiCore(
+    const aclTensorList* x, const aclTensorList* y, bool toNz, aclOpExecutor* executor)
+{
+    const std::string srcFormat = toNz ? "ND" : "FRACTAL_NZ";
+    const std::string dstFormat = toNz ? "FRACTAL_NZ" : "ND";
+    int64_t dstType = static_cast<int64_t>((*y)[0]->GetDataType());
+    auto ret = ADD_TO_LAUNCHER_LIST_AICORE(
+        TransDataNz, OP_INPUT(x), OP_OUTPUT(y), OP_ATTR(srcFormat, dstFormat, dstType));
+    OP_CHECK(
+        ret == ACLNN_SUCCESS, OP_LOGE(ACLNN_ERR_INNER_NULLPTR, "TransDataNzAiCore ADD_TO_LAUNCHER_LIST_AICORE failed."),
+        return nullptr);
+    return y;
+}
+
+const aclTensorList* TransDataNz(const aclTensorList* x, op::DataType dstType, bool toNz, aclOpExecutor* executor)
+{
+    L0_DFX(TransDataNz, x, dstType, toNz);
+    FVector<const aclTensor*> outVector;
+    for (uint64_t i = 0; i < x->Size(); i++) {
+        const aclTensor* outTensor = nullptr;
+        if (toNz) {
+            const op::Shape& ndShape = (*x)[i]->GetViewShape();
+            outTensor = executor->AllocTensor(
+                GetNzStorageShape(ndShape, dstType), ndShape, dstType, Format::FORMAT_FRACTAL_NZ, Format::FORMAT_ND);
+        } else {
+            const op::Shape& ndShape = (*x)[i]->GetOriginalShape();
+            outTensor = executor->AllocTensor(ndShape, ndShape, dstType, Format::FORMAT_ND, Format::FORMAT_ND);
+        }
+        CHECK_RET(outTensor != nullptr, nullptr);
+        outVector.emplace_back(outTensor);
+    }
+    auto out = executor->AllocTensorList(outVector.data(), outVector.size());
+    CHECK_RET(out != nullptr, nullptr);
+    return TransDataNzAiCore(x, out, toNz, executor);
+}
+
+const aclTensorList* TransDataNz(const aclTensorList* x, const aclTensorList* y, bool toNz, aclOpExecutor* executor)
+{
+    L0_DFX(TransDataNz, x, y, toNz);
+    return TransDataNzAiCore(x, y, toNz, executor);
+}
+} // namespace l0op
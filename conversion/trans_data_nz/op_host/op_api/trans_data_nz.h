@@ -0,0 +1,36 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+
+/*!
+ * \file trans_data_nz.h
+ * \brief
+ */
+#ifndef OP_API_INC_LEVEL0_OP_TRANS_DATA_NZ_H_
+#define OP_API_INC_LEVEL0_OP_TRANS_DATA_NZ_H_
+
+#include "opdev/op_executor.h"
+
+namespace l0op {
+// 单次下发支持的最大tensor个数
+constexpr size_t TRANS_DATA_NZ_MAX_TENSOR_NUM = 64;
+
+// toNz为true时x为ND，输出FRACTAL_NZ；否则x为FRACTAL_NZ，输出其原始shape的ND。dstType与x不同时融合Cast
+const aclTensorList* TransDataNz(const aclTensorList* x, op::DataType dstType, bool toNz, aclOpExecutor* executor);
+
+// 直接写入调用方给定的y，y需已设置好storage shape/format与数据类型
+const aclTensorList* TransDataNz(const aclTensorList* x, const aclTensorList* y, bool toNz, aclOpExecutor* executor);
+
+// ND shape [..., M, N]对应的FRACTAL_NZ storage shape [..., ceil(N / n0), ceil(M / 16), 16, n0]
+op::Shape GetNzStorageShape(const op::Shape& ndShape, op::DataType dataType);
+} // namespace l0op
+
+#endif // OP_API_INC_LEVEL0_OP_TRANS_DATA_NZ_H_
@@ -0,0 +1,114 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+
+/*!
+ * \file trans_data_nz_infershape.cpp
+ * \brief
+ */
+#include <cstring>
+#include "register/op_impl_registry.h"
+#include "log/log.h"
+
+using namespace ge;
+
+namespace ops {
+constexpr size_t INPUT_X_IDX = 0;
+constexpr size_t ATTR_DST_FORMAT_IDX = 1;
+constexpr size_t ATTR_DST_TYPE_IDX = 2;
+constexpr int64_t NZ_BLOCK_BYTES = 32;
+constexpr int64_t NZ_M0 = 16;
+constexpr size_t ND_MIN_DIM_NUM = 2;
+constexpr size_t NZ_EXTRA_DIM_NUM = 2;
+
+static bool IsToNz(const gert::RuntimeAttrs* attrs)
+{
+    const char* dstFormat = attrs->GetAttrPointer<char>(ATTR_DST_FORMAT_IDX);
+    return dstFormat == nullptr || std::strcmp(dstFormat, "FRACTAL_NZ") == 0;
+}
+
+static ge::DataType GetDstType(const gert::RuntimeAttrs* attrs, ge::DataType xDataType)
+{
+    const int64_t* dstTypePtr = attrs->GetAttrPointer<int64_t>(ATTR_DST_TYPE_IDX);
+    if (dstTypePtr == nullptr || *dstTypePtr < 0) {
+        return xDataType;
+    }
+    return static_cast<ge::DataType>(*dstTypePtr);
+}
+
+static int64_t CeilDiv(int64_t a, int64_t b)
+{
+    return (a + b - 1) / b;
+}
+
+static ge::graphStatus InferShapeForTransDataNz(gert::InferShapeContext* context)
+{
+    auto attrs = context->GetAttrs();
+    OP_CHECK_NULL_WITH_CONTEXT(context, attrs);
+    auto xDesc = context->GetInputDesc(INPUT_X_IDX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, xDesc);
+    bool toNz = IsToNz(attrs);
+    // NZ侧的数据类型决定分形的列数n0，保证每个分形行为32字节
+    ge::DataType nzDataType = toNz ? GetDstType(attrs, xDesc->GetDataType()) : xDesc->GetDataType();
+    int64_t nzTypeSize = ge::GetSizeByDataType(nzDataType);
+    OP_CHECK_IF(nzTypeSize <= 0, OP_LOGE(context, "Invalid NZ data type."), return ge::GRAPH_FAILED);
+    int64_t n0 = NZ_BLOCK_BYTES / nzTypeSize;
+
+    size_t outputNum = context->GetComputeNodeOutputNum();
+    for (size_t i = 0; i < outputNum; i++) {
+        auto xShape = context->GetDynamicInputShape(INPUT_X_IDX, i);
+        OP_CHECK_NULL_WITH_CONTEXT(context, xShape);
+        auto yShape = context->GetOutputShape(i);
+        OP_CHECK_NULL_WITH_CONTEXT(context, yShape);
+        size_t dimNum = xShape->GetDimNum();
+        yShape->SetDimNum(0);
+        if (toNz) {
+            // [..., M, N] -> [..., ceil(N / n0), ceil(M / 16), 16, n0]
+            OP_CHECK_IF(dimNum < ND_MIN_DIM_NUM, OP_LOGE(context, "The ND input must be at least 2D."),
+                        return ge::GRAPH_FAILED);
+            for (size_t d = 0; d < dimNum - ND_MIN_DIM_NUM; d++) {
+                yShape->AppendDim(xShape->GetDim(d));
+            }
+            yShape->AppendDim(CeilDiv(xShape->GetDim(dimNum - 1), n0));
+            yShape->AppendDim(CeilDiv(xShape->GetDim(dimNum - 2), NZ_M0));
+            yShape->AppendDim(NZ_M0);
+            yShape->AppendDim(n0);
+        } else {
+            // [..., N1, M1, 16, n0] -> [..., M1 * 16, N1 * n0]，原始shape未知时按对齐后的大小推导
+            OP_CHECK_IF(dimNum < ND_MIN_DIM_NUM + NZ_EXTRA_DIM_NUM,
+                        OP_LOGE(context, "The FRACTAL_NZ input must be at least 4D."), return ge::GRAPH_FAILED);
+            size_t batchDimNum = dimNum - ND_MIN_DIM_NUM - NZ_EXTRA_DIM_NUM;
+            for (size_t d = 0; d < batchDimNum; d++) {
+                yShape->AppendDim(xShape->GetDim(d));
+            }
+            yShape->AppendDim(xShape->GetDim(batchDimNum + 1) * xShape->GetDim(batchDimNum + 2));
+            yShape->AppendDim(xShape->GetDim(batchDimNum) * xShape->GetDim(batchDimNum + 3));
+        }
+    }
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus InferDataTypeForTransDataNz(gert::InferDataTypeContext* context)
+{
+    auto attrs = context->GetAttrs();
+    OP_CHECK_NULL_WITH_CONTEXT(context, attrs);
+    const ge::DataType yDataType = GetDstType(attrs, context->GetInputDataType(INPUT_X_IDX));
+    size_t outputNum = context->GetComputeNodeOutputNum();
+    for (size_t i = 0; i < outputNum; i++) {
+        context->SetOutputDataType(i, yDataType);
+    }
+    return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_INFERSHAPE(TransDataNz)
+    .InferShape(InferShapeForTransDataNz)
+    .InferDataType(InferDataTypeForTransDataNz);
+} // namespace ops
@@ -0,0 +1,321 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+
+/*!
+ * \file trans_data_nz_tiling.cpp
+ * \brief
+ */
+#include <algorithm>
+#include <cstring>
+#include <set>
+#include <utility>
+#include "trans_data_nz_tiling.h"
+#include "log/log.h"
+#include "register/op_def_registry.h"
+#include "tiling_base/tiling_templates_registry.h"
+#include "platform/platform_info.h"
+#include "graph/utils/type_utils.h"
+
+namespace optiling {
+constexpr size_t X_INPUT_INDEX = 0;
+constexpr size_t SRC_FORMAT_ATTR_INDEX = 0;
+constexpr size_t DST_FORMAT_ATTR_INDEX = 1;
+constexpr size_t DST_TYPE_ATTR_INDEX = 2;
+constexpr size_t ND_MIN_DIM_NUM = 2;
+constexpr size_t NZ_EXTRA_DIM_NUM = 2;
+constexpr uint64_t BYTE_BLOCK = 32;
+constexpr uint64_t NZ_M0 = 16;
+constexpr uint64_t BUFFER_NUM = 2;
+constexpr uint64_t RESERVED_UB = 1024;
+constexpr uint64_t MIN_COL_BLOCK_FACTOR = 2;
+constexpr uint64_t TARGET_BURST_BYTES = 512; // ND侧每行连续搬运的目标字节数
+constexpr uint64_t MAX_ROW_FACTOR = 4080;    // DataCopy的blockCount上限4095按16向下对齐
+
+constexpr uint64_t ND_TO_NZ_TILING_KEY = 1;
+constexpr uint64_t NZ_TO_ND_TILING_KEY = 2;
+
+// 支持的(x, y)数据类型组合，类型不同时在搬运中融合Cast
+static const std::set<std::pair<ge::DataType, ge::DataType>> SUPPORT_DTYPE_PAIRS = {
+    {ge::DT_FLOAT16, ge::DT_FLOAT16}, {ge::DT_BF16, ge::DT_BF16},   {ge::DT_INT8, ge::DT_INT8},
+    {ge::DT_FLOAT, ge::DT_FLOAT},     {ge::DT_FLOAT, ge::DT_FLOAT16}, {ge::DT_FLOAT, ge::DT_BF16},
+    {ge::DT_FLOAT16, ge::DT_FLOAT},   {ge::DT_BF16, ge::DT_FLOAT}};
+
+struct TransDataNzParams {
+    bool toNz;
+    ge::DataType srcType;
+    ge::DataType dstType;
+    uint32_t tensorNum;
+    int64_t batch[TRANS_DATA_NZ_MAX_TENSOR_NUM];
+    int64_t m[TRANS_DATA_NZ_MAX_TENSOR_NUM];
+    int64_t n[TRANS_DATA_NZ_MAX_TENSOR_NUM];
+};
+
+static inline uint64_t CeilDiv(uint64_t a, uint64_t b)
+{
+    return b == 0 ? a : (a + b - 1) / b;
+}
+
+static inline uint64_t CeilAlign(uint64_t a, uint64_t b)
+{
+    return CeilDiv(a, b) * b;
+}
+
+static ge::graphStatus GetDirection(const gert::TilingContext* context, bool& toNz)
+{
+    auto attrs = context->GetAttrs();
+    OP_CHECK_NULL_WITH_CONTEXT(context, attrs);
+    const char* srcFormat = attrs->GetAttrPointer<char>(SRC_FORMAT_ATTR_INDEX);
+    const char* dstFormat = attrs->GetAttrPointer<char>(DST_FORMAT_ATTR_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, srcFormat);
+    OP_CHECK_NULL_WITH_CONTEXT(context, dstFormat);
+    if (std::strcmp(srcFormat, "ND") == 0 && std::strcmp(dstFormat, "FRACTAL_NZ") == 0) {
+        toNz = true;
+    } else if (std::strcmp(srcFormat, "FRACTAL_NZ") == 0 && std::strcmp(dstFormat, "ND") == 0) {
+        toNz = false;
+    } else {
+        OP_LOGE(
+            context->GetNodeName(), "Only support ND to FRACTAL_NZ or FRACTAL_NZ to ND, but got %s to %s.", srcFormat,
+            dstFormat);
+        return ge::GRAPH_FAILED;
+    }
+    return ge::GRAPH_SUCCESS;
+}
+
+// NZ shape必须为[..., ceil(N / n0), ceil(M / 16), 16, n0]，其中前置维度与ND一致
+static bool CheckNzShape(const gert::Shape& ndShape, const gert::Shape& nzShape, int64_t n0)
+{
+    size_t ndDimNum = ndShape.GetDimNum();
+    if (ndDimNum < ND_MIN_DIM_NUM || nzShape.GetDimNum() != ndDimNum + NZ_EXTRA_DIM_NUM) {
+        return false;
+    }
+    size_t batchDimNum = ndDimNum - ND_MIN_DIM_NUM;
+    for (size_t i = 0; i < batchDimNum; i++) {
+        if (ndShape.GetDim(i) != nzShape.GetDim(i)) {
+            return false;
+        }
+    }
+    int64_t m = ndShape.GetDim(batchDimNum);
+    int64_t n = ndShape.GetDim(batchDimNum + 1);
+    return nzShape.GetDim(batchDimNum) == static_cast<int64_t>(CeilDiv(n, n0)) &&
+           nzShape.GetDim(batchDimNum + 1) == static_cast<int64_t>(CeilDiv(m, NZ_M0)) &&
+           nzShape.GetDim(batchDimNum + 2) == static_cast<int64_t>(NZ_M0) && nzShape.GetDim(batchDimNum + 3) == n0;
+}
+
+static ge::graphStatus GetInputInfo(gert::TilingContext* context, TransDataNzParams& params)
+{
+    const ge::char_t* nodeName = context->GetNodeName();
+    OP_CHECK_IF(
+        GetDirection(context, params.toNz) != ge::GRAPH_SUCCESS, OP_LOGE(nodeName, "GetDirection failed."),
+        return ge::GRAPH_FAILED);
+    size_t tensorNum = context->GetComputeNodeOutputNum();
+    OP_CHECK_IF(
+        tensorNum == 0 || tensorNum > TRANS_DATA_NZ_MAX_TENSOR_NUM,
+        OP_LOGE(nodeName, "The number of tensors [%zu] not in (0, %u].", tensorNum, TRANS_DATA_NZ_MAX_TENSOR_NUM),
+        return ge::GRAPH_FAILED);
+    OP_CHECK_IF(
+        context->GetComputeNodeInputNum() != tensorNum, OP_LOGE(nodeName, "x and y must contain the same tensors."),
+        return ge::GRAPH_FAILED);
+    params.tensorNum = static_cast<uint32_t>(tensorNum);
+
+    auto xDesc = context->GetDynamicInputDesc(X_INPUT_INDEX, 0);
+    OP_CHECK_NULL_WITH_CONTEXT(context, xDesc);
+    auto yDesc = context->GetOutputDesc(0);
+    OP_CHECK_NULL_WITH_CONTEXT(context, yDesc);
+    params.srcType = xDesc->GetDataType();
+    params.dstType = yDesc->GetDataType();
+    OP_CHECK_IF(
+        SUPPORT_DTYPE_PAIRS.count({params.srcType, params.dstType}) == 0,
+        OP_LOGE(
+            nodeName, "The dtype pair of x [%s] and y [%s] is not supported.",
+            ge::TypeUtils::DataTypeToSerialString(params.srcType).c_str(),
+            ge::TypeUtils::DataTypeToSerialString(params.dstType).c_str()),
+        return ge::GRAPH_FAILED);
+    auto attrs = context->GetAttrs();
+    OP_CHECK_NULL_WITH_CONTEXT(context, attrs);
+    const int64_t* dstTypePtr = attrs->GetAttrPointer<int64_t>(DST_TYPE_ATTR_INDEX);
+    OP_CHECK_IF(
+        dstTypePtr != nullptr && *dstTypePtr >= 0 && static_cast<ge::DataType>(*dstTypePtr) != params.dstType,
+        OP_LOGE(nodeName, "The attr dst_type [%ld] is not the dtype of y.", *dstTypePtr), return ge::GRAPH_FAILED);
+
+    ge::DataType nzType = params.toNz ? params.dstType : params.srcType;
+    int64_t n0 = static_cast<int64_t>(BYTE_BLOCK) / ge::GetSizeByDataType(nzType);
+    for (size_t i = 0; i < tensorNum; i++) {
+        auto xDescI = context->GetDynamicInputDesc(X_INPUT_INDEX, i);
+        OP_CHECK_NULL_WITH_CONTEXT(context, xDescI);
+        auto yDescI = context->GetOutputDesc(i);
+        OP_CHECK_NULL_WITH_CONTEXT(context, yDescI);
+        OP_CHECK_IF(
+            xDescI->GetDataType() != params.srcType || yDescI->GetDataType() != params.dstType,
+            OP_LOGE(nodeName, "All tensors in x and y must have consistent data types."), return ge::GRAPH_FAILED);
+        auto xShape = context->GetDynamicInputShape(X_INPUT_INDEX, i);
+        OP_CHECK_NULL_WITH_CONTEXT(context, xShape);
+        auto yShape = context->GetOutputShape(i);
+        OP_CHECK_NULL_WITH_CONTEXT(context, yShape);
+        const gert::Shape& ndShape = params.toNz ? xShape->GetStorageShape() : yShape->GetStorageShape();
+        const gert::Shape& nzShape = params.toNz ? yShape->GetStorageShape() : xShape->GetStorageShape();
+        OP_CHECK_IF(
+            !CheckNzShape(ndShape, nzShape, n0),
+            OP_LOGE(nodeName, "The FRACTAL_NZ shape of tensor %zu does not match its ND shape.", i),
+            return ge::GRAPH_FAILED);
+        size_t ndDimNum = ndShape.GetDimNum();
+        params.batch[i] = 1;
+        for (size_t d = 0; d < ndDimNum - ND_MIN_DIM_NUM; d++) {
+            params.batch[i] *= ndShape.GetDim(d);
+        }
+        params.m[i] = ndShape.GetDim(ndDimNum - ND_MIN_DIM_NUM);
+        params.n[i] = ndShape.GetDim(ndDimNum - 1);
+    }
+    return ge::GRAPH_SUCCESS;
+}
+
+static uint64_t CalcUnitNum(const TransDataNzParams& params, uint32_t i, uint64_t rowFactor, uint64_t colFactor)
+{
+    return static_cast<uint64_t>(params.batch[i]) * CeilDiv(params.m[i], rowFactor) *
+           CeilDiv(params.n[i], colFactor);
+}
+
+static uint64_t CalcTotalUnitNum(const TransDataNzParams& params, uint64_t rowFactor, uint64_t colFactor)
+{
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < params.tensorNum; i++) {
+        total += CalcUnitNum(params, i, rowFactor, colFactor);
+    }
+    return total;
+}
+
+static void CalcTilingData(
+    const TransDataNzParams& params, uint32_t coreNum, uint32_t ubSize, TransDataNzTilingData& tilingData)
+{
+    uint64_t srcSize = ge::GetSizeByDataType(params.srcType);
+    uint64_t dstSize = ge::GetSizeByDataType(params.dstType);
+    uint64_t ndSize = params.toNz ? srcSize : dstSize;
+    uint64_t n0 = BYTE_BLOCK / (params.toNz ? dstSize : srcSize);
+    // 不做Cast时搬入搬出共用一块buffer，否则src/dst各一块，均开double buffer
+    uint64_t bytesPerElem = BUFFER_NUM * (params.srcType == params.dstType ? srcSize : srcSize + dstSize);
+
+    uint64_t maxM = 0;
+    uint64_t maxN1 = 0;
+    for (uint32_t i = 0; i < params.tensorNum; i++) {
+        maxM = std::max<uint64_t>(maxM, CeilAlign(params.m[i], NZ_M0));
+        maxN1 = std::max<uint64_t>(maxN1, CeilDiv(params.n[i], n0));
+    }
+    // 列块数取偶数，保证不同位宽的src/dst行在UB内都32字节对齐
+    uint64_t colBlockFactor = CeilAlign(CeilDiv(TARGET_BURST_BYTES, n0 * ndSize), MIN_COL_BLOCK_FACTOR);
+    colBlockFactor = std::max(std::min(colBlockFactor, CeilAlign(maxN1, MIN_COL_BLOCK_FACTOR)), MIN_COL_BLOCK_FACTOR);
+    uint64_t rowFactor = (ubSize - RESERVED_UB) / bytesPerElem / (colBlockFactor * n0) / NZ_M0 * NZ_M0;
+    while (rowFactor < NZ_M0 && colBlockFactor > MIN_COL_BLOCK_FACTOR) {
+        colBlockFactor -= MIN_COL_BLOCK_FACTOR;
+        rowFactor = (ubSize - RESERVED_UB) / bytesPerElem / (colBlockFactor * n0) / NZ_M0 * NZ_M0;
+    }
+    rowFactor = std::min({rowFactor, std::max(maxM, NZ_M0), MAX_ROW_FACTOR});
+    uint64_t colFactor = colBlockFactor * n0;
+    uint64_t unitNum = CalcTotalUnitNum(params, rowFactor, colFactor);
+    // 单元数不足核数时减小M方向切分，让更多核分到数据
+    while (unitNum < coreNum && rowFactor > NZ_M0) {
+        rowFactor = CeilAlign(rowFactor / BUFFER_NUM, NZ_M0);
+        unitNum = CalcTotalUnitNum(params, rowFactor, colFactor);
+    }
+
+    int64_t* batchList = tilingData.get_batchList();
+    int64_t* mList = tilingData.get_mList();
+    int64_t* nList = tilingData.get_nList();
+    int64_t* unitEndList = tilingData.get_unitEndList();
+    uint64_t unitEnd = 0;
+    for (uint32_t i = 0; i < params.tensorNum; i++) {
+        unitEnd += CalcUnitNum(params, i, rowFactor, colFactor);
+        batchList[i] = params.batch[i];
+        mList[i] = params.m[i];
+        nList[i] = params.n[i];
+        unitEndList[i] = static_cast<int64_t>(unitEnd);
+    }
+    uint64_t usedCoreNum = std::max<uint64_t>(std::min<uint64_t>(coreNum, unitNum), 1);
+
+    tilingData.set_tensorNum(params.tensorNum);
+    tilingData.set_usedCoreNum(static_cast<uint32_t>(usedCoreNum));
+    tilingData.set_rowFactor(static_cast<uint32_t>(rowFactor));
+    tilingData.set_colBlockFactor(static_cast<uint32_t>(colBlockFactor));
+    tilingData.set_unitsPerCore(unitNum / usedCoreNum);
+    tilingData.set_tailUnits(unitNum % usedCoreNum);
+}
+
+static void PrintTilingData(gert::TilingContext* context, TransDataNzTilingData& tilingData)
+{
+    const ge::char_t* nodeName = context->GetNodeName();
+    OP_LOGD(nodeName, "tensorNum: %u", tilingData.get_tensorNum());
+    OP_LOGD(nodeName, "usedCoreNum: %u", tilingData.get_usedCoreNum());
+    OP_LOGD(nodeName, "rowFactor: %u", tilingData.get_rowFactor());
+    OP_LOGD(nodeName, "colBlockFactor: %u", tilingData.get_colBlockFactor());
+    OP_LOGD(nodeName, "unitsPerCore: %lu", tilingData.get_unitsPerCore());
+    OP_LOGD(nodeName, "tailUnits: %lu", tilingData.get_tailUnits());
+    for (uint32_t i = 0; i < tilingData.get_tensorNum(); i++) {
+        OP_LOGD(
+            nodeName, "tensor %u: batch %ld, m %ld, n %ld, unitEnd %ld", i, tilingData.get_batchList()[i],
+            tilingData.get_mList()[i], tilingData.get_nList()[i], tilingData.get_unitEndList()[i]);
+    }
+}
+
+static ge::graphStatus Tiling4TransDataNz(gert::TilingContext* context)
+{
+    OP_LOGI(context->GetNodeName(), "TransDataNz tiling starts running");
+    auto compileInfo = reinterpret_cast<const TransDataNzCompileInfo*>(context->GetCompileInfo());
+    OP_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    OP_CHECK_IF(
+        compileInfo->vectorCoreNum <= 0 || compileInfo->ubByteSize <= RESERVED_UB,
+        OP_LOGE(context->GetNodeName(), "Failed to get core num or ub size."), return ge::GRAPH_FAILED);
+
+    TransDataNzParams params;
+    ge::graphStatus ret = GetInputInfo(context, params);
+    if (ret != ge::GRAPH_SUCCESS) {
+        return ret;
+    }
+
+    TransDataNzTilingData tilingData;
+    CalcTilingData(params, compileInfo->vectorCoreNum, compileInfo->ubByteSize, tilingData);
+    OP_CHECK_IF(
+        tilingData.get_rowFactor() == 0, OP_LOGE(context->GetNodeName(), "ub space is not enough, please check input."),
+        return ge::GRAPH_FAILED);
+
+    context->SetTilingKey(params.toNz ? ND_TO_NZ_TILING_KEY : NZ_TO_ND_TILING_KEY);
+    context->SetBlockDim(tilingData.get_usedCoreNum());
+    size_t* workspaces = context->GetWorkspaceSizes(1);
+    workspaces[0] = compileInfo->sysWorkspaceByteSize;
+    tilingData.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tilingData.GetDataSize());
+    PrintTilingData(context, tilingData);
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus TilingPrepare4TransDataNz(gert::TilingParseContext* context)
+{
+    auto compileInfo = context->GetCompiledInfo<TransDataNzCompileInfo>();
+    OP_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    auto platformInfo = context->GetPlatformInfo();
+    OP_CHECK_NULL_WITH_CONTEXT(context, platformInfo);
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(platformInfo);
+    compileInfo->vectorCoreNum = ascendcPlatform.GetCoreNumAiv();
+    OP_CHECK_IF(
+        (compileInfo->vectorCoreNum <= 0), OP_LOGE(context->GetNodeName(), "No vector core available."),
+        return ge::GRAPH_FAILED);
+    uint64_t ubByteSize;
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ubByteSize);
+    compileInfo->ubByteSize = ubByteSize;
+    OP_CHECK_IF(
+        (compileInfo->ubByteSize <= 0), OP_LOGE(context->GetNodeName(), "Failed to get ub size."),
+        return ge::GRAPH_FAILED);
+    compileInfo->sysWorkspaceByteSize = ascendcPlatform.GetLibApiWorkSpaceSize();
+    return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_OPTILING(TransDataNz)
+    .Tiling(Tiling4TransDataNz)
+    .TilingParse<TransDataNzCompileInfo>(TilingPrepare4TransDataNz);
+} // namespace optiling
@@ -0,0 +1,45 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+
+/*!
+ * \file trans_data_nz_tiling.h
+ * \brief
+ */
+#ifndef OPS_BUILT_IN_OP_TILING_RUNTIME_TRANS_DATA_NZ_H_
+#define OPS_BUILT_IN_OP_TILING_RUNTIME_TRANS_DATA_NZ_H_
+
+#include "register/tilingdata_base.h"
+
+namespace optiling {
+constexpr uint32_t TRANS_DATA_NZ_MAX_TENSOR_NUM = 64; // 单次下发支持的最大tensor个数
+
+BEGIN_TILING_DATA_DEF(TransDataNzTilingData)
+TILING_DATA_FIELD_DEF(uint32_t, tensorNum);
+TILING_DATA_FIELD_DEF(uint32_t, usedCoreNum);
+TILING_DATA_FIELD_DEF(uint32_t, rowFactor);      // 每个单元处理的M方向行数，16对齐
+TILING_DATA_FIELD_DEF(uint32_t, colBlockFactor); // 每个单元处理的N方向分形列块数(每块n0列)
+TILING_DATA_FIELD_DEF(uint64_t, unitsPerCore);   // 每核处理的(batch, M块, N块)单元数
+TILING_DATA_FIELD_DEF(uint64_t, tailUnits);      // 前tailUnits个核多处理一个单元
+TILING_DATA_FIELD_DEF_ARR(int64_t, TRANS_DATA_NZ_MAX_TENSOR_NUM, batchList); // ND shape除最后两维外的乘积
+TILING_DATA_FIELD_DEF_ARR(int64_t, TRANS_DATA_NZ_MAX_TENSOR_NUM, mList);
+TILING_DATA_FIELD_DEF_ARR(int64_t, TRANS_DATA_NZ_MAX_TENSOR_NUM, nList);
+TILING_DATA_FIELD_DEF_ARR(int64_t, TRANS_DATA_NZ_MAX_TENSOR_NUM, unitEndList); // 各tensor单元数的前缀和
+END_TILING_DATA_DEF;
+REGISTER_TILING_DATA_CLASS(TransDataNz, TransDataNzTilingData)
+
+struct TransDataNzCompileInfo {
+    uint32_t vectorCoreNum;
+    uint32_t sysWorkspaceByteSize;
+    uint32_t ubByteSize;
+};
+} // namespace optiling
+#endif // OPS_BUILT_IN_OP_TILING_RUNTIME_TRANS_DATA_NZ_H_
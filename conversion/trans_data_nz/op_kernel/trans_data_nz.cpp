@@ -0,0 +1,36 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+
+/*!
+ * \file trans_data_nz.cpp
+ * \brief
+ */
+
+#include "kernel_operator.h"
+#include "trans_data_nz.h"
+
+using namespace TransDataNz;
+
+extern "C" __global__ __aicore__ void trans_data_nz(GM_ADDR x, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling)
+{
+    GET_TILING_DATA(tilingData, tiling);
+    // tiling key: 1为ND->FRACTAL_NZ，2为FRACTAL_NZ->ND；x/y的数据类型由编译宏区分
+    if (TILING_KEY_IS(1)) {
+        TransDataNzND<DTYPE_X, DTYPE_Y, true> op;
+        op.Init(x, y, &tilingData);
+        op.Process();
+    } else if (TILING_KEY_IS(2)) {
+        TransDataNzND<DTYPE_X, DTYPE_Y, false> op;
+        op.Init(x, y, &tilingData);
+        op.Process();
+    }
+}
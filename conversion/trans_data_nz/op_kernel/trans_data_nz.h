@@ -0,0 +1,304 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+
+/*!
+ * \file trans_data_nz.h
+ * \brief ND与FRACTAL_NZ互转，可融合Cast，一次下发处理tensor列表
+ *
+ * ND [..., M, N]对应的NZ为[..., N1, M1, 16, n0]，n0 = 32B / sizeof(NZ侧类型)。
+ * 每个处理单元为某个tensor的(batch, M方向rowFactor行, N方向colBlockFactor个n0列块)，
+ * 所有tensor的单元按前缀和连续编号后均分给各核。ND侧按行整段搬运，NZ侧每个列块
+ * 是rowFactor个连续的32B分形行，用带stride的DataCopy完成UB内行主序与分形序的转换。
+ */
+#ifndef TRANS_DATA_NZ_H
+#define TRANS_DATA_NZ_H
+
+#include "kernel_operator.h"
+#ifdef __CCE_KT_TEST__
+#include "../../../common/inc/op_kernel/multi_tensor_apply.h"
+#else
+#include "../common/multi_tensor_apply.h"
+#endif
+
+namespace TransDataNz {
+using namespace AscendC;
+
+constexpr int32_t BUFFER_NUM = 2;
+constexpr uint32_t BYTE_BLOCK = 32;
+constexpr uint32_t NZ_M0 = 16;
+
+template <typename TX, typename TY, bool TO_NZ>
+class TransDataNzND {
+public:
+    __aicore__ inline TransDataNzND(){};
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR y, const TransDataNzTilingData* __restrict tilingData);
+    __aicore__ inline void Process();
+
+private:
+    __aicore__ inline void LocateTensor(uint64_t unit);
+    __aicore__ inline void ProcessUnit(uint64_t unit);
+    __aicore__ inline LocalTensor<TX> CopyInNd(uint64_t batch, uint64_t rowStart, uint64_t colStart);
+    __aicore__ inline LocalTensor<TX> CopyInNz(uint64_t batch, uint64_t rowStart, uint64_t colBlockStart);
+    __aicore__ inline LocalTensor<TY> CastTile(LocalTensor<TX>& xLocal, uint32_t count);
+    __aicore__ inline void CopyOutNz(LocalTensor<TY>& yLocal, uint64_t batch, uint64_t rowStart,
+                                     uint64_t colBlockStart);
+    __aicore__ inline void CopyOutNd(LocalTensor<TY>& yLocal, uint64_t batch, uint64_t rowStart, uint64_t colStart);
+    __aicore__ inline void FreeTile(LocalTensor<TY>& yLocal);
+    __aicore__ inline LocalTensor<TX> AllocIn();
+    __aicore__ inline LocalTensor<TX> EnDeQueIn(LocalTensor<TX>& xLocal);
+
+    template <typename T1>
+    __aicore__ inline T1 CeilDiv(T1 a, T1 b)
+    {
+        return b == 0 ? a : (a + b - 1) / b;
+    }
+
+    template <typename T1>
+    __aicore__ inline T1 CeilAlign(T1 a, T1 b)
+    {
+        return CeilDiv(a, b) * b;
+    }
+
+private:
+    static constexpr bool NEED_CAST = !IsSameType<TX, TY>::value;
+    // NZ侧类型决定分形列数n0
+    static constexpr uint32_t N0 = BYTE_BLOCK / (TO_NZ ? sizeof(TY) : sizeof(TX));
+    static constexpr RoundMode CAST_MODE = sizeof(TY) < sizeof(TX) ? RoundMode::CAST_RINT : RoundMode::CAST_NONE;
+
+    TPipe pipe;
+    TQueBind<QuePosition::VECIN, QuePosition::VECOUT, BUFFER_NUM> bindQueue;
+    TQue<QuePosition::VECIN, BUFFER_NUM> inQueue;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> outQueue;
+    GlobalTensor<TX> xGm;
+    GlobalTensor<TY> yGm;
+    GM_ADDR xList = nullptr;
+    GM_ADDR yList = nullptr;
+    const TransDataNzTilingData* tiling = nullptr;
+
+    uint64_t unitStart = 0;
+    uint64_t unitNum = 0;
+    uint32_t rowFactor = 0;
+    uint32_t colBlockFactor = 0;
+    uint32_t colFactor = 0;
+
+    // 当前处理的tensor
+    int32_t tensorIdx = -1;
+    uint64_t tensorUnitStart = 0;
+    uint64_t m = 0;
+    uint64_t n = 0;
+    uint64_t m1 = 0;
+    uint64_t n1 = 0;
+    uint64_t rowBlocks = 0;
+    uint64_t colBlocks = 0;
+
+    // 当前处理的单元
+    uint32_t rowsValid = 0;
+    uint32_t rowsAligned = 0;
+    uint32_t colsValid = 0;
+    uint32_t colBlocksValid = 0;
+};
+
+template <typename TX, typename TY, bool TO_NZ>
+__aicore__ inline void TransDataNzND<TX, TY, TO_NZ>::Init(
+    GM_ADDR x, GM_ADDR y, const TransDataNzTilingData* __restrict tilingData)
+{
+    uint64_t blockIdx = GetBlockIdx();
+    uint64_t unitsPerCore = tilingData->unitsPerCore;
+    uint64_t tailUnits = tilingData->tailUnits;
+    unitNum = unitsPerCore + (blockIdx < tailUnits ? 1 : 0);
+    unitStart = blockIdx * unitsPerCore + (blockIdx < tailUnits ? blockIdx : tailUnits);
+    rowFactor = tilingData->rowFactor;
+    colBlockFactor = tilingData->colBlockFactor;
+    colFactor = colBlockFactor * N0;
+    xList = x;
+    yList = y;
+    tiling = tilingData;
+
+    uint32_t tileSize = rowFactor * colFactor;
+    if constexpr (NEED_CAST) {
+        pipe.InitBuffer(inQueue, BUFFER_NUM, tileSize * sizeof(TX));
+        pipe.InitBuffer(outQueue, BUFFER_NUM, tileSize * sizeof(TY));
+    } else {
+        pipe.InitBuffer(bindQueue, BUFFER_NUM, tileSize * sizeof(TX));
+    }
+}
+
+template <typename TX, typename TY, bool TO_NZ>
+__aicore__ inline void TransDataNzND<TX, TY, TO_NZ>::Process()
+{
+    for (uint64_t unit = unitStart; unit < unitStart + unitNum; unit++) {
+        LocateTensor(unit);
+        ProcessUnit(unit - tensorUnitStart);
+    }
+}
+
+template <typename TX, typename TY, bool TO_NZ>
+__aicore__ inline void TransDataNzND<TX, TY, TO_NZ>::LocateTensor(uint64_t unit)
+{
+    if (tensorIdx >= 0 && unit < static_cast<uint64_t>(tiling->unitEndList[tensorIdx])) {
+        return;
+    }
+    // 单元数为0的空tensor被直接跳过
+    do {
+        tensorIdx++;
+    } while (unit >= static_cast<uint64_t>(tiling->unitEndList[tensorIdx]));
+    tensorUnitStart = tensorIdx == 0 ? 0 : static_cast<uint64_t>(tiling->unitEndList[tensorIdx - 1]);
+    m = tiling->mList[tensorIdx];
+    n = tiling->nList[tensorIdx];
+    m1 = CeilDiv<uint64_t>(m, NZ_M0);
+    n1 = CeilDiv<uint64_t>(n, N0);
+    rowBlocks = CeilDiv<uint64_t>(m, rowFactor);
+    colBlocks = CeilDiv<uint64_t>(n, colFactor);
+    xGm.SetGlobalBuffer(MultiTensorApply::GetTensorAddr<TX>(xList, tensorIdx));
+    yGm.SetGlobalBuffer(MultiTensorApply::GetTensorAddr<TY>(yList, tensorIdx));
+}
+
+template <typename TX, typename TY, bool TO_NZ>
+__aicore__ inline void TransDataNzND<TX, TY, TO_NZ>::ProcessUnit(uint64_t unit)
+{
+    uint64_t colIdx = unit % colBlocks;
+    uint64_t rowIdx = (unit / colBlocks) % rowBlocks;
+    uint64_t batch = unit / colBlocks / rowBlocks;
+    uint64_t rowStart = rowIdx * rowFactor;
+    uint64_t colStart = colIdx * colFactor;
+    rowsValid = static_cast<uint32_t>(rowStart + rowFactor > m ? m - rowStart : rowFactor);
+    rowsAligned = CeilAlign<uint32_t>(rowsValid, NZ_M0);
+    colsValid = static_cast<uint32_t>(colStart + colFactor > n ? n - colStart : colFactor);
+    colBlocksValid = CeilDiv<uint32_t>(colsValid, N0);
+
+    if constexpr (TO_NZ) {
+        LocalTensor<TX> xLocal = CopyInNd(batch, rowStart, colStart);
+        // M方向尾部补齐到16行的pad行也需写出
+        LocalTensor<TY> yLocal = CastTile(xLocal, rowsAligned * colFactor);
+        CopyOutNz(yLocal, batch, rowStart, colIdx * colBlockFactor);
+        FreeTile(yLocal);
+    } else {
+        LocalTensor<TX> xLocal = CopyInNz(batch, rowStart, colIdx * colBlockFactor);
+        LocalTensor<TY> yLocal = CastTile(xLocal, rowsValid * colFactor);
+        CopyOutNd(yLocal, batch, rowStart, colStart);
+        FreeTile(yLocal);
+    }
+}
+
+template <typename TX, typename TY, bool TO_NZ>
+__aicore__ inline LocalTensor<TX> TransDataNzND<TX, TY, TO_NZ>::CopyInNd(
+    uint64_t batch, uint64_t rowStart, uint64_t colStart)
+{
+    LocalTensor<TX> xLocal = AllocIn();
+    uint32_t rowBytes = colsValid * sizeof(TX);
+    uint32_t rowBytesAligned = CeilAlign<uint32_t>(rowBytes, BYTE_BLOCK);
+    // 写出的分形中超出ND范围的行/列必须为0；DataCopyPad只补齐到32B，其余部分提前清零
+    if (rowsValid < rowsAligned || rowBytesAligned < colBlocksValid * N0 * sizeof(TX)) {
+        event_t eventMte3V = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::MTE3_V));
+        SetFlag<HardEvent::MTE3_V>(eventMte3V);
+        WaitFlag<HardEvent::MTE3_V>(eventMte3V);
+        Duplicate(xLocal.template ReinterpretCast<uint16_t>(), static_cast<uint16_t>(0),
+                  rowsAligned * colFactor * sizeof(TX) / sizeof(uint16_t));
+        event_t eventVMte2 = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::V_MTE2));
+        SetFlag<HardEvent::V_MTE2>(eventVMte2);
+        WaitFlag<HardEvent::V_MTE2>(eventVMte2);
+    }
+    DataCopyExtParams copyParams{
+        static_cast<uint16_t>(rowsValid), rowBytes, static_cast<uint32_t>((n - colsValid) * sizeof(TX)),
+        static_cast<uint32_t>((colFactor * sizeof(TX) - rowBytesAligned) / BYTE_BLOCK), 0};
+    DataCopyPadExtParams<TX> padParams{
+        true, 0, static_cast<uint8_t>((rowBytesAligned - rowBytes) / sizeof(TX)), static_cast<TX>(0)};
+    DataCopyPad(xLocal, xGm[(batch * m + rowStart) * n + colStart], copyParams, padParams);
+    return EnDeQueIn(xLocal);
+}
+
+template <typename TX, typename TY, bool TO_NZ>
+__aicore__ inline LocalTensor<TX> TransDataNzND<TX, TY, TO_NZ>::CopyInNz(
+    uint64_t batch, uint64_t rowStart, uint64_t colBlockStart)
+{
+    LocalTensor<TX> xLocal = AllocIn();
+    // 每个列块为rowsValid个连续的32B分形行，散写到UB中各行的第j个32B
+    DataCopyParams copyParams{static_cast<uint16_t>(rowsValid), 1, 0, static_cast<uint16_t>(colBlockFactor - 1)};
+    for (uint32_t j = 0; j < colBlocksValid; j++) {
+        uint64_t srcOffset = ((batch * n1 + colBlockStart + j) * m1 * NZ_M0 + rowStart) * N0;
+        DataCopy(xLocal[j * N0], xGm[srcOffset], copyParams);
+    }
+    return EnDeQueIn(xLocal);
+}
+
+template <typename TX, typename TY, bool TO_NZ>
+__aicore__ inline LocalTensor<TY> TransDataNzND<TX, TY, TO_NZ>::CastTile(LocalTensor<TX>& xLocal, uint32_t count)
+{
+    if constexpr (NEED_CAST) {
+        LocalTensor<TY> yLocal = outQueue.AllocTensor<TY>();
+        Cast(yLocal, xLocal, CAST_MODE, count);
+        inQueue.FreeTensor(xLocal);
+        outQueue.EnQue(yLocal);
+        return outQueue.DeQue<TY>();
+    } else {
+        return xLocal;
+    }
+}
+
+template <typename TX, typename TY, bool TO_NZ>
+__aicore__ inline void TransDataNzND<TX, TY, TO_NZ>::CopyOutNz(
+    LocalTensor<TY>& yLocal, uint64_t batch, uint64_t rowStart, uint64_t colBlockStart)
+{
+    // UB中各行的第j个32B依次写成NZ中第j个列块的rowsAligned个连续分形行
+    DataCopyParams copyParams{static_cast<uint16_t>(rowsAligned), 1, static_cast<uint16_t>(colBlockFactor - 1), 0};
+    for (uint32_t j = 0; j < colBlocksValid; j++) {
+        uint64_t dstOffset = ((batch * n1 + colBlockStart + j) * m1 * NZ_M0 + rowStart) * N0;
+        DataCopy(yGm[dstOffset], yLocal[j * N0], copyParams);
+    }
+}
+
+template <typename TX, typename TY, bool TO_NZ>
+__aicore__ inline void TransDataNzND<TX, TY, TO_NZ>::CopyOutNd(
+    LocalTensor<TY>& yLocal, uint64_t batch, uint64_t rowStart, uint64_t colStart)
+{
+    uint32_t rowBytes = colsValid * sizeof(TY);
+    DataCopyExtParams copyParams{
+        static_cast<uint16_t>(rowsValid), rowBytes,
+        static_cast<uint32_t>((colFactor * sizeof(TY) - CeilAlign<uint32_t>(rowBytes, BYTE_BLOCK)) / BYTE_BLOCK),
+        static_cast<uint32_t>((n - colsValid) * sizeof(TY)), 0};
+    DataCopyPad(yGm[(batch * m + rowStart) * n + colStart], yLocal, copyParams);
+}
+
+template <typename TX, typename TY, bool TO_NZ>
+__aicore__ inline void TransDataNzND<TX, TY, TO_NZ>::FreeTile(LocalTensor<TY>& yLocal)
+{
+    if constexpr (NEED_CAST) {
+        outQueue.FreeTensor(yLocal);
+    } else {
+        bindQueue.FreeTensor(yLocal);
+    }
+}
+
+template <typename TX, typename TY, bool TO_NZ>
+__aicore__ inline LocalTensor<TX> TransDataNzND<TX, TY, TO_NZ>::AllocIn()
+{
+    // 不做Cast时搬入搬出共用同一块buffer
+    if constexpr (NEED_CAST) {
+        return inQueue.AllocTensor<TX>();
+    } else {
+        return bindQueue.AllocTensor<TX>();
+    }
+}
+
+template <typename TX, typename TY, bool TO_NZ>
+__aicore__ inline LocalTensor<TX> TransDataNzND<TX, TY, TO_NZ>::EnDeQueIn(LocalTensor<TX>& xLocal)
+{
+    if constexpr (NEED_CAST) {
+        inQueue.EnQue(xLocal);
+        return inQueue.DeQue<TX>();
+    } else {
+        bindQueue.EnQue(xLocal);
+        return bindQueue.DeQue<TX>();
+    }
+}
+} // namespace TransDataNz
+#endif // TRANS_DATA_NZ_H
@@ -0,0 +1,161 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+
+/*!
+ * \file test_trans_data_nz_tiling.cpp
+ * \brief
+ */
+
+#include <iostream>
+#include <gtest/gtest.h>
+#include "../../../op_host/trans_data_nz_tiling.h"
+#include "tiling_context_faker.h"
+#include "tiling_case_executor.h"
+
+class TransDataNzTiling : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        std::cout << "TransDataNzTiling SetUp" << std::endl;
+    }
+    static void TearDownTestCase()
+    {
+        std::cout << "TransDataNzTiling TearDown" << std::endl;
+    }
+};
+
+// 多个权重一次下发，单元按tensor前缀和连续编号
+TEST_F(TransDataNzTiling, trans_data_nz_tiling_nd_to_nz_float16_list)
+{
+    optiling::TransDataNzCompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "TransDataNz",
+        {
+            {{{1024, 4096}, {1024, 4096}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{3, 100, 200}, {3, 100, 200}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{17, 33}, {17, 33}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+        },
+        {
+            {{{1024, 4096}, {256, 64, 16, 16}}, ge::DT_FLOAT16, ge::FORMAT_FRACTAL_NZ},
+            {{{3, 100, 200}, {3, 13, 7, 16, 16}}, ge::DT_FLOAT16, ge::FORMAT_FRACTAL_NZ},
+            {{{17, 33}, {3, 2, 16, 16}}, ge::DT_FLOAT16, ge::FORMAT_FRACTAL_NZ},
+        },
+        {gert::TilingContextPara::OpAttr("src_format", Ops::Math::AnyValue::CreateFrom<std::string>("ND")),
+         gert::TilingContextPara::OpAttr("dst_format", Ops::Math::AnyValue::CreateFrom<std::string>("FRACTAL_NZ")),
+         gert::TilingContextPara::OpAttr("dst_type", Ops::Math::AnyValue::CreateFrom<int64_t>(-1))},
+        {3}, {3}, &compileInfo);
+    uint64_t expectTilingKey = 1;
+    std::string expectTilingData =
+        "274877906947 68719476912 1 36 1 3 1 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1024 100 17 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 4096 200 33 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 96 99 100 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+// fp32权重在搬运中Cast为bf16，n0按NZ侧的bf16取16
+TEST_F(TransDataNzTiling, trans_data_nz_tiling_nd_to_nz_float_cast_bfloat16)
+{
+    optiling::TransDataNzCompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "TransDataNz",
+        {
+            {{{4096, 11008}, {4096, 11008}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{5, 300}, {5, 300}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{4096, 11008}, {688, 256, 16, 16}}, ge::DT_BF16, ge::FORMAT_FRACTAL_NZ},
+            {{{5, 300}, {19, 1, 16, 16}}, ge::DT_BF16, ge::FORMAT_FRACTAL_NZ},
+        },
+        {gert::TilingContextPara::OpAttr("src_format", Ops::Math::AnyValue::CreateFrom<std::string>("ND")),
+         gert::TilingContextPara::OpAttr("dst_format", Ops::Math::AnyValue::CreateFrom<std::string>("FRACTAL_NZ")),
+         gert::TilingContextPara::OpAttr("dst_type", Ops::Math::AnyValue::CreateFrom<int64_t>(27))},
+        {2}, {2}, &compileInfo);
+    uint64_t expectTilingKey = 1;
+    std::string expectTilingData =
+        "274877906946 34359738480 49 49 1 1 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 4096 5 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 11008 300 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 3182 3185 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+// 单元数不足核数时M方向切分减小到16行
+TEST_F(TransDataNzTiling, trans_data_nz_tiling_nz_to_nd_int8)
+{
+    optiling::TransDataNzCompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "TransDataNz",
+        {
+            {{{2, 64, 96}, {2, 3, 4, 16, 32}}, ge::DT_INT8, ge::FORMAT_FRACTAL_NZ},
+            {{{1000, 7}, {1, 63, 16, 32}}, ge::DT_INT8, ge::FORMAT_FRACTAL_NZ},
+        },
+        {
+            {{{2, 64, 96}, {2, 64, 96}}, ge::DT_INT8, ge::FORMAT_ND},
+            {{{1000, 7}, {1000, 7}}, ge::DT_INT8, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("src_format", Ops::Math::AnyValue::CreateFrom<std::string>("FRACTAL_NZ")),
+         gert::TilingContextPara::OpAttr("dst_format", Ops::Math::AnyValue::CreateFrom<std::string>("ND")),
+         gert::TilingContextPara::OpAttr("dst_type", Ops::Math::AnyValue::CreateFrom<int64_t>(-1))},
+        {2}, {2}, &compileInfo);
+    uint64_t expectTilingKey = 2;
+    std::string expectTilingData =
+        "274877906946 17179869200 1 7 2 1 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 64 1000 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 96 7 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 8 71 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(TransDataNzTiling, trans_data_nz_tiling_nz_shape_mismatch)
+{
+    optiling::TransDataNzCompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "TransDataNz",
+        {
+            {{{100, 200}, {100, 200}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+        },
+        {
+            {{{100, 200}, {13, 8, 16, 16}}, ge::DT_FLOAT16, ge::FORMAT_FRACTAL_NZ},
+        },
+        {gert::TilingContextPara::OpAttr("src_format", Ops::Math::AnyValue::CreateFrom<std::string>("ND")),
+         gert::TilingContextPara::OpAttr("dst_format", Ops::Math::AnyValue::CreateFrom<std::string>("FRACTAL_NZ")),
+         gert::TilingContextPara::OpAttr("dst_type", Ops::Math::AnyValue::CreateFrom<int64_t>(-1))},
+        {1}, {1}, &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
+
+TEST_F(TransDataNzTiling, trans_data_nz_tiling_unsupported_dtype_pair)
+{
+    optiling::TransDataNzCompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "TransDataNz",
+        {
+            {{{64, 64}, {64, 64}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+        },
+        {
+            {{{64, 64}, {4, 4, 16, 16}}, ge::DT_BF16, ge::FORMAT_FRACTAL_NZ},
+        },
+        {gert::TilingContextPara::OpAttr("src_format", Ops::Math::AnyValue::CreateFrom<std::string>("ND")),
+         gert::TilingContextPara::OpAttr("dst_format", Ops::Math::AnyValue::CreateFrom<std::string>("FRACTAL_NZ")),
+         gert::TilingContextPara::OpAttr("dst_type", Ops::Math::AnyValue::CreateFrom<int64_t>(27))},
+        {1}, {1}, &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
@@ -0,0 +1,83 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+
+/*!
+ * \file tensor_list_operate.h
+ * \brief
+ */
+#ifndef TENSOR_LIST_OPERATE_H
+#define TENSOR_LIST_OPERATE_H
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "data_utils.h"
+
+namespace TransDataNzTest {
+
+template <typename T1, typename T2>
+inline T1 CeilA2B(T1 a, T2 b)
+{
+    return (a + b - 1) / b;
+}
+
+template <typename T>
+uint8_t* CreateTensorList(const std::vector<std::vector<uint64_t>>& shapeInfos)
+{
+    uint64_t tensorListDescCount = 1 + shapeInfos.size() * 2;
+    for (auto s : shapeInfos) {
+        tensorListDescCount += s.size();
+    }
+    std::vector<uint64_t> shapeSizeList;
+    uint64_t* tensorListDesc = (uint64_t*)AscendC::GmAlloc(tensorListDescCount * sizeof(uint64_t));
+    *tensorListDesc = (tensorListDescCount - shapeInfos.size()) * sizeof(uint64_t);
+    uint64_t addrIndex = 0;
+    for (size_t i = 0; i < shapeInfos.size(); i++) {
+        addrIndex++;
+        uint16_t dimCount = shapeInfos[i].size();
+        *(tensorListDesc + addrIndex) = ((uint64_t)(i) << 32) + dimCount;
+        uint64_t shapeSize = 1;
+        for (size_t j = 0; j < dimCount; j++) {
+            addrIndex++;
+            *(tensorListDesc + addrIndex) = shapeInfos[i][j];
+            shapeSize *= shapeInfos[i][j];
+        }
+        shapeSizeList.push_back(shapeSize);
+    }
+    for (size_t i = 0; i < shapeInfos.size(); i++) {
+        addrIndex++;
+        uint64_t dataSize = shapeSizeList[i] * sizeof(T);
+        uint8_t* dataPtr = (uint8_t*)AscendC::GmAlloc(CeilA2B(dataSize, 32) * 32);
+        *(tensorListDesc + addrIndex) = (uint64_t)dataPtr;
+    }
+    return (uint8_t*)tensorListDesc;
+}
+
+template <typename T>
+T* GetTensorData(uint8_t* addr, size_t index)
+{
+    uint64_t dataPtrOffset = *((uint64_t*)addr);
+    uint8_t* dataAddr = addr + dataPtrOffset;
+    return (T*)(*((uint64_t*)(dataAddr) + index));
+}
+
+template <typename T>
+void FreeTensorList(uint8_t* addr, const std::vector<std::vector<uint64_t>>& shapeInfos)
+{
+    for (size_t i = 0; i < shapeInfos.size(); i++) {
+        AscendC::GmFree((void*)(GetTensorData<T>(addr, i)));
+    }
+    AscendC::GmFree((void*)addr);
+}
+
+} // namespace TransDataNzTest
+#endif // TENSOR_LIST_OPERATE_H
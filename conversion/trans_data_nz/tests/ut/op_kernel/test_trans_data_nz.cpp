@@ -0,0 +1,101 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+
+/*!
+ * \file test_trans_data_nz.cpp
+ * \brief
+ */
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include "gtest/gtest.h"
+#include "tikicpulib.h"
+#include "data_utils.h"
+#include "tensor_list_operate.h"
+
+using namespace std;
+using namespace TransDataNzTest;
+
+extern "C" __global__ __aicore__ void trans_data_nz(GM_ADDR x, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling);
+
+class trans_data_nz_test : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        cout << "trans_data_nz_test SetUp\n" << endl;
+    }
+    static void TearDownTestCase()
+    {
+        cout << "trans_data_nz_test TearDown\n" << endl;
+    }
+};
+
+TEST_F(trans_data_nz_test, test_nd_to_nz_float16_list)
+{
+    // x: [20, 40], [2, 16, 32] -> y: [3, 2, 16, 16], [2, 2, 1, 16, 16]，每核处理16行x64列的一个单元
+    std::vector<std::vector<uint64_t>> xShapes = {{20, 40}, {2, 16, 32}};
+    std::vector<std::vector<uint64_t>> yShapes = {{3, 2, 16, 16}, {2, 2, 1, 16, 16}};
+    uint32_t blockDim = 4;
+    uint8_t* x = CreateTensorList<half>(xShapes);
+    uint8_t* y = CreateTensorList<half>(yShapes);
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(16 * 1024 * 1024);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(sizeof(TransDataNzTilingData));
+
+    half* x0 = GetTensorData<half>(x, 0);
+    for (size_t i = 0; i < 20 * 40; i++) {
+        x0[i] = static_cast<half>(i);
+    }
+    half* x1 = GetTensorData<half>(x, 1);
+    for (size_t i = 0; i < 2 * 16 * 32; i++) {
+        x1[i] = static_cast<half>(i);
+    }
+    half* y0 = GetTensorData<half>(y, 0);
+    for (size_t i = 0; i < 3 * 2 * 16 * 16; i++) {
+        y0[i] = static_cast<half>(-1);
+    }
+
+    TransDataNzTilingData* tilingData = reinterpret_cast<TransDataNzTilingData*>(tiling);
+    tilingData->tensorNum = 2;
+    tilingData->usedCoreNum = blockDim;
+    tilingData->rowFactor = 16;
+    tilingData->colBlockFactor = 4;
+    tilingData->unitsPerCore = 1;
+    tilingData->tailUnits = 0;
+    int64_t batchList[2] = {1, 2};
+    int64_t mList[2] = {20, 16};
+    int64_t nList[2] = {40, 32};
+    int64_t unitEndList[2] = {2, 4};
+    for (int32_t i = 0; i < 2; i++) {
+        tilingData->batchList[i] = batchList[i];
+        tilingData->mList[i] = mList[i];
+        tilingData->nList[i] = nList[i];
+        tilingData->unitEndList[i] = unitEndList[i];
+    }
+
+    ICPU_SET_TILING_KEY(1);
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_RUN_KF(trans_data_nz, blockDim, x, y, workspace, (uint8_t*)(tilingData));
+
+    // (m, n)位于NZ的((n / 16) * M1 * 16 + m) * 16 + n % 16
+    EXPECT_FLOAT_EQ(static_cast<float>(y0[((2 * 2 * 16) + 17) * 16 + 3]), 17.0f * 40 + 35);
+    EXPECT_FLOAT_EQ(static_cast<float>(y0[3]), 3.0f);
+    // M方向补齐的行与N方向补齐的列填0
+    EXPECT_FLOAT_EQ(static_cast<float>(y0[25 * 16]), 0.0f);
+    EXPECT_FLOAT_EQ(static_cast<float>(y0[((2 * 2 * 16) + 18) * 16 + 13]), 0.0f);
+    half* y1 = GetTensorData<half>(y, 1);
+    EXPECT_FLOAT_EQ(static_cast<float>(y1[((1 * 2 + 1) * 16 + 5) * 16 + 4]), 512.0f + 5 * 32 + 20);
+
+    FreeTensorList<half>(x, xShapes);
+    FreeTensorList<half>(y, yShapes);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+}
@@ -14,6 +14,8 @@
  * \brief
  */
 
+#include <cstdio>
+#include <cstdlib>
 #include <iostream>
 #include <fstream>
 #include <vector>
@@ -96,4 +98,44 @@ TEST_F(TransposeV2Tiling, transpose_v2_float16_0213_success_case)
     string expectTilingData = "1 32 64 64 0 32 1 1 512 2 0 0 0 0 0 0 0 0 0 ";
     std::vector<size_t> expectWorkspaces = {16777216};
     ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
-}
\ No newline at end of file
+}
+
+// 语料回放：只回放本算子的合法行，注释、其他算子、非法JSON与不支持的dtype均跳过，且每条回放都记录覆盖信息
+TEST_F(TransposeV2Tiling, transpose_v2_replay_tiling_corpus)
+{
+    const string corpusFile = "transpose_v2_tiling_corpus.jsonl";
+    const string coverageFile = "transpose_v2_tiling_coverage.jsonl";
+    std::remove(coverageFile.c_str());
+    {
+        std::ofstream corpus(corpusFile);
+        corpus << "# transpose_v2 corpus" << std::endl;
+        corpus << R"({"op": "TransposeV2", "inputs": [{"shape": [1, 30, 68], "dtype": "float16"}, )"
+               << R"({"shape": [3], "dtype": "int64", "value": [0, 2, 1]}], )"
+               << R"("outputs": [{"shape": [1, 68, 30], "dtype": "float16"}]})" << std::endl;
+        corpus << R"({"op": "TransposeV2", "inputs": [{"shape": [1, 30, 64], "dtype": "float16"}, )"
+               << R"({"shape": [3], "dtype": "int64", "value": [1, 0, 2]}], )"
+               << R"("outputs": [{"shape": [30, 1, 64], "dtype": "float16"}]})" << std::endl;
+        corpus << R"({"op": "Add", "inputs": [{"shape": [8], "dtype": "float16"}]})" << std::endl;
+        corpus << R"({"op": "TransposeV2", "inputs": [{"shape": [8], "dtype": "string"}]})" << std::endl;
+        corpus << "not a json line" << std::endl;
+    }
+
+    setenv("TILING_COVERAGE_FILE", coverageFile.c_str(), 1);
+    optiling::Tiling4TransposeV2CompileInfo compileInfo = {48, 196608, 16777216};
+    size_t successCount = ReplayTilingCorpus(corpusFile, "TransposeV2", &compileInfo);
+    unsetenv("TILING_COVERAGE_FILE");
+    EXPECT_EQ(successCount, 2);
+
+    std::ifstream coverage(coverageFile);
+    std::vector<string> records;
+    for (string line; std::getline(coverage, line);) {
+        records.push_back(line);
+    }
+    ASSERT_EQ(records.size(), 2);
+    EXPECT_NE(records[0].find(R"("tiling_key":20)"), string::npos);
+    EXPECT_NE(records[1].find(R"("tiling_key":121)"), string::npos);
+    EXPECT_NE(records[0].find(R"("op":"TransposeV2")"), string::npos);
+
+    std::remove(corpusFile.c_str());
+    std::remove(coverageFile.c_str());
+}
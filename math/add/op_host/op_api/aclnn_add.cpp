@@ -19,6 +19,8 @@
 #include "math/logical_and/op_host/op_api/logical_and.h"
 #include "math/logical_or/op_host/op_api/logical_or.h"
 #include "aclnn_kernels/common/op_error_check.h"
+#include "common/level2_elementwise_dispatch.h"
+#include "common/level2_executor_cache.h"
 #include "opdev/common_types.h"
 #include "opdev/data_type_utils.h"
 #include "opdev/format_utils.h"
@@ -317,6 +319,16 @@ aclnnStatus aclnnAddGetWorkspaceSize(
     aclOpExecutor** executor)
 {
     L2_DFX_PHASE_1(aclnnAdd, DFX_IN(self, other, alpha), DFX_OUT(out));
+    // 相同签名的重复调用直接复用已构图的执行器，仅刷新tensor地址
+    bool useCache = ExecutorCache::IsEnabled() && self != nullptr && other != nullptr && alpha != nullptr &&
+                    out != nullptr && workspaceSize != nullptr && executor != nullptr;
+    ExecutorSignature signature("aclnnAdd");
+    if (useCache) {
+        signature.Append(self).Append(other).Append(alpha).Append(out);
+        if (ExecutorCache::GetInstance().Lookup(signature, {self, other}, {out}, workspaceSize, executor)) {
+            return ACLNN_SUCCESS;
+        }
+    }
     // 固定写法，创建OpExecutor
     auto uniqueExecutor = CREATE_EXECUTOR();
     CHECK_RET(uniqueExecutor.get() != nullptr, ACLNN_ERR_INNER_CREATE_EXECUTOR);
@@ -332,31 +344,38 @@ aclnnStatus aclnnAddGetWorkspaceSize(
         uniqueExecutor.ReleaseTo(executor);
         return ACLNN_SUCCESS;
     }
-    // 固定写法，将输入self转换成连续的tensor
-    auto selfContiguous = l0op::Contiguous(self, uniqueExecutor.get());
-    CHECK_RET(selfContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
-
-    // 固定写法，将输入other转换成连续的tensor
-    auto otherContiguous = l0op::Contiguous(other, uniqueExecutor.get());
-    CHECK_RET(otherContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    // 一次性计算广播类别、输入连续性与Cast需求，按路径表只执行必要的Contiguous/Cast
+    auto promoteType = op::PromoteType(self->GetDataType(), other->GetDataType());
+    auto dispatchSig = ElementwiseDispatcher::Classify(self, other, out, promoteType);
+    // 判断输入是否符合kernel支持的混合输入类型，此时kernel直接输出推导类型，输入侧不做Cast
+    bool isMixDataType = isAddMixDtypeSupport(self, other) && !(alpha->ToFloat() > 1 || alpha->ToFloat() < 1);
+    if (isMixDataType) {
+        dispatchSig.SkipInputCast();
+    }
+    const auto& plan = ElementwiseDispatcher::Select(dispatchSig);
 
     // 申请add的输出tensor
     const aclTensor* addOpOut = nullptr;
-    // 判断输入是否符合kernel支持的混合输入类型
-    bool isMixDataType = isAddMixDtypeSupport(self, other);
-    if (isMixDataType && !(alpha->ToFloat() > 1 || alpha->ToFloat() < 1)) {
-        // 无需调用Cast，直接调用L0带混合数据类型的kernel
+    if (isMixDataType) {
+        // 无需调用Cast，按需转连续后直接调用L0带混合数据类型的kernel
+        auto selfContiguous = ElementwiseDispatcher::PrepareInput(
+            self, plan, ELEMENTWISE_STEP_CONTIGUOUS_SELF, 0, promoteType, uniqueExecutor.get());
+        CHECK_RET(selfContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        auto otherContiguous = ElementwiseDispatcher::PrepareInput(
+            other, plan, ELEMENTWISE_STEP_CONTIGUOUS_OTHER, 0, promoteType, uniqueExecutor.get());
+        CHECK_RET(otherContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
         addOpOut = l0op::Add(selfContiguous, otherContiguous, uniqueExecutor.get());
     } else {
-        // 对self和other两个输入做隐式数据类型转换，根据具体算子语义按需调用
-        auto promoteType = op::PromoteType(self->GetDataType(), other->GetDataType());
-
-        // 将输入self的数据类型转换成隐式数据类型，根据具体算子语义按需调用
-        auto selfCasted = l0op::Cast(selfContiguous, promoteType, uniqueExecutor.get());
+        // 将输入self转换成连续的tensor并转换成隐式数据类型
+        auto selfCasted = ElementwiseDispatcher::PrepareInput(
+            self, plan, ELEMENTWISE_STEP_CONTIGUOUS_SELF, ELEMENTWISE_STEP_CAST_SELF, promoteType,
+            uniqueExecutor.get());
         CHECK_RET(selfCasted != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
-        // 将输入other的数据类型转换成隐式数据类型，根据具体算子语义按需调用
-        auto otherCasted = l0op::Cast(otherContiguous, promoteType, uniqueExecutor.get());
+        // 将输入other转换成连续的tensor并转换成隐式数据类型
+        auto otherCasted = ElementwiseDispatcher::PrepareInput(
+            other, plan, ELEMENTWISE_STEP_CONTIGUOUS_OTHER, ELEMENTWISE_STEP_CAST_OTHER, promoteType,
+            uniqueExecutor.get());
         CHECK_RET(otherCasted != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
         // 进行非混合输入类型的Add计算分支判断
@@ -376,8 +395,10 @@ aclnnStatus aclnnAddGetWorkspaceSize(
     }
     CHECK_RET(addOpOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
-    // 固定写法，将计算结果转换成输出out的数据类型
-    auto castOut = l0op::Cast(addOpOut, out->GetDataType(), uniqueExecutor.get());
+    // 计算结果为推导类型，与out类型不一致时才需要Cast
+    auto castOut = plan.Has(ELEMENTWISE_STEP_CAST_OUT) ?
+                       l0op::Cast(addOpOut, out->GetDataType(), uniqueExecutor.get()) :
+                       addOpOut;
     CHECK_RET(castOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
     // 固定写法，将计算结果拷贝到输出out上，out可能是非连续的tensor
@@ -387,6 +408,9 @@ aclnnStatus aclnnAddGetWorkspaceSize(
     // 固定写法，获取计算过程中需要使用的workspace大小
     *workspaceSize = uniqueExecutor->GetWorkspaceSize();
     uniqueExecutor.ReleaseTo(executor); // 需要把 uniqueExecutor持有executor转移给executor
+    if (useCache) {
+        ExecutorCache::GetInstance().Insert(std::move(signature), *workspaceSize, *executor);
+    }
     return ACLNN_SUCCESS;
 }
 
@@ -580,14 +604,24 @@ aclnnStatus aclnnAdd(void* workspace, uint64_t workspaceSize, aclOpExecutor* exe
 {
     L2_DFX_PHASE_2(aclnnAdd);
     // 固定写法，调用框架能力，完成计算
-    return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+    auto ret = CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+    if (ExecutorCache::IsEnabled()) {
+        // 地址已随任务下发，解除缓存执行器的占用
+        ExecutorCache::GetInstance().MarkLaunched(executor);
+    }
+    return ret;
 }
 
 aclnnStatus aclnnInplaceAdd(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream)
 {
     L2_DFX_PHASE_2(aclnnInplaceAdd);
     // 固定写法，调用框架能力，完成计算
-    return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+    auto ret = CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+    if (ExecutorCache::IsEnabled()) {
+        // 地址已随任务下发，解除缓存执行器的占用
+        ExecutorCache::GetInstance().MarkLaunched(executor);
+    }
+    return ret;
 }
 
 aclnnStatus aclnnAdds(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream)
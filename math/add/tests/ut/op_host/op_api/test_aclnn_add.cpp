@@ -10,10 +10,13 @@
  */
 
 #include <array>
+#include <thread>
 #include <vector>
 #include "gtest/gtest.h"
 
 #include "level2/aclnn_add.h"
+#include "common/level2_elementwise_dispatch.h"
+#include "common/level2_executor_cache.h"
 
 #include "op_api_ut_common/op_api_ut.h"
 #include "op_api_ut_common/scalar_desc.h"
@@ -788,4 +791,127 @@ TEST_F(l2_add_test, Ascend910B2_case_bool_bool)
     uint64_t workspace_size = 0;
     aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
     EXPECT_EQ(aclRet, ACL_SUCCESS);
-}
\ No newline at end of file
+}
+static aclTensor* CreateContiguousTensor(const vector<int64_t>& shape, aclDataType dtype, void* addr)
+{
+    vector<int64_t> strides(shape.size(), 1);
+    for (int64_t i = static_cast<int64_t>(shape.size()) - 2; i >= 0; i--) {
+        strides[i] = strides[i + 1] * shape[i + 1];
+    }
+    return aclCreateTensor(
+        shape.data(), shape.size(), dtype, strides.data(), 0, ACL_FORMAT_ND, shape.data(), shape.size(), addr);
+}
+
+// 执行器缓存：下发前相同签名不复用执行器；跨线程下发后命中并刷新地址；超过容量按LRU淘汰未占用的缓存项
+TEST_F(l2_add_test, Ascend910B2_case_repeat_same_signature)
+{
+    op::ExecutorCache::SetEnabled(true);
+    op::ExecutorCache::GetInstance().Clear();
+    op::ExecutorCache::ResetStats();
+
+    constexpr size_t CALL_NUM = 3;
+    vector<vector<float>> selfData(CALL_NUM, vector<float>(64 * 128, 1.0f));
+    vector<vector<float>> otherData(CALL_NUM, vector<float>(128, 1.0f));
+    vector<vector<float>> outData(CALL_NUM, vector<float>(64 * 128, 0.0f));
+    vector<aclTensor*> selfs;
+    vector<aclTensor*> others;
+    vector<aclTensor*> outs;
+    for (size_t i = 0; i < CALL_NUM; i++) {
+        selfs.push_back(CreateContiguousTensor({64, 128}, ACL_FLOAT, selfData[i].data()));
+        others.push_back(CreateContiguousTensor({1, 128}, ACL_FLOAT, otherData[i].data()));
+        outs.push_back(CreateContiguousTensor({64, 128}, ACL_FLOAT, outData[i].data()));
+    }
+    float alphaValue = 2.0f;
+    aclScalar* alpha = aclCreateScalar(&alphaValue, ACL_FLOAT);
+
+    uint64_t firstWorkspaceSize = 0;
+    aclOpExecutor* firstExecutor = nullptr;
+    EXPECT_EQ(aclnnAddGetWorkspaceSize(selfs[0], others[0], alpha, outs[0], &firstWorkspaceSize, &firstExecutor),
+              ACLNN_SUCCESS);
+
+    // 第一次返回的执行器尚未下发，相同签名构建独立执行器
+    uint64_t workspaceSize = 0;
+    aclOpExecutor* busyExecutor = nullptr;
+    EXPECT_EQ(aclnnAddGetWorkspaceSize(selfs[1], others[1], alpha, outs[1], &workspaceSize, &busyExecutor),
+              ACLNN_SUCCESS);
+    EXPECT_NE(busyExecutor, firstExecutor);
+    EXPECT_EQ(workspaceSize, firstWorkspaceSize);
+    delete busyExecutor;
+    auto stats = op::ExecutorCache::GetStats();
+    EXPECT_EQ(stats.hit, 0U);
+    EXPECT_EQ(stats.miss, 2U);
+    EXPECT_EQ(stats.busy, 1U);
+
+    // 第二段接口在其他线程下发后命中，返回同一执行器并刷新为本次调用的地址
+    std::thread launcher([firstExecutor]() { op::ExecutorCache::GetInstance().MarkLaunched(firstExecutor); });
+    launcher.join();
+    aclOpExecutor* hitExecutor = nullptr;
+    EXPECT_EQ(aclnnAddGetWorkspaceSize(selfs[2], others[2], alpha, outs[2], &workspaceSize, &hitExecutor),
+              ACLNN_SUCCESS);
+    EXPECT_EQ(hitExecutor, firstExecutor);
+    EXPECT_EQ(workspaceSize, firstWorkspaceSize);
+    vector<const void*> boundAddrs;
+    EXPECT_TRUE(op::ExecutorCache::GetInstance().GetBoundAddrs(hitExecutor, boundAddrs));
+    vector<const void*> expectAddrs = {selfData[2].data(), otherData[2].data(), outData[2].data()};
+    EXPECT_EQ(boundAddrs, expectAddrs);
+    stats = op::ExecutorCache::GetStats();
+    EXPECT_EQ(stats.hit, 1U);
+    EXPECT_EQ(stats.miss, 2U);
+    op::ExecutorCache::GetInstance().MarkLaunched(hitExecutor);
+
+    // 再插入EXECUTOR_CACHE_MAX_ENTRIES个不同签名，淘汰最久未用的一项
+    for (int64_t rows = 1; rows <= static_cast<int64_t>(op::EXECUTOR_CACHE_MAX_ENTRIES); rows++) {
+        aclTensor* self = CreateContiguousTensor({rows, 64}, ACL_FLOAT, selfData[0].data());
+        aclTensor* other = CreateContiguousTensor({rows, 64}, ACL_FLOAT, selfData[1].data());
+        aclTensor* out = CreateContiguousTensor({rows, 64}, ACL_FLOAT, outData[0].data());
+        aclOpExecutor* executor = nullptr;
+        EXPECT_EQ(aclnnAddGetWorkspaceSize(self, other, alpha, out, &workspaceSize, &executor), ACLNN_SUCCESS);
+        op::ExecutorCache::GetInstance().MarkLaunched(executor);
+        aclDestroyTensor(self);
+        aclDestroyTensor(other);
+        aclDestroyTensor(out);
+    }
+    stats = op::ExecutorCache::GetStats();
+    EXPECT_EQ(stats.hit, 1U);
+    EXPECT_EQ(stats.miss, 2U + op::EXECUTOR_CACHE_MAX_ENTRIES);
+    EXPECT_EQ(stats.evict, 1U);
+    EXPECT_EQ(op::ExecutorCache::GetInstance().Size(), op::EXECUTOR_CACHE_MAX_ENTRIES);
+
+    op::ExecutorCache::GetInstance().Clear();
+    op::ExecutorCache::SetEnabled(false);
+    for (size_t i = 0; i < CALL_NUM; i++) {
+        aclDestroyTensor(selfs[i]);
+        aclDestroyTensor(others[i]);
+        aclDestroyTensor(outs[i]);
+    }
+    aclDestroyScalar(alpha);
+}
+
+// 构图路径计数：同类型同形状走直连路径，需要Cast和广播时分别计入对应类别
+TEST_F(l2_add_test, case_elementwise_dispatch_stats)
+{
+    op::ElementwiseDispatcher::ResetStats();
+    auto self_tensor_desc = TensorDesc({16, 32}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto other_tensor_desc = TensorDesc({16, 32}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto out_tensor_desc = TensorDesc({16, 32}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto scalar_desc = ScalarDesc(1.0f);
+    auto ut = OP_API_UT(aclnnAdd, INPUT(self_tensor_desc, other_tensor_desc, scalar_desc), OUTPUT(out_tensor_desc));
+    uint64_t workspace_size = 0;
+    EXPECT_EQ(ut.TestGetWorkspaceSize(&workspace_size), ACL_SUCCESS);
+
+    auto half_desc = TensorDesc({16, 32}, ACL_FLOAT16, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto row_desc = TensorDesc({1, 32}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto alpha_desc = ScalarDesc(2.0f);
+    auto ut_cast = OP_API_UT(aclnnAdd, INPUT(half_desc, row_desc, alpha_desc), OUTPUT(out_tensor_desc));
+    EXPECT_EQ(ut_cast.TestGetWorkspaceSize(&workspace_size), ACL_SUCCESS);
+
+    // 混合dtype且alpha为1时由kernel直接处理，不做Cast，计入直连路径
+    auto ut_mix = OP_API_UT(aclnnAdd, INPUT(half_desc, other_tensor_desc, scalar_desc), OUTPUT(out_tensor_desc));
+    EXPECT_EQ(ut_mix.TestGetWorkspaceSize(&workspace_size), ACL_SUCCESS);
+
+    auto stats = op::ElementwiseDispatcher::GetStats();
+    EXPECT_EQ(stats.path[static_cast<size_t>(op::ElementwisePath::DIRECT)], 2U);
+    EXPECT_EQ(stats.path[static_cast<size_t>(op::ElementwisePath::CAST)], 1U);
+    EXPECT_EQ(stats.broadcast[static_cast<size_t>(op::ElementwiseBroadcast::SAME_SHAPE)], 2U);
+    EXPECT_EQ(stats.broadcast[static_cast<size_t>(op::ElementwiseBroadcast::GENERAL)], 1U);
+}
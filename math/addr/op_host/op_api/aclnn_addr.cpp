@@ -12,6 +12,7 @@
 #include "aclnn_addr.h"
 #include "../../../add/op_host/op_api/add.h"
 #include "addr.h"
+#include "../../../addr_v2/op_host/op_api/addr_v2.h"
 #include "../../../mul/op_host/op_api/mul.h"
 #include "../../../logical_or/op_host/op_api/logical_or.h"
 #include "../../../logical_and/op_host/op_api/logical_and.h"
@@ -309,6 +310,25 @@ static aclnnStatus addrStub(
     return addrOutHandle(addrOut, out, executor, DataType::DT_MAX);
 }
 
+// 融合kernel：self保持原dtype直接参与计算，只对长度为m/n的vec1、vec2做类型转换
+static aclnnStatus addrV2Proc(
+    const aclTensor* selfContiguous, const aclTensor* vec1Contiguous, const aclTensor* vec2Contiguous,
+    const aclScalar* beta, const aclScalar* alpha, aclTensor* out, aclOpExecutor* executor,
+    const op::DataType& hightDtype)
+{
+    auto vec1Cast = l0op::Cast(vec1Contiguous, hightDtype, executor);
+    CHECK_RET(vec1Cast != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    auto vec2Cast = l0op::Cast(vec2Contiguous, hightDtype, executor);
+    CHECK_RET(vec2Cast != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    // beta、alpha为nullptr时以默认值1处理；beta为0时kernel不读取self
+    float betaValue = beta != nullptr ? beta->ToFloat() : 1.0f;
+    float alphaValue = alpha != nullptr ? alpha->ToFloat() : 1.0f;
+    auto addrOut = l0op::AddrV2(selfContiguous, vec1Cast, vec2Cast, betaValue, alphaValue, executor);
+    CHECK_RET(addrOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    return addrOutHandle(addrOut, out, executor, DataType::DT_MAX);
+}
+
 static aclnnStatus addrProc(
     const aclTensor* self, const aclTensor* vec1, const aclTensor* vec2, const aclScalar* beta, const aclScalar* alpha,
     aclTensor* out, aclOpExecutor* executor)
@@ -324,6 +344,10 @@ static aclnnStatus addrProc(
     auto vec2Contiguous = l0op::Contiguous(vec2, executor);
     CHECK_RET(vec2Contiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
+    if (l0op::IsAddrV2Support(selfContiguous->GetDataType(), hightDtype)) {
+        return addrV2Proc(selfContiguous, vec1Contiguous, vec2Contiguous, beta, alpha, out, executor, hightDtype);
+    }
+
     // 类型转换，都转换成最高类型进行计算
     auto selfCast = l0op::Cast(selfContiguous, hightDtype, executor);
     CHECK_RET(selfCast != nullptr, ACLNN_ERR_INNER_NULLPTR);
@@ -73,6 +73,63 @@ TEST_F(l2_addr_test, ascend910B2_addr_dtype_bfloat16)
     EXPECT_EQ(aclRet, ACL_SUCCESS);
 }
 
+// test fused addr: FLOAT16 self with FLOAT vectors
+TEST_F(l2_addr_test, ascend910B2_addr_fused_mixed_dtype)
+{
+    auto self_tensor_desc = TensorDesc({64, 300}, ACL_FLOAT16, ACL_FORMAT_ND).ValueRange(-2.0, 2.0);
+    auto vec1_tensor_desc = TensorDesc({64}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-2.0, 2.0);
+    auto vec2_tensor_desc = TensorDesc({300}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-2.0, 2.0);
+    auto beta_scalar_desc = ScalarDesc(0.5f);
+    auto alpha_scalar_desc = ScalarDesc(2.0f);
+    auto out_tensor_desc = TensorDesc({64, 300}, ACL_FLOAT, ACL_FORMAT_ND).Precision(0.001, 0.001);
+
+    auto ut = OP_API_UT(
+        aclnnAddr, INPUT(self_tensor_desc, vec1_tensor_desc, vec2_tensor_desc, beta_scalar_desc, alpha_scalar_desc),
+        OUTPUT(out_tensor_desc));
+
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACL_SUCCESS);
+}
+
+// test fused addr: beta为0且self为行广播
+TEST_F(l2_addr_test, ascend910B2_addr_fused_beta_zero_row_self)
+{
+    auto self_tensor_desc = TensorDesc({300}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-2.0, 2.0);
+    auto vec1_tensor_desc = TensorDesc({64}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-2.0, 2.0);
+    auto vec2_tensor_desc = TensorDesc({300}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-2.0, 2.0);
+    auto beta_scalar_desc = ScalarDesc(0.0f);
+    auto alpha_scalar_desc = ScalarDesc(1.0f);
+    auto out_tensor_desc = TensorDesc({64, 300}, ACL_FLOAT, ACL_FORMAT_ND).Precision(0.0001, 0.0001);
+
+    auto ut = OP_API_UT(
+        aclnnAddr, INPUT(self_tensor_desc, vec1_tensor_desc, vec2_tensor_desc, beta_scalar_desc, alpha_scalar_desc),
+        OUTPUT(out_tensor_desc));
+
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACL_SUCCESS);
+}
+
+// test fused addr: BOOL
+TEST_F(l2_addr_test, ascend910B2_addr_fused_bool)
+{
+    auto self_tensor_desc = TensorDesc({16, 1}, ACL_BOOL, ACL_FORMAT_ND).ValueRange(false, true);
+    auto vec1_tensor_desc = TensorDesc({16}, ACL_BOOL, ACL_FORMAT_ND).ValueRange(false, true);
+    auto vec2_tensor_desc = TensorDesc({40}, ACL_BOOL, ACL_FORMAT_ND).ValueRange(false, true);
+    auto beta_scalar_desc = ScalarDesc(static_cast<bool>(true));
+    auto alpha_scalar_desc = ScalarDesc(static_cast<bool>(true));
+    auto out_tensor_desc = TensorDesc({16, 40}, ACL_BOOL, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(
+        aclnnAddr, INPUT(self_tensor_desc, vec1_tensor_desc, vec2_tensor_desc, beta_scalar_desc, alpha_scalar_desc),
+        OUTPUT(out_tensor_desc));
+
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACL_SUCCESS);
+}
+
 // test dtype: BFLOAT16 91095
 TEST_F(l2_addr_test, ascend910_95_addr_dtype_bfloat16)
 {
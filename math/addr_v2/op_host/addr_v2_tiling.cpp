@@ -0,0 +1,260 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file addr_v2_tiling.cpp
+ * \brief
+ */
+#include <algorithm>
+#include "addr_v2_tiling.h"
+#include "log/log.h"
+#include "register/op_def_registry.h"
+#include "tiling_base/tiling_templates_registry.h"
+#include "platform/platform_info.h"
+
+namespace optiling {
+constexpr int32_t SELF_INPUT_INDEX = 0;
+constexpr int32_t VEC1_INPUT_INDEX = 1;
+constexpr int32_t VEC2_INPUT_INDEX = 2;
+constexpr size_t BETA_ATTR_INDEX = 0;
+constexpr size_t ALPHA_ATTR_INDEX = 1;
+constexpr size_t MAX_SELF_DIM_NUM = 2;
+constexpr uint32_t BYTE_BLOCK = 32;
+constexpr uint32_t BUFFER_NUM = 2;
+constexpr uint32_t RESERVED_UB = 1024;
+constexpr uint32_t MAX_COL_FACTOR = 2048;
+constexpr uint32_t MIN_COL_FACTOR = 256;
+constexpr uint32_t MAX_ROW_FACTOR = 4095; // DataCopyPad blockCount上限
+
+constexpr uint32_t SELF_MODE_NONE = 0;   // beta为0，不读取self
+constexpr uint32_t SELF_MODE_FULL = 1;   // self为[m, n]
+constexpr uint32_t SELF_MODE_ROW = 2;    // self为[n]或[1, n]，每行复用
+constexpr uint32_t SELF_MODE_COL = 3;    // self为[m, 1]，每行一个标量
+constexpr uint32_t SELF_MODE_SCALAR = 4; // self只有一个元素
+
+struct AddrV2DtypeKey {
+    ge::DataType selfDtype;
+    ge::DataType vecDtype;
+    uint64_t tilingKey;
+};
+
+// self单独保留原dtype，避免对[m, n]大小的self做Cast；vec1/vec2/y为提升后的计算dtype
+static const AddrV2DtypeKey DTYPE_KEYS[] = {
+    {ge::DT_FLOAT, ge::DT_FLOAT, 1},     {ge::DT_FLOAT16, ge::DT_FLOAT, 2}, {ge::DT_BF16, ge::DT_FLOAT, 3},
+    {ge::DT_FLOAT16, ge::DT_FLOAT16, 4}, {ge::DT_BF16, ge::DT_BF16, 5},     {ge::DT_BOOL, ge::DT_BOOL, 6},
+};
+
+static inline uint64_t CeilDiv(uint64_t a, uint64_t b)
+{
+    return b == 0 ? a : (a + b - 1) / b;
+}
+
+static inline uint64_t CeilAlign(uint64_t a, uint64_t b)
+{
+    return CeilDiv(a, b) * b;
+}
+
+static ge::graphStatus GetSelfMode(
+    gert::TilingContext* context, const gert::Shape& selfShape, uint64_t rowNum, uint64_t colNum, uint32_t& selfMode)
+{
+    size_t dimNum = selfShape.GetDimNum();
+    OP_CHECK_IF(
+        dimNum > MAX_SELF_DIM_NUM, OP_LOGE(context->GetNodeName(), "self should be 0~2 dims, but got %zu.", dimNum),
+        return ge::GRAPH_FAILED);
+    uint64_t selfRows = dimNum == MAX_SELF_DIM_NUM ? static_cast<uint64_t>(selfShape.GetDim(0)) : 1;
+    uint64_t selfCols = dimNum == 0 ? 1 : static_cast<uint64_t>(selfShape.GetDim(dimNum - 1));
+    if (selfRows == rowNum && selfCols == colNum) {
+        selfMode = SELF_MODE_FULL;
+    } else if (selfRows == 1 && selfCols == colNum) {
+        selfMode = SELF_MODE_ROW;
+    } else if (selfRows == rowNum && selfCols == 1) {
+        selfMode = SELF_MODE_COL;
+    } else if (selfRows == 1 && selfCols == 1) {
+        selfMode = SELF_MODE_SCALAR;
+    } else {
+        OP_LOGE(
+            context->GetNodeName(), "self [%lu, %lu] can not broadcast to outer shape [%lu, %lu].", selfRows, selfCols,
+            rowNum, colNum);
+        return ge::GRAPH_FAILED;
+    }
+    return ge::GRAPH_SUCCESS;
+}
+
+static void CalcTilingData(
+    uint32_t selfSize, uint32_t vecSize, uint32_t coreNum, uint32_t ubSize, AddrV2TilingData& tilingData)
+{
+    uint64_t rowNum = tilingData.get_rowNum();
+    uint64_t colNum = tilingData.get_colNum();
+    uint32_t selfMode = tilingData.get_selfMode();
+    // bool在half上计算，其余在fp32上计算
+    uint32_t calcSize = vecSize == 1 ? sizeof(uint16_t) : sizeof(float);
+    uint32_t alignNum = BYTE_BLOCK / std::min(selfSize, vecSize);
+    uint64_t ubAvail = ubSize - RESERVED_UB;
+
+    uint64_t colFactor = std::min<uint64_t>(CeilAlign(colNum, alignNum), MAX_COL_FACTOR);
+    uint64_t colBlocks = CeilDiv(colNum, colFactor);
+    if (rowNum * colBlocks < coreNum && colNum > MIN_COL_FACTOR) {
+        // 行数不足核数时沿列方向再切，让每个核都分到数据
+        uint64_t splitFactor = CeilAlign(CeilDiv(colNum, CeilDiv(coreNum, rowNum)), alignNum);
+        colFactor = std::min(colFactor, std::max<uint64_t>(MIN_COL_FACTOR, splitFactor));
+        colBlocks = CeilDiv(colNum, colFactor);
+    }
+    // 输入self与输出y double buffer，外加一份计算buffer
+    uint64_t perElem = (selfMode == SELF_MODE_FULL ? BUFFER_NUM * selfSize : 0) + calcSize + BUFFER_NUM * vecSize;
+    // vec2、alpha*vec2、行临时结果，以及ROW模式下的self行
+    uint64_t perCol = vecSize + calcSize + calcSize + selfSize + calcSize;
+    // vec1以及COL模式下的self列
+    uint64_t perRow = vecSize + calcSize + selfSize + calcSize;
+    uint64_t colBytes = colFactor * perCol;
+    uint64_t rowFactor = 0;
+    if (ubAvail > colBytes) {
+        rowFactor = (ubAvail - colBytes) / (colFactor * perElem + perRow);
+    }
+    rowFactor = std::min<uint64_t>({rowFactor, MAX_ROW_FACTOR, rowNum});
+    rowFactor = std::min<uint64_t>(rowFactor, CeilDiv(rowNum, CeilDiv(coreNum, colBlocks)));
+    uint64_t unitNum = rowFactor == 0 ? 0 : CeilDiv(rowNum, rowFactor) * colBlocks;
+    uint64_t usedCoreNum = std::max<uint64_t>(1, std::min<uint64_t>(coreNum, unitNum));
+
+    tilingData.set_colBlocks(colBlocks);
+    tilingData.set_unitNum(unitNum);
+    tilingData.set_unitsPerCore(unitNum / usedCoreNum);
+    tilingData.set_tailUnits(unitNum % usedCoreNum);
+    tilingData.set_usedCoreNum(static_cast<uint32_t>(usedCoreNum));
+    tilingData.set_rowFactor(static_cast<uint32_t>(rowFactor));
+    tilingData.set_colFactor(static_cast<uint32_t>(colFactor));
+}
+
+static void PrintTilingData(gert::TilingContext* context, AddrV2TilingData& tilingData)
+{
+    const ge::char_t* nodeName = context->GetNodeName();
+    OP_LOGD(nodeName, "rowNum: %lu", tilingData.get_rowNum());
+    OP_LOGD(nodeName, "colNum: %lu", tilingData.get_colNum());
+    OP_LOGD(nodeName, "colBlocks: %lu", tilingData.get_colBlocks());
+    OP_LOGD(nodeName, "unitNum: %lu", tilingData.get_unitNum());
+    OP_LOGD(nodeName, "unitsPerCore: %lu", tilingData.get_unitsPerCore());
+    OP_LOGD(nodeName, "tailUnits: %lu", tilingData.get_tailUnits());
+    OP_LOGD(nodeName, "beta: %f", tilingData.get_beta());
+    OP_LOGD(nodeName, "alpha: %f", tilingData.get_alpha());
+    OP_LOGD(nodeName, "selfMode: %u", tilingData.get_selfMode());
+    OP_LOGD(nodeName, "usedCoreNum: %u", tilingData.get_usedCoreNum());
+    OP_LOGD(nodeName, "rowFactor: %u", tilingData.get_rowFactor());
+    OP_LOGD(nodeName, "colFactor: %u", tilingData.get_colFactor());
+}
+
+static ge::graphStatus Tiling4AddrV2(gert::TilingContext* context)
+{
+    OP_LOGI(context->GetNodeName(), "AddrV2 tiling starts running");
+    auto compileInfo = reinterpret_cast<const AddrV2CompileInfo*>(context->GetCompileInfo());
+    OP_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    OP_CHECK_IF(
+        compileInfo->vectorCoreNum <= 0 || compileInfo->ubByteSize <= RESERVED_UB,
+        OP_LOGE(context->GetNodeName(), "Failed to get core num or ub size."), return ge::GRAPH_FAILED);
+
+    auto selfDesc = context->GetInputDesc(SELF_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, selfDesc);
+    auto vec1Desc = context->GetInputDesc(VEC1_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, vec1Desc);
+    auto vec2Desc = context->GetInputDesc(VEC2_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, vec2Desc);
+    ge::DataType selfDtype = selfDesc->GetDataType();
+    ge::DataType vecDtype = vec1Desc->GetDataType();
+    OP_CHECK_IF(
+        vec2Desc->GetDataType() != vecDtype,
+        OP_LOGE(context->GetNodeName(), "vec1 and vec2 should have the same dtype."), return ge::GRAPH_FAILED);
+    uint64_t tilingKey = 0;
+    for (const auto& item : DTYPE_KEYS) {
+        if (item.selfDtype == selfDtype && item.vecDtype == vecDtype) {
+            tilingKey = item.tilingKey;
+        }
+    }
+    OP_CHECK_IF(
+        tilingKey == 0, OP_LOGE(context->GetNodeName(), "the dtype combination of self and vec is not supported."),
+        return ge::GRAPH_FAILED);
+
+    auto vec1Shape = context->GetInputShape(VEC1_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, vec1Shape);
+    auto vec2Shape = context->GetInputShape(VEC2_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, vec2Shape);
+    auto selfShape = context->GetInputShape(SELF_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, selfShape);
+    OP_CHECK_IF(
+        vec1Shape->GetStorageShape().GetDimNum() != 1 || vec2Shape->GetStorageShape().GetDimNum() != 1,
+        OP_LOGE(context->GetNodeName(), "vec1 and vec2 should be 1D."), return ge::GRAPH_FAILED);
+    int64_t rowNum = vec1Shape->GetStorageShape().GetDim(0);
+    int64_t colNum = vec2Shape->GetStorageShape().GetDim(0);
+    OP_CHECK_IF(
+        rowNum <= 0 || colNum <= 0, OP_LOGE(context->GetNodeName(), "vec1 and vec2 should not be empty."),
+        return ge::GRAPH_FAILED);
+
+    const gert::RuntimeAttrs* attrs = context->GetAttrs();
+    OP_CHECK_NULL_WITH_CONTEXT(context, attrs);
+    const float* betaPtr = attrs->GetAttrPointer<float>(BETA_ATTR_INDEX);
+    const float* alphaPtr = attrs->GetAttrPointer<float>(ALPHA_ATTR_INDEX);
+    float beta = betaPtr == nullptr ? 1.0f : *betaPtr;
+    float alpha = alphaPtr == nullptr ? 1.0f : *alphaPtr;
+
+    AddrV2TilingData tilingData;
+    uint32_t selfMode = SELF_MODE_NONE;
+    if (beta != 0.0f) {
+        ge::graphStatus ret = GetSelfMode(
+            context, selfShape->GetStorageShape(), static_cast<uint64_t>(rowNum), static_cast<uint64_t>(colNum),
+            selfMode);
+        if (ret != ge::GRAPH_SUCCESS) {
+            return ret;
+        }
+    }
+    tilingData.set_rowNum(static_cast<uint64_t>(rowNum));
+    tilingData.set_colNum(static_cast<uint64_t>(colNum));
+    tilingData.set_beta(beta);
+    tilingData.set_alpha(alpha);
+    tilingData.set_selfMode(selfMode);
+    CalcTilingData(
+        ge::GetSizeByDataType(selfDtype), ge::GetSizeByDataType(vecDtype), compileInfo->vectorCoreNum,
+        compileInfo->ubByteSize, tilingData);
+    OP_CHECK_IF(
+        tilingData.get_rowFactor() == 0,
+        OP_LOGE(context->GetNodeName(), "ub space is not enough, please check input."), return ge::GRAPH_FAILED);
+
+    context->SetTilingKey(tilingKey);
+    context->SetBlockDim(tilingData.get_usedCoreNum());
+    size_t* workspaces = context->GetWorkspaceSizes(1);
+    workspaces[0] = compileInfo->sysWorkspaceByteSize;
+    tilingData.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tilingData.GetDataSize());
+    PrintTilingData(context, tilingData);
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus TilingPrepare4AddrV2(gert::TilingParseContext* context)
+{
+    auto compileInfo = context->GetCompiledInfo<AddrV2CompileInfo>();
+    OP_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    auto platformInfo = context->GetPlatformInfo();
+    OP_CHECK_NULL_WITH_CONTEXT(context, platformInfo);
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(platformInfo);
+    compileInfo->vectorCoreNum = ascendcPlatform.GetCoreNumAiv();
+    OP_CHECK_IF(
+        (compileInfo->vectorCoreNum <= 0), OP_LOGE(context->GetNodeName(), "No vector core available."),
+        return ge::GRAPH_FAILED);
+    uint64_t ubByteSize;
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ubByteSize);
+    compileInfo->ubByteSize = ubByteSize;
+    OP_CHECK_IF(
+        (compileInfo->ubByteSize <= 0), OP_LOGE(context->GetNodeName(), "Failed to get ub size."),
+        return ge::GRAPH_FAILED);
+    compileInfo->sysWorkspaceByteSize = ascendcPlatform.GetLibApiWorkSpaceSize();
+    return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_OPTILING(AddrV2)
+    .Tiling(Tiling4AddrV2)
+    .TilingParse<AddrV2CompileInfo>(TilingPrepare4AddrV2);
+} // namespace optiling
@@ -0,0 +1,44 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file addr_v2_tiling.h
+ * \brief
+ */
+#ifndef OPS_BUILT_IN_OP_TILING_RUNTIME_ADDR_V2_H_
+#define OPS_BUILT_IN_OP_TILING_RUNTIME_ADDR_V2_H_
+
+#include "register/tilingdata_base.h"
+
+namespace optiling {
+BEGIN_TILING_DATA_DEF(AddrV2TilingData)
+TILING_DATA_FIELD_DEF(uint64_t, rowNum);       // vec1长度，即输出行数
+TILING_DATA_FIELD_DEF(uint64_t, colNum);       // vec2长度，即输出列数
+TILING_DATA_FIELD_DEF(uint64_t, colBlocks);    // 每行在列方向上切分的块数
+TILING_DATA_FIELD_DEF(uint64_t, unitNum);      // (行块, 列块)单元总数
+TILING_DATA_FIELD_DEF(uint64_t, unitsPerCore); // 每核处理的单元数
+TILING_DATA_FIELD_DEF(uint64_t, tailUnits);    // 前tailUnits个核多处理一个单元
+TILING_DATA_FIELD_DEF(float, beta);
+TILING_DATA_FIELD_DEF(float, alpha);
+TILING_DATA_FIELD_DEF(uint32_t, selfMode);     // self的广播方式，beta为0时不读取self
+TILING_DATA_FIELD_DEF(uint32_t, usedCoreNum);
+TILING_DATA_FIELD_DEF(uint32_t, rowFactor);    // 每次处理的行数
+TILING_DATA_FIELD_DEF(uint32_t, colFactor);    // 每次处理的列数
+END_TILING_DATA_DEF;
+REGISTER_TILING_DATA_CLASS(AddrV2, AddrV2TilingData)
+
+struct AddrV2CompileInfo {
+    uint32_t vectorCoreNum;
+    uint32_t sysWorkspaceByteSize;
+    uint32_t ubByteSize;
+};
+} // namespace optiling
+#endif // OPS_BUILT_IN_OP_TILING_RUNTIME_ADDR_V2_H_
@@ -0,0 +1,70 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file addr_v2.cpp
+ * \brief
+ */
+
+#include "addr_v2.h"
+#include "opdev/data_type_utils.h"
+#include "opdev/format_utils.h"
+#include "opdev/make_op_executor.h"
+#include "opdev/op_def.h"
+#include "opdev/op_dfx.h"
+#include "opdev/op_executor.h"
+#include "opdev/op_log.h"
+#include "opdev/platform.h"
+#include "opdev/shape_utils.h"
+
+using namespace op;
+
+namespace l0op {
+OP_TYPE_REGISTER(AddrV2);
+
+static const std::initializer_list<op::DataType> FLOAT_SELF_DTYPE_SUPPORT_LIST = {
+    DataType::DT_FLOAT, DataType::DT_FLOAT16, DataType::DT_BF16};
+
+static const std::initializer_list<op::DataType> SAME_DTYPE_SUPPORT_LIST = {
+    DataType::DT_FLOAT16, DataType::DT_BF16, DataType::DT_BOOL};
+
+bool IsAddrV2Support(const op::DataType& selfDtype, const op::DataType& hightDtype)
+{
+    SocVersion socVersion = GetCurrentPlatformInfo().GetSocVersion();
+    if (socVersion != SocVersion::ASCEND910B && socVersion != SocVersion::ASCEND910_93) {
+        return false;
+    }
+    // 计算dtype为float时self可为任意浮点类型，在kernel内转换；其余情况self需与计算dtype一致
+    if (hightDtype == DataType::DT_FLOAT) {
+        return CheckType(selfDtype, FLOAT_SELF_DTYPE_SUPPORT_LIST);
+    }
+    return selfDtype == hightDtype && CheckType(hightDtype, SAME_DTYPE_SUPPORT_LIST);
+}
+
+const aclTensor* AddrV2(
+    const aclTensor* self, const aclTensor* vec1, const aclTensor* vec2, float beta, float alpha,
+    aclOpExecutor* executor)
+{
+    L0_DFX(AddrV2, self, vec1, vec2, beta, alpha);
+
+    op::Shape outShape = {vec1->GetViewShape().GetDim(0), vec2->GetViewShape().GetDim(0)};
+    auto addrOut = executor->AllocTensor(outShape, vec1->GetDataType(), Format::FORMAT_ND);
+    CHECK_RET(addrOut != nullptr, nullptr);
+
+    auto ret = ADD_TO_LAUNCHER_LIST_AICORE(
+        AddrV2, OP_INPUT(self, vec1, vec2), OP_OUTPUT(addrOut), OP_ATTR(beta, alpha));
+    if (ret != ACLNN_SUCCESS) {
+        OP_LOGE(ACLNN_ERR_INNER_NULLPTR, "AddrV2 ADD_TO_LAUNCHER_LIST_AICORE failed.");
+        return nullptr;
+    }
+    return addrOut;
+}
+} // namespace l0op
@@ -0,0 +1,31 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file addr_v2.h
+ * \brief
+ */
+
+#ifndef OP_API_INC_LEVEL0_ADDR_V2_H
+#define OP_API_INC_LEVEL0_ADDR_V2_H
+#include "opdev/op_executor.h"
+
+namespace l0op {
+// 芯片以及self/提升后dtype组合是否可走融合Addr kernel
+bool IsAddrV2Support(const op::DataType& selfDtype, const op::DataType& hightDtype);
+
+// y = beta * self + alpha * (vec1 ⊗ vec2)，self保留原dtype，vec1/vec2需已转换为hightDtype，输出dtype与vec1一致
+const aclTensor* AddrV2(
+    const aclTensor* self, const aclTensor* vec1, const aclTensor* vec2, float beta, float alpha,
+    aclOpExecutor* executor);
+} // namespace l0op
+
+#endif // OP_API_INC_LEVEL0_ADDR_V2_H
@@ -0,0 +1,51 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file addr_v2.cpp
+ * \brief
+ */
+
+#include "kernel_operator.h"
+#include "addr_v2.h"
+
+using namespace AddrV2;
+
+extern "C" __global__ __aicore__ void addr_v2(
+    GM_ADDR self, GM_ADDR vec1, GM_ADDR vec2, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling)
+{
+    GET_TILING_DATA(tilingData, tiling);
+    if (TILING_KEY_IS(1)) {
+        AddrV2ND<float, float, float> op;
+        op.Init(self, vec1, vec2, y, &tilingData);
+        op.Process();
+    } else if (TILING_KEY_IS(2)) {
+        AddrV2ND<half, float, float> op;
+        op.Init(self, vec1, vec2, y, &tilingData);
+        op.Process();
+    } else if (TILING_KEY_IS(3)) {
+        AddrV2ND<bfloat16_t, float, float> op;
+        op.Init(self, vec1, vec2, y, &tilingData);
+        op.Process();
+    } else if (TILING_KEY_IS(4)) {
+        AddrV2ND<half, half, float> op;
+        op.Init(self, vec1, vec2, y, &tilingData);
+        op.Process();
+    } else if (TILING_KEY_IS(5)) {
+        AddrV2ND<bfloat16_t, bfloat16_t, float> op;
+        op.Init(self, vec1, vec2, y, &tilingData);
+        op.Process();
+    } else if (TILING_KEY_IS(6)) {
+        AddrV2ND<uint8_t, uint8_t, half> op;
+        op.Init(self, vec1, vec2, y, &tilingData);
+        op.Process();
+    }
+}
@@ -0,0 +1,368 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file addr_v2.h
+ * \brief 融合Addr：y = beta * self + alpha * (vec1 ⊗ vec2)
+ *
+ * 输出按(行块, 列块)切分到多核。每个单元先把vec2的一段乘以alpha常驻UB，vec1的一段转成计算类型后逐行取标量，
+ * 外积在UB内逐行生成，self只读取一次（beta为0时不读取），行/列/标量广播的self在UB内复用。
+ * self保留原dtype在kernel内转换，bool在half上计算，乘法即逻辑与，取max即逻辑或。
+ */
+#ifndef ADDR_V2_H
+#define ADDR_V2_H
+
+#include "kernel_operator.h"
+
+namespace AddrV2 {
+using namespace AscendC;
+
+constexpr int32_t BUFFER_NUM = 2;
+constexpr uint32_t BYTE_BLOCK = 32;
+
+constexpr uint32_t SELF_MODE_NONE = 0;
+constexpr uint32_t SELF_MODE_FULL = 1;
+constexpr uint32_t SELF_MODE_ROW = 2;
+constexpr uint32_t SELF_MODE_COL = 3;
+constexpr uint32_t SELF_MODE_SCALAR = 4;
+
+// TS为self类型，T为vec1/vec2/y类型，TC为计算类型
+template <typename TS, typename T, typename TC>
+class AddrV2ND {
+public:
+    __aicore__ inline AddrV2ND(){};
+    __aicore__ inline void Init(
+        GM_ADDR self, GM_ADDR vec1, GM_ADDR vec2, GM_ADDR y, const AddrV2TilingData* __restrict tilingData);
+    __aicore__ inline void Process();
+
+private:
+    __aicore__ inline void ProcessUnit(uint64_t rowStart, uint32_t rows, uint64_t colStart, uint32_t cols);
+    __aicore__ inline void LoadRowVectors(uint64_t rowStart, uint32_t rows);
+    __aicore__ inline void LoadColVectors(uint64_t colStart, uint32_t cols);
+    __aicore__ inline void LoadSelfTile(
+        const LocalTensor<TC>& calc, uint64_t rowStart, uint32_t rows, uint64_t colStart, uint32_t cols,
+        uint32_t colLen);
+    __aicore__ inline void AccumulateRow(const LocalTensor<TC>& dst, TC scale, uint32_t colLen);
+    __aicore__ inline void CopyOut(
+        const LocalTensor<T>& outLocal, uint64_t rowStart, uint32_t rows, uint64_t colStart, uint32_t cols,
+        uint32_t colLen);
+
+    template <typename T1>
+    __aicore__ inline T1 CeilAlign(T1 a, T1 b)
+    {
+        return b == 0 ? a : (a + b - 1) / b * b;
+    }
+
+    template <typename T1>
+    __aicore__ inline T1 Min(T1 a, T1 b)
+    {
+        return a < b ? a : b;
+    }
+
+    template <HardEvent EVENT>
+    __aicore__ inline void SyncFlag()
+    {
+        event_t eventId = static_cast<event_t>(GetTPipePtr()->FetchEventID(EVENT));
+        SetFlag<EVENT>(eventId);
+        WaitFlag<EVENT>(eventId);
+    }
+
+    // 数据按colLen对齐排布时，每行在UB上相对32B对齐长度多出的block数
+    template <typename T1>
+    __aicore__ inline uint32_t UbRowGap(uint32_t cols, uint32_t colLen)
+    {
+        return (colLen * sizeof(T1) - CeilAlign(static_cast<uint32_t>(cols * sizeof(T1)), BYTE_BLOCK)) / BYTE_BLOCK;
+    }
+
+    template <typename TDst, typename TSrc>
+    __aicore__ inline void CastTo(const LocalTensor<TDst>& dst, const LocalTensor<TSrc>& src, uint32_t count)
+    {
+        if constexpr (IsSameType<TDst, TSrc>::value) {
+            Adds(dst, src, static_cast<TDst>(0), count);
+        } else if constexpr (sizeof(TDst) > sizeof(TSrc) || IsSameType<TDst, half>::value) {
+            Cast(dst, src, RoundMode::CAST_NONE, count);
+        } else {
+            Cast(dst, src, RoundMode::CAST_RINT, count);
+        }
+    }
+
+private:
+    static constexpr bool IS_BOOL = sizeof(T) == 1;
+    static constexpr bool CALC_IN_OUT = IsSameType<T, TC>::value;
+
+    TPipe pipe;
+    TQue<QuePosition::VECIN, BUFFER_NUM> selfQueue;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> outQueue;
+    TBuf<QuePosition::VECCALC> calcBuf;
+    TBuf<QuePosition::VECCALC> vec1InBuf;
+    TBuf<QuePosition::VECCALC> vec1Buf;
+    TBuf<QuePosition::VECCALC> vec2InBuf;
+    TBuf<QuePosition::VECCALC> vec2Buf;
+    TBuf<QuePosition::VECCALC> tmpRowBuf;
+    TBuf<QuePosition::VECCALC> selfVecInBuf;
+    TBuf<QuePosition::VECCALC> selfVecBuf;
+    GlobalTensor<TS> selfGm;
+    GlobalTensor<T> vec1Gm;
+    GlobalTensor<T> vec2Gm;
+    GlobalTensor<T> yGm;
+
+    uint64_t unitStart = 0;
+    uint64_t unitNum = 0;
+    uint64_t rowNum = 0;
+    uint64_t colNum = 0;
+    uint64_t colBlocks = 0;
+    uint64_t loadedRowStart = 0;
+    uint64_t loadedColStart = 0;
+    bool rowLoaded = false;
+    bool colLoaded = false;
+    TC beta = 0;
+    TC alpha = 0;
+    uint32_t selfMode = 0;
+    uint32_t rowFactor = 0;
+    uint32_t colFactor = 0;
+    uint32_t alignNum = 0;
+};
+
+template <typename TS, typename T, typename TC>
+__aicore__ inline void AddrV2ND<TS, T, TC>::Init(
+    GM_ADDR self, GM_ADDR vec1, GM_ADDR vec2, GM_ADDR y, const AddrV2TilingData* __restrict tilingData)
+{
+    uint64_t blockIdx = GetBlockIdx();
+    uint64_t unitsPerCore = tilingData->unitsPerCore;
+    uint64_t tailUnits = tilingData->tailUnits;
+    unitNum = unitsPerCore + (blockIdx < tailUnits ? 1 : 0);
+    unitStart = blockIdx * unitsPerCore + (blockIdx < tailUnits ? blockIdx : tailUnits);
+    rowNum = tilingData->rowNum;
+    colNum = tilingData->colNum;
+    colBlocks = tilingData->colBlocks;
+    beta = static_cast<TC>(tilingData->beta);
+    alpha = static_cast<TC>(tilingData->alpha);
+    selfMode = tilingData->selfMode;
+    rowFactor = tilingData->rowFactor;
+    colFactor = tilingData->colFactor;
+    alignNum = BYTE_BLOCK / (sizeof(TS) < sizeof(T) ? sizeof(TS) : sizeof(T));
+
+    selfGm.SetGlobalBuffer((__gm__ TS*)self);
+    vec1Gm.SetGlobalBuffer((__gm__ T*)vec1);
+    vec2Gm.SetGlobalBuffer((__gm__ T*)vec2);
+    yGm.SetGlobalBuffer((__gm__ T*)y);
+
+    uint32_t tileElems = rowFactor * colFactor;
+    uint32_t rowAlloc = CeilAlign(rowFactor, BYTE_BLOCK);
+    pipe.InitBuffer(outQueue, BUFFER_NUM, tileElems * sizeof(T));
+    if constexpr (!CALC_IN_OUT) {
+        pipe.InitBuffer(calcBuf, tileElems * sizeof(TC));
+    }
+    pipe.InitBuffer(vec1InBuf, rowAlloc * sizeof(T));
+    pipe.InitBuffer(vec1Buf, rowAlloc * sizeof(TC));
+    pipe.InitBuffer(vec2InBuf, colFactor * sizeof(T));
+    pipe.InitBuffer(vec2Buf, colFactor * sizeof(TC));
+    if constexpr (IS_BOOL) {
+        pipe.InitBuffer(tmpRowBuf, colFactor * sizeof(TC));
+    }
+    if (selfMode == SELF_MODE_FULL) {
+        pipe.InitBuffer(selfQueue, BUFFER_NUM, tileElems * sizeof(TS));
+    } else if (selfMode == SELF_MODE_ROW) {
+        pipe.InitBuffer(selfVecInBuf, colFactor * sizeof(TS));
+        pipe.InitBuffer(selfVecBuf, colFactor * sizeof(TC));
+    } else if (selfMode == SELF_MODE_COL || selfMode == SELF_MODE_SCALAR) {
+        pipe.InitBuffer(selfVecInBuf, rowAlloc * sizeof(TS));
+        pipe.InitBuffer(selfVecBuf, rowAlloc * sizeof(TC));
+    }
+}
+
+template <typename TS, typename T, typename TC>
+__aicore__ inline void AddrV2ND<TS, T, TC>::Process()
+{
+    for (uint64_t i = 0; i < unitNum; i++) {
+        uint64_t unit = unitStart + i;
+        uint64_t rowStart = (unit / colBlocks) * rowFactor;
+        uint64_t colStart = (unit % colBlocks) * colFactor;
+        uint32_t rows = static_cast<uint32_t>(Min(static_cast<uint64_t>(rowFactor), rowNum - rowStart));
+        uint32_t cols = static_cast<uint32_t>(Min(static_cast<uint64_t>(colFactor), colNum - colStart));
+        ProcessUnit(rowStart, rows, colStart, cols);
+    }
+}
+
+// vec1段转成计算类型，COL/SCALAR模式下同时载入每行对应的beta*self
+template <typename TS, typename T, typename TC>
+__aicore__ inline void AddrV2ND<TS, T, TC>::LoadRowVectors(uint64_t rowStart, uint32_t rows)
+{
+    if (rowLoaded && loadedRowStart == rowStart) {
+        return;
+    }
+    LocalTensor<T> vec1In = vec1InBuf.Get<T>();
+    LocalTensor<TC> vec1Local = vec1Buf.Get<TC>();
+    uint32_t rowAlloc = CeilAlign(rows, BYTE_BLOCK);
+    SyncFlag<HardEvent::V_MTE2>();
+    DataCopyExtParams copyParams = {1, static_cast<uint32_t>(rows * sizeof(T)), 0, 0, 0};
+    DataCopyPadExtParams<T> padParams = {false, 0, 0, static_cast<T>(0)};
+    DataCopyPad(vec1In, vec1Gm[rowStart], copyParams, padParams);
+    bool loadSelf = selfMode == SELF_MODE_COL || selfMode == SELF_MODE_SCALAR;
+    if (loadSelf) {
+        // SCALAR模式下每行都取self[0]，按一行长度载入后只使用第0个
+        uint32_t selfCount = selfMode == SELF_MODE_COL ? rows : 1;
+        uint64_t selfOffset = selfMode == SELF_MODE_COL ? rowStart : 0;
+        DataCopyExtParams selfParams = {1, static_cast<uint32_t>(selfCount * sizeof(TS)), 0, 0, 0};
+        DataCopyPadExtParams<TS> selfPadParams = {false, 0, 0, static_cast<TS>(0)};
+        DataCopyPad(selfVecInBuf.Get<TS>(), selfGm[selfOffset], selfParams, selfPadParams);
+    }
+    SyncFlag<HardEvent::MTE2_V>();
+    CastTo(vec1Local, vec1In, rowAlloc);
+    if (loadSelf) {
+        LocalTensor<TC> selfLocal = selfVecBuf.Get<TC>();
+        CastTo(selfLocal, selfVecInBuf.Get<TS>(), rowAlloc);
+        PipeBarrier<PIPE_V>();
+        Muls(selfLocal, selfLocal, beta, rowAlloc);
+    }
+    SyncFlag<HardEvent::V_S>();
+    loadedRowStart = rowStart;
+    rowLoaded = true;
+}
+
+// vec2段乘以alpha后常驻UB，ROW模式下同时载入beta*self行
+template <typename TS, typename T, typename TC>
+__aicore__ inline void AddrV2ND<TS, T, TC>::LoadColVectors(uint64_t colStart, uint32_t cols)
+{
+    if (colLoaded && loadedColStart == colStart) {
+        return;
+    }
+    LocalTensor<T> vec2In = vec2InBuf.Get<T>();
+    LocalTensor<TC> vec2Local = vec2Buf.Get<TC>();
+    uint32_t colLen = CeilAlign(cols, alignNum);
+    SyncFlag<HardEvent::V_MTE2>();
+    DataCopyExtParams copyParams = {1, static_cast<uint32_t>(cols * sizeof(T)), 0, 0, 0};
+    DataCopyPadExtParams<T> padParams = {false, 0, 0, static_cast<T>(0)};
+    DataCopyPad(vec2In, vec2Gm[colStart], copyParams, padParams);
+    if (selfMode == SELF_MODE_ROW) {
+        DataCopyExtParams selfParams = {1, static_cast<uint32_t>(cols * sizeof(TS)), 0, 0, 0};
+        DataCopyPadExtParams<TS> selfPadParams = {false, 0, 0, static_cast<TS>(0)};
+        DataCopyPad(selfVecInBuf.Get<TS>(), selfGm[colStart], selfParams, selfPadParams);
+    }
+    SyncFlag<HardEvent::MTE2_V>();
+    CastTo(vec2Local, vec2In, colLen);
+    if (selfMode == SELF_MODE_ROW) {
+        LocalTensor<TC> selfLocal = selfVecBuf.Get<TC>();
+        CastTo(selfLocal, selfVecInBuf.Get<TS>(), colLen);
+        PipeBarrier<PIPE_V>();
+        Muls(selfLocal, selfLocal, beta, colLen);
+    }
+    PipeBarrier<PIPE_V>();
+    Muls(vec2Local, vec2Local, alpha, colLen);
+    PipeBarrier<PIPE_V>();
+    loadedColStart = colStart;
+    colLoaded = true;
+}
+
+// 搬入[rows, cols]的self块，转成计算类型并乘以beta
+template <typename TS, typename T, typename TC>
+__aicore__ inline void AddrV2ND<TS, T, TC>::LoadSelfTile(
+    const LocalTensor<TC>& calc, uint64_t rowStart, uint32_t rows, uint64_t colStart, uint32_t cols, uint32_t colLen)
+{
+    LocalTensor<TS> selfLocal = selfQueue.AllocTensor<TS>();
+    DataCopyExtParams copyParams = {
+        static_cast<uint16_t>(rows), static_cast<uint32_t>(cols * sizeof(TS)),
+        static_cast<uint32_t>((colNum - cols) * sizeof(TS)), UbRowGap<TS>(cols, colLen), 0};
+    DataCopyPadExtParams<TS> padParams = {false, 0, 0, static_cast<TS>(0)};
+    DataCopyPad(selfLocal, selfGm[rowStart * colNum + colStart], copyParams, padParams);
+    selfQueue.EnQue(selfLocal);
+    selfLocal = selfQueue.DeQue<TS>();
+    CastTo(calc, selfLocal, rows * colLen);
+    PipeBarrier<PIPE_V>();
+    selfQueue.FreeTensor(selfLocal);
+    Muls(calc, calc, beta, rows * colLen);
+    PipeBarrier<PIPE_V>();
+}
+
+// dst += scale * alpha * vec2，bool时为dst |= scale & alpha & vec2
+template <typename TS, typename T, typename TC>
+__aicore__ inline void AddrV2ND<TS, T, TC>::AccumulateRow(const LocalTensor<TC>& dst, TC scale, uint32_t colLen)
+{
+    LocalTensor<TC> vec2Local = vec2Buf.Get<TC>();
+    if constexpr (IS_BOOL) {
+        LocalTensor<TC> tmpRow = tmpRowBuf.Get<TC>();
+        Muls(tmpRow, vec2Local, scale, colLen);
+        PipeBarrier<PIPE_V>();
+        Max(dst, dst, tmpRow, colLen);
+    } else {
+        Axpy(dst, vec2Local, scale, colLen);
+    }
+    PipeBarrier<PIPE_V>();
+}
+
+template <typename TS, typename T, typename TC>
+__aicore__ inline void AddrV2ND<TS, T, TC>::ProcessUnit(
+    uint64_t rowStart, uint32_t rows, uint64_t colStart, uint32_t cols)
+{
+    uint32_t colLen = CeilAlign(cols, alignNum);
+    LoadColVectors(colStart, cols);
+    LoadRowVectors(rowStart, rows);
+
+    LocalTensor<T> outLocal = outQueue.AllocTensor<T>();
+    LocalTensor<TC> calc;
+    if constexpr (CALC_IN_OUT) {
+        calc = outLocal;
+    } else {
+        calc = calcBuf.Get<TC>();
+    }
+    LocalTensor<TC> vec1Local = vec1Buf.Get<TC>();
+    LocalTensor<TC> selfLocal;
+    if (selfMode == SELF_MODE_FULL) {
+        LoadSelfTile(calc, rowStart, rows, colStart, cols, colLen);
+    } else if (selfMode == SELF_MODE_ROW) {
+        selfLocal = selfVecBuf.Get<TC>();
+        // 先铺一行beta*self，再按倍增方式复制到整块
+        Adds(calc, selfLocal, static_cast<TC>(0), colLen);
+        PipeBarrier<PIPE_V>();
+        for (uint32_t filled = 1; filled < rows;) {
+            uint32_t count = Min(filled, rows - filled);
+            Adds(calc[filled * colLen], calc, static_cast<TC>(0), count * colLen);
+            PipeBarrier<PIPE_V>();
+            filled += count;
+        }
+    } else if (selfMode == SELF_MODE_COL || selfMode == SELF_MODE_SCALAR) {
+        selfLocal = selfVecBuf.Get<TC>();
+        for (uint32_t r = 0; r < rows; r++) {
+            TC selfScalar = selfLocal.GetValue(selfMode == SELF_MODE_COL ? r : 0);
+            Duplicate(calc[r * colLen], selfScalar, colLen);
+        }
+        PipeBarrier<PIPE_V>();
+    } else {
+        Duplicate(calc, static_cast<TC>(0), rows * colLen);
+        PipeBarrier<PIPE_V>();
+    }
+
+    for (uint32_t r = 0; r < rows; r++) {
+        AccumulateRow(calc[r * colLen], vec1Local.GetValue(r), colLen);
+    }
+
+    if constexpr (!CALC_IN_OUT) {
+        CastTo(outLocal, calc, rows * colLen);
+    }
+    outQueue.EnQue(outLocal);
+    outLocal = outQueue.DeQue<T>();
+    CopyOut(outLocal, rowStart, rows, colStart, cols, colLen);
+    outQueue.FreeTensor(outLocal);
+}
+
+template <typename TS, typename T, typename TC>
+__aicore__ inline void AddrV2ND<TS, T, TC>::CopyOut(
+    const LocalTensor<T>& outLocal, uint64_t rowStart, uint32_t rows, uint64_t colStart, uint32_t cols,
+    uint32_t colLen)
+{
+    DataCopyExtParams copyParams = {
+        static_cast<uint16_t>(rows), static_cast<uint32_t>(cols * sizeof(T)), UbRowGap<T>(cols, colLen),
+        static_cast<uint32_t>((colNum - cols) * sizeof(T)), 0};
+    DataCopyPad(yGm[rowStart * colNum + colStart], outLocal, copyParams);
+}
+} // namespace AddrV2
+
+#endif // ADDR_V2_H
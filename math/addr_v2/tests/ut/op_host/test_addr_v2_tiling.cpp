@@ -0,0 +1,226 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file test_addr_v2_tiling.cpp
+ * \brief
+ */
+
+#include <iostream>
+#include <vector>
+#include <gtest/gtest.h>
+#include "../../../op_host/addr_v2_tiling.h"
+#include "tiling_context_faker.h"
+#include "tiling_case_executor.h"
+
+class AddrV2Tiling : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        std::cout << "AddrV2Tiling SetUp" << std::endl;
+    }
+    static void TearDownTestCase()
+    {
+        std::cout << "AddrV2Tiling TearDown" << std::endl;
+    }
+};
+
+TEST_F(AddrV2Tiling, addr_v2_tiling_full_float)
+{
+    optiling::AddrV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "AddrV2",
+        {
+            {{{1024, 4096}, {1024, 4096}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{1024}, {1024}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{4096}, {4096}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{1024, 4096}, {1024, 4096}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("beta", Ops::Math::AnyValue::CreateFrom<float>(0.5f)),
+         gert::TilingContextPara::OpAttr("alpha", Ops::Math::AnyValue::CreateFrom<float>(2.0f))},
+        &compileInfo);
+    uint64_t expectTilingKey = 1;
+    std::string expectTilingData = "1024 4096 2 684 10 44 4611686019484352512 274877906945 8796093022211 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(AddrV2Tiling, addr_v2_tiling_full_float16_self_float_vec)
+{
+    optiling::AddrV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "AddrV2",
+        {
+            {{{64, 300}, {64, 300}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{64}, {64}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{300}, {300}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{64, 300}, {64, 300}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("beta", Ops::Math::AnyValue::CreateFrom<float>(0.5f)),
+         gert::TilingContextPara::OpAttr("alpha", Ops::Math::AnyValue::CreateFrom<float>(2.0f))},
+        &compileInfo);
+    uint64_t expectTilingKey = 2;
+    std::string expectTilingData = "64 300 1 64 1 0 4611686019484352512 274877906945 1305670057985 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(AddrV2Tiling, addr_v2_tiling_row_split_col)
+{
+    optiling::AddrV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "AddrV2",
+        {
+            {{{10000}, {10000}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{8}, {8}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{10000}, {10000}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{8, 10000}, {8, 10000}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("beta", Ops::Math::AnyValue::CreateFrom<float>(1.0f)),
+         gert::TilingContextPara::OpAttr("alpha", Ops::Math::AnyValue::CreateFrom<float>(1.0f))},
+        &compileInfo);
+    uint64_t expectTilingKey = 1;
+    std::string expectTilingData = "8 10000 8 64 1 0 4575657222473777152 274877906946 5394478923777 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(AddrV2Tiling, addr_v2_tiling_col_bfloat16)
+{
+    optiling::AddrV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "AddrV2",
+        {
+            {{{2000, 1}, {2000, 1}}, ge::DT_BF16, ge::FORMAT_ND},
+            {{{2000}, {2000}}, ge::DT_BF16, ge::FORMAT_ND},
+            {{{64}, {64}}, ge::DT_BF16, ge::FORMAT_ND},
+        },
+        {
+            {{{2000, 64}, {2000, 64}}, ge::DT_BF16, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("beta", Ops::Math::AnyValue::CreateFrom<float>(1.0f)),
+         gert::TilingContextPara::OpAttr("alpha", Ops::Math::AnyValue::CreateFrom<float>(1.5f))},
+        &compileInfo);
+    uint64_t expectTilingKey = 5;
+    std::string expectTilingData = "2000 64 1 63 1 0 4593671620983259136 270582939651 274877906976 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(AddrV2Tiling, addr_v2_tiling_scalar_bool)
+{
+    optiling::AddrV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "AddrV2",
+        {
+            {{{1}, {1}}, ge::DT_BOOL, ge::FORMAT_ND},
+            {{{16}, {16}}, ge::DT_BOOL, ge::FORMAT_ND},
+            {{{40}, {40}}, ge::DT_BOOL, ge::FORMAT_ND},
+        },
+        {
+            {{{16, 40}, {16, 40}}, ge::DT_BOOL, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("beta", Ops::Math::AnyValue::CreateFrom<float>(1.0f)),
+         gert::TilingContextPara::OpAttr("alpha", Ops::Math::AnyValue::CreateFrom<float>(1.0f))},
+        &compileInfo);
+    uint64_t expectTilingKey = 6;
+    std::string expectTilingData = "16 40 1 16 1 0 4575657222473777152 68719476740 274877906945 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(AddrV2Tiling, addr_v2_tiling_beta_zero_skip_self)
+{
+    optiling::AddrV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "AddrV2",
+        {
+            {{{512, 512}, {512, 512}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{512}, {512}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{512}, {512}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+        },
+        {
+            {{{512, 512}, {512, 512}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("beta", Ops::Math::AnyValue::CreateFrom<float>(0.0f)),
+         gert::TilingContextPara::OpAttr("alpha", Ops::Math::AnyValue::CreateFrom<float>(1.0f))},
+        &compileInfo);
+    uint64_t expectTilingKey = 4;
+    std::string expectTilingData = "512 512 1 64 1 0 4575657221408423936 274877906944 2199023255560 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+// self无法广播到外积shape
+TEST_F(AddrV2Tiling, addr_v2_tiling_self_not_broadcast)
+{
+    optiling::AddrV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "AddrV2",
+        {
+            {{{32, 64}, {32, 64}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{64}, {64}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{64}, {64}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{64, 64}, {64, 64}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("beta", Ops::Math::AnyValue::CreateFrom<float>(1.0f)),
+         gert::TilingContextPara::OpAttr("alpha", Ops::Math::AnyValue::CreateFrom<float>(1.0f))},
+        &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
+
+// vec1与vec2 dtype不一致
+TEST_F(AddrV2Tiling, addr_v2_tiling_vec_dtype_mismatch)
+{
+    optiling::AddrV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "AddrV2",
+        {
+            {{{64, 64}, {64, 64}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{64}, {64}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{64}, {64}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+        },
+        {
+            {{{64, 64}, {64, 64}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("beta", Ops::Math::AnyValue::CreateFrom<float>(1.0f)),
+         gert::TilingContextPara::OpAttr("alpha", Ops::Math::AnyValue::CreateFrom<float>(1.0f))},
+        &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
+
+// self为float时vec必须为float
+TEST_F(AddrV2Tiling, addr_v2_tiling_unsupported_dtype_combination)
+{
+    optiling::AddrV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "AddrV2",
+        {
+            {{{64, 64}, {64, 64}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{64}, {64}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{64}, {64}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+        },
+        {
+            {{{64, 64}, {64, 64}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("beta", Ops::Math::AnyValue::CreateFrom<float>(1.0f)),
+         gert::TilingContextPara::OpAttr("alpha", Ops::Math::AnyValue::CreateFrom<float>(1.0f))},
+        &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
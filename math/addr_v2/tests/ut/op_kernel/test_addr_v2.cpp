@@ -0,0 +1,196 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+/*!
+ * \file test_addr_v2.cpp
+ * \brief
+ */
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <cmath>
+#include <vector>
+#include "gtest/gtest.h"
+#include "tikicpulib.h"
+#include "data_utils.h"
+
+using namespace std;
+
+extern "C" __global__ __aicore__ void addr_v2(
+    GM_ADDR self, GM_ADDR vec1, GM_ADDR vec2, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling);
+
+class addr_v2_test : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        cout << "addr_v2_test SetUp\n" << endl;
+    }
+    static void TearDownTestCase()
+    {
+        cout << "addr_v2_test TearDown\n" << endl;
+    }
+};
+
+static void InitTilingData(
+    AddrV2TilingData* tilingData, uint64_t rowNum, uint64_t colNum, uint32_t rowFactor, uint32_t colFactor,
+    uint32_t blockDim)
+{
+    uint64_t colBlocks = (colNum + colFactor - 1) / colFactor;
+    uint64_t unitNum = (rowNum + rowFactor - 1) / rowFactor * colBlocks;
+    tilingData->rowNum = rowNum;
+    tilingData->colNum = colNum;
+    tilingData->colBlocks = colBlocks;
+    tilingData->unitNum = unitNum;
+    tilingData->unitsPerCore = unitNum / blockDim;
+    tilingData->tailUnits = unitNum % blockDim;
+    tilingData->usedCoreNum = blockDim;
+    tilingData->rowFactor = rowFactor;
+    tilingData->colFactor = colFactor;
+}
+
+TEST_F(addr_v2_test, test_full_float)
+{
+    // self: [8, 40] = 1, vec1[i] = i, vec2[j] = j, y = 0.5 * self + 2 * i * j
+    size_t rowNum = 8;
+    size_t colNum = 40;
+    uint32_t blockDim = 2;
+    uint8_t* self = (uint8_t*)AscendC::GmAlloc(rowNum * colNum * sizeof(float));
+    uint8_t* vec1 = (uint8_t*)AscendC::GmAlloc(rowNum * sizeof(float));
+    uint8_t* vec2 = (uint8_t*)AscendC::GmAlloc(colNum * sizeof(float));
+    uint8_t* y = (uint8_t*)AscendC::GmAlloc(rowNum * colNum * sizeof(float));
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(16 * 1024 * 1024);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(sizeof(AddrV2TilingData));
+
+    float* selfData = reinterpret_cast<float*>(self);
+    for (size_t i = 0; i < rowNum * colNum; i++) {
+        selfData[i] = 1.0f;
+    }
+    for (size_t i = 0; i < rowNum; i++) {
+        reinterpret_cast<float*>(vec1)[i] = static_cast<float>(i);
+    }
+    for (size_t j = 0; j < colNum; j++) {
+        reinterpret_cast<float*>(vec2)[j] = static_cast<float>(j);
+    }
+
+    AddrV2TilingData* tilingData = reinterpret_cast<AddrV2TilingData*>(tiling);
+    InitTilingData(tilingData, rowNum, colNum, 4, 40, blockDim);
+    tilingData->beta = 0.5f;
+    tilingData->alpha = 2.0f;
+    tilingData->selfMode = 1;
+
+    ICPU_SET_TILING_KEY(1);
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_RUN_KF(addr_v2, blockDim, self, vec1, vec2, y, workspace, (uint8_t*)(tilingData));
+
+    float* yData = reinterpret_cast<float*>(y);
+    for (size_t i = 0; i < rowNum; i++) {
+        for (size_t j = 0; j < colNum; j++) {
+            EXPECT_NEAR(yData[i * colNum + j], 0.5f + 2.0f * i * j, 1e-4f);
+        }
+    }
+
+    AscendC::GmFree(self);
+    AscendC::GmFree(vec1);
+    AscendC::GmFree(vec2);
+    AscendC::GmFree(y);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+}
+
+TEST_F(addr_v2_test, test_col_float16_self_split_col)
+{
+    // self: [8, 1] float16 = i, vec1 = 1, vec2[j] = j, 列方向切成3块且尾块不对齐, y = i + j
+    size_t rowNum = 8;
+    size_t colNum = 40;
+    uint32_t blockDim = 4;
+    uint8_t* self = (uint8_t*)AscendC::GmAlloc(rowNum * sizeof(half));
+    uint8_t* vec1 = (uint8_t*)AscendC::GmAlloc(rowNum * sizeof(float));
+    uint8_t* vec2 = (uint8_t*)AscendC::GmAlloc(colNum * sizeof(float));
+    uint8_t* y = (uint8_t*)AscendC::GmAlloc(rowNum * colNum * sizeof(float));
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(16 * 1024 * 1024);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(sizeof(AddrV2TilingData));
+
+    for (size_t i = 0; i < rowNum; i++) {
+        reinterpret_cast<half*>(self)[i] = static_cast<half>(i);
+        reinterpret_cast<float*>(vec1)[i] = 1.0f;
+    }
+    for (size_t j = 0; j < colNum; j++) {
+        reinterpret_cast<float*>(vec2)[j] = static_cast<float>(j);
+    }
+
+    AddrV2TilingData* tilingData = reinterpret_cast<AddrV2TilingData*>(tiling);
+    InitTilingData(tilingData, rowNum, colNum, 3, 16, blockDim);
+    tilingData->beta = 1.0f;
+    tilingData->alpha = 1.0f;
+    tilingData->selfMode = 3;
+
+    ICPU_SET_TILING_KEY(2);
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_RUN_KF(addr_v2, blockDim, self, vec1, vec2, y, workspace, (uint8_t*)(tilingData));
+
+    float* yData = reinterpret_cast<float*>(y);
+    for (size_t i = 0; i < rowNum; i++) {
+        for (size_t j = 0; j < colNum; j++) {
+            EXPECT_NEAR(yData[i * colNum + j], static_cast<float>(i + j), 1e-4f);
+        }
+    }
+
+    AscendC::GmFree(self);
+    AscendC::GmFree(vec1);
+    AscendC::GmFree(vec2);
+    AscendC::GmFree(y);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+}
+
+TEST_F(addr_v2_test, test_scalar_bool)
+{
+    // self: [1] = false, vec1[i] = i % 2, vec2 = true, y[i, j] = vec1[i]
+    size_t rowNum = 16;
+    size_t colNum = 40;
+    uint32_t blockDim = 2;
+    uint8_t* self = (uint8_t*)AscendC::GmAlloc(32);
+    uint8_t* vec1 = (uint8_t*)AscendC::GmAlloc(rowNum);
+    uint8_t* vec2 = (uint8_t*)AscendC::GmAlloc(colNum);
+    uint8_t* y = (uint8_t*)AscendC::GmAlloc(rowNum * colNum);
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(16 * 1024 * 1024);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(sizeof(AddrV2TilingData));
+
+    self[0] = 0;
+    for (size_t i = 0; i < rowNum; i++) {
+        vec1[i] = static_cast<uint8_t>(i % 2);
+    }
+    for (size_t j = 0; j < colNum; j++) {
+        vec2[j] = 1;
+    }
+
+    AddrV2TilingData* tilingData = reinterpret_cast<AddrV2TilingData*>(tiling);
+    InitTilingData(tilingData, rowNum, colNum, 8, 64, blockDim);
+    tilingData->beta = 1.0f;
+    tilingData->alpha = 1.0f;
+    tilingData->selfMode = 4;
+
+    ICPU_SET_TILING_KEY(6);
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_RUN_KF(addr_v2, blockDim, self, vec1, vec2, y, workspace, (uint8_t*)(tilingData));
+
+    for (size_t i = 0; i < rowNum; i++) {
+        for (size_t j = 0; j < colNum; j++) {
+            EXPECT_EQ(y[i * colNum + j], static_cast<uint8_t>(i % 2));
+        }
+    }
+
+    AscendC::GmFree(self);
+    AscendC::GmFree(vec1);
+    AscendC::GmFree(vec2);
+    AscendC::GmFree(y);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+}
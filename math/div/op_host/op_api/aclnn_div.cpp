@@ -12,6 +12,7 @@
 #include "aclnn_div.h"
 #include "aclnn_kernels/cast.h"
 #include "aclnn_kernels/contiguous.h"
+#include "common/level2_elementwise_dispatch.h"
 #include "math/floor_div/op_host/op_api/floordiv.h"
 #include "math/real_div/op_host/op_api/realdiv.h"
 #include "math/trunc/op_host/op_api/trunc.h"
@@ -391,28 +392,27 @@ aclnnStatus aclnnDivGetWorkspaceSize(
                            CompatibleInferDivDtype(self->GetDataType(), other->GetDataType()) :
                            InferDivModeDtype(self->GetDataType(), other->GetDataType(), MODE_REAL_DIV);
 
-    // 固定写法，将输入other转换成连续的tensor
-    auto otherContiguous = l0op::Contiguous(other, uniqueExecutor.get());
-    CHECK_RET(otherContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
-
-    // 固定写法，将输入self转换成连续的tensor
-    auto selfContiguous = l0op::Contiguous(self, uniqueExecutor.get());
-    CHECK_RET(selfContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    // 一次性计算广播类别、输入连续性与Cast需求，按路径表只执行必要的Contiguous/Cast
+    const auto& plan = ElementwiseDispatcher::Select(ElementwiseDispatcher::Classify(self, other, out, promoteType));
 
-    // 将输入other的数据类型转换成隐式数据类型，根据具体算子语义按需调用
-    auto otherCasted = l0op::Cast(otherContiguous, promoteType, uniqueExecutor.get());
+    // 将输入other转换成连续的tensor并转换成隐式数据类型
+    auto otherCasted = ElementwiseDispatcher::PrepareInput(
+        other, plan, ELEMENTWISE_STEP_CONTIGUOUS_OTHER, ELEMENTWISE_STEP_CAST_OTHER, promoteType, uniqueExecutor.get());
     CHECK_RET(otherCasted != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
-    // 将输入self的数据类型转换成隐式数据类型，根据具体算子语义按需调用
-    auto selfCasted = l0op::Cast(selfContiguous, promoteType, uniqueExecutor.get());
+    // 将输入self转换成连续的tensor并转换成隐式数据类型
+    auto selfCasted = ElementwiseDispatcher::PrepareInput(
+        self, plan, ELEMENTWISE_STEP_CONTIGUOUS_SELF, ELEMENTWISE_STEP_CAST_SELF, promoteType, uniqueExecutor.get());
     CHECK_RET(selfCasted != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
     // 调用l0算子RealDiv进行计算
     const aclTensor* divOpOut = l0op::RealDiv(selfCasted, otherCasted, uniqueExecutor.get());
     CHECK_RET(divOpOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
-    // 固定写法，将计算结果转换成输出out的数据类型
-    auto castOut = l0op::Cast(divOpOut, out->GetDataType(), uniqueExecutor.get());
+    // 计算结果与out类型不一致时才需要Cast
+    auto castOut = plan.Has(ELEMENTWISE_STEP_CAST_OUT) ?
+                       l0op::Cast(divOpOut, out->GetDataType(), uniqueExecutor.get()) :
+                       divOpOut;
     CHECK_RET(castOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
     // 固定写法，将计算结果拷贝到输出out上，out可能是非连续的tensor
@@ -16,6 +16,7 @@
 
 #include "aclnn_dot.h"
 #include "dot.h"
+#include "../../../dot_v2/op_host/op_api/dot_v2.h"
 #include "conversion/fill/op_host/op_api/fill.h"
 #include "aclnn_kernels/cast.h"
 #include "aclnn_kernels/contiguous.h"
@@ -102,6 +103,46 @@ static aclnnStatus CheckParams(const aclTensor* self, const aclTensor* tensor, c
     return ACLNN_SUCCESS;
 }
 
+// 跨步在[1, DOT_V2_MAX_STRIDE]内时构造以首元素为起点、覆盖跨步区间的视图交给kernel直接读取，否则先做Contiguous
+static const aclTensor* StridedVectorView(const aclTensor* x, int64_t& stride, aclOpExecutor* executor)
+{
+    int64_t len = x->GetViewShape().GetDim(0);
+    stride = len > 1 ? x->GetViewStrides()[0] : 1;
+    if (stride < 1 || stride > l0op::DOT_V2_MAX_STRIDE) {
+        stride = 1;
+        return l0op::Contiguous(x, executor);
+    }
+    if (stride == 1 && x->GetViewOffset() == 0 && x->GetStorageShape().GetShapeSize() == len) {
+        return x;
+    }
+    executor->AbandonCache();
+    op::Shape spanShape = {(len - 1) * stride + 1};
+    auto xView = executor->CreateView(x, spanShape, 0);
+    CHECK_RET(xView != nullptr, nullptr);
+    xView->SetStorageShape(spanShape);
+    xView->SetOriginalShape(spanShape);
+    xView->SetStorageAddr(x->GetStorageAddr());
+    xView->SetStorageOffset(x->GetViewOffset() + x->GetStorageOffset());
+    return xView;
+}
+
+static aclnnStatus DotV2Proc(const aclTensor* self, const aclTensor* tensor, aclTensor* out, aclOpExecutor* executor)
+{
+    int64_t selfStride = 1;
+    int64_t tensorStride = 1;
+    auto selfView = StridedVectorView(self, selfStride, executor);
+    CHECK_RET(selfView != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    auto tensorView = StridedVectorView(tensor, tensorStride, executor);
+    CHECK_RET(tensorView != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    auto dotOut = l0op::DotV2(selfView, tensorView, selfStride, tensorStride, executor);
+    CHECK_RET(dotOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    auto viewCopyResult = l0op::ViewCopy(dotOut, out, executor);
+    CHECK_RET(viewCopyResult != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    return ACLNN_SUCCESS;
+}
+
 aclnnStatus aclnnDotGetWorkspaceSize(
     const aclTensor* self, const aclTensor* tensor, aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor)
 {
@@ -144,6 +185,15 @@ aclnnStatus aclnnDotGetWorkspaceSize(
         return ACLNN_SUCCESS;
     }
 
+    // 浮点类型走多核确定性Dot，直接读取跨步输入
+    if (l0op::IsDotV2Support(self)) {
+        auto dotRet = DotV2Proc(self, tensor, out, uniqueExecutor.get());
+        CHECK_RET(dotRet == ACLNN_SUCCESS, dotRet);
+        *workspaceSize = uniqueExecutor->GetWorkspaceSize();
+        uniqueExecutor.ReleaseTo(executor);
+        return ACLNN_SUCCESS;
+    }
+
     // 固定写法，将输入self转换成连续的Tensor
     auto contiguousSelf = l0op::Contiguous(self, uniqueExecutor.get());
     CHECK_RET(contiguousSelf != nullptr, ACLNN_ERR_INNER_NULLPTR);
@@ -429,4 +429,34 @@ TEST_F(l2_dot_test, l2_dot_normal_uncontiguous)
     aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
     EXPECT_EQ(aclRet, ACLNN_SUCCESS);
 
-}
\ No newline at end of file
+}
+
+// 多核确定性Dot_长向量_BF16
+TEST_F(l2_dot_test, ascend910B2_l2_dot_split_k_BF16)
+{
+    auto selfDesc = TensorDesc({100000}, ACL_BF16, ACL_FORMAT_ND);
+    auto tensorDesc = TensorDesc({100000}, ACL_BF16, ACL_FORMAT_ND);
+    auto outDesc = TensorDesc({}, ACL_BF16, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnDot, INPUT(selfDesc, tensorDesc), OUTPUT(outDesc));
+
+    // only test GetWorkspaceSize
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
+
+// 多核确定性Dot_跨步输入直接读取
+TEST_F(l2_dot_test, ascend910B2_l2_dot_split_k_strided)
+{
+    auto selfDesc = TensorDesc({4}, ACL_FLOAT16, ACL_FORMAT_ND, {2}, 0, {8});
+    auto tensorDesc = TensorDesc({4}, ACL_FLOAT16, ACL_FORMAT_ND, {32}, 0, {128});
+    auto outDesc = TensorDesc({}, ACL_FLOAT16, ACL_FORMAT_ND);
+
+    auto ut = OP_API_UT(aclnnDot, INPUT(selfDesc, tensorDesc), OUTPUT(outDesc));
+
+    // only test GetWorkspaceSize
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_SUCCESS);
+}
@@ -0,0 +1,215 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file dot_v2_tiling.cpp
+ * \brief
+ */
+#include <algorithm>
+#include "dot_v2_tiling.h"
+#include "log/log.h"
+#include "register/op_def_registry.h"
+#include "tiling_base/tiling_templates_registry.h"
+#include "platform/platform_info.h"
+
+namespace optiling {
+constexpr int32_t X_INPUT_INDEX = 0;
+constexpr int32_t Y_INPUT_INDEX = 1;
+constexpr size_t STRIDE_X_ATTR_INDEX = 0;
+constexpr size_t STRIDE_Y_ATTR_INDEX = 1;
+constexpr uint32_t FLOAT_BYTES = 4;
+constexpr uint32_t BUFFER_NUM = 2;
+constexpr uint32_t RESERVED_UB = 1024;
+constexpr uint32_t REDUCE_WORK_BYTES = 1024;
+constexpr uint32_t CHUNK_LEN = 4096;      // 块长固定，块内规约与块间树形合并的顺序都与核数无关
+constexpr uint32_t MIN_PIECE_LEN = 64;
+constexpr uint32_t PARTIAL_BATCH = 1024;
+constexpr int64_t MAX_STRIDE = 16;        // 与op_api一致，更大的间隔先做Contiguous
+
+struct DotV2DtypeKey {
+    ge::DataType dtype;
+    uint64_t tilingKey;
+};
+
+static const DotV2DtypeKey DTYPE_KEYS[] = {
+    {ge::DT_FLOAT, 1},
+    {ge::DT_FLOAT16, 2},
+    {ge::DT_BF16, 3},
+};
+
+static inline uint64_t CeilDiv(uint64_t a, uint64_t b)
+{
+    return b == 0 ? a : (a + b - 1) / b;
+}
+
+static inline uint64_t CeilAlign(uint64_t a, uint64_t b)
+{
+    return CeilDiv(a, b) * b;
+}
+
+// 输入为以首元素为起点的跨步视图，storage长度为(n - 1) * stride + 1
+static ge::graphStatus GetVectorLen(
+    gert::TilingContext* context, int32_t inputIndex, int64_t stride, uint64_t& len)
+{
+    auto shape = context->GetInputShape(inputIndex);
+    OP_CHECK_NULL_WITH_CONTEXT(context, shape);
+    const gert::Shape& storageShape = shape->GetStorageShape();
+    OP_CHECK_IF(
+        storageShape.GetDimNum() != 1, OP_LOGE(context->GetNodeName(), "input %d should be 1D.", inputIndex),
+        return ge::GRAPH_FAILED);
+    int64_t span = storageShape.GetDim(0);
+    OP_CHECK_IF(
+        span <= 0, OP_LOGE(context->GetNodeName(), "input %d should not be empty.", inputIndex),
+        return ge::GRAPH_FAILED);
+    len = static_cast<uint64_t>((span - 1) / stride + 1);
+    return ge::GRAPH_SUCCESS;
+}
+
+static void CalcTilingData(uint32_t typeSize, uint32_t coreNum, uint32_t ubSize, DotV2TilingData& tilingData)
+{
+    uint64_t totalLen = tilingData.get_totalLen();
+    uint64_t maxStride = std::max(tilingData.get_strideX(), tilingData.get_strideY());
+    // 乘积缓存、规约work与部分和缓存之外，按片搬入x/y的跨步区间（double buffer）、gather偏移、gather结果与fp32转换结果
+    uint64_t fixedBytes = RESERVED_UB + CHUNK_LEN * FLOAT_BYTES + REDUCE_WORK_BYTES + PARTIAL_BATCH * FLOAT_BYTES;
+    uint64_t perElem = BUFFER_NUM * (BUFFER_NUM * typeSize * maxStride + FLOAT_BYTES + typeSize + FLOAT_BYTES);
+    uint64_t maxPiece = ubSize > fixedBytes ? (ubSize - fixedBytes) / perElem : 0;
+    // 片长取2的幂，保证整除块长
+    uint32_t pieceLen = CHUNK_LEN;
+    while (pieceLen > maxPiece && pieceLen >= MIN_PIECE_LEN) {
+        pieceLen /= BUFFER_NUM;
+    }
+    if (pieceLen < MIN_PIECE_LEN) {
+        pieceLen = 0;
+    }
+
+    uint64_t chunkNum = CeilDiv(totalLen, CHUNK_LEN);
+    uint64_t usedCoreNum = std::max<uint64_t>(1, std::min<uint64_t>(coreNum, chunkNum));
+    tilingData.set_chunkNum(chunkNum);
+    tilingData.set_chunksPerCore(chunkNum / usedCoreNum);
+    tilingData.set_tailChunks(chunkNum % usedCoreNum);
+    tilingData.set_chunkLen(CHUNK_LEN);
+    tilingData.set_pieceLen(pieceLen);
+    tilingData.set_usedCoreNum(static_cast<uint32_t>(usedCoreNum));
+    tilingData.set_partialBatch(PARTIAL_BATCH);
+}
+
+static void PrintTilingData(gert::TilingContext* context, DotV2TilingData& tilingData)
+{
+    const ge::char_t* nodeName = context->GetNodeName();
+    OP_LOGD(nodeName, "totalLen: %lu", tilingData.get_totalLen());
+    OP_LOGD(nodeName, "chunkNum: %lu", tilingData.get_chunkNum());
+    OP_LOGD(nodeName, "chunksPerCore: %lu", tilingData.get_chunksPerCore());
+    OP_LOGD(nodeName, "tailChunks: %lu", tilingData.get_tailChunks());
+    OP_LOGD(nodeName, "strideX: %lu", tilingData.get_strideX());
+    OP_LOGD(nodeName, "strideY: %lu", tilingData.get_strideY());
+    OP_LOGD(nodeName, "chunkLen: %u", tilingData.get_chunkLen());
+    OP_LOGD(nodeName, "pieceLen: %u", tilingData.get_pieceLen());
+    OP_LOGD(nodeName, "usedCoreNum: %u", tilingData.get_usedCoreNum());
+    OP_LOGD(nodeName, "partialBatch: %u", tilingData.get_partialBatch());
+}
+
+static ge::graphStatus Tiling4DotV2(gert::TilingContext* context)
+{
+    OP_LOGI(context->GetNodeName(), "DotV2 tiling starts running");
+    auto compileInfo = reinterpret_cast<const DotV2CompileInfo*>(context->GetCompileInfo());
+    OP_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    OP_CHECK_IF(
+        compileInfo->vectorCoreNum <= 0 || compileInfo->ubByteSize <= RESERVED_UB,
+        OP_LOGE(context->GetNodeName(), "Failed to get core num or ub size."), return ge::GRAPH_FAILED);
+
+    auto xDesc = context->GetInputDesc(X_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, xDesc);
+    auto yDesc = context->GetInputDesc(Y_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, yDesc);
+    ge::DataType dtype = xDesc->GetDataType();
+    OP_CHECK_IF(
+        yDesc->GetDataType() != dtype, OP_LOGE(context->GetNodeName(), "x and y should have the same dtype."),
+        return ge::GRAPH_FAILED);
+    uint64_t tilingKey = 0;
+    for (const auto& item : DTYPE_KEYS) {
+        if (item.dtype == dtype) {
+            tilingKey = item.tilingKey;
+        }
+    }
+    OP_CHECK_IF(
+        tilingKey == 0, OP_LOGE(context->GetNodeName(), "dtype is not supported."), return ge::GRAPH_FAILED);
+
+    const gert::RuntimeAttrs* attrs = context->GetAttrs();
+    OP_CHECK_NULL_WITH_CONTEXT(context, attrs);
+    const int64_t* strideXPtr = attrs->GetAttrPointer<int64_t>(STRIDE_X_ATTR_INDEX);
+    const int64_t* strideYPtr = attrs->GetAttrPointer<int64_t>(STRIDE_Y_ATTR_INDEX);
+    int64_t strideX = strideXPtr == nullptr ? 1 : *strideXPtr;
+    int64_t strideY = strideYPtr == nullptr ? 1 : *strideYPtr;
+    OP_CHECK_IF(
+        strideX <= 0 || strideX > MAX_STRIDE || strideY <= 0 || strideY > MAX_STRIDE,
+        OP_LOGE(context->GetNodeName(), "stride should be in [1, %ld], but got %ld and %ld.", MAX_STRIDE, strideX,
+                strideY),
+        return ge::GRAPH_FAILED);
+
+    uint64_t lenX = 0;
+    uint64_t lenY = 0;
+    OP_CHECK_IF(
+        GetVectorLen(context, X_INPUT_INDEX, strideX, lenX) != ge::GRAPH_SUCCESS ||
+            GetVectorLen(context, Y_INPUT_INDEX, strideY, lenY) != ge::GRAPH_SUCCESS,
+        OP_LOGE(context->GetNodeName(), "get vector length failed."), return ge::GRAPH_FAILED);
+    OP_CHECK_IF(
+        lenX != lenY, OP_LOGE(context->GetNodeName(), "x len %lu and y len %lu should be same.", lenX, lenY),
+        return ge::GRAPH_FAILED);
+
+    DotV2TilingData tilingData;
+    tilingData.set_totalLen(lenX);
+    tilingData.set_strideX(static_cast<uint64_t>(strideX));
+    tilingData.set_strideY(static_cast<uint64_t>(strideY));
+    CalcTilingData(
+        ge::GetSizeByDataType(dtype), compileInfo->vectorCoreNum, compileInfo->ubByteSize, tilingData);
+    OP_CHECK_IF(
+        tilingData.get_pieceLen() == 0,
+        OP_LOGE(context->GetNodeName(), "ub space is not enough, please check input."), return ge::GRAPH_FAILED);
+
+    context->SetTilingKey(tilingKey);
+    context->SetBlockDim(tilingData.get_usedCoreNum());
+    // 两段ping-pong区域存放逐层合并的部分和
+    uint64_t chunkNum = tilingData.get_chunkNum();
+    size_t* workspaces = context->GetWorkspaceSizes(1);
+    workspaces[0] = compileInfo->sysWorkspaceByteSize +
+                    (CeilAlign(chunkNum, CHUNK_LEN) + CeilAlign(CeilDiv(chunkNum, CHUNK_LEN), CHUNK_LEN)) *
+                        FLOAT_BYTES;
+    tilingData.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tilingData.GetDataSize());
+    PrintTilingData(context, tilingData);
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus TilingPrepare4DotV2(gert::TilingParseContext* context)
+{
+    auto compileInfo = context->GetCompiledInfo<DotV2CompileInfo>();
+    OP_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    auto platformInfo = context->GetPlatformInfo();
+    OP_CHECK_NULL_WITH_CONTEXT(context, platformInfo);
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(platformInfo);
+    compileInfo->vectorCoreNum = ascendcPlatform.GetCoreNumAiv();
+    OP_CHECK_IF(
+        (compileInfo->vectorCoreNum <= 0), OP_LOGE(context->GetNodeName(), "No vector core available."),
+        return ge::GRAPH_FAILED);
+    uint64_t ubByteSize;
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ubByteSize);
+    compileInfo->ubByteSize = ubByteSize;
+    OP_CHECK_IF(
+        (compileInfo->ubByteSize <= 0), OP_LOGE(context->GetNodeName(), "Failed to get ub size."),
+        return ge::GRAPH_FAILED);
+    compileInfo->sysWorkspaceByteSize = ascendcPlatform.GetLibApiWorkSpaceSize();
+    return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_OPTILING(DotV2)
+    .Tiling(Tiling4DotV2)
+    .TilingParse<DotV2CompileInfo>(TilingPrepare4DotV2);
+} // namespace optiling
@@ -0,0 +1,42 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file dot_v2_tiling.h
+ * \brief
+ */
+#ifndef OPS_BUILT_IN_OP_TILING_RUNTIME_DOT_V2_H_
+#define OPS_BUILT_IN_OP_TILING_RUNTIME_DOT_V2_H_
+
+#include "register/tilingdata_base.h"
+
+namespace optiling {
+BEGIN_TILING_DATA_DEF(DotV2TilingData)
+TILING_DATA_FIELD_DEF(uint64_t, totalLen);      // 向量长度
+TILING_DATA_FIELD_DEF(uint64_t, chunkNum);      // 按chunkLen切分的块数，每块产生一个fp32部分和
+TILING_DATA_FIELD_DEF(uint64_t, chunksPerCore); // 每核处理的块数
+TILING_DATA_FIELD_DEF(uint64_t, tailChunks);    // 前tailChunks个核多处理一块
+TILING_DATA_FIELD_DEF(uint64_t, strideX);       // x相邻元素在GM上的间隔
+TILING_DATA_FIELD_DEF(uint64_t, strideY);       // y相邻元素在GM上的间隔
+TILING_DATA_FIELD_DEF(uint32_t, chunkLen);      // 固定块长，与核数无关，保证结果可复现
+TILING_DATA_FIELD_DEF(uint32_t, pieceLen);      // 每次搬入的元素数，整除chunkLen
+TILING_DATA_FIELD_DEF(uint32_t, usedCoreNum);
+TILING_DATA_FIELD_DEF(uint32_t, partialBatch);  // 部分和在UB中攒满后批量写回workspace
+END_TILING_DATA_DEF;
+REGISTER_TILING_DATA_CLASS(DotV2, DotV2TilingData)
+
+struct DotV2CompileInfo {
+    uint32_t vectorCoreNum;
+    uint32_t sysWorkspaceByteSize;
+    uint32_t ubByteSize;
+};
+} // namespace optiling
+#endif // OPS_BUILT_IN_OP_TILING_RUNTIME_DOT_V2_H_
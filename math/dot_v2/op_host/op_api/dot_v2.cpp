@@ -0,0 +1,64 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file dot_v2.cpp
+ * \brief
+ */
+
+#include "dot_v2.h"
+#include "opdev/data_type_utils.h"
+#include "opdev/format_utils.h"
+#include "opdev/make_op_executor.h"
+#include "opdev/op_def.h"
+#include "opdev/op_dfx.h"
+#include "opdev/op_executor.h"
+#include "opdev/op_log.h"
+#include "opdev/platform.h"
+#include "opdev/shape_utils.h"
+
+using namespace op;
+
+namespace l0op {
+OP_TYPE_REGISTER(DotV2);
+
+static const std::initializer_list<op::DataType> AICORE_DTYPE_SUPPORT_LIST = {
+    DataType::DT_FLOAT, DataType::DT_FLOAT16, DataType::DT_BF16};
+
+bool IsDotV2Support(const aclTensor* self)
+{
+    SocVersion socVersion = GetCurrentPlatformInfo().GetSocVersion();
+    if (socVersion != SocVersion::ASCEND910B && socVersion != SocVersion::ASCEND910_93) {
+        return false;
+    }
+    return CheckType(self->GetDataType(), AICORE_DTYPE_SUPPORT_LIST);
+}
+
+const aclTensor* DotV2(
+    const aclTensor* self, const aclTensor* tensor, int64_t selfStride, int64_t tensorStride,
+    aclOpExecutor* executor)
+{
+    L0_DFX(DotV2, self, tensor, selfStride, tensorStride);
+
+    Shape outShape;
+    outShape.SetDimNum(0);
+    auto out = executor->AllocTensor(outShape, self->GetDataType(), Format::FORMAT_ND);
+    CHECK_RET(out != nullptr, nullptr);
+
+    auto ret = ADD_TO_LAUNCHER_LIST_AICORE(
+        DotV2, OP_INPUT(self, tensor), OP_OUTPUT(out), OP_ATTR(selfStride, tensorStride));
+    if (ret != ACLNN_SUCCESS) {
+        OP_LOGE(ACLNN_ERR_INNER_NULLPTR, "DotV2 ADD_TO_LAUNCHER_LIST_AICORE failed.");
+        return nullptr;
+    }
+    return out;
+}
+} // namespace l0op
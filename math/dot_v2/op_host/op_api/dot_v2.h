@@ -0,0 +1,34 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file dot_v2.h
+ * \brief
+ */
+
+#ifndef OP_API_INC_LEVEL0_DOT_V2_H
+#define OP_API_INC_LEVEL0_DOT_V2_H
+#include "opdev/op_executor.h"
+
+namespace l0op {
+// 芯片与dtype是否可走多核确定性Dot kernel
+bool IsDotV2Support(const aclTensor* self);
+
+// 输入跨步不超过该值时kernel直接读取跨步数据，无需Contiguous
+constexpr int64_t DOT_V2_MAX_STRIDE = 16;
+
+// self、tensor为以首元素为起点的跨步视图，storage长度为(n - 1) * stride + 1；fp16/bf16在kernel内按fp32累加
+const aclTensor* DotV2(
+    const aclTensor* self, const aclTensor* tensor, int64_t selfStride, int64_t tensorStride,
+    aclOpExecutor* executor);
+} // namespace l0op
+
+#endif // OP_API_INC_LEVEL0_DOT_V2_H
@@ -0,0 +1,332 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file dot_v2.h
+ * \brief 多核切分的确定性Dot
+ *
+ * 向量按固定块长chunkLen切分，块按顺序均分到各核。每块内按片搬入x/y，跨步输入搬入跨步区间后用Gather取出有效元素，
+ * 转fp32后相乘写入块乘积缓存，整块一次ReduceSum得到部分和写入workspace。所有核同步后由0核对部分和按chunkLen一组
+ * 逐层ReduceSum，块划分与合并顺序都只依赖向量长度，结果与核数、运行次数无关。
+ */
+#ifndef DOT_V2_H
+#define DOT_V2_H
+
+#include "kernel_operator.h"
+
+namespace DotV2 {
+using namespace AscendC;
+
+constexpr int32_t BUFFER_NUM = 2;
+constexpr uint32_t BYTE_BLOCK = 32;
+constexpr uint32_t REDUCE_WORK_BYTES = 1024;
+
+template <typename T>
+class DotV2ND {
+public:
+    __aicore__ inline DotV2ND(){};
+    __aicore__ inline void Init(
+        GM_ADDR x, GM_ADDR y, GM_ADDR z, GM_ADDR workspace, const DotV2TilingData* __restrict tilingData);
+    __aicore__ inline void Process();
+
+private:
+    __aicore__ inline float ComputeChunk(uint64_t chunkIdx);
+    __aicore__ inline LocalTensor<float> LoadPiece(
+        TQue<QuePosition::VECIN, BUFFER_NUM>& inQueue, TBuf<QuePosition::VECCALC>& offsetBuf,
+        TBuf<QuePosition::VECCALC>& gatherBuf, TBuf<QuePosition::VECCALC>& castBuf, const GlobalTensor<T>& srcGm,
+        uint64_t stride, uint64_t elemStart, uint32_t len);
+    __aicore__ inline float ReduceLocal(const LocalTensor<float>& src, uint32_t len);
+    __aicore__ inline void PushPartial(const GlobalTensor<float>& dstGm, uint64_t idx, float value, bool flush);
+    __aicore__ inline float TreeReduce();
+    __aicore__ inline void CopyOut(float result);
+    __aicore__ inline void InitOffsets(TBuf<QuePosition::VECCALC>& offsetBuf, uint64_t stride);
+
+    template <typename T1>
+    __aicore__ inline T1 CeilDiv(T1 a, T1 b)
+    {
+        return b == 0 ? a : (a + b - 1) / b;
+    }
+
+    template <typename T1>
+    __aicore__ inline T1 Min(T1 a, T1 b)
+    {
+        return a < b ? a : b;
+    }
+
+    template <HardEvent EVENT>
+    __aicore__ inline void SyncFlag()
+    {
+        event_t eventId = static_cast<event_t>(GetTPipePtr()->FetchEventID(EVENT));
+        SetFlag<EVENT>(eventId);
+        WaitFlag<EVENT>(eventId);
+    }
+
+private:
+    TPipe pipe;
+    TQue<QuePosition::VECIN, BUFFER_NUM> inQueueX;
+    TQue<QuePosition::VECIN, BUFFER_NUM> inQueueY;
+    TBuf<QuePosition::VECCALC> offsetXBuf;
+    TBuf<QuePosition::VECCALC> offsetYBuf;
+    TBuf<QuePosition::VECCALC> gatherXBuf;
+    TBuf<QuePosition::VECCALC> gatherYBuf;
+    TBuf<QuePosition::VECCALC> castXBuf;
+    TBuf<QuePosition::VECCALC> castYBuf;
+    TBuf<QuePosition::VECCALC> prodBuf;
+    TBuf<QuePosition::VECCALC> workBuf;
+    TBuf<QuePosition::VECCALC> sumBuf;
+    TBuf<QuePosition::VECCALC> partialBuf;
+    TBuf<QuePosition::VECCALC> outBuf;
+    GlobalTensor<T> xGm;
+    GlobalTensor<T> yGm;
+    GlobalTensor<T> zGm;
+    GlobalTensor<float> partialGm;
+    GlobalTensor<float> mergeGm;
+
+    uint64_t totalLen = 0;
+    uint64_t chunkNum = 0;
+    uint64_t chunkStart = 0;
+    uint64_t coreChunkNum = 0;
+    uint64_t strideX = 1;
+    uint64_t strideY = 1;
+    uint64_t batchStart = 0;
+    uint32_t batchCount = 0;
+    uint32_t chunkLen = 0;
+    uint32_t pieceLen = 0;
+    uint32_t partialBatch = 0;
+};
+
+template <typename T>
+__aicore__ inline void DotV2ND<T>::Init(
+    GM_ADDR x, GM_ADDR y, GM_ADDR z, GM_ADDR workspace, const DotV2TilingData* __restrict tilingData)
+{
+    uint64_t blockIdx = GetBlockIdx();
+    uint64_t chunksPerCore = tilingData->chunksPerCore;
+    uint64_t tailChunks = tilingData->tailChunks;
+    coreChunkNum = chunksPerCore + (blockIdx < tailChunks ? 1 : 0);
+    chunkStart = blockIdx * chunksPerCore + (blockIdx < tailChunks ? blockIdx : tailChunks);
+    totalLen = tilingData->totalLen;
+    chunkNum = tilingData->chunkNum;
+    strideX = tilingData->strideX;
+    strideY = tilingData->strideY;
+    chunkLen = tilingData->chunkLen;
+    pieceLen = tilingData->pieceLen;
+    partialBatch = tilingData->partialBatch;
+
+    xGm.SetGlobalBuffer((__gm__ T*)x);
+    yGm.SetGlobalBuffer((__gm__ T*)y);
+    zGm.SetGlobalBuffer((__gm__ T*)z);
+    // 两段ping-pong区域：第一段存放各块部分和，逐层合并结果在两段之间交替写入
+    uint64_t regionLen = CeilDiv(chunkNum, static_cast<uint64_t>(chunkLen)) * chunkLen;
+    partialGm.SetGlobalBuffer((__gm__ float*)workspace);
+    mergeGm.SetGlobalBuffer((__gm__ float*)workspace + regionLen);
+
+    pipe.InitBuffer(inQueueX, BUFFER_NUM, pieceLen * strideX * sizeof(T));
+    pipe.InitBuffer(inQueueY, BUFFER_NUM, pieceLen * strideY * sizeof(T));
+    if (strideX != 1) {
+        pipe.InitBuffer(offsetXBuf, pieceLen * sizeof(uint32_t));
+        pipe.InitBuffer(gatherXBuf, pieceLen * sizeof(T));
+        InitOffsets(offsetXBuf, strideX);
+    }
+    if (strideY != 1) {
+        pipe.InitBuffer(offsetYBuf, pieceLen * sizeof(uint32_t));
+        pipe.InitBuffer(gatherYBuf, pieceLen * sizeof(T));
+        InitOffsets(offsetYBuf, strideY);
+    }
+    if constexpr (!IsSameType<T, float>::value) {
+        pipe.InitBuffer(castXBuf, pieceLen * sizeof(float));
+        pipe.InitBuffer(castYBuf, pieceLen * sizeof(float));
+    }
+    pipe.InitBuffer(prodBuf, chunkLen * sizeof(float));
+    pipe.InitBuffer(workBuf, REDUCE_WORK_BYTES);
+    pipe.InitBuffer(sumBuf, BYTE_BLOCK);
+    pipe.InitBuffer(partialBuf, partialBatch * sizeof(float));
+    pipe.InitBuffer(outBuf, BYTE_BLOCK);
+}
+
+// Gather使用的字节偏移：第i个元素位于跨步区间的i * stride处
+template <typename T>
+__aicore__ inline void DotV2ND<T>::InitOffsets(TBuf<QuePosition::VECCALC>& offsetBuf, uint64_t stride)
+{
+    LocalTensor<int32_t> offsetLocal = offsetBuf.Get<int32_t>();
+    CreateVecIndex(offsetLocal, static_cast<int32_t>(0), pieceLen);
+    PipeBarrier<PIPE_V>();
+    Muls(offsetLocal, offsetLocal, static_cast<int32_t>(stride * sizeof(T)), pieceLen);
+    PipeBarrier<PIPE_V>();
+}
+
+template <typename T>
+__aicore__ inline void DotV2ND<T>::Process()
+{
+    for (uint64_t i = 0; i < coreChunkNum; i++) {
+        float partial = ComputeChunk(chunkStart + i);
+        PushPartial(partialGm, chunkStart + i, partial, i + 1 == coreChunkNum);
+    }
+    SyncAll();
+    if (GetBlockIdx() != 0) {
+        return;
+    }
+    CopyOut(TreeReduce());
+}
+
+// 搬入一片跨步区间，取出有效元素并转为fp32
+template <typename T>
+__aicore__ inline LocalTensor<float> DotV2ND<T>::LoadPiece(
+    TQue<QuePosition::VECIN, BUFFER_NUM>& inQueue, TBuf<QuePosition::VECCALC>& offsetBuf,
+    TBuf<QuePosition::VECCALC>& gatherBuf, TBuf<QuePosition::VECCALC>& castBuf, const GlobalTensor<T>& srcGm,
+    uint64_t stride, uint64_t elemStart, uint32_t len)
+{
+    LocalTensor<T> inLocal = inQueue.AllocTensor<T>();
+    uint32_t span = static_cast<uint32_t>((len - 1) * stride + 1);
+    DataCopyExtParams copyParams = {1, static_cast<uint32_t>(span * sizeof(T)), 0, 0, 0};
+    DataCopyPadExtParams<T> padParams = {false, 0, 0, static_cast<T>(0)};
+    DataCopyPad(inLocal, srcGm[elemStart * stride], copyParams, padParams);
+    inQueue.EnQue(inLocal);
+    inLocal = inQueue.DeQue<T>();
+
+    LocalTensor<T> denseLocal = inLocal;
+    if (stride != 1) {
+        denseLocal = gatherBuf.Get<T>();
+        LocalTensor<uint32_t> offsetLocal = offsetBuf.Get<uint32_t>();
+        if constexpr (sizeof(T) == sizeof(half)) {
+            LocalTensor<half> dstHalf = denseLocal.template ReinterpretCast<half>();
+            LocalTensor<half> srcHalf = inLocal.template ReinterpretCast<half>();
+            Gather(dstHalf, srcHalf, offsetLocal, static_cast<uint32_t>(0), len);
+        } else {
+            Gather(denseLocal, inLocal, offsetLocal, static_cast<uint32_t>(0), len);
+        }
+        PipeBarrier<PIPE_V>();
+    }
+    LocalTensor<float> result;
+    if constexpr (IsSameType<T, float>::value) {
+        if (stride == 1) {
+            // 连续fp32输入直接参与乘法，乘完后再释放
+            result = inLocal;
+            return result;
+        }
+        result = denseLocal;
+    } else {
+        result = castBuf.Get<float>();
+        Cast(result, denseLocal, RoundMode::CAST_NONE, len);
+        PipeBarrier<PIPE_V>();
+    }
+    inQueue.FreeTensor(inLocal);
+    return result;
+}
+
+template <typename T>
+__aicore__ inline float DotV2ND<T>::ReduceLocal(const LocalTensor<float>& src, uint32_t len)
+{
+    LocalTensor<float> sumLocal = sumBuf.Get<float>();
+    LocalTensor<float> workLocal = workBuf.Get<float>();
+    ReduceSum<float>(sumLocal, src, workLocal, len);
+    SyncFlag<HardEvent::V_S>();
+    float sum = sumLocal.GetValue(0);
+    SyncFlag<HardEvent::S_V>();
+    return sum;
+}
+
+// 块内按片生成乘积，整块一次规约，块内求和顺序与片长、跨步无关
+template <typename T>
+__aicore__ inline float DotV2ND<T>::ComputeChunk(uint64_t chunkIdx)
+{
+    uint64_t elemStart = chunkIdx * chunkLen;
+    uint32_t len = static_cast<uint32_t>(Min(static_cast<uint64_t>(chunkLen), totalLen - elemStart));
+    LocalTensor<float> prodLocal = prodBuf.Get<float>();
+    for (uint32_t offset = 0; offset < len; offset += pieceLen) {
+        uint32_t curLen = Min(pieceLen, len - offset);
+        LocalTensor<float> xLocal =
+            LoadPiece(inQueueX, offsetXBuf, gatherXBuf, castXBuf, xGm, strideX, elemStart + offset, curLen);
+        LocalTensor<float> yLocal =
+            LoadPiece(inQueueY, offsetYBuf, gatherYBuf, castYBuf, yGm, strideY, elemStart + offset, curLen);
+        Mul(prodLocal[offset], xLocal, yLocal, curLen);
+        PipeBarrier<PIPE_V>();
+        if constexpr (IsSameType<T, float>::value) {
+            if (strideX == 1) {
+                inQueueX.FreeTensor(xLocal);
+            }
+            if (strideY == 1) {
+                inQueueY.FreeTensor(yLocal);
+            }
+        }
+    }
+    return ReduceLocal(prodLocal, len);
+}
+
+// 部分和先在UB攒批，满批或最后一个时写回GM
+template <typename T>
+__aicore__ inline void DotV2ND<T>::PushPartial(const GlobalTensor<float>& dstGm, uint64_t idx, float value, bool flush)
+{
+    LocalTensor<float> partialLocal = partialBuf.Get<float>();
+    if (batchCount == 0) {
+        batchStart = idx;
+    }
+    partialLocal.SetValue(batchCount, value);
+    batchCount++;
+    if (batchCount < partialBatch && !flush) {
+        return;
+    }
+    SyncFlag<HardEvent::S_MTE3>();
+    DataCopyExtParams copyParams = {1, static_cast<uint32_t>(batchCount * sizeof(float)), 0, 0, 0};
+    DataCopyPad(dstGm[batchStart], partialLocal, copyParams);
+    SyncFlag<HardEvent::MTE3_S>();
+    batchCount = 0;
+}
+
+// 0核按chunkLen一组逐层规约部分和，直至只剩一个
+template <typename T>
+__aicore__ inline float DotV2ND<T>::TreeReduce()
+{
+    LocalTensor<float> prodLocal = prodBuf.Get<float>();
+    GlobalTensor<float> srcGm = partialGm;
+    GlobalTensor<float> dstGm = mergeGm;
+    uint64_t count = chunkNum;
+    float result = 0.0f;
+    do {
+        uint64_t groupNum = CeilDiv(count, static_cast<uint64_t>(chunkLen));
+        for (uint64_t g = 0; g < groupNum; g++) {
+            uint32_t len = static_cast<uint32_t>(Min(static_cast<uint64_t>(chunkLen), count - g * chunkLen));
+            SyncFlag<HardEvent::V_MTE2>();
+            DataCopyExtParams copyParams = {1, static_cast<uint32_t>(len * sizeof(float)), 0, 0, 0};
+            DataCopyPadExtParams<float> padParams = {false, 0, 0, 0.0f};
+            DataCopyPad(prodLocal, srcGm[g * chunkLen], copyParams, padParams);
+            SyncFlag<HardEvent::MTE2_V>();
+            result = ReduceLocal(prodLocal, len);
+            PushPartial(dstGm, g, result, g + 1 == groupNum);
+        }
+        SyncFlag<HardEvent::MTE3_MTE2>();
+        GlobalTensor<float> tmpGm = srcGm;
+        srcGm = dstGm;
+        dstGm = tmpGm;
+        count = groupNum;
+    } while (count > 1);
+    return result;
+}
+
+template <typename T>
+__aicore__ inline void DotV2ND<T>::CopyOut(float result)
+{
+    LocalTensor<T> outLocal = outBuf.Get<T>();
+    if constexpr (IsSameType<T, float>::value) {
+        outLocal.SetValue(0, result);
+        SyncFlag<HardEvent::S_MTE3>();
+    } else {
+        LocalTensor<float> sumLocal = sumBuf.Get<float>();
+        sumLocal.SetValue(0, result);
+        SyncFlag<HardEvent::S_V>();
+        Cast(outLocal, sumLocal, RoundMode::CAST_RINT, 1);
+        SyncFlag<HardEvent::V_MTE3>();
+    }
+    DataCopyExtParams copyParams = {1, static_cast<uint32_t>(sizeof(T)), 0, 0, 0};
+    DataCopyPad(zGm, outLocal, copyParams);
+}
+} // namespace DotV2
+
+#endif // DOT_V2_H
@@ -0,0 +1,175 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file test_dot_v2_tiling.cpp
+ * \brief
+ */
+
+#include <iostream>
+#include <vector>
+#include <gtest/gtest.h>
+#include "../../../op_host/dot_v2_tiling.h"
+#include "tiling_context_faker.h"
+#include "tiling_case_executor.h"
+
+class DotV2Tiling : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        std::cout << "DotV2Tiling SetUp" << std::endl;
+    }
+    static void TearDownTestCase()
+    {
+        std::cout << "DotV2Tiling TearDown" << std::endl;
+    }
+};
+
+TEST_F(DotV2Tiling, dot_v2_tiling_long_float)
+{
+    optiling::DotV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "DotV2",
+        {
+            {{{100000000}, {100000000}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{100000000}, {100000000}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{}, {}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("stride_x", Ops::Math::AnyValue::CreateFrom<int64_t>(1)),
+         gert::TilingContextPara::OpAttr("stride_y", Ops::Math::AnyValue::CreateFrom<int64_t>(1))},
+        &compileInfo);
+    uint64_t expectTilingKey = 1;
+    std::string expectTilingData = "100000000 24415 381 31 1 1 17592186048512 4398046511168 ";
+    std::vector<size_t> expectWorkspaces = {16891904};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(DotV2Tiling, dot_v2_tiling_float16)
+{
+    optiling::DotV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "DotV2",
+        {
+            {{{100000}, {100000}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{100000}, {100000}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+        },
+        {
+            {{{}, {}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("stride_x", Ops::Math::AnyValue::CreateFrom<int64_t>(1)),
+         gert::TilingContextPara::OpAttr("stride_y", Ops::Math::AnyValue::CreateFrom<int64_t>(1))},
+        &compileInfo);
+    uint64_t expectTilingKey = 2;
+    std::string expectTilingData = "100000 25 1 0 1 1 17592186048512 4398046511129 ";
+    std::vector<size_t> expectWorkspaces = {16809984};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(DotV2Tiling, dot_v2_tiling_strided_bfloat16)
+{
+    optiling::DotV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "DotV2",
+        {
+            {{{9999}, {9999}}, ge::DT_BF16, ge::FORMAT_ND},
+            {{{79985}, {79985}}, ge::DT_BF16, ge::FORMAT_ND},
+        },
+        {
+            {{{}, {}}, ge::DT_BF16, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("stride_x", Ops::Math::AnyValue::CreateFrom<int64_t>(2)),
+         gert::TilingContextPara::OpAttr("stride_y", Ops::Math::AnyValue::CreateFrom<int64_t>(16))},
+        &compileInfo);
+    uint64_t expectTilingKey = 3;
+    std::string expectTilingData = "5000 2 1 0 2 16 4398046515200 4398046511106 ";
+    std::vector<size_t> expectWorkspaces = {16809984};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(DotV2Tiling, dot_v2_tiling_strided_single_chunk_float)
+{
+    optiling::DotV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "DotV2",
+        {
+            {{{4785}, {4785}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{4785}, {4785}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{}, {}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("stride_x", Ops::Math::AnyValue::CreateFrom<int64_t>(16)),
+         gert::TilingContextPara::OpAttr("stride_y", Ops::Math::AnyValue::CreateFrom<int64_t>(16))},
+        &compileInfo);
+    uint64_t expectTilingKey = 1;
+    std::string expectTilingData = "300 1 1 0 16 16 2199023259648 4398046511105 ";
+    std::vector<size_t> expectWorkspaces = {16809984};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+// 跨步超过16需先做Contiguous
+TEST_F(DotV2Tiling, dot_v2_tiling_stride_too_large)
+{
+    optiling::DotV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "DotV2",
+        {
+            {{{1700}, {1700}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{1700}, {1700}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{}, {}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("stride_x", Ops::Math::AnyValue::CreateFrom<int64_t>(17)),
+         gert::TilingContextPara::OpAttr("stride_y", Ops::Math::AnyValue::CreateFrom<int64_t>(17))},
+        &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
+
+// x与y长度不一致
+TEST_F(DotV2Tiling, dot_v2_tiling_len_mismatch)
+{
+    optiling::DotV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "DotV2",
+        {
+            {{{100}, {100}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{101}, {101}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{}, {}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("stride_x", Ops::Math::AnyValue::CreateFrom<int64_t>(1)),
+         gert::TilingContextPara::OpAttr("stride_y", Ops::Math::AnyValue::CreateFrom<int64_t>(1))},
+        &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
+
+// 整数类型不支持
+TEST_F(DotV2Tiling, dot_v2_tiling_unsupported_dtype)
+{
+    optiling::DotV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "DotV2",
+        {
+            {{{100}, {100}}, ge::DT_INT32, ge::FORMAT_ND},
+            {{{100}, {100}}, ge::DT_INT32, ge::FORMAT_ND},
+        },
+        {
+            {{{}, {}}, ge::DT_INT32, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("stride_x", Ops::Math::AnyValue::CreateFrom<int64_t>(1)),
+         gert::TilingContextPara::OpAttr("stride_y", Ops::Math::AnyValue::CreateFrom<int64_t>(1))},
+        &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
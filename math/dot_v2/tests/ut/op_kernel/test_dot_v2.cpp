@@ -0,0 +1,145 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+/*!
+ * \file test_dot_v2.cpp
+ * \brief
+ */
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <vector>
+#include "gtest/gtest.h"
+#include "tikicpulib.h"
+#include "data_utils.h"
+
+using namespace std;
+
+extern "C" __global__ __aicore__ void dot_v2(GM_ADDR x, GM_ADDR y, GM_ADDR z, GM_ADDR workspace, GM_ADDR tiling);
+
+class dot_v2_test : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        cout << "dot_v2_test SetUp\n" << endl;
+    }
+    static void TearDownTestCase()
+    {
+        cout << "dot_v2_test TearDown\n" << endl;
+    }
+};
+
+static constexpr size_t WORKSPACE_SIZE = 16 * 1024 * 1024 + 64 * 1024;
+
+static void InitTilingData(
+    DotV2TilingData* tilingData, uint64_t totalLen, uint64_t strideX, uint64_t strideY, uint32_t pieceLen,
+    uint32_t blockDim)
+{
+    uint64_t chunkNum = (totalLen + 4096 - 1) / 4096;
+    tilingData->totalLen = totalLen;
+    tilingData->chunkNum = chunkNum;
+    tilingData->chunksPerCore = chunkNum / blockDim;
+    tilingData->tailChunks = chunkNum % blockDim;
+    tilingData->strideX = strideX;
+    tilingData->strideY = strideY;
+    tilingData->chunkLen = 4096;
+    tilingData->pieceLen = pieceLen;
+    tilingData->usedCoreNum = blockDim;
+    tilingData->partialBatch = 1024;
+}
+
+static float RunFloatDot(const vector<float>& xHost, const vector<float>& yHost, uint32_t blockDim)
+{
+    size_t totalLen = xHost.size();
+    uint8_t* x = (uint8_t*)AscendC::GmAlloc(totalLen * sizeof(float));
+    uint8_t* y = (uint8_t*)AscendC::GmAlloc(totalLen * sizeof(float));
+    uint8_t* z = (uint8_t*)AscendC::GmAlloc(32);
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(WORKSPACE_SIZE);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(sizeof(DotV2TilingData));
+    memcpy(x, xHost.data(), totalLen * sizeof(float));
+    memcpy(y, yHost.data(), totalLen * sizeof(float));
+
+    DotV2TilingData* tilingData = reinterpret_cast<DotV2TilingData*>(tiling);
+    InitTilingData(tilingData, totalLen, 1, 1, 4096, blockDim);
+
+    ICPU_SET_TILING_KEY(1);
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_RUN_KF(dot_v2, blockDim, x, y, z, workspace, (uint8_t*)(tilingData));
+    float result = reinterpret_cast<float*>(z)[0];
+
+    AscendC::GmFree(x);
+    AscendC::GmFree(y);
+    AscendC::GmFree(z);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+    return result;
+}
+
+TEST_F(dot_v2_test, test_float_multi_chunk)
+{
+    vector<float> xHost(10000, 1.0f);
+    vector<float> yHost(10000, 0.5f);
+    EXPECT_NEAR(RunFloatDot(xHost, yHost, 2), 5000.0f, 1e-3f);
+}
+
+TEST_F(dot_v2_test, test_float_deterministic_across_core_num)
+{
+    // 块划分与合并顺序与核数无关，不同核数下结果逐位一致
+    size_t totalLen = 20000;
+    vector<float> xHost(totalLen);
+    vector<float> yHost(totalLen);
+    for (size_t i = 0; i < totalLen; i++) {
+        xHost[i] = static_cast<float>((i * 37) % 101) * 0.013f - 0.6f;
+        yHost[i] = static_cast<float>((i * 53) % 97) * 0.021f - 1.0f;
+    }
+    float resultOneCore = RunFloatDot(xHost, yHost, 1);
+    float resultThreeCore = RunFloatDot(xHost, yHost, 3);
+    EXPECT_EQ(memcmp(&resultOneCore, &resultThreeCore, sizeof(float)), 0);
+}
+
+TEST_F(dot_v2_test, test_float16_strided)
+{
+    // x跨步为2，间隙填充不参与计算的值；y连续；fp32累加后结果为10000
+    size_t totalLen = 5000;
+    uint64_t strideX = 2;
+    size_t spanX = (totalLen - 1) * strideX + 1;
+    uint32_t blockDim = 2;
+    uint8_t* x = (uint8_t*)AscendC::GmAlloc(spanX * sizeof(half));
+    uint8_t* y = (uint8_t*)AscendC::GmAlloc(totalLen * sizeof(half));
+    uint8_t* z = (uint8_t*)AscendC::GmAlloc(32);
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(WORKSPACE_SIZE);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(sizeof(DotV2TilingData));
+
+    half* xData = reinterpret_cast<half*>(x);
+    half* yData = reinterpret_cast<half*>(y);
+    for (size_t i = 0; i < spanX; i++) {
+        xData[i] = static_cast<half>(i % strideX == 0 ? 1.0f : 100.0f);
+    }
+    for (size_t i = 0; i < totalLen; i++) {
+        yData[i] = static_cast<half>(2.0f);
+    }
+
+    DotV2TilingData* tilingData = reinterpret_cast<DotV2TilingData*>(tiling);
+    InitTilingData(tilingData, totalLen, strideX, 1, 1024, blockDim);
+
+    ICPU_SET_TILING_KEY(2);
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_RUN_KF(dot_v2, blockDim, x, y, z, workspace, (uint8_t*)(tilingData));
+
+    EXPECT_NEAR(static_cast<float>(reinterpret_cast<half*>(z)[0]), 10000.0f, 1e-3f);
+
+    AscendC::GmFree(x);
+    AscendC::GmFree(y);
+    AscendC::GmFree(z);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+}
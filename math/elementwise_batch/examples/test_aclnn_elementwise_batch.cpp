@@ -0,0 +1,306 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include "acl/acl.h"
+#include "aclnnop/aclnn_elementwise_batch.h"
+#include "aclnnop/aclnn_abs.h"
+#include "aclnnop/aclnn_mul.h"
+#include "aclnnop/aclnn_sqrt.h"
+
+#define CHECK_RET(cond, return_expr) \
+    do {                             \
+        if (!(cond)) {               \
+            return_expr;             \
+        }                            \
+    } while (0)
+
+#define LOG_PRINT(message, ...)         \
+    do {                                \
+        printf(message, ##__VA_ARGS__); \
+    } while (0)
+
+// 与aclnnElementwiseBatch接口中的op取值一致
+constexpr int64_t OP_MULS = 0;
+constexpr int64_t OP_ABS = 3;
+constexpr int64_t OP_SQRT = 5;
+
+int64_t GetShapeSize(const std::vector<int64_t>& shape)
+{
+    int64_t shapeSize = 1;
+    for (auto i : shape) {
+        shapeSize *= i;
+    }
+    return shapeSize;
+}
+
+int Init(int32_t deviceId, aclrtStream* stream)
+{
+    // 固定写法，初始化
+    auto ret = aclInit(nullptr);
+    CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclInit failed. ERROR: %d\n", ret); return ret);
+    ret = aclrtSetDevice(deviceId);
+    CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtSetDevice failed. ERROR: %d\n", ret); return ret);
+    ret = aclrtCreateStream(stream);
+    CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtCreateStream failed. ERROR: %d\n", ret); return ret);
+    return 0;
+}
+
+template <typename T>
+int CreateAclTensor(
+    const std::vector<T>& hostData, const std::vector<int64_t>& shape, void** deviceAddr, aclDataType dataType,
+    aclTensor** tensor)
+{
+    auto size = GetShapeSize(shape) * sizeof(T);
+    // 调用aclrtMalloc申请device侧内存
+    auto ret = aclrtMalloc(deviceAddr, size, ACL_MEM_MALLOC_HUGE_FIRST);
+    CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtMalloc failed. ERROR: %d\n", ret); return ret);
+    // 调用aclrtMemcpy将host侧数据拷贝到device侧内存上
+    ret = aclrtMemcpy(*deviceAddr, size, hostData.data(), size, ACL_MEMCPY_HOST_TO_DEVICE);
+    CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtMemcpy failed. ERROR: %d\n", ret); return ret);
+
+    // 计算连续tensor的strides
+    std::vector<int64_t> strides(shape.size(), 1);
+    for (int64_t i = shape.size() - 2; i >= 0; i--) {
+        strides[i] = shape[i + 1] * strides[i + 1];
+    }
+
+    // 调用aclCreateTensor接口创建aclTensor
+    *tensor = aclCreateTensor(
+        shape.data(), shape.size(), dataType, strides.data(), 0, aclFormat::ACL_FORMAT_ND, shape.data(), shape.size(),
+        *deviceAddr);
+    return 0;
+}
+
+// 多次下发复用同一块workspace，只在需要更大空间时重新申请
+void* g_workspaceAddr = nullptr;
+uint64_t g_workspaceCapacity = 0;
+
+int RunWithWorkspace(
+    uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream,
+    aclnnStatus (*api)(void*, uint64_t, aclOpExecutor*, aclrtStream))
+{
+    if (workspaceSize > g_workspaceCapacity) {
+        // 旧workspace可能仍被已下发的任务使用，同步后再释放
+        if (g_workspaceAddr != nullptr) {
+            aclrtSynchronizeStream(stream);
+            aclrtFree(g_workspaceAddr);
+            g_workspaceAddr = nullptr;
+            g_workspaceCapacity = 0;
+        }
+        auto ret = aclrtMalloc(&g_workspaceAddr, workspaceSize, ACL_MEM_MALLOC_HUGE_FIRST);
+        CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("allocate workspace failed. ERROR: %d\n", ret); return ret);
+        g_workspaceCapacity = workspaceSize;
+    }
+    return api(g_workspaceAddr, workspaceSize, executor, stream);
+}
+
+aclTensor* CreateViewTensor(void* deviceAddr, const std::vector<int64_t>& shape)
+{
+    std::vector<int64_t> strides(shape.size(), 1);
+    for (int64_t i = shape.size() - 2; i >= 0; i--) {
+        strides[i] = shape[i + 1] * strides[i + 1];
+    }
+    return aclCreateTensor(
+        shape.data(), shape.size(), aclDataType::ACL_FLOAT, strides.data(), 0, aclFormat::ACL_FORMAT_ND, shape.data(),
+        shape.size(), deviceAddr);
+}
+
+/**
+ * 逐元素计算队列：Enqueue只在host侧记录{输入地址, 输出地址, shape, op, a, b}，
+ * Flush时把队列中的计算打包为一次aclnnElementwiseBatch调用下发，然后清空队列。
+ */
+class ElementwiseQueue {
+public:
+    void Enqueue(void* x, void* out, const std::vector<int64_t>& shape, int64_t op, float a = 0.0f, float b = 0.0f)
+    {
+        inputs_.push_back(x);
+        outputs_.push_back(out);
+        shapes_.push_back(shape);
+        ops_.push_back(op);
+        alpha_.push_back(a);
+        beta_.push_back(b);
+    }
+
+    int Flush(aclrtStream stream)
+    {
+        if (inputs_.empty()) {
+            return ACL_SUCCESS;
+        }
+        // aclDestroyTensorList会同时释放列表中的aclTensor，因此每次Flush重新创建tensor
+        std::vector<aclTensor*> xs;
+        std::vector<aclTensor*> outs;
+        for (size_t i = 0; i < inputs_.size(); i++) {
+            xs.push_back(CreateViewTensor(inputs_[i], shapes_[i]));
+            outs.push_back(CreateViewTensor(outputs_[i], shapes_[i]));
+        }
+        aclTensorList* xList = aclCreateTensorList(xs.data(), xs.size());
+        aclTensorList* outList = aclCreateTensorList(outs.data(), outs.size());
+        aclIntArray* ops = aclCreateIntArray(ops_.data(), ops_.size());
+        aclFloatArray* alpha = aclCreateFloatArray(alpha_.data(), alpha_.size());
+        aclFloatArray* beta = aclCreateFloatArray(beta_.data(), beta_.size());
+
+        uint64_t workspaceSize = 0;
+        aclOpExecutor* executor;
+        auto ret = aclnnElementwiseBatchGetWorkspaceSize(xList, ops, alpha, beta, outList, &workspaceSize, &executor);
+        if (ret == ACL_SUCCESS) {
+            ret = RunWithWorkspace(workspaceSize, executor, stream, aclnnElementwiseBatch);
+        } else {
+            LOG_PRINT("aclnnElementwiseBatchGetWorkspaceSize failed. ERROR: %d\n", ret);
+        }
+
+        aclDestroyTensorList(xList);
+        aclDestroyTensorList(outList);
+        aclDestroyIntArray(ops);
+        aclDestroyFloatArray(alpha);
+        aclDestroyFloatArray(beta);
+        inputs_.clear();
+        outputs_.clear();
+        shapes_.clear();
+        ops_.clear();
+        alpha_.clear();
+        beta_.clear();
+        return ret;
+    }
+
+private:
+    std::vector<void*> inputs_;
+    std::vector<void*> outputs_;
+    std::vector<std::vector<int64_t>> shapes_;
+    std::vector<int64_t> ops_;
+    std::vector<float> alpha_;
+    std::vector<float> beta_;
+};
+
+// 逐个tensor调用单算子接口，作为对比基线
+int LaunchPerOp(aclTensor* x, aclTensor* out, int64_t op, aclScalar* scale, aclrtStream stream)
+{
+    uint64_t workspaceSize = 0;
+    aclOpExecutor* executor;
+    aclnnStatus ret;
+    if (op == OP_MULS) {
+        ret = aclnnMulsGetWorkspaceSize(x, scale, out, &workspaceSize, &executor);
+        CHECK_RET(ret == ACL_SUCCESS, return ret);
+        return RunWithWorkspace(workspaceSize, executor, stream, aclnnMuls);
+    }
+    if (op == OP_ABS) {
+        ret = aclnnAbsGetWorkspaceSize(x, out, &workspaceSize, &executor);
+        CHECK_RET(ret == ACL_SUCCESS, return ret);
+        return RunWithWorkspace(workspaceSize, executor, stream, aclnnAbs);
+    }
+    ret = aclnnSqrtGetWorkspaceSize(x, out, &workspaceSize, &executor);
+    CHECK_RET(ret == ACL_SUCCESS, return ret);
+    return RunWithWorkspace(workspaceSize, executor, stream, aclnnSqrt);
+}
+
+int main()
+{
+    // 1. （固定写法）device/stream初始化，参考acl API文档
+    // 根据自己的实际device填写deviceId
+    int32_t deviceId = 0;
+    aclrtStream stream;
+    auto ret = Init(deviceId, &stream);
+    CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("Init acl failed. ERROR: %d\n", ret); return ret);
+
+    // 2. 构造输入与输出：大量小tensor，按MULS、ABS、SQRT轮流计算
+    const size_t tensorNum = 200;
+    const int64_t loops = 20;
+    const float scale = 0.5f;
+    const int64_t opCycle[] = {OP_MULS, OP_ABS, OP_SQRT};
+    std::vector<int64_t> shape = {16, 16};
+    std::vector<void*> xDeviceAddrs(tensorNum, nullptr);
+    std::vector<void*> outDeviceAddrs(tensorNum, nullptr);
+    std::vector<aclTensor*> xs(tensorNum, nullptr);
+    std::vector<aclTensor*> outs(tensorNum, nullptr);
+    std::vector<float> outHostData(GetShapeSize(shape), 0.0f);
+    for (size_t i = 0; i < tensorNum; i++) {
+        std::vector<float> xHostData(GetShapeSize(shape), static_cast<float>(i % 7) + 1.0f);
+        ret = CreateAclTensor(xHostData, shape, &xDeviceAddrs[i], aclDataType::ACL_FLOAT, &xs[i]);
+        CHECK_RET(ret == ACL_SUCCESS, return ret);
+        ret = CreateAclTensor(outHostData, shape, &outDeviceAddrs[i], aclDataType::ACL_FLOAT, &outs[i]);
+        CHECK_RET(ret == ACL_SUCCESS, return ret);
+    }
+    aclScalar* scaleScalar = aclCreateScalar(const_cast<float*>(&scale), aclDataType::ACL_FLOAT);
+
+    // 3. 逐tensor下发单算子，统计耗时
+    auto start = std::chrono::steady_clock::now();
+    for (int64_t loop = 0; loop < loops; loop++) {
+        for (size_t i = 0; i < tensorNum; i++) {
+            ret = LaunchPerOp(xs[i], outs[i], opCycle[i % 3], scaleScalar, stream);
+            CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("launch per op failed. ERROR: %d\n", ret); return ret);
+        }
+    }
+    ret = aclrtSynchronizeStream(stream);
+    CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtSynchronizeStream failed. ERROR: %d\n", ret); return ret);
+    auto perOpUs =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    // 4. 入队后一次Flush下发ElementwiseBatch，统计耗时
+    ElementwiseQueue queue;
+    start = std::chrono::steady_clock::now();
+    for (int64_t loop = 0; loop < loops; loop++) {
+        for (size_t i = 0; i < tensorNum; i++) {
+            queue.Enqueue(xDeviceAddrs[i], outDeviceAddrs[i], shape, opCycle[i % 3], scale);
+        }
+        ret = queue.Flush(stream);
+        CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("flush failed. ERROR: %d\n", ret); return ret);
+    }
+    ret = aclrtSynchronizeStream(stream);
+    CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclrtSynchronizeStream failed. ERROR: %d\n", ret); return ret);
+    auto batchUs =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    LOG_PRINT(
+        "%zu tensors x %ld loops, per op: %ld us, batched: %ld us\n", tensorNum, loops, static_cast<long>(perOpUs),
+        static_cast<long>(batchUs));
+
+    // 5. 获取输出的值，与host侧计算结果比较
+    for (size_t i = 0; i < tensorNum; i++) {
+        ret = aclrtMemcpy(
+            outHostData.data(), outHostData.size() * sizeof(float), outDeviceAddrs[i],
+            outHostData.size() * sizeof(float), ACL_MEMCPY_DEVICE_TO_HOST);
+        CHECK_RET(
+            ret == ACL_SUCCESS, LOG_PRINT("copy result from device to host failed. ERROR: %d\n", ret); return ret);
+        float x = static_cast<float>(i % 7) + 1.0f;
+        float expect = x * scale;
+        if (opCycle[i % 3] == OP_ABS) {
+            expect = std::fabs(x);
+        } else if (opCycle[i % 3] == OP_SQRT) {
+            expect = std::sqrt(x);
+        }
+        if (std::fabs(outHostData[0] - expect) > 1e-5f) {
+            LOG_PRINT("elementwise batch result[%zu] is: %f, expect %f\n", i, outHostData[0], expect);
+        }
+    }
+
+    // 6. 释放aclTensor和aclScalar
+    for (size_t i = 0; i < tensorNum; i++) {
+        aclDestroyTensor(xs[i]);
+        aclDestroyTensor(outs[i]);
+    }
+    aclDestroyScalar(scaleScalar);
+
+    // 7. 释放device资源
+    for (size_t i = 0; i < tensorNum; i++) {
+        aclrtFree(xDeviceAddrs[i]);
+        aclrtFree(outDeviceAddrs[i]);
+    }
+    if (g_workspaceAddr != nullptr) {
+        aclrtFree(g_workspaceAddr);
+    }
+    aclrtDestroyStream(stream);
+    aclrtResetDevice(deviceId);
+    aclFinalize();
+
+    return 0;
+}
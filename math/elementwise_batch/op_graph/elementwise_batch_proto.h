@@ -0,0 +1,50 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file elementwise_batch_proto.h
+ * \brief
+ */
+#ifndef OPS_OP_PROTO_INC_ELEMENTWISE_BATCH_OPS_H_
+#define OPS_OP_PROTO_INC_ELEMENTWISE_BATCH_OPS_H_
+
+#include "graph/operator_reg.h"
+#include "graph/types.h"
+
+namespace ge {
+/**
+ * @brief Apply an individually described unary computation to every tensor of the list in a single launch.
+ * Tensor i is described by args[3 * i], args[3 * i + 1], args[3 * i + 2] = {op, a, b}:
+ * op 0: y = a * x
+ * op 1: y = x + a
+ * op 2: y = a * x + b
+ * op 3: y = |x|
+ * op 4: y = max(x, 0)
+ * op 5: y = sqrt(x)
+ * op 6: y = min(max(x, a), b)
+ * @par Inputs:
+ * Two inputs:
+ * x: Dynamic input, A tensor list containing multiple ND format tensors,
+ * Support 1D ~ 8D, dtype can be float16, bfloat16, float32. All tensors share one dtype.
+ * The list can contain a maximum of 256 tensors.
+ * args: Required input, A 1D float32 tensor holding at least 3 * len(x) elements, the descriptors of the tensors.
+ * @par Outputs:
+ * y: Dynamic output, y[i] has the shape and dtype of x[i]. y may share memory with x.
+ */
+REG_OP(ElementwiseBatch)
+    .DYNAMIC_INPUT(x, TensorType({DT_FLOAT16, DT_BF16, DT_FLOAT}))
+    .INPUT(args, TensorType({DT_FLOAT}))
+    .DYNAMIC_OUTPUT(y, TensorType({DT_FLOAT16, DT_BF16, DT_FLOAT}))
+    .OP_END_FACTORY_REG(ElementwiseBatch)
+
+} // namespace ge
+
+#endif
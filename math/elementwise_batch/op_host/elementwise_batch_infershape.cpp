@@ -0,0 +1,52 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file elementwise_batch_infershape.cpp
+ * \brief
+ */
+
+#include "register/op_impl_registry.h"
+#include "log/log.h"
+
+using namespace ge;
+
+namespace ops {
+constexpr size_t INPUT_X_IDX = 0;
+
+static ge::graphStatus InferShapeForElementwiseBatch(gert::InferShapeContext* context)
+{
+    // y[i] has the shape of x[i].
+    size_t outputNum = context->GetComputeNodeOutputNum();
+    for (size_t i = 0; i < outputNum; i++) {
+        auto xShape = context->GetDynamicInputShape(INPUT_X_IDX, i);
+        OP_CHECK_NULL_WITH_CONTEXT(context, xShape);
+        auto yShape = context->GetOutputShape(i);
+        OP_CHECK_NULL_WITH_CONTEXT(context, yShape);
+        *yShape = *xShape;
+    }
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus InferDataTypeForElementwiseBatch(gert::InferDataTypeContext* context)
+{
+    const ge::DataType xDataType = context->GetInputDataType(INPUT_X_IDX);
+    size_t outputNum = context->GetComputeNodeOutputNum();
+    for (size_t i = 0; i < outputNum; i++) {
+        context->SetOutputDataType(i, xDataType);
+    }
+    return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_INFERSHAPE(ElementwiseBatch)
+    .InferShape(InferShapeForElementwiseBatch)
+    .InferDataType(InferDataTypeForElementwiseBatch);
+} // namespace ops
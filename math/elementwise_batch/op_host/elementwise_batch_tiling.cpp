@@ -0,0 +1,255 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file elementwise_batch_tiling.cpp
+ * \brief
+ */
+#include <algorithm>
+#include "elementwise_batch_tiling.h"
+#include "tiling_base/multi_tensor_apply_tiling.h"
+#include "register/op_impl_registry.h"
+#include "util/math_util.h"
+#include "log/log.h"
+#include "tiling/platform/platform_ascendc.h"
+#include "platform/platform_infos_def.h"
+
+namespace optiling {
+
+constexpr uint32_t BYTE_BLOCK = 32;
+constexpr uint32_t PROC_COUNT_ALIGN = 64;
+constexpr size_t WORKSPACE_SIZE = 1;
+constexpr uint32_t BUFFER_NUM = 2;
+constexpr uint32_t DTYPE_SIZE_FLOAT = 4;
+constexpr uint32_t INPUT_NUM = 1;
+
+class ElementwiseBatchTiling {
+public:
+    explicit ElementwiseBatchTiling(gert::TilingContext* context)
+        : tilingContext(context), nodeName(context->GetNodeName()) {};
+
+    ge::graphStatus Init();
+    ge::graphStatus RunBigKernelTiling();
+
+private:
+    ge::graphStatus CheckArgs() const;
+    ge::graphStatus FillCompileInfo();
+    bool DivideUbMemory();
+    uint64_t GetTilingKeyVal() const;
+    void FillTilingData();
+
+private:
+    gert::TilingContext* tilingContext = nullptr;
+    std::string nodeName = "ElementwiseBatch";
+    ElementwiseBatchTilingData tilingData;
+    ElementwiseBatchCompileInfo compileInfo;
+
+    uint32_t maxProcCount = 0;
+    int64_t tensorDataCountAlignedList[ELEMENTWISE_BATCH_MAX_TENSOR_COUNT] = {0};
+    int64_t* tensorDataCountList = nullptr;
+    int64_t totalDataCountAligned = 0;
+    ge::DataType dataType = ge::DT_UNDEFINED;
+    int32_t dataTypeSize = 0;
+    int32_t elementsPerBlock = 0;
+    int32_t totalTensorCount = 0;
+    uint32_t needCoreNum = 0;
+};
+
+ge::graphStatus ElementwiseBatchTiling::CheckArgs() const
+{
+    // args follows the totalTensorCount instances of x.
+    auto argsDesc = tilingContext->GetInputDesc(totalTensorCount);
+    OP_CHECK_NULL_WITH_CONTEXT(tilingContext, argsDesc);
+    OP_CHECK_IF(
+        argsDesc->GetDataType() != ge::DT_FLOAT, OP_LOGE(tilingContext, "The dtype of args must be float."),
+        return ge::GRAPH_FAILED);
+    auto argsShape = tilingContext->GetInputShape(totalTensorCount);
+    OP_CHECK_NULL_WITH_CONTEXT(tilingContext, argsShape);
+    int64_t argsCount = argsShape->GetStorageShape().GetShapeSize();
+    OP_CHECK_IF(
+        argsCount < ELEMENTWISE_BATCH_ARG_NUM * totalTensorCount,
+        OP_LOGE(
+            tilingContext, "The args holds %ld elements, at least %ld are required.", argsCount,
+            ELEMENTWISE_BATCH_ARG_NUM * totalTensorCount),
+        return ge::GRAPH_FAILED);
+    return ge::GRAPH_SUCCESS;
+}
+
+ge::graphStatus ElementwiseBatchTiling::Init()
+{
+    tensorDataCountList = tilingData.get_tensorDataCountList();
+    // x and y hold the same number of tensors.
+    totalTensorCount = int32_t(tilingContext->GetComputeNodeOutputNum());
+    OP_CHECK_IF(
+        totalTensorCount > ELEMENTWISE_BATCH_MAX_TENSOR_COUNT || totalTensorCount <= 0,
+        OP_LOGE(
+            tilingContext, "The number of tensors [%d] not in (0, %hu].", totalTensorCount,
+            ELEMENTWISE_BATCH_MAX_TENSOR_COUNT),
+        return ge::GRAPH_FAILED);
+    OP_CHECK_IF(
+        tilingContext->GetComputeNodeInputNum() != size_t(totalTensorCount) + 1,
+        OP_LOGE(tilingContext, "x must contain %d tensors followed by args.", totalTensorCount),
+        return ge::GRAPH_FAILED);
+    OP_CHECK_IF(CheckArgs() != ge::GRAPH_SUCCESS, OP_LOGE(tilingContext, "CheckArgs failed."), return ge::GRAPH_FAILED);
+
+    auto firstDesc = tilingContext->GetDynamicInputDesc(0, 0);
+    OP_CHECK_NULL_WITH_CONTEXT(tilingContext, firstDesc);
+    dataType = firstDesc->GetDataType();
+    OP_CHECK_IF(
+        dataType != ge::DT_FLOAT16 && dataType != ge::DT_BF16 && dataType != ge::DT_FLOAT,
+        OP_LOGE(tilingContext, "The input dtype not in [float16, bfloat16, float]."), return ge::GRAPH_FAILED);
+    dataTypeSize = ge::GetSizeByDataType(dataType);
+    elementsPerBlock = BYTE_BLOCK / dataTypeSize;
+
+    for (int32_t i = 0; i < totalTensorCount; i++) {
+        auto descPtr = tilingContext->GetDynamicInputDesc(0, i);
+        OP_CHECK_NULL_WITH_CONTEXT(tilingContext, descPtr);
+        OP_CHECK_IF(
+            descPtr->GetDataType() != dataType, OP_LOGE(tilingContext, "All tensor data types must be consistent."),
+            return ge::GRAPH_FAILED);
+        auto shapePtr = tilingContext->GetDynamicInputShape(0, i);
+        OP_CHECK_NULL_WITH_CONTEXT(tilingContext, shapePtr);
+        tensorDataCountList[i] = shapePtr->GetStorageShape().GetShapeSize();
+        OP_CHECK_IF(
+            tensorDataCountList[i] == 0, OP_LOGE(tilingContext, "The input shape not support empty tensor."),
+            return ge::GRAPH_FAILED);
+        // Make a 32-byte alignment for each Tensor
+        tensorDataCountAlignedList[i] = Ops::Base::CeilAlign(tensorDataCountList[i], int64_t(elementsPerBlock));
+        totalDataCountAligned += tensorDataCountAlignedList[i];
+    }
+    OP_LOGD(
+        tilingContext, "dataType:%d, totalTensorCount:%d, totalDataCountAligned:%ld.", static_cast<int32_t>(dataType),
+        totalTensorCount, totalDataCountAligned);
+    return ge::GRAPH_SUCCESS;
+}
+
+ge::graphStatus ElementwiseBatchTiling::RunBigKernelTiling()
+{
+    OP_LOGD(tilingContext, "Start.");
+    OP_CHECK_IF(
+        FillCompileInfo() != ge::GRAPH_SUCCESS, OP_LOGE(tilingContext, "FillCompileInfo error."),
+        return ge::GRAPH_FAILED);
+    OP_CHECK_IF(
+        compileInfo.totalCoreNum > ELEMENTWISE_BATCH_MAX_CORE_COUNT,
+        OP_LOGE(
+            tilingContext, "The number of totalCoreNum exceeds the limit(%hu).", ELEMENTWISE_BATCH_MAX_CORE_COUNT),
+        return ge::GRAPH_FAILED);
+
+    needCoreNum = uint32_t(std::min(totalDataCountAligned / elementsPerBlock, int64_t(compileInfo.totalCoreNum)));
+    OP_CHECK_IF(needCoreNum == 0, OP_LOGE(tilingContext, "Param needCoreNum is zero."), return ge::GRAPH_FAILED);
+    Ops::Math::OpTiling::TensorListSplitInfo splitInfo;
+    splitInfo.tensorStartList = tilingData.get_tensorStartList();
+    splitInfo.tensorEndList = tilingData.get_tensorEndList();
+    splitInfo.tensorStartOffsetList = tilingData.get_tensorStartOffsetList();
+    splitInfo.tensorEndOffsetList = tilingData.get_tensorEndOffsetList();
+    needCoreNum = Ops::Math::OpTiling::SplitTensorListToCores(
+        tensorDataCountAlignedList, totalTensorCount, dataTypeSize, elementsPerBlock, needCoreNum, splitInfo);
+    OP_CHECK_IF(DivideUbMemory() == false, OP_LOGE(tilingContext, "DivideUbMemory failed."), return ge::GRAPH_FAILED);
+
+    FillTilingData();
+
+    tilingContext->SetTilingKey(GetTilingKeyVal());
+    tilingContext->SetBlockDim(needCoreNum);
+    size_t* workspaces = tilingContext->GetWorkspaceSizes(1);
+    workspaces[0] = WORKSPACE_SIZE;
+    OP_LOGD(tilingContext, "Success.");
+    return ge::GRAPH_SUCCESS;
+}
+
+ge::graphStatus ElementwiseBatchTiling::FillCompileInfo()
+{
+    auto ptrCompileInfo = tilingContext->GetCompileInfo<ElementwiseBatchCompileInfo>();
+    if (ptrCompileInfo != nullptr) {
+        compileInfo = *ptrCompileInfo;
+        return ge::GRAPH_SUCCESS;
+    }
+
+    auto platformInfo = tilingContext->GetPlatformInfo();
+    OP_CHECK_NULL_WITH_CONTEXT(tilingContext, platformInfo);
+
+    compileInfo.totalCoreNum = int32_t(platformInfo->GetCoreNum());
+    platformInfo->GetLocalMemSize(fe::LocalMemType::UB, compileInfo.ubSizePlatForm);
+    return ge::GRAPH_SUCCESS;
+}
+
+bool ElementwiseBatchTiling::DivideUbMemory()
+{
+    /* Per element: double buffered copy-in and copy-out, plus the float scratch of the kernel (one buffer for
+        float, float copies of input/result/scratch for float16 and bfloat16). */
+    uint32_t calcBytes = (dataTypeSize == int32_t(DTYPE_SIZE_FLOAT)) ? DTYPE_SIZE_FLOAT :
+                                                                       (INPUT_NUM + 2) * DTYPE_SIZE_FLOAT;
+    uint32_t bytesPerElement = BUFFER_NUM * (INPUT_NUM + 1) * dataTypeSize + calcBytes;
+    uint32_t canUseUbSize = uint32_t(compileInfo.ubSizePlatForm / BYTE_BLOCK * BYTE_BLOCK);
+    maxProcCount = Ops::Base::FloorAlign(canUseUbSize / bytesPerElement, PROC_COUNT_ALIGN);
+    return maxProcCount > 0;
+}
+
+uint64_t ElementwiseBatchTiling::GetTilingKeyVal() const
+{
+    ElementwiseBatchDtypeKey dtypeKey = ElementwiseBatchDtypeKey::KEY_FLOAT;
+    if (dataType == ge::DT_FLOAT16) {
+        dtypeKey = ElementwiseBatchDtypeKey::KEY_FLOAT16;
+    } else if (dataType == ge::DT_BF16) {
+        dtypeKey = ElementwiseBatchDtypeKey::KEY_BF16;
+    }
+    return static_cast<uint64_t>(dtypeKey);
+}
+
+void ElementwiseBatchTiling::FillTilingData()
+{
+    OP_LOGD(tilingContext, "maxProcCount: %u, needCoreNum: %u.", maxProcCount, needCoreNum);
+    tilingData.set_maxProcCount(maxProcCount);
+    tilingData.set_tensorNum(uint32_t(totalTensorCount));
+    tilingData.SaveToBuffer(
+        tilingContext->GetRawTilingData()->GetData(), tilingContext->GetRawTilingData()->GetCapacity());
+    tilingContext->GetRawTilingData()->SetDataSize(tilingData.GetDataSize());
+}
+
+static ge::graphStatus Tiling4ElementwiseBatch(gert::TilingContext* context)
+{
+    ElementwiseBatchTiling tilingObject(context);
+    if (tilingObject.Init() != ge::GRAPH_SUCCESS) {
+        OP_LOGE(context, "Init tiling object return failed.");
+        return ge::GRAPH_FAILED;
+    }
+    if (tilingObject.RunBigKernelTiling() != ge::GRAPH_SUCCESS) {
+        OP_LOGE(context, "Run big kernel tiling return failed.");
+        return ge::GRAPH_FAILED;
+    }
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus TilingPrepare4ElementwiseBatch(gert::TilingParseContext* context)
+{
+    auto compileInfo = context->GetCompiledInfo<ElementwiseBatchCompileInfo>();
+    OP_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    auto platformInfo = context->GetPlatformInfo();
+    OP_CHECK_NULL_WITH_CONTEXT(context, platformInfo);
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(platformInfo);
+    compileInfo->totalCoreNum = ascendcPlatform.GetCoreNumAiv();
+    OP_CHECK_IF(
+        (compileInfo->totalCoreNum <= 0), OP_LOGE(context, "TilingPrepare4ElementwiseBatch get aiv core num failed."),
+        return ge::GRAPH_FAILED);
+
+    uint64_t ubSizePlatForm;
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ubSizePlatForm);
+    compileInfo->ubSizePlatForm = ubSizePlatForm;
+    OP_CHECK_IF(
+        (compileInfo->ubSizePlatForm <= 0), OP_LOGE(context, "TilingPrepare4ElementwiseBatch get ub size failed."),
+        return ge::GRAPH_FAILED);
+    return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_OPTILING(ElementwiseBatch)
+    .Tiling(Tiling4ElementwiseBatch)
+    .TilingParse<ElementwiseBatchCompileInfo>(TilingPrepare4ElementwiseBatch);
+
+} // namespace optiling
@@ -0,0 +1,53 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file elementwise_batch_tiling.h
+ * \brief
+ */
+#ifndef OPS_BUILT_IN_OP_TILING_RUNTIME_ELEMENTWISE_BATCH_TILING_H
+#define OPS_BUILT_IN_OP_TILING_RUNTIME_ELEMENTWISE_BATCH_TILING_H
+
+#include "register/tilingdata_base.h"
+
+namespace optiling {
+constexpr uint16_t ELEMENTWISE_BATCH_MAX_TENSOR_COUNT = 256;
+constexpr uint16_t ELEMENTWISE_BATCH_MAX_CORE_COUNT = 64;
+// Each tensor is described by {op, a, b} in the args input.
+constexpr int64_t ELEMENTWISE_BATCH_ARG_NUM = 3;
+
+struct ElementwiseBatchCompileInfo {
+    int32_t totalCoreNum = 0;
+    uint64_t ubSizePlatForm = 0;
+};
+
+// tiling key = dtype key, the op of every tensor is read from args in the kernel
+enum class ElementwiseBatchDtypeKey : uint64_t
+{
+    KEY_FLOAT = 1,
+    KEY_FLOAT16 = 2,
+    KEY_BF16 = 3
+};
+
+BEGIN_TILING_DATA_DEF(ElementwiseBatchTilingData)
+TILING_DATA_FIELD_DEF(uint32_t, maxProcCount);
+TILING_DATA_FIELD_DEF(uint32_t, tensorNum);
+TILING_DATA_FIELD_DEF_ARR(int64_t, ELEMENTWISE_BATCH_MAX_TENSOR_COUNT, tensorDataCountList);
+TILING_DATA_FIELD_DEF_ARR(uint16_t, ELEMENTWISE_BATCH_MAX_CORE_COUNT, tensorStartList);
+TILING_DATA_FIELD_DEF_ARR(uint16_t, ELEMENTWISE_BATCH_MAX_CORE_COUNT, tensorEndList);
+TILING_DATA_FIELD_DEF_ARR(int64_t, ELEMENTWISE_BATCH_MAX_CORE_COUNT, tensorStartOffsetList);
+TILING_DATA_FIELD_DEF_ARR(int64_t, ELEMENTWISE_BATCH_MAX_CORE_COUNT, tensorEndOffsetList);
+END_TILING_DATA_DEF;
+
+REGISTER_TILING_DATA_CLASS(ElementwiseBatch, ElementwiseBatchTilingData)
+} // namespace optiling
+
+#endif // OPS_BUILT_IN_OP_TILING_RUNTIME_ELEMENTWISE_BATCH_TILING_H
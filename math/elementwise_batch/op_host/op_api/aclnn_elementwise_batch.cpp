@@ -0,0 +1,214 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <algorithm>
+#include "aclnn_elementwise_batch.h"
+#include "aclnn_kernels/contiguous.h"
+#include "elementwise_batch.h"
+#include "opdev/common_types.h"
+#include "opdev/data_type_utils.h"
+#include "opdev/format_utils.h"
+#include "opdev/op_dfx.h"
+#include "opdev/op_executor.h"
+#include "opdev/shape_utils.h"
+#include "opdev/tensor_view_utils.h"
+#include "aclnn_kernels/common/op_error_check.h"
+#include "common/op_api_def.h"
+
+using namespace op;
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static const std::initializer_list<op::DataType> DTYPE_SUPPORT_LIST = {
+    op::DataType::DT_FLOAT16, op::DataType::DT_BF16, op::DataType::DT_FLOAT};
+
+static bool CheckListNotNull(const aclTensorList* tensors)
+{
+    OP_CHECK_NULL(tensors, return false);
+    for (uint64_t i = 0; i < tensors->Size(); i++) {
+        if ((*tensors)[i] == nullptr) {
+            OP_LOGE(ACLNN_ERR_PARAM_NULLPTR, "expected a proper Tensor but got null for tensor %lu.", i);
+            return false;
+        }
+    }
+    return true;
+}
+
+// out的个数、dtype、shape都需要与x一致
+static bool CheckOutSameWithX(const aclTensorList* x, const aclTensorList* out)
+{
+    if (out->Size() != x->Size()) {
+        OP_LOGE(
+            ACLNN_ERR_PARAM_INVALID, "Tensor list out size %lu should be the same as x size %lu.", out->Size(),
+            x->Size());
+        return false;
+    }
+    for (uint64_t i = 0; i < x->Size(); i++) {
+        auto self = (*x)[i];
+        auto t = (*out)[i];
+        if (t->GetDataType() != self->GetDataType()) {
+            OP_LOGE(
+                ACLNN_ERR_PARAM_INVALID, "Tensor %lu dtype %s should be the same as x dtype %s.", i,
+                op::ToString(t->GetDataType()).GetString(), op::ToString(self->GetDataType()).GetString());
+            return false;
+        }
+        if (t->GetViewShape() != self->GetViewShape()) {
+            OP_LOGE(
+                ACLNN_ERR_PARAM_INVALID, "Tensor %lu shape %s should be the same as x shape %s.", i,
+                op::ToString(t->GetViewShape()).GetString(), op::ToString(self->GetViewShape()).GetString());
+            return false;
+        }
+    }
+    return true;
+}
+
+// 每个tensor对应一组描述符{op, a, b}，op需要在支持范围内
+static bool CheckDescriptors(
+    const aclTensorList* x, const aclIntArray* ops, const aclFloatArray* alpha, const aclFloatArray* beta)
+{
+    if (ops->Size() != x->Size() || alpha->Size() != x->Size() || beta->Size() != x->Size()) {
+        OP_LOGE(
+            ACLNN_ERR_PARAM_INVALID, "The size of ops %lu, alpha %lu and beta %lu should be the same as x size %lu.",
+            ops->Size(), alpha->Size(), beta->Size(), x->Size());
+        return false;
+    }
+    for (uint64_t i = 0; i < ops->Size(); i++) {
+        int64_t op = (*ops)[i];
+        if (op < l0op::ELEMENTWISE_BATCH_OP_MULS || op > l0op::ELEMENTWISE_BATCH_OP_CLAMP) {
+            OP_LOGE(
+                ACLNN_ERR_PARAM_INVALID, "ops[%lu] is %ld, should be in [%ld, %ld].", i, op,
+                l0op::ELEMENTWISE_BATCH_OP_MULS, l0op::ELEMENTWISE_BATCH_OP_CLAMP);
+            return false;
+        }
+    }
+    return true;
+}
+
+static aclnnStatus CheckParams(
+    const aclTensorList* x, const aclIntArray* ops, const aclFloatArray* alpha, const aclFloatArray* beta,
+    const aclTensorList* out)
+{
+    // 1. 检查参数是否为空指针
+    CHECK_RET(CheckListNotNull(x), ACLNN_ERR_PARAM_NULLPTR);
+    CHECK_RET(CheckListNotNull(out), ACLNN_ERR_PARAM_NULLPTR);
+    OP_CHECK_NULL(ops, return ACLNN_ERR_PARAM_NULLPTR);
+    OP_CHECK_NULL(alpha, return ACLNN_ERR_PARAM_NULLPTR);
+    OP_CHECK_NULL(beta, return ACLNN_ERR_PARAM_NULLPTR);
+    if (x->Size() == 0) {
+        OP_LOGE(ACLNN_ERR_PARAM_INVALID, "Tensor list x should not be empty.");
+        return ACLNN_ERR_PARAM_INVALID;
+    }
+
+    // 2. 检查数据类型与维度
+    for (uint64_t i = 0; i < x->Size(); i++) {
+        auto self = (*x)[i];
+        if (!CheckType(self->GetDataType(), DTYPE_SUPPORT_LIST)) {
+            OP_LOGE(
+                ACLNN_ERR_PARAM_INVALID, "tensor %lu not implemented for %s, should be in dtype support list [%s].", i,
+                op::ToString(self->GetDataType()).GetString(), op::ToString(DTYPE_SUPPORT_LIST).GetString());
+            return ACLNN_ERR_PARAM_INVALID;
+        }
+        if (self->GetDataType() != (*x)[0]->GetDataType()) {
+            OP_LOGE(ACLNN_ERR_PARAM_INVALID, "All tensors in x should have the same dtype.");
+            return ACLNN_ERR_PARAM_INVALID;
+        }
+        OP_CHECK_MAX_DIM(self, MAX_SUPPORT_DIMS_NUMS, return ACLNN_ERR_PARAM_INVALID);
+    }
+
+    // 3. 检查输出与描述符
+    CHECK_RET(CheckOutSameWithX(x, out), ACLNN_ERR_PARAM_INVALID);
+    CHECK_RET(CheckDescriptors(x, ops, alpha, beta), ACLNN_ERR_PARAM_INVALID);
+    return ACLNN_SUCCESS;
+}
+
+/**
+ * 描述符在host侧打包为{op, a, b}的float数组并转换为device tensor，与tensor列表一起下发，
+ * kernel按tensor读取各自的描述符，使不同计算的小tensor在一次下发中完成；
+ * 超过单次下发上限时按ELEMENTWISE_BATCH_MAX_TENSOR_NUM分批。
+ */
+static aclnnStatus ElementwiseBatchProcess(
+    const aclTensorList* x, const aclIntArray* ops, const aclFloatArray* alpha, const aclFloatArray* beta,
+    const aclTensorList* out, aclOpExecutor* executor)
+{
+    auto ret = CheckParams(x, ops, alpha, beta, out);
+    CHECK_RET(ret == ACLNN_SUCCESS, ret);
+
+    // 空tensor不参与计算
+    op::FVector<const aclTensor*> inputs;
+    op::FVector<const aclTensor*> outputs;
+    op::FVector<float> descriptors;
+    for (uint64_t i = 0; i < x->Size(); i++) {
+        if ((*x)[i]->IsEmpty()) {
+            continue;
+        }
+        inputs.push_back((*x)[i]);
+        outputs.push_back((*out)[i]);
+        descriptors.push_back(static_cast<float>((*ops)[i]));
+        descriptors.push_back((*alpha)[i]);
+        descriptors.push_back((*beta)[i]);
+    }
+
+    for (size_t start = 0; start < outputs.size(); start += l0op::ELEMENTWISE_BATCH_MAX_TENSOR_NUM) {
+        size_t num = std::min(l0op::ELEMENTWISE_BATCH_MAX_TENSOR_NUM, outputs.size() - start);
+        op::FVector<const aclTensor*> contiguousList;
+        for (size_t i = start; i < start + num; i++) {
+            auto contiguousOut = l0op::Contiguous(inputs[i], executor);
+            CHECK_RET(contiguousOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+            contiguousList.push_back(contiguousOut);
+        }
+        auto xList = executor->AllocTensorList(contiguousList.data(), contiguousList.size());
+        CHECK_RET(xList != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        auto args = executor->ConvertToTensor(
+            descriptors.data() + start * l0op::ELEMENTWISE_BATCH_ARG_NUM, num * l0op::ELEMENTWISE_BATCH_ARG_NUM,
+            op::DataType::DT_FLOAT);
+        CHECK_RET(args != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+        auto result = l0op::ElementwiseBatch(xList, args, executor);
+        CHECK_RET(result != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        // 固定写法，将计算结果拷贝到输出out上，out可能是非连续的tensor
+        for (size_t i = 0; i < num; i++) {
+            auto viewCopyResult = l0op::ViewCopy((*result)[i], outputs[start + i], executor);
+            CHECK_RET(viewCopyResult != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        }
+    }
+    return ACLNN_SUCCESS;
+}
+
+aclnnStatus aclnnElementwiseBatchGetWorkspaceSize(
+    const aclTensorList* x, const aclIntArray* ops, const aclFloatArray* alpha, const aclFloatArray* beta,
+    const aclTensorList* out, uint64_t* workspaceSize, aclOpExecutor** executor)
+{
+    OP_CHECK_COMM_INPUT(workspaceSize, executor);
+    L2_DFX_PHASE_1(aclnnElementwiseBatch, DFX_IN(x, ops, alpha, beta), DFX_OUT(out));
+
+    // 固定写法，创建OpExecutor
+    auto uniqueExecutor = CREATE_EXECUTOR();
+    CHECK_RET(uniqueExecutor.get() != nullptr, ACLNN_ERR_INNER_CREATE_EXECUTOR);
+
+    auto ret = ElementwiseBatchProcess(x, ops, alpha, beta, out, uniqueExecutor.get());
+    CHECK_RET(ret == ACLNN_SUCCESS, ret);
+
+    // 固定写法，获取计算过程中需要使用的workspace大小
+    *workspaceSize = uniqueExecutor->GetWorkspaceSize();
+    uniqueExecutor.ReleaseTo(executor);
+    return ACLNN_SUCCESS;
+}
+
+aclnnStatus aclnnElementwiseBatch(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream)
+{
+    L2_DFX_PHASE_2(aclnnElementwiseBatch);
+    return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+}
+
+#ifdef __cplusplus
+}
+#endif
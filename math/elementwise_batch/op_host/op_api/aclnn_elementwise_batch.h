@@ -0,0 +1,67 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_API_INC_ELEMENTWISE_BATCH_H_
+#define OP_API_INC_ELEMENTWISE_BATCH_H_
+
+#include "aclnn/aclnn_base.h"
+#include "aclnn_util.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief aclnnElementwiseBatch的第一段接口，根据具体的计算流程，计算workspace大小。
+ * @domain aclnn_math
+ *
+ * 算子功能：对输入tensor列表x中的每个tensor执行各自描述的一元计算，op = ops[i]，a = alpha[i]，b = beta[i]：
+ * op 0: out[i] = a * x[i]
+ * op 1: out[i] = x[i] + a
+ * op 2: out[i] = a * x[i] + b
+ * op 3: out[i] = |x[i]|
+ * op 4: out[i] = max(x[i], 0)
+ * op 5: out[i] = sqrt(x[i])
+ * op 6: out[i] = min(max(x[i], a), b)
+ * 用于合并大量小tensor上的逐元素计算：描述符在host侧打包为一个device tensor，
+ * 整个列表在一次kernel下发中完成计算，float16/bfloat16在kernel内以float计算。
+ *
+ * @param [in] x: npu device侧的aclTensorList，数据类型支持FLOAT、FLOAT16、BFLOAT16，数据格式支持ND，
+ * 列表内所有tensor的数据类型需要一致。
+ * @param [in] ops: host侧的aclIntArray，长度与x一致，取值范围[0, 6]。
+ * @param [in] alpha: host侧的aclFloatArray，长度与x一致，不使用a的op对应位置可填任意值。
+ * @param [in] beta: host侧的aclFloatArray，长度与x一致，不使用b的op对应位置可填任意值。
+ * @param [in] out: npu device侧的aclTensorList，tensor个数、shape和数据类型与输入一致，支持与输入为同一列表。
+ * @param [out] workspaceSize: 返回用户需要在npu device侧申请的workspace大小。
+ * @param [out] executor: 返回op执行器，包含算子计算流程。
+ * @return aclnnStatus: 返回状态码。
+ */
+ACLNN_API aclnnStatus aclnnElementwiseBatchGetWorkspaceSize(
+    const aclTensorList* x, const aclIntArray* ops, const aclFloatArray* alpha, const aclFloatArray* beta,
+    const aclTensorList* out, uint64_t* workspaceSize, aclOpExecutor** executor);
+
+/**
+ * @brief aclnnElementwiseBatch的第二段接口，用于执行计算。
+ *
+ * @param [in] workspace: 在npu device侧申请的workspace内存起址。
+ * @param [in] workspace_size: 在npu device侧申请的workspace大小，由第一段接口aclnnElementwiseBatchGetWorkspaceSize获取。
+ * @param [in] executor: op执行器，包含了算子计算流程。
+ * @param [in] stream: acl stream流。
+ * @return aclnnStatus: 返回状态码。
+ */
+ACLNN_API aclnnStatus aclnnElementwiseBatch(
+    void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OP_API_INC_ELEMENTWISE_BATCH_H_
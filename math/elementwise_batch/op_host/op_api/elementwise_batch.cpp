@@ -0,0 +1,46 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file elementwise_batch.cpp
+ * \brief
+ */
+#include "elementwise_batch.h"
+#include "opdev/make_op_executor.h"
+#include "opdev/op_def.h"
+#include "opdev/op_dfx.h"
+#include "opdev/op_executor.h"
+#include "opdev/shape_utils.h"
+
+using namespace op;
+
+namespace l0op {
+OP_TYPE_REGISTER(ElementwiseBatch);
+
+const aclTensorList* ElementwiseBatch(const aclTensorList* x, const aclTensor* args, aclOpExecutor* executor)
+{
+    L0_DFX(ElementwiseBatch, x, args);
+    FVector<const aclTensor*> outVector;
+    for (uint64_t i = 0; i < x->Size(); i++) {
+        auto outTensor = executor->AllocTensor((*x)[i]->GetViewShape(), (*x)[i]->GetDataType());
+        CHECK_RET(outTensor != nullptr, nullptr);
+        outVector.emplace_back(outTensor);
+    }
+    auto out = executor->AllocTensorList(outVector.data(), outVector.size());
+    CHECK_RET(out != nullptr, nullptr);
+    auto ret = ADD_TO_LAUNCHER_LIST_AICORE(ElementwiseBatch, OP_INPUT(x, args), OP_OUTPUT(out));
+    OP_CHECK(
+        ret == ACLNN_SUCCESS,
+        OP_LOGE(ACLNN_ERR_INNER_NULLPTR, "ElementwiseBatchAiCore ADD_TO_LAUNCHER_LIST_AICORE failed."),
+        return nullptr);
+    return out;
+}
+} // namespace l0op
@@ -0,0 +1,39 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file elementwise_batch.h
+ * \brief
+ */
+#ifndef OP_API_INC_LEVEL0_OP_ELEMENTWISE_BATCH_H_
+#define OP_API_INC_LEVEL0_OP_ELEMENTWISE_BATCH_H_
+
+#include "opdev/op_executor.h"
+
+namespace l0op {
+// ElementwiseBatch描述符中的op取值，与kernel侧保持一致
+constexpr int64_t ELEMENTWISE_BATCH_OP_MULS = 0;
+constexpr int64_t ELEMENTWISE_BATCH_OP_ADDS = 1;
+constexpr int64_t ELEMENTWISE_BATCH_OP_AXPB = 2;
+constexpr int64_t ELEMENTWISE_BATCH_OP_ABS = 3;
+constexpr int64_t ELEMENTWISE_BATCH_OP_RELU = 4;
+constexpr int64_t ELEMENTWISE_BATCH_OP_SQRT = 5;
+constexpr int64_t ELEMENTWISE_BATCH_OP_CLAMP = 6;
+// 每个tensor的描述符{op, a, b}所占的float个数
+constexpr size_t ELEMENTWISE_BATCH_ARG_NUM = 3;
+// 单次下发支持的最大tensor个数
+constexpr size_t ELEMENTWISE_BATCH_MAX_TENSOR_NUM = 256;
+
+// args为float类型的描述符tensor，第i个tensor的描述符位于args[3 * i, 3 * i + 3)
+const aclTensorList* ElementwiseBatch(const aclTensorList* x, const aclTensor* args, aclOpExecutor* executor);
+} // namespace l0op
+
+#endif // OP_API_INC_LEVEL0_OP_ELEMENTWISE_BATCH_H_
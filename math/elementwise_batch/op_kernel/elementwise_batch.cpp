@@ -0,0 +1,45 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file elementwise_batch.cpp
+ * \brief
+ */
+
+#include "elementwise_batch_functor.h"
+
+using namespace ElementwiseBatch;
+using namespace MultiTensorApply;
+
+template <typename T>
+__aicore__ inline void ElementwiseBatchRun(
+    GM_ADDR x, GM_ADDR args, GM_ADDR y, const ElementwiseBatchTilingData* tilingData)
+{
+    MultiTensorApplyND<T, BatchFunctor, ElementwiseBatchTilingData> op;
+    // Only the first input list is read, x is passed for the unused ones.
+    op.Init(x, x, x, y, tilingData, args);
+    op.Process();
+}
+
+extern "C" __global__ __aicore__ void elementwise_batch(
+    GM_ADDR x, GM_ADDR args, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling)
+{
+    GET_TILING_DATA(tilingData, tiling);
+
+    // tiling key = dtype key(1: float, 2: float16, 3: bfloat16)
+    if (TILING_KEY_IS(1)) {
+        ElementwiseBatchRun<float>(x, args, y, &tilingData);
+    } else if (TILING_KEY_IS(2)) {
+        ElementwiseBatchRun<half>(x, args, y, &tilingData);
+    } else if (TILING_KEY_IS(3)) {
+        ElementwiseBatchRun<bfloat16_t>(x, args, y, &tilingData);
+    }
+}
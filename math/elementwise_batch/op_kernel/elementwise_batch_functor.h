@@ -0,0 +1,82 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file elementwise_batch_functor.h
+ * \brief
+ */
+#ifndef ELEMENTWISE_BATCH_FUNCTOR_H
+#define ELEMENTWISE_BATCH_FUNCTOR_H
+
+#ifdef __CCE_KT_TEST__
+#include "../../../common/inc/op_kernel/multi_tensor_apply.h"
+#else
+#include "../common/multi_tensor_apply.h"
+#endif
+
+namespace ElementwiseBatch {
+
+using namespace AscendC;
+
+// Must match the op ids of the ElementwiseBatch l0 interface.
+constexpr int32_t OP_MULS = 0;
+constexpr int32_t OP_ADDS = 1;
+constexpr int32_t OP_AXPB = 2;
+constexpr int32_t OP_ABS = 3;
+constexpr int32_t OP_RELU = 4;
+constexpr int32_t OP_SQRT = 5;
+constexpr int32_t OP_CLAMP = 6;
+
+// Every tensor reads its own descriptor {op, a, b}, unknown ops copy the input.
+struct BatchFunctor {
+    static constexpr int32_t INPUT_NUM = 1;
+    static constexpr int32_t ARG_NUM = 3;
+    static __aicore__ inline void Compute(
+        const LocalTensor<float>& dst, const LocalTensor<float> (&src)[INPUT_NUM], const LocalTensor<float>& tmp,
+        const float (&args)[MultiTensorApply::MTA_MAX_ARG_NUM], uint32_t count)
+    {
+        int32_t op = static_cast<int32_t>(args[0]);
+        float a = args[1];
+        float b = args[2];
+        switch (op) {
+            case OP_MULS:
+                Muls(dst, src[0], a, count);
+                break;
+            case OP_ADDS:
+                Adds(dst, src[0], a, count);
+                break;
+            case OP_AXPB:
+                Muls(tmp, src[0], a, count);
+                Adds(dst, tmp, b, count);
+                break;
+            case OP_ABS:
+                Abs(dst, src[0], count);
+                break;
+            case OP_RELU:
+                Relu(dst, src[0], count);
+                break;
+            case OP_SQRT:
+                Sqrt(dst, src[0], count);
+                break;
+            case OP_CLAMP:
+                Maxs(tmp, src[0], a, count);
+                Mins(dst, tmp, b, count);
+                break;
+            default:
+                Adds(dst, src[0], 0.0f, count);
+                break;
+        }
+    }
+};
+
+} // namespace ElementwiseBatch
+
+#endif // ELEMENTWISE_BATCH_FUNCTOR_H
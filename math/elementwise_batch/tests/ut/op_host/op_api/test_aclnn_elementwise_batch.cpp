@@ -0,0 +1,107 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include "gtest/gtest.h"
+#include "../../../../op_host/op_api/aclnn_elementwise_batch.h"
+#include "op_api_ut_common/tensor_desc.h"
+#include "op_api_ut_common/array_desc.h"
+#include "op_api_ut_common/op_api_ut.h"
+#include "op_api_ut_common/inner/types.h"
+
+class l2_elementwise_batch_test : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        std::cout << "l2_elementwise_batch_test SetUp" << std::endl;
+    }
+
+    static void TearDownTestCase()
+    {
+        std::cout << "l2_elementwise_batch_test TearDown" << std::endl;
+    }
+};
+
+// 正常场景，列表内每个tensor的op与shape各不相同
+TEST_F(l2_elementwise_batch_test, l2_elementwise_batch_float)
+{
+    auto tensor1Desc = TensorDesc({2, 3}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto tensor2Desc = TensorDesc({1000}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto tensor3Desc = TensorDesc({4, 8}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(0, 4);
+    auto listDesc = TensorListDesc({tensor1Desc, tensor2Desc, tensor3Desc});
+    auto outDesc = TensorListDesc({tensor1Desc, tensor2Desc, tensor3Desc});
+    auto opsDesc = IntArrayDesc(vector<int64_t>{0, 6, 5});
+    auto alphaDesc = FloatArrayDesc(vector<float>{2.0f, -0.5f, 0.0f});
+    auto betaDesc = FloatArrayDesc(vector<float>{0.0f, 0.5f, 0.0f});
+    auto ut = OP_API_UT(aclnnElementwiseBatch, INPUT(listDesc, opsDesc, alphaDesc, betaDesc), OUTPUT(outDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACL_SUCCESS);
+}
+
+// 超过单次下发上限时分批下发
+TEST_F(l2_elementwise_batch_test, l2_elementwise_batch_fp16_over_max_tensor_num)
+{
+    auto tensorDesc = TensorDesc({16}, ACL_FLOAT16, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto listDesc = TensorListDesc(300, tensorDesc);
+    auto outDesc = TensorListDesc(300, tensorDesc);
+    auto opsDesc = IntArrayDesc(300, 2);
+    auto alphaDesc = FloatArrayDesc(300, 0.5f);
+    auto betaDesc = FloatArrayDesc(300, 1.0f);
+    auto ut = OP_API_UT(aclnnElementwiseBatch, INPUT(listDesc, opsDesc, alphaDesc, betaDesc), OUTPUT(outDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACL_SUCCESS);
+}
+
+// op取值超出范围
+TEST_F(l2_elementwise_batch_test, l2_elementwise_batch_invalid_op)
+{
+    auto tensorDesc = TensorDesc({2, 3}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto listDesc = TensorListDesc(2, tensorDesc);
+    auto outDesc = TensorListDesc(2, tensorDesc);
+    auto opsDesc = IntArrayDesc(vector<int64_t>{3, 7});
+    auto alphaDesc = FloatArrayDesc(2, 1.0f);
+    auto betaDesc = FloatArrayDesc(2, 1.0f);
+    auto ut = OP_API_UT(aclnnElementwiseBatch, INPUT(listDesc, opsDesc, alphaDesc, betaDesc), OUTPUT(outDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+// 描述符个数与x不一致
+TEST_F(l2_elementwise_batch_test, l2_elementwise_batch_descriptor_size_mismatch)
+{
+    auto tensorDesc = TensorDesc({2, 3}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto listDesc = TensorListDesc(2, tensorDesc);
+    auto outDesc = TensorListDesc(2, tensorDesc);
+    auto opsDesc = IntArrayDesc(vector<int64_t>{0, 1});
+    auto alphaDesc = FloatArrayDesc(1, 1.0f);
+    auto betaDesc = FloatArrayDesc(2, 1.0f);
+    auto ut = OP_API_UT(aclnnElementwiseBatch, INPUT(listDesc, opsDesc, alphaDesc, betaDesc), OUTPUT(outDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+// 列表内数据类型不一致
+TEST_F(l2_elementwise_batch_test, l2_elementwise_batch_dtype_mismatch)
+{
+    auto tensor1Desc = TensorDesc({2, 3}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto tensor2Desc = TensorDesc({2, 3}, ACL_FLOAT16, ACL_FORMAT_ND);
+    auto listDesc = TensorListDesc({tensor1Desc, tensor2Desc});
+    auto outDesc = TensorListDesc({tensor1Desc, tensor2Desc});
+    auto opsDesc = IntArrayDesc(vector<int64_t>{3, 4});
+    auto alphaDesc = FloatArrayDesc(2, 0.0f);
+    auto betaDesc = FloatArrayDesc(2, 0.0f);
+    auto ut = OP_API_UT(aclnnElementwiseBatch, INPUT(listDesc, opsDesc, alphaDesc, betaDesc), OUTPUT(outDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
@@ -0,0 +1,148 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file test_elementwise_batch_tiling.cpp
+ * \brief
+ */
+
+#include <iostream>
+#include <gtest/gtest.h>
+#include "tiling_context_faker.h"
+#include "tiling_case_executor.h"
+#include "../../../op_host/elementwise_batch_tiling.h"
+
+class ElementwiseBatchTiling : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        std::cout << "ElementwiseBatchTiling SetUp" << std::endl;
+    }
+
+    static void TearDownTestCase()
+    {
+        std::cout << "ElementwiseBatchTiling TearDown" << std::endl;
+    }
+};
+
+struct ElementwiseBatchCompileInfo {
+    uint32_t coreNum = 0;
+    uint64_t ubSizePlatForm = 0;
+};
+
+// small fp16 tensors with different ops are packed onto one core
+TEST_F(ElementwiseBatchTiling, elementwise_batch_test_tiling_fp16)
+{
+    ElementwiseBatchCompileInfo compileInfo = {48, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "ElementwiseBatch",
+        {
+            {{{3, 6, 5}, {3, 6, 5}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{1000}, {1000}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{17}, {17}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{9}, {9}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{3, 6, 5}, {3, 6, 5}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{1000}, {1000}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{17}, {17}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+        },
+        {}, {3, 1}, {3}, &compileInfo);
+    uint64_t expectTilingKey = 2;
+    string expectTilingData =
+        "12884911680 90 1000 17 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 2 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 31 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 ";
+    std::vector<size_t> expectWorkspaces = {1};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+// large tensors are split across all cores
+TEST_F(ElementwiseBatchTiling, elementwise_batch_test_tiling_fp32)
+{
+    ElementwiseBatchCompileInfo compileInfo = {48, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "ElementwiseBatch",
+        {
+            {{{64000}, {64000}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{8}, {8}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{300000}, {300000}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{9}, {9}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{64000}, {64000}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{8}, {8}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{300000}, {300000}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {}, {3, 1}, {3}, &compileInfo);
+    uint64_t expectTilingKey = 1;
+    string expectTilingData =
+        "12884911680 64000 8 300000 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 562958543486976 562958543486978 562958543486978 562958543486978 562958543486978 562958543486978 "
+        "562958543486978 562958543486978 562958543486978 562958543486978 0 0 0 0 0 0 562958543486978 562958543486978 "
+        "562958543486978 562958543486978 562958543486978 562958543486978 562958543486978 562958543486978 "
+        "562958543486978 562958543486978 0 0 0 0 0 7672 15344 23016 30688 38360 46032 53704 61376 944 8616 16288 "
+        "23960 31632 39304 46976 54648 62320 69992 77664 85336 93008 100680 108352 116024 123696 131368 139040 "
+        "146712 154384 162056 169728 177400 185072 192744 200416 208088 215760 223432 231104 238776 246448 254120 "
+        "261792 269464 277136 284808 292480 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 7671 15343 23015 30687 38359 46031 53703 "
+        "61375 943 8615 16287 23959 31631 39303 46975 54647 62319 69991 77663 85335 93007 100679 108351 116023 "
+        "123695 131367 139039 146711 154383 162055 169727 177399 185071 192743 200415 208087 215759 223431 231103 "
+        "238775 246447 254119 261791 269463 277135 284807 292479 299999 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 ";
+    std::vector<size_t> expectWorkspaces = {1};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+// args must hold 3 descriptor values per tensor
+TEST_F(ElementwiseBatchTiling, elementwise_batch_test_tiling_args_too_short)
+{
+    ElementwiseBatchCompileInfo compileInfo = {48, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "ElementwiseBatch",
+        {
+            {{{16}, {16}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{16}, {16}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{5}, {5}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{16}, {16}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{16}, {16}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {}, {2, 1}, {2}, &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
+
+// all tensors of x must share one dtype
+TEST_F(ElementwiseBatchTiling, elementwise_batch_test_tiling_dtype_mismatch)
+{
+    ElementwiseBatchCompileInfo compileInfo = {48, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "ElementwiseBatch",
+        {
+            {{{16}, {16}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{16}, {16}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{6}, {6}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{16}, {16}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{16}, {16}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {}, {2, 1}, {2}, &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
@@ -0,0 +1,80 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <iostream>
+#include <gtest/gtest.h>
+#include "tiling_context_faker.h"
+#include "tiling_case_executor.h"
+
+#include "../../../../rfft1_d/op_host/fft_whole_dft_tiling.h"
+using namespace std;
+using namespace ge;
+
+class Fft1DTiling : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        std::cout << "Fft1DTiling SetUp" << std::endl;
+    }
+
+    static void TearDownTestCase()
+    {
+        std::cout << "Fft1DTiling TearDown" << std::endl;
+    }
+};
+
+static gert::TilingContextPara MakeFft1DPara(
+    const gert::StorageShape& xShape, int64_t len, int64_t norm, optiling::FftWholeDftCompileInfo& compileInfo)
+{
+    return gert::TilingContextPara(
+        "Fft1D",
+        {
+            {xShape, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {xShape, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            gert::TilingContextPara::OpAttr("n", Ops::Math::AnyValue::CreateFrom<int64_t>(len)),
+            gert::TilingContextPara::OpAttr("norm", Ops::Math::AnyValue::CreateFrom<int64_t>(norm)),
+            gert::TilingContextPara::OpAttr("forward", Ops::Math::AnyValue::CreateFrom<bool>(true)),
+        },
+        &compileInfo);
+}
+
+TEST_F(Fft1DTiling, ascend910B1_test_tiling_c2c_001)
+{
+    optiling::FftWholeDftCompileInfo compileInfo = {48, 196608};
+    uint64_t expectTilingKey = 0;
+    string expectTilingData = "8796093023232 2048 4294967304 4194304 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(
+        MakeFft1DPara({{8, 1024, 2}, {8, 1024, 2}}, 1024, 1, compileInfo), ge::GRAPH_SUCCESS, expectTilingKey,
+        expectTilingData, expectWorkspaces);
+}
+
+TEST_F(Fft1DTiling, ascend910B1_test_tiling_length_exceed_002)
+{
+    optiling::FftWholeDftCompileInfo compileInfo = {48, 196608};
+    ExecuteTestCase(MakeFft1DPara({{8, 4096, 2}, {8, 4096, 2}}, 4096, 1, compileInfo), ge::GRAPH_FAILED);
+}
+
+TEST_F(Fft1DTiling, ascend910B1_test_tiling_points_mismatch_003)
+{
+    optiling::FftWholeDftCompileInfo compileInfo = {48, 196608};
+    ExecuteTestCase(MakeFft1DPara({{8, 1000, 2}, {8, 1000, 2}}, 1024, 1, compileInfo), ge::GRAPH_FAILED);
+}
+
+TEST_F(Fft1DTiling, ascend910B1_test_tiling_not_complex_004)
+{
+    optiling::FftWholeDftCompileInfo compileInfo = {48, 196608};
+    ExecuteTestCase(MakeFft1DPara({{8, 1024}, {8, 1024}}, 1024, 1, compileInfo), ge::GRAPH_FAILED);
+}
@@ -0,0 +1,71 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <string>
+#include <cstdint>
+#include "gtest/gtest.h"
+#include "tikicpulib.h"
+#include "data_utils.h"
+
+using namespace std;
+
+extern "C" __global__ __aicore__ void fft1_d(GM_ADDR x, GM_ADDR dft, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling);
+
+class fft1d_test : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        cout << "fft1d_test SetUp\n" << endl;
+    }
+    static void TearDownTestCase()
+    {
+        cout << "fft1d_test TearDown\n" << endl;
+    }
+};
+
+TEST_F(fft1d_test, test_case_whole_dft)
+{
+    uint32_t blockDim = 24;
+    uint32_t fftLength = 32;
+    uint32_t inLength = 64;
+    uint32_t outLength = 64;
+    uint32_t dftOverallSize = ((inLength + 15) / 16 * 16) * ((outLength + 15) / 16 * 16);
+    size_t inputByteSize = blockDim * inLength * sizeof(float);
+    size_t dftByteSize = dftOverallSize * sizeof(float);
+    size_t outputByteSize = blockDim * outLength * sizeof(float);
+    size_t tilingDataSize = sizeof(FftWholeDftTilingData);
+
+    uint8_t* x = (uint8_t*)AscendC::GmAlloc(inputByteSize);
+    uint8_t* dft = (uint8_t*)AscendC::GmAlloc(dftByteSize);
+    uint8_t* y = (uint8_t*)AscendC::GmAlloc(outputByteSize);
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(1024 * 1024 * 16);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(tilingDataSize);
+
+    FftWholeDftTilingData* tilingDatafromBin = reinterpret_cast<FftWholeDftTilingData*>(tiling);
+
+    tilingDatafromBin->length = fftLength;
+    tilingDatafromBin->inLength = inLength;
+    tilingDatafromBin->outLength = outLength;
+    tilingDatafromBin->batchesPerCore = 1;
+    tilingDatafromBin->leftOverBatches = 0;
+    tilingDatafromBin->normal = 1;
+    tilingDatafromBin->dftOverallSize = dftOverallSize;
+
+    ICPU_SET_TILING_KEY(0);
+    AscendC::SetKernelMode(KernelMode::MIX_MODE);
+    ICPU_RUN_KF(fft1_d, blockDim, x, dft, y, workspace, (uint8_t*)(tilingDatafromBin));
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    AscendC::GmFree(x);
+    AscendC::GmFree(dft);
+    AscendC::GmFree(y);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+}
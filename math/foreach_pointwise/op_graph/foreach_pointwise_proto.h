@@ -0,0 +1,56 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file foreach_pointwise_proto.h
+ * \brief
+ */
+#ifndef OPS_OP_PROTO_INC_FOREACH_POINTWISE_OPS_H_
+#define OPS_OP_PROTO_INC_FOREACH_POINTWISE_OPS_H_
+
+#include "graph/operator_reg.h"
+#include "graph/types.h"
+
+namespace ge {
+/**
+ * @brief Apply one pointwise computation to every tensor of the lists in a single launch.
+ * mode 0: y = x1 * scalar
+ * mode 1: y = x1 + scalar * x2
+ * mode 2: y = x1 + scalar * (x2 - x1)
+ * mode 3: y = x1 + scalar * x2 * x3
+ * mode 4: y = x1 + scalar * x2 / x3
+ * mode 5: y = sqrt(x1)
+ * @par Inputs:
+ * Three inputs:
+ * x1: Dynamic input, A tensor list containing multiple ND format tensors,
+ * Support 1D ~ 8D, dtype can be float16, bfloat16, float32. The list can contain a maximum of 256 tensors.
+ * x2: Dynamic input, same number of tensors as x1 and x2[i] has the shape and dtype of x1[i].
+ * Pass x1 again when the mode does not read x2.
+ * x3: Dynamic input, same number of tensors as x1 and x3[i] has the shape and dtype of x1[i].
+ * Pass x1 again when the mode does not read x3.
+ * @par Attributes:
+ * mode: Required int, the computation to apply, in [0, 5].
+ * scalar: Optional float, defaults to 1.0.
+ * @par Outputs:
+ * y: Dynamic output, y[i] has the shape and dtype of x1[i]. y may share memory with x1.
+ */
+REG_OP(ForeachPointwise)
+    .DYNAMIC_INPUT(x1, TensorType({DT_FLOAT16, DT_BF16, DT_FLOAT}))
+    .DYNAMIC_INPUT(x2, TensorType({DT_FLOAT16, DT_BF16, DT_FLOAT}))
+    .DYNAMIC_INPUT(x3, TensorType({DT_FLOAT16, DT_BF16, DT_FLOAT}))
+    .DYNAMIC_OUTPUT(y, TensorType({DT_FLOAT16, DT_BF16, DT_FLOAT}))
+    .REQUIRED_ATTR(mode, Int)
+    .ATTR(scalar, Float, 1.0)
+    .OP_END_FACTORY_REG(ForeachPointwise)
+
+} // namespace ge
+
+#endif
@@ -0,0 +1,278 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file foreach_pointwise_tiling.cpp
+ * \brief
+ */
+#include <algorithm>
+#include "foreach_pointwise_tiling.h"
+#include "tiling_base/multi_tensor_apply_tiling.h"
+#include "register/op_impl_registry.h"
+#include "util/math_util.h"
+#include "log/log.h"
+#include "tiling/platform/platform_ascendc.h"
+#include "platform/platform_infos_def.h"
+
+namespace optiling {
+
+constexpr uint32_t BYTE_BLOCK = 32;
+constexpr uint32_t PROC_COUNT_ALIGN = 64;
+constexpr size_t WORKSPACE_SIZE = 1;
+constexpr uint32_t BUFFER_NUM = 2;
+constexpr uint32_t DTYPE_SIZE_FLOAT = 4;
+constexpr uint32_t INPUT_LIST_NUM = 3;
+constexpr uint64_t TILING_KEY_MODE_FACTOR = 10;
+constexpr size_t ATTR_MODE_IDX = 0;
+constexpr size_t ATTR_SCALAR_IDX = 1;
+// Number of input lists read by each mode, indexed by ForeachPointwiseMode.
+constexpr uint32_t MODE_INPUT_NUM[] = {1, 2, 2, 3, 3, 1};
+
+class ForeachPointwiseTiling {
+public:
+    explicit ForeachPointwiseTiling(gert::TilingContext* context)
+        : tilingContext(context), nodeName(context->GetNodeName()) {};
+
+    ge::graphStatus Init();
+    ge::graphStatus RunBigKernelTiling();
+
+private:
+    ge::graphStatus ParseAttrs();
+    ge::graphStatus CheckListTensor(size_t irIndex, int32_t index, const gert::Shape& expectShape) const;
+    ge::graphStatus FillCompileInfo();
+    bool DivideUbMemory();
+    uint64_t GetTilingKeyVal() const;
+    void FillTilingData();
+
+private:
+    gert::TilingContext* tilingContext = nullptr;
+    std::string nodeName = "ForeachPointwise";
+    ForeachPointwiseTilingData tilingData;
+    ForeachPointwiseCompileInfo compileInfo;
+
+    int64_t mode = 0;
+    float scalar = 1.0f;
+    uint32_t inputNum = 0;
+    uint32_t maxProcCount = 0;
+    int64_t tensorDataCountAlignedList[FOREACH_MAX_TENSOR_COUNT] = {0};
+    int64_t* tensorDataCountList = nullptr;
+    int64_t totalDataCountAligned = 0;
+    ge::DataType dataType = ge::DT_UNDEFINED;
+    int32_t dataTypeSize = 0;
+    int32_t elementsPerBlock = 0;
+    int32_t totalTensorCount = 0;
+    uint32_t needCoreNum = 0;
+};
+
+ge::graphStatus ForeachPointwiseTiling::ParseAttrs()
+{
+    auto attrs = tilingContext->GetAttrs();
+    OP_CHECK_NULL_WITH_CONTEXT(tilingContext, attrs);
+    const int64_t* modePtr = attrs->GetInt(ATTR_MODE_IDX);
+    OP_CHECK_NULL_WITH_CONTEXT(tilingContext, modePtr);
+    mode = *modePtr;
+    OP_CHECK_IF(
+        mode < static_cast<int64_t>(ForeachPointwiseMode::MULS) || mode > static_cast<int64_t>(ForeachPointwiseMode::SQRT),
+        OP_LOGE(tilingContext, "The attr mode [%ld] not in [0, 5].", mode), return ge::GRAPH_FAILED);
+    inputNum = MODE_INPUT_NUM[mode];
+    const float* scalarPtr = attrs->GetFloat(ATTR_SCALAR_IDX);
+    if (scalarPtr != nullptr) {
+        scalar = *scalarPtr;
+    }
+    return ge::GRAPH_SUCCESS;
+}
+
+ge::graphStatus ForeachPointwiseTiling::CheckListTensor(
+    size_t irIndex, int32_t index, const gert::Shape& expectShape) const
+{
+    auto descPtr = tilingContext->GetDynamicInputDesc(irIndex, index);
+    OP_CHECK_NULL_WITH_CONTEXT(tilingContext, descPtr);
+    OP_CHECK_IF(
+        descPtr->GetDataType() != dataType, OP_LOGE(tilingContext, "All tensor data types must be consistent."),
+        return ge::GRAPH_FAILED);
+    auto shapePtr = tilingContext->GetDynamicInputShape(irIndex, index);
+    OP_CHECK_NULL_WITH_CONTEXT(tilingContext, shapePtr);
+    OP_CHECK_IF(
+        shapePtr->GetStorageShape() != expectShape,
+        OP_LOGE(tilingContext, "The shape of input %zu tensor %d must be the same as x1.", irIndex, index),
+        return ge::GRAPH_FAILED);
+    return ge::GRAPH_SUCCESS;
+}
+
+ge::graphStatus ForeachPointwiseTiling::Init()
+{
+    tensorDataCountList = tilingData.get_tensorDataCountList();
+    OP_CHECK_IF(ParseAttrs() != ge::GRAPH_SUCCESS, OP_LOGE(tilingContext, "ParseAttrs failed."), return ge::GRAPH_FAILED);
+    // x1, x2, x3 and y hold the same number of tensors.
+    totalTensorCount = int32_t(tilingContext->GetComputeNodeOutputNum());
+    OP_CHECK_IF(
+        totalTensorCount > FOREACH_MAX_TENSOR_COUNT || totalTensorCount <= 0,
+        OP_LOGE(
+            tilingContext, "The number of tensors [%d] not in (0, %hu].", totalTensorCount, FOREACH_MAX_TENSOR_COUNT),
+        return ge::GRAPH_FAILED);
+    OP_CHECK_IF(
+        tilingContext->GetComputeNodeInputNum() != INPUT_LIST_NUM * size_t(totalTensorCount),
+        OP_LOGE(tilingContext, "x1, x2 and x3 must contain %d tensors each.", totalTensorCount),
+        return ge::GRAPH_FAILED);
+
+    auto firstDesc = tilingContext->GetDynamicInputDesc(0, 0);
+    OP_CHECK_NULL_WITH_CONTEXT(tilingContext, firstDesc);
+    dataType = firstDesc->GetDataType();
+    OP_CHECK_IF(
+        dataType != ge::DT_FLOAT16 && dataType != ge::DT_BF16 && dataType != ge::DT_FLOAT,
+        OP_LOGE(tilingContext, "The input dtype not in [float16, bfloat16, float]."), return ge::GRAPH_FAILED);
+    dataTypeSize = ge::GetSizeByDataType(dataType);
+    elementsPerBlock = BYTE_BLOCK / dataTypeSize;
+
+    for (int32_t i = 0; i < totalTensorCount; i++) {
+        auto shapePtr = tilingContext->GetDynamicInputShape(0, i);
+        OP_CHECK_NULL_WITH_CONTEXT(tilingContext, shapePtr);
+        const gert::Shape& xShape = shapePtr->GetStorageShape();
+        for (uint32_t k = 0; k < inputNum; k++) {
+            OP_CHECK_IF(
+                CheckListTensor(k, i, xShape) != ge::GRAPH_SUCCESS,
+                OP_LOGE(tilingContext, "Check input %u tensor %d failed.", k, i), return ge::GRAPH_FAILED);
+        }
+        tensorDataCountList[i] = xShape.GetShapeSize();
+        OP_CHECK_IF(
+            tensorDataCountList[i] == 0, OP_LOGE(tilingContext, "The input shape not support empty tensor."),
+            return ge::GRAPH_FAILED);
+        // Make a 32-byte alignment for each Tensor
+        tensorDataCountAlignedList[i] = Ops::Base::CeilAlign(tensorDataCountList[i], int64_t(elementsPerBlock));
+        totalDataCountAligned += tensorDataCountAlignedList[i];
+    }
+    OP_LOGD(
+        tilingContext, "mode:%ld, scalar:%f, dataType:%d, totalTensorCount:%d, totalDataCountAligned:%ld.", mode,
+        scalar, static_cast<int32_t>(dataType), totalTensorCount, totalDataCountAligned);
+    return ge::GRAPH_SUCCESS;
+}
+
+ge::graphStatus ForeachPointwiseTiling::RunBigKernelTiling()
+{
+    OP_LOGD(tilingContext, "Start.");
+    OP_CHECK_IF(
+        FillCompileInfo() != ge::GRAPH_SUCCESS, OP_LOGE(tilingContext, "FillCompileInfo error."),
+        return ge::GRAPH_FAILED);
+    OP_CHECK_IF(
+        compileInfo.totalCoreNum > FOREACH_MAX_CORE_COUNT,
+        OP_LOGE(tilingContext, "The number of totalCoreNum exceeds the limit(%hu).", FOREACH_MAX_CORE_COUNT),
+        return ge::GRAPH_FAILED);
+
+    needCoreNum = uint32_t(std::min(totalDataCountAligned / elementsPerBlock, int64_t(compileInfo.totalCoreNum)));
+    OP_CHECK_IF(needCoreNum == 0, OP_LOGE(tilingContext, "Param needCoreNum is zero."), return ge::GRAPH_FAILED);
+    Ops::Math::OpTiling::TensorListSplitInfo splitInfo;
+    splitInfo.tensorStartList = tilingData.get_tensorStartList();
+    splitInfo.tensorEndList = tilingData.get_tensorEndList();
+    splitInfo.tensorStartOffsetList = tilingData.get_tensorStartOffsetList();
+    splitInfo.tensorEndOffsetList = tilingData.get_tensorEndOffsetList();
+    needCoreNum = Ops::Math::OpTiling::SplitTensorListToCores(
+        tensorDataCountAlignedList, totalTensorCount, dataTypeSize, elementsPerBlock, needCoreNum, splitInfo);
+    OP_CHECK_IF(DivideUbMemory() == false, OP_LOGE(tilingContext, "DivideUbMemory failed."), return ge::GRAPH_FAILED);
+
+    FillTilingData();
+
+    tilingContext->SetTilingKey(GetTilingKeyVal());
+    tilingContext->SetBlockDim(needCoreNum);
+    size_t* workspaces = tilingContext->GetWorkspaceSizes(1);
+    workspaces[0] = WORKSPACE_SIZE;
+    OP_LOGD(tilingContext, "Success.");
+    return ge::GRAPH_SUCCESS;
+}
+
+ge::graphStatus ForeachPointwiseTiling::FillCompileInfo()
+{
+    auto ptrCompileInfo = tilingContext->GetCompileInfo<ForeachPointwiseCompileInfo>();
+    if (ptrCompileInfo != nullptr) {
+        compileInfo = *ptrCompileInfo;
+        return ge::GRAPH_SUCCESS;
+    }
+
+    auto platformInfo = tilingContext->GetPlatformInfo();
+    OP_CHECK_NULL_WITH_CONTEXT(tilingContext, platformInfo);
+
+    compileInfo.totalCoreNum = int32_t(platformInfo->GetCoreNum());
+    platformInfo->GetLocalMemSize(fe::LocalMemType::UB, compileInfo.ubSizePlatForm);
+    return ge::GRAPH_SUCCESS;
+}
+
+bool ForeachPointwiseTiling::DivideUbMemory()
+{
+    /* Per element: double buffered copy-in of every input list and copy-out, plus the float scratch of the
+        kernel (one buffer for float, float copies of inputs/result/scratch for float16 and bfloat16). */
+    uint32_t calcBytes = (dataTypeSize == int32_t(DTYPE_SIZE_FLOAT)) ? DTYPE_SIZE_FLOAT :
+                                                                       (inputNum + 2) * DTYPE_SIZE_FLOAT;
+    uint32_t bytesPerElement = BUFFER_NUM * (inputNum + 1) * dataTypeSize + calcBytes;
+    uint32_t canUseUbSize = uint32_t(compileInfo.ubSizePlatForm / BYTE_BLOCK * BYTE_BLOCK);
+    maxProcCount = Ops::Base::FloorAlign(canUseUbSize / bytesPerElement, PROC_COUNT_ALIGN);
+    return maxProcCount > 0;
+}
+
+uint64_t ForeachPointwiseTiling::GetTilingKeyVal() const
+{
+    ForeachPointwiseDtypeKey dtypeKey = ForeachPointwiseDtypeKey::KEY_FLOAT;
+    if (dataType == ge::DT_FLOAT16) {
+        dtypeKey = ForeachPointwiseDtypeKey::KEY_FLOAT16;
+    } else if (dataType == ge::DT_BF16) {
+        dtypeKey = ForeachPointwiseDtypeKey::KEY_BF16;
+    }
+    return static_cast<uint64_t>(mode) * TILING_KEY_MODE_FACTOR + static_cast<uint64_t>(dtypeKey);
+}
+
+void ForeachPointwiseTiling::FillTilingData()
+{
+    OP_LOGD(tilingContext, "maxProcCount: %u, needCoreNum: %u.", maxProcCount, needCoreNum);
+    tilingData.set_maxProcCount(maxProcCount);
+    tilingData.set_scalar(scalar);
+    tilingData.SaveToBuffer(
+        tilingContext->GetRawTilingData()->GetData(), tilingContext->GetRawTilingData()->GetCapacity());
+    tilingContext->GetRawTilingData()->SetDataSize(tilingData.GetDataSize());
+}
+
+static ge::graphStatus Tiling4ForeachPointwise(gert::TilingContext* context)
+{
+    ForeachPointwiseTiling tilingObject(context);
+    if (tilingObject.Init() != ge::GRAPH_SUCCESS) {
+        OP_LOGE(context, "Init tiling object return failed.");
+        return ge::GRAPH_FAILED;
+    }
+    if (tilingObject.RunBigKernelTiling() != ge::GRAPH_SUCCESS) {
+        OP_LOGE(context, "Run big kernel tiling return failed.");
+        return ge::GRAPH_FAILED;
+    }
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus TilingPrepare4ForeachPointwise(gert::TilingParseContext* context)
+{
+    auto compileInfo = context->GetCompiledInfo<ForeachPointwiseCompileInfo>();
+    OP_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    auto platformInfo = context->GetPlatformInfo();
+    OP_CHECK_NULL_WITH_CONTEXT(context, platformInfo);
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(platformInfo);
+    compileInfo->totalCoreNum = ascendcPlatform.GetCoreNumAiv();
+    OP_CHECK_IF(
+        (compileInfo->totalCoreNum <= 0), OP_LOGE(context, "TilingPrepare4ForeachPointwise get aiv core num failed."),
+        return ge::GRAPH_FAILED);
+
+    uint64_t ubSizePlatForm;
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ubSizePlatForm);
+    compileInfo->ubSizePlatForm = ubSizePlatForm;
+    OP_CHECK_IF(
+        (compileInfo->ubSizePlatForm <= 0), OP_LOGE(context, "TilingPrepare4ForeachPointwise get ub size failed."),
+        return ge::GRAPH_FAILED);
+    return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_OPTILING(ForeachPointwise)
+    .Tiling(Tiling4ForeachPointwise)
+    .TilingParse<ForeachPointwiseCompileInfo>(TilingPrepare4ForeachPointwise);
+
+} // namespace optiling
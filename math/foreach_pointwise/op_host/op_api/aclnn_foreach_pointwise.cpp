@@ -0,0 +1,316 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <algorithm>
+#include "aclnn_foreach_pointwise.h"
+#include "aclnn_kernels/contiguous.h"
+#include "foreach_pointwise.h"
+#include "opdev/common_types.h"
+#include "opdev/data_type_utils.h"
+#include "opdev/format_utils.h"
+#include "opdev/op_dfx.h"
+#include "opdev/op_executor.h"
+#include "opdev/shape_utils.h"
+#include "opdev/tensor_view_utils.h"
+#include "aclnn_kernels/common/op_error_check.h"
+#include "common/op_api_def.h"
+
+using namespace op;
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static const std::initializer_list<op::DataType> DTYPE_SUPPORT_LIST = {
+    op::DataType::DT_FLOAT16, op::DataType::DT_BF16, op::DataType::DT_FLOAT};
+
+static bool CheckListNotNull(const aclTensorList* tensors)
+{
+    OP_CHECK_NULL(tensors, return false);
+    for (uint64_t i = 0; i < tensors->Size(); i++) {
+        if ((*tensors)[i] == nullptr) {
+            OP_LOGE(ACLNN_ERR_PARAM_NULLPTR, "expected a proper Tensor but got null for tensor %lu.", i);
+            return false;
+        }
+    }
+    return true;
+}
+
+// 列表中每个tensor的个数、dtype、shape都需要与x1一致
+static bool CheckListSameWithX1(const aclTensorList* x1, const aclTensorList* other)
+{
+    if (other->Size() != x1->Size()) {
+        OP_LOGE(
+            ACLNN_ERR_PARAM_INVALID, "Tensor list size %lu should be the same as x1 size %lu.", other->Size(),
+            x1->Size());
+        return false;
+    }
+    for (uint64_t i = 0; i < x1->Size(); i++) {
+        auto x = (*x1)[i];
+        auto t = (*other)[i];
+        if (t->GetDataType() != x->GetDataType()) {
+            OP_LOGE(
+                ACLNN_ERR_PARAM_INVALID, "Tensor %lu dtype %s should be the same as x1 dtype %s.", i,
+                op::ToString(t->GetDataType()).GetString(), op::ToString(x->GetDataType()).GetString());
+            return false;
+        }
+        if (t->GetViewShape() != x->GetViewShape()) {
+            OP_LOGE(
+                ACLNN_ERR_PARAM_INVALID, "Tensor %lu shape %s should be the same as x1 shape %s.", i,
+                op::ToString(t->GetViewShape()).GetString(), op::ToString(x->GetViewShape()).GetString());
+            return false;
+        }
+    }
+    return true;
+}
+
+static aclnnStatus CheckParams(
+    const aclTensorList* x1, const aclTensorList* x2, const aclTensorList* x3, const aclTensorList* out)
+{
+    // 1. 检查参数是否为空指针
+    CHECK_RET(CheckListNotNull(x1), ACLNN_ERR_PARAM_NULLPTR);
+    CHECK_RET(CheckListNotNull(x2), ACLNN_ERR_PARAM_NULLPTR);
+    CHECK_RET(CheckListNotNull(x3), ACLNN_ERR_PARAM_NULLPTR);
+    CHECK_RET(CheckListNotNull(out), ACLNN_ERR_PARAM_NULLPTR);
+    if (x1->Size() == 0) {
+        OP_LOGE(ACLNN_ERR_PARAM_INVALID, "Tensor list x1 should not be empty.");
+        return ACLNN_ERR_PARAM_INVALID;
+    }
+
+    // 2. 检查数据类型与维度
+    for (uint64_t i = 0; i < x1->Size(); i++) {
+        auto x = (*x1)[i];
+        if (!CheckType(x->GetDataType(), DTYPE_SUPPORT_LIST)) {
+            OP_LOGE(
+                ACLNN_ERR_PARAM_INVALID, "tensor %lu not implemented for %s, should be in dtype support list [%s].", i,
+                op::ToString(x->GetDataType()).GetString(), op::ToString(DTYPE_SUPPORT_LIST).GetString());
+            return ACLNN_ERR_PARAM_INVALID;
+        }
+        if (x->GetDataType() != (*x1)[0]->GetDataType()) {
+            OP_LOGE(ACLNN_ERR_PARAM_INVALID, "All tensors in x1 should have the same dtype.");
+            return ACLNN_ERR_PARAM_INVALID;
+        }
+        OP_CHECK_MAX_DIM(x, MAX_SUPPORT_DIMS_NUMS, return ACLNN_ERR_PARAM_INVALID);
+    }
+
+    // 3. 检查其余列表与x1一致
+    CHECK_RET(CheckListSameWithX1(x1, x2), ACLNN_ERR_PARAM_INVALID);
+    CHECK_RET(CheckListSameWithX1(x1, x3), ACLNN_ERR_PARAM_INVALID);
+    CHECK_RET(CheckListSameWithX1(x1, out), ACLNN_ERR_PARAM_INVALID);
+    return ACLNN_SUCCESS;
+}
+
+// 已连续的tensor直接使用，仅对非连续tensor插入Contiguous
+static const aclTensorList* ContiguousList(
+    const op::FVector<const aclTensor*>& tensors, size_t start, size_t num, aclOpExecutor* executor)
+{
+    op::FVector<const aclTensor*> contiguousList;
+    for (size_t i = start; i < start + num; i++) {
+        if (IsContiguous(tensors[i])) {
+            contiguousList.push_back(tensors[i]);
+            continue;
+        }
+        auto contiguousOut = l0op::Contiguous(tensors[i], executor);
+        CHECK_RET(contiguousOut != nullptr, nullptr);
+        contiguousList.push_back(contiguousOut);
+    }
+    return executor->AllocTensorList(contiguousList.data(), contiguousList.size());
+}
+
+/**
+ * 整个列表一次下发ForeachPointwise；超过单次下发上限时按FOREACH_MAX_TENSOR_NUM分批。
+ * 不参与计算的输入列表直接复用x1，kernel不会读取。
+ * 连续的out直接作为kernel输出，只有非连续的out申请中间tensor并在计算后ViewCopy。
+ */
+static aclnnStatus ForeachPointwiseProcess(
+    const aclTensorList* x1, const aclTensorList* x2, const aclTensorList* x3, int64_t mode, float scalar,
+    const aclTensorList* out, aclOpExecutor* executor)
+{
+    auto ret = CheckParams(x1, x2, x3, out);
+    CHECK_RET(ret == ACLNN_SUCCESS, ret);
+
+    // 空tensor不参与计算
+    op::FVector<const aclTensor*> inputs[3];
+    op::FVector<const aclTensor*> outputs;
+    const aclTensorList* lists[3] = {x1, x2, x3};
+    for (uint64_t i = 0; i < x1->Size(); i++) {
+        if ((*x1)[i]->IsEmpty()) {
+            continue;
+        }
+        for (size_t k = 0; k < 3; k++) {
+            inputs[k].push_back((*lists[k])[i]);
+        }
+        outputs.push_back((*out)[i]);
+    }
+
+    for (size_t start = 0; start < outputs.size(); start += l0op::FOREACH_MAX_TENSOR_NUM) {
+        size_t num = std::min(l0op::FOREACH_MAX_TENSOR_NUM, outputs.size() - start);
+        const aclTensorList* contiguousLists[3] = {nullptr, nullptr, nullptr};
+        for (size_t k = 0; k < 3; k++) {
+            if (k > 0 && lists[k] == x1) {
+                contiguousLists[k] = contiguousLists[0];
+                continue;
+            }
+            contiguousLists[k] = ContiguousList(inputs[k], start, num, executor);
+            CHECK_RET(contiguousLists[k] != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        }
+        op::FVector<const aclTensor*> kernelOutputs;
+        for (size_t i = start; i < start + num; i++) {
+            if (IsContiguous(outputs[i])) {
+                kernelOutputs.push_back(outputs[i]);
+                continue;
+            }
+            auto tmpOut = executor->AllocTensor(outputs[i]->GetViewShape(), outputs[i]->GetDataType());
+            CHECK_RET(tmpOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+            kernelOutputs.push_back(tmpOut);
+        }
+        auto kernelOutList = executor->AllocTensorList(kernelOutputs.data(), kernelOutputs.size());
+        CHECK_RET(kernelOutList != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        auto result = l0op::ForeachPointwise(
+            contiguousLists[0], contiguousLists[1], contiguousLists[2], mode, scalar, kernelOutList, executor);
+        CHECK_RET(result != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        // 非连续的out需要将计算结果拷贝回去
+        for (size_t i = 0; i < num; i++) {
+            if (kernelOutputs[i] == outputs[start + i]) {
+                continue;
+            }
+            auto viewCopyResult = l0op::ViewCopy((*result)[i], outputs[start + i], executor);
+            CHECK_RET(viewCopyResult != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        }
+    }
+    return ACLNN_SUCCESS;
+}
+
+static float ScalarToFloat(const aclScalar* scalar)
+{
+    return scalar == nullptr ? 1.0f : scalar->ToFloat();
+}
+
+static aclnnStatus ForeachPointwiseGetWorkspaceSize(
+    const aclTensorList* x1, const aclTensorList* x2, const aclTensorList* x3, int64_t mode, float scalar,
+    const aclTensorList* out, uint64_t* workspaceSize, aclOpExecutor** executor)
+{
+    // 固定写法，创建OpExecutor
+    auto uniqueExecutor = CREATE_EXECUTOR();
+    CHECK_RET(uniqueExecutor.get() != nullptr, ACLNN_ERR_INNER_CREATE_EXECUTOR);
+
+    auto ret = ForeachPointwiseProcess(x1, x2, x3, mode, scalar, out, uniqueExecutor.get());
+    CHECK_RET(ret == ACLNN_SUCCESS, ret);
+
+    // 固定写法，获取计算过程中需要使用的workspace大小
+    *workspaceSize = uniqueExecutor->GetWorkspaceSize();
+    uniqueExecutor.ReleaseTo(executor);
+    return ACLNN_SUCCESS;
+}
+
+aclnnStatus aclnnForeachMulScalarGetWorkspaceSize(
+    const aclTensorList* x, const aclScalar* scalar, const aclTensorList* out, uint64_t* workspaceSize,
+    aclOpExecutor** executor)
+{
+    OP_CHECK_COMM_INPUT(workspaceSize, executor);
+    L2_DFX_PHASE_1(aclnnForeachMulScalar, DFX_IN(x, scalar), DFX_OUT(out));
+    OP_CHECK_NULL(scalar, return ACLNN_ERR_PARAM_NULLPTR);
+    return ForeachPointwiseGetWorkspaceSize(
+        x, x, x, l0op::FOREACH_MODE_MULS, ScalarToFloat(scalar), out, workspaceSize, executor);
+}
+
+aclnnStatus aclnnForeachAddListGetWorkspaceSize(
+    const aclTensorList* x1, const aclTensorList* x2, const aclScalar* alpha, const aclTensorList* out,
+    uint64_t* workspaceSize, aclOpExecutor** executor)
+{
+    OP_CHECK_COMM_INPUT(workspaceSize, executor);
+    L2_DFX_PHASE_1(aclnnForeachAddList, DFX_IN(x1, x2, alpha), DFX_OUT(out));
+    // alpha为空时按1处理
+    return ForeachPointwiseGetWorkspaceSize(
+        x1, x2, x1, l0op::FOREACH_MODE_ADD, ScalarToFloat(alpha), out, workspaceSize, executor);
+}
+
+aclnnStatus aclnnForeachLerpScalarGetWorkspaceSize(
+    const aclTensorList* x1, const aclTensorList* x2, const aclScalar* weight, const aclTensorList* out,
+    uint64_t* workspaceSize, aclOpExecutor** executor)
+{
+    OP_CHECK_COMM_INPUT(workspaceSize, executor);
+    L2_DFX_PHASE_1(aclnnForeachLerpScalar, DFX_IN(x1, x2, weight), DFX_OUT(out));
+    OP_CHECK_NULL(weight, return ACLNN_ERR_PARAM_NULLPTR);
+    return ForeachPointwiseGetWorkspaceSize(
+        x1, x2, x1, l0op::FOREACH_MODE_LERP, ScalarToFloat(weight), out, workspaceSize, executor);
+}
+
+aclnnStatus aclnnForeachAddcmulScalarGetWorkspaceSize(
+    const aclTensorList* x1, const aclTensorList* x2, const aclTensorList* x3, const aclScalar* scalar,
+    const aclTensorList* out, uint64_t* workspaceSize, aclOpExecutor** executor)
+{
+    OP_CHECK_COMM_INPUT(workspaceSize, executor);
+    L2_DFX_PHASE_1(aclnnForeachAddcmulScalar, DFX_IN(x1, x2, x3, scalar), DFX_OUT(out));
+    return ForeachPointwiseGetWorkspaceSize(
+        x1, x2, x3, l0op::FOREACH_MODE_ADDCMUL, ScalarToFloat(scalar), out, workspaceSize, executor);
+}
+
+aclnnStatus aclnnForeachAddcdivScalarGetWorkspaceSize(
+    const aclTensorList* x1, const aclTensorList* x2, const aclTensorList* x3, const aclScalar* scalar,
+    const aclTensorList* out, uint64_t* workspaceSize, aclOpExecutor** executor)
+{
+    OP_CHECK_COMM_INPUT(workspaceSize, executor);
+    L2_DFX_PHASE_1(aclnnForeachAddcdivScalar, DFX_IN(x1, x2, x3, scalar), DFX_OUT(out));
+    return ForeachPointwiseGetWorkspaceSize(
+        x1, x2, x3, l0op::FOREACH_MODE_ADDCDIV, ScalarToFloat(scalar), out, workspaceSize, executor);
+}
+
+aclnnStatus aclnnForeachSqrtGetWorkspaceSize(
+    const aclTensorList* x, const aclTensorList* out, uint64_t* workspaceSize, aclOpExecutor** executor)
+{
+    OP_CHECK_COMM_INPUT(workspaceSize, executor);
+    L2_DFX_PHASE_1(aclnnForeachSqrt, DFX_IN(x), DFX_OUT(out));
+    return ForeachPointwiseGetWorkspaceSize(
+        x, x, x, l0op::FOREACH_MODE_SQRT, 1.0f, out, workspaceSize, executor);
+}
+
+aclnnStatus aclnnForeachMulScalar(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream)
+{
+    L2_DFX_PHASE_2(aclnnForeachMulScalar);
+    return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+}
+
+aclnnStatus aclnnForeachAddList(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream)
+{
+    L2_DFX_PHASE_2(aclnnForeachAddList);
+    return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+}
+
+aclnnStatus aclnnForeachLerpScalar(
+    void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream)
+{
+    L2_DFX_PHASE_2(aclnnForeachLerpScalar);
+    return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+}
+
+aclnnStatus aclnnForeachAddcmulScalar(
+    void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream)
+{
+    L2_DFX_PHASE_2(aclnnForeachAddcmulScalar);
+    return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+}
+
+aclnnStatus aclnnForeachAddcdivScalar(
+    void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream)
+{
+    L2_DFX_PHASE_2(aclnnForeachAddcdivScalar);
+    return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+}
+
+aclnnStatus aclnnForeachSqrt(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream)
+{
+    L2_DFX_PHASE_2(aclnnForeachSqrt);
+    return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+}
+
+#ifdef __cplusplus
+}
+#endif
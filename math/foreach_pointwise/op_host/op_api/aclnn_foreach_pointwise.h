@@ -0,0 +1,210 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_API_INC_FOREACH_POINTWISE_H_
+#define OP_API_INC_FOREACH_POINTWISE_H_
+
+#include "aclnn/aclnn_base.h"
+#include "aclnn_util.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief aclnnForeachMulScalar的第一段接口，根据具体的计算流程，计算workspace大小。
+ * @domain aclnn_math
+ *
+ * 算子功能：对输入tensor列表x中的每个tensor乘以标量scalar：out[i] = x[i] * scalar。
+ * 整个tensor列表在一次kernel下发中完成计算，float16/bfloat16在kernel内以float计算。
+ *
+ * @param [in] x: npu device侧的aclTensorList，数据类型支持FLOAT、FLOAT16、BFLOAT16，数据格式支持ND。
+ * @param [in] scalar: host侧的aclScalar，数据类型需要可转换为FLOAT。
+ * @param [in] out: npu device侧的aclTensorList，tensor个数、shape和数据类型与输入一致，支持与输入为同一列表。
+ * @param [out] workspaceSize: 返回用户需要在npu device侧申请的workspace大小。
+ * @param [out] executor: 返回op执行器，包含算子计算流程。
+ * @return aclnnStatus: 返回状态码。
+ */
+ACLNN_API aclnnStatus aclnnForeachMulScalarGetWorkspaceSize(
+    const aclTensorList* x, const aclScalar* scalar, const aclTensorList* out, uint64_t* workspaceSize,
+    aclOpExecutor** executor);
+
+/**
+ * @brief aclnnForeachMulScalar的第二段接口，用于执行计算。
+ *
+ * @param [in] workspace: 在npu device侧申请的workspace内存起址。
+ * @param [in] workspace_size: 在npu device侧申请的workspace大小，由第一段接口aclnnForeachMulScalarGetWorkspaceSize获取。
+ * @param [in] executor: op执行器，包含了算子计算流程。
+ * @param [in] stream: acl stream流。
+ * @return aclnnStatus: 返回状态码。
+ */
+ACLNN_API aclnnStatus aclnnForeachMulScalar(
+    void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream);
+
+/**
+ * @brief aclnnForeachAddList的第一段接口，根据具体的计算流程，计算workspace大小。
+ * @domain aclnn_math
+ *
+ * 算子功能：out[i] = x1[i] + alpha * x2[i]。
+ * 整个tensor列表在一次kernel下发中完成计算，float16/bfloat16在kernel内以float计算。
+ *
+ * @param [in] x1: npu device侧的aclTensorList，数据类型支持FLOAT、FLOAT16、BFLOAT16，数据格式支持ND。
+ * @param [in] x2: npu device侧的aclTensorList，tensor个数、shape和数据类型与x1一致。
+ * @param [in] alpha: host侧的aclScalar，数据类型需要可转换为FLOAT。
+ * @param [in] out: npu device侧的aclTensorList，tensor个数、shape和数据类型与输入一致，支持与输入为同一列表。
+ * @param [out] workspaceSize: 返回用户需要在npu device侧申请的workspace大小。
+ * @param [out] executor: 返回op执行器，包含算子计算流程。
+ * @return aclnnStatus: 返回状态码。
+ */
+ACLNN_API aclnnStatus aclnnForeachAddListGetWorkspaceSize(
+    const aclTensorList* x1, const aclTensorList* x2, const aclScalar* alpha, const aclTensorList* out,
+    uint64_t* workspaceSize, aclOpExecutor** executor);
+
+/**
+ * @brief aclnnForeachAddList的第二段接口，用于执行计算。
+ *
+ * @param [in] workspace: 在npu device侧申请的workspace内存起址。
+ * @param [in] workspace_size: 在npu device侧申请的workspace大小，由第一段接口aclnnForeachAddListGetWorkspaceSize获取。
+ * @param [in] executor: op执行器，包含了算子计算流程。
+ * @param [in] stream: acl stream流。
+ * @return aclnnStatus: 返回状态码。
+ */
+ACLNN_API aclnnStatus aclnnForeachAddList(
+    void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream);
+
+/**
+ * @brief aclnnForeachLerpScalar的第一段接口，根据具体的计算流程，计算workspace大小。
+ * @domain aclnn_math
+ *
+ * 算子功能：out[i] = x1[i] + weight * (x2[i] - x1[i])。
+ * 整个tensor列表在一次kernel下发中完成计算，float16/bfloat16在kernel内以float计算。
+ *
+ * @param [in] x1: npu device侧的aclTensorList，数据类型支持FLOAT、FLOAT16、BFLOAT16，数据格式支持ND。
+ * @param [in] x2: npu device侧的aclTensorList，tensor个数、shape和数据类型与x1一致。
+ * @param [in] weight: host侧的aclScalar，数据类型需要可转换为FLOAT。
+ * @param [in] out: npu device侧的aclTensorList，tensor个数、shape和数据类型与输入一致，支持与输入为同一列表。
+ * @param [out] workspaceSize: 返回用户需要在npu device侧申请的workspace大小。
+ * @param [out] executor: 返回op执行器，包含算子计算流程。
+ * @return aclnnStatus: 返回状态码。
+ */
+ACLNN_API aclnnStatus aclnnForeachLerpScalarGetWorkspaceSize(
+    const aclTensorList* x1, const aclTensorList* x2, const aclScalar* weight, const aclTensorList* out,
+    uint64_t* workspaceSize, aclOpExecutor** executor);
+
+/**
+ * @brief aclnnForeachLerpScalar的第二段接口，用于执行计算。
+ *
+ * @param [in] workspace: 在npu device侧申请的workspace内存起址。
+ * @param [in] workspace_size: 在npu device侧申请的workspace大小，由第一段接口aclnnForeachLerpScalarGetWorkspaceSize获取。
+ * @param [in] executor: op执行器，包含了算子计算流程。
+ * @param [in] stream: acl stream流。
+ * @return aclnnStatus: 返回状态码。
+ */
+ACLNN_API aclnnStatus aclnnForeachLerpScalar(
+    void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream);
+
+/**
+ * @brief aclnnForeachAddcmulScalar的第一段接口，根据具体的计算流程，计算workspace大小。
+ * @domain aclnn_math
+ *
+ * 算子功能：out[i] = x1[i] + scalar * x2[i] * x3[i]。
+ * 整个tensor列表在一次kernel下发中完成计算，float16/bfloat16在kernel内以float计算。
+ *
+ * @param [in] x1: npu device侧的aclTensorList，数据类型支持FLOAT、FLOAT16、BFLOAT16，数据格式支持ND。
+ * @param [in] x2: npu device侧的aclTensorList，tensor个数、shape和数据类型与x1一致。
+ * @param [in] x3: npu device侧的aclTensorList，tensor个数、shape和数据类型与x1一致。
+ * @param [in] scalar: host侧的aclScalar，数据类型需要可转换为FLOAT。
+ * @param [in] out: npu device侧的aclTensorList，tensor个数、shape和数据类型与输入一致，支持与输入为同一列表。
+ * @param [out] workspaceSize: 返回用户需要在npu device侧申请的workspace大小。
+ * @param [out] executor: 返回op执行器，包含算子计算流程。
+ * @return aclnnStatus: 返回状态码。
+ */
+ACLNN_API aclnnStatus aclnnForeachAddcmulScalarGetWorkspaceSize(
+    const aclTensorList* x1, const aclTensorList* x2, const aclTensorList* x3, const aclScalar* scalar,
+    const aclTensorList* out, uint64_t* workspaceSize, aclOpExecutor** executor);
+
+/**
+ * @brief aclnnForeachAddcmulScalar的第二段接口，用于执行计算。
+ *
+ * @param [in] workspace: 在npu device侧申请的workspace内存起址。
+ * @param [in] workspace_size: 在npu device侧申请的workspace大小，由第一段接口aclnnForeachAddcmulScalarGetWorkspaceSize获取。
+ * @param [in] executor: op执行器，包含了算子计算流程。
+ * @param [in] stream: acl stream流。
+ * @return aclnnStatus: 返回状态码。
+ */
+ACLNN_API aclnnStatus aclnnForeachAddcmulScalar(
+    void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream);
+
+/**
+ * @brief aclnnForeachAddcdivScalar的第一段接口，根据具体的计算流程，计算workspace大小。
+ * @domain aclnn_math
+ *
+ * 算子功能：out[i] = x1[i] + scalar * x2[i] / x3[i]。
+ * 整个tensor列表在一次kernel下发中完成计算，float16/bfloat16在kernel内以float计算。
+ *
+ * @param [in] x1: npu device侧的aclTensorList，数据类型支持FLOAT、FLOAT16、BFLOAT16，数据格式支持ND。
+ * @param [in] x2: npu device侧的aclTensorList，tensor个数、shape和数据类型与x1一致。
+ * @param [in] x3: npu device侧的aclTensorList，tensor个数、shape和数据类型与x1一致。
+ * @param [in] scalar: host侧的aclScalar，数据类型需要可转换为FLOAT。
+ * @param [in] out: npu device侧的aclTensorList，tensor个数、shape和数据类型与输入一致，支持与输入为同一列表。
+ * @param [out] workspaceSize: 返回用户需要在npu device侧申请的workspace大小。
+ * @param [out] executor: 返回op执行器，包含算子计算流程。
+ * @return aclnnStatus: 返回状态码。
+ */
+ACLNN_API aclnnStatus aclnnForeachAddcdivScalarGetWorkspaceSize(
+    const aclTensorList* x1, const aclTensorList* x2, const aclTensorList* x3, const aclScalar* scalar,
+    const aclTensorList* out, uint64_t* workspaceSize, aclOpExecutor** executor);
+
+/**
+ * @brief aclnnForeachAddcdivScalar的第二段接口，用于执行计算。
+ *
+ * @param [in] workspace: 在npu device侧申请的workspace内存起址。
+ * @param [in] workspace_size: 在npu device侧申请的workspace大小，由第一段接口aclnnForeachAddcdivScalarGetWorkspaceSize获取。
+ * @param [in] executor: op执行器，包含了算子计算流程。
+ * @param [in] stream: acl stream流。
+ * @return aclnnStatus: 返回状态码。
+ */
+ACLNN_API aclnnStatus aclnnForeachAddcdivScalar(
+    void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream);
+
+/**
+ * @brief aclnnForeachSqrt的第一段接口，根据具体的计算流程，计算workspace大小。
+ * @domain aclnn_math
+ *
+ * 算子功能：out[i] = sqrt(x[i])。
+ * 整个tensor列表在一次kernel下发中完成计算，float16/bfloat16在kernel内以float计算。
+ *
+ * @param [in] x: npu device侧的aclTensorList，数据类型支持FLOAT、FLOAT16、BFLOAT16，数据格式支持ND。
+ * @param [in] out: npu device侧的aclTensorList，tensor个数、shape和数据类型与输入一致，支持与输入为同一列表。
+ * @param [out] workspaceSize: 返回用户需要在npu device侧申请的workspace大小。
+ * @param [out] executor: 返回op执行器，包含算子计算流程。
+ * @return aclnnStatus: 返回状态码。
+ */
+ACLNN_API aclnnStatus aclnnForeachSqrtGetWorkspaceSize(
+    const aclTensorList* x, const aclTensorList* out, uint64_t* workspaceSize, aclOpExecutor** executor);
+
+/**
+ * @brief aclnnForeachSqrt的第二段接口，用于执行计算。
+ *
+ * @param [in] workspace: 在npu device侧申请的workspace内存起址。
+ * @param [in] workspace_size: 在npu device侧申请的workspace大小，由第一段接口aclnnForeachSqrtGetWorkspaceSize获取。
+ * @param [in] executor: op执行器，包含了算子计算流程。
+ * @param [in] stream: acl stream流。
+ * @return aclnnStatus: 返回状态码。
+ */
+ACLNN_API aclnnStatus aclnnForeachSqrt(
+    void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OP_API_INC_FOREACH_POINTWISE_H_
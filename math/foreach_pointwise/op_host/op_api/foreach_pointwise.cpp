@@ -0,0 +1,51 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file foreach_pointwise.cpp
+ * \brief
+ */
+#include "foreach_pointwise.h"
+#include "opdev/make_op_executor.h"
+#include "opdev/op_def.h"
+#include "opdev/op_dfx.h"
+#include "opdev/op_executor.h"
+#include "opdev/shape_utils.h"
+
+using namespace op;
+
+namespace l0op {
+OP_TYPE_REGISTER(ForeachPointwise);
+
+const aclTensorList* ForeachPointwise(
+    const aclTensorList* x1, const aclTensorList* x2, const aclTensorList* x3, int64_t mode, float scalar,
+    const aclTensorList* out, aclOpExecutor* executor)
+{
+    L0_DFX(ForeachPointwise, x1, x2, x3, mode, scalar, out);
+    if (out == nullptr) {
+        FVector<const aclTensor*> outVector;
+        for (uint64_t i = 0; i < x1->Size(); i++) {
+            auto outTensor = executor->AllocTensor((*x1)[i]->GetViewShape(), (*x1)[i]->GetDataType());
+            CHECK_RET(outTensor != nullptr, nullptr);
+            outVector.emplace_back(outTensor);
+        }
+        out = executor->AllocTensorList(outVector.data(), outVector.size());
+        CHECK_RET(out != nullptr, nullptr);
+    }
+    auto ret = ADD_TO_LAUNCHER_LIST_AICORE(
+        ForeachPointwise, OP_INPUT(x1, x2, x3), OP_OUTPUT(out), OP_ATTR(mode, scalar));
+    OP_CHECK(
+        ret == ACLNN_SUCCESS,
+        OP_LOGE(ACLNN_ERR_INNER_NULLPTR, "ForeachPointwiseAiCore ADD_TO_LAUNCHER_LIST_AICORE failed."),
+        return nullptr);
+    return out;
+}
+} // namespace l0op
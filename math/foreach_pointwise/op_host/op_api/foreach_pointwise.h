@@ -0,0 +1,38 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file foreach_pointwise.h
+ * \brief
+ */
+#ifndef OP_API_INC_LEVEL0_OP_FOREACH_POINTWISE_H_
+#define OP_API_INC_LEVEL0_OP_FOREACH_POINTWISE_H_
+
+#include "opdev/op_executor.h"
+
+namespace l0op {
+// ForeachPointwise的mode属性取值
+constexpr int64_t FOREACH_MODE_MULS = 0;
+constexpr int64_t FOREACH_MODE_ADD = 1;
+constexpr int64_t FOREACH_MODE_LERP = 2;
+constexpr int64_t FOREACH_MODE_ADDCMUL = 3;
+constexpr int64_t FOREACH_MODE_ADDCDIV = 4;
+constexpr int64_t FOREACH_MODE_SQRT = 5;
+// 单次下发支持的最大tensor个数
+constexpr size_t FOREACH_MAX_TENSOR_NUM = 256;
+
+// out为空时申请连续的输出列表；非空时直接写入out，要求其中tensor均连续
+const aclTensorList* ForeachPointwise(
+    const aclTensorList* x1, const aclTensorList* x2, const aclTensorList* x3, int64_t mode, float scalar,
+    const aclTensorList* out, aclOpExecutor* executor);
+} // namespace l0op
+
+#endif // OP_API_INC_LEVEL0_OP_FOREACH_POINTWISE_H_
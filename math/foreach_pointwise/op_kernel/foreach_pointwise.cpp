@@ -0,0 +1,74 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file foreach_pointwise.cpp
+ * \brief
+ */
+
+#include "foreach_pointwise_functor.h"
+
+using namespace ForeachPointwise;
+using namespace MultiTensorApply;
+
+template <typename T, typename Functor>
+__aicore__ inline void ForeachPointwiseRun(
+    GM_ADDR x1, GM_ADDR x2, GM_ADDR x3, GM_ADDR y, const ForeachPointwiseTilingData* tilingData)
+{
+    MultiTensorApplyND<T, Functor, ForeachPointwiseTilingData> op;
+    op.Init(x1, x2, x3, y, tilingData);
+    op.Process();
+}
+
+extern "C" __global__ __aicore__ void foreach_pointwise(
+    GM_ADDR x1, GM_ADDR x2, GM_ADDR x3, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling)
+{
+    GET_TILING_DATA(tilingData, tiling);
+
+    // tiling key = mode * 10 + dtype key(1: float, 2: float16, 3: bfloat16)
+    if (TILING_KEY_IS(1)) {
+        ForeachPointwiseRun<float, MulsFunctor>(x1, x2, x3, y, &tilingData);
+    } else if (TILING_KEY_IS(2)) {
+        ForeachPointwiseRun<half, MulsFunctor>(x1, x2, x3, y, &tilingData);
+    } else if (TILING_KEY_IS(3)) {
+        ForeachPointwiseRun<bfloat16_t, MulsFunctor>(x1, x2, x3, y, &tilingData);
+    } else if (TILING_KEY_IS(11)) {
+        ForeachPointwiseRun<float, AddFunctor>(x1, x2, x3, y, &tilingData);
+    } else if (TILING_KEY_IS(12)) {
+        ForeachPointwiseRun<half, AddFunctor>(x1, x2, x3, y, &tilingData);
+    } else if (TILING_KEY_IS(13)) {
+        ForeachPointwiseRun<bfloat16_t, AddFunctor>(x1, x2, x3, y, &tilingData);
+    } else if (TILING_KEY_IS(21)) {
+        ForeachPointwiseRun<float, LerpFunctor>(x1, x2, x3, y, &tilingData);
+    } else if (TILING_KEY_IS(22)) {
+        ForeachPointwiseRun<half, LerpFunctor>(x1, x2, x3, y, &tilingData);
+    } else if (TILING_KEY_IS(23)) {
+        ForeachPointwiseRun<bfloat16_t, LerpFunctor>(x1, x2, x3, y, &tilingData);
+    } else if (TILING_KEY_IS(31)) {
+        ForeachPointwiseRun<float, AddcmulFunctor>(x1, x2, x3, y, &tilingData);
+    } else if (TILING_KEY_IS(32)) {
+        ForeachPointwiseRun<half, AddcmulFunctor>(x1, x2, x3, y, &tilingData);
+    } else if (TILING_KEY_IS(33)) {
+        ForeachPointwiseRun<bfloat16_t, AddcmulFunctor>(x1, x2, x3, y, &tilingData);
+    } else if (TILING_KEY_IS(41)) {
+        ForeachPointwiseRun<float, AddcdivFunctor>(x1, x2, x3, y, &tilingData);
+    } else if (TILING_KEY_IS(42)) {
+        ForeachPointwiseRun<half, AddcdivFunctor>(x1, x2, x3, y, &tilingData);
+    } else if (TILING_KEY_IS(43)) {
+        ForeachPointwiseRun<bfloat16_t, AddcdivFunctor>(x1, x2, x3, y, &tilingData);
+    } else if (TILING_KEY_IS(51)) {
+        ForeachPointwiseRun<float, SqrtFunctor>(x1, x2, x3, y, &tilingData);
+    } else if (TILING_KEY_IS(52)) {
+        ForeachPointwiseRun<half, SqrtFunctor>(x1, x2, x3, y, &tilingData);
+    } else if (TILING_KEY_IS(53)) {
+        ForeachPointwiseRun<bfloat16_t, SqrtFunctor>(x1, x2, x3, y, &tilingData);
+    }
+}
@@ -0,0 +1,104 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file foreach_pointwise_functor.h
+ * \brief
+ */
+#ifndef FOREACH_POINTWISE_FUNCTOR_H
+#define FOREACH_POINTWISE_FUNCTOR_H
+
+#ifdef __CCE_KT_TEST__
+#include "../../../common/inc/op_kernel/multi_tensor_apply.h"
+#else
+#include "../common/multi_tensor_apply.h"
+#endif
+
+namespace ForeachPointwise {
+
+using namespace AscendC;
+
+// y = x1 * scalar
+struct MulsFunctor {
+    static constexpr int32_t INPUT_NUM = 1;
+    static __aicore__ inline void Compute(
+        const LocalTensor<float>& dst, const LocalTensor<float> (&src)[INPUT_NUM], const LocalTensor<float>& tmp,
+        float scalar, uint32_t count)
+    {
+        Muls(dst, src[0], scalar, count);
+    }
+};
+
+// y = x1 + scalar * x2
+struct AddFunctor {
+    static constexpr int32_t INPUT_NUM = 2;
+    static __aicore__ inline void Compute(
+        const LocalTensor<float>& dst, const LocalTensor<float> (&src)[INPUT_NUM], const LocalTensor<float>& tmp,
+        float scalar, uint32_t count)
+    {
+        Muls(tmp, src[1], scalar, count);
+        Add(dst, src[0], tmp, count);
+    }
+};
+
+// y = x1 + scalar * (x2 - x1)
+struct LerpFunctor {
+    static constexpr int32_t INPUT_NUM = 2;
+    static __aicore__ inline void Compute(
+        const LocalTensor<float>& dst, const LocalTensor<float> (&src)[INPUT_NUM], const LocalTensor<float>& tmp,
+        float scalar, uint32_t count)
+    {
+        Sub(tmp, src[1], src[0], count);
+        Muls(tmp, tmp, scalar, count);
+        Add(dst, src[0], tmp, count);
+    }
+};
+
+// y = x1 + scalar * x2 * x3
+struct AddcmulFunctor {
+    static constexpr int32_t INPUT_NUM = 3;
+    static __aicore__ inline void Compute(
+        const LocalTensor<float>& dst, const LocalTensor<float> (&src)[INPUT_NUM], const LocalTensor<float>& tmp,
+        float scalar, uint32_t count)
+    {
+        Mul(tmp, src[1], src[2], count);
+        Muls(tmp, tmp, scalar, count);
+        Add(dst, src[0], tmp, count);
+    }
+};
+
+// y = x1 + scalar * x2 / x3
+struct AddcdivFunctor {
+    static constexpr int32_t INPUT_NUM = 3;
+    static __aicore__ inline void Compute(
+        const LocalTensor<float>& dst, const LocalTensor<float> (&src)[INPUT_NUM], const LocalTensor<float>& tmp,
+        float scalar, uint32_t count)
+    {
+        Div(tmp, src[1], src[2], count);
+        Muls(tmp, tmp, scalar, count);
+        Add(dst, src[0], tmp, count);
+    }
+};
+
+// y = sqrt(x1)
+struct SqrtFunctor {
+    static constexpr int32_t INPUT_NUM = 1;
+    static __aicore__ inline void Compute(
+        const LocalTensor<float>& dst, const LocalTensor<float> (&src)[INPUT_NUM], const LocalTensor<float>& tmp,
+        float scalar, uint32_t count)
+    {
+        Sqrt(dst, src[0], count);
+    }
+};
+
+} // namespace ForeachPointwise
+
+#endif // FOREACH_POINTWISE_FUNCTOR_H
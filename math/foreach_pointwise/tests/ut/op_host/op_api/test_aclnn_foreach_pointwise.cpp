@@ -0,0 +1,96 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include "gtest/gtest.h"
+#include "../../../../op_host/op_api/aclnn_foreach_pointwise.h"
+#include "op_api_ut_common/tensor_desc.h"
+#include "op_api_ut_common/scalar_desc.h"
+#include "op_api_ut_common/op_api_ut.h"
+#include "op_api_ut_common/inner/types.h"
+
+class l2_foreach_pointwise_test : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        std::cout << "l2_foreach_pointwise_test SetUp" << std::endl;
+    }
+
+    static void TearDownTestCase()
+    {
+        std::cout << "l2_foreach_pointwise_test TearDown" << std::endl;
+    }
+};
+
+// 正常addcmul，列表内shape各不相同
+TEST_F(l2_foreach_pointwise_test, l2_foreach_addcmul_float)
+{
+    auto tensor1Desc = TensorDesc({2, 3}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto tensor2Desc = TensorDesc({1000}, ACL_FLOAT, ACL_FORMAT_ND).ValueRange(-1, 1);
+    auto listDesc = TensorListDesc({tensor1Desc, tensor2Desc});
+    auto outDesc = TensorListDesc({tensor1Desc, tensor2Desc});
+    auto scalarDesc = ScalarDesc(0.5f);
+    auto ut = OP_API_UT(
+        aclnnForeachAddcmulScalar, INPUT(listDesc, listDesc, listDesc, scalarDesc), OUTPUT(outDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACL_SUCCESS);
+}
+
+// 正常sqrt，bfloat16
+TEST_F(l2_foreach_pointwise_test, l2_foreach_sqrt_bf16)
+{
+    auto tensorDesc = TensorDesc({16, 16}, ACL_BF16, ACL_FORMAT_ND).ValueRange(0, 4);
+    auto listDesc = TensorListDesc(3, tensorDesc);
+    auto outDesc = TensorListDesc(3, tensorDesc);
+    auto ut = OP_API_UT(aclnnForeachSqrt, INPUT(listDesc), OUTPUT(outDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACL_SUCCESS);
+}
+
+// 输入为空指针
+TEST_F(l2_foreach_pointwise_test, l2_foreach_mul_scalar_nullptr)
+{
+    auto tensorDesc = TensorDesc({2, 3}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto outDesc = TensorListDesc(2, tensorDesc);
+    auto scalarDesc = ScalarDesc(2.0f);
+    auto ut = OP_API_UT(aclnnForeachMulScalar, INPUT(nullptr, scalarDesc), OUTPUT(outDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_NULLPTR);
+}
+
+// x2与x1 shape不一致
+TEST_F(l2_foreach_pointwise_test, l2_foreach_add_list_shape_mismatch)
+{
+    auto tensor1Desc = TensorDesc({2, 3}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto tensor2Desc = TensorDesc({3, 2}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto x1Desc = TensorListDesc(2, tensor1Desc);
+    auto x2Desc = TensorListDesc({tensor1Desc, tensor2Desc});
+    auto outDesc = TensorListDesc(2, tensor1Desc);
+    auto scalarDesc = ScalarDesc(1.0f);
+    auto ut = OP_API_UT(aclnnForeachAddList, INPUT(x1Desc, x2Desc, scalarDesc), OUTPUT(outDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
+
+// 不支持的数据类型
+TEST_F(l2_foreach_pointwise_test, l2_foreach_lerp_int32)
+{
+    auto tensorDesc = TensorDesc({2, 3}, ACL_INT32, ACL_FORMAT_ND);
+    auto listDesc = TensorListDesc(2, tensorDesc);
+    auto outDesc = TensorListDesc(2, tensorDesc);
+    auto scalarDesc = ScalarDesc(0.5f);
+    auto ut = OP_API_UT(aclnnForeachLerpScalar, INPUT(listDesc, listDesc, scalarDesc), OUTPUT(outDesc));
+    uint64_t workspaceSize = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
@@ -0,0 +1,163 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file test_foreach_pointwise_tiling.cpp
+ * \brief
+ */
+
+#include <iostream>
+#include <gtest/gtest.h>
+#include "tiling_context_faker.h"
+#include "tiling_case_executor.h"
+#include "../../../op_host/foreach_pointwise_tiling.h"
+
+class ForeachPointwiseTiling : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        std::cout << "ForeachPointwiseTiling SetUp" << std::endl;
+    }
+
+    static void TearDownTestCase()
+    {
+        std::cout << "ForeachPointwiseTiling TearDown" << std::endl;
+    }
+};
+
+struct ForeachPointwiseCompileInfo {
+    uint32_t coreNum = 0;
+    uint64_t ubSizePlatForm = 0;
+};
+
+// small fp16 lists are packed onto one core
+TEST_F(ForeachPointwiseTiling, foreach_pointwise_test_tiling_addcmul_fp16)
+{
+    ForeachPointwiseCompileInfo compileInfo = {48, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "ForeachPointwise",
+        {
+            {{{3, 6, 5}, {3, 6, 5}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{1000}, {1000}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{17}, {17}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{3, 6, 5}, {3, 6, 5}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{1000}, {1000}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{17}, {17}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{3, 6, 5}, {3, 6, 5}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{1000}, {1000}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{17}, {17}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+        },
+        {
+            {{{3, 6, 5}, {3, 6, 5}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{1000}, {1000}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{17}, {17}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("mode", Ops::Math::AnyValue::CreateFrom<int64_t>(3)),
+         gert::TilingContextPara::OpAttr("scalar", Ops::Math::AnyValue::CreateFrom<float>(0.5))},
+        {3, 3, 3}, {3}, &compileInfo);
+    uint64_t expectTilingKey = 32;
+    string expectTilingData =
+        "4539628424389465408 90 1000 17 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 2 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 31 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 ";
+    std::vector<size_t> expectWorkspaces = {1};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+// large tensors are split across all cores
+TEST_F(ForeachPointwiseTiling, foreach_pointwise_test_tiling_muls_fp32)
+{
+    ForeachPointwiseCompileInfo compileInfo = {48, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "ForeachPointwise",
+        {
+            {{{64000}, {64000}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{8}, {8}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{300000}, {300000}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{64000}, {64000}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{8}, {8}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{300000}, {300000}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{64000}, {64000}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{8}, {8}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{300000}, {300000}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{64000}, {64000}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{8}, {8}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{300000}, {300000}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("mode", Ops::Math::AnyValue::CreateFrom<int64_t>(0)),
+         gert::TilingContextPara::OpAttr("scalar", Ops::Math::AnyValue::CreateFrom<float>(2.0))},
+        {3, 3, 3}, {3}, &compileInfo);
+    uint64_t expectTilingKey = 1;
+    string expectTilingData =
+        "4611686018427397696 64000 8 300000 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
+        "0 0 0 562958543486976 562958543486978 562958543486978 562958543486978 562958543486978 562958543486978 "
+        "562958543486978 562958543486978 562958543486978 562958543486978 0 0 0 0 0 0 562958543486978 562958543486978 "
+        "562958543486978 562958543486978 562958543486978 562958543486978 562958543486978 562958543486978 "
+        "562958543486978 562958543486978 0 0 0 0 0 7672 15344 23016 30688 38360 46032 53704 61376 944 8616 16288 "
+        "23960 31632 39304 46976 54648 62320 69992 77664 85336 93008 100680 108352 116024 123696 131368 139040 "
+        "146712 154384 162056 169728 177400 185072 192744 200416 208088 215760 223432 231104 238776 246448 254120 "
+        "261792 269464 277136 284808 292480 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 7671 15343 23015 30687 38359 46031 53703 "
+        "61375 943 8615 16287 23959 31631 39303 46975 54647 62319 69991 77663 85335 93007 100679 108351 116023 "
+        "123695 131367 139039 146711 154383 162055 169727 177399 185071 192743 200415 208087 215759 223431 231103 "
+        "238775 246447 254119 261791 269463 277135 284807 292479 299999 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 ";
+    std::vector<size_t> expectWorkspaces = {1};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(ForeachPointwiseTiling, foreach_pointwise_test_tiling_invalid_mode)
+{
+    ForeachPointwiseCompileInfo compileInfo = {48, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "ForeachPointwise",
+        {
+            {{{16}, {16}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{16}, {16}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{16}, {16}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{16}, {16}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("mode", Ops::Math::AnyValue::CreateFrom<int64_t>(6)),
+         gert::TilingContextPara::OpAttr("scalar", Ops::Math::AnyValue::CreateFrom<float>(1.0))},
+        {1, 1, 1}, {1}, &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
+
+// x2 must have the shape of x1
+TEST_F(ForeachPointwiseTiling, foreach_pointwise_test_tiling_shape_mismatch)
+{
+    ForeachPointwiseCompileInfo compileInfo = {48, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "ForeachPointwise",
+        {
+            {{{16}, {16}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{32}, {32}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{16}, {16}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{16}, {16}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("mode", Ops::Math::AnyValue::CreateFrom<int64_t>(1)),
+         gert::TilingContextPara::OpAttr("scalar", Ops::Math::AnyValue::CreateFrom<float>(1.0))},
+        {1, 1, 1}, {1}, &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
@@ -11,6 +11,7 @@
 #include "aclnn_ge_tensor.h"
 #include "greater_equal.h"
 #include "aclnn_kernels/contiguous.h"
+#include "common/level2_elementwise_dispatch.h"
 #include "aclnn_kernels/cast.h"
 #include "aclnn_kernels/transdata.h"
 #include "opdev/op_log.h"
@@ -173,28 +174,28 @@ static aclnnStatus aclnnGeTensorCommon(
         return ACLNN_SUCCESS;
     }
 
-    // self如果非连续，需要转连续
-    auto selfContiguous = l0op::Contiguous(self, uniqueExecutor.get());
-    CHECK_RET(selfContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    // 一次性计算广播类别、输入连续性与Cast需求，按路径表只执行必要的Contiguous/Cast
+    const auto& plan = ElementwiseDispatcher::Select(
+        ElementwiseDispatcher::Classify(self, other, out, promoteType, DataType::DT_BOOL));
 
-    // 将输入self的数据类型转换成推导后的数据类型
-    auto selfCasted = l0op::Cast(selfContiguous, promoteType, uniqueExecutor.get());
+    // 将输入self转换成连续的tensor并转换成隐式数据类型
+    auto selfCasted = ElementwiseDispatcher::PrepareInput(
+        self, plan, ELEMENTWISE_STEP_CONTIGUOUS_SELF, ELEMENTWISE_STEP_CAST_SELF, promoteType, uniqueExecutor.get());
     CHECK_RET(selfCasted != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
-    // other如果非连续，需要转连续
-    auto otherContiguous = l0op::Contiguous(other, uniqueExecutor.get());
-    CHECK_RET(otherContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
-
-    // 将输入other的数据类型转换成推导后的数据类型
-    auto otherCasted = l0op::Cast(otherContiguous, promoteType, uniqueExecutor.get());
+    // 将输入other转换成连续的tensor并转换成隐式数据类型
+    auto otherCasted = ElementwiseDispatcher::PrepareInput(
+        other, plan, ELEMENTWISE_STEP_CONTIGUOUS_OTHER, ELEMENTWISE_STEP_CAST_OTHER, promoteType, uniqueExecutor.get());
     CHECK_RET(otherCasted != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
     // 调用l0算子GreaterEqual进行计算
     auto greaterEqualResult = l0op::GreaterEqual(selfCasted, otherCasted, uniqueExecutor.get());
     CHECK_RET(greaterEqualResult != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
-    // 将输入self的数据类型转换成推导后的数据类型
-    auto greaterEqualResultCasted = l0op::Cast(greaterEqualResult, out->GetDataType(), uniqueExecutor.get());
+    // 计算结果与out类型不一致时才需要Cast
+    auto greaterEqualResultCasted = plan.Has(ELEMENTWISE_STEP_CAST_OUT) ?
+                                        l0op::Cast(greaterEqualResult, out->GetDataType(), uniqueExecutor.get()) :
+                                        greaterEqualResult;
     CHECK_RET(greaterEqualResultCasted != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
     // 如果出参out是非连续Tensor，需要把计算完的连续Tensor转非连续
@@ -166,6 +166,24 @@ ge::graphStatus GroupedBiasAddGradTiling::DoUnequalCPerformanceTiling()
     return ge::GRAPH_SUCCESS;
 }
 
+ge::graphStatus GroupedBiasAddGradTiling::DoUnequalCBalanceTiling()
+{
+    // 行段长度只与baseC相关、与核数无关，段内最多UB_GROUP_SUM_NUM次循环，组内结果全部留在ub
+    OP_LOGD(nodeName_, "[GroupedBiasAddGrad] DoUnequalCBalanceTiling start running.");
+    baseInfoOp_.balance = 1;
+    int64_t coreNum = baseInfoOp_.vectorCoreNum;
+    splitCoreOp_.segRows = UB_GROUP_SUM_NUM * splitCoreOp_.baseC;
+    splitCoreOp_.segNum = Ops::Base::CeilDiv(baseInfoOp_.dimGB, splitCoreOp_.segRows);
+    int64_t totalSplitNum = Ops::Base::CeilDiv(baseInfoOp_.dimH, splitCoreOp_.baseH) * splitCoreOp_.segNum;
+    splitCoreOp_.usedCoreNum = totalSplitNum > coreNum ? coreNum : totalSplitNum;
+    splitCoreOp_.normalCoreProcessNum = Ops::Base::CeilDiv(totalSplitNum, splitCoreOp_.usedCoreNum);
+    splitCoreOp_.tailCoreProcessNum = splitCoreOp_.normalCoreProcessNum - 1;
+    int64_t tailCoreNum = splitCoreOp_.normalCoreProcessNum * splitCoreOp_.usedCoreNum - totalSplitNum;
+    splitCoreOp_.normalCoreNum = splitCoreOp_.usedCoreNum - tailCoreNum;
+    splitCoreOp_.wsUnitNum = 0;
+    return ge::GRAPH_SUCCESS;
+}
+
 ge::graphStatus GroupedBiasAddGradTiling::DoTiling()
 {
     // 分别走C等长和不等长模板切分，C不等长情况还可以根据H大小判断走高性能模板
@@ -197,6 +215,11 @@ ge::graphStatus GroupedBiasAddGradTiling::DoTiling()
         avilableUbsize = avilableUbsize - groupIdxAlign - groupIdxAlign;
         splitCoreOp_.baseC = avilableUbsize / ACTIVE_NODES_NUM / sizeof(float) / splitCoreOp_.baseH;
         splitCoreOp_.wsUnitNum = Ops::Base::CeilDiv(baseInfoOp_.dimGB, splitCoreOp_.baseC);
+        // 行数足够切出多个行段时按行段均衡分核，大组跨核切分、小组在段内打包
+        if (baseInfoOp_.dimGB < INT32_MAX &&
+            baseInfoOp_.dimGB >= BALANCE_MIN_SEG_NUM * UB_GROUP_SUM_NUM * splitCoreOp_.baseC) {
+            return DoUnequalCBalanceTiling();
+        }
     }
     return ge::GRAPH_SUCCESS;
 }
@@ -216,6 +239,7 @@ void GroupedBiasAddGradTiling::SaveToTilingData()
     tilingData_.set_baseC(splitCoreOp_.baseC);
     tilingData_.set_loopCNum(splitCoreOp_.loopCNum);
     tilingData_.set_groupIdxType(baseInfoOp_.groupIdxType);
+    tilingData_.set_segRows(splitCoreOp_.segRows);
 }
 
 ge::graphStatus GroupedBiasAddGradTiling::PostTiling()
@@ -224,7 +248,13 @@ ge::graphStatus GroupedBiasAddGradTiling::PostTiling()
     OP_CHECK_NULL_WITH_CONTEXT(context_, workspaces);
     size_t workspaceSize = WORKSPACE_BASE_CAL;
     workspaces[0] = workspaceSize;
-    workspaces[0] += splitCoreOp_.wsUnitNum * H_BASE_SIZE * splitCoreOp_.usedCoreNum;
+    if (baseInfoOp_.balance == 1) {
+        // 每个(行段, H块)预留段首、段尾两个跨段部分和
+        int64_t hNum = Ops::Base::CeilDiv(baseInfoOp_.dimH, splitCoreOp_.baseH);
+        workspaces[0] += splitCoreOp_.segNum * SEG_SLOT_NUM * hNum * H_BASE_SIZE;
+    } else {
+        workspaces[0] += splitCoreOp_.wsUnitNum * H_BASE_SIZE * splitCoreOp_.usedCoreNum;
+    }
 
     SaveToTilingData();
 
@@ -262,14 +292,14 @@ uint64_t GroupedBiasAddGradTiling::GetTilingKey() const
     }
 
     uint32_t useUBSum = 0;
-    if (splitCoreOp_.wsUnitNum <= UB_GROUP_SUM_NUM) {
+    if (baseInfoOp_.balance == 0 && splitCoreOp_.wsUnitNum <= UB_GROUP_SUM_NUM) {
         useUBSum = 1;
     }
 
     uint32_t groupIdxDtype = baseInfoOp_.groupIdxInputDtype == ge::DT_INT32 ? 0 : 1;
     auto tilingKey = ComputeTiling(
-        {static_cast<uint32_t>(groupIdxDtype), baseInfoOp_.performance, useUBSum, baseInfoOp_.existGroupIdx,
-         static_cast<uint32_t>(inDtype)});
+        {baseInfoOp_.balance, static_cast<uint32_t>(groupIdxDtype), baseInfoOp_.performance, useUBSum,
+         baseInfoOp_.existGroupIdx, static_cast<uint32_t>(inDtype)});
     OP_LOGI(nodeName_, "[GroupedBiasAddGrad] GetTilingKey [%lu].", tilingKey);
     return tilingKey;
 }
@@ -286,6 +316,7 @@ void GroupedBiasAddGradTiling::DumpTilingInfo() const
     info << "baseInfoOp_.gradYInputDtype: " << baseInfoOp_.gradYInputDtype << std::endl;
     info << "baseInfoOp_.existGroupIdx: " << baseInfoOp_.existGroupIdx << std::endl;
     info << "baseInfoOp_.performance: " << baseInfoOp_.performance << std::endl;
+    info << "baseInfoOp_.balance: " << baseInfoOp_.balance << std::endl;
     info << "baseInfoOp_.groupIdxType: " << baseInfoOp_.groupIdxType << std::endl;
 
     info << "splitCoreOp_.usedCoreNum: " << splitCoreOp_.usedCoreNum << std::endl;
@@ -296,6 +327,8 @@ void GroupedBiasAddGradTiling::DumpTilingInfo() const
     info << "splitCoreOp_.baseC: " << splitCoreOp_.baseC << std::endl;
     info << "splitCoreOp_.loopCNum: " << splitCoreOp_.loopCNum << std::endl;
     info << "splitCoreOp_.wsUnitNum: " << splitCoreOp_.wsUnitNum << std::endl;
+    info << "splitCoreOp_.segRows: " << splitCoreOp_.segRows << std::endl;
+    info << "splitCoreOp_.segNum: " << splitCoreOp_.segNum << std::endl;
 
     OP_LOGI(nodeName_, "%s", info.str().c_str());
 }
@@ -45,6 +45,7 @@ struct BaseInfoParams {
     // optional
     uint32_t existGroupIdx{0};
     uint32_t performance{0};
+    uint32_t balance{0};
 };
 
 struct SplitCoreParams {
@@ -58,6 +59,8 @@ struct SplitCoreParams {
 
     int64_t loopCNum{0};
     int64_t wsUnitNum{0};
+    int64_t segRows{0};
+    int64_t segNum{0};
 };
 
 class GroupedBiasAddGradTiling {
@@ -76,6 +79,7 @@ public:
     ge::graphStatus DoTiling();
     ge::graphStatus DoSplitTiling();
     ge::graphStatus DoUnequalCPerformanceTiling();
+    ge::graphStatus DoUnequalCBalanceTiling();
     ge::graphStatus PostTiling();
     void DumpTilingInfo() const;
     uint64_t ComputeTiling(const std::vector<uint32_t>& args) const;
@@ -36,6 +36,8 @@ constexpr int64_t WORKSPACE_BASE_CAL = 32 * 1024 * 1024; // 系统预留
 constexpr int64_t BLOCK_SIZE = 32;
 constexpr int64_t BLOCK_NUM = BLOCK_SIZE / sizeof(int32_t);
 constexpr int64_t PERF_G_NUM = 200;
+constexpr int64_t BALANCE_MIN_SEG_NUM = 2; // 至少切出2个行段才走均衡模板
+constexpr int64_t SEG_SLOT_NUM = 2;        // 每个行段在workspace上预留的跨段部分和个数
 constexpr int64_t TWO_NUM = 2;
 constexpr int64_t THREE_NUM = 3;
 
@@ -35,6 +35,7 @@ TILING_DATA_FIELD_DEF(uint32_t, baseH);    // 单次ub处理的H方向个数
 TILING_DATA_FIELD_DEF(uint32_t, baseC);    // 单次ub处理的C方向个数
 TILING_DATA_FIELD_DEF(uint32_t, loopCNum); // 每个核的ub循环次数
 TILING_DATA_FIELD_DEF(int32_t, groupIdxType);
+TILING_DATA_FIELD_DEF(int64_t, segRows); // 均衡模板每个行段的行数
 END_TILING_DATA_DEF;
 
 REGISTER_TILING_DATA_CLASS(GroupedBiasAddGrad, GroupedBiasAddGradTilingData)
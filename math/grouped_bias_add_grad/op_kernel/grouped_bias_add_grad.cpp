@@ -19,6 +19,7 @@
 #include "grouped_bias_add_grad_equal_c.h"
 #include "grouped_bias_add_grad_unequal_c.h"
 #include "grouped_bias_add_grad_unequal_c_perf.h"
+#include "grouped_bias_add_grad_unequal_c_balance.h"
 
 using namespace GroupedBiasAddGradAll;
 #define THREE_DIMS_HALF 1000000
@@ -56,6 +57,13 @@ using namespace GroupedBiasAddGradAll;
 #define TWO_DIMS_FLOAT_USEUB_GRP64_PERF 1011111
 #define TWO_DIMS_BFLOAT16_USEUB_GRP64_PERF 1011112
 
+#define TWO_DIMS_HALF_BALANCE 1100010
+#define TWO_DIMS_FLOAT_BALANCE 1100011
+#define TWO_DIMS_BFLOAT16_BALANCE 1100012
+#define TWO_DIMS_HALF_GRP64_BALANCE 1110010
+#define TWO_DIMS_FLOAT_GRP64_BALANCE 1110011
+#define TWO_DIMS_BFLOAT16_GRP64_BALANCE 1110012
+
 template <typename T, const uint32_t USE_TYPE>
 __aicore__ inline void InvokeTemplateGroupedEqualC(
     GM_ADDR grad_y, GM_ADDR grad_bias, GM_ADDR userWS, const GroupedBiasAddGradTilingData& tilingData)
@@ -85,6 +93,16 @@ __aicore__ inline void InvokeTemplateGroupedUnequalCPerf(
     op.Process();
 }
 
+template <typename T, typename G>
+__aicore__ inline void InvokeTemplateGroupedUnequalCBalance(
+    GM_ADDR grad_y, GM_ADDR group_idx, GM_ADDR grad_bias, GM_ADDR userWS,
+    const GroupedBiasAddGradTilingData& tilingData)
+{
+    GroupedBiasAddGradUnequalCBalance<T, G> op;
+    op.Init(grad_y, group_idx, grad_bias, userWS, tilingData);
+    op.Process();
+}
+
 extern "C" __global__ __aicore__ void grouped_bias_add_grad(
     GM_ADDR grad_y, GM_ADDR group_idx, GM_ADDR grad_bias, GM_ADDR workspace, GM_ADDR tiling_data)
 {
@@ -162,5 +180,17 @@ extern "C" __global__ __aicore__ void grouped_bias_add_grad(
     } else if (TILING_KEY_IS(TWO_DIMS_BFLOAT16_GRP64_PERF)) {
         InvokeTemplateGroupedUnequalCPerf<bfloat16_t, int64_t, USE_WS>(
             grad_y, group_idx, grad_bias, userWS, tilingData);
+    } else if (TILING_KEY_IS(TWO_DIMS_FLOAT_BALANCE)) {
+        InvokeTemplateGroupedUnequalCBalance<float, int32_t>(grad_y, group_idx, grad_bias, userWS, tilingData);
+    } else if (TILING_KEY_IS(TWO_DIMS_HALF_BALANCE)) {
+        InvokeTemplateGroupedUnequalCBalance<half, int32_t>(grad_y, group_idx, grad_bias, userWS, tilingData);
+    } else if (TILING_KEY_IS(TWO_DIMS_BFLOAT16_BALANCE)) {
+        InvokeTemplateGroupedUnequalCBalance<bfloat16_t, int32_t>(grad_y, group_idx, grad_bias, userWS, tilingData);
+    } else if (TILING_KEY_IS(TWO_DIMS_FLOAT_GRP64_BALANCE)) {
+        InvokeTemplateGroupedUnequalCBalance<float, int64_t>(grad_y, group_idx, grad_bias, userWS, tilingData);
+    } else if (TILING_KEY_IS(TWO_DIMS_HALF_GRP64_BALANCE)) {
+        InvokeTemplateGroupedUnequalCBalance<half, int64_t>(grad_y, group_idx, grad_bias, userWS, tilingData);
+    } else if (TILING_KEY_IS(TWO_DIMS_BFLOAT16_GRP64_BALANCE)) {
+        InvokeTemplateGroupedUnequalCBalance<bfloat16_t, int64_t>(grad_y, group_idx, grad_bias, userWS, tilingData);
     }
 }
\ No newline at end of file
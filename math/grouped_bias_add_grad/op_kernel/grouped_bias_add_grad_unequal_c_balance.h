@@ -0,0 +1,322 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file grouped_bias_add_grad_unequal_c_balance.h
+ * \brief
+ */
+
+#ifndef GROUPED_BIAS_ADD_GRAD_UNEQUAL_C_BALANCE_H
+#define GROUPED_BIAS_ADD_GRAD_UNEQUAL_C_BALANCE_H
+
+#include "kernel_tiling/kernel_tiling.h"
+#include "kernel_operator.h"
+#include "grouped_bias_add_grad_base.h"
+
+namespace GroupedBiasAddGradAll {
+using namespace AscendC;
+
+constexpr int64_t SEG_SLOT_NUM = 2; // 每个行段最多两个跨段分组的部分和：段首组(slot 0)、段尾组(slot 1)
+
+// 按行段均衡分核：grad_y的行按固定segRows切段，(段, H块)为一个单元分给各核，
+// 小组在段内整组算完直接UB输出，大组跨段时各段部分和写workspace，SyncAll后按段号升序合并，结果与核数无关
+template <typename T, typename G>
+class GroupedBiasAddGradUnequalCBalance : public GroupedBiasAddGradBase<T> {
+public:
+    __aicore__ inline GroupedBiasAddGradUnequalCBalance(){};
+    __aicore__ inline void Init(
+        GM_ADDR grad_y, GM_ADDR group_idx, GM_ADDR grad_bias, GM_ADDR workspace,
+        const GroupedBiasAddGradTilingData& tilingData);
+    __aicore__ inline void CopyInGroupIdAndCalcInterval(LocalTensor<int32_t>& interval, LocalTensor<int32_t>& groupIdx);
+    __aicore__ inline void CopyInGroupIdAndCalcInterval(LocalTensor<int64_t>& interval, LocalTensor<int64_t>& groupIdx);
+    __aicore__ inline void Process();
+
+private:
+    __aicore__ inline int64_t FindFirstGroup(const int64_t row, const bool includeEmpty);
+    __aicore__ inline void ProcessSegment(const int64_t segIdx);
+    __aicore__ inline void CombineSegment(const int64_t segIdx);
+    __aicore__ inline void ComputePiece(const int64_t rowStart, const int64_t rowNum);
+    __aicore__ inline void CopyOutPartial(const int64_t segIdx, const int64_t slot);
+    __aicore__ inline void AddPartial(LocalTensor<float>& accLocal, const int64_t segIdx, const int64_t slot);
+    __aicore__ inline int64_t PartialGmAddr(const int64_t segIdx, const int64_t slot) const;
+
+    GlobalTensor<int32_t> groupIdxGm_;
+    TQue<QuePosition::VECIN, 1> groupIntervalInQue_;
+    TQue<QuePosition::VECIN, 1> groupIdxInQue_;
+    LocalTensor<int32_t> cValueLocal_;
+    LocalTensor<int32_t> groupIdxLocal_;
+    uint32_t groupIdxAlign_{0};
+
+    int64_t dimGB_{0};
+    int64_t segRows_{0};
+    int64_t segNum_{0};
+};
+
+template <typename T, typename G>
+__aicore__ inline void GroupedBiasAddGradUnequalCBalance<T, G>::Init(
+    GM_ADDR grad_y, GM_ADDR group_idx, GM_ADDR grad_bias, GM_ADDR workspace,
+    const GroupedBiasAddGradTilingData& tilingData)
+{
+    // Init tiling data
+    this->InitBaseParams(grad_y, grad_bias, workspace, tilingData);
+    dimGB_ = tilingData.dimGB;
+    segRows_ = tilingData.segRows;
+    segNum_ = (dimGB_ + segRows_ - 1) / segRows_;
+
+    groupIdxGm_.SetGlobalBuffer((__gm__ int32_t*)group_idx);
+
+    if constexpr (IsSameType<G, int32_t>::value) {
+        groupIdxAlign_ = (this->dimG_ + B32_BLOCK_NUM - 1) / B32_BLOCK_NUM * B32_BLOCK_NUM;
+    } else {
+        groupIdxAlign_ = (this->dimG_ + B64_BLOCK_NUM - 1) / B64_BLOCK_NUM * B64_BLOCK_NUM;
+    }
+
+    this->pipe_.InitBuffer(groupIntervalInQue_, 1, groupIdxAlign_ * sizeof(G));
+    this->pipe_.InitBuffer(groupIdxInQue_, 1, groupIdxAlign_ * sizeof(G));
+}
+
+template <typename T, typename G>
+__aicore__ inline void GroupedBiasAddGradUnequalCBalance<T, G>::CopyInGroupIdAndCalcInterval(
+    LocalTensor<int32_t>& interval, LocalTensor<int32_t>& groupIdx)
+{
+    DataCopyExtParams copyParams{
+        static_cast<uint16_t>(1), static_cast<uint32_t>(this->dimG_ * sizeof(int32_t)), static_cast<uint32_t>(0),
+        static_cast<uint32_t>(0), static_cast<uint32_t>(0)};
+    int32_t dimGMod = this->dimG_ % B32_BLOCK_NUM;
+    int32_t processRightPad = dimGMod ? (B32_BLOCK_NUM - dimGMod) : 0;
+
+    DataCopyPadExtParams<int32_t> padParams{
+        true, static_cast<uint8_t>(0), static_cast<uint8_t>(processRightPad), static_cast<int32_t>(0)};
+    DataCopyPad(interval, groupIdxGm_[0], copyParams, padParams);
+
+    if (unlikely(this->dimG_ == 1)) {
+        Duplicate(groupIdx, static_cast<int32_t>(0), groupIdxAlign_);
+    } else {
+        GroupedBiasAddGradBase<T>::CalcGroupInterval(interval, groupIdx, groupIdxGm_, processRightPad);
+    }
+    groupIntervalInQue_.EnQue(interval);
+    groupIdxInQue_.EnQue(groupIdx);
+}
+
+template <typename T, typename G>
+__aicore__ inline void GroupedBiasAddGradUnequalCBalance<T, G>::CopyInGroupIdAndCalcInterval(
+    LocalTensor<int64_t>& interval, LocalTensor<int64_t>& groupIdx)
+{
+    DataCopyExtParams copyParams{
+        static_cast<uint16_t>(1), static_cast<uint32_t>(this->dimG_ * sizeof(int64_t)), static_cast<uint32_t>(0),
+        static_cast<uint32_t>(0), static_cast<uint32_t>(0)};
+    int32_t dimGMod = this->dimG_ % B64_BLOCK_NUM;
+    int32_t processRightPad = dimGMod ? (B64_BLOCK_NUM - dimGMod) : 0;
+
+    DataCopyPadExtParams<int32_t> padParams{
+        true, static_cast<uint8_t>(0), static_cast<uint8_t>(processRightPad * 2), static_cast<int32_t>(0)};
+
+    LocalTensor<int32_t> intervalInt32 = interval.template ReinterpretCast<int32_t>();
+    LocalTensor<int32_t> groupIdxInt32 = groupIdx.template ReinterpretCast<int32_t>();
+
+    DataCopyPad(intervalInt32, groupIdxGm_[0], copyParams, padParams);
+
+    if (unlikely(this->dimG_ == 1)) {
+        Duplicate(groupIdxInt32, static_cast<int32_t>(0), groupIdxAlign_ * 2);
+    } else {
+        GroupedBiasAddGradBase<T>::CalcGroupInterval(interval, groupIdx, groupIdxGm_, processRightPad);
+    }
+    groupIntervalInQue_.EnQue(intervalInt32);
+    groupIdxInQue_.EnQue(groupIdxInt32);
+}
+
+template <typename T, typename G>
+__aicore__ inline int64_t GroupedBiasAddGradUnequalCBalance<T, G>::FindFirstGroup(
+    const int64_t row, const bool includeEmpty)
+{
+    // 组起止位置单调不减，二分查找首个结束位置超过row的组；includeEmpty时起点不小于row的空组也算
+    int64_t left = 0;
+    int64_t right = this->dimG_;
+    while (left < right) {
+        int64_t mid = (left + right) / TWO_NUM;
+        int64_t start = groupIdxLocal_(mid);
+        int64_t end = start + cValueLocal_(mid);
+        if (end > row || (includeEmpty && start >= row)) {
+            right = mid;
+        } else {
+            left = mid + 1;
+        }
+    }
+    return left;
+}
+
+template <typename T, typename G>
+__aicore__ inline int64_t GroupedBiasAddGradUnequalCBalance<T, G>::PartialGmAddr(
+    const int64_t segIdx, const int64_t slot) const
+{
+    return ((segIdx * SEG_SLOT_NUM + slot) * this->hNum_ + this->hIdx_) * this->baseH_;
+}
+
+template <typename T, typename G>
+__aicore__ inline void GroupedBiasAddGradUnequalCBalance<T, G>::ComputePiece(
+    const int64_t rowStart, const int64_t rowNum)
+{
+    // 段内行数不超过UB_GROUP_SUM_NUM * baseC，各次循环的组内结果都能放在sumBuf_中
+    this->ComputeBasePara();
+    this->loopCNum_ = (rowNum + this->baseC_ - 1) / this->baseC_;
+    int64_t tailC = rowNum - (this->loopCNum_ - 1) * this->baseC_;
+    LocalTensor<float> groupSumLocal = this->sumBuf_.template Get<float>();
+    for (int64_t loop = 0; loop < this->loopCNum_; loop++) {
+        bool isLastC = loop == (this->loopCNum_ - 1);
+        if (unlikely(isLastC)) {
+            this->processC_ = tailC;
+        }
+        this->ComputePerLoopUb(loop, rowStart, groupSumLocal);
+    }
+    LocalTensor<float> sumOutLocal = this->castBuf_.template Get<float>();
+    this->CustomTensorReduce(sumOutLocal, groupSumLocal, this->loopCNum_, this->baseH_);
+}
+
+template <typename T, typename G>
+__aicore__ inline void GroupedBiasAddGradUnequalCBalance<T, G>::CopyOutPartial(
+    const int64_t segIdx, const int64_t slot)
+{
+    LocalTensor<float> sumOutLocal = this->castBuf_.template Get<float>();
+    LocalTensor<float> partialLocal = this->gradBiasQue_.template AllocTensor<float>();
+    Muls(partialLocal, sumOutLocal, 1.0f, this->processHAlign_);
+    this->gradBiasQue_.template EnQue<float>(partialLocal);
+    partialLocal = this->gradBiasQue_.template DeQue<float>();
+    DataCopyExtParams copyParams{
+        static_cast<uint16_t>(1), static_cast<uint32_t>(this->processHAlign_ * sizeof(float)),
+        static_cast<uint32_t>(0), static_cast<uint32_t>(0), static_cast<uint32_t>(0)};
+    DataCopyPad(this->groupSumWorkspaceGm_[PartialGmAddr(segIdx, slot)], partialLocal, copyParams);
+    this->gradBiasQue_.FreeTensor(partialLocal);
+}
+
+template <typename T, typename G>
+__aicore__ inline void GroupedBiasAddGradUnequalCBalance<T, G>::AddPartial(
+    LocalTensor<float>& accLocal, const int64_t segIdx, const int64_t slot)
+{
+    LocalTensor<float> partialLocal = this->inQue_.template AllocTensor<float>();
+    DataCopyExtParams copyParams{
+        static_cast<uint16_t>(1), static_cast<uint32_t>(this->processHAlign_ * sizeof(float)),
+        static_cast<uint32_t>(0), static_cast<uint32_t>(0), static_cast<uint32_t>(0)};
+    DataCopyPadExtParams<float> padParams{
+        false, static_cast<uint8_t>(0), static_cast<uint8_t>(0), static_cast<float>(0)};
+    DataCopyPad(partialLocal, this->groupSumWorkspaceGm_[PartialGmAddr(segIdx, slot)], copyParams, padParams);
+    this->inQue_.EnQue(partialLocal);
+    partialLocal = this->inQue_.template DeQue<float>();
+    Add(accLocal, accLocal, partialLocal, this->processHAlign_);
+    PipeBarrier<PIPE_V>();
+    this->inQue_.FreeTensor(partialLocal);
+}
+
+template <typename T, typename G>
+__aicore__ inline void GroupedBiasAddGradUnequalCBalance<T, G>::ProcessSegment(const int64_t segIdx)
+{
+    int64_t segStart = segIdx * segRows_;
+    int64_t segEnd = segStart + segRows_ < dimGB_ ? segStart + segRows_ : dimGB_;
+    bool isLastSeg = segIdx == (segNum_ - 1);
+    for (int64_t g = FindFirstGroup(segStart, true); g < this->dimG_; g++) {
+        int64_t start = groupIdxLocal_(g);
+        int64_t cValue = cValueLocal_(g);
+        int64_t end = start + cValue;
+        if (start >= segEnd && !isLastSeg) {
+            break;
+        }
+        this->gIdx_ = g;
+        this->ComputeBasePara();
+        if (unlikely(cValue == 0)) {
+            // 空组归属起点所在的段，尾段兜底超出dimGB的空组
+            if (start >= segStart) {
+                InitOutput<T>(
+                    this->gradBiasGm_[this->gIdx_ * this->dimH_ + this->hIdx_ * this->baseH_], this->processH_, 0);
+            }
+            continue;
+        }
+        int64_t pieceStart = start > segStart ? start : segStart;
+        int64_t pieceEnd = end < segEnd ? end : segEnd;
+        if (pieceEnd <= pieceStart) {
+            continue;
+        }
+        ComputePiece(pieceStart, pieceEnd - pieceStart);
+        if (start >= segStart && (end <= segEnd || isLastSeg)) {
+            // 整组落在本段内，不经过workspace直接输出
+            LocalTensor<float> sumOutLocal = this->castBuf_.template Get<float>();
+            this->CastAndCopyOut(sumOutLocal);
+        } else {
+            CopyOutPartial(segIdx, start < segStart ? 0 : 1);
+        }
+    }
+}
+
+template <typename T, typename G>
+__aicore__ inline void GroupedBiasAddGradUnequalCBalance<T, G>::CombineSegment(const int64_t segIdx)
+{
+    // 由组起点所在段的单元负责合并，按段号升序累加各段部分和，累加顺序固定
+    if (segIdx == segNum_ - 1) {
+        return;
+    }
+    int64_t segStart = segIdx * segRows_;
+    int64_t segEnd = segStart + segRows_;
+    int64_t g = FindFirstGroup(segEnd - 1, false);
+    if (g >= this->dimG_) {
+        return;
+    }
+    int64_t start = groupIdxLocal_(g);
+    int64_t end = start + cValueLocal_(g);
+    if (start < segStart || start >= segEnd || end <= segEnd) {
+        return;
+    }
+    this->gIdx_ = g;
+    this->ComputeBasePara();
+    LocalTensor<float> accLocal = this->castBuf_.template Get<float>();
+    Duplicate(accLocal, static_cast<float>(0), this->processHAlign_);
+    PipeBarrier<PIPE_V>();
+    AddPartial(accLocal, segIdx, 1);
+    for (int64_t s = segIdx + 1; s < segNum_; s++) {
+        AddPartial(accLocal, s, 0);
+        if (end <= (s + 1) * segRows_) {
+            break;
+        }
+    }
+    this->CastAndCopyOut(accLocal);
+}
+
+template <typename T, typename G>
+__aicore__ inline void GroupedBiasAddGradUnequalCBalance<T, G>::Process()
+{
+    if (this->blockIdx_ >= this->usedCoreNum_) {
+        return;
+    }
+
+    LocalTensor<G> cValueTensor = groupIntervalInQue_.AllocTensor<G>();
+    LocalTensor<G> groupIdxTensor = groupIdxInQue_.AllocTensor<G>();
+    CopyInGroupIdAndCalcInterval(cValueTensor, groupIdxTensor);
+    cValueLocal_ = groupIntervalInQue_.DeQue<int32_t>();
+    groupIdxLocal_ = groupIdxInQue_.DeQue<int32_t>();
+    event_t eventVtoS = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::V_S));
+    SetFlag<HardEvent::V_S>(eventVtoS);
+    WaitFlag<HardEvent::V_S>(eventVtoS);
+
+    for (int64_t i = 0; i < this->processGHByCore_; i++) {
+        int64_t unitIdx = this->blockIdx_ + this->usedCoreNum_ * i;
+        this->hIdx_ = unitIdx % this->hNum_;
+        ProcessSegment(unitIdx / this->hNum_);
+    }
+    if (segNum_ > 1) {
+        SyncAll();
+        for (int64_t i = 0; i < this->processGHByCore_; i++) {
+            int64_t unitIdx = this->blockIdx_ + this->usedCoreNum_ * i;
+            this->hIdx_ = unitIdx % this->hNum_;
+            CombineSegment(unitIdx / this->hNum_);
+        }
+    }
+    groupIntervalInQue_.FreeTensor(cValueLocal_);
+    groupIdxInQue_.FreeTensor(groupIdxLocal_);
+}
+} // namespace GroupedBiasAddGradAll
+#endif
@@ -51,7 +51,45 @@ TEST_F(TilingGroupedBiasAddGrad, ascend910B1_test_tiling__001)
         },
         {gert::TilingContextPara::OpAttr("group_idx_type", Ops::Math::AnyValue::CreateFrom<int64_t>(0))}, &compileInfo);
     uint64_t expectTilingKey = 1000111;
-    string expectTilingData = "12884901891 1 1 3 0 32 10 511101108352 0 ";
+    string expectTilingData = "12884901891 1 1 3 0 32 10 511101108352 0 0 ";
     std::vector<size_t> expectWorkspaces = {33555968};
     ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
-}
\ No newline at end of file
+}
+
+TEST_F(TilingGroupedBiasAddGrad, ascend910B1_test_tiling_balance_fp32_int32)
+{
+    optiling::GroupedBiasAddGradCompileInfo compileInfo = {196608, 48};
+    gert::TilingContextPara tilingContextPara(
+        "GroupedBiasAddGrad",
+        {
+            {{{4096, 256}, {4096, 256}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{8}, {8}}, ge::DT_INT32, ge::FORMAT_ND},
+        },
+        {
+            {{{8, 256}, {8, 256}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("group_idx_type", Ops::Math::AnyValue::CreateFrom<int64_t>(0))}, &compileInfo);
+    uint64_t expectTilingKey = 1100011;
+    string expectTilingData = "42949672970 1 0 8 0 256 4096 511101108352 0 952 ";
+    std::vector<size_t> expectWorkspaces = {33564672};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(TilingGroupedBiasAddGrad, ascend910B1_test_tiling_balance_bf16_int64)
+{
+    optiling::GroupedBiasAddGradCompileInfo compileInfo = {196608, 48};
+    gert::TilingContextPara tilingContextPara(
+        "GroupedBiasAddGrad",
+        {
+            {{{20000, 1024}, {20000, 1024}}, ge::DT_BF16, ge::FORMAT_ND},
+            {{{64}, {64}}, ge::DT_INT64, ge::FORMAT_ND},
+        },
+        {
+            {{{64, 1024}, {64, 1024}}, ge::DT_BF16, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("group_idx_type", Ops::Math::AnyValue::CreateFrom<int64_t>(1))}, &compileInfo);
+    uint64_t expectTilingKey = 1110012;
+    string expectTilingData = "137438953520 12884901892 0 64 0 1024 20000 506806141056 4294967296 944 ";
+    std::vector<size_t> expectWorkspaces = {33734656};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
@@ -182,6 +182,7 @@ case_list = [
                 0,  0,  0,  1,  0,  0,  1,  1,  0,  0,  1,  0,  1,  1,  0,  1,  0, \
                 1,  1,  0,  0,  1,  1,  1,  1,  0,  1,  1,  1,  1,  0,  1,  0,  0, \
                 0,  1,  0,  0,  1,  1,  1,  0,  0,  1,  1,  0, 92], 'group_idx_type': 1},
+    {'dtype': 'fp32', 'grp_dtype': np.int32, 'grad_y_shape': [4096, 256], 'group_idx': [0, 3, 3000, 3001, 3005, 3010, 3010, 4096]},
 ]
 
 def grouped_bias_add_grad(grad_y, group_idx, group_idx_type):
@@ -44,6 +44,9 @@ case22_params = [12, 12, 1, 0, 17, 3, 0, 458, 1968, 128, 119, 0, 1]
 case23_params = [40, 20, 100, 100, 2, 200, 0, 2560, 200, 128, 114, 0, 1] # group_idx int64, perf with use ub sum and group_idx_type is 1
 case24_params = [40, 20, 100, 100, 2, 200, 0, 2560, 200, 128, 115, 0, 1] # group_idx int32, perf with use ub sum and group_idx_type is 1
 
+# 均衡模板，最后一个参数为segRows
+case25_params = [10, 10, 1, 0, 0, 8, 0, 256, 4096, 128, 119, 0, 0, 952] # group_idx float32 balance
+
 params_info = {
     "case0": case0_params,
     "case1": case1_params,
@@ -70,6 +73,7 @@ params_info = {
     "case22": case22_params,
     "case23": case23_params,
     "case24": case24_params,
+    "case25": case25_params,
 }
 
 
@@ -79,14 +83,16 @@ def main():
     tiling = np.array(params_info.get(case), dtype=np.int64)
 
     first4 = tiling[:4]
-    middle = tiling[4:-4]
-    last4 = tiling[-4:]
+    middle = tiling[4:9]
+    last4 = tiling[9:13]
+    seg_rows = tiling[13:14] if tiling.size > 13 else np.zeros(1, dtype=np.int64)
 
-    # 写入文件（前4和后4按uint32_t，中间按int64）
+    # 写入文件（前4和后4按uint32_t，中间和segRows按int64）
     with open("tiling.bin", "wb") as tiling_file:
         first4.astype(np.uint32).tofile(tiling_file)  # 前4个按uint32存储
         middle.tofile(tiling_file)                    # 中间按int64存储
         last4.astype(np.uint32).tofile(tiling_file)   # 后4个按uint32存储
+        seg_rows.tofile(tiling_file)                  # segRows按int64存储
 
 
 if __name__ == '__main__':
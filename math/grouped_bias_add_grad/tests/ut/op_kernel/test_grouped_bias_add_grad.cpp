@@ -79,3 +79,46 @@ TEST_F(grouped_bias_add_grad_test, test_case_fp16_group_idx)
 
     system("cd ./grouped_bias_add_grad_data/ && python3 compare_data.py 'float16'");
 }
+
+TEST_F(grouped_bias_add_grad_test, test_case_fp32_group_idx_balance)
+{
+    system(
+        "cp -rf "
+        "../../../../math/grouped_bias_add_grad/tests/ut/op_kernel/grouped_bias_add_grad_data ./");
+    system("chmod -R 755 ./grouped_bias_add_grad_data/");
+    system("cd ./grouped_bias_add_grad_data/ && python3 gen_data.py 25");
+    system("cd ./grouped_bias_add_grad_data/ && python3 gen_tiling.py 'case25'");
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    size_t tilingSize = sizeof(GroupedBiasAddGradTilingData);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(tilingSize);
+
+    uint32_t blockDim = 10;
+
+    size_t gradYByteSize = 4096 * 256 * sizeof(float);
+    size_t groupIdxByteSize = 8 * sizeof(int32_t);
+    size_t outByteSize = 8 * 256 * sizeof(float);
+    size_t workspaceBytesSize = 32 * 1024 * 1024 + 5 * 2 * 2 * 512;
+
+    uint8_t* grad_y = (uint8_t*)AscendC::GmAlloc(gradYByteSize);
+    uint8_t* group_idx = (uint8_t*)AscendC::GmAlloc(groupIdxByteSize);
+    uint8_t* out = (uint8_t*)AscendC::GmAlloc(outByteSize);
+
+    uint8_t* workSpace = (uint8_t*)AscendC::GmAlloc(workspaceBytesSize);
+
+    std::string curPath = ".";
+    ReadFile(curPath + "/grouped_bias_add_grad_data/grad_y.bin", gradYByteSize, grad_y, gradYByteSize);
+    ReadFile(curPath + "/grouped_bias_add_grad_data/group_idx.bin", groupIdxByteSize, group_idx, groupIdxByteSize);
+    ReadFile(curPath + "/grouped_bias_add_grad_data/tiling.bin", tilingSize, tiling, tilingSize);
+
+    ICPU_SET_TILING_KEY(1100011);
+    ICPU_RUN_KF(grouped_bias_add_grad, blockDim, grad_y, group_idx, out, workSpace, tiling);
+
+    WriteFile(curPath + "/grouped_bias_add_grad_data/output.bin", out, outByteSize);
+    AscendC::GmFree((void*)grad_y);
+    AscendC::GmFree((void*)group_idx);
+    AscendC::GmFree((void*)out);
+    AscendC::GmFree((void*)workSpace);
+    AscendC::GmFree((void*)tiling);
+
+    system("cd ./grouped_bias_add_grad_data/ && python3 compare_data.py 'float32'");
+}
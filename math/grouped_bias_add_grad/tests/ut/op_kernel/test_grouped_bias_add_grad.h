@@ -28,6 +28,7 @@ struct GroupedBiasAddGradTilingData {
     uint32_t baseC;
     uint32_t loopCNum;
     int32_t groupIdxType;
+    int64_t segRows;
 };
 
 #pragma pack(1)
@@ -56,6 +57,7 @@ struct GroupedBiasAddGradTilingData {
     (tilingData).baseH = tilingDataPointer->baseH;                                    \
     (tilingData).baseC = tilingDataPointer->baseC;                                    \
     (tilingData).loopCNum = tilingDataPointer->loopCNum;                              \
-    (tilingData).groupIdxType = tilingDataPointer->groupIdxType;
+    (tilingData).groupIdxType = tilingDataPointer->groupIdxType;                      \
+    (tilingData).segRows = tilingDataPointer->segRows;
 
 #endif // _TEST_GROUPED_BIAS_ADD_GRAD_H_
@@ -0,0 +1,70 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file irfft1_d_def.cpp
+ * \brief
+ */
+#include "register/op_def_registry.h"
+
+namespace ops {
+// 仅注册整段DFT矩阵乘可覆盖的长度，与FftWholeDftTiling的C2R上限一致，超出范围不选择AI Core实现
+static const int64_t IRFFT1D_MAX_LENGTH = 4096;
+
+static ge::graphStatus Irfft1DCheckSupport(const ge::Operator& op, ge::AscendString& result)
+{
+    int64_t length = 0;
+    if (op.GetAttr("n", length) != ge::GRAPH_SUCCESS || length < 1 || length > IRFFT1D_MAX_LENGTH) {
+        std::string resultJsonStr = R"({"ret_code": "0", "reason":"Irfft1D only supports n in [1, 4096]"})";
+        result = ge::AscendString(resultJsonStr.c_str());
+        return ge::GRAPH_FAILED;
+    }
+    std::string resultJsonStr = R"({"ret_code": "1", "reason":""})";
+    result = ge::AscendString(resultJsonStr.c_str());
+    return ge::GRAPH_SUCCESS;
+}
+
+class Irfft1D : public OpDef {
+public:
+    explicit Irfft1D(const char* name) : OpDef(name)
+    {
+        this->Input("x")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT})
+            .Format({ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND});
+
+        this->Input("dft")
+            .ParamType(VIRTUAL)
+            .DataType({ge::DT_FLOAT})
+            .Format({ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND});
+
+        this->Attr("n").AttrType(OPTIONAL).Int();
+
+        this->Attr("norm").AttrType(OPTIONAL).Int();
+
+        this->Output("y")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT})
+            .Format({ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND});
+
+        this->AICore().SetCheckSupport(Irfft1DCheckSupport);
+        OpAICoreConfig aicConfig;
+        aicConfig.NeedCheckSupportFlag(true);
+        this->AICore().AddConfig("ascend910b", aicConfig);
+        this->AICore().AddConfig("ascend910_93", aicConfig);
+    }
+};
+
+OP_ADD(Irfft1D);
+} // namespace ops
@@ -0,0 +1,29 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file irfft1_d_tiling.cpp
+ * \brief
+ */
+
+#include "../../rfft1_d/op_host/fft_whole_dft_tiling.h"
+
+namespace optiling {
+
+static ge::graphStatus Tiling4Irfft1D(gert::TilingContext* context)
+{
+    FftWholeDftTiling tiling(context, FftWholeDftKind::C2R);
+    return tiling.DoTiling();
+}
+
+IMPL_OP_OPTILING(Irfft1D).Tiling(Tiling4Irfft1D).TilingParse<FftWholeDftCompileInfo>(TilingPrepare4FftWholeDft);
+
+} // namespace optiling
@@ -0,0 +1,88 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <iostream>
+#include <gtest/gtest.h>
+#include "tiling_context_faker.h"
+#include "tiling_case_executor.h"
+
+#include "../../../../rfft1_d/op_host/fft_whole_dft_tiling.h"
+using namespace std;
+using namespace ge;
+
+class Irfft1DTiling : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        std::cout << "Irfft1DTiling SetUp" << std::endl;
+    }
+
+    static void TearDownTestCase()
+    {
+        std::cout << "Irfft1DTiling TearDown" << std::endl;
+    }
+};
+
+static gert::TilingContextPara MakeIrfft1DPara(
+    const gert::StorageShape& xShape, const gert::StorageShape& yShape, int64_t len, int64_t norm,
+    optiling::FftWholeDftCompileInfo& compileInfo)
+{
+    return gert::TilingContextPara(
+        "Irfft1D",
+        {
+            {xShape, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {yShape, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            gert::TilingContextPara::OpAttr("n", Ops::Math::AnyValue::CreateFrom<int64_t>(len)),
+            gert::TilingContextPara::OpAttr("norm", Ops::Math::AnyValue::CreateFrom<int64_t>(norm)),
+        },
+        &compileInfo);
+}
+
+TEST_F(Irfft1DTiling, ascend910B1_test_tiling_c2r_001)
+{
+    optiling::FftWholeDftCompileInfo compileInfo = {48, 196608};
+    uint64_t expectTilingKey = 0;
+    string expectTilingData = "4406636446720 8589935616 12884901888 1064960 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(
+        MakeIrfft1DPara({{128, 513, 2}, {128, 513, 2}}, {{128, 1024}, {128, 1024}}, 1024, 3, compileInfo),
+        ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(Irfft1DTiling, ascend910B1_test_tiling_c2r_max_length_002)
+{
+    optiling::FftWholeDftCompileInfo compileInfo = {48, 196608};
+    uint64_t expectTilingKey = 0;
+    string expectTilingData = "17600775983104 4096 8589934593 16842752 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(
+        MakeIrfft1DPara({{1, 2049, 2}, {1, 2049, 2}}, {{1, 4096}, {1, 4096}}, 4096, 2, compileInfo),
+        ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(Irfft1DTiling, ascend910B1_test_tiling_invalid_norm_003)
+{
+    optiling::FftWholeDftCompileInfo compileInfo = {48, 196608};
+    ExecuteTestCase(
+        MakeIrfft1DPara({{4, 513, 2}, {4, 513, 2}}, {{4, 1024}, {4, 1024}}, 1024, 4, compileInfo), ge::GRAPH_FAILED);
+}
+
+TEST_F(Irfft1DTiling, ascend910B1_test_tiling_points_mismatch_004)
+{
+    optiling::FftWholeDftCompileInfo compileInfo = {48, 196608};
+    ExecuteTestCase(
+        MakeIrfft1DPara({{4, 1024, 2}, {4, 1024, 2}}, {{4, 1024}, {4, 1024}}, 1024, 1, compileInfo),
+        ge::GRAPH_FAILED);
+}
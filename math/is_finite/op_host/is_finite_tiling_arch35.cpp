@@ -16,6 +16,7 @@
 
 #include "is_finite_tiling_arch35.h"
 #include "tiling_base/tiling_util.h"
+#include "tiling_base/elewise_dag_tiling.h"
 #include "log/log.h"
 #include "graph/utils/type_utils.h"
 #include "../op_kernel/arch35/is_finite_dag.h"
@@ -101,22 +102,15 @@ ge::graphStatus IsFiniteRegbaseTiling::RunTiling()
         (tiling_ == nullptr), OP_LOGE(tilingContext, "Get EleBaseTilingDataV2 from context failed"),
         return ge::GRAPH_FAILED);
 
-    ge::graphStatus baseTilingResult = ge::GRAPH_FAILED;
     if (this->inputDtype == ge::DT_FLOAT16) {
         dType = TPL_FP16;
-        baseTilingResult = elewiseBaseTiling.DoTiling<IsFiniteDag<half>::OpDag>(*tiling_, ASCEND_API_BUFFER);
     } else if (this->inputDtype == ge::DT_BF16) {
         dType = TPL_BF16;
-        baseTilingResult = elewiseBaseTiling.DoTiling<IsFiniteDag<bfloat16_t>::OpDag>(*tiling_, ASCEND_API_BUFFER);
-    } else if (this->inputDtype == ge::DT_FLOAT) {
-        dType = TPL_FP32;
-        baseTilingResult = elewiseBaseTiling.DoTiling<IsFiniteDag<float>::OpDag>(*tiling_, ASCEND_API_BUFFER);
     } else {
-        OP_LOGE(
-            tilingContext, "Input x dtype not supported, only support [DT_FLOAT, DT_FLOAT16, DT_BF16], got %s",
-            ge::TypeUtils::DataTypeToSerialString(this->inputDtype).c_str());
-        return ge::GRAPH_FAILED;
+        dType = TPL_FP32;
     }
+    ge::graphStatus baseTilingResult =
+        DoElewiseDagTiling<IsFiniteOpDag>(elewiseBaseTiling, *tiling_, this->inputDtype, ASCEND_API_BUFFER);
     OP_CHECK_IF(
         baseTilingResult == ge::GRAPH_FAILED, OP_LOGE(tilingContext, "ElewiseBaseTiling failed"),
         return ge::GRAPH_FAILED);
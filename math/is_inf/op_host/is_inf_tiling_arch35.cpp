@@ -15,6 +15,7 @@
  */
 #include "is_inf_tiling_arch35.h"
 #include "tiling_base/tiling_util.h"
+#include "tiling_base/elewise_dag_tiling.h"
 #include "log/log.h"
 #include "platform/platform_ascendc.h"
 #include "graph/utils/type_utils.h"
@@ -117,19 +118,8 @@ ge::graphStatus IsInfRegbaseTiling::RunTiling()
         (tiling_ == nullptr), OP_LOGE(tilingContext, "Get EleBaseTilingDataV2 from context failed"),
         return ge::GRAPH_FAILED);
 
-    ge::graphStatus baseTilingResult = ge::GRAPH_FAILED;
-    if (this->inputDtype == ge::DT_FLOAT16) {
-        baseTilingResult = elewiseBaseTiling.DoTiling<IsInfOp::IsInfDAG<half>::OpDag>(*tiling_);
-    } else if (this->inputDtype == ge::DT_BF16) {
-        baseTilingResult = elewiseBaseTiling.DoTiling<IsInfOp::IsInfDAG<bfloat16_t>::OpDag>(*tiling_);
-    } else if (this->inputDtype == ge::DT_FLOAT) {
-        baseTilingResult = elewiseBaseTiling.DoTiling<IsInfOp::IsInfDAG<float>::OpDag>(*tiling_);
-    } else {
-        OP_LOGE(
-            tilingContext, "input x dtype [%s] not supported, only support [DT_FLOAT16, DT_BF16, DT_FLOAT]",
-            ge::TypeUtils::DataTypeToSerialString(this->inputDtype).c_str());
-        return ge::GRAPH_FAILED;
-    }
+    ge::graphStatus baseTilingResult =
+        DoElewiseDagTiling<IsInfOp::IsInfOpDag>(elewiseBaseTiling, *tiling_, this->inputDtype);
     OP_CHECK_IF(
         baseTilingResult == ge::GRAPH_FAILED, OP_LOGE(tilingContext, "elewiseBaseTiling failed"),
         return ge::GRAPH_FAILED);
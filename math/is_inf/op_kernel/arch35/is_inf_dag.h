@@ -16,42 +16,25 @@
 #ifndef CANN_CUSTOM_OPS_IS_INF_DAG_H
 #define CANN_CUSTOM_OPS_IS_INF_DAG_H
 
-#include "atvoss/util/dag.h"
-#include "atvoss/util/vec.h"
-#include "atvoss/util/placeholder.h"
-
-#ifndef INFINITY
-#define INFINITY (__builtin_inff())
+// kernel build copies the common kernel headers to ../common, host tiling finds them under common/inc
+#if __has_include("../../common/elewise_dag_fusion.h")
+#include "../../common/elewise_dag_fusion.h"
+#else
+#include "op_kernel/elewise_dag_fusion.h"
 #endif
 
 namespace IsInfOp {
 using namespace Ops::Base;
 
-constexpr int32_t CAST_MODE = 0;
-constexpr int32_t CMP_MODE = 2;
-constexpr int32_t SELECT_MODE = 1;
-constexpr float CONST_INF = INFINITY;
-
 template <typename U, typename T = float>
 struct IsInfDAG {
-    using ConstOne = MAKE_CONST(uint8_t, 1);
-    using ConstZero = MAKE_CONST(uint8_t, 0);
-    using ConstInf = MAKE_CONST(T, CONST_INF);
-
-    using DataOne = Bind<Vec::Duplicate<uint8_t>, ConstOne>;
-
-    using OpCopyIn = Bind<Vec::CopyIn<U>, Placeholder::In0<U>>;
-    using OpCast = Bind<Vec::Cast<T, U, CAST_MODE>, OpCopyIn>;
-    using OpAbs = Bind<Vec::Abs<T>, OpCast>;
-
-    using CompareMask = Bind<Vec::Compare<uint8_t, T, CMP_MODE>, OpAbs, ConstInf>;
-    using SelectRes = Bind<Vec::Select<uint8_t, uint8_t, SELECT_MODE>, CompareMask, DataOne, ConstZero>;
-
-    using OpCopyOut = Bind<Vec::CopyOut<uint8_t>, Placeholder::Out0<uint8_t>, SelectRes>;
-
-    using Outputs = Elems<OpCopyOut>;
-    using MemCfg = MemOptCfg<MemLevel::LEVEL_2>;
-    using OpDag = DAGSch<Outputs, void, MemCfg>;
+    // cast -> abs -> (|x| == inf) -> select(1, 0) -> copy out
+    using OpDag = typename ElewiseDagFusion::FusedUnaryDag<
+        U, uint8_t, ElewiseDagFusion::UpcastAbsFrag<U, T>, ElewiseDagFusion::IsInfMaskFrag<T>,
+        ElewiseDagFusion::MaskToBoolFrag>::OpDag;
 };
+
+template <typename U>
+using IsInfOpDag = typename IsInfDAG<U>::OpDag;
 } // namespace IsInfOp
 #endif // CANN_CUSTOM_OPS_IS_INF_DAG_H
\ No newline at end of file
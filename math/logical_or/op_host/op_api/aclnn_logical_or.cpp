@@ -12,6 +12,7 @@
 #include "logical_or.h"
 #include "aclnn_kernels/cast.h"
 #include "aclnn_kernels/contiguous.h"
+#include "common/level2_elementwise_dispatch.h"
 #include "aclnn/aclnn_base.h"
 #include "aclnn_kernels/common/op_error_check.h"
 #include "opdev/common_types.h"
@@ -139,24 +140,20 @@ static aclnnStatus GetWorkspaceSizeCommon(
         return ACLNN_SUCCESS;
     }
 
-    // 将输入self转换成连续的tensor
-    auto selfContiguous = l0op::Contiguous(self, uniqueExecutor.get());
-    CHECK_RET(selfContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    // 逻辑类算子输入统一推导为DT_BOOL，按路径表只执行必要的Contiguous/Cast
+    const auto& plan = ElementwiseDispatcher::Select(
+        ElementwiseDispatcher::Classify(self, other, out, op::DataType::DT_BOOL));
 
-    // 将输入self的数据类型转换成DT_BOOL类型
-    auto selfCasted = (selfContiguous->GetDataType() == op::DataType::DT_BOOL) ?
-                          selfContiguous :
-                          l0op::Cast(selfContiguous, op::DataType::DT_BOOL, uniqueExecutor.get());
+    // 将输入self转换成连续的tensor，按需转换成DT_BOOL类型
+    auto selfCasted = ElementwiseDispatcher::PrepareInput(
+        self, plan, ELEMENTWISE_STEP_CONTIGUOUS_SELF, ELEMENTWISE_STEP_CAST_SELF, op::DataType::DT_BOOL,
+        uniqueExecutor.get());
     CHECK_RET(selfCasted != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
-    // 将输入other转换成连续的tensor
-    auto otherContiguous = l0op::Contiguous(other, uniqueExecutor.get());
-    CHECK_RET(otherContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
-
-    // 将输入other的数据类型转换成DT_BOOL类型
-    auto otherCasted = (otherContiguous->GetDataType() == op::DataType::DT_BOOL) ?
-                           otherContiguous :
-                           l0op::Cast(otherContiguous, op::DataType::DT_BOOL, uniqueExecutor.get());
+    // 将输入other转换成连续的tensor，按需转换成DT_BOOL类型
+    auto otherCasted = ElementwiseDispatcher::PrepareInput(
+        other, plan, ELEMENTWISE_STEP_CONTIGUOUS_OTHER, ELEMENTWISE_STEP_CAST_OTHER, op::DataType::DT_BOOL,
+        uniqueExecutor.get());
     CHECK_RET(otherCasted != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
     // 进行LogicalOr计算
@@ -164,7 +161,7 @@ static aclnnStatus GetWorkspaceSizeCommon(
     CHECK_RET(logical_orOpOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
     // 将计算结果转换成输出out的数据类型
-    auto castOut = (out->GetDataType() == op::DataType::DT_BOOL) ?
+    auto castOut = !plan.Has(ELEMENTWISE_STEP_CAST_OUT) ?
                        logical_orOpOut :
                        l0op::Cast(logical_orOpOut, out->GetDataType(), uniqueExecutor.get());
     CHECK_RET(castOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
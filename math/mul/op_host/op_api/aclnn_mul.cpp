@@ -11,6 +11,7 @@
 #include "aclnn_mul.h"
 #include "aclnn_kernels/cast.h"
 #include "aclnn_kernels/contiguous.h"
+#include "common/level2_elementwise_dispatch.h"
 #include "math/logical_and/op_host/op_api/logical_and.h"
 #include "mul.h"
 #include "math/muls/op_host/op_api/muls.h"
@@ -471,36 +472,33 @@ aclnnStatus aclnnMulGetWorkspaceSize(
         return ACLNN_SUCCESS;
     }
 
-    // 固定写法，将输入self转换成连续的tensor
-    auto selfContiguous = l0op::Contiguous(self, uniqueExecutor.get());
-    CHECK_RET(selfContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    // 一次性计算广播类别、输入连续性与Cast需求，按路径表只执行必要的Contiguous/Cast
+    auto promoteType = op::PromoteType(self->GetDataType(), other->GetDataType());
+    auto dispatchSig = ElementwiseDispatcher::Classify(self, other, out, promoteType);
+    // 判断输入是否符合kernel支持的混合输入类型，此时kernel直接输出推导类型，输入侧不做Cast
+    if (IsMulMixDtypeSupport(self, other)) {
+        dispatchSig.SkipInputCast();
+    }
+    const auto& plan = ElementwiseDispatcher::Select(dispatchSig);
 
-    // 固定写法，将输入other转换成连续的tensor
-    auto otherContiguous = l0op::Contiguous(other, uniqueExecutor.get());
-    CHECK_RET(otherContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    // 将输入self转换成连续的tensor，按需转换成隐式数据类型
+    auto selfCast = ElementwiseDispatcher::PrepareInput(
+        self, plan, ELEMENTWISE_STEP_CONTIGUOUS_SELF, ELEMENTWISE_STEP_CAST_SELF, promoteType, uniqueExecutor.get());
+    CHECK_RET(selfCast != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
-    // 判断输入是否符合kernel支持的混合输入类型
-    bool isMixDataType = IsMulMixDtypeSupport(self, other);
+    // 将输入other转换成连续的tensor，按需转换成隐式数据类型
+    auto otherCast = ElementwiseDispatcher::PrepareInput(
+        other, plan, ELEMENTWISE_STEP_CONTIGUOUS_OTHER, ELEMENTWISE_STEP_CAST_OTHER, promoteType, uniqueExecutor.get());
+    CHECK_RET(otherCast != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
-    const aclTensor* resTensor = nullptr;
-    if (isMixDataType) {
-        // 无需调用Cast对输入进行隐式数据类型转换
-        resTensor = l0op::Mul(selfContiguous, otherContiguous, uniqueExecutor.get());
-    } else {
-        auto promoteType = op::PromoteType(self->GetDataType(), other->GetDataType());
-        // 将输入self的数据类型转换成隐式数据类型
-        auto selfCast = l0op::Cast(selfContiguous, promoteType, uniqueExecutor.get());
-        CHECK_RET(selfCast != nullptr, ACLNN_ERR_INNER_NULLPTR);
-        // 将输入other的数据类型转换成隐式数据类型
-        auto otherCast = l0op::Cast(otherContiguous, promoteType, uniqueExecutor.get());
-        CHECK_RET(otherCast != nullptr, ACLNN_ERR_INNER_NULLPTR);
-        // 调用主体计算函数
-        resTensor = l0op::Mul(selfCast, otherCast, uniqueExecutor.get());
-    }
+    // 调用主体计算函数
+    const aclTensor* resTensor = l0op::Mul(selfCast, otherCast, uniqueExecutor.get());
     CHECK_RET(resTensor != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
-    // 固定写法，将计算结果转换成输出out的数据类型
-    auto castOut = l0op::Cast(resTensor, out->GetDataType(), uniqueExecutor.get());
+    // 计算结果与out类型不一致时才需要Cast
+    auto castOut = plan.Has(ELEMENTWISE_STEP_CAST_OUT) ?
+                       l0op::Cast(resTensor, out->GetDataType(), uniqueExecutor.get()) :
+                       resTensor;
     CHECK_RET(castOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
     // 固定写法，将计算结果拷贝到输出out上，out可能是非连续的tensor
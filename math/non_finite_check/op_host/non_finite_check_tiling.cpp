@@ -14,6 +14,7 @@
  * \brief
  */
 #include "non_finite_check_tiling.h"
+#include "tiling_base/multi_tensor_apply_tiling.h"
 #include "register/op_impl_registry.h"
 #include "util/math_util.h"
 #include "log/log.h"
@@ -28,6 +29,7 @@ constexpr size_t WORKSPACE_SIZE = 1;
 
 constexpr uint8_t DTYPE_SIZE_FLOAT = 4;
 constexpr uint8_t NUM_TWO = 2;
+constexpr uint8_t NUM_THREE = 3;
 constexpr uint32_t COEFFICIENT_1 = 128;
 
 class NonFiniteCheckTiling {
@@ -198,51 +200,13 @@ bool NonFiniteCheckTiling::CalcNeedCoreNum()
 
 void NonFiniteCheckTiling::AssignDataToEachCore()
 {
-    int64_t blockCount = totalDataCountAligned / elementsPerBlock;
-    // Divisible, representing the amount of data each core needs to process.
-    int64_t tempPerCoreCount = blockCount / needCoreNum * elementsPerBlock;
-    int64_t remainderCount = blockCount % needCoreNum; // remainder.
-    uint16_t coreIndex = 0;
-    int64_t dataCount = 0;
-    int64_t curCmpCount = 0;
-    int64_t cursorPos = 0;
-    tensorStartList[coreIndex] = 0;
-    tensorStartOffsetList[coreIndex] = 0;
-    for (uint16_t i = 0; i < totalTensorCount; i++) {
-        // When the remainder is not 0, each kernel index with less than the remainder processes one more block of data.
-        if (remainderCount != 0 && coreIndex < remainderCount) {
-            curCmpCount = tempPerCoreCount + elementsPerBlock;
-        } else {
-            curCmpCount = tempPerCoreCount;
-        }
-        int64_t tempCount = tensorDataCountAlignedList[i] - cursorPos;
-        if (dataCount + tempCount < curCmpCount) {
-            dataCount += tempCount;
-            cursorPos = 0;
-            continue;
-        }
-        // dataCount >= curCmpCount, Calculate the offset
-        tensorEndList[coreIndex] = i;
-        cursorPos = cursorPos + curCmpCount - dataCount;
-        tensorEndOffsetList[coreIndex] = cursorPos - 1;
-        dataCount = 0;
-        coreIndex++;
-        if (cursorPos < tensorDataCountAlignedList[i]) {
-            tensorStartList[coreIndex] = i;
-            tensorStartOffsetList[coreIndex] = cursorPos;
-            --i; // The next loop continues to allocate the current tensor
-        } else if (coreIndex != needCoreNum) {
-            tensorStartList[coreIndex] = i + 1;
-            tensorStartOffsetList[coreIndex] = 0;
-            cursorPos = 0;
-        }
-    }
-    /* The temporary count variable is not 0, which means that the last tensor is truncated,
-        and you need to manually set the offset of the last core. */
-    if (dataCount != 0) {
-        tensorEndList[coreIndex] = totalTensorCount - 1;
-        tensorEndOffsetList[coreIndex] = tensorDataCountAlignedList[totalTensorCount - 1] - 1;
-    }
+    Ops::Math::OpTiling::TensorListSplitInfo splitInfo;
+    splitInfo.tensorStartList = tensorStartList;
+    splitInfo.tensorEndList = tensorEndList;
+    splitInfo.tensorStartOffsetList = tensorStartOffsetList;
+    splitInfo.tensorEndOffsetList = tensorEndOffsetList;
+    needCoreNum = Ops::Math::OpTiling::SplitTensorListToCores(
+        tensorDataCountAlignedList, totalTensorCount, dataTypeSize, elementsPerBlock, needCoreNum, splitInfo);
 }
 
 bool NonFiniteCheckTiling::DivideUbMemory()
@@ -253,12 +217,14 @@ bool NonFiniteCheckTiling::DivideUbMemory()
     if (dataType == ge::DT_BF16) {
         dtypeSizeTemp = DTYPE_SIZE_FLOAT;
     }
-    uint32_t predictSGUbSize =
-        uint32_t((canUseUbSize - BYTE_BLOCK) * COEFFICIENT_1 * 1.0 / (BYTE_REPEAT + dtypeSizeTemp));
+    /* UB holds two copy-in buffers and one accumulator of maxDataUbSize each, plus the ReduceSum workspace
+        (about 2 * maxDataUbSize * dtypeSize / BYTE_REPEAT) used when polling the accumulator. */
+    uint32_t predictSGUbSize = uint32_t(
+        (canUseUbSize - NUM_TWO * BYTE_BLOCK) * COEFFICIENT_1 * 1.0 / (NUM_THREE * COEFFICIENT_1 + dtypeSizeTemp));
     uint32_t maxDataUbSize = predictSGUbSize / BYTE_BLOCK * BYTE_BLOCK;
     maxProcCount = maxDataUbSize / dtypeSizeTemp;
     tempValUbSize = GetReduceRetValSize(maxDataUbSize, dtypeSizeTemp);
-    if ((NUM_TWO * maxDataUbSize + tempValUbSize) > compileInfo.ubSizePlatForm) {
+    if ((NUM_THREE * maxDataUbSize + tempValUbSize) > compileInfo.ubSizePlatForm) {
         return false;
     } else {
         return true;
@@ -268,7 +234,7 @@ bool NonFiniteCheckTiling::DivideUbMemory()
 uint32_t NonFiniteCheckTiling::GetReduceRetValSize(uint32_t srcDataSize, uint32_t dtypeSize) const
 {
     /* Calculate the space size of the intermediate variable workLocal and
-        the result variable dstLocal of ReduceMax and ReduceMin. */
+        the result variable dstLocal of ReduceSum. */
     uint8_t perBlockCount = BYTE_BLOCK / dtypeSize;
     uint32_t iter1OutputCount = uint32_t(std::ceil(NUM_TWO * 1.0 * srcDataSize / BYTE_REPEAT));
     uint32_t iter1AlignEnd = Ops::Base::CeilAlign(iter1OutputCount, uint32_t(perBlockCount));
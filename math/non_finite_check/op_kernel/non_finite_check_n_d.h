@@ -23,6 +23,8 @@ namespace NonFiniteCheck {
 using namespace AscendC;
 constexpr int32_t BUFFER_NUM = 2;
 constexpr uint32_t BYTE_BLOCK = 32;
+// Number of chunks accumulated between two checks of the local result and the global flag.
+constexpr uint32_t POLL_INTERVAL = 8;
 
 template <typename T>
 class NonFiniteCheckND {
@@ -54,6 +56,8 @@ private:
     __aicore__ inline void CopyIn(uint16_t index, int64_t dataCount);
     template <typename T2>
     __aicore__ inline void Compute(uint16_t index, int64_t dataCount);
+    template <typename T2>
+    __aicore__ inline void PollFoundFlag();
     __aicore__ inline bool IsNonFinite(float value);
     __aicore__ inline bool IsNonFinite(half value);
     __aicore__ inline __gm__ T* GetTensorAddr(uint16_t index);
@@ -62,12 +66,14 @@ private:
     TPipe pipe;
     TQue<QuePosition::VECIN, BUFFER_NUM> copyInQueue;
     TBuf<QuePosition::VECCALC> tempValBuf;
+    TBuf<QuePosition::VECCALC> accBuf;
     GlobalTensor<T> tensorListGM;
     GlobalTensor<float> foundFlagGM;
     GM_ADDR tensorListPtr = nullptr;
     int64_t blockIdx = 0;
     bool haveFoundInf = false;
     int32_t perBlockCount = 0;
+    uint32_t pendingChunks = 0;
 
     // tiling params
     const NonFiniteCheckTilingData* __restrict tilingDataInClass = nullptr;
@@ -91,8 +97,12 @@ __aicore__ inline void NonFiniteCheckND<T>::Init(
     foundFlagGM.SetGlobalBuffer((__gm__ float*)found_flag, 1);
 #if defined(ORIG_DTYPE_TENSOR_LIST) && ORIG_DTYPE_TENSOR_LIST == DT_FLOAT16
     pipe.InitBuffer(copyInQueue, BUFFER_NUM, maxProcCount * sizeof(half));
+    pipe.InitBuffer(accBuf, maxProcCount * sizeof(half));
+    Duplicate(accBuf.Get<half>(), half(0.0f), maxProcCount);
 #else
     pipe.InitBuffer(copyInQueue, BUFFER_NUM, maxProcCount * sizeof(float));
+    pipe.InitBuffer(accBuf, maxProcCount * sizeof(float));
+    Duplicate(accBuf.Get<float>(), float(0.0f), maxProcCount);
 #endif
     pipe.InitBuffer(tempValBuf, tempValUbSize);
     perBlockCount = BYTE_BLOCK / sizeof(T);
@@ -112,7 +122,7 @@ __aicore__ inline void NonFiniteCheckND<T>::Process()
     }
     SyncAll();
 
-    for (uint16_t i = tensorStart; i <= tensorEnd; i++) {
+    for (uint16_t i = tensorStart; i <= tensorEnd && !haveFoundInf; i++) {
         int64_t cursorStart = 0;
         int64_t cursorEnd = tensorDataCountList[i] - 1;
         int64_t dataCount = 0;
@@ -126,6 +136,13 @@ __aicore__ inline void NonFiniteCheckND<T>::Process()
         tensorListGM.SetGlobalBuffer(GetTensorAddr(i) + cursorStart);
         SingleTensorProcess(dataCount);
     }
+    if (!haveFoundInf && pendingChunks > 0) {
+#if defined(ORIG_DTYPE_TENSOR_LIST) && ORIG_DTYPE_TENSOR_LIST == DT_FLOAT16
+        PollFoundFlag<half>();
+#else
+        PollFoundFlag<float>();
+#endif
+    }
 }
 
 template <typename T>
@@ -145,7 +162,7 @@ __aicore__ inline void NonFiniteCheckND<T>::SingleTensorProcess(int64_t dataCoun
 {
     // Batch handling and calculation.
     uint32_t copyTimes = CeilDiv(dataCount, maxProcCount);
-    for (uint32_t i = 0; i < copyTimes; i++) {
+    for (uint32_t i = 0; i < copyTimes && !haveFoundInf; i++) {
         int64_t tempCount = maxProcCount;
         if ((i + 1 == copyTimes) && (dataCount % maxProcCount)) {
             tempCount = dataCount % maxProcCount;
@@ -154,8 +171,14 @@ __aicore__ inline void NonFiniteCheckND<T>::SingleTensorProcess(int64_t dataCoun
         int64_t realProcCount = CeilAlignA2B(tempCount, perBlockCount);
 #if defined(ORIG_DTYPE_TENSOR_LIST) && ORIG_DTYPE_TENSOR_LIST == DT_FLOAT16
         Compute<half>(i, realProcCount);
+        if (pendingChunks >= POLL_INTERVAL) {
+            PollFoundFlag<half>();
+        }
 #else
         Compute<float>(i, realProcCount);
+        if (pendingChunks >= POLL_INTERVAL) {
+            PollFoundFlag<float>();
+        }
 #endif
     }
 }
@@ -200,32 +223,39 @@ template <typename T2>
 __aicore__ inline void NonFiniteCheckND<T>::Compute(uint16_t index, int64_t dataCount)
 {
     LocalTensor<T2> computeInLT = copyInQueue.DeQue<T2>();
-    if (!haveFoundInf) { // Inside the same Core, just find it once.
-        LocalTensor<T2> workLocal = tempValBuf.Get<T2>();
-        ReduceMax<T2>(workLocal, computeInLT, workLocal, dataCount, false);
-        event_t eventID1 = static_cast<event_t>(pipe.FetchEventID(HardEvent::V_S));
-        SetFlag<HardEvent::V_S>(eventID1);
-        WaitFlag<HardEvent::V_S>(eventID1);
-        T2 maxValue = workLocal.GetValue(0);
-        if (IsNonFinite(maxValue)) {
-            foundFlagGM.SetValue(0, 1.0);
-            DataCacheCleanAndInvalid<float, CacheLine::SINGLE_CACHE_LINE, DcciDst::CACHELINE_OUT>(foundFlagGM);
-            haveFoundInf = true;
-        }
-        if (!haveFoundInf) {
-            ReduceMin<T2>(workLocal, computeInLT, workLocal, dataCount, false);
-            event_t eventID2 = static_cast<event_t>(pipe.FetchEventID(HardEvent::V_S));
-            SetFlag<HardEvent::V_S>(eventID2);
-            WaitFlag<HardEvent::V_S>(eventID2);
-            T2 minValue = workLocal.GetValue(0);
-            if (IsNonFinite(minValue)) {
-                foundFlagGM.SetValue(0, 1.0);
-                DataCacheCleanAndInvalid<float, CacheLine::SINGLE_CACHE_LINE, DcciDst::CACHELINE_OUT>(foundFlagGM);
-                haveFoundInf = true;
-            }
-        }
-    }
+    LocalTensor<T2> accLT = accBuf.Get<T2>();
+    // x - x is 0 for finite values and nan for +-inf/nan. The nan is sticky under Add, so the chunk can be folded
+    // into the accumulator without reading any scalar back.
+    Sub(computeInLT, computeInLT, computeInLT, dataCount);
+    Add(accLT, accLT, computeInLT, dataCount);
     copyInQueue.FreeTensor(computeInLT);
+    pendingChunks++;
+}
+
+template <typename T>
+template <typename T2>
+__aicore__ inline void NonFiniteCheckND<T>::PollFoundFlag()
+{
+    pendingChunks = 0;
+    LocalTensor<T2> accLT = accBuf.Get<T2>();
+    LocalTensor<T2> workLocal = tempValBuf.Get<T2>();
+    // The accumulator only holds 0 or nan, so the sum is nan exactly when a non-finite value was seen.
+    ReduceSum<T2>(workLocal, accLT, workLocal, maxProcCount);
+    event_t eventID1 = static_cast<event_t>(pipe.FetchEventID(HardEvent::V_S));
+    SetFlag<HardEvent::V_S>(eventID1);
+    WaitFlag<HardEvent::V_S>(eventID1);
+    T2 sumValue = workLocal.GetValue(0);
+    if (IsNonFinite(sumValue)) {
+        foundFlagGM.SetValue(0, 1.0);
+        DataCacheCleanAndInvalid<float, CacheLine::SINGLE_CACHE_LINE, DcciDst::CACHELINE_OUT>(foundFlagGM);
+        haveFoundInf = true;
+        return;
+    }
+    // Stop early once another core has published the flag.
+    DataCacheCleanAndInvalid<float, CacheLine::SINGLE_CACHE_LINE, DcciDst::CACHELINE_OUT>(foundFlagGM);
+    if (foundFlagGM.GetValue(0) != 0.0f) {
+        haveFoundInf = true;
+    }
 }
 
 template <typename T>
@@ -17,6 +17,7 @@
 #include <cstdint>
 #include <vector>
 #include <cmath>
+#include <algorithm>
 #include "non_finite_check_tiling.h"
 #include "exe_graph/runtime/shape.h"
 #include "graph/types.h"
@@ -29,7 +30,9 @@ constexpr uint32_t BYTE_REPEAT = 256;
 
 constexpr uint8_t DTYPE_SIZE_FLOAT = 4;
 constexpr uint8_t NUM_TWO = 2;
+constexpr uint8_t NUM_THREE = 3;
 constexpr uint32_t COEFFICIENT_1 = 128;
+constexpr int64_t SEGMENT_OVERHEAD_BYTES = 8192;
 
 class NonFiniteCheckTiling {
 public:
@@ -134,51 +137,57 @@ bool NonFiniteCheckTiling::CalcNeedCoreNum()
 
 void NonFiniteCheckTiling::AssignDataToEachCore()
 {
-    int64_t blockCount = totalDataCountAligned / elementsPerBlock;
-    // Divisible, representing the amount of data each core needs to process.
-    int64_t tempPerCoreCount = blockCount / needCoreNum * elementsPerBlock;
-    int64_t remainderCount = blockCount % needCoreNum; // remainder.
+    /* Balance the work by bytes plus a fixed cost per tensor segment: large tensors are split across cores and
+        runs of small tensors are packed onto one core instead of each costing a core its own setup. */
+    int64_t segmentCost = std::max(SEGMENT_OVERHEAD_BYTES / dataTypeSize, int64_t(elementsPerBlock));
+    int64_t totalCost = totalDataCountAligned + segmentCost * totalTensorCount;
+    // Every core should get at least two segments worth of work, otherwise the setup cost dominates.
+    needCoreNum = uint32_t(std::max(std::min(int64_t(needCoreNum), totalCost / (NUM_TWO * segmentCost)), int64_t(1)));
+    // Each cut inside a tensor adds one more segment.
+    int64_t perCoreCost =
+        CeilDiv(totalCost + segmentCost * (int64_t(needCoreNum) - 1), int64_t(needCoreNum));
     uint16_t coreIndex = 0;
-    int64_t dataCount = 0;
-    int64_t curCmpCount = 0;
-    int64_t cursorPos = 0;
+    int64_t coreCost = 0;
     tensorStartList[coreIndex] = 0;
     tensorStartOffsetList[coreIndex] = 0;
     for (uint16_t i = 0; i < totalTensorCount; i++) {
-        // When the remainder is not 0, each kernel index with less than the remainder processes one more block of data.
-        if (remainderCount != 0 && coreIndex < remainderCount) {
-            curCmpCount = tempPerCoreCount + elementsPerBlock;
-        } else {
-            curCmpCount = tempPerCoreCount;
-        }
-        int64_t tempCount = tensorDataCountAlignedList[i] - cursorPos;
-        if (dataCount + tempCount < curCmpCount) {
-            dataCount += tempCount;
-            cursorPos = 0;
-            continue;
-        }
-        // dataCount >= curCmpCount, Calculate the offset
-        tensorEndList[coreIndex] = i;
-        cursorPos = cursorPos + curCmpCount - dataCount;
-        tensorEndOffsetList[coreIndex] = cursorPos - 1;
-        dataCount = 0;
-        coreIndex++;
-        if (cursorPos < tensorDataCountAlignedList[i]) {
-            tensorStartList[coreIndex] = i;
-            tensorStartOffsetList[coreIndex] = cursorPos;
-            --i; // The next loop continues to allocate the current tensor
-        } else if (coreIndex != needCoreNum) {
-            tensorStartList[coreIndex] = i + 1;
-            tensorStartOffsetList[coreIndex] = 0;
-            cursorPos = 0;
+        int64_t cursorPos = (tensorStartList[coreIndex] == i) ? tensorStartOffsetList[coreIndex] : 0;
+        while (cursorPos < tensorDataCountAlignedList[i]) {
+            int64_t remainCount = tensorDataCountAlignedList[i] - cursorPos;
+            coreCost += segmentCost;
+            bool isLastCore = (coreIndex + 1U == needCoreNum);
+            if (isLastCore || coreCost + remainCount < perCoreCost) {
+                coreCost += remainCount;
+                cursorPos = tensorDataCountAlignedList[i];
+                break;
+            }
+            // The current core is full inside this tensor, take at least one block and cut.
+            int64_t takeCount = CeilDiv(std::max(perCoreCost - coreCost, int64_t(1)), int64_t(elementsPerBlock)) *
+                int64_t(elementsPerBlock);
+            takeCount = std::min(takeCount, remainCount);
+            cursorPos += takeCount;
+            tensorEndList[coreIndex] = i;
+            tensorEndOffsetList[coreIndex] = cursorPos - 1;
+            coreCost = 0;
+            if (i + 1 == totalTensorCount && cursorPos == tensorDataCountAlignedList[i]) {
+                break;
+            }
+            coreIndex++;
+            if (cursorPos < tensorDataCountAlignedList[i]) {
+                tensorStartList[coreIndex] = i;
+                tensorStartOffsetList[coreIndex] = cursorPos;
+            } else {
+                tensorStartList[coreIndex] = i + 1;
+                tensorStartOffsetList[coreIndex] = 0;
+            }
         }
     }
-    /* The temporary count variable is not 0, which means that the last tensor is truncated,
-        and you need to manually set the offset of the last core. */
-    if (dataCount != 0) {
+    if (coreCost != 0) {
         tensorEndList[coreIndex] = totalTensorCount - 1;
         tensorEndOffsetList[coreIndex] = tensorDataCountAlignedList[totalTensorCount - 1] - 1;
     }
+    // Packing small tensors may leave trailing cores without work.
+    needCoreNum = uint32_t(coreIndex) + 1U;
 }
 
 bool NonFiniteCheckTiling::DivideUbMemory()
@@ -189,12 +198,14 @@ bool NonFiniteCheckTiling::DivideUbMemory()
     if (dataType == ge::DT_BF16) {
         dtypeSizeTemp = DTYPE_SIZE_FLOAT;
     }
-    uint32_t predictSGUbSize =
-        uint32_t((canUseUbSize - BYTE_BLOCK) * COEFFICIENT_1 * 1.0 / (BYTE_REPEAT + dtypeSizeTemp));
+    /* UB holds two copy-in buffers and one accumulator of maxDataUbSize each, plus the ReduceSum workspace
+        (about 2 * maxDataUbSize * dtypeSize / BYTE_REPEAT) used when polling the accumulator. */
+    uint32_t predictSGUbSize = uint32_t(
+        (canUseUbSize - NUM_TWO * BYTE_BLOCK) * COEFFICIENT_1 * 1.0 / (NUM_THREE * COEFFICIENT_1 + dtypeSizeTemp));
     uint32_t maxDataUbSize = predictSGUbSize / BYTE_BLOCK * BYTE_BLOCK;
     maxProcCount = maxDataUbSize / dtypeSizeTemp;
     tempValUbSize = GetReduceRetValSize(maxDataUbSize, dtypeSizeTemp);
-    if ((NUM_TWO * maxDataUbSize + tempValUbSize) > compileInfo.ubSizePlatForm) {
+    if ((NUM_THREE * maxDataUbSize + tempValUbSize) > compileInfo.ubSizePlatForm) {
         return false;
     } else {
         return true;
@@ -204,7 +215,7 @@ bool NonFiniteCheckTiling::DivideUbMemory()
 uint32_t NonFiniteCheckTiling::GetReduceRetValSize(uint32_t srcDataSize, uint32_t dtypeSize) const
 {
     /* Calculate the space size of the intermediate variable workLocal and
-        the result variable dstLocal of ReduceMax and ReduceMin. */
+        the result variable dstLocal of ReduceSum. */
     uint8_t perBlockCount = BYTE_BLOCK / dtypeSize;
     uint32_t iter1OutputCount = uint32_t(std::ceil(NUM_TWO * 1.0 * srcDataSize / BYTE_REPEAT));
     uint32_t iter1AlignEnd = CeilDiv(iter1OutputCount, perBlockCount) * perBlockCount;
@@ -13,11 +13,13 @@
 #include "aclnn_one_hot.h"
 #include "aclnn_kernels/contiguous.h"
 #include "one_hot.h"
+#include "../../../one_hot_v2/op_host/op_api/one_hot_v2.h"
 #include "aclnn_kernels/transdata.h"
 
 #include "aclnn_kernels/common/op_error_check.h"
 #include "opdev/op_dfx.h"
 #include "opdev/make_op_executor.h"
+#include "opdev/tensor_view_utils.h"
 
 using namespace op;
 #ifdef __cplusplus
@@ -37,6 +39,11 @@ static const std::initializer_list<op::DataType> VALUE_DTYPE_SUPPORT_LIST = {
 static const std::initializer_list<op::DataType> VALUE_DTYPE_SUPPORT_LIST_910_95 = {
     op::DataType::DT_FLOAT16, op::DataType::DT_FLOAT, op::DataType::DT_INT32,
     op::DataType::DT_INT64,   op::DataType::DT_INT8,  op::DataType::DT_UINT8};
+static const std::initializer_list<op::DataType> SMOOTHING_DTYPE_SUPPORT_LIST = {
+    op::DataType::DT_FLOAT16, op::DataType::DT_FLOAT};
+static const std::initializer_list<op::DataType> SPARSE_VALUE_DTYPE_SUPPORT_LIST = {
+    op::DataType::DT_FLOAT16, op::DataType::DT_FLOAT, op::DataType::DT_INT32};
+static const std::initializer_list<op::DataType> SPARSE_INDEX_DTYPE_SUPPORT_LIST = {op::DataType::DT_INT64};
 
 static inline bool CheckNotNull(
     const aclTensor* self, const aclTensor* onValue, const aclTensor* offValue, const aclTensor* out)
@@ -179,6 +186,128 @@ static inline aclnnStatus CheckParams(
     return ACLNN_SUCCESS;
 }
 
+static bool IsLastAxis(const aclTensor* self, int64_t axis)
+{
+    int64_t selfDimNum = self->GetViewShape().GetDimNum();
+    return axis == MIN_AXIS || axis == selfDimNum;
+}
+
+static bool CheckLabelSmoothing(const aclTensor* self, const aclTensor* onValue, int64_t axis, double labelSmoothing)
+{
+    if (labelSmoothing < 0.0 || labelSmoothing > 1.0) {
+        OP_LOGE(ACLNN_ERR_PARAM_INVALID, "LabelSmoothing should be in [0, 1], but got %f.", labelSmoothing);
+        return false;
+    }
+    if (labelSmoothing == 0.0) {
+        return true;
+    }
+    // 标签平滑在OneHotV2 kernel内完成，只支持类别轴为最后一维的浮点输出
+    OP_CHECK_DTYPE_NOT_SUPPORT(onValue, SMOOTHING_DTYPE_SUPPORT_LIST, return false);
+    if (!IsLastAxis(self, axis)) {
+        OP_LOGE(ACLNN_ERR_PARAM_INVALID, "LabelSmoothing only supports the last axis, but got axis %ld.", axis);
+        return false;
+    }
+    if (!l0op::IsOneHotV2Support(self, onValue)) {
+        OP_LOGE(ACLNN_ERR_PARAM_INVALID, "LabelSmoothing is not supported on this soc.");
+        return false;
+    }
+    return true;
+}
+
+// out最后一维连续、前面各维可合并为统一行间隔时返回行间隔，kernel直接按行写入out；否则返回0
+static int64_t GetOutRowStride(const aclTensor* out, int64_t numClasses)
+{
+    const op::Shape& shape = out->GetViewShape();
+    const auto& strides = out->GetViewStrides();
+    int64_t lastDim = static_cast<int64_t>(shape.GetDimNum()) - 1;
+    if (numClasses > 1 && strides[lastDim] != 1) {
+        return 0;
+    }
+    int64_t rowStride = 0;
+    int64_t expected = 0;
+    for (int64_t i = lastDim - 1; i >= 0; i--) {
+        int64_t dimSize = shape.GetDim(i);
+        if (dimSize == 1) {
+            continue;
+        }
+        if (rowStride == 0) {
+            rowStride = strides[i];
+            expected = rowStride;
+        }
+        if (strides[i] != expected) {
+            return 0;
+        }
+        expected *= dimSize;
+    }
+    // 只有一行时行间隔不参与寻址
+    rowStride = rowStride == 0 ? numClasses : rowStride;
+    return (rowStride >= numClasses && rowStride <= l0op::ONE_HOT_V2_MAX_ROW_STRIDE) ? rowStride : 0;
+}
+
+// 以out首元素为起点、覆盖所有行的一维视图，行间空隙不写
+static const aclTensor* OutRowView(
+    const aclTensor* out, int64_t rowNum, int64_t rowStride, int64_t numClasses, aclOpExecutor* executor)
+{
+    if (rowStride == numClasses && out->GetViewOffset() == 0 &&
+        out->GetStorageShape().GetShapeSize() == rowNum * numClasses) {
+        return out;
+    }
+    op::Shape spanShape = {(rowNum - 1) * rowStride + numClasses};
+    return executor->CreateView(out, spanShape, out->GetViewOffset());
+}
+
+static aclnnStatus OneHotV2Proc(
+    const aclTensor* self, int64_t numClasses, const aclTensor* onValue, const aclTensor* offValue,
+    float labelSmoothing, aclTensor* out, aclOpExecutor* executor)
+{
+    int64_t rowStride = GetOutRowStride(out, numClasses);
+    if (rowStride > 0) {
+        auto outView = OutRowView(out, self->GetViewShape().GetShapeSize(), rowStride, numClasses, executor);
+        CHECK_RET(outView != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        auto oneHotOut =
+            l0op::OneHotV2(self, onValue, offValue, numClasses, rowStride, labelSmoothing, outView, executor);
+        CHECK_RET(oneHotOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        return ACLNN_SUCCESS;
+    }
+
+    auto oneHotOut = l0op::OneHotV2(self, onValue, offValue, numClasses, 0, labelSmoothing, nullptr, executor);
+    CHECK_RET(oneHotOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    auto viewCopyResult = l0op::ViewCopy(oneHotOut, out, executor);
+    CHECK_RET(viewCopyResult != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    return ACLNN_SUCCESS;
+}
+
+static aclnnStatus OneHotProc(
+    const aclTensor* self, int64_t numClasses, const aclTensor* onValue, const aclTensor* offValue, int64_t axis,
+    float labelSmoothing, aclTensor* out, aclOpExecutor* executor)
+{
+    // 将输入self转换成连续的tensor
+    const aclTensor* selfContiguous = l0op::Contiguous(self, executor);
+    CHECK_RET(selfContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    // 类别轴为最后一维时走OneHotV2，索引按ND读取，无需ReFormat，结果直接写入out
+    if (IsLastAxis(self, axis) && l0op::IsOneHotV2Support(selfContiguous, onValue)) {
+        return OneHotV2Proc(selfContiguous, numClasses, onValue, offValue, labelSmoothing, out, executor);
+    }
+
+    auto reformat = l0op::ReFormat(selfContiguous, Format::FORMAT_ND);
+    CHECK_RET(reformat != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    // 初始化参数
+    const aclTensor* numClassesTensor = executor->ConvertToTensor(
+        executor->AllocScalar(numClasses),
+        self->GetDataType() == op::DataType::DT_UINT8 ? op::DataType::DT_INT32 : self->GetDataType());
+
+    // 调用OneHot算子kernel
+    auto oneHotOut = l0op::OneHot(reformat, numClassesTensor, onValue, offValue, axis, executor);
+    CHECK_RET(oneHotOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    // 将计算结果拷贝到输出out上，out可能是非连续的tensor
+    auto viewCopyResult = l0op::ViewCopy(oneHotOut, out, executor);
+    CHECK_RET(viewCopyResult != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    return ACLNN_SUCCESS;
+}
+
 aclnnStatus aclnnOneHotGetWorkspaceSize(
     const aclTensor* self, int numClasses, const aclTensor* onValue, const aclTensor* offValue, int64_t axis,
     aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor)
@@ -203,25 +332,175 @@ aclnnStatus aclnnOneHotGetWorkspaceSize(
         return ACLNN_SUCCESS;
     }
 
-    // 将输入self转换成连续的tensor
-    const aclTensor* selfContiguous = l0op::Contiguous(self, uniqueExecutorInst);
-    CHECK_RET(selfContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    ret = OneHotProc(self, numClasses, onValue, offValue, axis, 0.0f, out, uniqueExecutorInst);
+    CHECK_RET(ret == ACLNN_SUCCESS, ret);
 
-    auto reformat = l0op::ReFormat(selfContiguous, Format::FORMAT_ND);
-    CHECK_RET(reformat != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    // 获取计算过程中需要使用的workspace大小
+    *workspaceSize = uniqueExecutor->GetWorkspaceSize();
+    uniqueExecutor.ReleaseTo(executor);
 
-    // 初始化参数
-    const aclTensor* numClassesTensor = uniqueExecutorInst->ConvertToTensor(
-        uniqueExecutorInst->AllocScalar(numClasses),
-        self->GetDataType() == op::DataType::DT_UINT8 ? op::DataType::DT_INT32 : self->GetDataType());
+    return ACLNN_SUCCESS;
+}
 
-    // 调用OneHot算子kernel
-    auto oneHotOut = l0op::OneHot(reformat, numClassesTensor, onValue, offValue, axis, uniqueExecutorInst);
-    CHECK_RET(oneHotOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+aclnnStatus aclnnOneHot(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream)
+{
+    L2_DFX_PHASE_2(aclnnOneHot);
+    // 固定写法，调用框架能力，完成计算
+    return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+}
 
-    // 将计算结果拷贝到输出out上，out可能是非连续的tensor
-    auto viewCopyResult = l0op::ViewCopy(oneHotOut, out, uniqueExecutorInst);
+aclnnStatus aclnnOneHotLabelSmoothingGetWorkspaceSize(
+    const aclTensor* self, int numClasses, const aclTensor* onValue, const aclTensor* offValue, int64_t axis,
+    double labelSmoothing, aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor)
+{
+    OP_CHECK_COMM_INPUT(workspaceSize, executor);
+
+    L2_DFX_PHASE_1(
+        aclnnOneHotLabelSmoothing, DFX_IN(self, numClasses, onValue, offValue, axis, labelSmoothing), DFX_OUT(out));
+
+    // 参数检查
+    aclnnStatus ret = CheckParams(self, numClasses, onValue, offValue, axis, out);
+    CHECK_RET(ret == ACLNN_SUCCESS, ret);
+    CHECK_COND(
+        CheckLabelSmoothing(self, onValue, axis, labelSmoothing), ACLNN_ERR_PARAM_INVALID,
+        "CheckLabelSmoothing failed!");
+
+    // 创建OpExecutor
+    UniqueExecutor uniqueExecutor = CREATE_EXECUTOR();
+    aclOpExecutor* uniqueExecutorInst = uniqueExecutor.get();
+    CHECK_RET(uniqueExecutorInst != nullptr, ACLNN_ERR_INNER_CREATE_EXECUTOR);
+
+    // 空tensor，或numClasses为0，直接返回空tensor即可
+    if (self->IsEmpty() || numClasses == 0) {
+        *workspaceSize = 0;
+        uniqueExecutor.ReleaseTo(executor);
+        return ACLNN_SUCCESS;
+    }
+
+    ret = OneHotProc(
+        self, numClasses, onValue, offValue, axis, static_cast<float>(labelSmoothing), out, uniqueExecutorInst);
+    CHECK_RET(ret == ACLNN_SUCCESS, ret);
+
+    // 获取计算过程中需要使用的workspace大小
+    *workspaceSize = uniqueExecutor->GetWorkspaceSize();
+    uniqueExecutor.ReleaseTo(executor);
+
+    return ACLNN_SUCCESS;
+}
+
+aclnnStatus aclnnOneHotLabelSmoothing(
+    void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream)
+{
+    L2_DFX_PHASE_2(aclnnOneHotLabelSmoothing);
+    // 固定写法，调用框架能力，完成计算
+    return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+}
+
+static bool CheckSparseParams(
+    const aclTensor* self, int64_t numClasses, const aclTensor* onValue, const aclTensor* offValue,
+    double labelSmoothing, const aclTensor* crowIndices, const aclTensor* colIndices, const aclTensor* values)
+{
+    OP_CHECK_NULL(self, return false);
+    OP_CHECK_NULL(onValue, return false);
+    OP_CHECK_NULL(offValue, return false);
+    OP_CHECK_NULL(crowIndices, return false);
+    OP_CHECK_NULL(colIndices, return false);
+    OP_CHECK_NULL(values, return false);
+
+    OP_CHECK_DTYPE_NOT_SUPPORT(self, DTYPE_SUPPORT_LIST, return false);
+    OP_CHECK_DTYPE_NOT_SUPPORT(values, SPARSE_VALUE_DTYPE_SUPPORT_LIST, return false);
+    OP_CHECK_DTYPE_NOT_MATCH(onValue, values->GetDataType(), return false);
+    OP_CHECK_DTYPE_NOT_MATCH(offValue, values->GetDataType(), return false);
+    OP_CHECK_DTYPE_NOT_SUPPORT(crowIndices, SPARSE_INDEX_DTYPE_SUPPORT_LIST, return false);
+    OP_CHECK_DTYPE_NOT_SUPPORT(colIndices, SPARSE_INDEX_DTYPE_SUPPORT_LIST, return false);
+    OP_CHECK_MAX_DIM(self, MAX_SUPPORT_DIMS_NUMS, return false);
+
+    if (numClasses <= MIN_NUM_CLASSES) {
+        OP_LOGE(
+            ACLNN_ERR_PARAM_INVALID, "NumClasses should be greater than %ld, but got %ld.", MIN_NUM_CLASSES,
+            numClasses);
+        return false;
+    }
+    // 稀疏输出为每行一个非背景元素的CSR：values/colIndices长度为n，crowIndices长度为n + 1
+    int64_t rowNum = self->GetViewShape().GetShapeSize();
+    op::Shape rowShape = {rowNum};
+    op::Shape crowShape = {rowNum + 1};
+    OP_CHECK_SHAPE_NOT_EQUAL_WITH_EXPECTED_SIZE(values, rowShape, return false);
+    OP_CHECK_SHAPE_NOT_EQUAL_WITH_EXPECTED_SIZE(colIndices, rowShape, return false);
+    OP_CHECK_SHAPE_NOT_EQUAL_WITH_EXPECTED_SIZE(crowIndices, crowShape, return false);
+
+    if (!l0op::IsOneHotV2Support(self, onValue)) {
+        OP_LOGE(ACLNN_ERR_PARAM_INVALID, "Sparse one hot is not supported on this soc.");
+        return false;
+    }
+    return CheckLabelSmoothing(self, onValue, MIN_AXIS, labelSmoothing);
+}
+
+static const aclTensor* SparseKernelOut(const aclTensor* out)
+{
+    return IsContiguous(out) ? out : nullptr;
+}
+
+static aclnnStatus CopyToSparseOut(const aclTensor* result, const aclTensor* out, aclOpExecutor* executor)
+{
+    if (result == out) {
+        return ACLNN_SUCCESS;
+    }
+    auto viewCopyResult = l0op::ViewCopy(result, out, executor);
     CHECK_RET(viewCopyResult != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    return ACLNN_SUCCESS;
+}
+
+aclnnStatus aclnnOneHotSparseGetWorkspaceSize(
+    const aclTensor* self, int numClasses, const aclTensor* onValue, const aclTensor* offValue,
+    double labelSmoothing, aclTensor* crowIndices, aclTensor* colIndices, aclTensor* values,
+    uint64_t* workspaceSize, aclOpExecutor** executor)
+{
+    OP_CHECK_COMM_INPUT(workspaceSize, executor);
+
+    L2_DFX_PHASE_1(
+        aclnnOneHotSparse, DFX_IN(self, numClasses, onValue, offValue, labelSmoothing),
+        DFX_OUT(crowIndices, colIndices, values));
+
+    // 参数检查
+    CHECK_COND(
+        CheckSparseParams(self, numClasses, onValue, offValue, labelSmoothing, crowIndices, colIndices, values),
+        ACLNN_ERR_PARAM_INVALID, "CheckSparseParams failed!");
+
+    // 创建OpExecutor
+    UniqueExecutor uniqueExecutor = CREATE_EXECUTOR();
+    aclOpExecutor* uniqueExecutorInst = uniqueExecutor.get();
+    CHECK_RET(uniqueExecutorInst != nullptr, ACLNN_ERR_INNER_CREATE_EXECUTOR);
+
+    // 空tensor时只需写出crowIndices = [0]
+    if (self->IsEmpty()) {
+        int64_t zero = 0;
+        auto zeroArray = uniqueExecutorInst->AllocIntArray(&zero, 1);
+        CHECK_RET(zeroArray != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        auto zeroTensor = uniqueExecutorInst->ConvertToTensor(zeroArray, op::DataType::DT_INT64);
+        CHECK_RET(zeroTensor != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        auto viewCopyResult = l0op::ViewCopy(zeroTensor, crowIndices, uniqueExecutorInst);
+        CHECK_RET(viewCopyResult != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        *workspaceSize = uniqueExecutor->GetWorkspaceSize();
+        uniqueExecutor.ReleaseTo(executor);
+        return ACLNN_SUCCESS;
+    }
+
+    const aclTensor* selfContiguous = l0op::Contiguous(self, uniqueExecutorInst);
+    CHECK_RET(selfContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    // 连续输出由kernel直接写入，非连续输出先写入临时tensor再ViewCopy
+    auto sparseOut = l0op::OneHotV2Sparse(
+        selfContiguous, onValue, offValue, numClasses, static_cast<float>(labelSmoothing), SparseKernelOut(values),
+        SparseKernelOut(colIndices), SparseKernelOut(crowIndices), uniqueExecutorInst);
+    const aclTensor* valuesOut = std::get<0>(sparseOut);
+    const aclTensor* colOut = std::get<1>(sparseOut);
+    const aclTensor* crowOut = std::get<2>(sparseOut);
+    CHECK_RET(valuesOut != nullptr && colOut != nullptr && crowOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    CHECK_RET(CopyToSparseOut(valuesOut, values, uniqueExecutorInst) == ACLNN_SUCCESS, ACLNN_ERR_INNER_NULLPTR);
+    CHECK_RET(CopyToSparseOut(colOut, colIndices, uniqueExecutorInst) == ACLNN_SUCCESS, ACLNN_ERR_INNER_NULLPTR);
+    CHECK_RET(CopyToSparseOut(crowOut, crowIndices, uniqueExecutorInst) == ACLNN_SUCCESS, ACLNN_ERR_INNER_NULLPTR);
 
     // 获取计算过程中需要使用的workspace大小
     *workspaceSize = uniqueExecutor->GetWorkspaceSize();
@@ -230,9 +509,9 @@ aclnnStatus aclnnOneHotGetWorkspaceSize(
     return ACLNN_SUCCESS;
 }
 
-aclnnStatus aclnnOneHot(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream)
+aclnnStatus aclnnOneHotSparse(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream)
 {
-    L2_DFX_PHASE_2(aclnnOneHot);
+    L2_DFX_PHASE_2(aclnnOneHotSparse);
     // 固定写法，调用框架能力，完成计算
     return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
 }
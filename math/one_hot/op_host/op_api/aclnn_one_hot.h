@@ -31,6 +31,40 @@ ACLNN_API aclnnStatus aclnnOneHotGetWorkspaceSize(
  */
 ACLNN_API aclnnStatus aclnnOneHot(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream);
 
+/**
+ * @brief aclnnOneHotLabelSmoothing的第一段接口，根据具体的计算流程，计算workspace大小。
+ * 在aclnnOneHot基础上按labelSmoothing调整on/off值：v' = (1 - labelSmoothing) * v + labelSmoothing * mean，
+ * mean = (onValue + (numClasses - 1) * offValue) / numClasses。labelSmoothing非0时要求axis为最后一维，out为浮点类型。
+ * @domain aclnn_math
+ */
+ACLNN_API aclnnStatus aclnnOneHotLabelSmoothingGetWorkspaceSize(
+    const aclTensor* self, int numClasses, const aclTensor* onValue, const aclTensor* offValue, int64_t axis,
+    double labelSmoothing, aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor);
+
+/**
+ * @brief aclnnOneHotLabelSmoothing的第二段接口，用于执行计算。
+ */
+ACLNN_API aclnnStatus aclnnOneHotLabelSmoothing(
+    void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream);
+
+/**
+ * @brief aclnnOneHotSparse的第一段接口，根据具体的计算流程，计算workspace大小。
+ * 以CSR格式输出[n, numClasses]的one hot矩阵，n为self元素个数：每行一个非背景元素，values/colIndices长度为n，
+ * crowIndices长度为n + 1，背景值为offValue。越界索引所在行仍存储一项(0, offValue)，按存储项计算的CSR消费方会
+ * 把它当作第0列的有效值，offValue非0时需先过滤越界索引或将offValue设为0。
+ * @domain aclnn_math
+ */
+ACLNN_API aclnnStatus aclnnOneHotSparseGetWorkspaceSize(
+    const aclTensor* self, int numClasses, const aclTensor* onValue, const aclTensor* offValue,
+    double labelSmoothing, aclTensor* crowIndices, aclTensor* colIndices, aclTensor* values,
+    uint64_t* workspaceSize, aclOpExecutor** executor);
+
+/**
+ * @brief aclnnOneHotSparse的第二段接口，用于执行计算。
+ */
+ACLNN_API aclnnStatus aclnnOneHotSparse(
+    void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream);
+
 #ifdef __cplusplus
 }
 #endif
@@ -570,4 +570,136 @@ TEST_F(l2_one_hot_test, ascend910_9589_l2_one_hot_test_uint8_and_uint8_dtype)
 
     // SAMPLE: precision simulate
     ut.TestPrecision();
-}
\ No newline at end of file
+}
+
+// OneHotV2_最后一维_跨步输出直接写入
+TEST_F(l2_one_hot_test, ascend910B2_l2_one_hot_v2_strided_out)
+{
+    auto selfDesc = TensorDesc({4, 8}, ACL_INT64, ACL_FORMAT_ND);
+    selfDesc.ValueRange(0, 10);
+    auto outDesc = TensorDesc({4, 8, 10}, ACL_FLOAT, ACL_FORMAT_ND, {128, 16, 1}, 0, {512});
+    auto onValue = TensorDesc({1}, ACL_FLOAT, ACL_FORMAT_ND);
+    onValue.ValueRange(1, 2);
+    auto offValue = TensorDesc({1}, ACL_FLOAT, ACL_FORMAT_ND);
+    offValue.ValueRange(0, 1);
+    int64_t numClasses = 10;
+    auto ut = OP_API_UT(aclnnOneHot, INPUT(selfDesc, numClasses, onValue, offValue, -1), OUTPUT(outDesc));
+
+    // only test GetWorkspaceSize
+    uint64_t workspaceSize = 0;
+    aclnnStatus getWorkspaceResult = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(getWorkspaceResult, ACLNN_SUCCESS);
+}
+
+// 标签平滑_FLOAT16
+TEST_F(l2_one_hot_test, ascend910B2_l2_one_hot_label_smoothing_float16)
+{
+    auto selfDesc = TensorDesc({16}, ACL_INT32, ACL_FORMAT_ND);
+    selfDesc.ValueRange(0, 100);
+    auto outDesc = TensorDesc({16, 100}, ACL_FLOAT16, ACL_FORMAT_ND);
+    auto onValue = TensorDesc({1}, ACL_FLOAT16, ACL_FORMAT_ND);
+    onValue.ValueRange(1, 2);
+    auto offValue = TensorDesc({1}, ACL_FLOAT16, ACL_FORMAT_ND);
+    offValue.ValueRange(0, 1);
+    int64_t numClasses = 100;
+    double labelSmoothing = 0.1;
+    auto ut = OP_API_UT(
+        aclnnOneHotLabelSmoothing, INPUT(selfDesc, numClasses, onValue, offValue, -1, labelSmoothing),
+        OUTPUT(outDesc));
+
+    // only test GetWorkspaceSize
+    uint64_t workspaceSize = 0;
+    aclnnStatus getWorkspaceResult = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(getWorkspaceResult, ACLNN_SUCCESS);
+}
+
+// 标签平滑_非最后一维
+TEST_F(l2_one_hot_test, ascend910B2_l2_one_hot_label_smoothing_axis_invalid)
+{
+    auto selfDesc = TensorDesc({16}, ACL_INT32, ACL_FORMAT_ND);
+    selfDesc.ValueRange(0, 100);
+    auto outDesc = TensorDesc({100, 16}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto onValue = TensorDesc({1}, ACL_FLOAT, ACL_FORMAT_ND);
+    onValue.ValueRange(1, 2);
+    auto offValue = TensorDesc({1}, ACL_FLOAT, ACL_FORMAT_ND);
+    offValue.ValueRange(0, 1);
+    int64_t numClasses = 100;
+    double labelSmoothing = 0.1;
+    auto ut = OP_API_UT(
+        aclnnOneHotLabelSmoothing, INPUT(selfDesc, numClasses, onValue, offValue, 0, labelSmoothing),
+        OUTPUT(outDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus getWorkspaceResult = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(getWorkspaceResult, ACLNN_ERR_PARAM_INVALID);
+}
+
+// 稀疏输出_大类别数
+TEST_F(l2_one_hot_test, ascend910B2_l2_one_hot_sparse_float)
+{
+    auto selfDesc = TensorDesc({32, 64}, ACL_INT64, ACL_FORMAT_ND);
+    selfDesc.ValueRange(0, 200000);
+    auto onValue = TensorDesc({1}, ACL_FLOAT, ACL_FORMAT_ND);
+    onValue.ValueRange(1, 2);
+    auto offValue = TensorDesc({1}, ACL_FLOAT, ACL_FORMAT_ND);
+    offValue.ValueRange(0, 1);
+    auto crowDesc = TensorDesc({2049}, ACL_INT64, ACL_FORMAT_ND);
+    auto colDesc = TensorDesc({2048}, ACL_INT64, ACL_FORMAT_ND);
+    auto valuesDesc = TensorDesc({2048}, ACL_FLOAT, ACL_FORMAT_ND);
+    int64_t numClasses = 200000;
+    double labelSmoothing = 0.0;
+    auto ut = OP_API_UT(
+        aclnnOneHotSparse, INPUT(selfDesc, numClasses, onValue, offValue, labelSmoothing),
+        OUTPUT(crowDesc, colDesc, valuesDesc));
+
+    // only test GetWorkspaceSize
+    uint64_t workspaceSize = 0;
+    aclnnStatus getWorkspaceResult = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(getWorkspaceResult, ACLNN_SUCCESS);
+}
+
+// 稀疏输出_values非连续，仅values经ViewCopy写出
+TEST_F(l2_one_hot_test, ascend910B2_l2_one_hot_sparse_strided_values)
+{
+    auto selfDesc = TensorDesc({16}, ACL_INT32, ACL_FORMAT_ND);
+    selfDesc.ValueRange(0, 100);
+    auto onValue = TensorDesc({1}, ACL_FLOAT, ACL_FORMAT_ND);
+    onValue.ValueRange(1, 2);
+    auto offValue = TensorDesc({1}, ACL_FLOAT, ACL_FORMAT_ND);
+    offValue.ValueRange(0, 1);
+    auto crowDesc = TensorDesc({17}, ACL_INT64, ACL_FORMAT_ND);
+    auto colDesc = TensorDesc({16}, ACL_INT64, ACL_FORMAT_ND);
+    auto valuesDesc = TensorDesc({16}, ACL_FLOAT, ACL_FORMAT_ND, {2}, 0, {32});
+    int64_t numClasses = 100;
+    double labelSmoothing = 0.0;
+    auto ut = OP_API_UT(
+        aclnnOneHotSparse, INPUT(selfDesc, numClasses, onValue, offValue, labelSmoothing),
+        OUTPUT(crowDesc, colDesc, valuesDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus getWorkspaceResult = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(getWorkspaceResult, ACLNN_SUCCESS);
+}
+
+// 稀疏输出_crowIndices长度错误
+TEST_F(l2_one_hot_test, ascend910B2_l2_one_hot_sparse_crow_shape_invalid)
+{
+    auto selfDesc = TensorDesc({16}, ACL_INT32, ACL_FORMAT_ND);
+    selfDesc.ValueRange(0, 100);
+    auto onValue = TensorDesc({1}, ACL_INT32, ACL_FORMAT_ND);
+    onValue.ValueRange(1, 2);
+    auto offValue = TensorDesc({1}, ACL_INT32, ACL_FORMAT_ND);
+    offValue.ValueRange(0, 1);
+    auto crowDesc = TensorDesc({16}, ACL_INT64, ACL_FORMAT_ND);
+    auto colDesc = TensorDesc({16}, ACL_INT64, ACL_FORMAT_ND);
+    auto valuesDesc = TensorDesc({16}, ACL_INT32, ACL_FORMAT_ND);
+    int64_t numClasses = 100;
+    double labelSmoothing = 0.0;
+    auto ut = OP_API_UT(
+        aclnnOneHotSparse, INPUT(selfDesc, numClasses, onValue, offValue, labelSmoothing),
+        OUTPUT(crowDesc, colDesc, valuesDesc));
+
+    uint64_t workspaceSize = 0;
+    aclnnStatus getWorkspaceResult = ut.TestGetWorkspaceSize(&workspaceSize);
+    EXPECT_EQ(getWorkspaceResult, ACLNN_ERR_PARAM_INVALID);
+}
@@ -0,0 +1,263 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file one_hot_v2_tiling.cpp
+ * \brief
+ */
+#include <algorithm>
+#include "one_hot_v2_tiling.h"
+#include "log/log.h"
+#include "register/op_def_registry.h"
+#include "tiling_base/tiling_templates_registry.h"
+#include "platform/platform_info.h"
+
+namespace optiling {
+constexpr int32_t X_INPUT_INDEX = 0;
+constexpr int32_t ON_VALUE_INPUT_INDEX = 1;
+constexpr int32_t OFF_VALUE_INPUT_INDEX = 2;
+constexpr size_t DEPTH_ATTR_INDEX = 0;
+constexpr size_t ROW_STRIDE_ATTR_INDEX = 1;
+constexpr size_t LABEL_SMOOTHING_ATTR_INDEX = 2;
+constexpr size_t SPARSE_ATTR_INDEX = 3;
+constexpr uint32_t BYTE_BLOCK = 32;
+constexpr uint32_t BUFFER_NUM = 2;
+constexpr uint32_t RESERVED_UB = 1024;
+constexpr uint32_t SPARSE_INDEX_BYTES = 8;  // col_indices/crow_indices为INT64
+constexpr uint64_t MAX_DENSE_ROWS = 4095;   // 稠密块按行一次DataCopyPad写出，受blockCount上限约束
+constexpr uint64_t MAX_SPARSE_ROWS = 4096;
+constexpr uint64_t SPARSE_KEY_BASE = 100;
+constexpr uint64_t INDEX_KEY_STEP = 10;
+
+struct OneHotV2DtypeKey {
+    ge::DataType dtype;
+    uint64_t key;
+};
+
+static const OneHotV2DtypeKey VALUE_DTYPE_KEYS[] = {
+    {ge::DT_FLOAT, 1},
+    {ge::DT_FLOAT16, 2},
+    {ge::DT_INT32, 3},
+};
+
+static const OneHotV2DtypeKey INDEX_DTYPE_KEYS[] = {
+    {ge::DT_INT32, 0},
+    {ge::DT_INT64, 1},
+};
+
+static inline uint64_t CeilDiv(uint64_t a, uint64_t b)
+{
+    return b == 0 ? a : (a + b - 1) / b;
+}
+
+static inline uint64_t CeilAlign(uint64_t a, uint64_t b)
+{
+    return CeilDiv(a, b) * b;
+}
+
+static inline uint64_t FloorAlign(uint64_t a, uint64_t b)
+{
+    return b == 0 ? a : a / b * b;
+}
+
+static bool GetDtypeKey(const OneHotV2DtypeKey* keys, size_t keyNum, ge::DataType dtype, uint64_t& key)
+{
+    for (size_t i = 0; i < keyNum; i++) {
+        if (keys[i].dtype == dtype) {
+            key = keys[i].key;
+            return true;
+        }
+    }
+    return false;
+}
+
+// 稠密模式：每块为rowsPerTile行 * colTileLen列，先Duplicate off值再逐行写入on值；depth过大时单行按列切块
+static void CalcDenseTile(uint32_t typeSize, uint32_t indexSize, uint64_t budget, OneHotV2TilingData& tilingData)
+{
+    uint64_t colAlign = BYTE_BLOCK / typeSize;
+    // 单行最多占用一块预算的一半，保证块内至少两行或按列切分
+    uint64_t maxColLen = FloorAlign(budget / BUFFER_NUM / typeSize, colAlign);
+    uint64_t colTileLen = std::min(CeilAlign(tilingData.get_depth(), colAlign), maxColLen);
+    uint64_t rowBytes = colTileLen * typeSize + indexSize;
+    uint64_t rowsPerTile =
+        std::min(std::min(tilingData.get_rowNum(), MAX_DENSE_ROWS), (budget - BYTE_BLOCK) / rowBytes);
+    uint64_t colTileNum = CeilDiv(tilingData.get_depth(), colTileLen);
+    tilingData.set_colTileLen(static_cast<uint32_t>(colTileLen));
+    tilingData.set_rowsPerTile(static_cast<uint32_t>(rowsPerTile));
+    tilingData.set_colTileNum(colTileNum);
+    tilingData.set_tileNum(CeilDiv(tilingData.get_rowNum(), rowsPerTile) * colTileNum);
+}
+
+// 稀疏模式：每行只输出一个(col, value)，每块为rowsPerTile行的索引、列号、值与行偏移
+static void CalcSparseTile(uint32_t typeSize, uint32_t indexSize, uint64_t budget, OneHotV2TilingData& tilingData)
+{
+    uint64_t rowBytes = indexSize + typeSize + SPARSE_INDEX_BYTES + SPARSE_INDEX_BYTES;
+    uint64_t rowsPerTile =
+        std::min(std::min(tilingData.get_rowNum(), MAX_SPARSE_ROWS), (budget - BYTE_BLOCK * 4) / rowBytes);
+    tilingData.set_colTileLen(0);
+    tilingData.set_rowsPerTile(static_cast<uint32_t>(rowsPerTile));
+    tilingData.set_colTileNum(1);
+    tilingData.set_tileNum(CeilDiv(tilingData.get_rowNum(), rowsPerTile));
+}
+
+static void CalcCoreSplit(uint32_t coreNum, OneHotV2TilingData& tilingData)
+{
+    uint64_t tileNum = tilingData.get_tileNum();
+    uint64_t usedCoreNum = std::max<uint64_t>(1, std::min<uint64_t>(coreNum, tileNum));
+    tilingData.set_tilesPerCore(tileNum / usedCoreNum);
+    tilingData.set_tailTiles(tileNum % usedCoreNum);
+    tilingData.set_usedCoreNum(static_cast<uint32_t>(usedCoreNum));
+}
+
+static void PrintTilingData(gert::TilingContext* context, OneHotV2TilingData& tilingData)
+{
+    const ge::char_t* nodeName = context->GetNodeName();
+    OP_LOGD(nodeName, "rowNum: %lu", tilingData.get_rowNum());
+    OP_LOGD(nodeName, "depth: %lu", tilingData.get_depth());
+    OP_LOGD(nodeName, "rowStride: %lu", tilingData.get_rowStride());
+    OP_LOGD(nodeName, "colTileNum: %lu", tilingData.get_colTileNum());
+    OP_LOGD(nodeName, "tileNum: %lu", tilingData.get_tileNum());
+    OP_LOGD(nodeName, "tilesPerCore: %lu", tilingData.get_tilesPerCore());
+    OP_LOGD(nodeName, "tailTiles: %lu", tilingData.get_tailTiles());
+    OP_LOGD(nodeName, "rowsPerTile: %u", tilingData.get_rowsPerTile());
+    OP_LOGD(nodeName, "colTileLen: %u", tilingData.get_colTileLen());
+    OP_LOGD(nodeName, "usedCoreNum: %u", tilingData.get_usedCoreNum());
+    OP_LOGD(nodeName, "labelSmoothing: %f", tilingData.get_labelSmoothing());
+}
+
+static ge::graphStatus GetTilingKey(gert::TilingContext* context, bool sparse, uint64_t& tilingKey)
+{
+    auto xDesc = context->GetInputDesc(X_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, xDesc);
+    auto onDesc = context->GetInputDesc(ON_VALUE_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, onDesc);
+    auto offDesc = context->GetInputDesc(OFF_VALUE_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, offDesc);
+    uint64_t indexKey = 0;
+    uint64_t valueKey = 0;
+    OP_CHECK_IF(
+        !GetDtypeKey(INDEX_DTYPE_KEYS, sizeof(INDEX_DTYPE_KEYS) / sizeof(INDEX_DTYPE_KEYS[0]), xDesc->GetDataType(),
+                     indexKey),
+        OP_LOGE(context->GetNodeName(), "x dtype should be int32 or int64."), return ge::GRAPH_FAILED);
+    OP_CHECK_IF(
+        !GetDtypeKey(VALUE_DTYPE_KEYS, sizeof(VALUE_DTYPE_KEYS) / sizeof(VALUE_DTYPE_KEYS[0]), onDesc->GetDataType(),
+                     valueKey),
+        OP_LOGE(context->GetNodeName(), "on_value dtype should be float, float16 or int32."),
+        return ge::GRAPH_FAILED);
+    OP_CHECK_IF(
+        offDesc->GetDataType() != onDesc->GetDataType(),
+        OP_LOGE(context->GetNodeName(), "on_value and off_value should have the same dtype."),
+        return ge::GRAPH_FAILED);
+    tilingKey = (sparse ? SPARSE_KEY_BASE : 0) + indexKey * INDEX_KEY_STEP + valueKey;
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus Tiling4OneHotV2(gert::TilingContext* context)
+{
+    OP_LOGI(context->GetNodeName(), "OneHotV2 tiling starts running");
+    auto compileInfo = reinterpret_cast<const OneHotV2CompileInfo*>(context->GetCompileInfo());
+    OP_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    OP_CHECK_IF(
+        compileInfo->vectorCoreNum <= 0 || compileInfo->ubByteSize <= RESERVED_UB,
+        OP_LOGE(context->GetNodeName(), "Failed to get core num or ub size."), return ge::GRAPH_FAILED);
+
+    const gert::RuntimeAttrs* attrs = context->GetAttrs();
+    OP_CHECK_NULL_WITH_CONTEXT(context, attrs);
+    const int64_t* depthPtr = attrs->GetAttrPointer<int64_t>(DEPTH_ATTR_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, depthPtr);
+    const int64_t* rowStridePtr = attrs->GetAttrPointer<int64_t>(ROW_STRIDE_ATTR_INDEX);
+    const float* smoothingPtr = attrs->GetAttrPointer<float>(LABEL_SMOOTHING_ATTR_INDEX);
+    const bool* sparsePtr = attrs->GetAttrPointer<bool>(SPARSE_ATTR_INDEX);
+    int64_t depth = *depthPtr;
+    int64_t rowStride = (rowStridePtr == nullptr || *rowStridePtr <= 0) ? depth : *rowStridePtr;
+    float labelSmoothing = smoothingPtr == nullptr ? 0.0f : *smoothingPtr;
+    bool sparse = sparsePtr != nullptr && *sparsePtr;
+    OP_CHECK_IF(
+        depth <= 0, OP_LOGE(context->GetNodeName(), "depth should be greater than 0, but got %ld.", depth),
+        return ge::GRAPH_FAILED);
+    OP_CHECK_IF(
+        !sparse && rowStride < depth,
+        OP_LOGE(context->GetNodeName(), "row_stride %ld should not be less than depth %ld.", rowStride, depth),
+        return ge::GRAPH_FAILED);
+    OP_CHECK_IF(
+        labelSmoothing < 0.0f || labelSmoothing > 1.0f,
+        OP_LOGE(context->GetNodeName(), "label_smoothing should be in [0, 1], but got %f.", labelSmoothing),
+        return ge::GRAPH_FAILED);
+
+    uint64_t tilingKey = 0;
+    OP_CHECK_IF(
+        GetTilingKey(context, sparse, tilingKey) != ge::GRAPH_SUCCESS,
+        OP_LOGE(context->GetNodeName(), "get tiling key failed."), return ge::GRAPH_FAILED);
+    ge::DataType valueDtype = context->GetInputDesc(ON_VALUE_INPUT_INDEX)->GetDataType();
+    OP_CHECK_IF(
+        valueDtype == ge::DT_INT32 && labelSmoothing != 0.0f,
+        OP_LOGE(context->GetNodeName(), "label_smoothing is not supported for int32 values."),
+        return ge::GRAPH_FAILED);
+
+    auto xShape = context->GetInputShape(X_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, xShape);
+    int64_t rowNum = xShape->GetStorageShape().GetShapeSize();
+    OP_CHECK_IF(
+        rowNum <= 0, OP_LOGE(context->GetNodeName(), "x should not be empty."), return ge::GRAPH_FAILED);
+
+    OneHotV2TilingData tilingData;
+    tilingData.set_rowNum(static_cast<uint64_t>(rowNum));
+    tilingData.set_depth(static_cast<uint64_t>(depth));
+    tilingData.set_rowStride(static_cast<uint64_t>(rowStride));
+    tilingData.set_labelSmoothing(labelSmoothing);
+    uint32_t typeSize = ge::GetSizeByDataType(valueDtype);
+    uint32_t indexSize = ge::GetSizeByDataType(context->GetInputDesc(X_INPUT_INDEX)->GetDataType());
+    uint64_t budget = (compileInfo->ubByteSize - RESERVED_UB) / BUFFER_NUM;
+    if (sparse) {
+        CalcSparseTile(typeSize, indexSize, budget, tilingData);
+    } else {
+        CalcDenseTile(typeSize, indexSize, budget, tilingData);
+    }
+    OP_CHECK_IF(
+        tilingData.get_rowsPerTile() == 0,
+        OP_LOGE(context->GetNodeName(), "ub space is not enough, please check input."), return ge::GRAPH_FAILED);
+    CalcCoreSplit(compileInfo->vectorCoreNum, tilingData);
+
+    context->SetTilingKey(tilingKey);
+    context->SetBlockDim(tilingData.get_usedCoreNum());
+    size_t* workspaces = context->GetWorkspaceSizes(1);
+    workspaces[0] = compileInfo->sysWorkspaceByteSize;
+    tilingData.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tilingData.GetDataSize());
+    PrintTilingData(context, tilingData);
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus TilingPrepare4OneHotV2(gert::TilingParseContext* context)
+{
+    auto compileInfo = context->GetCompiledInfo<OneHotV2CompileInfo>();
+    OP_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    auto platformInfo = context->GetPlatformInfo();
+    OP_CHECK_NULL_WITH_CONTEXT(context, platformInfo);
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(platformInfo);
+    compileInfo->vectorCoreNum = ascendcPlatform.GetCoreNumAiv();
+    OP_CHECK_IF(
+        (compileInfo->vectorCoreNum <= 0), OP_LOGE(context->GetNodeName(), "No vector core available."),
+        return ge::GRAPH_FAILED);
+    uint64_t ubByteSize;
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ubByteSize);
+    compileInfo->ubByteSize = ubByteSize;
+    OP_CHECK_IF(
+        (compileInfo->ubByteSize <= 0), OP_LOGE(context->GetNodeName(), "Failed to get ub size."),
+        return ge::GRAPH_FAILED);
+    compileInfo->sysWorkspaceByteSize = ascendcPlatform.GetLibApiWorkSpaceSize();
+    return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_OPTILING(OneHotV2)
+    .Tiling(Tiling4OneHotV2)
+    .TilingParse<OneHotV2CompileInfo>(TilingPrepare4OneHotV2);
+} // namespace optiling
@@ -0,0 +1,43 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file one_hot_v2_tiling.h
+ * \brief
+ */
+#ifndef OPS_BUILT_IN_OP_TILING_RUNTIME_ONE_HOT_V2_H_
+#define OPS_BUILT_IN_OP_TILING_RUNTIME_ONE_HOT_V2_H_
+
+#include "register/tilingdata_base.h"
+
+namespace optiling {
+BEGIN_TILING_DATA_DEF(OneHotV2TilingData)
+TILING_DATA_FIELD_DEF(uint64_t, rowNum);       // 索引个数，即输出行数
+TILING_DATA_FIELD_DEF(uint64_t, depth);        // 类别数
+TILING_DATA_FIELD_DEF(uint64_t, rowStride);    // 输出相邻行在GM上的间隔（元素），稠密模式下不小于depth
+TILING_DATA_FIELD_DEF(uint64_t, colTileNum);   // 每行按colTileLen切分的列块数，稀疏模式为1
+TILING_DATA_FIELD_DEF(uint64_t, tileNum);      // 行块数 * 列块数
+TILING_DATA_FIELD_DEF(uint64_t, tilesPerCore); // 每核处理的块数
+TILING_DATA_FIELD_DEF(uint64_t, tailTiles);    // 前tailTiles个核多处理一块
+TILING_DATA_FIELD_DEF(uint32_t, rowsPerTile);  // 每块的行数
+TILING_DATA_FIELD_DEF(uint32_t, colTileLen);   // 每块的列数，即UB中每行占用的元素数，32B对齐
+TILING_DATA_FIELD_DEF(uint32_t, usedCoreNum);
+TILING_DATA_FIELD_DEF(float, labelSmoothing);  // on/off值按标签平滑调整，0表示不平滑
+END_TILING_DATA_DEF;
+REGISTER_TILING_DATA_CLASS(OneHotV2, OneHotV2TilingData)
+
+struct OneHotV2CompileInfo {
+    uint32_t vectorCoreNum;
+    uint32_t sysWorkspaceByteSize;
+    uint32_t ubByteSize;
+};
+} // namespace optiling
+#endif // OPS_BUILT_IN_OP_TILING_RUNTIME_ONE_HOT_V2_H_
@@ -0,0 +1,105 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file one_hot_v2.cpp
+ * \brief
+ */
+
+#include "one_hot_v2.h"
+#include "opdev/data_type_utils.h"
+#include "opdev/format_utils.h"
+#include "opdev/make_op_executor.h"
+#include "opdev/op_def.h"
+#include "opdev/op_dfx.h"
+#include "opdev/op_executor.h"
+#include "opdev/op_log.h"
+#include "opdev/platform.h"
+#include "opdev/shape_utils.h"
+
+using namespace op;
+
+namespace l0op {
+OP_TYPE_REGISTER(OneHotV2);
+
+static const std::initializer_list<op::DataType> AICORE_INDEX_DTYPE_SUPPORT_LIST = {
+    DataType::DT_INT32, DataType::DT_INT64};
+
+static const std::initializer_list<op::DataType> AICORE_VALUE_DTYPE_SUPPORT_LIST = {
+    DataType::DT_FLOAT, DataType::DT_FLOAT16, DataType::DT_INT32};
+
+bool IsOneHotV2Support(const aclTensor* self, const aclTensor* onValue)
+{
+    SocVersion socVersion = GetCurrentPlatformInfo().GetSocVersion();
+    if (socVersion != SocVersion::ASCEND910B && socVersion != SocVersion::ASCEND910_93) {
+        return false;
+    }
+    return CheckType(self->GetDataType(), AICORE_INDEX_DTYPE_SUPPORT_LIST) &&
+           CheckType(onValue->GetDataType(), AICORE_VALUE_DTYPE_SUPPORT_LIST);
+}
+
+const aclTensor* OneHotV2(
+    const aclTensor* self, const aclTensor* onValue, const aclTensor* offValue, int64_t depth, int64_t rowStride,
+    float labelSmoothing, const aclTensor* out, aclOpExecutor* executor)
+{
+    L0_DFX(OneHotV2, self, onValue, offValue, depth, rowStride, labelSmoothing, out);
+
+    if (out == nullptr) {
+        Shape outShape = self->GetViewShape();
+        outShape.AppendDim(depth);
+        out = executor->AllocTensor(outShape, onValue->GetDataType(), Format::FORMAT_ND);
+        CHECK_RET(out != nullptr, nullptr);
+        rowStride = depth;
+    }
+    const aclTensor* colIndices = nullptr;
+    const aclTensor* crowIndices = nullptr;
+    bool sparse = false;
+    auto ret = ADD_TO_LAUNCHER_LIST_AICORE(
+        OneHotV2, OP_INPUT(self, onValue, offValue), OP_OUTPUT(out, colIndices, crowIndices),
+        OP_ATTR(depth, rowStride, labelSmoothing, sparse));
+    if (ret != ACLNN_SUCCESS) {
+        OP_LOGE(ACLNN_ERR_INNER_NULLPTR, "OneHotV2 ADD_TO_LAUNCHER_LIST_AICORE failed.");
+        return nullptr;
+    }
+    return out;
+}
+
+std::tuple<const aclTensor*, const aclTensor*, const aclTensor*> OneHotV2Sparse(
+    const aclTensor* self, const aclTensor* onValue, const aclTensor* offValue, int64_t depth, float labelSmoothing,
+    const aclTensor* values, const aclTensor* colIndices, const aclTensor* crowIndices, aclOpExecutor* executor)
+{
+    L0_DFX(OneHotV2Sparse, self, onValue, offValue, depth, labelSmoothing, values, colIndices, crowIndices);
+
+    int64_t rowNum = self->GetViewShape().GetShapeSize();
+    if (values == nullptr) {
+        values = executor->AllocTensor(Shape({rowNum}), onValue->GetDataType(), Format::FORMAT_ND);
+    }
+    if (colIndices == nullptr) {
+        colIndices = executor->AllocTensor(Shape({rowNum}), DataType::DT_INT64, Format::FORMAT_ND);
+    }
+    if (crowIndices == nullptr) {
+        crowIndices = executor->AllocTensor(Shape({rowNum + 1}), DataType::DT_INT64, Format::FORMAT_ND);
+    }
+    if (values == nullptr || colIndices == nullptr || crowIndices == nullptr) {
+        return std::tuple<const aclTensor*, const aclTensor*, const aclTensor*>(nullptr, nullptr, nullptr);
+    }
+    int64_t rowStride = 0;
+    bool sparse = true;
+    auto ret = ADD_TO_LAUNCHER_LIST_AICORE(
+        OneHotV2, OP_INPUT(self, onValue, offValue), OP_OUTPUT(values, colIndices, crowIndices),
+        OP_ATTR(depth, rowStride, labelSmoothing, sparse));
+    if (ret != ACLNN_SUCCESS) {
+        OP_LOGE(ACLNN_ERR_INNER_NULLPTR, "OneHotV2 sparse ADD_TO_LAUNCHER_LIST_AICORE failed.");
+        return std::tuple<const aclTensor*, const aclTensor*, const aclTensor*>(nullptr, nullptr, nullptr);
+    }
+    return std::tuple<const aclTensor*, const aclTensor*, const aclTensor*>(values, colIndices, crowIndices);
+}
+} // namespace l0op
@@ -0,0 +1,42 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file one_hot_v2.h
+ * \brief
+ */
+
+#ifndef OP_API_INC_LEVEL0_ONE_HOT_V2_H
+#define OP_API_INC_LEVEL0_ONE_HOT_V2_H
+#include <tuple>
+#include "opdev/op_executor.h"
+
+namespace l0op {
+// kernel一次DataCopyPad按行写出，行间隔字节数受uint32约束
+constexpr int64_t ONE_HOT_V2_MAX_ROW_STRIDE = 1L << 28;
+
+// 芯片与dtype是否可走OneHotV2 kernel
+bool IsOneHotV2Support(const aclTensor* self, const aclTensor* onValue);
+
+// 稠密输出，类别轴为最后一维。out为空时申请连续输出；否则out为以首元素为起点、行间隔为rowStride的输出视图，
+// kernel按行直接写入，无需ViewCopy。labelSmoothing非0时在kernel内调整on/off值
+const aclTensor* OneHotV2(
+    const aclTensor* self, const aclTensor* onValue, const aclTensor* offValue, int64_t depth, int64_t rowStride,
+    float labelSmoothing, const aclTensor* out, aclOpExecutor* executor);
+
+// 稀疏输出，返回(values, colIndices, crowIndices)：每个索引输出一个(col, value)，crowIndices长度为n + 1；
+// 越界索引仍存储一项(0, off值)。values/colIndices/crowIndices为连续输出时kernel直接写入，为空时申请临时输出
+std::tuple<const aclTensor*, const aclTensor*, const aclTensor*> OneHotV2Sparse(
+    const aclTensor* self, const aclTensor* onValue, const aclTensor* offValue, int64_t depth, float labelSmoothing,
+    const aclTensor* values, const aclTensor* colIndices, const aclTensor* crowIndices, aclOpExecutor* executor);
+} // namespace l0op
+
+#endif // OP_API_INC_LEVEL0_ONE_HOT_V2_H
@@ -0,0 +1,67 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file one_hot_v2.cpp
+ * \brief
+ */
+
+#include "kernel_operator.h"
+#include "one_hot_v2.h"
+
+using namespace OneHotV2;
+
+#define ONE_HOT_V2_DENSE_IMPL(IDX_T, VALUE_T)          \
+    do {                                               \
+        OneHotV2Dense<IDX_T, VALUE_T> op;              \
+        op.Init(x, onValue, offValue, y, &tilingData); \
+        op.Process();                                  \
+    } while (0)
+
+#define ONE_HOT_V2_SPARSE_IMPL(IDX_T, VALUE_T)                                  \
+    do {                                                                        \
+        OneHotV2Sparse<IDX_T, VALUE_T> op;                                      \
+        op.Init(x, onValue, offValue, y, colIndices, crowIndices, &tilingData); \
+        op.Process();                                                           \
+    } while (0)
+
+// 稠密与稀疏输出共用一个kernel，稠密模式下col_indices/crow_indices不使用
+extern "C" __global__ __aicore__ void one_hot_v2(
+    GM_ADDR x, GM_ADDR onValue, GM_ADDR offValue, GM_ADDR y, GM_ADDR colIndices, GM_ADDR crowIndices,
+    GM_ADDR workspace, GM_ADDR tiling)
+{
+    GET_TILING_DATA(tilingData, tiling);
+    if (TILING_KEY_IS(1)) {
+        ONE_HOT_V2_DENSE_IMPL(int32_t, float);
+    } else if (TILING_KEY_IS(2)) {
+        ONE_HOT_V2_DENSE_IMPL(int32_t, half);
+    } else if (TILING_KEY_IS(3)) {
+        ONE_HOT_V2_DENSE_IMPL(int32_t, int32_t);
+    } else if (TILING_KEY_IS(11)) {
+        ONE_HOT_V2_DENSE_IMPL(int64_t, float);
+    } else if (TILING_KEY_IS(12)) {
+        ONE_HOT_V2_DENSE_IMPL(int64_t, half);
+    } else if (TILING_KEY_IS(13)) {
+        ONE_HOT_V2_DENSE_IMPL(int64_t, int32_t);
+    } else if (TILING_KEY_IS(101)) {
+        ONE_HOT_V2_SPARSE_IMPL(int32_t, float);
+    } else if (TILING_KEY_IS(102)) {
+        ONE_HOT_V2_SPARSE_IMPL(int32_t, half);
+    } else if (TILING_KEY_IS(103)) {
+        ONE_HOT_V2_SPARSE_IMPL(int32_t, int32_t);
+    } else if (TILING_KEY_IS(111)) {
+        ONE_HOT_V2_SPARSE_IMPL(int64_t, float);
+    } else if (TILING_KEY_IS(112)) {
+        ONE_HOT_V2_SPARSE_IMPL(int64_t, half);
+    } else if (TILING_KEY_IS(113)) {
+        ONE_HOT_V2_SPARSE_IMPL(int64_t, int32_t);
+    }
+}
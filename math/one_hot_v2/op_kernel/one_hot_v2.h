@@ -0,0 +1,296 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file one_hot_v2.h
+ * \brief 按行块流式生成的OneHot
+ *
+ * 稠密模式：输出按rowsPerTile行 * colTileLen列切块，块在各核间均分。每块先Duplicate off值，再按索引逐行写入on值，
+ * 最后一次DataCopyPad按行写出，目的行间隔为rowStride，可直接写入跨步的输出视图。每个输出元素只写一次GM。
+ * 稀疏模式：每个索引输出一个(col, value)，crow_indices为0..n，输出大小与类别数无关。
+ * label_smoothing非0时on/off值按标签平滑调整后再写出。
+ */
+#ifndef ONE_HOT_V2_H
+#define ONE_HOT_V2_H
+
+#include "kernel_operator.h"
+
+namespace OneHotV2 {
+using namespace AscendC;
+
+constexpr int32_t BUFFER_NUM = 2;
+constexpr uint32_t BYTE_BLOCK = 32;
+
+template <typename T1>
+__aicore__ inline T1 CeilDiv(T1 a, T1 b)
+{
+    return b == 0 ? a : (a + b - 1) / b;
+}
+
+template <typename T1>
+__aicore__ inline T1 Min(T1 a, T1 b)
+{
+    return a < b ? a : b;
+}
+
+template <HardEvent EVENT>
+__aicore__ inline void SyncFlag()
+{
+    event_t eventId = static_cast<event_t>(GetTPipePtr()->FetchEventID(EVENT));
+    SetFlag<EVENT>(eventId);
+    WaitFlag<EVENT>(eventId);
+}
+
+// 读取标量on/off值并按标签平滑调整：v' = (1 - eps) * v + eps * (on + (depth - 1) * off) / depth
+template <typename T>
+__aicore__ inline void LoadOnOffValue(
+    GM_ADDR onValue, GM_ADDR offValue, uint64_t depth, float labelSmoothing, T& onOut, T& offOut)
+{
+    GlobalTensor<T> onGm;
+    GlobalTensor<T> offGm;
+    onGm.SetGlobalBuffer((__gm__ T*)onValue);
+    offGm.SetGlobalBuffer((__gm__ T*)offValue);
+    onOut = onGm.GetValue(0);
+    offOut = offGm.GetValue(0);
+    if constexpr (!IsSameType<T, int32_t>::value) {
+        if (labelSmoothing != 0.0f) {
+            float on = static_cast<float>(onOut);
+            float off = static_cast<float>(offOut);
+            float mean = (on + static_cast<float>(depth - 1) * off) / static_cast<float>(depth);
+            onOut = static_cast<T>((1.0f - labelSmoothing) * on + labelSmoothing * mean);
+            offOut = static_cast<T>((1.0f - labelSmoothing) * off + labelSmoothing * mean);
+        }
+    }
+}
+
+template <typename IdxT, typename T>
+class OneHotV2Dense {
+public:
+    __aicore__ inline OneHotV2Dense(){};
+    __aicore__ inline void Init(
+        GM_ADDR x, GM_ADDR onValue, GM_ADDR offValue, GM_ADDR y, const OneHotV2TilingData* __restrict tilingData);
+    __aicore__ inline void Process();
+
+private:
+    __aicore__ inline void ProcessTile(uint64_t tileIdx);
+
+private:
+    TPipe pipe;
+    TQue<QuePosition::VECIN, BUFFER_NUM> inQueueX;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> outQueueY;
+    GlobalTensor<IdxT> xGm;
+    GlobalTensor<T> yGm;
+    T onVal;
+    T offVal;
+
+    uint64_t rowNum = 0;
+    uint64_t depth = 0;
+    uint64_t rowStride = 0;
+    uint64_t colTileNum = 1;
+    uint64_t tileStart = 0;
+    uint64_t coreTileNum = 0;
+    uint32_t rowsPerTile = 0;
+    uint32_t colTileLen = 0;
+};
+
+template <typename IdxT, typename T>
+__aicore__ inline void OneHotV2Dense<IdxT, T>::Init(
+    GM_ADDR x, GM_ADDR onValue, GM_ADDR offValue, GM_ADDR y, const OneHotV2TilingData* __restrict tilingData)
+{
+    uint64_t blockIdx = GetBlockIdx();
+    uint64_t tilesPerCore = tilingData->tilesPerCore;
+    uint64_t tailTiles = tilingData->tailTiles;
+    coreTileNum = tilesPerCore + (blockIdx < tailTiles ? 1 : 0);
+    tileStart = blockIdx * tilesPerCore + (blockIdx < tailTiles ? blockIdx : tailTiles);
+    rowNum = tilingData->rowNum;
+    depth = tilingData->depth;
+    rowStride = tilingData->rowStride;
+    colTileNum = tilingData->colTileNum;
+    rowsPerTile = tilingData->rowsPerTile;
+    colTileLen = tilingData->colTileLen;
+
+    xGm.SetGlobalBuffer((__gm__ IdxT*)x);
+    yGm.SetGlobalBuffer((__gm__ T*)y);
+    LoadOnOffValue<T>(onValue, offValue, depth, tilingData->labelSmoothing, onVal, offVal);
+
+    pipe.InitBuffer(inQueueX, BUFFER_NUM, CeilDiv(rowsPerTile * sizeof(IdxT), BYTE_BLOCK) * BYTE_BLOCK);
+    pipe.InitBuffer(outQueueY, BUFFER_NUM, rowsPerTile * colTileLen * sizeof(T));
+}
+
+template <typename IdxT, typename T>
+__aicore__ inline void OneHotV2Dense<IdxT, T>::Process()
+{
+    for (uint64_t i = 0; i < coreTileNum; i++) {
+        ProcessTile(tileStart + i);
+    }
+}
+
+template <typename IdxT, typename T>
+__aicore__ inline void OneHotV2Dense<IdxT, T>::ProcessTile(uint64_t tileIdx)
+{
+    uint64_t rowStart = tileIdx / colTileNum * rowsPerTile;
+    uint64_t colStart = tileIdx % colTileNum * colTileLen;
+    uint32_t rows = static_cast<uint32_t>(Min(static_cast<uint64_t>(rowsPerTile), rowNum - rowStart));
+    uint32_t cols = static_cast<uint32_t>(Min(static_cast<uint64_t>(colTileLen), depth - colStart));
+
+    LocalTensor<IdxT> xLocal = inQueueX.AllocTensor<IdxT>();
+    DataCopyExtParams inParams = {1, static_cast<uint32_t>(rows * sizeof(IdxT)), 0, 0, 0};
+    DataCopyPadExtParams<IdxT> padParams = {false, 0, 0, static_cast<IdxT>(0)};
+    DataCopyPad(xLocal, xGm[rowStart], inParams, padParams);
+    inQueueX.EnQue(xLocal);
+    xLocal = inQueueX.DeQue<IdxT>();
+
+    LocalTensor<T> yLocal = outQueueY.AllocTensor<T>();
+    Duplicate(yLocal, offVal, static_cast<int32_t>(rows * colTileLen));
+    SyncFlag<HardEvent::MTE2_S>();
+    SyncFlag<HardEvent::V_S>();
+    // 每行至多一个on值，越界或负索引整行保持off值
+    for (uint32_t r = 0; r < rows; r++) {
+        int64_t col = static_cast<int64_t>(xLocal.GetValue(r)) - static_cast<int64_t>(colStart);
+        if (col >= 0 && col < static_cast<int64_t>(cols)) {
+            yLocal.SetValue(r * colTileLen + static_cast<uint32_t>(col), onVal);
+        }
+    }
+    SyncFlag<HardEvent::S_MTE2>();
+    inQueueX.FreeTensor(xLocal);
+    SyncFlag<HardEvent::S_MTE3>();
+    outQueueY.EnQue(yLocal);
+    yLocal = outQueueY.DeQue<T>();
+
+    // UB行长colTileLen按32B对齐，GM行间隔rowStride，一次搬出整块
+    uint32_t rowBytes = static_cast<uint32_t>(cols * sizeof(T));
+    uint32_t srcStride = (colTileLen * sizeof(T) - CeilDiv(rowBytes, BYTE_BLOCK) * BYTE_BLOCK) / BYTE_BLOCK;
+    uint32_t dstStride = static_cast<uint32_t>((rowStride - cols) * sizeof(T));
+    DataCopyExtParams outParams = {static_cast<uint16_t>(rows), rowBytes, srcStride, dstStride, 0};
+    DataCopyPad(yGm[rowStart * rowStride + colStart], yLocal, outParams);
+    outQueueY.FreeTensor(yLocal);
+}
+
+template <typename IdxT, typename T>
+class OneHotV2Sparse {
+public:
+    __aicore__ inline OneHotV2Sparse(){};
+    __aicore__ inline void Init(
+        GM_ADDR x, GM_ADDR onValue, GM_ADDR offValue, GM_ADDR values, GM_ADDR colIndices, GM_ADDR crowIndices,
+        const OneHotV2TilingData* __restrict tilingData);
+    __aicore__ inline void Process();
+
+private:
+    __aicore__ inline void ProcessTile(uint64_t tileIdx);
+
+private:
+    TPipe pipe;
+    TQue<QuePosition::VECIN, BUFFER_NUM> inQueueX;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> outQueueValue;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> outQueueCol;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> outQueueCrow;
+    GlobalTensor<IdxT> xGm;
+    GlobalTensor<T> valueGm;
+    GlobalTensor<int64_t> colGm;
+    GlobalTensor<int64_t> crowGm;
+    T onVal;
+    T offVal;
+
+    uint64_t rowNum = 0;
+    uint64_t depth = 0;
+    uint64_t tileStart = 0;
+    uint64_t coreTileNum = 0;
+    uint32_t rowsPerTile = 0;
+};
+
+template <typename IdxT, typename T>
+__aicore__ inline void OneHotV2Sparse<IdxT, T>::Init(
+    GM_ADDR x, GM_ADDR onValue, GM_ADDR offValue, GM_ADDR values, GM_ADDR colIndices, GM_ADDR crowIndices,
+    const OneHotV2TilingData* __restrict tilingData)
+{
+    uint64_t blockIdx = GetBlockIdx();
+    uint64_t tilesPerCore = tilingData->tilesPerCore;
+    uint64_t tailTiles = tilingData->tailTiles;
+    coreTileNum = tilesPerCore + (blockIdx < tailTiles ? 1 : 0);
+    tileStart = blockIdx * tilesPerCore + (blockIdx < tailTiles ? blockIdx : tailTiles);
+    rowNum = tilingData->rowNum;
+    depth = tilingData->depth;
+    rowsPerTile = tilingData->rowsPerTile;
+
+    xGm.SetGlobalBuffer((__gm__ IdxT*)x);
+    valueGm.SetGlobalBuffer((__gm__ T*)values);
+    colGm.SetGlobalBuffer((__gm__ int64_t*)colIndices);
+    crowGm.SetGlobalBuffer((__gm__ int64_t*)crowIndices);
+    LoadOnOffValue<T>(onValue, offValue, depth, tilingData->labelSmoothing, onVal, offVal);
+
+    pipe.InitBuffer(inQueueX, BUFFER_NUM, CeilDiv(rowsPerTile * sizeof(IdxT), BYTE_BLOCK) * BYTE_BLOCK);
+    pipe.InitBuffer(outQueueValue, BUFFER_NUM, CeilDiv(rowsPerTile * sizeof(T), BYTE_BLOCK) * BYTE_BLOCK);
+    pipe.InitBuffer(outQueueCol, BUFFER_NUM, CeilDiv(rowsPerTile * sizeof(int64_t), BYTE_BLOCK) * BYTE_BLOCK);
+    pipe.InitBuffer(outQueueCrow, BUFFER_NUM, CeilDiv((rowsPerTile + 1) * sizeof(int64_t), BYTE_BLOCK) * BYTE_BLOCK);
+}
+
+template <typename IdxT, typename T>
+__aicore__ inline void OneHotV2Sparse<IdxT, T>::Process()
+{
+    for (uint64_t i = 0; i < coreTileNum; i++) {
+        ProcessTile(tileStart + i);
+    }
+}
+
+template <typename IdxT, typename T>
+__aicore__ inline void OneHotV2Sparse<IdxT, T>::ProcessTile(uint64_t tileIdx)
+{
+    uint64_t rowStart = tileIdx * rowsPerTile;
+    uint32_t rows = static_cast<uint32_t>(Min(static_cast<uint64_t>(rowsPerTile), rowNum - rowStart));
+
+    LocalTensor<IdxT> xLocal = inQueueX.AllocTensor<IdxT>();
+    DataCopyExtParams inParams = {1, static_cast<uint32_t>(rows * sizeof(IdxT)), 0, 0, 0};
+    DataCopyPadExtParams<IdxT> padParams = {false, 0, 0, static_cast<IdxT>(0)};
+    DataCopyPad(xLocal, xGm[rowStart], inParams, padParams);
+    inQueueX.EnQue(xLocal);
+    xLocal = inQueueX.DeQue<IdxT>();
+
+    LocalTensor<T> valueLocal = outQueueValue.AllocTensor<T>();
+    LocalTensor<int64_t> colLocal = outQueueCol.AllocTensor<int64_t>();
+    LocalTensor<int64_t> crowLocal = outQueueCrow.AllocTensor<int64_t>();
+    SyncFlag<HardEvent::MTE2_S>();
+    SyncFlag<HardEvent::MTE3_S>();
+    // 越界或负索引的行输出(0, off值)，保持每行恰好一个非背景元素，crow_indices与索引值无关
+    for (uint32_t r = 0; r < rows; r++) {
+        int64_t idx = static_cast<int64_t>(xLocal.GetValue(r));
+        bool valid = idx >= 0 && idx < static_cast<int64_t>(depth);
+        colLocal.SetValue(r, valid ? idx : 0);
+        valueLocal.SetValue(r, valid ? onVal : offVal);
+    }
+    // 首块额外写出crow_indices[0] = 0，其余块写出crow_indices[rowStart + 1, rowStart + rows]
+    uint32_t crowLen = rowStart == 0 ? rows + 1 : rows;
+    uint64_t crowStart = rowStart == 0 ? 0 : rowStart + 1;
+    for (uint32_t r = 0; r < crowLen; r++) {
+        crowLocal.SetValue(r, static_cast<int64_t>(crowStart + r));
+    }
+    SyncFlag<HardEvent::S_MTE2>();
+    inQueueX.FreeTensor(xLocal);
+    SyncFlag<HardEvent::S_MTE3>();
+    outQueueValue.EnQue(valueLocal);
+    outQueueCol.EnQue(colLocal);
+    outQueueCrow.EnQue(crowLocal);
+    valueLocal = outQueueValue.DeQue<T>();
+    colLocal = outQueueCol.DeQue<int64_t>();
+    crowLocal = outQueueCrow.DeQue<int64_t>();
+
+    DataCopyExtParams valueParams = {1, static_cast<uint32_t>(rows * sizeof(T)), 0, 0, 0};
+    DataCopyPad(valueGm[rowStart], valueLocal, valueParams);
+    DataCopyExtParams colParams = {1, static_cast<uint32_t>(rows * sizeof(int64_t)), 0, 0, 0};
+    DataCopyPad(colGm[rowStart], colLocal, colParams);
+    DataCopyExtParams crowParams = {1, static_cast<uint32_t>(crowLen * sizeof(int64_t)), 0, 0, 0};
+    DataCopyPad(crowGm[crowStart], crowLocal, crowParams);
+    outQueueValue.FreeTensor(valueLocal);
+    outQueueCol.FreeTensor(colLocal);
+    outQueueCrow.FreeTensor(crowLocal);
+}
+} // namespace OneHotV2
+
+#endif // ONE_HOT_V2_H
@@ -0,0 +1,186 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file test_one_hot_v2_tiling.cpp
+ * \brief
+ */
+
+#include <iostream>
+#include <vector>
+#include <gtest/gtest.h>
+#include "../../../op_host/one_hot_v2_tiling.h"
+#include "tiling_context_faker.h"
+#include "tiling_case_executor.h"
+
+class OneHotV2Tiling : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        std::cout << "OneHotV2Tiling SetUp" << std::endl;
+    }
+    static void TearDownTestCase()
+    {
+        std::cout << "OneHotV2Tiling TearDown" << std::endl;
+    }
+};
+
+TEST_F(OneHotV2Tiling, one_hot_v2_tiling_dense_float)
+{
+    optiling::OneHotV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "OneHotV2",
+        {
+            {{{1024}, {1024}}, ge::DT_INT32, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{1024, 1000}, {1024, 1000}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{0}, {0}}, ge::DT_INT64, ge::FORMAT_ND},
+            {{{0}, {0}}, ge::DT_INT64, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("depth", Ops::Math::AnyValue::CreateFrom<int64_t>(1000)),
+         gert::TilingContextPara::OpAttr("row_stride", Ops::Math::AnyValue::CreateFrom<int64_t>(0)),
+         gert::TilingContextPara::OpAttr("label_smoothing", Ops::Math::AnyValue::CreateFrom<float>(0.0f)),
+         gert::TilingContextPara::OpAttr("sparse", Ops::Math::AnyValue::CreateFrom<bool>(false))},
+        &compileInfo);
+    uint64_t expectTilingKey = 1;
+    std::string expectTilingData = "1024 1000 1000 1 43 1 0 4294967296024 43 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(OneHotV2Tiling, one_hot_v2_tiling_dense_large_depth_float16)
+{
+    // depth超过单行预算时按列切块，每块一行
+    optiling::OneHotV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "OneHotV2",
+        {
+            {{{100}, {100}}, ge::DT_INT64, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+        },
+        {
+            {{{100, 200000}, {100, 200000}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{0}, {0}}, ge::DT_INT64, ge::FORMAT_ND},
+            {{{0}, {0}}, ge::DT_INT64, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("depth", Ops::Math::AnyValue::CreateFrom<int64_t>(200000)),
+         gert::TilingContextPara::OpAttr("row_stride", Ops::Math::AnyValue::CreateFrom<int64_t>(0)),
+         gert::TilingContextPara::OpAttr("label_smoothing", Ops::Math::AnyValue::CreateFrom<float>(0.1f)),
+         gert::TilingContextPara::OpAttr("sparse", Ops::Math::AnyValue::CreateFrom<bool>(false))},
+        &compileInfo);
+    uint64_t expectTilingKey = 12;
+    std::string expectTilingData = "100 200000 200000 9 900 14 4 105003360452609 4453159312402939968 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(OneHotV2Tiling, one_hot_v2_tiling_dense_row_stride_int32)
+{
+    // 输出视图行间隔1024大于depth，kernel按行间隔写入
+    optiling::OneHotV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "OneHotV2",
+        {
+            {{{8, 16}, {8, 16}}, ge::DT_INT32, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_INT32, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_INT32, ge::FORMAT_ND},
+        },
+        {
+            {{{8, 16, 1000}, {8, 16, 1000}}, ge::DT_INT32, ge::FORMAT_ND},
+            {{{0}, {0}}, ge::DT_INT64, ge::FORMAT_ND},
+            {{{0}, {0}}, ge::DT_INT64, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("depth", Ops::Math::AnyValue::CreateFrom<int64_t>(1000)),
+         gert::TilingContextPara::OpAttr("row_stride", Ops::Math::AnyValue::CreateFrom<int64_t>(1024)),
+         gert::TilingContextPara::OpAttr("label_smoothing", Ops::Math::AnyValue::CreateFrom<float>(0.0f)),
+         gert::TilingContextPara::OpAttr("sparse", Ops::Math::AnyValue::CreateFrom<bool>(false))},
+        &compileInfo);
+    uint64_t expectTilingKey = 3;
+    std::string expectTilingData = "128 1000 1024 1 6 1 0 4294967296024 6 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(OneHotV2Tiling, one_hot_v2_tiling_sparse_float)
+{
+    optiling::OneHotV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "OneHotV2",
+        {
+            {{{1000000}, {1000000}}, ge::DT_INT64, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{1000000}, {1000000}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{1000000}, {1000000}}, ge::DT_INT64, ge::FORMAT_ND},
+            {{{1000001}, {1000001}}, ge::DT_INT64, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("depth", Ops::Math::AnyValue::CreateFrom<int64_t>(100000)),
+         gert::TilingContextPara::OpAttr("row_stride", Ops::Math::AnyValue::CreateFrom<int64_t>(0)),
+         gert::TilingContextPara::OpAttr("label_smoothing", Ops::Math::AnyValue::CreateFrom<float>(0.0f)),
+         gert::TilingContextPara::OpAttr("sparse", Ops::Math::AnyValue::CreateFrom<bool>(true))},
+        &compileInfo);
+    uint64_t expectTilingKey = 111;
+    std::string expectTilingData = "1000000 100000 100000 1 287 4 31 3488 64 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(OneHotV2Tiling, one_hot_v2_tiling_row_stride_less_than_depth)
+{
+    optiling::OneHotV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "OneHotV2",
+        {
+            {{{16}, {16}}, ge::DT_INT32, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{16, 100}, {16, 100}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{0}, {0}}, ge::DT_INT64, ge::FORMAT_ND},
+            {{{0}, {0}}, ge::DT_INT64, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("depth", Ops::Math::AnyValue::CreateFrom<int64_t>(100)),
+         gert::TilingContextPara::OpAttr("row_stride", Ops::Math::AnyValue::CreateFrom<int64_t>(64)),
+         gert::TilingContextPara::OpAttr("label_smoothing", Ops::Math::AnyValue::CreateFrom<float>(0.0f)),
+         gert::TilingContextPara::OpAttr("sparse", Ops::Math::AnyValue::CreateFrom<bool>(false))},
+        &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
+
+TEST_F(OneHotV2Tiling, one_hot_v2_tiling_label_smoothing_int32)
+{
+    optiling::OneHotV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "OneHotV2",
+        {
+            {{{16}, {16}}, ge::DT_INT32, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_INT32, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_INT32, ge::FORMAT_ND},
+        },
+        {
+            {{{16, 100}, {16, 100}}, ge::DT_INT32, ge::FORMAT_ND},
+            {{{0}, {0}}, ge::DT_INT64, ge::FORMAT_ND},
+            {{{0}, {0}}, ge::DT_INT64, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("depth", Ops::Math::AnyValue::CreateFrom<int64_t>(100)),
+         gert::TilingContextPara::OpAttr("row_stride", Ops::Math::AnyValue::CreateFrom<int64_t>(0)),
+         gert::TilingContextPara::OpAttr("label_smoothing", Ops::Math::AnyValue::CreateFrom<float>(0.1f)),
+         gert::TilingContextPara::OpAttr("sparse", Ops::Math::AnyValue::CreateFrom<bool>(false))},
+        &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
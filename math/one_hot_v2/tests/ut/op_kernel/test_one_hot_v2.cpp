@@ -0,0 +1,210 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+/*!
+ * \file test_one_hot_v2.cpp
+ * \brief
+ */
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <vector>
+#include "gtest/gtest.h"
+#include "tikicpulib.h"
+#include "data_utils.h"
+
+using namespace std;
+
+extern "C" __global__ __aicore__ void one_hot_v2(
+    GM_ADDR x, GM_ADDR onValue, GM_ADDR offValue, GM_ADDR y, GM_ADDR colIndices, GM_ADDR crowIndices,
+    GM_ADDR workspace, GM_ADDR tiling);
+
+class one_hot_v2_test : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        cout << "one_hot_v2_test SetUp\n" << endl;
+    }
+    static void TearDownTestCase()
+    {
+        cout << "one_hot_v2_test TearDown\n" << endl;
+    }
+};
+
+static constexpr size_t WORKSPACE_SIZE = 16 * 1024 * 1024;
+
+static void InitTilingData(
+    OneHotV2TilingData* tilingData, uint64_t rowNum, uint64_t depth, uint64_t rowStride, uint32_t rowsPerTile,
+    uint32_t colTileLen, uint32_t blockDim, float labelSmoothing)
+{
+    uint64_t colTileNum = colTileLen == 0 ? 1 : (depth + colTileLen - 1) / colTileLen;
+    uint64_t tileNum = (rowNum + rowsPerTile - 1) / rowsPerTile * colTileNum;
+    tilingData->rowNum = rowNum;
+    tilingData->depth = depth;
+    tilingData->rowStride = rowStride;
+    tilingData->colTileNum = colTileNum;
+    tilingData->tileNum = tileNum;
+    tilingData->tilesPerCore = tileNum / blockDim;
+    tilingData->tailTiles = tileNum % blockDim;
+    tilingData->rowsPerTile = rowsPerTile;
+    tilingData->colTileLen = colTileLen;
+    tilingData->usedCoreNum = blockDim;
+    tilingData->labelSmoothing = labelSmoothing;
+}
+
+TEST_F(one_hot_v2_test, test_dense_float_row_stride)
+{
+    // 行间隔40大于depth 35，列按16切块；行间空隙保持原值，越界与负索引整行为off值
+    uint64_t rowNum = 20;
+    uint64_t depth = 35;
+    uint64_t rowStride = 40;
+    uint32_t blockDim = 3;
+    size_t outLen = (rowNum - 1) * rowStride + depth;
+    uint8_t* x = (uint8_t*)AscendC::GmAlloc(rowNum * sizeof(int32_t));
+    uint8_t* onValue = (uint8_t*)AscendC::GmAlloc(32);
+    uint8_t* offValue = (uint8_t*)AscendC::GmAlloc(32);
+    uint8_t* y = (uint8_t*)AscendC::GmAlloc(outLen * sizeof(float));
+    uint8_t* unused = (uint8_t*)AscendC::GmAlloc(32);
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(WORKSPACE_SIZE);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(sizeof(OneHotV2TilingData));
+
+    int32_t* xData = reinterpret_cast<int32_t*>(x);
+    for (uint64_t i = 0; i < rowNum; i++) {
+        xData[i] = static_cast<int32_t>((i * 7) % (depth + 5)) - 2;
+    }
+    reinterpret_cast<float*>(onValue)[0] = 3.0f;
+    reinterpret_cast<float*>(offValue)[0] = -1.0f;
+    float* yData = reinterpret_cast<float*>(y);
+    for (size_t i = 0; i < outLen; i++) {
+        yData[i] = 100.0f;
+    }
+
+    OneHotV2TilingData* tilingData = reinterpret_cast<OneHotV2TilingData*>(tiling);
+    InitTilingData(tilingData, rowNum, depth, rowStride, 6, 16, blockDim, 0.0f);
+
+    ICPU_SET_TILING_KEY(1);
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_RUN_KF(one_hot_v2, blockDim, x, onValue, offValue, y, unused, unused, workspace, (uint8_t*)(tilingData));
+
+    for (uint64_t r = 0; r < rowNum; r++) {
+        for (uint64_t c = 0; c < rowStride && r * rowStride + c < outLen; c++) {
+            float expect = c >= depth ? 100.0f : (xData[r] == static_cast<int32_t>(c) ? 3.0f : -1.0f);
+            EXPECT_EQ(yData[r * rowStride + c], expect);
+        }
+    }
+
+    AscendC::GmFree(x);
+    AscendC::GmFree(onValue);
+    AscendC::GmFree(offValue);
+    AscendC::GmFree(y);
+    AscendC::GmFree(unused);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+}
+
+TEST_F(one_hot_v2_test, test_dense_float16_label_smoothing)
+{
+    // on = 1, off = 0, eps = 0.2, depth = 10：on' = 0.82, off' = 0.02
+    uint64_t rowNum = 8;
+    uint64_t depth = 10;
+    uint32_t blockDim = 2;
+    uint8_t* x = (uint8_t*)AscendC::GmAlloc(rowNum * sizeof(int64_t));
+    uint8_t* onValue = (uint8_t*)AscendC::GmAlloc(32);
+    uint8_t* offValue = (uint8_t*)AscendC::GmAlloc(32);
+    uint8_t* y = (uint8_t*)AscendC::GmAlloc(rowNum * depth * sizeof(half));
+    uint8_t* unused = (uint8_t*)AscendC::GmAlloc(32);
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(WORKSPACE_SIZE);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(sizeof(OneHotV2TilingData));
+
+    int64_t* xData = reinterpret_cast<int64_t*>(x);
+    for (uint64_t i = 0; i < rowNum; i++) {
+        xData[i] = static_cast<int64_t>(i % depth);
+    }
+    reinterpret_cast<half*>(onValue)[0] = static_cast<half>(1.0f);
+    reinterpret_cast<half*>(offValue)[0] = static_cast<half>(0.0f);
+
+    OneHotV2TilingData* tilingData = reinterpret_cast<OneHotV2TilingData*>(tiling);
+    InitTilingData(tilingData, rowNum, depth, depth, 4, 16, blockDim, 0.2f);
+
+    ICPU_SET_TILING_KEY(12);
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_RUN_KF(one_hot_v2, blockDim, x, onValue, offValue, y, unused, unused, workspace, (uint8_t*)(tilingData));
+
+    half* yData = reinterpret_cast<half*>(y);
+    for (uint64_t r = 0; r < rowNum; r++) {
+        for (uint64_t c = 0; c < depth; c++) {
+            float expect = xData[r] == static_cast<int64_t>(c) ? 0.82f : 0.02f;
+            EXPECT_NEAR(static_cast<float>(yData[r * depth + c]), expect, 1e-3f);
+        }
+    }
+
+    AscendC::GmFree(x);
+    AscendC::GmFree(onValue);
+    AscendC::GmFree(offValue);
+    AscendC::GmFree(y);
+    AscendC::GmFree(unused);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+}
+
+TEST_F(one_hot_v2_test, test_sparse_int32)
+{
+    // 稀疏输出与depth无关；越界索引输出(0, off值)，crow_indices为0..n
+    uint64_t rowNum = 50;
+    uint64_t depth = 100000;
+    uint32_t blockDim = 4;
+    uint8_t* x = (uint8_t*)AscendC::GmAlloc(rowNum * sizeof(int32_t));
+    uint8_t* onValue = (uint8_t*)AscendC::GmAlloc(32);
+    uint8_t* offValue = (uint8_t*)AscendC::GmAlloc(32);
+    uint8_t* values = (uint8_t*)AscendC::GmAlloc(rowNum * sizeof(int32_t));
+    uint8_t* colIndices = (uint8_t*)AscendC::GmAlloc(rowNum * sizeof(int64_t));
+    uint8_t* crowIndices = (uint8_t*)AscendC::GmAlloc((rowNum + 1) * sizeof(int64_t));
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(WORKSPACE_SIZE);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(sizeof(OneHotV2TilingData));
+
+    int32_t* xData = reinterpret_cast<int32_t*>(x);
+    for (uint64_t i = 0; i < rowNum; i++) {
+        xData[i] = i % 10 == 9 ? static_cast<int32_t>(depth) : static_cast<int32_t>(i * 1999);
+    }
+    reinterpret_cast<int32_t*>(onValue)[0] = 5;
+    reinterpret_cast<int32_t*>(offValue)[0] = 0;
+
+    OneHotV2TilingData* tilingData = reinterpret_cast<OneHotV2TilingData*>(tiling);
+    InitTilingData(tilingData, rowNum, depth, depth, 16, 0, blockDim, 0.0f);
+
+    ICPU_SET_TILING_KEY(103);
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_RUN_KF(
+        one_hot_v2, blockDim, x, onValue, offValue, values, colIndices, crowIndices, workspace,
+        (uint8_t*)(tilingData));
+
+    int32_t* valueData = reinterpret_cast<int32_t*>(values);
+    int64_t* colData = reinterpret_cast<int64_t*>(colIndices);
+    int64_t* crowData = reinterpret_cast<int64_t*>(crowIndices);
+    for (uint64_t i = 0; i < rowNum; i++) {
+        bool valid = xData[i] < static_cast<int32_t>(depth);
+        EXPECT_EQ(colData[i], valid ? static_cast<int64_t>(xData[i]) : 0);
+        EXPECT_EQ(valueData[i], valid ? 5 : 0);
+    }
+    for (uint64_t i = 0; i <= rowNum; i++) {
+        EXPECT_EQ(crowData[i], static_cast<int64_t>(i));
+    }
+
+    AscendC::GmFree(x);
+    AscendC::GmFree(onValue);
+    AscendC::GmFree(offValue);
+    AscendC::GmFree(values);
+    AscendC::GmFree(colIndices);
+    AscendC::GmFree(crowIndices);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+}
@@ -120,6 +120,14 @@ aclnnStatus aclnnPdistGetWorkspaceSize(
         // 固定写法，将输入self转换成连续的tensor
         auto selfContiguous = l0op::Contiguous(self, uniqueExecutor.get());
         CHECK_RET(selfContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        // out连续时kernel直接按压缩上三角布局写入out
+        if (IsContiguous(out)) {
+            PdistOutRet = l0op::Pdist(selfContiguous, p, out, uniqueExecutor.get());
+            CHECK_RET(PdistOutRet != nullptr, ACLNN_ERR_INNER_NULLPTR);
+            *workspaceSize = uniqueExecutor->GetWorkspaceSize();
+            uniqueExecutor.ReleaseTo(executor);
+            return ACLNN_SUCCESS;
+        }
         // 执行L0 Pdist算子
         PdistOutRet = l0op::Pdist(selfContiguous, p, uniqueExecutor.get());
     }
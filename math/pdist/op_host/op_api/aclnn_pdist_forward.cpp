@@ -146,8 +146,15 @@ aclnnStatus aclnnPdistForwardGetWorkspaceSize(
     auto selfContiguous = l0op::Contiguous(self, uniqueExecutor.get());
     CHECK_RET(selfContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
-    // 调用Pdist算子kernel
+    // 调用Pdist算子kernel，out连续且dtype一致时直接写入out
     float pVal = CalculateValP(pScalar);
+    if (IsContiguous(out) && out->GetDataType() == selfContiguous->GetDataType()) {
+        auto pdistOut = l0op::Pdist(selfContiguous, pVal, out, uniqueExecutor.get());
+        CHECK_RET(pdistOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        *workspaceSize = uniqueExecutor->GetWorkspaceSize();
+        uniqueExecutor.ReleaseTo(executor);
+        return ACLNN_SUCCESS;
+    }
     auto pdistOut = l0op::Pdist(selfContiguous, pVal, uniqueExecutor.get());
     CHECK_RET(pdistOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
@@ -21,16 +21,23 @@ using namespace op;
 
 namespace l0op {
 OP_TYPE_REGISTER(Pdist);
-const aclTensor* Pdist(const aclTensor* self, float p, aclOpExecutor* executor)
+
+const aclTensor* Pdist(const aclTensor* self, float p, const aclTensor* out, aclOpExecutor* executor)
 {
-    L0_DFX(Pdist, self, p);
-    auto pdistOut = executor->AllocTensor(self->GetDataType(), op::Format::FORMAT_ND, op::Format::FORMAT_ND);
-    CHECK_RET(pdistOut != nullptr, nullptr);
-    INFER_SHAPE(Pdist, OP_INPUT(self), OP_OUTPUT(pdistOut), OP_ATTR(p));
-    auto ret = ADD_TO_LAUNCHER_LIST_AICORE(Pdist, OP_INPUT(self), OP_ATTR(p), OP_OUTPUT(pdistOut));
+    L0_DFX(Pdist, self, p, out);
+    auto ret = ADD_TO_LAUNCHER_LIST_AICORE(Pdist, OP_INPUT(self), OP_ATTR(p), OP_OUTPUT(out));
     OP_CHECK(
         ret == ACLNN_SUCCESS, OP_LOGE(ACLNN_ERR_INNER_NULLPTR, "PdistAiCore ADD_TO_LAUNCHER_LIST_AICORE failed."),
         return nullptr);
-    return pdistOut;
+    return out;
+}
+
+const aclTensor* Pdist(const aclTensor* self, float p, aclOpExecutor* executor)
+{
+    int64_t rowNum = self->GetViewShape().GetDim(0);
+    op::Shape outShape = {rowNum * (rowNum - 1) / 2};
+    auto pdistOut = executor->AllocTensor(outShape, self->GetDataType(), op::Format::FORMAT_ND);
+    CHECK_RET(pdistOut != nullptr, nullptr);
+    return Pdist(self, p, pdistOut, executor);
 }
 } // namespace l0op
\ No newline at end of file
@@ -15,6 +15,8 @@
 
 namespace l0op {
 const aclTensor* Pdist(const aclTensor* input, float p, aclOpExecutor* executor);
+// 结果直接写入out，out须为连续的一维tensor，长度为N * (N - 1) / 2
+const aclTensor* Pdist(const aclTensor* input, float p, const aclTensor* out, aclOpExecutor* executor);
 }
 
 #endif
@@ -0,0 +1,240 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file pdist_tiling.cpp
+ * \brief
+ */
+#include <algorithm>
+#include <cmath>
+#include "pdist_tiling.h"
+#include "log/log.h"
+#include "register/op_def_registry.h"
+#include "tiling_base/tiling_templates_registry.h"
+#include "platform/platform_info.h"
+
+namespace optiling {
+constexpr int32_t X_INPUT_INDEX = 0;
+constexpr size_t P_ATTR_INDEX = 0;
+constexpr size_t X_DIM_NUM = 2;
+constexpr uint32_t P_MODE_GENERAL = 0;
+constexpr uint32_t P_MODE_ONE = 1;
+constexpr uint32_t P_MODE_TWO = 2;
+constexpr uint32_t P_MODE_INF = 3;
+constexpr uint32_t P_MODE_ZERO = 4;
+constexpr uint64_t GRAM_KEY_OFFSET = 10;
+constexpr uint64_t GRAM_MIN_COLS = 64;  // M较小时cube的K方向利用率低，且展开式有相消误差，直接走vector
+constexpr uint32_t GRAM_BLOCK = 128;
+constexpr uint32_t VEC_BLOCK = 64;
+constexpr uint32_t COL_ALIGN = 16;      // fp16与fp32下UB内行长都按32B对齐
+constexpr uint32_t GRAM_NORM_COLS = 4096;
+constexpr uint32_t FLOAT_BYTES = 4;
+constexpr uint32_t BRCB_BLOCK = 8;
+constexpr uint32_t RESERVED_UB = 1024;
+constexpr uint32_t WORKSPACE_ALIGN = 512;
+constexpr uint32_t AIV_PER_AIC = 2;
+
+struct PdistDtypeKey {
+    ge::DataType dtype;
+    uint64_t tilingKey;
+};
+
+static const PdistDtypeKey DTYPE_KEYS[] = {
+    {ge::DT_FLOAT, 1},
+    {ge::DT_FLOAT16, 2},
+};
+
+static inline uint64_t CeilDiv(uint64_t a, uint64_t b)
+{
+    return b == 0 ? a : (a + b - 1) / b;
+}
+
+static inline uint64_t CeilAlign(uint64_t a, uint64_t b)
+{
+    return CeilDiv(a, b) * b;
+}
+
+static uint32_t GetPMode(float p)
+{
+    if (p == 0.0f) {
+        return P_MODE_ZERO;
+    }
+    if (p == 1.0f) {
+        return P_MODE_ONE;
+    }
+    if (p == 2.0f) {
+        return P_MODE_TWO;
+    }
+    if (std::isinf(p)) {
+        return P_MODE_INF;
+    }
+    return P_MODE_GENERAL;
+}
+
+// vector路径：xi/xj及其转置、Gather偏移表按colFactor线性增长，其余为64x64的累加、差值、错位与输出块
+static uint32_t CalcVectorColFactor(uint64_t m, uint32_t typeSize, uint32_t ubSize)
+{
+    uint64_t tileElems = static_cast<uint64_t>(VEC_BLOCK) * VEC_BLOCK;
+    uint64_t castBytes = typeSize == FLOAT_BYTES ? 0 : typeSize;
+    uint64_t fixedBytes = tileElems * FLOAT_BYTES * 3 + tileElems * castBytes + VEC_BLOCK * BRCB_BLOCK * FLOAT_BYTES +
+                          VEC_BLOCK * FLOAT_BYTES * 2;
+    uint64_t perColBytes = VEC_BLOCK * (FLOAT_BYTES * 5 + castBytes * 2);
+    if (ubSize <= RESERVED_UB + fixedBytes) {
+        return 0;
+    }
+    uint64_t maxCols = (ubSize - RESERVED_UB - fixedBytes) / perColBytes / COL_ALIGN * COL_ALIGN;
+    return static_cast<uint32_t>(std::min(CeilAlign(m, COL_ALIGN), maxCols));
+}
+
+static ge::graphStatus SetMatmulTiling(
+    gert::TilingContext* context, ge::DataType dtype, uint64_t m, PdistTilingData& tilingData)
+{
+    matmul_tiling::DataType mmDtype =
+        dtype == ge::DT_FLOAT ? matmul_tiling::DataType::DT_FLOAT : matmul_tiling::DataType::DT_FLOAT16;
+    matmul_tiling::MatmulApiTiling tilingApi;
+    tilingApi.SetAType(matmul_tiling::TPosition::GM, CubeFormat::ND, mmDtype, false);
+    tilingApi.SetBType(matmul_tiling::TPosition::GM, CubeFormat::ND, mmDtype, true);
+    tilingApi.SetCType(matmul_tiling::TPosition::GM, CubeFormat::ND, matmul_tiling::DataType::DT_FLOAT);
+    tilingApi.SetBiasType(matmul_tiling::TPosition::GM, CubeFormat::ND, matmul_tiling::DataType::DT_FLOAT);
+    tilingApi.SetOrgShape(GRAM_BLOCK, GRAM_BLOCK, static_cast<int32_t>(m));
+    tilingApi.SetShape(GRAM_BLOCK, GRAM_BLOCK, static_cast<int32_t>(m));
+    tilingApi.SetBias(false);
+    tilingApi.SetBufferSpace(-1, -1, -1);
+    tilingData.mmTilingData.set_usedCoreNum(1);
+    OP_CHECK_IF(
+        tilingApi.GetTiling(tilingData.mmTilingData) == -1,
+        OP_LOGE(context->GetNodeName(), "Get matmul tiling failed."), return ge::GRAPH_FAILED);
+    return ge::GRAPH_SUCCESS;
+}
+
+static void PrintTilingData(gert::TilingContext* context, PdistTilingData& tilingData)
+{
+    const ge::char_t* nodeName = context->GetNodeName();
+    OP_LOGD(nodeName, "n: %lu, m: %lu", tilingData.get_n(), tilingData.get_m());
+    OP_LOGD(nodeName, "tileNum: %lu", tilingData.get_tileNum());
+    OP_LOGD(nodeName, "tilesPerCore: %lu", tilingData.get_tilesPerCore());
+    OP_LOGD(nodeName, "tailTiles: %lu", tilingData.get_tailTiles());
+    OP_LOGD(nodeName, "p: %f, pMode: %u", tilingData.get_p(), tilingData.get_pMode());
+    OP_LOGD(nodeName, "blockRows: %u", tilingData.get_blockRows());
+    OP_LOGD(nodeName, "blockNum: %u", tilingData.get_blockNum());
+    OP_LOGD(nodeName, "colFactor: %u", tilingData.get_colFactor());
+    OP_LOGD(nodeName, "usedCoreNum: %u", tilingData.get_usedCoreNum());
+}
+
+static ge::graphStatus Tiling4Pdist(gert::TilingContext* context)
+{
+    OP_LOGI(context->GetNodeName(), "Pdist tiling starts running");
+    auto compileInfo = reinterpret_cast<const PdistCompileInfo*>(context->GetCompileInfo());
+    OP_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    OP_CHECK_IF(
+        compileInfo->vectorCoreNum <= 0 || compileInfo->ubByteSize <= RESERVED_UB,
+        OP_LOGE(context->GetNodeName(), "Failed to get core num or ub size."), return ge::GRAPH_FAILED);
+
+    auto xDesc = context->GetInputDesc(X_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, xDesc);
+    ge::DataType dtype = xDesc->GetDataType();
+    uint64_t tilingKey = 0;
+    for (const auto& item : DTYPE_KEYS) {
+        if (item.dtype == dtype) {
+            tilingKey = item.tilingKey;
+        }
+    }
+    OP_CHECK_IF(
+        tilingKey == 0, OP_LOGE(context->GetNodeName(), "dtype is not supported."), return ge::GRAPH_FAILED);
+
+    auto xShape = context->GetInputShape(X_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, xShape);
+    const gert::Shape& shape = xShape->GetStorageShape();
+    OP_CHECK_IF(
+        shape.GetDimNum() != X_DIM_NUM, OP_LOGE(context->GetNodeName(), "x should be 2D."), return ge::GRAPH_FAILED);
+    int64_t n = shape.GetDim(0);
+    int64_t m = shape.GetDim(1);
+    OP_CHECK_IF(
+        n < 2 || m < 1, OP_LOGE(context->GetNodeName(), "x should have at least 2 rows and 1 column."),
+        return ge::GRAPH_FAILED);
+
+    const gert::RuntimeAttrs* attrs = context->GetAttrs();
+    OP_CHECK_NULL_WITH_CONTEXT(context, attrs);
+    const float* pPtr = attrs->GetAttrPointer<float>(P_ATTR_INDEX);
+    float p = pPtr == nullptr ? 2.0f : *pPtr;
+    OP_CHECK_IF(
+        std::isnan(p) || p < 0.0f, OP_LOGE(context->GetNodeName(), "p should be non-negative."),
+        return ge::GRAPH_FAILED);
+
+    PdistTilingData tilingData;
+    uint32_t pMode = GetPMode(p);
+    bool useGram = pMode == P_MODE_TWO && static_cast<uint64_t>(m) >= GRAM_MIN_COLS;
+    uint32_t blockRows = useGram ? GRAM_BLOCK : VEC_BLOCK;
+    uint64_t blockNum = CeilDiv(n, blockRows);
+    uint64_t tileNum = blockNum * (blockNum + 1) / 2;
+    uint64_t usedCoreNum = std::min<uint64_t>(tileNum, compileInfo->vectorCoreNum);
+    uint32_t colFactor = useGram ?
+                             static_cast<uint32_t>(std::min<uint64_t>(CeilAlign(m, COL_ALIGN), GRAM_NORM_COLS)) :
+                             CalcVectorColFactor(m, ge::GetSizeByDataType(dtype), compileInfo->ubByteSize);
+    OP_CHECK_IF(
+        colFactor == 0, OP_LOGE(context->GetNodeName(), "ub size is too small."), return ge::GRAPH_FAILED);
+
+    tilingData.set_n(n);
+    tilingData.set_m(m);
+    tilingData.set_tileNum(tileNum);
+    tilingData.set_tilesPerCore(tileNum / usedCoreNum);
+    tilingData.set_tailTiles(tileNum % usedCoreNum);
+    tilingData.set_p(p);
+    tilingData.set_pMode(pMode);
+    tilingData.set_blockRows(blockRows);
+    tilingData.set_blockNum(static_cast<uint32_t>(blockNum));
+    tilingData.set_colFactor(colFactor);
+    tilingData.set_usedCoreNum(static_cast<uint32_t>(usedCoreNum));
+
+    size_t* workspaces = context->GetWorkspaceSizes(1);
+    workspaces[0] = compileInfo->sysWorkspaceByteSize;
+    if (useGram) {
+        OP_CHECK_IF(
+            SetMatmulTiling(context, dtype, m, tilingData) != ge::GRAPH_SUCCESS,
+            OP_LOGE(context->GetNodeName(), "Set matmul tiling failed."), return ge::GRAPH_FAILED);
+        tilingKey += GRAM_KEY_OFFSET;
+        // 行平方范数，以及每核一块cube输出的Gram子块
+        workspaces[0] += CeilAlign(n * FLOAT_BYTES, WORKSPACE_ALIGN) +
+                         usedCoreNum * GRAM_BLOCK * GRAM_BLOCK * FLOAT_BYTES;
+    }
+
+    context->SetTilingKey(tilingKey);
+    // mix算子按AIC数下发，每个AIC带两个AIV
+    context->SetBlockDim(CeilDiv(usedCoreNum, AIV_PER_AIC));
+    tilingData.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tilingData.GetDataSize());
+    PrintTilingData(context, tilingData);
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus TilingPrepare4Pdist(gert::TilingParseContext* context)
+{
+    auto compileInfo = context->GetCompiledInfo<PdistCompileInfo>();
+    OP_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    auto platformInfo = context->GetPlatformInfo();
+    OP_CHECK_NULL_WITH_CONTEXT(context, platformInfo);
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(platformInfo);
+    compileInfo->vectorCoreNum = ascendcPlatform.GetCoreNumAiv();
+    OP_CHECK_IF(
+        (compileInfo->vectorCoreNum <= 0), OP_LOGE(context->GetNodeName(), "No vector core available."),
+        return ge::GRAPH_FAILED);
+    uint64_t ubByteSize;
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ubByteSize);
+    compileInfo->ubByteSize = ubByteSize;
+    OP_CHECK_IF(
+        (compileInfo->ubByteSize <= 0), OP_LOGE(context->GetNodeName(), "Failed to get ub size."),
+        return ge::GRAPH_FAILED);
+    compileInfo->sysWorkspaceByteSize = ascendcPlatform.GetLibApiWorkSpaceSize();
+    return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_OPTILING(Pdist).Tiling(Tiling4Pdist).TilingParse<PdistCompileInfo>(TilingPrepare4Pdist);
+} // namespace optiling
@@ -0,0 +1,45 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file pdist_tiling.h
+ * \brief
+ */
+#ifndef OPS_BUILT_IN_OP_TILING_RUNTIME_PDIST_H_
+#define OPS_BUILT_IN_OP_TILING_RUNTIME_PDIST_H_
+
+#include "register/tilingdata_base.h"
+#include "tiling/tiling_api.h"
+
+namespace optiling {
+BEGIN_TILING_DATA_DEF(PdistTilingData)
+TILING_DATA_FIELD_DEF(uint64_t, n);            // 行数N，输出长度为N * (N - 1) / 2
+TILING_DATA_FIELD_DEF(uint64_t, m);            // 每行元素数M
+TILING_DATA_FIELD_DEF(uint64_t, tileNum);      // 上三角(bi <= bj)块对的个数
+TILING_DATA_FIELD_DEF(uint64_t, tilesPerCore); // 每核处理的块对数
+TILING_DATA_FIELD_DEF(uint64_t, tailTiles);    // 前tailTiles个核多处理一个块对
+TILING_DATA_FIELD_DEF(float, p);
+TILING_DATA_FIELD_DEF(uint32_t, pMode);        // 0:一般p 1:p=1 2:p=2 3:p=inf 4:p=0
+TILING_DATA_FIELD_DEF(uint32_t, blockRows);    // 块的行数
+TILING_DATA_FIELD_DEF(uint32_t, blockNum);     // 行方向的块数
+TILING_DATA_FIELD_DEF(uint32_t, colFactor);    // M方向每次搬入的元素数
+TILING_DATA_FIELD_DEF(uint32_t, usedCoreNum);  // 参与计算的vector核数
+TILING_DATA_FIELD_DEF_STRUCT(TCubeTiling, mmTilingData);
+END_TILING_DATA_DEF;
+REGISTER_TILING_DATA_CLASS(Pdist, PdistTilingData)
+
+struct PdistCompileInfo {
+    uint32_t vectorCoreNum;
+    uint32_t sysWorkspaceByteSize;
+    uint32_t ubByteSize;
+};
+} // namespace optiling
+#endif // OPS_BUILT_IN_OP_TILING_RUNTIME_PDIST_H_
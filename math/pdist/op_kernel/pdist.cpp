@@ -0,0 +1,55 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file pdist.cpp
+ * \brief
+ */
+
+#include "kernel_operator.h"
+#include "pdist_vector.h"
+#include "pdist_gram.h"
+
+using namespace PdistND;
+
+#define PDIST_VECTOR_IMPL(INPUT_TYPE)      \
+    do {                                   \
+        TPipe pipe;                        \
+        PdistVector<INPUT_TYPE> op;        \
+        op.Init(x, y, &tilingData, &pipe); \
+        op.Process();                      \
+    } while (0)
+
+#define PDIST_GRAM_IMPL(INPUT_TYPE)                                                      \
+    do {                                                                                 \
+        TPipe pipe;                                                                      \
+        PdistGram<INPUT_TYPE> op;                                                        \
+        REGIST_MATMUL_OBJ(&pipe, GetSysWorkSpacePtr(), op.mm, &tilingData.mmTilingData); \
+        op.Init(x, y, usrWorkspace, &tilingData, &pipe);                                 \
+        op.Process();                                                                    \
+    } while (0)
+
+// mix算子：vector路径只在AIV上运行，Gram路径由AIC完成块对的矩阵乘
+extern "C" __global__ __aicore__ void pdist(GM_ADDR x, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling)
+{
+    KERNEL_TASK_TYPE_DEFAULT(KERNEL_TYPE_MIX_AIC_1_2);
+    GET_TILING_DATA(tilingData, tiling);
+    GM_ADDR usrWorkspace = GetUserWorkspace(workspace);
+    if (TILING_KEY_IS(1)) {
+        PDIST_VECTOR_IMPL(float);
+    } else if (TILING_KEY_IS(2)) {
+        PDIST_VECTOR_IMPL(half);
+    } else if (TILING_KEY_IS(11)) {
+        PDIST_GRAM_IMPL(float);
+    } else if (TILING_KEY_IS(12)) {
+        PDIST_GRAM_IMPL(half);
+    }
+}
@@ -0,0 +1,195 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file pdist_base.h
+ * \brief Pdist两条路径共用的块对划分与压缩上三角写出
+ *
+ * 行方向按blockRows切块，只枚举bi <= bj的块对并按行优先线性编号，各核领取连续的一段块对，下三角不参与计算。
+ * 块对(bi, bj)的结果以fp32放在UB内[rows][stride]的块中；(i, j)在输出中的位置为i * N - i * (i + 1) / 2 + j - i - 1，
+ * 同一行内连续，因此每行一次搬出。对角块只保留j > i的部分，先用Gather把每行错位到行首再搬出。
+ */
+#ifndef PDIST_BASE_H
+#define PDIST_BASE_H
+
+#include "kernel_operator.h"
+
+namespace PdistND {
+using namespace AscendC;
+
+constexpr uint32_t P_MODE_GENERAL = 0;
+constexpr uint32_t P_MODE_ONE = 1;
+constexpr uint32_t P_MODE_TWO = 2;
+constexpr uint32_t P_MODE_INF = 3;
+constexpr uint32_t P_MODE_ZERO = 4;
+constexpr uint32_t BYTE_BLOCK = 32;
+constexpr uint32_t FLOAT_PER_BLOCK = 8;
+constexpr uint32_t FLOAT_PER_REPEAT = 64;
+constexpr uint32_t BLOCK_PER_REPEAT = 8;
+
+template <typename T>
+class PdistBase {
+protected:
+    __aicore__ inline void InitBase(GM_ADDR x, GM_ADDR y, const PdistTilingData* tilingData, TPipe* pipeIn);
+    __aicore__ inline void InitWriteBuffers(uint32_t stride);
+    __aicore__ inline void LocateTile(uint64_t tileIdx, uint64_t& bi, uint64_t& bj);
+    __aicore__ inline void NextTile(uint64_t& bi, uint64_t& bj);
+    __aicore__ inline void WriteTile(
+        const LocalTensor<float>& accLocal, uint64_t bi, uint64_t bj, uint32_t rowsI, uint32_t rowsJ);
+
+    __aicore__ inline uint32_t BlockRows(uint64_t blockIdx)
+    {
+        uint64_t rest = n - blockIdx * blockRows;
+        return rest < blockRows ? static_cast<uint32_t>(rest) : blockRows;
+    }
+
+    __aicore__ inline uint64_t OutIndex(uint64_t i, uint64_t j)
+    {
+        return i * n - i * (i + 1) / 2 + j - i - 1;
+    }
+
+    template <HardEvent EVENT>
+    __aicore__ inline void SyncFlag()
+    {
+        event_t eventId = static_cast<event_t>(GetTPipePtr()->FetchEventID(EVENT));
+        SetFlag<EVENT>(eventId);
+        WaitFlag<EVENT>(eventId);
+    }
+
+protected:
+    TPipe* pipe = nullptr;
+    TBuf<QuePosition::VECCALC> shiftedBuf;
+    TBuf<QuePosition::VECCALC> outBuf;
+    TBuf<QuePosition::VECCALC> idxBuf;
+    TBuf<QuePosition::VECCALC> shiftBuf;
+    GlobalTensor<T> xGm;
+    GlobalTensor<T> yGm;
+
+    uint64_t n = 0;
+    uint64_t m = 0;
+    uint64_t tileStart = 0;
+    uint64_t tileCount = 0;
+    float p = 0.0f;
+    uint32_t pMode = 0;
+    uint32_t blockRows = 0;
+    uint32_t blockNum = 0;
+    uint32_t colFactor = 0;
+    uint32_t usedCoreNum = 0;
+    uint32_t stride = 0;
+    uint32_t coreIdx = 0;
+};
+
+template <typename T>
+__aicore__ inline void PdistBase<T>::InitBase(
+    GM_ADDR x, GM_ADDR y, const PdistTilingData* tilingData, TPipe* pipeIn)
+{
+    pipe = pipeIn;
+    n = tilingData->n;
+    m = tilingData->m;
+    p = tilingData->p;
+    pMode = tilingData->pMode;
+    blockRows = tilingData->blockRows;
+    blockNum = tilingData->blockNum;
+    colFactor = tilingData->colFactor;
+    usedCoreNum = tilingData->usedCoreNum;
+    coreIdx = GetBlockIdx();
+    uint64_t tailTiles = tilingData->tailTiles;
+    tileStart = coreIdx * tilingData->tilesPerCore + (coreIdx < tailTiles ? coreIdx : tailTiles);
+    tileCount = tilingData->tilesPerCore + (coreIdx < tailTiles ? 1 : 0);
+    xGm.SetGlobalBuffer((__gm__ T*)x);
+    yGm.SetGlobalBuffer((__gm__ T*)y);
+}
+
+// 累加块每行stride个fp32，错位块与之同形；idx为每行内的字节偏移0, 4, 8, ...
+template <typename T>
+__aicore__ inline void PdistBase<T>::InitWriteBuffers(uint32_t rowStride)
+{
+    stride = rowStride;
+    pipe->InitBuffer(shiftedBuf, stride * stride * sizeof(float));
+    if constexpr (!IsSameType<T, float>::value) {
+        pipe->InitBuffer(outBuf, stride * stride * sizeof(T));
+    }
+    pipe->InitBuffer(idxBuf, stride * sizeof(int32_t));
+    pipe->InitBuffer(shiftBuf, stride * sizeof(int32_t));
+    LocalTensor<int32_t> idxLocal = idxBuf.Get<int32_t>();
+    CreateVecIndex(idxLocal, static_cast<int32_t>(0), stride);
+    PipeBarrier<PIPE_V>();
+    Muls(idxLocal, idxLocal, static_cast<int32_t>(sizeof(float)), stride);
+    PipeBarrier<PIPE_V>();
+}
+
+// 第bi行块上有blockNum - bi个块对
+template <typename T>
+__aicore__ inline void PdistBase<T>::LocateTile(uint64_t tileIdx, uint64_t& bi, uint64_t& bj)
+{
+    bi = 0;
+    uint64_t rowTiles = blockNum;
+    while (tileIdx >= rowTiles) {
+        tileIdx -= rowTiles;
+        bi++;
+        rowTiles--;
+    }
+    bj = bi + tileIdx;
+}
+
+template <typename T>
+__aicore__ inline void PdistBase<T>::NextTile(uint64_t& bi, uint64_t& bj)
+{
+    bj++;
+    if (bj == blockNum) {
+        bi++;
+        bj = bi;
+    }
+}
+
+template <typename T>
+__aicore__ inline void PdistBase<T>::WriteTile(
+    const LocalTensor<float>& accLocal, uint64_t bi, uint64_t bj, uint32_t rowsI, uint32_t rowsJ)
+{
+    bool isDiag = bi == bj;
+    LocalTensor<float> srcLocal = accLocal;
+    if (isDiag) {
+        srcLocal = shiftedBuf.Get<float>();
+        LocalTensor<int32_t> idxLocal = idxBuf.Get<int32_t>();
+        LocalTensor<int32_t> shiftLocal = shiftBuf.Get<int32_t>();
+        LocalTensor<uint32_t> gatherOffset = shiftLocal.template ReinterpretCast<uint32_t>();
+        for (uint32_t r = 0; r + 1 < rowsJ && r < rowsI; r++) {
+            uint32_t count = rowsJ - r - 1;
+            Adds(shiftLocal, idxLocal, static_cast<int32_t>((r * stride + r + 1) * sizeof(float)), count);
+            PipeBarrier<PIPE_V>();
+            Gather(srcLocal[r * stride], accLocal, gatherOffset, static_cast<uint32_t>(0), count);
+            PipeBarrier<PIPE_V>();
+        }
+    }
+    LocalTensor<T> outLocal;
+    if constexpr (IsSameType<T, float>::value) {
+        outLocal = srcLocal;
+    } else {
+        outLocal = outBuf.Get<T>();
+        Cast(outLocal, srcLocal, RoundMode::CAST_RINT, rowsI * stride);
+    }
+    SyncFlag<HardEvent::V_MTE3>();
+    uint64_t colBase = bj * blockRows;
+    for (uint32_t r = 0; r < rowsI; r++) {
+        uint32_t cStart = isDiag ? r + 1 : 0;
+        if (cStart >= rowsJ) {
+            break;
+        }
+        uint64_t i = bi * blockRows + r;
+        DataCopyExtParams copyParams = {1, static_cast<uint32_t>((rowsJ - cStart) * sizeof(T)), 0, 0, 0};
+        DataCopyPad(yGm[OutIndex(i, colBase + cStart)], outLocal[r * stride], copyParams);
+    }
+    // 下一个块对会覆盖累加块与输出块
+    SyncFlag<HardEvent::MTE3_V>();
+}
+} // namespace PdistND
+
+#endif // PDIST_BASE_H
@@ -0,0 +1,218 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file pdist_gram.h
+ * \brief p=2的Gram路径：d(i, j) = sqrt(max(|xi|^2 + |xj|^2 - 2 * xi · xj, 0))
+ *
+ * 先由各核求出全部行的平方范数写入workspace，全核同步后逐个块对调用cube计算128x128的X[bi] · X[bj]^T，
+ * 结果以fp32写到本核独占的workspace块，vector搬入后用Brcb广播的行范数与按行复用的列范数完成收尾并直接写出。
+ */
+#ifndef PDIST_GRAM_H
+#define PDIST_GRAM_H
+
+#include "lib/matmul_intf.h"
+#include "pdist_base.h"
+
+namespace PdistND {
+using namespace matmul;
+
+constexpr uint32_t GRAM_BLOCK = 128;
+constexpr uint32_t REDUCE_WORK_BYTES = 1024;
+constexpr uint32_t WORKSPACE_ALIGN = 512;
+
+template <typename T>
+class PdistGram : public PdistBase<T> {
+public:
+    typedef MatmulType<AscendC::TPosition::GM, CubeFormat::ND, T> aType;
+    typedef MatmulType<AscendC::TPosition::GM, CubeFormat::ND, T, true> bType;
+    typedef MatmulType<AscendC::TPosition::GM, CubeFormat::ND, float> cType;
+    typedef MatmulType<AscendC::TPosition::GM, CubeFormat::ND, float> biasType;
+
+    Matmul<aType, bType, cType, biasType> mm;
+
+    __aicore__ inline PdistGram(){};
+    __aicore__ inline void Init(
+        GM_ADDR x, GM_ADDR y, GM_ADDR workspace, const PdistTilingData* tilingData, TPipe* pipeIn);
+    __aicore__ inline void Process();
+
+private:
+    __aicore__ inline void ComputeNorms();
+    __aicore__ inline float RowNorm(uint64_t row);
+    __aicore__ inline void ProcessTile(uint64_t bi, uint64_t bj);
+    __aicore__ inline void LoadTile(uint64_t bi, uint64_t bj, uint32_t rowsI, uint32_t rowsJ);
+
+private:
+    TBuf<QuePosition::VECCALC> accBuf;
+    TBuf<QuePosition::VECCALC> brcbBuf;
+    TBuf<QuePosition::VECCALC> normIBuf;
+    TBuf<QuePosition::VECCALC> normJBuf;
+    TBuf<QuePosition::VECCALC> workBuf;
+    TBuf<QuePosition::VECCALC> sumBuf;
+    GlobalTensor<float> normGm;
+    GlobalTensor<float> gramGm;
+};
+
+template <typename T>
+__aicore__ inline void PdistGram<T>::Init(
+    GM_ADDR x, GM_ADDR y, GM_ADDR workspace, const PdistTilingData* tilingData, TPipe* pipeIn)
+{
+    this->InitBase(x, y, tilingData, pipeIn);
+    uint64_t normBytes = (this->n * sizeof(float) + WORKSPACE_ALIGN - 1) / WORKSPACE_ALIGN * WORKSPACE_ALIGN;
+    normGm.SetGlobalBuffer((__gm__ float*)workspace, this->n);
+    gramGm.SetGlobalBuffer(
+        (__gm__ float*)(workspace + normBytes) + this->coreIdx * GRAM_BLOCK * GRAM_BLOCK, GRAM_BLOCK * GRAM_BLOCK);
+    if (this->coreIdx >= this->usedCoreNum) {
+        return;
+    }
+    this->pipe->InitBuffer(accBuf, GRAM_BLOCK * GRAM_BLOCK * sizeof(float));
+    this->pipe->InitBuffer(brcbBuf, GRAM_BLOCK * FLOAT_PER_BLOCK * sizeof(float));
+    this->pipe->InitBuffer(normIBuf, GRAM_BLOCK * sizeof(float));
+    this->pipe->InitBuffer(normJBuf, GRAM_BLOCK * sizeof(float));
+    this->pipe->InitBuffer(workBuf, REDUCE_WORK_BYTES);
+    this->pipe->InitBuffer(sumBuf, BYTE_BLOCK);
+    this->InitWriteBuffers(GRAM_BLOCK);
+    mm.SetOrgShape(GRAM_BLOCK, GRAM_BLOCK, static_cast<int32_t>(this->m));
+}
+
+template <typename T>
+__aicore__ inline void PdistGram<T>::Process()
+{
+    if (this->coreIdx < this->usedCoreNum) {
+        ComputeNorms();
+    }
+    SyncAll();
+    if (this->coreIdx >= this->usedCoreNum) {
+        return;
+    }
+    uint64_t bi = 0;
+    uint64_t bj = 0;
+    this->LocateTile(this->tileStart, bi, bj);
+    for (uint64_t t = 0; t < this->tileCount; t++) {
+        ProcessTile(bi, bj);
+        this->NextTile(bi, bj);
+    }
+    mm.End();
+}
+
+// 各核连续分担若干行，每GRAM_BLOCK行攒满后一次写出
+template <typename T>
+__aicore__ inline void PdistGram<T>::ComputeNorms()
+{
+    uint64_t rowsPerCore = (this->n + this->usedCoreNum - 1) / this->usedCoreNum;
+    uint64_t rowStart = this->coreIdx * rowsPerCore;
+    uint64_t rowEnd = rowStart + rowsPerCore < this->n ? rowStart + rowsPerCore : this->n;
+    LocalTensor<float> normLocal = normIBuf.Get<float>();
+    for (uint64_t rowBase = rowStart; rowBase < rowEnd; rowBase += GRAM_BLOCK) {
+        uint32_t rows = rowEnd - rowBase < GRAM_BLOCK ? static_cast<uint32_t>(rowEnd - rowBase) : GRAM_BLOCK;
+        for (uint32_t r = 0; r < rows; r++) {
+            normLocal.SetValue(r, RowNorm(rowBase + r));
+        }
+        this->template SyncFlag<HardEvent::S_MTE3>();
+        DataCopyExtParams copyParams = {1, static_cast<uint32_t>(rows * sizeof(float)), 0, 0, 0};
+        DataCopyPad(normGm[rowBase], normLocal, copyParams);
+        this->template SyncFlag<HardEvent::MTE3_S>();
+    }
+}
+
+// 搬入与平方复用acc与错位块的空间，colFactor不超过4096
+template <typename T>
+__aicore__ inline float PdistGram<T>::RowNorm(uint64_t row)
+{
+    LocalTensor<T> inLocal = accBuf.Get<T>();
+    LocalTensor<float> sqLocal = this->shiftedBuf.template Get<float>();
+    LocalTensor<float> workLocal = workBuf.Get<float>();
+    LocalTensor<float> sumLocal = sumBuf.Get<float>();
+    DataCopyPadExtParams<T> padParams = {false, 0, 0, static_cast<T>(0)};
+    float sum = 0.0f;
+    for (uint64_t colStart = 0; colStart < this->m; colStart += this->colFactor) {
+        uint64_t rest = this->m - colStart;
+        uint32_t cols = rest < this->colFactor ? static_cast<uint32_t>(rest) : this->colFactor;
+        DataCopyExtParams copyParams = {1, static_cast<uint32_t>(cols * sizeof(T)), 0, 0, 0};
+        DataCopyPad(inLocal, this->xGm[row * this->m + colStart], copyParams, padParams);
+        this->template SyncFlag<HardEvent::MTE2_V>();
+        if constexpr (IsSameType<T, float>::value) {
+            Mul(sqLocal, inLocal, inLocal, cols);
+        } else {
+            Cast(sqLocal, inLocal, RoundMode::CAST_NONE, cols);
+            PipeBarrier<PIPE_V>();
+            Mul(sqLocal, sqLocal, sqLocal, cols);
+        }
+        PipeBarrier<PIPE_V>();
+        ReduceSum<float>(sumLocal, sqLocal, workLocal, cols);
+        this->template SyncFlag<HardEvent::V_S>();
+        sum += sumLocal.GetValue(0);
+        this->template SyncFlag<HardEvent::V_MTE2>();
+    }
+    return sum;
+}
+
+template <typename T>
+__aicore__ inline void PdistGram<T>::LoadTile(uint64_t bi, uint64_t bj, uint32_t rowsI, uint32_t rowsJ)
+{
+    LocalTensor<float> accLocal = accBuf.Get<float>();
+    LocalTensor<float> normILocal = normIBuf.Get<float>();
+    LocalTensor<float> normJLocal = normJBuf.Get<float>();
+    DataCopyPadExtParams<float> padParams = {false, 0, 0, 0.0f};
+    DataCopyExtParams normIParams = {1, static_cast<uint32_t>(rowsI * sizeof(float)), 0, 0, 0};
+    DataCopyPad(normILocal, normGm[bi * GRAM_BLOCK], normIParams, padParams);
+    DataCopyExtParams normJParams = {1, static_cast<uint32_t>(rowsJ * sizeof(float)), 0, 0, 0};
+    DataCopyPad(normJLocal, normGm[bj * GRAM_BLOCK], normJParams, padParams);
+    uint32_t rowBytes = rowsJ * sizeof(float);
+    uint32_t dstStride = (GRAM_BLOCK * sizeof(float) - (rowBytes + BYTE_BLOCK - 1) / BYTE_BLOCK * BYTE_BLOCK) /
+                         BYTE_BLOCK;
+    DataCopyExtParams tileParams = {
+        static_cast<uint16_t>(rowsI), rowBytes, static_cast<uint32_t>((GRAM_BLOCK - rowsJ) * sizeof(float)),
+        dstStride, 0};
+    DataCopyPad(accLocal, gramGm, tileParams, padParams);
+    this->template SyncFlag<HardEvent::MTE2_V>();
+}
+
+template <typename T>
+__aicore__ inline void PdistGram<T>::ProcessTile(uint64_t bi, uint64_t bj)
+{
+    uint32_t rowsI = this->BlockRows(bi);
+    uint32_t rowsJ = this->BlockRows(bj);
+    mm.SetSingleShape(rowsI, rowsJ, static_cast<int32_t>(this->m));
+    mm.SetTensorA(this->xGm[bi * GRAM_BLOCK * this->m]);
+    mm.SetTensorB(this->xGm[bj * GRAM_BLOCK * this->m], true);
+    mm.IterateAll(gramGm);
+    // 上一个块对的搬出完成后才能覆盖acc
+    this->template SyncFlag<HardEvent::MTE3_MTE2>();
+    LoadTile(bi, bj, rowsI, rowsJ);
+
+    LocalTensor<float> accLocal = accBuf.Get<float>();
+    LocalTensor<float> brcbLocal = brcbBuf.Get<float>();
+    LocalTensor<float> normJLocal = normJBuf.Get<float>();
+    uint32_t count = rowsI * GRAM_BLOCK;
+    uint8_t rowStride = GRAM_BLOCK / FLOAT_PER_BLOCK;
+    Brcb(brcbLocal, normIBuf.Get<float>(), static_cast<uint8_t>((rowsI + FLOAT_PER_BLOCK - 1) / FLOAT_PER_BLOCK),
+         {1, BLOCK_PER_REPEAT});
+    Muls(accLocal, accLocal, -2.0f, count);
+    PipeBarrier<PIPE_V>();
+    for (uint32_t col = 0; col < GRAM_BLOCK; col += FLOAT_PER_REPEAT) {
+        Add(accLocal[col], accLocal[col], brcbLocal, FLOAT_PER_REPEAT, static_cast<uint8_t>(rowsI),
+            {1, 1, 0, rowStride, rowStride, 1});
+        PipeBarrier<PIPE_V>();
+        Add(accLocal[col], accLocal[col], normJLocal[col], FLOAT_PER_REPEAT, static_cast<uint8_t>(rowsI),
+            {1, 1, 1, rowStride, rowStride, 0});
+        PipeBarrier<PIPE_V>();
+    }
+    // 展开式存在相消误差，先截断负值再开方
+    Maxs(accLocal, accLocal, 0.0f, count);
+    PipeBarrier<PIPE_V>();
+    Sqrt(accLocal, accLocal, count);
+    PipeBarrier<PIPE_V>();
+    this->WriteTile(accLocal, bi, bj, rowsI, rowsJ);
+}
+} // namespace PdistND
+
+#endif // PDIST_GRAM_H
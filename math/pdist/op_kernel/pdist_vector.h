@@ -0,0 +1,234 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file pdist_vector.h
+ * \brief 任意p的vector路径：64x64的块对在UB内按M方向分段累加
+ *
+ * 每段把两个行块[64][colFactor]搬入UB，用同一张偏移表Gather转置成[colFactor][64]。对第k列，Brcb把行块I的第k列
+ * 广播成每行一个32B块，一条带repeat参数的Sub即得到64x64的差值块：src0(行块J的第k列)的repeat步长为0，
+ * src1(广播块)的block步长为0。差值取绝对值后按p累加到fp32累加块，所有段结束后开p次方并写出。
+ */
+#ifndef PDIST_VECTOR_H
+#define PDIST_VECTOR_H
+
+#include "pdist_base.h"
+
+namespace PdistND {
+constexpr uint32_t VEC_BLOCK = 64;
+constexpr float NONZERO_SCALE = 18446744073709551616.0f; // 2^64，两次放大后非零的最小规格化数也不小于1
+
+template <typename T>
+class PdistVector : public PdistBase<T> {
+public:
+    __aicore__ inline PdistVector(){};
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR y, const PdistTilingData* tilingData, TPipe* pipeIn);
+    __aicore__ inline void Process();
+
+private:
+    __aicore__ inline void InitTransTable();
+    __aicore__ inline void ProcessTile(uint64_t bi, uint64_t bj);
+    __aicore__ inline void LoadBlock(
+        const LocalTensor<float>& dstLocal, TBuf<QuePosition::VECCALC>& inBuf, uint64_t blockIdx, uint32_t rows,
+        uint64_t colStart, uint32_t cols);
+    __aicore__ inline void AccumulateCol(const LocalTensor<float>& xiT, const LocalTensor<float>& xjT, uint32_t rowsI);
+    __aicore__ inline void Finalize(uint32_t count);
+
+private:
+    TBuf<QuePosition::VECCALC> xiInBuf;
+    TBuf<QuePosition::VECCALC> xjInBuf;
+    TBuf<QuePosition::VECCALC> xiBuf;
+    TBuf<QuePosition::VECCALC> xjBuf;
+    TBuf<QuePosition::VECCALC> xiTBuf;
+    TBuf<QuePosition::VECCALC> xjTBuf;
+    TBuf<QuePosition::VECCALC> tableBuf;
+    TBuf<QuePosition::VECCALC> accBuf;
+    TBuf<QuePosition::VECCALC> diffBuf;
+    TBuf<QuePosition::VECCALC> brcbBuf;
+};
+
+template <typename T>
+__aicore__ inline void PdistVector<T>::Init(GM_ADDR x, GM_ADDR y, const PdistTilingData* tilingData, TPipe* pipeIn)
+{
+    this->InitBase(x, y, tilingData, pipeIn);
+    if (this->coreIdx >= this->usedCoreNum) {
+        return;
+    }
+    uint32_t blockElems = VEC_BLOCK * this->colFactor;
+    if constexpr (!IsSameType<T, float>::value) {
+        this->pipe->InitBuffer(xiInBuf, blockElems * sizeof(T));
+        this->pipe->InitBuffer(xjInBuf, blockElems * sizeof(T));
+    }
+    this->pipe->InitBuffer(xiBuf, blockElems * sizeof(float));
+    this->pipe->InitBuffer(xjBuf, blockElems * sizeof(float));
+    this->pipe->InitBuffer(xiTBuf, blockElems * sizeof(float));
+    this->pipe->InitBuffer(xjTBuf, blockElems * sizeof(float));
+    this->pipe->InitBuffer(tableBuf, blockElems * sizeof(int32_t));
+    this->pipe->InitBuffer(accBuf, VEC_BLOCK * VEC_BLOCK * sizeof(float));
+    this->pipe->InitBuffer(diffBuf, VEC_BLOCK * VEC_BLOCK * sizeof(float));
+    this->pipe->InitBuffer(brcbBuf, VEC_BLOCK * FLOAT_PER_BLOCK * sizeof(float));
+    this->InitWriteBuffers(VEC_BLOCK);
+    InitTransTable();
+}
+
+template <typename T>
+__aicore__ inline void PdistVector<T>::Process()
+{
+    if ASCEND_IS_AIC {
+        return;
+    }
+    if (this->coreIdx >= this->usedCoreNum) {
+        return;
+    }
+    uint64_t bi = 0;
+    uint64_t bj = 0;
+    this->LocateTile(this->tileStart, bi, bj);
+    for (uint64_t t = 0; t < this->tileCount; t++) {
+        ProcessTile(bi, bj);
+        this->NextTile(bi, bj);
+    }
+}
+
+// 转置后第k行第c列取自[c][k]：table[k * 64 + c] = (c * colFactor + k) * 4
+template <typename T>
+__aicore__ inline void PdistVector<T>::InitTransTable()
+{
+    LocalTensor<int32_t> tableLocal = tableBuf.Get<int32_t>();
+    CreateVecIndex(tableLocal, static_cast<int32_t>(0), VEC_BLOCK);
+    PipeBarrier<PIPE_V>();
+    Muls(tableLocal, tableLocal, static_cast<int32_t>(this->colFactor * sizeof(float)), VEC_BLOCK);
+    PipeBarrier<PIPE_V>();
+    for (uint32_t k = 1; k < this->colFactor; k++) {
+        Adds(tableLocal[k * VEC_BLOCK], tableLocal, static_cast<int32_t>(k * sizeof(float)), VEC_BLOCK);
+    }
+    PipeBarrier<PIPE_V>();
+}
+
+// 行块搬入为[rows][colFactor]，行尾补齐部分的值不参与计算
+template <typename T>
+__aicore__ inline void PdistVector<T>::LoadBlock(
+    const LocalTensor<float>& dstLocal, TBuf<QuePosition::VECCALC>& inBuf, uint64_t blockIdx, uint32_t rows,
+    uint64_t colStart, uint32_t cols)
+{
+    uint32_t rowBytes = cols * sizeof(T);
+    uint32_t dstStride = (this->colFactor * sizeof(T) - (rowBytes + BYTE_BLOCK - 1) / BYTE_BLOCK * BYTE_BLOCK) /
+                         BYTE_BLOCK;
+    DataCopyExtParams copyParams = {
+        static_cast<uint16_t>(rows), rowBytes, static_cast<uint32_t>((this->m - cols) * sizeof(T)), dstStride, 0};
+    DataCopyPadExtParams<T> padParams = {false, 0, 0, static_cast<T>(0)};
+    uint64_t offset = blockIdx * this->blockRows * this->m + colStart;
+    if constexpr (IsSameType<T, float>::value) {
+        DataCopyPad(dstLocal, this->xGm[offset], copyParams, padParams);
+    } else {
+        LocalTensor<T> inLocal = inBuf.Get<T>();
+        DataCopyPad(inLocal, this->xGm[offset], copyParams, padParams);
+        this->template SyncFlag<HardEvent::MTE2_V>();
+        Cast(dstLocal, inLocal, RoundMode::CAST_NONE, rows * this->colFactor);
+    }
+}
+
+template <typename T>
+__aicore__ inline void PdistVector<T>::ProcessTile(uint64_t bi, uint64_t bj)
+{
+    uint32_t rowsI = this->BlockRows(bi);
+    uint32_t rowsJ = this->BlockRows(bj);
+    bool isDiag = bi == bj;
+    LocalTensor<float> accLocal = accBuf.Get<float>();
+    LocalTensor<float> xiLocal = xiBuf.Get<float>();
+    LocalTensor<float> xjLocal = xjBuf.Get<float>();
+    LocalTensor<float> xiT = xiTBuf.Get<float>();
+    LocalTensor<float> xjT = isDiag ? xiT : xjTBuf.Get<float>();
+    LocalTensor<uint32_t> tableLocal = tableBuf.Get<uint32_t>();
+    Duplicate(accLocal, 0.0f, rowsI * VEC_BLOCK);
+    for (uint64_t colStart = 0; colStart < this->m; colStart += this->colFactor) {
+        uint64_t rest = this->m - colStart;
+        uint32_t cols = rest < this->colFactor ? static_cast<uint32_t>(rest) : this->colFactor;
+        LoadBlock(xiLocal, xiInBuf, bi, rowsI, colStart, cols);
+        if (!isDiag) {
+            LoadBlock(xjLocal, xjInBuf, bj, rowsJ, colStart, cols);
+        }
+        this->template SyncFlag<HardEvent::MTE2_V>();
+        Gather(xiT, xiLocal, tableLocal, static_cast<uint32_t>(0), cols * VEC_BLOCK);
+        if (!isDiag) {
+            Gather(xjT, xjLocal, tableLocal, static_cast<uint32_t>(0), cols * VEC_BLOCK);
+        }
+        PipeBarrier<PIPE_V>();
+        for (uint32_t k = 0; k < cols; k++) {
+            AccumulateCol(xiT[k * VEC_BLOCK], xjT[k * VEC_BLOCK], rowsI);
+        }
+        // 下一段搬入会覆盖行块
+        this->template SyncFlag<HardEvent::V_MTE2>();
+    }
+    Finalize(rowsI * VEC_BLOCK);
+    this->WriteTile(accLocal, bi, bj, rowsI, rowsJ);
+}
+
+template <typename T>
+__aicore__ inline void PdistVector<T>::AccumulateCol(
+    const LocalTensor<float>& xiT, const LocalTensor<float>& xjT, uint32_t rowsI)
+{
+    LocalTensor<float> accLocal = accBuf.Get<float>();
+    LocalTensor<float> diffLocal = diffBuf.Get<float>();
+    LocalTensor<float> brcbLocal = brcbBuf.Get<float>();
+    uint32_t count = rowsI * VEC_BLOCK;
+    Brcb(brcbLocal, xiT, static_cast<uint8_t>((rowsI + FLOAT_PER_BLOCK - 1) / FLOAT_PER_BLOCK), {1, BLOCK_PER_REPEAT});
+    PipeBarrier<PIPE_V>();
+    Sub(diffLocal, xjT, brcbLocal, FLOAT_PER_REPEAT, static_cast<uint8_t>(rowsI), {1, 1, 0, BLOCK_PER_REPEAT, 0, 1});
+    PipeBarrier<PIPE_V>();
+    Abs(diffLocal, diffLocal, count);
+    PipeBarrier<PIPE_V>();
+    if (this->pMode == P_MODE_INF) {
+        Max(accLocal, accLocal, diffLocal, count);
+        PipeBarrier<PIPE_V>();
+        return;
+    }
+    if (this->pMode == P_MODE_TWO) {
+        Mul(diffLocal, diffLocal, diffLocal, count);
+        PipeBarrier<PIPE_V>();
+    } else if (this->pMode == P_MODE_ZERO) {
+        Muls(diffLocal, diffLocal, NONZERO_SCALE, count);
+        PipeBarrier<PIPE_V>();
+        Muls(diffLocal, diffLocal, NONZERO_SCALE, count);
+        PipeBarrier<PIPE_V>();
+        Mins(diffLocal, diffLocal, 1.0f, count);
+        PipeBarrier<PIPE_V>();
+    } else if (this->pMode == P_MODE_GENERAL) {
+        // |d|^p = exp(p * ln|d|)，d = 0时ln为-inf，结果为0
+        Ln(diffLocal, diffLocal, count);
+        PipeBarrier<PIPE_V>();
+        Muls(diffLocal, diffLocal, this->p, count);
+        PipeBarrier<PIPE_V>();
+        Exp(diffLocal, diffLocal, count);
+        PipeBarrier<PIPE_V>();
+    }
+    Add(accLocal, accLocal, diffLocal, count);
+    PipeBarrier<PIPE_V>();
+}
+
+template <typename T>
+__aicore__ inline void PdistVector<T>::Finalize(uint32_t count)
+{
+    LocalTensor<float> accLocal = accBuf.Get<float>();
+    if (this->pMode == P_MODE_TWO) {
+        Sqrt(accLocal, accLocal, count);
+        PipeBarrier<PIPE_V>();
+    } else if (this->pMode == P_MODE_GENERAL) {
+        Ln(accLocal, accLocal, count);
+        PipeBarrier<PIPE_V>();
+        Muls(accLocal, accLocal, 1.0f / this->p, count);
+        PipeBarrier<PIPE_V>();
+        Exp(accLocal, accLocal, count);
+        PipeBarrier<PIPE_V>();
+    }
+}
+} // namespace PdistND
+
+#endif // PDIST_VECTOR_H
@@ -0,0 +1,150 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file test_pdist_tiling.cpp
+ * \brief
+ */
+
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+#include <gtest/gtest.h>
+#include "../../../op_host/pdist_tiling.h"
+#include "tiling_context_faker.h"
+#include "tiling_case_executor.h"
+
+class PdistTiling : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        std::cout << "PdistTiling SetUp" << std::endl;
+    }
+    static void TearDownTestCase()
+    {
+        std::cout << "PdistTiling TearDown" << std::endl;
+    }
+};
+
+// PdistTilingData中TCubeTiling之前的字段
+struct PdistTilingHead {
+    uint64_t n;
+    uint64_t m;
+    uint64_t tileNum;
+    uint64_t tilesPerCore;
+    uint64_t tailTiles;
+    float p;
+    uint32_t pMode;
+    uint32_t blockRows;
+    uint32_t blockNum;
+    uint32_t colFactor;
+    uint32_t usedCoreNum;
+};
+
+static gert::TilingContextPara MakePdistPara(
+    const gert::StorageShape& xShape, ge::DataType dtype, float p, optiling::PdistCompileInfo& compileInfo)
+{
+    int64_t n = xShape.GetStorageShape().GetDim(0);
+    int64_t outLen = n * (n - 1) / 2;
+    return gert::TilingContextPara(
+        "Pdist", {{xShape, dtype, ge::FORMAT_ND}}, {{{{outLen}, {outLen}}, dtype, ge::FORMAT_ND}},
+        {gert::TilingContextPara::OpAttr("p", Ops::Math::AnyValue::CreateFrom<float>(p))}, &compileInfo);
+}
+
+static PdistTilingHead RunPdistTiling(
+    int64_t n, int64_t m, ge::DataType dtype, float p, TilingInfo& tilingInfo)
+{
+    optiling::PdistCompileInfo compileInfo = {64, 16777216, 196608};
+    PdistTilingHead head;
+    memset(&head, 0, sizeof(head));
+    EXPECT_TRUE(ExecuteTiling(MakePdistPara({{n, m}, {n, m}}, dtype, p, compileInfo), tilingInfo));
+    EXPECT_GE(tilingInfo.tilingDataSize, sizeof(PdistTilingHead));
+    if (tilingInfo.tilingDataSize >= sizeof(PdistTilingHead)) {
+        memcpy(&head, tilingInfo.tilingData.get(), sizeof(head));
+    }
+    return head;
+}
+
+TEST_F(PdistTiling, pdist_tiling_general_p_float)
+{
+    TilingInfo tilingInfo;
+    PdistTilingHead head = RunPdistTiling(1000, 50, ge::DT_FLOAT, 3.0f, tilingInfo);
+    EXPECT_EQ(tilingInfo.tilingKey, 1);
+    EXPECT_EQ(tilingInfo.blockNum, 32);
+    EXPECT_EQ(head.blockRows, 64);
+    EXPECT_EQ(head.blockNum, 16);
+    // 16个行块只枚举上三角的136个块对，64核前8核各多一个
+    EXPECT_EQ(head.tileNum, 136);
+    EXPECT_EQ(head.tilesPerCore, 2);
+    EXPECT_EQ(head.tailTiles, 8);
+    EXPECT_EQ(head.pMode, 0);
+    EXPECT_EQ(head.colFactor, 64);
+    EXPECT_EQ(head.usedCoreNum, 64);
+    ASSERT_EQ(tilingInfo.workspaceSizes.size(), 1);
+    EXPECT_EQ(tilingInfo.workspaceSizes[0], 16777216);
+}
+
+TEST_F(PdistTiling, pdist_tiling_p2_small_m_float16)
+{
+    // M小于64时p=2也走vector路径
+    TilingInfo tilingInfo;
+    PdistTilingHead head = RunPdistTiling(100, 32, ge::DT_FLOAT16, 2.0f, tilingInfo);
+    EXPECT_EQ(tilingInfo.tilingKey, 2);
+    EXPECT_EQ(tilingInfo.blockNum, 2);
+    EXPECT_EQ(head.tileNum, 3);
+    EXPECT_EQ(head.tilesPerCore, 1);
+    EXPECT_EQ(head.tailTiles, 0);
+    EXPECT_EQ(head.pMode, 2);
+    EXPECT_EQ(head.colFactor, 32);
+    EXPECT_EQ(head.usedCoreNum, 3);
+}
+
+TEST_F(PdistTiling, pdist_tiling_pinf_float16_col_split)
+{
+    TilingInfo tilingInfo;
+    PdistTilingHead head =
+        RunPdistTiling(200, 1000, ge::DT_FLOAT16, std::numeric_limits<float>::infinity(), tilingInfo);
+    EXPECT_EQ(tilingInfo.tilingKey, 2);
+    EXPECT_EQ(head.pMode, 3);
+    EXPECT_EQ(head.colFactor, 80);
+    EXPECT_EQ(head.tileNum, 10);
+    EXPECT_EQ(head.usedCoreNum, 10);
+}
+
+TEST_F(PdistTiling, pdist_tiling_gram_float)
+{
+    TilingInfo tilingInfo;
+    PdistTilingHead head = RunPdistTiling(4096, 256, ge::DT_FLOAT, 2.0f, tilingInfo);
+    EXPECT_EQ(tilingInfo.tilingKey, 11);
+    EXPECT_EQ(tilingInfo.blockNum, 32);
+    EXPECT_EQ(head.blockRows, 128);
+    EXPECT_EQ(head.blockNum, 32);
+    EXPECT_EQ(head.tileNum, 528);
+    EXPECT_EQ(head.tilesPerCore, 8);
+    EXPECT_EQ(head.tailTiles, 16);
+    EXPECT_EQ(head.colFactor, 256);
+    // 行范数16KB，外加64核各一个128x128的fp32 Gram子块
+    ASSERT_EQ(tilingInfo.workspaceSizes.size(), 1);
+    EXPECT_EQ(tilingInfo.workspaceSizes[0], 16777216 + 16384 + 64 * 65536);
+}
+
+TEST_F(PdistTiling, pdist_tiling_negative_p)
+{
+    optiling::PdistCompileInfo compileInfo = {64, 16777216, 196608};
+    ExecuteTestCase(MakePdistPara({{100, 32}, {100, 32}}, ge::DT_FLOAT, -1.0f, compileInfo), ge::GRAPH_FAILED);
+}
+
+TEST_F(PdistTiling, pdist_tiling_invalid_rank)
+{
+    optiling::PdistCompileInfo compileInfo = {64, 16777216, 196608};
+    ExecuteTestCase(MakePdistPara({{4, 100, 32}, {4, 100, 32}}, ge::DT_FLOAT, 2.0f, compileInfo), ge::GRAPH_FAILED);
+}
@@ -0,0 +1,166 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+/*!
+ * \file test_pdist.cpp
+ * \brief
+ */
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "gtest/gtest.h"
+#include "tikicpulib.h"
+#include "data_utils.h"
+
+using namespace std;
+
+extern "C" __global__ __aicore__ void pdist(GM_ADDR x, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling);
+
+class pdist_test : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        cout << "pdist_test SetUp\n" << endl;
+    }
+    static void TearDownTestCase()
+    {
+        cout << "pdist_test TearDown\n" << endl;
+    }
+};
+
+static uint32_t GetPMode(float p)
+{
+    if (p == 0.0f) {
+        return 4;
+    }
+    if (p == 1.0f) {
+        return 1;
+    }
+    if (p == 2.0f) {
+        return 2;
+    }
+    if (std::isinf(p)) {
+        return 3;
+    }
+    return 0;
+}
+
+static vector<float> PdistGolden(const vector<float>& x, uint64_t n, uint64_t m, float p)
+{
+    vector<float> y;
+    for (uint64_t i = 0; i < n; i++) {
+        for (uint64_t j = i + 1; j < n; j++) {
+            double acc = 0.0;
+            for (uint64_t k = 0; k < m; k++) {
+                double d = std::fabs(static_cast<double>(x[i * m + k]) - x[j * m + k]);
+                if (std::isinf(p)) {
+                    acc = std::max(acc, d);
+                } else if (p == 0.0f) {
+                    acc += d != 0.0 ? 1.0 : 0.0;
+                } else {
+                    acc += std::pow(d, static_cast<double>(p));
+                }
+            }
+            if (!std::isinf(p) && p != 0.0f) {
+                acc = std::pow(acc, 1.0 / p);
+            }
+            y.push_back(static_cast<float>(acc));
+        }
+    }
+    return y;
+}
+
+// vector路径，colFactor取16以覆盖M方向的多段累加
+static vector<float> RunFloatPdist(const vector<float>& xHost, uint64_t n, uint64_t m, float p, uint32_t blockDim)
+{
+    uint64_t blockNum = (n + 63) / 64;
+    uint64_t tileNum = blockNum * (blockNum + 1) / 2;
+    uint64_t outLen = n * (n - 1) / 2;
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(sizeof(PdistTilingData));
+    PdistTilingData* tilingData = reinterpret_cast<PdistTilingData*>(tiling);
+    memset(tilingData, 0, sizeof(PdistTilingData));
+    tilingData->n = n;
+    tilingData->m = m;
+    tilingData->tileNum = tileNum;
+    tilingData->tilesPerCore = tileNum / blockDim;
+    tilingData->tailTiles = tileNum % blockDim;
+    tilingData->p = p;
+    tilingData->pMode = GetPMode(p);
+    tilingData->blockRows = 64;
+    tilingData->blockNum = blockNum;
+    tilingData->colFactor = 16;
+    tilingData->usedCoreNum = blockDim;
+    uint8_t* x = (uint8_t*)AscendC::GmAlloc(xHost.size() * sizeof(float));
+    uint8_t* y = (uint8_t*)AscendC::GmAlloc(outLen * sizeof(float));
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(16 * 1024 * 1024);
+    memcpy(x, xHost.data(), xHost.size() * sizeof(float));
+
+    ICPU_SET_TILING_KEY(1);
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_RUN_KF(pdist, blockDim, x, y, workspace, (uint8_t*)(tilingData));
+
+    vector<float> out(outLen);
+    memcpy(out.data(), y, outLen * sizeof(float));
+    AscendC::GmFree(x);
+    AscendC::GmFree(y);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+    return out;
+}
+
+static vector<float> MakeInput(uint64_t n, uint64_t m)
+{
+    vector<float> x(n * m);
+    for (uint64_t i = 0; i < x.size(); i++) {
+        x[i] = static_cast<float>((i * 37) % 101) / 25.0f - 2.0f;
+    }
+    return x;
+}
+
+static void CheckPdist(uint64_t n, uint64_t m, float p, uint32_t blockDim, float tol)
+{
+    vector<float> x = MakeInput(n, m);
+    vector<float> out = RunFloatPdist(x, n, m, p, blockDim);
+    vector<float> golden = PdistGolden(x, n, m, p);
+    ASSERT_EQ(out.size(), golden.size());
+    for (size_t i = 0; i < golden.size(); i++) {
+        EXPECT_NEAR(out[i], golden[i], tol * std::max(1.0f, std::fabs(golden[i]))) << "index " << i;
+    }
+}
+
+TEST_F(pdist_test, test_float_p2_multi_tile)
+{
+    // 两个行块共3个块对，最后一个为不满64行的对角块
+    CheckPdist(70, 20, 2.0f, 2, 1e-5f);
+}
+
+TEST_F(pdist_test, test_float_p1_single_core)
+{
+    CheckPdist(10, 5, 1.0f, 1, 1e-5f);
+}
+
+TEST_F(pdist_test, test_float_pinf)
+{
+    CheckPdist(33, 40, std::numeric_limits<float>::infinity(), 1, 1e-6f);
+}
+
+TEST_F(pdist_test, test_float_p0_counts_nonzero)
+{
+    CheckPdist(12, 17, 0.0f, 1, 1e-6f);
+}
+
+TEST_F(pdist_test, test_float_general_p)
+{
+    CheckPdist(130, 9, 3.0f, 3, 1e-4f);
+}
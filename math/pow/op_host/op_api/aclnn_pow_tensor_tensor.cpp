@@ -13,6 +13,7 @@
 #include "pow.h"
 #include "aclnn_kernels/cast.h"
 #include "aclnn_kernels/contiguous.h"
+#include "common/level2_elementwise_dispatch.h"
 #include "aclnn_kernels/common/op_error_check.h"
 #include "opdev/common_types.h"
 #include "opdev/data_type_utils.h"
@@ -158,28 +159,28 @@ aclnnStatus aclnnPowTensorTensorGetWorkspaceSize(
     // Pow算子需要对self和exponent两个输入做隐式数据类型转换，根据具体算子语义按需调用
     auto promoteType = op::PromoteType(self->GetDataType(), exponent->GetDataType());
 
-    // 固定写法，将输入self转换成连续的tensor
-    auto selfContiguous = l0op::Contiguous(self, uniqueExecutor.get());
-    CHECK_RET(selfContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    // 一次性计算广播类别、输入连续性与Cast需求，按路径表只执行必要的Contiguous/Cast
+    const auto& plan = ElementwiseDispatcher::Select(ElementwiseDispatcher::Classify(self, exponent, out, promoteType));
 
-    // 将输入self的数据类型转换成隐式数据类型，根据具体算子语义按需调用
-    auto selfCasted = l0op::Cast(selfContiguous, promoteType, uniqueExecutor.get());
+    // 将输入self转换成连续的tensor并转换成隐式数据类型
+    auto selfCasted = ElementwiseDispatcher::PrepareInput(
+        self, plan, ELEMENTWISE_STEP_CONTIGUOUS_SELF, ELEMENTWISE_STEP_CAST_SELF, promoteType, uniqueExecutor.get());
     CHECK_RET(selfCasted != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
-    // 固定写法，将输入exponent转换成连续的tensor
-    auto exponentContiguous = l0op::Contiguous(exponent, uniqueExecutor.get());
-    CHECK_RET(exponentContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
-
-    // 将输入exponent的数据类型转换成隐式数据类型，根据具体算子语义按需调用
-    auto exponentCasted = l0op::Cast(exponentContiguous, promoteType, uniqueExecutor.get());
+    // 将输入exponent转换成连续的tensor并转换成隐式数据类型
+    auto exponentCasted = ElementwiseDispatcher::PrepareInput(
+        exponent, plan, ELEMENTWISE_STEP_CONTIGUOUS_OTHER, ELEMENTWISE_STEP_CAST_OTHER, promoteType,
+        uniqueExecutor.get());
     CHECK_RET(exponentCasted != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
     // 调用Pow算子kernel
     auto powOpOut = l0op::Pow(selfCasted, exponentCasted, uniqueExecutor.get());
     CHECK_RET(powOpOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
-    // 固定写法，将计算结果转换成输出out的数据类型
-    auto castOut = l0op::Cast(powOpOut, out->GetDataType(), uniqueExecutor.get());
+    // 计算结果与out类型不一致时才需要Cast
+    auto castOut = plan.Has(ELEMENTWISE_STEP_CAST_OUT) ?
+                       l0op::Cast(powOpOut, out->GetDataType(), uniqueExecutor.get()) :
+                       powOpOut;
     CHECK_RET(castOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
 
     // 固定写法，将计算结果拷贝到输出out上，out可能是非连续的tensor
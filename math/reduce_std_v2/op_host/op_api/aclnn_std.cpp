@@ -17,6 +17,7 @@
 #include "aclnn_kernels/reshape.h"
 #include "aclnn_kernels/contiguous.h"
 #include "math/expand/op_host/op_api/expand.h"
+#include "math/welford_var_mean/op_host/op_api/welford_var_mean.h"
 #include "aclnn_kernels/transdata.h"
 #include "opdev/common_types.h"
 #include "opdev/data_type_utils.h"
@@ -222,6 +223,27 @@ static aclnnStatus aclnnStdV2ImplUnify(
     return ACLNN_SUCCESS;
 }
 
+// 910B/910_93上由单遍Welford kernel直接输出标准差，替代ReduceMean->Expand->ReduceStdWithMean
+static aclnnStatus aclnnStdImplWelford(
+    const aclTensor* self, const aclIntArray* dim, int64_t correction, bool keepdim, aclTensor* out,
+    uint64_t* workspaceSize, UniqueExecutor& uniqueExecutor, aclOpExecutor** executor)
+{
+    auto welfordOut = l0op::WelfordVarMean(self, dim, correction, keepdim, true, uniqueExecutor.get());
+
+    auto stdOut = std::get<0>(welfordOut);
+    CHECK_RET(stdOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    auto castOut = l0op::Cast(stdOut, out->GetDataType(), uniqueExecutor.get());
+    CHECK_RET(castOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    auto viewCopyResult = l0op::ViewCopy(castOut, out, uniqueExecutor.get());
+    CHECK_RET(viewCopyResult != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    // 获取计算过程中需要使用的workspace大小
+    *workspaceSize = uniqueExecutor->GetWorkspaceSize();
+    uniqueExecutor.ReleaseTo(executor);
+
+    return ACLNN_SUCCESS;
+}
+
 aclnnStatus aclnnStdGetWorkspaceSize(
     const aclTensor* self, const aclIntArray* dim, const int64_t correction, bool keepdim, aclTensor* out,
     uint64_t* workspaceSize, aclOpExecutor** executor)
@@ -295,6 +317,10 @@ aclnnStatus aclnnStdGetWorkspaceSize(
         return aclnnStdV2ImplUnify(
             selfReformat, dimArray, correction, keepdim, out, workspaceSize, uniqueExecutor, executor);
     }
+    if (l0op::IsWelfordVarMeanSupport(selfReformat, dimArray)) {
+        return aclnnStdImplWelford(
+            selfReformat, dimArray, correction, keepdim, out, workspaceSize, uniqueExecutor, executor);
+    }
 
     // 调用Mean算子kernel
     auto meanOpOut = l0op::ReduceMean(selfContiguous, dimArray, true, uniqueExecutor.get());
@@ -18,6 +18,7 @@
 #include "aclnn_kernels/transdata.h"
 #include "conversion/unsqueeze/op_host/op_api/unsqueeze.h"
 #include "math/expand/op_host/op_api/expand.h"
+#include "math/welford_var_mean/op_host/op_api/welford_var_mean.h"
 #include "opdev/common_types.h"
 #include "opdev/data_type_utils.h"
 #include "opdev/format_utils.h"
@@ -292,6 +293,34 @@ static aclnnStatus aclnnStdMeanCorrectionImplUnify(
     return ACLNN_SUCCESS;
 }
 
+// 单遍Welford kernel同时输出标准差与均值，替代ReduceMean->Expand->ReduceStdWithMean
+static aclnnStatus aclnnStdMeanCorrectionImplWelford(
+    const aclTensor* self, const aclIntArray* dim, int64_t correction, bool keepdim, aclTensor* stdOut,
+    aclTensor* meanOut, uint64_t* workspaceSize, UniqueExecutor& uniqueExecutor, aclOpExecutor** executor)
+{
+    auto welfordOut = l0op::WelfordVarMean(self, dim, correction, keepdim, true, uniqueExecutor.get());
+
+    auto stdOpOut = std::get<0>(welfordOut);
+    CHECK_RET(stdOpOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    auto castOut = l0op::Cast(stdOpOut, stdOut->GetDataType(), uniqueExecutor.get());
+    CHECK_RET(castOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    auto viewCopyResult = l0op::ViewCopy(castOut, stdOut, uniqueExecutor.get());
+    CHECK_RET(viewCopyResult != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    auto meanOpOut = std::get<1>(welfordOut);
+    CHECK_RET(meanOpOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    auto castOut1 = l0op::Cast(meanOpOut, meanOut->GetDataType(), uniqueExecutor.get());
+    CHECK_RET(castOut1 != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    auto viewCopyResult1 = l0op::ViewCopy(castOut1, meanOut, uniqueExecutor.get());
+    CHECK_RET(viewCopyResult1 != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    // 获取计算过程中需要使用的workspace大小
+    *workspaceSize = uniqueExecutor->GetWorkspaceSize();
+    uniqueExecutor.ReleaseTo(executor);
+
+    return ACLNN_SUCCESS;
+}
+
 aclnnStatus aclnnStdMeanCorrectionGetWorkspaceSize(
     const aclTensor* self, const aclIntArray* dim, int64_t correction, bool keepdim, aclTensor* stdOut,
     aclTensor* meanOut, uint64_t* workspaceSize, aclOpExecutor** executor)
@@ -332,6 +361,11 @@ aclnnStatus aclnnStdMeanCorrectionGetWorkspaceSize(
         return aclnnStdMeanCorrectionImplUnify(
             selfReformat, dimArray, correction, keepdim, stdOut, meanOut, workspaceSize, uniqueExecutor, executor);
     }
+    // shapeProd小于等于correction的NAN/INF场景仍走下方的填充逻辑
+    if (CalcShapeProd(self, dimArray) > correction && l0op::IsWelfordVarMeanSupport(selfReformat, dimArray)) {
+        return aclnnStdMeanCorrectionImplWelford(
+            selfReformat, dimArray, correction, keepdim, stdOut, meanOut, workspaceSize, uniqueExecutor, executor);
+    }
 
     // 调用Mean算子kernel
     auto meanOpOut = l0op::ReduceMean(selfContiguous, dimArray, keepdim, uniqueExecutor.get());
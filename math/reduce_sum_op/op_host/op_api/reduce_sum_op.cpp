@@ -78,23 +78,17 @@ static const aclTensor* ReduceSumOpAiCore(
     return out;
 }
 
-// AICPU算子kernel
+// AICPU算子kernel，所有数据类型统一走仓内的ReduceSum AICPU实现（两两求和、多轴并行）
 static const aclTensor* ReduceSumOpAiCpu(
-    const aclTensor* x, const aclTensor* axes, bool keepDim, const aclTensor* out, aclOpExecutor* executor)
+    const aclTensor* x, const aclTensor* axes, bool keepDim, bool noopWithEmptyAxes, const aclTensor* out,
+    aclOpExecutor* executor)
 {
-    L0_DFX(ReduceSumOpAiCpu, x, axes, keepDim, out);
-    if (x->GetDataType() == op::DataType::DT_INT64) {
-        static internal::AicpuTaskSpace space("ReduceSum", ge::DEPEND_IN_SHAPE);
-        auto ret = ADD_TO_LAUNCHER_LIST_AICPU(
-            ReduceSum, OP_ATTR_NAMES({"keep_dims"}), OP_INPUT(x, axes), OP_OUTPUT(out), OP_ATTR(keepDim));
-        CHECK_RET(ret == ACLNN_SUCCESS, nullptr);
-    } else {
-        static internal::AicpuTaskSpace space("Sum", ge::DEPEND_IN_SHAPE, true);
-        auto ret = ADD_TO_LAUNCHER_LIST_AICPU(
-            ReduceSum, OP_ATTR_NAMES({"Tidx", "keep_dims"}), OP_INPUT(x, axes), OP_OUTPUT(out),
-            OP_ATTR(axes->GetDataType(), keepDim));
-        CHECK_RET(ret == ACLNN_SUCCESS, nullptr);
-    }
+    L0_DFX(ReduceSumOpAiCpu, x, axes, keepDim, noopWithEmptyAxes, out);
+    static internal::AicpuTaskSpace space("ReduceSum", ge::DEPEND_IN_SHAPE);
+    auto ret = ADD_TO_LAUNCHER_LIST_AICPU(
+        ReduceSum, OP_ATTR_NAMES({"keep_dims", "noop_with_empty_axes"}), OP_INPUT(x, axes), OP_OUTPUT(out),
+        OP_ATTR(keepDim, noopWithEmptyAxes));
+    CHECK_RET(ret == ACLNN_SUCCESS, nullptr);
     return out;
 }
 
@@ -121,7 +115,7 @@ const aclTensor* ReduceSumOp(const aclTensor* x, const aclIntArray* axes, bool k
     if (IsAiCoreSupport(x)) {
         return ReduceSumOpAiCore(x, axesTensor, keepDim, noopWithEmptyAxes, out, executor);
     } else {
-        return ReduceSumOpAiCpu(x, axesTensor, keepDim, out, executor);
+        return ReduceSumOpAiCpu(x, axesTensor, keepDim, noopWithEmptyAxes, out, executor);
     }
 }
 } // namespace l0op
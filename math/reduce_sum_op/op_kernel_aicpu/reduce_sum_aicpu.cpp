@@ -0,0 +1,425 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "reduce_sum_aicpu.h"
+
+#include <algorithm>
+#include <complex>
+#include <cstring>
+#include <utility>
+
+#include "Eigen/Core"
+#include "cpu_kernel_utils.h"
+#include "cpu_types.h"
+#include "log.h"
+#include "utils/kernel_util.h"
+
+namespace {
+const char* const kReduceSum = "ReduceSum";
+constexpr size_t kOutputSize = 1;
+constexpr int64_t kParallelDataNum = 32 * 1024; // 输入元素数达到该值才多线程
+constexpr int64_t kPairwiseBlock = 128;         // 两两求和递归到该长度后直接累加
+constexpr int64_t kLaneNum = 8;                 // 叶子块内独立累加器个数，便于编译器向量化
+constexpr int64_t kCascadeRows = 64;            // 纵向累加时每个级联块的行数
+constexpr int64_t kColTile = 1024;              // 纵向累加时每次处理的最内维列数
+
+#define REDUCE_SUM_COMPUTE_CASE(DTYPE, TYPE, ACC, CTX)            \
+    case (DTYPE): {                                              \
+        return static_cast<uint32_t>(DoCompute<TYPE, ACC>(CTX)); \
+    }
+} // namespace
+
+namespace aicpu {
+namespace {
+std::vector<int64_t> EnumerateOffsets(const std::vector<std::pair<int64_t, int64_t>>& dims)
+{
+    // dims为(长度, 步长)，按行优先展开所有组合的偏移
+    std::vector<int64_t> offsets{0};
+    for (const auto& dim : dims) {
+        std::vector<int64_t> next;
+        next.reserve(offsets.size() * dim.first);
+        for (int64_t base : offsets) {
+            for (int64_t i = 0; i < dim.first; i++) {
+                next.push_back(base + i * dim.second);
+            }
+        }
+        offsets.swap(next);
+    }
+    return offsets;
+}
+
+template <typename T, typename Acc>
+Acc PairwiseSum(const T* data, int64_t n)
+{
+    if (n <= kPairwiseBlock) {
+        Acc lanes[kLaneNum] = {};
+        int64_t i = 0;
+        for (; i + kLaneNum <= n; i += kLaneNum) {
+            for (int64_t l = 0; l < kLaneNum; l++) {
+                lanes[l] += static_cast<Acc>(data[i + l]);
+            }
+        }
+        Acc res = Acc();
+        for (int64_t l = 0; l < kLaneNum; l++) {
+            res += lanes[l];
+        }
+        for (; i < n; i++) {
+            res += static_cast<Acc>(data[i]);
+        }
+        return res;
+    }
+    int64_t half = n / 2;
+    half -= half % kLaneNum;
+    return PairwiseSum<T, Acc>(data, half) + PairwiseSum<T, Acc>(data + half, n - half);
+}
+
+// 最内维归约：行内两两求和，行之间同样按二分合并
+template <typename T, typename Acc>
+Acc SumRows(const T* base, const int64_t* rowOffsets, int64_t rowNum, int64_t colBegin, int64_t colEnd)
+{
+    if (rowNum == 1) {
+        return PairwiseSum<T, Acc>(base + rowOffsets[0] + colBegin, colEnd - colBegin);
+    }
+    int64_t half = rowNum / 2;
+    return SumRows<T, Acc>(base, rowOffsets, half, colBegin, colEnd) +
+           SumRows<T, Acc>(base, rowOffsets + half, rowNum - half, colBegin, colEnd);
+}
+
+// 外层归约：逐行纵向累加（按列连续，可向量化），每kCascadeRows行成一块，
+// 块之间按二进制进位方式两两合并，误差随行数对数增长
+template <typename T, typename Acc>
+void SumColumns(const T* base, const int64_t* rowOffsets, int64_t rowNum, int64_t len, Acc* dst)
+{
+    std::vector<std::vector<Acc>> levels;
+    std::vector<Acc> block(len);
+    for (int64_t r0 = 0; r0 < rowNum; r0 += kCascadeRows) {
+        int64_t r1 = std::min(rowNum, r0 + kCascadeRows);
+        std::fill(block.begin(), block.end(), Acc());
+        for (int64_t r = r0; r < r1; r++) {
+            const T* row = base + rowOffsets[r];
+            for (int64_t j = 0; j < len; j++) {
+                block[j] += static_cast<Acc>(row[j]);
+            }
+        }
+        size_t level = 0;
+        while (level < levels.size() && !levels[level].empty()) {
+            for (int64_t j = 0; j < len; j++) {
+                block[j] += levels[level][j];
+            }
+            levels[level].clear();
+            level++;
+        }
+        if (level == levels.size()) {
+            levels.emplace_back();
+        }
+        levels[level] = block;
+    }
+    std::fill(dst, dst + len, Acc());
+    for (const auto& partial : levels) {
+        if (partial.empty()) {
+            continue;
+        }
+        for (int64_t j = 0; j < len; j++) {
+            dst[j] += partial[j];
+        }
+    }
+}
+} // namespace
+
+KernelStatus ReduceSumKernel::GetInputAndCheck(const CpuKernelContext& ctx)
+{
+    xTensor_ = ctx.Input(0);
+    KERNEL_CHECK_NULLPTR(xTensor_, KERNEL_STATUS_PARAM_INVALID, "Get input:[0] failed");
+    xDtype_ = static_cast<DataType>(xTensor_->GetDataType());
+    axesTensor_ = ctx.Input(1);
+    KERNEL_CHECK_NULLPTR(axesTensor_, KERNEL_STATUS_PARAM_INVALID, "Get input:[1] failed");
+    yTensor_ = ctx.Output(0);
+    KERNEL_CHECK_NULLPTR(yTensor_, KERNEL_STATUS_PARAM_INVALID, "Get output:[0] failed");
+    if (ctx.GetOutputsSize() != kOutputSize) {
+        KERNEL_LOG_ERROR(
+            "Output number is: [%d], but ReduceSum needs [%zu] outputs.", ctx.GetOutputsSize(), kOutputSize);
+        return KERNEL_STATUS_PARAM_INVALID;
+    }
+    if (yTensor_->GetDataType() != xTensor_->GetDataType()) {
+        KERNEL_LOG_ERROR(
+            "The dtype of output [%s] should be same with input [%s].", DTypeStr(yTensor_->GetDataType()).c_str(),
+            DTypeStr(xTensor_->GetDataType()).c_str());
+        return KERNEL_STATUS_PARAM_INVALID;
+    }
+
+    AttrValue* keepDims = ctx.GetAttr("keep_dims");
+    keepDims_ = (keepDims == nullptr) ? false : keepDims->GetBool();
+    AttrValue* noopWithEmptyAxes = ctx.GetAttr("noop_with_empty_axes");
+    noopWithEmptyAxes_ = (noopWithEmptyAxes == nullptr) ? true : noopWithEmptyAxes->GetBool();
+
+    axes_.clear();
+    int64_t axesNum = axesTensor_->NumElements();
+    auto axesDtype = axesTensor_->GetDataType();
+    if (axesDtype == DT_INT32) {
+        auto axesData = PtrToPtr<void, int32_t>(axesTensor_->GetData());
+        axes_.assign(axesData, axesData + axesNum);
+    } else if (axesDtype == DT_INT64) {
+        auto axesData = PtrToPtr<void, int64_t>(axesTensor_->GetData());
+        axes_.assign(axesData, axesData + axesNum);
+    } else {
+        KERNEL_LOG_ERROR("axes type must be DT_INT32 or DT_INT64, but got %s", DTypeStr(axesDtype).c_str());
+        return KERNEL_STATUS_PARAM_INVALID;
+    }
+    KERNEL_LOG_DEBUG(
+        "x shape is [%s], axes is [%s], keep_dims is %d.",
+        VectorToString(xTensor_->GetTensorShape()->GetDimSizes()).c_str(), VectorToString(axes_).c_str(),
+        static_cast<int32_t>(keepDims_));
+    return KERNEL_STATUS_OK;
+}
+
+KernelStatus ReduceSumKernel::BuildPlan(const std::vector<int64_t>& xDims)
+{
+    int64_t rank = static_cast<int64_t>(xDims.size());
+    std::vector<bool> isReduce(rank, axes_.empty() && !noopWithEmptyAxes_);
+    for (int64_t axis : axes_) {
+        int64_t realAxis = axis < 0 ? axis + rank : axis;
+        if (realAxis < 0 || realAxis >= rank) {
+            KERNEL_LOG_ERROR("axis [%ld] is out of range [%ld, %ld).", axis, -rank, rank);
+            return KERNEL_STATUS_PARAM_INVALID;
+        }
+        isReduce[realAxis] = true;
+    }
+
+    // 去掉长度为1的轴，相邻的同类轴合并成一维
+    std::vector<std::pair<int64_t, bool>> dims;
+    for (int64_t i = 0; i < rank; i++) {
+        if (xDims[i] == 1) {
+            continue;
+        }
+        if (!dims.empty() && dims.back().second == isReduce[i]) {
+            dims.back().first *= xDims[i];
+        } else {
+            dims.emplace_back(xDims[i], isReduce[i]);
+        }
+    }
+
+    plan_ = ReducePlan();
+    if (std::none_of(dims.begin(), dims.end(), [](const std::pair<int64_t, bool>& dim) { return dim.second; })) {
+        plan_.noReduce = true;
+        return KERNEL_STATUS_OK;
+    }
+
+    std::vector<int64_t> strides(dims.size());
+    int64_t stride = 1;
+    for (size_t i = dims.size(); i > 0; i--) {
+        strides[i - 1] = stride;
+        stride *= dims[i - 1].first;
+    }
+    plan_.innerLen = dims.back().first;
+    plan_.innerReduce = dims.back().second;
+    std::vector<std::pair<int64_t, int64_t>> keptDims;
+    std::vector<std::pair<int64_t, int64_t>> reduceDims;
+    for (size_t i = 0; i + 1 < dims.size(); i++) {
+        if (dims[i].second) {
+            reduceDims.emplace_back(dims[i].first, strides[i]);
+        } else {
+            keptDims.emplace_back(dims[i].first, strides[i]);
+        }
+    }
+    plan_.keptOffsets = EnumerateOffsets(keptDims);
+    plan_.reduceOffsets = EnumerateOffsets(reduceDims);
+    return KERNEL_STATUS_OK;
+}
+
+template <typename T, typename Acc>
+KernelStatus ReduceSumKernel::ComputeInnerReduce(const CpuKernelContext& ctx, const T* x, T* y)
+{
+    const int64_t outNum = static_cast<int64_t>(plan_.keptOffsets.size());
+    const int64_t rowNum = static_cast<int64_t>(plan_.reduceOffsets.size());
+    const int64_t len = plan_.innerLen;
+    const int64_t* keptOffsets = plan_.keptOffsets.data();
+    const int64_t* rowOffsets = plan_.reduceOffsets.data();
+    const int64_t cpuNum = std::max(static_cast<int64_t>(CpuKernelUtils::GetCPUNum(ctx)), static_cast<int64_t>(1));
+
+    auto outTask = [&](int64_t start, int64_t end) {
+        for (int64_t o = start; o < end; o++) {
+            y[o] = static_cast<T>(SumRows<T, Acc>(x + keptOffsets[o], rowOffsets, rowNum, 0, len));
+        }
+    };
+    if (xTensor_->NumElements() < kParallelDataNum || cpuNum == 1) {
+        outTask(0, outNum);
+        return KERNEL_STATUS_OK;
+    }
+    if (outNum >= cpuNum) {
+        auto ret = CpuKernelUtils::ParallelFor(ctx, outNum, CeilMultiple(outNum, cpuNum), outTask);
+        KERNEL_CHECK_FALSE((ret == KERNEL_STATUS_OK), KERNEL_STATUS_INNER_ERROR, "CpuKernelUtils::ParallelFor failed.");
+        return KERNEL_STATUS_OK;
+    }
+
+    // 输出个数少于线程数（含全归约）：沿归约方向切分，行数够时按行切，否则切最内维，
+    // 各分片写各自的部分和，再按分片顺序合并
+    const bool splitRows = rowNum >= cpuNum;
+    const int64_t shardNum = splitRows ? cpuNum : std::min(cpuNum, len);
+    std::vector<Acc> partials(shardNum * outNum);
+    auto shardTask = [&](int64_t start, int64_t end) {
+        for (int64_t s = start; s < end; s++) {
+            for (int64_t o = 0; o < outNum; o++) {
+                Acc partial;
+                if (splitRows) {
+                    int64_t rowBegin = rowNum * s / shardNum;
+                    int64_t rowEnd = rowNum * (s + 1) / shardNum;
+                    partial = SumRows<T, Acc>(x + keptOffsets[o], rowOffsets + rowBegin, rowEnd - rowBegin, 0, len);
+                } else {
+                    int64_t colBegin = len * s / shardNum;
+                    int64_t colEnd = len * (s + 1) / shardNum;
+                    partial = SumRows<T, Acc>(x + keptOffsets[o], rowOffsets, rowNum, colBegin, colEnd);
+                }
+                partials[s * outNum + o] = partial;
+            }
+        }
+    };
+    auto ret = CpuKernelUtils::ParallelFor(ctx, shardNum, 1, shardTask);
+    KERNEL_CHECK_FALSE((ret == KERNEL_STATUS_OK), KERNEL_STATUS_INNER_ERROR, "CpuKernelUtils::ParallelFor failed.");
+    for (int64_t o = 0; o < outNum; o++) {
+        Acc acc = Acc();
+        for (int64_t s = 0; s < shardNum; s++) {
+            acc += partials[s * outNum + o];
+        }
+        y[o] = static_cast<T>(acc);
+    }
+    return KERNEL_STATUS_OK;
+}
+
+template <typename T, typename Acc>
+KernelStatus ReduceSumKernel::ComputeOuterReduce(const CpuKernelContext& ctx, const T* x, T* y)
+{
+    const int64_t blockNum = static_cast<int64_t>(plan_.keptOffsets.size());
+    const int64_t rowNum = static_cast<int64_t>(plan_.reduceOffsets.size());
+    const int64_t len = plan_.innerLen;
+    const int64_t tileNum = (len + kColTile - 1) / kColTile;
+    const int64_t unitNum = blockNum * tileNum;
+    const int64_t* keptOffsets = plan_.keptOffsets.data();
+    const int64_t* rowOffsets = plan_.reduceOffsets.data();
+    const int64_t cpuNum = std::max(static_cast<int64_t>(CpuKernelUtils::GetCPUNum(ctx)), static_cast<int64_t>(1));
+
+    auto unitTask = [&](int64_t start, int64_t end) {
+        std::vector<Acc> acc(kColTile);
+        for (int64_t u = start; u < end; u++) {
+            int64_t o = u / tileNum;
+            int64_t colBegin = (u % tileNum) * kColTile;
+            int64_t colLen = std::min(kColTile, len - colBegin);
+            SumColumns<T, Acc>(x + keptOffsets[o] + colBegin, rowOffsets, rowNum, colLen, acc.data());
+            T* dst = y + o * len + colBegin;
+            for (int64_t j = 0; j < colLen; j++) {
+                dst[j] = static_cast<T>(acc[j]);
+            }
+        }
+    };
+    if (xTensor_->NumElements() < kParallelDataNum || cpuNum == 1) {
+        unitTask(0, unitNum);
+        return KERNEL_STATUS_OK;
+    }
+    if (unitNum >= cpuNum || rowNum < cpuNum) {
+        auto ret = CpuKernelUtils::ParallelFor(ctx, unitNum, CeilMultiple(unitNum, cpuNum), unitTask);
+        KERNEL_CHECK_FALSE((ret == KERNEL_STATUS_OK), KERNEL_STATUS_INNER_ERROR, "CpuKernelUtils::ParallelFor failed.");
+        return KERNEL_STATUS_OK;
+    }
+
+    // 输出列数不足以占满线程：按归约行切分，各分片纵向累加出部分和，再按分片顺序合并
+    const int64_t shardNum = cpuNum;
+    const int64_t outNum = blockNum * len;
+    std::vector<Acc> partials(shardNum * outNum);
+    auto shardTask = [&](int64_t start, int64_t end) {
+        for (int64_t s = start; s < end; s++) {
+            int64_t rowBegin = rowNum * s / shardNum;
+            int64_t rowEnd = rowNum * (s + 1) / shardNum;
+            for (int64_t o = 0; o < blockNum; o++) {
+                for (int64_t colBegin = 0; colBegin < len; colBegin += kColTile) {
+                    int64_t colLen = std::min(kColTile, len - colBegin);
+                    SumColumns<T, Acc>(
+                        x + keptOffsets[o] + colBegin, rowOffsets + rowBegin, rowEnd - rowBegin, colLen,
+                        partials.data() + s * outNum + o * len + colBegin);
+                }
+            }
+        }
+    };
+    auto ret = CpuKernelUtils::ParallelFor(ctx, shardNum, 1, shardTask);
+    KERNEL_CHECK_FALSE((ret == KERNEL_STATUS_OK), KERNEL_STATUS_INNER_ERROR, "CpuKernelUtils::ParallelFor failed.");
+    for (int64_t i = 0; i < outNum; i++) {
+        Acc acc = Acc();
+        for (int64_t s = 0; s < shardNum; s++) {
+            acc += partials[s * outNum + i];
+        }
+        y[i] = static_cast<T>(acc);
+    }
+    return KERNEL_STATUS_OK;
+}
+
+template <typename T, typename Acc>
+KernelStatus ReduceSumKernel::DoCompute(const CpuKernelContext& ctx)
+{
+    auto x = PtrToPtr<void, T>(xTensor_->GetData());
+    auto y = PtrToPtr<void, T>(yTensor_->GetData());
+    int64_t xNum = xTensor_->NumElements();
+    int64_t yNum = yTensor_->NumElements();
+    if (xNum == 0) {
+        KERNEL_LOG_DEBUG("x size is zero.");
+        std::fill(y, y + yNum, static_cast<T>(Acc()));
+        return KERNEL_STATUS_OK;
+    }
+
+    KernelStatus ret = BuildPlan(xTensor_->GetTensorShape()->GetDimSizes());
+    if (ret != KERNEL_STATUS_OK) {
+        return ret;
+    }
+    if (plan_.noReduce) {
+        KERNEL_CHECK_FALSE(
+            (xNum == yNum), KERNEL_STATUS_PARAM_INVALID, "The output size [%ld] should be same with input [%ld].", yNum,
+            xNum);
+        std::copy(x, x + xNum, y);
+        return KERNEL_STATUS_OK;
+    }
+    int64_t expectNum = static_cast<int64_t>(plan_.keptOffsets.size()) * (plan_.innerReduce ? 1 : plan_.innerLen);
+    KERNEL_CHECK_FALSE(
+        (expectNum == yNum), KERNEL_STATUS_PARAM_INVALID, "The output size should be [%ld], but got [%ld].", expectNum,
+        yNum);
+    if (plan_.innerReduce) {
+        return ComputeInnerReduce<T, Acc>(ctx, x, y);
+    }
+    return ComputeOuterReduce<T, Acc>(ctx, x, y);
+}
+
+uint32_t ReduceSumKernel::Compute(CpuKernelContext& ctx)
+{
+    KernelStatus res = GetInputAndCheck(ctx);
+    KERNEL_CHECK_FALSE(
+        (res == KERNEL_STATUS_OK), static_cast<uint32_t>(res), "GetInputAndCheck failed, result = [%u].", res);
+
+    // 低精度浮点用float累加，整数在64位上累加后截断回原类型，bool累加后非0即为true
+    switch (xDtype_) {
+        REDUCE_SUM_COMPUTE_CASE(DT_FLOAT16, Eigen::half, float, ctx)
+        REDUCE_SUM_COMPUTE_CASE(DT_BF16, Eigen::bfloat16, float, ctx)
+        REDUCE_SUM_COMPUTE_CASE(DT_FLOAT, float, float, ctx)
+        REDUCE_SUM_COMPUTE_CASE(DT_DOUBLE, double, double, ctx)
+        REDUCE_SUM_COMPUTE_CASE(DT_INT8, int8_t, int64_t, ctx)
+        REDUCE_SUM_COMPUTE_CASE(DT_INT16, int16_t, int64_t, ctx)
+        REDUCE_SUM_COMPUTE_CASE(DT_INT32, int32_t, int64_t, ctx)
+        REDUCE_SUM_COMPUTE_CASE(DT_INT64, int64_t, int64_t, ctx)
+        REDUCE_SUM_COMPUTE_CASE(DT_UINT8, uint8_t, uint64_t, ctx)
+        REDUCE_SUM_COMPUTE_CASE(DT_UINT16, uint16_t, uint64_t, ctx)
+        REDUCE_SUM_COMPUTE_CASE(DT_UINT32, uint32_t, uint64_t, ctx)
+        REDUCE_SUM_COMPUTE_CASE(DT_UINT64, uint64_t, uint64_t, ctx)
+        REDUCE_SUM_COMPUTE_CASE(DT_BOOL, bool, int64_t, ctx)
+        REDUCE_SUM_COMPUTE_CASE(DT_COMPLEX64, std::complex<float>, std::complex<float>, ctx)
+        REDUCE_SUM_COMPUTE_CASE(DT_COMPLEX128, std::complex<double>, std::complex<double>, ctx)
+        default:
+            KERNEL_LOG_ERROR("ReduceSum op doesn't support input tensor types: [%s]", DTypeStr(xDtype_).c_str());
+            return static_cast<uint32_t>(KERNEL_STATUS_PARAM_INVALID);
+    }
+}
+
+REGISTER_CPU_KERNEL(kReduceSum, ReduceSumKernel);
+} // namespace aicpu
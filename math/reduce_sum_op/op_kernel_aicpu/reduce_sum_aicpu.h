@@ -0,0 +1,57 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef AICPU_KERNELS_NORMALIZED_REDUCE_SUM_H
+#define AICPU_KERNELS_NORMALIZED_REDUCE_SUM_H
+
+#include <vector>
+#include "cpu_kernel.h"
+#include "utils/status.h"
+
+namespace aicpu {
+
+// 合并相邻同类轴后的归约计划：输出块按保留轴行优先排列，最内连续维单独处理
+struct ReducePlan {
+    std::vector<int64_t> keptOffsets;   // 每个输出块在输入中的起始偏移（不含最内维）
+    std::vector<int64_t> reduceOffsets; // 每个归约行相对输出块起点的偏移（不含最内维）
+    int64_t innerLen = 1;               // 最内连续维长度
+    bool innerReduce = false;           // 最内连续维是否为归约维
+    bool noReduce = false;              // 没有需要归约的轴，直接拷贝
+};
+
+class ReduceSumKernel : public CpuKernel {
+public:
+    ~ReduceSumKernel() override = default;
+    uint32_t Compute(CpuKernelContext& ctx) override;
+
+private:
+    KernelStatus GetInputAndCheck(const CpuKernelContext& ctx);
+    KernelStatus BuildPlan(const std::vector<int64_t>& xDims);
+
+    template <typename T, typename Acc>
+    KernelStatus DoCompute(const CpuKernelContext& ctx);
+    template <typename T, typename Acc>
+    KernelStatus ComputeInnerReduce(const CpuKernelContext& ctx, const T* x, T* y);
+    template <typename T, typename Acc>
+    KernelStatus ComputeOuterReduce(const CpuKernelContext& ctx, const T* x, T* y);
+
+    bool keepDims_ = false;
+    bool noopWithEmptyAxes_ = true;
+    DataType xDtype_ = DT_FLOAT;
+    std::vector<int64_t> axes_;
+    ReducePlan plan_;
+
+    Tensor* xTensor_ = nullptr;
+    Tensor* axesTensor_ = nullptr;
+    Tensor* yTensor_ = nullptr;
+};
+} // namespace aicpu
+#endif
@@ -0,0 +1,171 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "gtest/gtest.h"
+#ifndef private
+#define private public
+#define protected public
+#endif
+#include "aicpu_test_utils.h"
+#include "cpu_kernel_utils.h"
+#include "node_def_builder.h"
+#include "aicpu_read_file.h"
+#undef private
+#undef protected
+#include <complex>
+#include <vector>
+#include "Eigen/Core"
+
+using namespace std;
+using namespace aicpu;
+
+class TEST_ReduceSum_UTest : public testing::Test {};
+
+namespace {
+template <typename T>
+uint32_t RunReduceSum(
+    DataType dtype, std::vector<int64_t> xShape, std::vector<T>& x, std::vector<int64_t> axes,
+    std::vector<int64_t> yShape, std::vector<T>& y, bool keepDims = false)
+{
+    auto nodeDef = CpuKernelUtils::CreateNodeDef();
+    nodeDef->SetOpType("ReduceSum");
+    auto keepDimsAttr = CpuKernelUtils::CreateAttrValue();
+    keepDimsAttr->SetBool(keepDims);
+    nodeDef->AddAttrs("keep_dims", keepDimsAttr.get());
+    auto inputTensor0 = nodeDef->AddInputs();
+    EXPECT_NE(inputTensor0, nullptr);
+    inputTensor0->GetTensorShape()->SetDimSizes(xShape);
+    inputTensor0->SetDataType(dtype);
+    inputTensor0->SetData(x.data());
+    inputTensor0->SetDataSize(x.size() * sizeof(T));
+    auto inputTensor1 = nodeDef->AddInputs();
+    EXPECT_NE(inputTensor1, nullptr);
+    inputTensor1->GetTensorShape()->SetDimSizes({static_cast<int64_t>(axes.size())});
+    inputTensor1->SetDataType(DT_INT64);
+    inputTensor1->SetData(axes.data());
+    inputTensor1->SetDataSize(axes.size() * sizeof(int64_t));
+    auto outputTensor0 = nodeDef->AddOutputs();
+    EXPECT_NE(outputTensor0, nullptr);
+    outputTensor0->GetTensorShape()->SetDimSizes(yShape);
+    outputTensor0->SetDataType(dtype);
+    outputTensor0->SetData(y.data());
+    outputTensor0->SetDataSize(y.size() * sizeof(T));
+    CpuKernelContext ctx(DEVICE);
+    EXPECT_EQ(ctx.Init(nodeDef.get()), KERNEL_STATUS_OK);
+    return CpuKernelRegister::Instance().RunCpuKernel(ctx);
+}
+
+std::vector<double> Iota(int64_t num)
+{
+    std::vector<double> data(num);
+    for (int64_t i = 0; i < num; i++) {
+        data[i] = static_cast<double>(i);
+    }
+    return data;
+}
+} // namespace
+
+TEST_F(TEST_ReduceSum_UTest, ReduceSum_Success_InnerAxis)
+{
+    std::vector<double> x = Iota(2 * 3 * 4);
+    std::vector<double> y(2 * 3, 0);
+    std::vector<double> expected = {6, 22, 38, 54, 70, 86};
+    EXPECT_EQ(RunReduceSum<double>(DT_DOUBLE, {2, 3, 4}, x, {2}, {2, 3}, y), KERNEL_STATUS_OK);
+    EXPECT_EQ(y, expected);
+}
+
+TEST_F(TEST_ReduceSum_UTest, ReduceSum_Success_OuterAxis)
+{
+    std::vector<double> x = Iota(2 * 3 * 4);
+    std::vector<double> y(3 * 4, 0);
+    std::vector<double> expected = {12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34};
+    EXPECT_EQ(RunReduceSum<double>(DT_DOUBLE, {2, 3, 4}, x, {0}, {1, 3, 4}, y, true), KERNEL_STATUS_OK);
+    EXPECT_EQ(y, expected);
+}
+
+TEST_F(TEST_ReduceSum_UTest, ReduceSum_Success_MiddleAxis)
+{
+    std::vector<double> x = Iota(2 * 3 * 4);
+    std::vector<double> y(2 * 4, 0);
+    std::vector<double> expected = {12, 15, 18, 21, 48, 51, 54, 57};
+    EXPECT_EQ(RunReduceSum<double>(DT_DOUBLE, {2, 3, 4}, x, {-2}, {2, 4}, y), KERNEL_STATUS_OK);
+    EXPECT_EQ(y, expected);
+}
+
+TEST_F(TEST_ReduceSum_UTest, ReduceSum_Success_AllAxes)
+{
+    std::vector<double> x = Iota(2 * 3 * 4);
+    std::vector<double> y(1, 0);
+    std::vector<double> expected = {276};
+    EXPECT_EQ(RunReduceSum<double>(DT_DOUBLE, {2, 3, 4}, x, {0, 1, 2}, {}, y), KERNEL_STATUS_OK);
+    EXPECT_EQ(y, expected);
+}
+
+TEST_F(TEST_ReduceSum_UTest, ReduceSum_Success_Int8_Wraparound)
+{
+    std::vector<int8_t> x = {100, 100, 100, -100, -100, -100};
+    std::vector<int8_t> y(2, 0);
+    std::vector<int8_t> expected = {44, -44};
+    EXPECT_EQ(RunReduceSum<int8_t>(DT_INT8, {2, 3}, x, {1}, {2}, y), KERNEL_STATUS_OK);
+    EXPECT_EQ(y, expected);
+}
+
+TEST_F(TEST_ReduceSum_UTest, ReduceSum_Success_Complex64)
+{
+    std::vector<std::complex<float>> x = {{1, 2}, {3, 4}, {5, 6}, {7, 8}};
+    std::vector<std::complex<float>> y(2);
+    std::vector<std::complex<float>> expected = {{6, 8}, {10, 12}};
+    EXPECT_EQ(RunReduceSum<std::complex<float>>(DT_COMPLEX64, {2, 2}, x, {0}, {2}, y), KERNEL_STATUS_OK);
+    EXPECT_EQ(y, expected);
+}
+
+TEST_F(TEST_ReduceSum_UTest, ReduceSum_Success_Float_Pairwise)
+{
+    // 逐个顺序累加时加到2^24后再加1会被舍掉，两两求和可以精确得到结果
+    const int64_t num = 1 << 25;
+    std::vector<float> x(num, 1.0f);
+    std::vector<float> y(1, 0);
+    EXPECT_EQ(RunReduceSum<float>(DT_FLOAT, {num}, x, {0}, {}, y), KERNEL_STATUS_OK);
+    EXPECT_EQ(y[0], static_cast<float>(num));
+}
+
+TEST_F(TEST_ReduceSum_UTest, ReduceSum_Axis_Out_Of_Range_Error)
+{
+    std::vector<double> x = Iota(2 * 3);
+    std::vector<double> y(2, 0);
+    EXPECT_EQ(RunReduceSum<double>(DT_DOUBLE, {2, 3}, x, {2}, {2}, y), KERNEL_STATUS_PARAM_INVALID);
+}
+
+TEST_F(TEST_ReduceSum_UTest, ReduceSum_Success_Bf16)
+{
+    std::vector<Eigen::bfloat16> x(2 * 256, Eigen::bfloat16(1.0f));
+    std::vector<Eigen::bfloat16> y(2, Eigen::bfloat16(0.0f));
+    // bf16逐个累加到256后再加1会被舍掉，float累加可以精确得到结果
+    EXPECT_EQ(RunReduceSum<Eigen::bfloat16>(DT_BF16, {2, 256}, x, {1}, {2}, y), KERNEL_STATUS_OK);
+    EXPECT_EQ(static_cast<float>(y[0]), 256.0f);
+    EXPECT_EQ(static_cast<float>(y[1]), 256.0f);
+}
+
+TEST_F(TEST_ReduceSum_UTest, ReduceSum_Success_Bool)
+{
+    std::vector<uint8_t> x = {1, 0, 1, 0, 0, 0};
+    std::vector<uint8_t> y(2, 0);
+    std::vector<uint8_t> expected = {1, 0};
+    EXPECT_EQ(RunReduceSum<uint8_t>(DT_BOOL, {2, 3}, x, {1}, {2}, y), KERNEL_STATUS_OK);
+    EXPECT_EQ(y, expected);
+}
+
+TEST_F(TEST_ReduceSum_UTest, ReduceSum_Input_Type_Error)
+{
+    std::vector<uint8_t> x = {1, 0};
+    std::vector<uint8_t> y(1, 0);
+    EXPECT_EQ(RunReduceSum<uint8_t>(DT_STRING, {2}, x, {0}, {}, y), KERNEL_STATUS_PARAM_INVALID);
+}
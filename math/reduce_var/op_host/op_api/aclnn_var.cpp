@@ -14,6 +14,7 @@
 #include "../../../reduce_std_v2_update/op_host/op_api/reduce_std_v2_update.h"
 #include "../../../reduce_mean/op_api/reduce_mean.h"
 #include "../../../expand/op_host/op_api/expand.h"
+#include "../../../welford_var_mean/op_host/op_api/welford_var_mean.h"
 #include "aclnn_kernels/cast.h"
 #include "aclnn_kernels/contiguous.h"
 #include "aclnn_kernels/transdata.h"
@@ -162,6 +163,27 @@ static aclnnStatus aclnnVarImplUnify(
     return ACLNN_SUCCESS;
 }
 
+// 单遍Welford kernel直接输出方差，替代ReduceMean->Expand->ReduceStdV2Update三个kernel
+static aclnnStatus aclnnVarImplWelford(
+    const aclTensor* self, const aclIntArray* dim, int64_t correction, bool keepdim, aclTensor* out,
+    uint64_t* workspaceSize, UniqueExecutor& uniqueExecutor, aclOpExecutor** executor)
+{
+    auto welfordOut = l0op::WelfordVarMean(self, dim, correction, keepdim, false, uniqueExecutor.get());
+
+    auto varOut = std::get<0>(welfordOut);
+    CHECK_RET(varOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    auto castOut = l0op::Cast(varOut, out->GetDataType(), uniqueExecutor.get());
+    CHECK_RET(castOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    auto viewCopyResult = l0op::ViewCopy(castOut, out, uniqueExecutor.get());
+    CHECK_RET(viewCopyResult != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    // 获取计算过程中需要使用的workspace大小
+    *workspaceSize = uniqueExecutor->GetWorkspaceSize();
+    uniqueExecutor.ReleaseTo(executor);
+
+    return ACLNN_SUCCESS;
+}
+
 aclnnStatus aclnnVarGetWorkspaceSize(
     const aclTensor* self, const aclIntArray* dim, bool unbiased, bool keepdim, aclTensor* out, uint64_t* workspaceSize,
     aclOpExecutor** executor)
@@ -203,6 +225,10 @@ aclnnStatus aclnnVarGetWorkspaceSize(
         return aclnnVarImplUnify(
             selfReformat, dimArray, unbiased, keepdim, out, workspaceSize, uniqueExecutor, executor);
     }
+    if (l0op::IsWelfordVarMeanSupport(selfReformat, dimArray)) {
+        return aclnnVarImplWelford(
+            selfReformat, dimArray, unbiased ? 1 : 0, keepdim, out, workspaceSize, uniqueExecutor, executor);
+    }
 
     // 调用mean算子kernel
     auto meanOpOut = l0op::ReduceMean(selfReformat, dimArray, true, uniqueExecutor.get());
@@ -328,6 +354,10 @@ aclnnStatus aclnnVarCorrectionGetWorkspaceSize(
         return aclnnVarCorrectionImplUnify(
             selfReformat, dimArray, correction, keepdim, out, workspaceSize, uniqueExecutor, executor);
     }
+    if (l0op::IsWelfordVarMeanSupport(selfReformat, dimArray)) {
+        return aclnnVarImplWelford(
+            selfReformat, dimArray, correction, keepdim, out, workspaceSize, uniqueExecutor, executor);
+    }
 
     // 调用mean算子kernel
     auto meanOpOut = l0op::ReduceMean(selfReformat, dimArray, true, uniqueExecutor.get());
@@ -14,6 +14,7 @@
 #include "../../../reduce_std_v2_update/op_host/op_api/reduce_std_v2_update.h"
 #include "../../../reduce_mean/op_api/reduce_mean.h"
 #include "../../../expand/op_host/op_api/expand.h"
+#include "../../../welford_var_mean/op_host/op_api/welford_var_mean.h"
 #include "aclnn_kernels/reshape.h"
 #include "aclnn_kernels/cast.h"
 #include "aclnn_kernels/contiguous.h"
@@ -158,6 +159,34 @@ static aclnnStatus aclnnVarMeanImplUnify(
     return ACLNN_SUCCESS;
 }
 
+// 单遍Welford kernel同时输出方差与均值，替代ReduceMean->Expand->ReduceStdV2UpdateCorrection
+static aclnnStatus aclnnVarMeanImplWelford(
+    const aclTensor* self, const aclIntArray* dim, int64_t correction, bool keepdim, aclTensor* varOut,
+    aclTensor* meanOut, uint64_t* workspaceSize, UniqueExecutor& uniqueExecutor, aclOpExecutor** executor)
+{
+    auto welfordOut = l0op::WelfordVarMean(self, dim, correction, keepdim, false, uniqueExecutor.get());
+
+    auto varOpOut = std::get<0>(welfordOut);
+    CHECK_RET(varOpOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    auto castOut = l0op::Cast(varOpOut, varOut->GetDataType(), uniqueExecutor.get());
+    CHECK_RET(castOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    auto viewCopyResult = l0op::ViewCopy(castOut, varOut, uniqueExecutor.get());
+    CHECK_RET(viewCopyResult != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    auto meanOpOut = std::get<1>(welfordOut);
+    CHECK_RET(meanOpOut != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    auto castOut1 = l0op::Cast(meanOpOut, meanOut->GetDataType(), uniqueExecutor.get());
+    CHECK_RET(castOut1 != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    auto viewCopyResult1 = l0op::ViewCopy(castOut1, meanOut, uniqueExecutor.get());
+    CHECK_RET(viewCopyResult1 != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    // 获取计算过程中需要使用的workspace大小
+    *workspaceSize = uniqueExecutor->GetWorkspaceSize();
+    uniqueExecutor.ReleaseTo(executor);
+
+    return ACLNN_SUCCESS;
+}
+
 aclnnStatus aclnnVarMeanGetWorkspaceSize(
     const aclTensor* self, const aclIntArray* dim, int64_t correction, bool keepdim, aclTensor* varOut,
     aclTensor* meanOut, uint64_t* workspaceSize, aclOpExecutor** executor)
@@ -210,6 +239,12 @@ aclnnStatus aclnnVarMeanGetWorkspaceSize(
         return aclnnVarMeanImplUnify(
             selfReformat, dimArray, correction, keepdim, varOut, meanOut, workspaceSize, uniqueExecutor, executor);
     }
+    // shapeProd小于等于correction的NAN/INF场景仍走下方的填充逻辑
+    if (CalcShapeProdStdAndVarMean(self, dimArray) > correction &&
+        l0op::IsWelfordVarMeanSupport(selfReformat, dimArray)) {
+        return aclnnVarMeanImplWelford(
+            selfReformat, dimArray, correction, keepdim, varOut, meanOut, workspaceSize, uniqueExecutor, executor);
+    }
 
     // 调用mean算子kernel
     auto meanOpOut = l0op::ReduceMean(selfReformat, dimArray, keepdim, uniqueExecutor.get());
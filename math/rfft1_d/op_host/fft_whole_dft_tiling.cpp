@@ -0,0 +1,148 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file fft_whole_dft_tiling.cpp
+ * \brief
+ */
+
+#include "fft_whole_dft_tiling.h"
+#include "log/log.h"
+#include "util/math_util.h"
+
+namespace optiling {
+static const uint32_t COMPLEX_PART = 2;
+static const size_t COMPLEX_DIM_OFFSET = 1;
+static const size_t POINT_DIM_OFFSET = 2;
+static const int64_t C2C_MAX_LENGTH = 2048;
+static const int64_t C2R_MAX_LENGTH = 4096;
+static const uint32_t DFT_ALIGN = 16;
+static const size_t SYS_WORKSPACE_SIZE = 16 * 1024 * 1024;
+static const int64_t NORM_BACKWARD = 1;
+static const int64_t NORM_ORTHO = 3;
+
+ge::graphStatus FftWholeDftTiling::GetPlatformInfo()
+{
+    auto platformPtr = context_->GetPlatformInfo();
+    if (platformPtr == nullptr) {
+        auto compileInfoPtr = reinterpret_cast<const FftWholeDftCompileInfo*>(context_->GetCompileInfo());
+        OP_CHECK_IF(compileInfoPtr == nullptr, OP_LOGE(context_, "compile info is null"), return ge::GRAPH_FAILED);
+        coreNum = static_cast<uint32_t>(compileInfoPtr->coreNum);
+    } else {
+        auto ascendcPlatform = platform_ascendc::PlatformAscendC(platformPtr);
+        coreNum = ascendcPlatform.GetCoreNum();
+    }
+    OP_CHECK_IF(coreNum < 1, OP_LOGE(context_->GetNodeName(), "core num is 0"), return ge::GRAPH_FAILED);
+    return ge::GRAPH_SUCCESS;
+}
+
+ge::graphStatus FftWholeDftTiling::GetShapeAttrsInfo()
+{
+    auto runtimeAttrs = context_->GetAttrs();
+    OP_CHECK_NULL_WITH_CONTEXT(context_, runtimeAttrs);
+    const int64_t* lengthPtr = runtimeAttrs->GetAttrPointer<int64_t>(0);
+    const int64_t* normPtr = runtimeAttrs->GetAttrPointer<int64_t>(1);
+    OP_CHECK_NULL_WITH_CONTEXT(context_, lengthPtr);
+    OP_CHECK_NULL_WITH_CONTEXT(context_, normPtr);
+    length = *lengthPtr;
+    normal = *normPtr;
+
+    const int64_t maxLength = kind_ == FftWholeDftKind::C2C ? C2C_MAX_LENGTH : C2R_MAX_LENGTH;
+    OP_CHECK_IF(
+        length < 1 || length > maxLength,
+        OP_LOGE(context_->GetNodeName(), "n should be in [1, %ld], but got %ld", maxLength, length),
+        return ge::GRAPH_FAILED);
+    OP_CHECK_IF(
+        normal < NORM_BACKWARD || normal > NORM_ORTHO,
+        OP_LOGE(context_->GetNodeName(), "Incorrect norm parameter value %ld", normal), return ge::GRAPH_FAILED);
+
+    auto inputXDesc = context_->GetInputDesc(0);
+    OP_CHECK_NULL_WITH_CONTEXT(context_, inputXDesc);
+    OP_CHECK_IF(
+        inputXDesc->GetDataType() != ge::DataType::DT_FLOAT,
+        OP_LOGE(context_->GetNodeName(), "x only support float32"), return ge::GRAPH_FAILED);
+
+    auto inputX = context_->GetInputShape(0);
+    OP_CHECK_NULL_WITH_CONTEXT(context_, inputX);
+    const gert::Shape& xShape = inputX->GetStorageShape();
+    const size_t dimNum = xShape.GetDimNum();
+    OP_CHECK_IF(
+        dimNum < POINT_DIM_OFFSET || xShape.GetDim(dimNum - COMPLEX_DIM_OFFSET) != COMPLEX_PART,
+        OP_LOGE(context_->GetNodeName(), "x should be complex stored as [..., points, 2]"), return ge::GRAPH_FAILED);
+
+    // Irfft1D只读入非负频率部分，其余频点由dft矩阵按Hermitian对称折叠
+    const int64_t points = kind_ == FftWholeDftKind::C2C ? length : length / COMPLEX_PART + 1;
+    OP_CHECK_IF(
+        xShape.GetDim(dimNum - POINT_DIM_OFFSET) != points,
+        OP_LOGE(
+            context_->GetNodeName(), "x points should be %ld, but got %ld", points,
+            xShape.GetDim(dimNum - POINT_DIM_OFFSET)),
+        return ge::GRAPH_FAILED);
+    for (size_t i = 0; i < dimNum - POINT_DIM_OFFSET; i++) {
+        batches *= static_cast<uint64_t>(xShape.GetDim(i));
+    }
+    OP_CHECK_IF(batches == 0, OP_LOGE(context_->GetNodeName(), "x should not be empty"), return ge::GRAPH_FAILED);
+
+    inLength = static_cast<uint32_t>(points * COMPLEX_PART);
+    outLength = static_cast<uint32_t>(kind_ == FftWholeDftKind::C2C ? length * COMPLEX_PART : length);
+    return ge::GRAPH_SUCCESS;
+}
+
+ge::graphStatus FftWholeDftTiling::PostTiling()
+{
+    context_->SetBlockDim(coreNum);
+    context_->SetTilingKey(0);
+    tiling.SaveToBuffer(context_->GetRawTilingData()->GetData(), context_->GetRawTilingData()->GetCapacity());
+    context_->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+
+    // 整段DFT只使用matmul所需的系统workspace
+    size_t* currentWorkspace = context_->GetWorkspaceSizes(1);
+    OP_CHECK_NULL_WITH_CONTEXT(context_, currentWorkspace);
+    currentWorkspace[0] = SYS_WORKSPACE_SIZE;
+    return ge::GRAPH_SUCCESS;
+}
+
+ge::graphStatus FftWholeDftTiling::DoTiling()
+{
+    auto ret = GetPlatformInfo();
+    if (ret != ge::GRAPH_SUCCESS) {
+        return ret;
+    }
+    ret = GetShapeAttrsInfo();
+    if (ret != ge::GRAPH_SUCCESS) {
+        return ret;
+    }
+
+    tiling.set_length(static_cast<uint32_t>(length));
+    tiling.set_inLength(inLength);
+    tiling.set_outLength(outLength);
+    tiling.set_batchesPerCore(static_cast<uint32_t>(batches / coreNum));
+    tiling.set_leftOverBatches(static_cast<uint32_t>(batches % coreNum));
+    tiling.set_normal(static_cast<int32_t>(normal));
+    tiling.set_dftOverallSize(Ops::Base::CeilAlign(inLength, DFT_ALIGN) * Ops::Base::CeilAlign(outLength, DFT_ALIGN));
+    return PostTiling();
+}
+
+ge::graphStatus TilingPrepare4FftWholeDft(gert::TilingParseContext* context)
+{
+    fe::PlatFormInfos* platformInfoPtr = context->GetPlatformInfo();
+    OP_CHECK_IF(platformInfoPtr == nullptr, OP_LOGE(context, "platformInfoPtr is null"), return ge::GRAPH_FAILED);
+
+    auto compileInfoPtr = context->GetCompiledInfo<FftWholeDftCompileInfo>();
+    OP_CHECK_IF(
+        compileInfoPtr == nullptr, OP_LOGE(context->GetNodeName(), "compileInfoPtr is null"), return ge::GRAPH_FAILED);
+
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(platformInfoPtr);
+    compileInfoPtr->coreNum = ascendcPlatform.GetCoreNum();
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, compileInfoPtr->ubSize);
+    return ge::GRAPH_SUCCESS;
+}
+} // namespace optiling
@@ -0,0 +1,74 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file fft_whole_dft_tiling.h
+ * \brief Fft1D/Irfft1D共用的整段DFT tiling，kernel复用Rfft1D的KernelRfftFastDFT
+ */
+
+#ifndef OPS_BUILT_IN_OP_TILING_RUNTIME_FFT_WHOLE_DFT_TILING_H_
+#define OPS_BUILT_IN_OP_TILING_RUNTIME_FFT_WHOLE_DFT_TILING_H_
+
+#include "register/tilingdata_base.h"
+#include "register/op_impl_registry.h"
+#include "tiling/platform/platform_ascendc.h"
+
+namespace optiling {
+BEGIN_TILING_DATA_DEF(FftWholeDftTilingData)
+TILING_DATA_FIELD_DEF(uint32_t, length);
+TILING_DATA_FIELD_DEF(uint32_t, inLength);
+TILING_DATA_FIELD_DEF(uint32_t, outLength);
+TILING_DATA_FIELD_DEF(uint32_t, batchesPerCore);
+TILING_DATA_FIELD_DEF(uint32_t, leftOverBatches);
+TILING_DATA_FIELD_DEF(int32_t, normal);
+TILING_DATA_FIELD_DEF(uint32_t, dftOverallSize);
+END_TILING_DATA_DEF;
+
+REGISTER_TILING_DATA_CLASS(Fft1D, FftWholeDftTilingData)
+REGISTER_TILING_DATA_CLASS(Irfft1D, FftWholeDftTilingData)
+
+struct FftWholeDftCompileInfo {
+    uint64_t coreNum;
+    uint64_t ubSize;
+};
+
+enum class FftWholeDftKind : int32_t
+{
+    C2C = 0, // Fft1D/Ifft1D: x[..., n, 2] -> y[..., n, 2]
+    C2R = 1  // Irfft1D: x[..., n / 2 + 1, 2] -> y[..., n]
+};
+
+// 复数输入按(实部, 虚部)交织存放，矩阵乘的K为2倍复数点数；方向、Hermitian折叠和归一化系数均由dft矩阵承载
+class FftWholeDftTiling {
+public:
+    FftWholeDftTiling(gert::TilingContext* context, FftWholeDftKind kind) : context_(context), kind_(kind)
+    {}
+    ge::graphStatus DoTiling();
+
+private:
+    ge::graphStatus GetPlatformInfo();
+    ge::graphStatus GetShapeAttrsInfo();
+    ge::graphStatus PostTiling();
+
+    gert::TilingContext* context_ = nullptr;
+    FftWholeDftKind kind_;
+    FftWholeDftTilingData tiling;
+    uint32_t coreNum = 0;
+    int64_t length = 0;
+    int64_t normal = 0;
+    uint64_t batches = 1;
+    uint32_t inLength = 0;
+    uint32_t outLength = 0;
+};
+
+ge::graphStatus TilingPrepare4FftWholeDft(gert::TilingParseContext* context);
+} // namespace optiling
+#endif // OPS_BUILT_IN_OP_TILING_RUNTIME_FFT_WHOLE_DFT_TILING_H_
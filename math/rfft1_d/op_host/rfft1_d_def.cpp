@@ -36,6 +36,8 @@ public:
 
         this->Attr("norm").AttrType(OPTIONAL).Int();
 
+        this->Attr("factor_layout").AttrType(OPTIONAL).Int(0);
+
         this->Output("y")
             .ParamType(REQUIRED)
             .DataType({ge::DT_FLOAT})
@@ -36,6 +36,10 @@ static const uint32_t TWIDDLE_MATRICES_AMOUNT = 2;
 static const gert::Shape g_vec_1_shape = {1};
 
 static const uint32_t DFT_BORDER_VALUE = 4096;
+// factor_layout属性取值：0为贪心拆分，1为贪心拆分超过3个因子时搜索三因子组合
+static const int64_t FACTOR_LAYOUT_GREEDY = 0;
+static const int64_t FACTOR_LAYOUT_BALANCED = 1;
+static const size_t ATTR_FACTOR_LAYOUT_IDX = 2;
 
 using namespace AscendC;
 using namespace matmul_tiling;
@@ -93,7 +97,30 @@ ge::graphStatus Rfft1DTiling::GetWorkspaceSize()
     return ge::GRAPH_SUCCESS;
 }
 
-static void CalcColleyTukeyFactors(uint32_t factors[], std::vector<uint32_t> availableFactors, const uint32_t len)
+// 贪心按最大因子拆分可能得到多于3个因子(如 54080 -> 64*13*13*5)，而该长度存在 52*52*20 的三因子拆分。
+// 此时枚举降序的三因子组合(各因子不超过LAST_FACTOR)，优先首因子最大，避免退化到补零2倍的Bluestein。
+// 仅在factor_layout为FACTOR_LAYOUT_BALANCED时启用，dft输入的终止矩阵需按相同拆分生成。
+static bool SearchThreeFactors(uint32_t factors[], const uint32_t len)
+{
+    for (uint32_t first = LAST_FACTOR; first > 1; --first) {
+        if (len % first != 0) {
+            continue;
+        }
+        const uint32_t rest = len / first;
+        for (uint32_t second = first; second > 1; --second) {
+            if (rest % second == 0 && rest / second <= second) {
+                factors[0] = first;
+                factors[1] = second;
+                factors[2] = rest / second;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static void CalcColleyTukeyFactors(
+    uint32_t factors[], std::vector<uint32_t> availableFactors, const uint32_t len, const int64_t factorLayout)
 {
     std::vector<uint32_t> factorsTmp;
     int curFactorIndex = availableFactors.size() - 1;
@@ -115,6 +142,10 @@ static void CalcColleyTukeyFactors(uint32_t factors[], std::vector<uint32_t> ava
             curFactorIndex -= 1;
         }
 
+        if (factorLayout == FACTOR_LAYOUT_BALANCED && factorsTmp.size() > MAX_FACTORS_LEN &&
+            SearchThreeFactors(factors, len)) {
+            return;
+        }
         while (factorsTmp.size() < MAX_FACTORS_LEN) {
             factorsTmp.emplace_back(1);
         }
@@ -216,6 +247,12 @@ ge::graphStatus Rfft1DTiling::DoOpTiling()
     OP_CHECK_NULL_WITH_CONTEXT(context_, runtimeAttrs);
     const uint32_t len = *runtimeAttrs->GetAttrPointer<uint32_t>(0);
     const uint32_t norm = *runtimeAttrs->GetAttrPointer<uint32_t>(1);
+    const int64_t* factorLayoutPtr = runtimeAttrs->GetAttrPointer<int64_t>(ATTR_FACTOR_LAYOUT_IDX);
+    const int64_t factorLayout = factorLayoutPtr == nullptr ? FACTOR_LAYOUT_GREEDY : *factorLayoutPtr;
+    OP_CHECK_IF(
+        factorLayout != FACTOR_LAYOUT_GREEDY && factorLayout != FACTOR_LAYOUT_BALANCED,
+        OP_LOGE(context_->GetNodeName(), "factor_layout should be 0 or 1, but got %ld.", factorLayout),
+        return ge::GRAPH_FAILED);
 
     uint32_t factors[MAX_FACTORS_LEN] = {1, 1, 1};
     uint32_t prevRadices[MAX_FACTORS_LEN] = {1, 1, 1};
@@ -226,7 +263,7 @@ ge::graphStatus Rfft1DTiling::DoOpTiling()
     std::vector<uint32_t> availableFactors(LAST_FACTOR - 1);
     std::iota(availableFactors.begin(), availableFactors.end(), COMPLEX_PART);
 
-    CalcColleyTukeyFactors(factors, availableFactors, len);
+    CalcColleyTukeyFactors(factors, availableFactors, len, factorLayout);
 
     const bool isBluestein = (len % LAST_FACTOR != 0) || (factors[0] * factors[1] * factors[2] != len);
     const uint32_t pow2 = COMPLEX_PART * uint32_t(std::pow(2, std::ceil(std::log2(double(len)))));
@@ -115,14 +115,23 @@ public:
           dftOverallSize(dftOverallSize)
     {
         modeLength = (fftLength / RFFT_HALF + 1) * COMPLEX;
+        InitBatches();
+    }
 
-        cores = GetBlockNum();
-        ASSERT(cores != 0 && "block dim can not be zero!");
-
-        batches = batchesPerCore * cores + leftOverBatches;
-        advancedBatches = leftOverBatches == 0 ? 0 : cores - leftOverBatches;
-        totalBatches = batches + advancedBatches;
-        batchesPerCoreCeil = (batches + advancedBatches) / GetBlockNum();
+    // Generic whole DFT: y(batch, outLength) = x(batch, inLength) * dft(inLength, outLength).
+    // Used by Fft1D/Ifft1D (complex input, inLength = outLength = 2n) and Irfft1D (inLength = 2(n/2+1), outLength = n),
+    // the transform direction, Hermitian folding and normalization are all carried by the dft matrix.
+    __aicore__ inline KernelRfftFastDFT(
+        const uint32_t& inLength, const uint32_t& outLength, const uint32_t& batchesPerCore,
+        const uint32_t& leftOverBatches, const uint32_t& dftOverallSize)
+        : fftLength(inLength),
+          norm(0),
+          batchesPerCore(batchesPerCore),
+          leftOverBatches(leftOverBatches),
+          dftOverallSize(dftOverallSize)
+    {
+        modeLength = outLength;
+        InitBatches();
     }
 
     __aicore__ inline void Init(GM_ADDR x, GM_ADDR dftMatrix, GM_ADDR y, GM_ADDR workspace)
@@ -141,6 +150,17 @@ public:
     }
 
 private:
+    __aicore__ inline void InitBatches()
+    {
+        cores = GetBlockNum();
+        ASSERT(cores != 0 && "block dim can not be zero!");
+
+        batches = batchesPerCore * cores + leftOverBatches;
+        advancedBatches = leftOverBatches == 0 ? 0 : cores - leftOverBatches;
+        totalBatches = batches + advancedBatches;
+        batchesPerCoreCeil = (batches + advancedBatches) / GetBlockNum();
+    }
+
     // Copies the input from GM, normalizes it and splits the input
     __aicore__ inline void CopyIn()
     {
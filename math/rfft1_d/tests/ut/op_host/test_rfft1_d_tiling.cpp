@@ -9,7 +9,9 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 
+#include <cstring>
 #include <iostream>
+#include <vector>
 #include <gtest/gtest.h>
 #include "tiling_context_faker.h"
 #include "tiling_case_executor.h"
@@ -61,3 +63,103 @@ TEST_F(Rfft1DTiling, ascend910B1_test_tiling__001)
     std::vector<size_t> expectWorkspaces = {2164260864};
     ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
 }
+
+static gert::TilingContextPara MakeRfft1DPara(
+    int64_t len, int64_t batch, int64_t factorLayout, Rfft1DCompileInfo& compileInfo)
+{
+    return gert::TilingContextPara(
+        "Rfft1D",
+        {
+            {{{batch, len}, {batch, len}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{batch, len / 2 + 1, 2}, {batch, len / 2 + 1, 2}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            gert::TilingContextPara::OpAttr("n", Ops::Math::AnyValue::CreateFrom<int64_t>(len)),
+            gert::TilingContextPara::OpAttr("norm", Ops::Math::AnyValue::CreateFrom<int64_t>(1)),
+            gert::TilingContextPara::OpAttr("factor_layout", Ops::Math::AnyValue::CreateFrom<int64_t>(factorLayout)),
+        },
+        &compileInfo);
+}
+
+// 54080 = 64*13*13*5，贪心拆分超过3个因子，factor_layout=1时应选用 52*52*20 走Cooley-Tukey
+TEST_F(Rfft1DTiling, ascend910B1_test_tiling_balanced_factors_002)
+{
+    Rfft1DCompileInfo compileInfo = {48, 196608, true};
+    uint64_t expectTilingKey = 0;
+    string expectTilingData =
+        "54080 223338353472 85899345972 223338299393 232271831370384 223338300432 116140210716928 2 "
+        "1394455621926916 33466934927544576 4326135808 13331578495296 1025432031968160 23227183136768 8112 "
+        "11613591568384 0 5408 ";
+    std::vector<size_t> expectWorkspaces = {2164260864};
+    ExecuteTestCase(
+        MakeRfft1DPara(54080, 4, 1, compileInfo), ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData,
+        expectWorkspaces);
+}
+
+// 85184 = 64*11*11*11，factor_layout=1时拆分为 44*44*44
+TEST_F(Rfft1DTiling, ascend910B1_test_tiling_balanced_factors_003)
+{
+    Rfft1DCompileInfo compileInfo = {48, 196608, true};
+    uint64_t expectTilingKey = 0;
+    string expectTilingData =
+        "85184 188978646208 188978561068 188978561025 365862494144400 188978562960 182935542104320 2 "
+        "2196411915436036 52713885972510336 4344060928 16630113377856 1546600543594656 16630113370112 5808 "
+        "8315056685056 0 3872 ";
+    std::vector<size_t> expectWorkspaces = {2164260864};
+    ExecuteTestCase(
+        MakeRfft1DPara(85184, 4, 1, compileInfo), ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData,
+        expectWorkspaces);
+}
+
+// 长度扫描：2^13~2^22 及若干素数(不超过4096的长度走整段DFT，不在此校验)，检查计算路径与补零长度
+TEST_F(Rfft1DTiling, ascend910B1_test_tiling_path_sweep_004)
+{
+    // Rfft1DTilingData 的头部字段
+    struct Rfft1DTilingHead {
+        int32_t length;
+        uint8_t isBluestein;
+        int32_t lengthPad;
+        uint32_t factors[3];
+    };
+    struct SweepCase {
+        int64_t len;
+        int64_t factorLayout;
+        bool isBluestein;
+        int32_t lengthPad;
+    };
+    // factor_layout=0保持贪心拆分，54080/85184仍走Bluestein，与按贪心规则生成的终止矩阵一致
+    const std::vector<SweepCase> cases = {
+        {8192, 0, false, 8192},       {16384, 0, false, 16384},     {32768, 0, false, 32768},
+        {65536, 0, false, 65536},     {131072, 0, false, 131072},   {262144, 0, false, 262144},
+        {524288, 0, false, 524288},   {54080, 0, true, 131072},     {85184, 0, true, 262144},
+        {54080, 1, false, 54080},     {85184, 1, false, 85184},     {65536, 1, false, 65536},
+        {4099, 1, true, 16384},       {65521, 0, true, 131072},     {131071, 0, true, 262144},
+        {524287, 0, true, 1048576},   {1048576, 0, true, 2097152},  {4194304, 0, true, 8388608},
+    };
+    Rfft1DCompileInfo compileInfo = {48, 196608, true};
+    for (const auto& sweepCase : cases) {
+        TilingInfo tilingInfo;
+        ASSERT_TRUE(ExecuteTiling(MakeRfft1DPara(sweepCase.len, 4, sweepCase.factorLayout, compileInfo), tilingInfo));
+        ASSERT_GE(tilingInfo.tilingDataSize, sizeof(Rfft1DTilingHead));
+        Rfft1DTilingHead head;
+        memcpy(&head, tilingInfo.tilingData.get(), sizeof(head));
+        EXPECT_EQ(head.isBluestein != 0, sweepCase.isBluestein)
+            << "len " << sweepCase.len << " layout " << sweepCase.factorLayout;
+        EXPECT_EQ(head.lengthPad, sweepCase.lengthPad)
+            << "len " << sweepCase.len << " layout " << sweepCase.factorLayout;
+        if (!sweepCase.isBluestein) {
+            EXPECT_EQ(
+                static_cast<int64_t>(head.factors[0]) * head.factors[1] * head.factors[2], sweepCase.len);
+        }
+    }
+}
+
+// factor_layout只支持0和1
+TEST_F(Rfft1DTiling, ascend910B1_test_tiling_invalid_factor_layout_005)
+{
+    Rfft1DCompileInfo compileInfo = {48, 196608, true};
+    TilingInfo tilingInfo;
+    EXPECT_FALSE(ExecuteTiling(MakeRfft1DPara(54080, 4, 2, compileInfo), tilingInfo));
+}
@@ -56,7 +56,7 @@ static bool CheckDtypeEqual(const aclTensor* self, const aclTensor* out)
     return true;
 }
 
-static bool CheckShape(const aclTensor* self, const aclTensor* out)
+static bool CheckShape(const aclTensor* self, const aclTensor* out, bool cumsumOnly)
 {
     auto selfShape = self->GetViewShape();
     auto outShape = out->GetViewShape();
@@ -68,6 +68,11 @@ static bool CheckShape(const aclTensor* self, const aclTensor* out)
             FOURDIMS, selfDimSize);
         return false;
     }
+    if (cumsumOnly) {
+        // 只输出末轴前缀和，out与self同shape
+        OP_CHECK_SHAPE_NOT_EQUAL(out, self, return false);
+        return true;
+    }
     if (outDimSize != selfDimSize + 1) {
         OP_LOGE(
             ACLNN_ERR_PARAM_INVALID,
@@ -114,7 +119,7 @@ static bool CheckFormat(const aclTensor* self, const aclTensor* out)
     return true;
 }
 
-static aclnnStatus CheckParams(const aclTensor* self, const aclTensor* out)
+static aclnnStatus CheckParams(const aclTensor* self, const aclTensor* out, bool cumsumOnly)
 {
     // 1. 检查参数是否为空指针
     CHECK_RET(CheckNotNull(self, out), ACLNN_ERR_PARAM_NULLPTR);
@@ -126,7 +131,7 @@ static aclnnStatus CheckParams(const aclTensor* self, const aclTensor* out)
     CHECK_RET(CheckDtypeEqual(self, out), ACLNN_ERR_PARAM_INVALID);
 
     // 4. 检查shape是否支持
-    CHECK_RET(CheckShape(self, out), ACLNN_ERR_PARAM_INVALID);
+    CHECK_RET(CheckShape(self, out, cumsumOnly), ACLNN_ERR_PARAM_INVALID);
 
     // 5. 检查format是否支持
     CHECK_RET(CheckFormat(self, out), ACLNN_ERR_PARAM_INVALID);
@@ -134,6 +139,29 @@ static aclnnStatus CheckParams(const aclTensor* self, const aclTensor* out)
     return ACLNN_SUCCESS;
 }
 
+static aclnnStatus ExpSegsumProcess(const aclTensor* self, bool cumsumOnly, aclTensor* out, aclOpExecutor* executor)
+{
+    auto ret = CheckParams(self, out, cumsumOnly);
+    CHECK_RET(ret == ACLNN_SUCCESS, ret);
+
+    auto selfContiguous = l0op::Contiguous(self, executor);
+    CHECK_RET(selfContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    // out连续时kernel直接写入，省去一次L*L规模的ViewCopy
+    if (IsContiguous(out)) {
+        auto result = l0op::SegsumOut(selfContiguous, out, executor);
+        CHECK_RET(result != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        return ACLNN_SUCCESS;
+    }
+
+    auto result = l0op::Segsum(selfContiguous, out, executor);
+    CHECK_RET(result != nullptr, ACLNN_ERR_INNER_NULLPTR);
+
+    auto viewCopyResult = l0op::ViewCopy(result, out, executor);
+    CHECK_RET(viewCopyResult != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    return ACLNN_SUCCESS;
+}
+
 aclnnStatus aclnnExpSegsumGetWorkspaceSize(
     const aclTensor* self, aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor)
 {
@@ -149,26 +177,46 @@ aclnnStatus aclnnExpSegsumGetWorkspaceSize(
         uniqueExecutor.ReleaseTo(executor);
         return ACLNN_SUCCESS;
     }
-    auto ret = CheckParams(self, out);
+    auto ret = ExpSegsumProcess(self, false, out, uniqueExecutor.get());
     CHECK_RET(ret == ACLNN_SUCCESS, ret);
 
-    auto selfContiguous = l0op::Contiguous(self, uniqueExecutor.get());
-    CHECK_RET(selfContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
+    *workspaceSize = uniqueExecutor->GetWorkspaceSize();
+    uniqueExecutor.ReleaseTo(executor);
+    return ACLNN_SUCCESS;
+}
 
-    auto result = l0op::Segsum(selfContiguous, out, uniqueExecutor.get());
-    CHECK_RET(result != nullptr, ACLNN_ERR_INNER_NULLPTR);
+aclnnStatus aclnnExpSegsum(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream)
+{
+    L2_DFX_PHASE_2(aclnnExpSegsum);
+    return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+}
 
-    auto viewCopyResult = l0op::ViewCopy(result, out, uniqueExecutor.get());
-    CHECK_RET(viewCopyResult != nullptr, ACLNN_ERR_INNER_NULLPTR);
+aclnnStatus aclnnExpSegsumV2GetWorkspaceSize(
+    const aclTensor* self, bool cumsumOnly, aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor)
+{
+    OP_CHECK_COMM_INPUT(workspaceSize, executor);
+
+    L2_DFX_PHASE_1(aclnnExpSegsumV2, DFX_IN(self, cumsumOnly), DFX_OUT(out));
+
+    auto uniqueExecutor = CREATE_EXECUTOR();
+    CHECK_RET(uniqueExecutor.get() != nullptr, ACLNN_ERR_INNER_CREATE_EXECUTOR);
+
+    if (self->IsEmpty()) {
+        *workspaceSize = 0;
+        uniqueExecutor.ReleaseTo(executor);
+        return ACLNN_SUCCESS;
+    }
+    auto ret = ExpSegsumProcess(self, cumsumOnly, out, uniqueExecutor.get());
+    CHECK_RET(ret == ACLNN_SUCCESS, ret);
 
     *workspaceSize = uniqueExecutor->GetWorkspaceSize();
     uniqueExecutor.ReleaseTo(executor);
     return ACLNN_SUCCESS;
 }
 
-aclnnStatus aclnnExpSegsum(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream)
+aclnnStatus aclnnExpSegsumV2(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream)
 {
-    L2_DFX_PHASE_2(aclnnExpSegsum);
+    L2_DFX_PHASE_2(aclnnExpSegsumV2);
     return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
 }
 
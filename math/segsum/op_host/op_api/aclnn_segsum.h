@@ -79,6 +79,38 @@ ACLNN_API aclnnStatus aclnnExpSegsumGetWorkspaceSize(
 ACLNN_API aclnnStatus
 aclnnExpSegsum(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream);
 
+/**
+ * @brief aclnnExpSegsumV2的第一段接口，根据具体的计算流程，计算workspace大小。
+ * @domain aclnn_ops_infer
+ *
+ * 算子功能：cumsumOnly为false时与aclnnExpSegsum一致；cumsumOnly为true时只输出self末轴的前缀和，
+ * out与self同shape。此时exp(segsum)[..., i, j] = exp(out[..., i] - out[..., j]) (j <= i)，
+ * 调用方可按块现场展开，无需在device侧存储L*L的结果。
+ *
+ * @param [in] self: npu device侧的aclTensor，数据类型支持FLOAT、BFLOAT16、FLOAT16。
+ * 支持非连续的Tensor。
+ * @param [in] cumsumOnly: 是否只输出前缀和。
+ * @param [out] out: npu device侧的aclTensor，数据类型与self一致。
+ * @param [out] workspaceSize: 返回用户需要在npu device侧申请的workspace大小。
+ * @param [out] executor: 返回op执行器，包含算子计算流程。
+ * @return aclnnStatus: 返回状态码。
+ */
+ACLNN_API aclnnStatus aclnnExpSegsumV2GetWorkspaceSize(
+    const aclTensor* self, bool cumsumOnly, aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor);
+
+/**
+ * @brief aclnnExpSegsumV2的第二段接口，用于执行计算。
+ *
+ * @param [in] workspace: 在npu device侧申请的workspace内存起址。
+ * @param [in] workspaceSize: 在npu device侧申请的workspace大小，
+ * 由第一段接口aclnnExpSegsumV2GetWorkspaceSize获取。
+ * @param [in] executor: op执行器，包含了算子计算流程。
+ * @param [in] stream: 指定执行任务的AscendCL Stream流。
+ * @return aclnnStatus: 返回状态码。
+ */
+ACLNN_API aclnnStatus
+aclnnExpSegsumV2(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream);
+
 #ifdef __cplusplus
 }
 #endif
@@ -34,14 +34,18 @@ OP_TYPE_REGISTER(Segsum);
 static const std::initializer_list<op::DataType> AICORE_DTYPE_SUPPORT_LIST = {
     op::DataType::DT_FLOAT, op::DataType::DT_FLOAT16, op::DataType::DT_BF16};
 
-const aclTensor* Segsum(const aclTensor* self, aclTensor* output, aclOpExecutor* executor)
+const aclTensor* SegsumOut(const aclTensor* self, const aclTensor* out, aclOpExecutor* executor)
 {
-    L0_DFX(Segsum, self);
-
-    const aclTensor* out = executor->AllocTensor(output->GetViewShape(), self->GetDataType(), self->GetStorageFormat());
-    CHECK_RET(out != nullptr, nullptr);
+    L0_DFX(Segsum, self, out);
 
     ADD_TO_LAUNCHER_LIST_AICORE(Segsum, OP_INPUT(self), OP_OUTPUT(out));
     return out;
 }
+
+const aclTensor* Segsum(const aclTensor* self, aclTensor* output, aclOpExecutor* executor)
+{
+    const aclTensor* out = executor->AllocTensor(output->GetViewShape(), self->GetDataType(), self->GetStorageFormat());
+    CHECK_RET(out != nullptr, nullptr);
+    return SegsumOut(self, out, executor);
+}
 } // namespace l0op
@@ -19,6 +19,8 @@
 #include "opdev/op_executor.h"
 
 namespace l0op {
+// 输出连续时直接写入out，省去L*L结果的ViewCopy
+const aclTensor* SegsumOut(const aclTensor* self, const aclTensor* out, aclOpExecutor* executor);
 const aclTensor* Segsum(const aclTensor* self, aclTensor* output, aclOpExecutor* executor);
 }
 
@@ -13,6 +13,7 @@
  * \file segsum_tiling.cpp
  * \brief
  */
+#include <algorithm>
 #include "segsum_tiling.h"
 
 namespace optiling {
@@ -21,14 +22,21 @@ constexpr uint64_t WORK_SPACE_SIZE = 32 * 1024 * 1024;
 
 constexpr uint8_t BYTE_LEN_4 = 4;
 constexpr uint8_t BYTE_LEN_2 = 2;
-constexpr int32_t BLOCK = 32;
 constexpr uint64_t DATE_TYPE_FLOAT16 = 1;
 constexpr uint64_t DATE_TYPE_FLOAT = 2;
 constexpr uint64_t DATE_TYPE_BF16 = 3;
 constexpr uint64_t RESERVED_LENGTH = 320;
-constexpr uint32_t COMMON_TILING_KEY = 1000;
-constexpr uint32_t SMALL_SIZE_TILING_KEY = 1001;
-constexpr uint32_t TENSOR_NUM = 4;
+constexpr uint32_t COMMON_TILING_KEY = 1000;     // 前缀和放不下UB，暂存在workspace
+constexpr uint32_t SMALL_SIZE_TILING_KEY = 1001; // 前缀和常驻UB
+constexpr uint32_t CUMSUM_TILING_KEY = 1002;     // 只输出前缀和，不展开L*L矩阵
+constexpr int64_t VEC_ELEMS = 64;                // 一个repeat处理的fp32元素数
+constexpr int64_t BRCB_ELEMS = 8;
+constexpr int64_t MAX_TILE_COLS = 512;
+constexpr int64_t MAX_TILE_ROWS = 64;            // 对角块模板按行做mask，单行不超过一个repeat
+constexpr int64_t TILE_ELEMS = 8192;
+constexpr int64_t MAX_SLIDE_SIZE = 2048;
+constexpr int64_t SLIDE_ALIGN = 16;              // fp16与fp32下搬入长度都按32B对齐
+constexpr int64_t DOUBLE_BUFFER = 2;
 
 class SegsumTiling {
 public:
@@ -37,7 +45,7 @@ public:
 
 private:
     ge::graphStatus ParseInputAttrs();
-    void GetWorkSpace(uint32_t needCoreNum);
+    void GetTileSize();
     void GetNeedCoreNum(uint32_t coreNumPlatform);
     void GetTilingKey(uint64_t ubSizePlatform);
     uint8_t GetDataTypeVal();
@@ -57,65 +65,104 @@ private:
     uint16_t dataTypeSize = 4;
     int64_t batches = 1;
     int64_t tailDimSize = 1;
-    int32_t batchStart[MAX_CORE_CONT] = {0};
-    int32_t batchEnd[MAX_CORE_CONT] = {0};
-    int32_t blockSize = 8;
+    bool cumsumOnly = false;
+    int64_t tileRows = BRCB_ELEMS;
+    int64_t tileCols = VEC_ELEMS;
+    int64_t rowTiles = 1;
+    int64_t csLength = 0;
+    int64_t unitsPerCore = 0;
+    int64_t tailUnits = 0;
     uint32_t needCoreNum = 0;
     uint32_t tilingKey = 1000;
 };
 ge::graphStatus SegsumTiling::ParseInputAttrs()
 {
     auto srcInputShape = tilingContext->GetInputShape(0);
+    OP_CHECK_NULL_WITH_CONTEXT(tilingContext, srcInputShape);
+    auto dstOutputShape = tilingContext->GetOutputShape(0);
+    OP_CHECK_NULL_WITH_CONTEXT(tilingContext, dstOutputShape);
     int32_t input_dim = srcInputShape->GetStorageShape().GetDimNum();
     inputShape = srcInputShape->GetOriginShape();
     for (int8_t i = 0; i < input_dim - 1; i++) {
         batches *= inputShape.GetDim(i);
     }
     tailDimSize = inputShape.GetDim(input_dim - 1);
+    // 输出与输入同秩时只输出前缀和，由调用方按块自行展开
+    cumsumOnly = dstOutputShape->GetStorageShape().GetDimNum() == static_cast<size_t>(input_dim);
     auto temp = tilingContext->GetInputDesc(0);
+    OP_CHECK_NULL_WITH_CONTEXT(tilingContext, temp);
     dataType = temp->GetDataType();
-    blockSize = BLOCK / dataTypeSize;
+    dataTypeSize = GetDataTypeSize();
+    OP_CHECK_IF(
+        tailDimSize <= 0 || batches <= 0,
+        OP_LOGE(tilingContext->GetNodeName(), "Segsum invalid input shape, batches %ld, tailDimSize %ld.", batches,
+            tailDimSize),
+        return ge::GRAPH_FAILED);
     return ge::GRAPH_SUCCESS;
 }
 
 ge::graphStatus SegsumTiling::RunBigKernelTiling()
 {
-    ParseInputAttrs();
-    size_t* workspaces = tilingContext->GetWorkspaceSizes(1);
-    workspaces[0] = WORK_SPACE_SIZE;
+    if (ParseInputAttrs() != ge::GRAPH_SUCCESS) {
+        return ge::GRAPH_FAILED;
+    }
     auto compileInfo = reinterpret_cast<const SegsumCompileInfo*>(tilingContext->GetCompileInfo());
+    OP_CHECK_NULL_WITH_CONTEXT(tilingContext, compileInfo);
     uint32_t coreNumPlatform = compileInfo->coreNum;
     uint64_t ubSizePlatform = compileInfo->ubSize;
+    GetTileSize();
     GetNeedCoreNum(coreNumPlatform);
     GetTilingKey(ubSizePlatform);
+    size_t* workspaces = tilingContext->GetWorkspaceSizes(1);
+    workspaces[0] = WORK_SPACE_SIZE;
+    if (tilingKey == COMMON_TILING_KEY) {
+        workspaces[0] += static_cast<size_t>(needCoreNum) * csLength * sizeof(float);
+    }
     FillTilingData();
     return ge::GRAPH_SUCCESS;
 }
 
+void SegsumTiling::GetTileSize()
+{
+    slideSize = std::min(CeilA2B(tailDimSize, SLIDE_ALIGN) * SLIDE_ALIGN, MAX_SLIDE_SIZE);
+    // 列方向按repeat对齐，行方向取能整除列数的8的倍数，保证对角块在列内的偏移也是32B对齐的
+    tileCols = std::min(CeilA2B(tailDimSize, VEC_ELEMS) * VEC_ELEMS, MAX_TILE_COLS);
+    int64_t rowBound = std::min(std::min(MAX_TILE_ROWS, TILE_ELEMS / tileCols),
+        CeilA2B(tailDimSize, BRCB_ELEMS) * BRCB_ELEMS);
+    tileRows = rowBound / BRCB_ELEMS * BRCB_ELEMS;
+    while (tileRows > BRCB_ELEMS && tileCols % tileRows != 0) {
+        tileRows -= BRCB_ELEMS;
+    }
+    rowTiles = CeilA2B(tailDimSize, tileRows);
+    csLength = CeilA2B(tailDimSize, tileCols) * tileCols;
+}
+
 void SegsumTiling::GetTilingKey(uint64_t ubSizePlatform)
 {
-    int64_t eachTensorSize = (ubSizePlatform - RESERVED_LENGTH) / TENSOR_NUM;
-    int64_t maxSlideSizeUnalign = eachTensorSize / dataTypeSize;
-    int64_t maxSlideSizeBlock = maxSlideSizeUnalign / blockSize;
-    int64_t maxSlideSize = maxSlideSizeBlock * blockSize;
-    if (tailDimSize <= maxSlideSize) {
+    if (cumsumOnly) {
+        tilingKey = CUMSUM_TILING_KEY;
+        return;
+    }
+    int64_t tileBytes = tileRows * tileCols * dataTypeSize * DOUBLE_BUFFER + tileRows * BRCB_ELEMS * BYTE_LEN_4 +
+                        tileRows * tileRows * BYTE_LEN_4 + slideSize * dataTypeSize;
+    if (dataType != ge::DT_FLOAT) {
+        tileBytes += tileRows * tileCols * BYTE_LEN_4;
+    }
+    int64_t ubAvailable = static_cast<int64_t>(ubSizePlatform) - static_cast<int64_t>(RESERVED_LENGTH) - tileBytes;
+    if (csLength * BYTE_LEN_4 <= ubAvailable) {
         tilingKey = SMALL_SIZE_TILING_KEY;
     } else {
         tilingKey = COMMON_TILING_KEY;
     }
-    int32_t blockSizeReal = BLOCK / GetDataTypeSize();
-    int64_t tailDimSizeAlign = CeilA2B(tailDimSize, blockSizeReal) * blockSizeReal;
-    slideSize = std::min(batchEnd[0] * tailDimSizeAlign, maxSlideSize);
 }
 
 void SegsumTiling::GetNeedCoreNum(uint32_t coreNumPlatform)
 {
-    int64_t averageBatches = CeilA2B(batches, coreNumPlatform);
-    needCoreNum = CeilA2B(batches, averageBatches);
-    for (int64_t coreIndex = 0; coreIndex < needCoreNum; coreIndex++) {
-        batchStart[coreIndex] = coreIndex * averageBatches;
-        batchEnd[coreIndex] = std::min((coreIndex + 1) * averageBatches, batches);
-    }
+    // 每个(batch, 行块)单元写出的数据量相同，按单元数均分即可
+    int64_t units = cumsumOnly ? batches : batches * rowTiles;
+    needCoreNum = static_cast<uint32_t>(std::min(units, static_cast<int64_t>(std::max(coreNumPlatform, 1U))));
+    unitsPerCore = units / needCoreNum;
+    tailUnits = units % needCoreNum;
 }
 
 uint8_t SegsumTiling::GetDataTypeVal()
@@ -160,11 +207,15 @@ void SegsumTiling::FillTilingData()
 {
     tilingData.set_batches(batches);
     tilingData.set_tailDimSize(tailDimSize);
-    tilingData.set_batchStart(batchStart);
-    tilingData.set_batchEnd(batchEnd);
     tilingData.set_dataType(GetDataTypeVal());
     tilingData.set_needCoreNum(needCoreNum);
     tilingData.set_slideSize(slideSize);
+    tilingData.set_tileRows(tileRows);
+    tilingData.set_tileCols(tileCols);
+    tilingData.set_rowTiles(rowTiles);
+    tilingData.set_csLength(csLength);
+    tilingData.set_unitsPerCore(unitsPerCore);
+    tilingData.set_tailUnits(tailUnits);
 
     tilingContext->SetBlockDim(needCoreNum);
     tilingContext->SetTilingKey(tilingKey);
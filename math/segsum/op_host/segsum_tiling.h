@@ -27,8 +27,6 @@
 
 namespace optiling {
 
-constexpr uint16_t MAX_CORE_CONT = 50;
-
 struct SegsumCompileInfo {
     uint32_t coreNum = 0;
     uint64_t ubSize = 0;
@@ -40,10 +38,13 @@ TILING_DATA_FIELD_DEF(int64_t, dataType);
 TILING_DATA_FIELD_DEF(int64_t, needCoreNum);
 TILING_DATA_FIELD_DEF(int64_t, batches);
 TILING_DATA_FIELD_DEF(int64_t, tailDimSize);
-TILING_DATA_FIELD_DEF(int64_t, slideSize);
-
-TILING_DATA_FIELD_DEF_ARR(int32_t, MAX_CORE_CONT, batchStart);
-TILING_DATA_FIELD_DEF_ARR(int32_t, MAX_CORE_CONT, batchEnd);
+TILING_DATA_FIELD_DEF(int64_t, slideSize);    // 前缀和每次搬入的元素数
+TILING_DATA_FIELD_DEF(int64_t, tileRows);     // 输出块的行数(i方向)
+TILING_DATA_FIELD_DEF(int64_t, tileCols);     // 输出块的列数(j方向)
+TILING_DATA_FIELD_DEF(int64_t, rowTiles);     // 每个batch在i方向上的块数
+TILING_DATA_FIELD_DEF(int64_t, csLength);     // 前缀和按tileCols补齐后的长度
+TILING_DATA_FIELD_DEF(int64_t, unitsPerCore); // 每核处理的(batch, 行块)单元数
+TILING_DATA_FIELD_DEF(int64_t, tailUnits);    // 前tailUnits个核多处理一个单元
 END_TILING_DATA_DEF;
 
 REGISTER_TILING_DATA_CLASS(Segsum, SegsumTilingData)
@@ -36,6 +36,10 @@ extern "C" __global__ __aicore__ void segsum(GM_ADDR x, GM_ADDR y, GM_ADDR works
             SegsumND<bfloat16_t, 1> op;
             op.Init(x, y, userWS, &tilingData);
             op.Process();
+        } else if (TILING_KEY_IS(1002)) {
+            SegsumND<bfloat16_t, 2> op;
+            op.Init(x, y, userWS, &tilingData);
+            op.Process();
         } else {
             return;
         }
@@ -48,6 +52,10 @@ extern "C" __global__ __aicore__ void segsum(GM_ADDR x, GM_ADDR y, GM_ADDR works
             SegsumND<half, 1> op;
             op.Init(x, y, userWS, &tilingData);
             op.Process();
+        } else if (TILING_KEY_IS(1002)) {
+            SegsumND<half, 2> op;
+            op.Init(x, y, userWS, &tilingData);
+            op.Process();
         } else {
             return;
         }
@@ -60,6 +68,10 @@ extern "C" __global__ __aicore__ void segsum(GM_ADDR x, GM_ADDR y, GM_ADDR works
             SegsumND<float, 1> op;
             op.Init(x, y, userWS, &tilingData);
             op.Process();
+        } else if (TILING_KEY_IS(1002)) {
+            SegsumND<float, 2> op;
+            op.Init(x, y, userWS, &tilingData);
+            op.Process();
         } else {
             return;
         }
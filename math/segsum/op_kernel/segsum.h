@@ -23,9 +23,21 @@
 
 namespace Segsum {
 using namespace AscendC;
-constexpr int32_t NO_BUFFER_NUM = 1;
+constexpr int32_t DOUBLE_BUFFER = 2;
+constexpr int32_t CS_IN_WORKSPACE = 0; // 前缀和暂存workspace，按块搬入
+constexpr int32_t CS_IN_UB = 1;        // 前缀和常驻UB
+constexpr int32_t CUMSUM_ONLY = 2;     // 只输出前缀和
+constexpr int64_t VEC_ELEMS = 64;
+constexpr int64_t BRCB_ELEMS = 8;
 
 constexpr float INF_FLOAT = -INFINITY;
+
+/*
+ * segsum[i, j] = cs[i] - cs[j] (j <= i)，cs为末轴的包含式前缀和。
+ * 每个batch只做一次前缀和，之后按(tileRows x tileCols)输出块展开：
+ * Brcb广播cs[i]后与cs[j]行做一次repeat步长减法，对角块叠加上三角-inf模板，再整体Exp。
+ * 完全位于上三角的块直接写0，不做计算。
+ */
 template <typename T, int32_t MODE>
 class SegsumND {
 public:
@@ -49,49 +61,58 @@ private:
     {
         return a < b ? a : b;
     };
-    __aicore__ inline int64_t getProcessedNum(int64_t rowIdx, int64_t colIdx, int64_t dataIdx, int64_t diagonal)
+    template <HardEvent EVENT>
+    __aicore__ inline void SyncFlag()
+    {
+        event_t eventId = static_cast<event_t>(GetTPipePtr()->FetchEventID(EVENT));
+        SetFlag<EVENT>(eventId);
+        WaitFlag<EVENT>(eventId);
+    }
+    __aicore__ inline float ToFloatValue(T value)
     {
-        if (rowIdx < colIdx) {
-            return -1;
-        } else if (rowIdx == colIdx) {
-            return dataIdx % slideSize + diagonal;
+        if constexpr (std::is_same<T, bfloat16_t>::value) {
+            return ToFloat(value);
         } else {
-            return slideSize;
+            return static_cast<float>(value);
         }
     }
 
     __aicore__ inline void ParseTilingData(SegsumTilingData* tilingData);
-    __aicore__ inline void ComputeBase();
-    __aicore__ inline void ComputeBatches();
-    __aicore__ inline void Compute(int64_t batchIdx, int64_t colIdx);
-    __aicore__ inline void CopyInBatch(int32_t offset, int64_t batchesEachCopy, uint32_t calSize);
-    __aicore__ inline void CopyOutBatch(int32_t offset, int64_t batchesEachCopy, int32_t calNum, uint32_t calSize);
-    __aicore__ inline void processY(
-        int64_t outProcessedNum, int64_t calCount, LocalTensor<float> currentRow, int64_t batchesEachCopy,
-        int64_t blockNumData);
-    __aicore__ inline void processCurrent(
-        int64_t dataIdx, LocalTensor<float> currentRow, LocalTensor<T> xTensor, int64_t batchesEachCopy,
-        int64_t blockNumData);
+    __aicore__ inline void InitTriMask();
+    __aicore__ inline void CopyInX(int64_t offset, int64_t count);
+    __aicore__ inline float ScanChunk(LocalTensor<float>& dst, int64_t count, float carry);
+    __aicore__ inline void BuildCumsum(int64_t batchIdx);
+    __aicore__ inline void ProcessCumsum(int64_t batchIdx);
+    __aicore__ inline void ProcessRowTile(int64_t batchIdx, int64_t rowTile);
+    __aicore__ inline void LoadCs(LocalTensor<float>& dst, int64_t offset, int64_t count);
+    __aicore__ inline void ComputeBlock(LocalTensor<T>& yLocal, LocalTensor<float>& csJ, int64_t diagOffset);
+    __aicore__ inline void CopyOutBlock(int64_t batchIdx, int64_t rowStart, int64_t colStart, int64_t rows,
+        int64_t cols);
 
 private:
-    TBuf<QuePosition::VECCALC> lastQueue;
-    TBuf<QuePosition::VECCALC> currentQueue;
-    TBuf<QuePosition::VECCALC> castQueue;
-    TQue<QuePosition::VECIN, NO_BUFFER_NUM> inQueue;
-    TQue<QuePosition::VECOUT, NO_BUFFER_NUM> outQueue;
+    TBuf<QuePosition::VECCALC> xBuf;
+    TBuf<QuePosition::VECCALC> csBuf;
+    TBuf<QuePosition::VECCALC> csIBuf;
+    TBuf<QuePosition::VECCALC> csJBuf;
+    TBuf<QuePosition::VECCALC> bcastBuf;
+    TBuf<QuePosition::VECCALC> triBuf;
+    TBuf<QuePosition::VECCALC> calcBuf;
+    TQue<QuePosition::VECOUT, DOUBLE_BUFFER> outQueue;
 
     GlobalTensor<T> inTensorsGM;
     GlobalTensor<T> outTensorsGM;
+    GlobalTensor<float> csGM;
 
     int64_t blockIdx = 0;
-    int64_t batchStart = 0;
-    int64_t batchEnd = 0;
     int64_t needCoreNum = 0;
     int64_t slideSize = 0;
-
     int64_t tailDimSize = 0;
-    int64_t calCount = 0;
-    int64_t blockSize = 8;
+    int64_t tileRows = 0;
+    int64_t tileCols = 0;
+    int64_t rowTiles = 0;
+    int64_t csLength = 0;
+    int64_t unitStart = 0;
+    int64_t unitNum = 0;
 };
 
 template <typename T, int32_t MODE>
@@ -100,16 +121,30 @@ __aicore__ inline void SegsumND<T, MODE>::Init(
 {
     blockIdx = GetBlockIdx();
     ParseTilingData(tilingData);
-    pipe.InitBuffer(inQueue, NO_BUFFER_NUM, slideSize * sizeof(T));
-    pipe.InitBuffer(outQueue, NO_BUFFER_NUM, slideSize * sizeof(T));
-    pipe.InitBuffer(lastQueue, slideSize * sizeof(float));
-    pipe.InitBuffer(currentQueue, slideSize * sizeof(float));
-    if constexpr (std::is_same<T, bfloat16_t>::value || std::is_same<T, half>::value) {
-        pipe.InitBuffer(castQueue, slideSize * sizeof(float));
-    }
-
     inTensorsGM.SetGlobalBuffer((__gm__ T*)input);
     outTensorsGM.SetGlobalBuffer((__gm__ T*)output);
+
+    pipe.InitBuffer(xBuf, slideSize * sizeof(T));
+    if constexpr (MODE == CUMSUM_ONLY) {
+        pipe.InitBuffer(csBuf, slideSize * sizeof(float));
+        pipe.InitBuffer(outQueue, DOUBLE_BUFFER, slideSize * sizeof(T));
+        return;
+    }
+    if constexpr (MODE == CS_IN_UB) {
+        pipe.InitBuffer(csBuf, csLength * sizeof(float));
+    } else {
+        pipe.InitBuffer(csBuf, slideSize * sizeof(float));
+        pipe.InitBuffer(csIBuf, tileRows * sizeof(float));
+        pipe.InitBuffer(csJBuf, tileCols * sizeof(float));
+        csGM.SetGlobalBuffer((__gm__ float*)workspace + blockIdx * csLength, csLength);
+    }
+    pipe.InitBuffer(outQueue, DOUBLE_BUFFER, tileRows * tileCols * sizeof(T));
+    pipe.InitBuffer(bcastBuf, tileRows * BRCB_ELEMS * sizeof(float));
+    pipe.InitBuffer(triBuf, tileRows * tileRows * sizeof(float));
+    if constexpr (!std::is_same<T, float>::value) {
+        pipe.InitBuffer(calcBuf, tileRows * tileCols * sizeof(float));
+    }
+    InitTriMask();
 };
 
 template <typename T, int32_t MODE>
@@ -118,181 +153,221 @@ __aicore__ inline void SegsumND<T, MODE>::Process()
     if (blockIdx >= needCoreNum) {
         return;
     }
-    if (MODE == 0) {
-        ComputeBase();
-    } else {
-        ComputeBatches();
+    if constexpr (MODE == CUMSUM_ONLY) {
+        for (int64_t batchIdx = unitStart; batchIdx < unitStart + unitNum; batchIdx++) {
+            ProcessCumsum(batchIdx);
+        }
+        return;
+    }
+    // 同一batch的多个行块只做一次前缀和
+    int64_t builtBatch = -1;
+    for (int64_t unitIdx = unitStart; unitIdx < unitStart + unitNum; unitIdx++) {
+        int64_t batchIdx = unitIdx / rowTiles;
+        if (batchIdx != builtBatch) {
+            BuildCumsum(batchIdx);
+            builtBatch = batchIdx;
+        }
+        ProcessRowTile(batchIdx, unitIdx % rowTiles);
     }
 }
 
 template <typename T, int32_t MODE>
-__aicore__ inline void SegsumND<T, MODE>::ComputeBase()
+__aicore__ inline void SegsumND<T, MODE>::InitTriMask()
 {
-    LocalTensor<T> lastRow = lastQueue.Get<T>();
-    LocalTensor<T> currentRow = currentQueue.Get<T>();
-    for (int64_t batchIdx = batchStart; batchIdx < batchEnd; batchIdx++) {
-        for (int64_t colIdx = 0; colIdx < tailDimSize; colIdx += slideSize) {
-            Compute(batchIdx, colIdx);
+    // 对角块的[d, d + tileRows)列：下三角及对角线为0，上三角为-inf
+    LocalTensor<float> triLocal = triBuf.Get<float>();
+    for (int64_t r = 0; r < tileRows; r++) {
+        for (int64_t c = 0; c < tileRows; c++) {
+            triLocal.SetValue(r * tileRows + c, c > r ? INF_FLOAT : 0.0f);
         }
     }
+    SyncFlag<HardEvent::S_V>();
 }
 
 template <typename T, int32_t MODE>
-__aicore__ inline void SegsumND<T, MODE>::Compute(int64_t batchIdx, int64_t colIdx)
+__aicore__ inline void SegsumND<T, MODE>::CopyInX(int64_t offset, int64_t count)
 {
-    LocalTensor<float> lastRow = lastQueue.Get<float>();
-    LocalTensor<float> currentRow = currentQueue.Get<float>();
-
-    Duplicate(lastRow, static_cast<float>(0), slideSize);
-    for (int64_t rowIdx = 0; rowIdx < tailDimSize; rowIdx += slideSize) {
-        int64_t loopCount = Min(slideSize, tailDimSize - rowIdx);
-        calCount = Min(slideSize, tailDimSize - colIdx);
-        int64_t blockNumData = CeilA2B(calCount, blockSize) * blockSize;
-
-        int32_t inOffset = batchIdx * tailDimSize + rowIdx;
-        CopyInBatch(inOffset, 1, calCount * sizeof(T));
-        LocalTensor<T> xTensor = inQueue.DeQue<T>();
-        for (int64_t dataIdx = rowIdx; dataIdx < rowIdx + loopCount; dataIdx++) {
-            int64_t currentProcessedNum = getProcessedNum(rowIdx, colIdx, dataIdx, 0);
-
-            if (currentProcessedNum >= 0) {
-                Duplicate(currentRow, static_cast<float>(0), slideSize);
-            }
-            if (currentProcessedNum > 0) {
-                if constexpr (std::is_same<T, bfloat16_t>::value) {
-                    Duplicate(currentRow, ToFloat(xTensor.GetValue(dataIdx - rowIdx)), currentProcessedNum);
-                } else {
-                    Duplicate(currentRow, static_cast<float>(xTensor.GetValue(dataIdx - rowIdx)), currentProcessedNum);
-                }
-                PipeBarrier<PIPE_V>();
-                Add(currentRow, currentRow, lastRow, currentProcessedNum);
-                PipeBarrier<PIPE_V>();
-            }
-
-            int64_t outProcessedNum = getProcessedNum(rowIdx, colIdx, dataIdx, 1);
-            processY(outProcessedNum, calCount, currentRow, 1, 0);
-
-            int64_t outOffset = batchIdx * tailDimSize * tailDimSize + dataIdx * tailDimSize + colIdx;
-            CopyOutBatch(outOffset, 1, 0, calCount * sizeof(T));
+    LocalTensor<T> xLocal = xBuf.Get<T>();
+    // 上一段仍可能在被标量读取
+    SyncFlag<HardEvent::S_MTE2>();
+    DataCopyExtParams copyParams{1, static_cast<uint32_t>(count * sizeof(T)), 0, 0, 0};
+    DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+    DataCopyPad(xLocal, inTensorsGM[offset], copyParams, padParams);
+    SyncFlag<HardEvent::MTE2_S>();
+}
 
-            DataCopy(lastRow, currentRow, blockNumData);
-        }
-        inQueue.FreeTensor(xTensor);
+template <typename T, int32_t MODE>
+__aicore__ inline float SegsumND<T, MODE>::ScanChunk(LocalTensor<float>& dst, int64_t count, float carry)
+{
+    LocalTensor<T> xLocal = xBuf.Get<T>();
+    for (int64_t k = 0; k < count; k++) {
+        carry += ToFloatValue(xLocal.GetValue(k));
+        dst.SetValue(k, carry);
     }
+    return carry;
 }
 
 template <typename T, int32_t MODE>
-__aicore__ inline void SegsumND<T, MODE>::processY(
-    int64_t outProcessedNum, int64_t calCount, LocalTensor<float> currentRow, int64_t batchesEachCopy,
-    int64_t blockNumData)
+__aicore__ inline void SegsumND<T, MODE>::BuildCumsum(int64_t batchIdx)
 {
-    if constexpr (std::is_same<T, bfloat16_t>::value || std::is_same<T, half>::value) {
-        LocalTensor<T> yTensor = outQueue.AllocTensor<T>();
-        LocalTensor<float> castRow = castQueue.Get<float>();
-        Duplicate(castRow, INF_FLOAT, calCount);
-        PipeBarrier<PIPE_ALL>();
-        if (outProcessedNum > 0) {
-            for (int64_t i = 0; i < batchesEachCopy; i++) {
-                Adds(castRow[i * blockNumData], currentRow[i * blockNumData], static_cast<float>(0), outProcessedNum);
-                PipeBarrier<PIPE_ALL>();
-            }
-        }
-        Exp(castRow, castRow, calCount);
-        PipeBarrier<PIPE_ALL>();
-        Cast(yTensor, castRow, RoundMode::CAST_ROUND, calCount);
-        PipeBarrier<PIPE_V>();
-        outQueue.EnQue(yTensor);
-    } else if constexpr (std::is_same<T, float>::value) {
-        LocalTensor<float> yTensor = outQueue.AllocTensor<float>();
-        Duplicate(yTensor, INF_FLOAT, calCount);
-        PipeBarrier<PIPE_V>();
-        if (outProcessedNum > 0) {
-            for (int64_t i = 0; i < batchesEachCopy; i++) {
-                Adds(yTensor[i * blockNumData], currentRow[i * blockNumData], static_cast<T>(0), outProcessedNum);
-                PipeBarrier<PIPE_V>();
-            }
+    LocalTensor<float> csLocal = csBuf.Get<float>();
+    // 上一个batch的块计算仍可能在读前缀和
+    SyncFlag<HardEvent::V_S>();
+    float carry = 0.0f;
+    for (int64_t colIdx = 0; colIdx < tailDimSize; colIdx += slideSize) {
+        int64_t count = Min(slideSize, tailDimSize - colIdx);
+        CopyInX(batchIdx * tailDimSize + colIdx, count);
+        if constexpr (MODE == CS_IN_UB) {
+            LocalTensor<float> dst = csLocal[colIdx];
+            carry = ScanChunk(dst, count, carry);
+        } else {
+            SyncFlag<HardEvent::MTE3_S>();
+            carry = ScanChunk(csLocal, count, carry);
+            SyncFlag<HardEvent::S_MTE3>();
+            DataCopyExtParams copyParams{1, static_cast<uint32_t>(count * sizeof(float)), 0, 0, 0};
+            DataCopyPad(csGM[colIdx], csLocal, copyParams);
         }
-        Exp(yTensor, yTensor, calCount);
-        PipeBarrier<PIPE_V>();
-        outQueue.EnQue(yTensor);
+    }
+    if constexpr (MODE == CS_IN_UB) {
+        SyncFlag<HardEvent::S_V>();
+    } else {
+        SyncFlag<HardEvent::MTE3_MTE2>();
     }
 }
 
 template <typename T, int32_t MODE>
-__aicore__ inline void SegsumND<T, MODE>::processCurrent(
-    int64_t dataIdx, LocalTensor<float> currentRow, LocalTensor<T> xTensor, int64_t batchesEachCopy,
-    int64_t blockNumData)
+__aicore__ inline void SegsumND<T, MODE>::ProcessCumsum(int64_t batchIdx)
 {
-    for (int64_t i = 0; i < batchesEachCopy; i++) {
-        if constexpr (std::is_same<T, bfloat16_t>::value) {
-            Duplicate(currentRow[i * blockNumData], ToFloat(xTensor.GetValue(dataIdx + i * blockNumData)), dataIdx);
-            PipeBarrier<PIPE_V>();
+    LocalTensor<float> csLocal = csBuf.Get<float>();
+    float carry = 0.0f;
+    for (int64_t colIdx = 0; colIdx < tailDimSize; colIdx += slideSize) {
+        int64_t count = Min(slideSize, tailDimSize - colIdx);
+        CopyInX(batchIdx * tailDimSize + colIdx, count);
+        LocalTensor<T> yLocal = outQueue.AllocTensor<T>();
+        // 前一段的Cast仍可能在读csLocal
+        SyncFlag<HardEvent::V_S>();
+        if constexpr (std::is_same<T, float>::value) {
+            SyncFlag<HardEvent::MTE3_S>();
+            carry = ScanChunk(yLocal, count, carry);
+            SyncFlag<HardEvent::S_MTE3>();
         } else {
-            Duplicate(
-                currentRow[i * blockNumData], static_cast<float>(xTensor.GetValue(dataIdx + i * blockNumData)),
-                dataIdx);
-            PipeBarrier<PIPE_V>();
+            carry = ScanChunk(csLocal, count, carry);
+            SyncFlag<HardEvent::S_V>();
+            Cast(yLocal, csLocal, RoundMode::CAST_ROUND, count);
         }
+        outQueue.EnQue(yLocal);
+        yLocal = outQueue.DeQue<T>();
+        DataCopyExtParams copyParams{1, static_cast<uint32_t>(count * sizeof(T)), 0, 0, 0};
+        DataCopyPad(outTensorsGM[batchIdx * tailDimSize + colIdx], yLocal, copyParams);
+        outQueue.FreeTensor(yLocal);
     }
 }
 
 template <typename T, int32_t MODE>
-__aicore__ inline void SegsumND<T, MODE>::ComputeBatches()
+__aicore__ inline void SegsumND<T, MODE>::LoadCs(LocalTensor<float>& dst, int64_t offset, int64_t count)
 {
-    LocalTensor<float> lastRow = lastQueue.Get<float>();
-    LocalTensor<float> currentRow = currentQueue.Get<float>();
-    uint32_t calSize = calCount * sizeof(T);
-    int64_t blockNumData = CeilA2B(calCount, blockSize) * blockSize;
-    int64_t batchNum = slideSize / blockNumData;
-    int64_t totalBlockNumData = blockNumData * batchNum;
-    for (int64_t batchIdx = batchStart; batchIdx < batchEnd; batchIdx += batchNum) {
-        int64_t batchesEachCopy = Min(batchEnd - batchIdx, batchNum);
-        int32_t inOffset = batchIdx * tailDimSize;
-        CopyInBatch(inOffset, batchesEachCopy, calSize);
-        LocalTensor<T> xTensor = inQueue.DeQue<T>();
+    // 上一次搬入的数据仍可能在被向量读取
+    SyncFlag<HardEvent::V_MTE2>();
+    DataCopy(dst, csGM[offset], count);
+    SyncFlag<HardEvent::MTE2_V>();
+}
 
-        Duplicate(lastRow, static_cast<float>(0), totalBlockNumData);
-        PipeBarrier<PIPE_ALL>();
-        for (int64_t dataIdx = 0; dataIdx < calCount; dataIdx++) {
-            Duplicate(currentRow, static_cast<float>(0), blockNumData * batchesEachCopy);
-            PipeBarrier<PIPE_ALL>();
-            if (dataIdx > 0) {
-                processCurrent(dataIdx, currentRow, xTensor, batchesEachCopy, blockNumData);
+template <typename T, int32_t MODE>
+__aicore__ inline void SegsumND<T, MODE>::ProcessRowTile(int64_t batchIdx, int64_t rowTile)
+{
+    int64_t rowStart = rowTile * tileRows;
+    int64_t rows = Min(tileRows, tailDimSize - rowStart);
+    int64_t diagColTile = rowStart / tileCols;
+    LocalTensor<float> csLocal = csBuf.Get<float>();
+    LocalTensor<float> bcastLocal = bcastBuf.Get<float>();
+
+    LocalTensor<float> csI;
+    if constexpr (MODE == CS_IN_UB) {
+        csI = csLocal[rowStart];
+    } else {
+        csI = csIBuf.Get<float>();
+        LoadCs(csI, rowStart, tileRows);
+    }
+    // 每行的cs[i]广播成一个32B块，后续减法按repeat逐行取用
+    Brcb(bcastLocal, csI, static_cast<uint8_t>(tileRows / BRCB_ELEMS), {1, static_cast<uint16_t>(BRCB_ELEMS)});
+    PipeBarrier<PIPE_V>();
+
+    for (int64_t colTile = 0; colTile * tileCols < tailDimSize; colTile++) {
+        int64_t colStart = colTile * tileCols;
+        LocalTensor<T> yLocal = outQueue.AllocTensor<T>();
+        if (colTile > diagColTile) {
+            // 整块位于上三角，exp(-inf) = 0
+            if constexpr (std::is_same<T, float>::value) {
+                Duplicate(yLocal, 0.0f, tileRows * tileCols);
+            } else {
+                LocalTensor<uint16_t> zeroLocal = yLocal.template ReinterpretCast<uint16_t>();
+                Duplicate(zeroLocal, static_cast<uint16_t>(0), tileRows * tileCols);
             }
-            Add(currentRow, currentRow, lastRow, totalBlockNumData);
-            PipeBarrier<PIPE_V>();
-
-            processY(dataIdx + 1, totalBlockNumData, currentRow, batchesEachCopy, blockNumData);
-
-            int64_t outOffset = batchIdx * tailDimSize * tailDimSize + dataIdx * calCount;
-            CopyOutBatch(outOffset, batchesEachCopy, calCount, calSize);
-
-            DataCopy(lastRow, currentRow, totalBlockNumData);
-            PipeBarrier<PIPE_ALL>();
+        } else {
+            LocalTensor<float> csJ;
+            if constexpr (MODE == CS_IN_UB) {
+                csJ = csLocal[colStart];
+            } else {
+                csJ = csJBuf.Get<float>();
+                LoadCs(csJ, colStart, tileCols);
+            }
+            ComputeBlock(yLocal, csJ, colTile == diagColTile ? rowStart - colStart : -1);
         }
-        inQueue.FreeTensor(xTensor);
+        outQueue.EnQue(yLocal);
+        CopyOutBlock(batchIdx, rowStart, colStart, rows, Min(tileCols, tailDimSize - colStart));
     }
 }
 
 template <typename T, int32_t MODE>
-__aicore__ inline void SegsumND<T, MODE>::CopyInBatch(int32_t offset, int64_t batchesEachCopy, uint32_t calSize)
+__aicore__ inline void SegsumND<T, MODE>::ComputeBlock(
+    LocalTensor<T>& yLocal, LocalTensor<float>& csJ, int64_t diagOffset)
 {
-    LocalTensor<T> xTensor = inQueue.AllocTensor<T>();
-    DataCopyExtParams copyParams{static_cast<uint16_t>(batchesEachCopy), calSize, 0, 0, 0};
-    DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
-    DataCopyPad(xTensor, inTensorsGM[offset], copyParams, padParams);
-    inQueue.EnQue(xTensor);
+    LocalTensor<float> blockLocal;
+    if constexpr (std::is_same<T, float>::value) {
+        blockLocal = yLocal;
+    } else {
+        blockLocal = calcBuf.Get<float>();
+    }
+    LocalTensor<float> bcastLocal = bcastBuf.Get<float>();
+    uint8_t repeat = static_cast<uint8_t>(tileRows);
+    uint8_t rowStride = static_cast<uint8_t>(tileCols / BRCB_ELEMS);
+    // block[r, c] = cs[i0 + r] - cs[j0 + c]
+    for (int64_t c = 0; c < tileCols; c += VEC_ELEMS) {
+        Sub(blockLocal[c], bcastLocal, csJ[c], static_cast<uint64_t>(VEC_ELEMS), repeat,
+            {1, 0, 1, rowStride, 1, 0});
+    }
+    PipeBarrier<PIPE_V>();
+    if (diagOffset >= 0) {
+        // 对角线穿过[diagOffset, diagOffset + tileRows)列，其右侧整体位于上三角
+        LocalTensor<float> triLocal = triBuf.Get<float>();
+        uint8_t triStride = static_cast<uint8_t>(tileRows / BRCB_ELEMS);
+        Add(blockLocal[diagOffset], blockLocal[diagOffset], triLocal, static_cast<uint64_t>(tileRows), repeat,
+            {1, 1, 1, rowStride, rowStride, triStride});
+        for (int64_t c = diagOffset + tileRows; c < tileCols; c += VEC_ELEMS) {
+            Duplicate(blockLocal[c], INF_FLOAT, static_cast<uint64_t>(Min(VEC_ELEMS, tileCols - c)), repeat, 1,
+                rowStride);
+        }
+        PipeBarrier<PIPE_V>();
+    }
+    Exp(blockLocal, blockLocal, tileRows * tileCols);
+    if constexpr (!std::is_same<T, float>::value) {
+        PipeBarrier<PIPE_V>();
+        Cast(yLocal, blockLocal, RoundMode::CAST_ROUND, tileRows * tileCols);
+    }
 }
+
 template <typename T, int32_t MODE>
-__aicore__ inline void SegsumND<T, MODE>::CopyOutBatch(
-    int32_t offset, int64_t batchesEachCopy, int32_t calNum, uint32_t calSize)
+__aicore__ inline void SegsumND<T, MODE>::CopyOutBlock(
+    int64_t batchIdx, int64_t rowStart, int64_t colStart, int64_t rows, int64_t cols)
 {
-    LocalTensor<T> yTensor = outQueue.DeQue<T>();
-    DataCopyExtParams copyParams{
-        static_cast<uint16_t>(batchesEachCopy), calSize, 0, static_cast<uint32_t>((calNum - 1) * calNum * sizeof(T)),
-        0};
-    DataCopyPad(outTensorsGM[offset], yTensor, copyParams);
-    outQueue.FreeTensor(yTensor);
+    LocalTensor<T> yLocal = outQueue.DeQue<T>();
+    uint32_t rowBytes = static_cast<uint32_t>(cols * sizeof(T));
+    uint32_t srcStride = static_cast<uint32_t>(tileCols * sizeof(T) - CeilA2B(rowBytes, 32) * 32) / 32;
+    uint32_t dstStride = static_cast<uint32_t>((tailDimSize - cols) * sizeof(T));
+    DataCopyExtParams copyParams{static_cast<uint16_t>(rows), rowBytes, srcStride, dstStride, 0};
+    int64_t outOffset = batchIdx * tailDimSize * tailDimSize + rowStart * tailDimSize + colStart;
+    DataCopyPad(outTensorsGM[outOffset], yLocal, copyParams);
+    outQueue.FreeTensor(yLocal);
 }
 
 template <typename T, int32_t MODE>
@@ -300,11 +375,14 @@ __aicore__ inline void SegsumND<T, MODE>::ParseTilingData(SegsumTilingData* tili
 {
     slideSize = tilingData->slideSize;
     tailDimSize = tilingData->tailDimSize;
-    calCount = tailDimSize;
     needCoreNum = tilingData->needCoreNum;
-    batchStart = tilingData->batchStart[blockIdx];
-    batchEnd = tilingData->batchEnd[blockIdx];
-    blockSize = 32 / sizeof(T);
+    tileRows = tilingData->tileRows;
+    tileCols = tilingData->tileCols;
+    rowTiles = tilingData->rowTiles;
+    csLength = tilingData->csLength;
+    int64_t tailUnits = tilingData->tailUnits;
+    unitNum = tilingData->unitsPerCore + (blockIdx < tailUnits ? 1 : 0);
+    unitStart = blockIdx * tilingData->unitsPerCore + Min(blockIdx, tailUnits);
 }
 } // namespace Segsum
-#endif
\ No newline at end of file
+#endif
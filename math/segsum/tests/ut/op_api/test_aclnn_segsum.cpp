@@ -163,4 +163,43 @@ TEST_F(l2_segsum_test, ascend910B2_case_format_invalid_2)
     uint64_t workspace_size = 0;
     aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
     EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
-}
\ No newline at end of file
+}
+
+TEST_F(l2_segsum_test, ascend910B2_case_v2_cumsum_valid)
+{
+    auto self_desc = TensorDesc({1, 2, 3, 64}, ACL_FLOAT16, ACL_FORMAT_ND);
+    auto out_desc = TensorDesc({1, 2, 3, 64}, ACL_FLOAT16, ACL_FORMAT_ND);
+    bool cumsumOnly = true;
+
+    auto ut = OP_API_UT(aclnnExpSegsumV2, INPUT(self_desc, cumsumOnly), OUTPUT(out_desc));
+
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACL_SUCCESS);
+}
+
+TEST_F(l2_segsum_test, ascend910B2_case_v2_full_valid)
+{
+    auto self_desc = TensorDesc({1, 2, 3}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto out_desc = TensorDesc({1, 2, 3, 3}, ACL_FLOAT, ACL_FORMAT_ND);
+    bool cumsumOnly = false;
+
+    auto ut = OP_API_UT(aclnnExpSegsumV2, INPUT(self_desc, cumsumOnly), OUTPUT(out_desc));
+
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACL_SUCCESS);
+}
+
+TEST_F(l2_segsum_test, ascend910B2_case_v2_cumsum_shape_invalid)
+{
+    auto self_desc = TensorDesc({1, 2, 3}, ACL_FLOAT, ACL_FORMAT_ND);
+    auto out_desc = TensorDesc({1, 2, 3, 3}, ACL_FLOAT, ACL_FORMAT_ND);
+    bool cumsumOnly = true;
+
+    auto ut = OP_API_UT(aclnnExpSegsumV2, INPUT(self_desc, cumsumOnly), OUTPUT(out_desc));
+
+    uint64_t workspace_size = 0;
+    aclnnStatus aclRet = ut.TestGetWorkspaceSize(&workspace_size);
+    EXPECT_EQ(aclRet, ACLNN_ERR_PARAM_INVALID);
+}
@@ -33,7 +33,7 @@ protected:
 
 TEST_F(SegsumTiling, segsum_tiling_001)
 {
-    optiling::SegsumCompileInfo compileInfo = {1};
+    optiling::SegsumCompileInfo compileInfo = {1, 196608};
     gert::TilingContextPara tilingContextPara(
         "Segsum",
         {
@@ -44,9 +44,61 @@ TEST_F(SegsumTiling, segsum_tiling_001)
         },
         &compileInfo);
     uint64_t expectTilingKey = 1001;
-    string expectTilingData =
-        "2 1 1 128 128 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 "
-        "0 0 ";
+    string expectTilingData = "2 1 1 128 128 64 128 2 128 2 0 ";
+    std::vector<size_t> expectWorkspaces = {33554432};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(SegsumTiling, segsum_tiling_cumsum_only)
+{
+    optiling::SegsumCompileInfo compileInfo = {48, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "Segsum",
+        {
+            {{{2, 4, 8, 100}, {2, 4, 8, 100}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+        },
+        {
+            {{{2, 4, 8, 100}, {2, 4, 8, 100}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+        },
+        &compileInfo);
+    uint64_t expectTilingKey = 1002;
+    string expectTilingData = "1 48 64 100 112 64 128 2 128 1 16 ";
+    std::vector<size_t> expectWorkspaces = {33554432};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(SegsumTiling, segsum_tiling_cumsum_in_workspace)
+{
+    optiling::SegsumCompileInfo compileInfo = {48, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "Segsum",
+        {
+            {{{1, 1, 1, 40000}, {1, 1, 1, 40000}}, ge::DT_BF16, ge::FORMAT_ND},
+        },
+        {
+            {{{1, 1, 1, 40000, 40000}, {1, 1, 1, 40000, 40000}}, ge::DT_BF16, ge::FORMAT_ND},
+        },
+        &compileInfo);
+    uint64_t expectTilingKey = 1000;
+    string expectTilingData = "3 48 1 40000 2048 16 512 2500 40448 52 4 ";
+    std::vector<size_t> expectWorkspaces = {41320448};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(SegsumTiling, segsum_tiling_unaligned_tail)
+{
+    optiling::SegsumCompileInfo compileInfo = {48, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "Segsum",
+        {
+            {{{3, 5, 20}, {3, 5, 20}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{3, 5, 20, 20}, {3, 5, 20, 20}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        &compileInfo);
+    uint64_t expectTilingKey = 1001;
+    string expectTilingData = "2 30 15 20 32 16 64 2 64 1 0 ";
     std::vector<size_t> expectWorkspaces = {33554432};
     ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
 }
@@ -31,9 +31,12 @@ struct SegsumTilingData {
     int64_t batches;
     int64_t tailDimSize;
     int64_t slideSize;
-
-    int32_t batchStart[50] = {0};
-    int32_t batchEnd[50] = {0};
+    int64_t tileRows;
+    int64_t tileCols;
+    int64_t rowTiles;
+    int64_t csLength;
+    int64_t unitsPerCore;
+    int64_t tailUnits;
 };
 
 #pragma pack()
@@ -19,9 +19,12 @@
 #include <iostream>
 #include <string>
 #include <cstdint>
+#include <cstring>
+#include <cmath>
 #include "gtest/gtest.h"
 #include "tikicpulib.h"
 #include "../../../op_host/segsum_tiling.h"
+#include "kernel_bench.h"
 
 extern "C" __global__ __aicore__ void segsum(GM_ADDR x, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling);
 
@@ -55,13 +58,14 @@ TEST_F(segsum_test, test_case_float_0)
     tilingDatafromBin->dataType = 2;
     tilingDatafromBin->needCoreNum = 2;
     tilingDatafromBin->batches = 2;
-    tilingDatafromBin->tailDimSize = 2;
-    tilingDatafromBin->slideSize = 8;
-
-    tilingDatafromBin->batchStart[0] = 0;
-    tilingDatafromBin->batchStart[1] = 1;
-    tilingDatafromBin->batchEnd[0] = 1;
-    tilingDatafromBin->batchEnd[1] = 2;
+    tilingDatafromBin->tailDimSize = 4;
+    tilingDatafromBin->slideSize = 16;
+    tilingDatafromBin->tileRows = 8;
+    tilingDatafromBin->tileCols = 64;
+    tilingDatafromBin->rowTiles = 1;
+    tilingDatafromBin->csLength = 64;
+    tilingDatafromBin->unitsPerCore = 1;
+    tilingDatafromBin->tailUnits = 0;
 
     ICPU_SET_TILING_KEY(1000);
     ICPU_RUN_KF(segsum, blockDim, x, y, workspace, (uint8_t*)(tilingDatafromBin));
@@ -91,10 +95,13 @@ TEST_F(segsum_test, test_case_float_1)
     tilingDatafromBin->needCoreNum = 1;
     tilingDatafromBin->batches = 4;
     tilingDatafromBin->tailDimSize = 3;
-    tilingDatafromBin->slideSize = 32;
-
-    tilingDatafromBin->batchStart[0] = 0;
-    tilingDatafromBin->batchEnd[1] = 4;
+    tilingDatafromBin->slideSize = 16;
+    tilingDatafromBin->tileRows = 8;
+    tilingDatafromBin->tileCols = 64;
+    tilingDatafromBin->rowTiles = 1;
+    tilingDatafromBin->csLength = 64;
+    tilingDatafromBin->unitsPerCore = 4;
+    tilingDatafromBin->tailUnits = 0;
 
     ICPU_SET_TILING_KEY(1001);
     ICPU_RUN_KF(segsum, blockDim, x, y, workspace, (uint8_t*)(tilingDatafromBin));
@@ -124,10 +131,13 @@ TEST_F(segsum_test, test_case_float16_0)
     tilingDatafromBin->needCoreNum = 1;
     tilingDatafromBin->batches = 1;
     tilingDatafromBin->tailDimSize = 2;
-    tilingDatafromBin->slideSize = 8;
-
-    tilingDatafromBin->batchStart[0] = 0;
-    tilingDatafromBin->batchEnd[1] = 1;
+    tilingDatafromBin->slideSize = 16;
+    tilingDatafromBin->tileRows = 8;
+    tilingDatafromBin->tileCols = 64;
+    tilingDatafromBin->rowTiles = 1;
+    tilingDatafromBin->csLength = 64;
+    tilingDatafromBin->unitsPerCore = 1;
+    tilingDatafromBin->tailUnits = 0;
 
     ICPU_SET_TILING_KEY(1000);
     ICPU_RUN_KF(segsum, blockDim, x, y, workspace, (uint8_t*)(tilingDatafromBin));
@@ -136,4 +146,154 @@ TEST_F(segsum_test, test_case_float16_0)
     AscendC::GmFree((void*)(y));
     AscendC::GmFree((void*)workspace);
     AscendC::GmFree((void*)tiling);
-}
\ No newline at end of file
+}
+
+static std::vector<float> SegsumGolden(const std::vector<float>& x, int64_t batches, int64_t len)
+{
+    std::vector<float> y(batches * len * len, 0.0f);
+    for (int64_t b = 0; b < batches; b++) {
+        for (int64_t i = 0; i < len; i++) {
+            float sum = 0.0f;
+            y[(b * len + i) * len + i] = 1.0f;
+            for (int64_t j = i - 1; j >= 0; j--) {
+                sum += x[b * len + j + 1];
+                y[(b * len + i) * len + j] = std::exp(sum);
+            }
+        }
+    }
+    return y;
+}
+
+TEST_F(segsum_test, test_case_float_golden)
+{
+    // L = 70：两个行块，第二个行块跨过对角块并含尾列
+    int64_t batches = 2;
+    int64_t len = 70;
+    size_t inputByteSize = batches * len * sizeof(float);
+    size_t outputByteSize = batches * len * len * sizeof(float);
+    size_t tiling_data_size = sizeof(SegsumTilingData);
+    size_t workspaceSize = 32 * 1024 * 1024;
+    uint32_t blockDim = 2;
+
+    uint8_t* x = (uint8_t*)AscendC::GmAlloc(inputByteSize);
+    uint8_t* y = (uint8_t*)AscendC::GmAlloc(outputByteSize);
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(workspaceSize);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(tiling_data_size);
+
+    std::vector<float> xData(batches * len);
+    for (size_t i = 0; i < xData.size(); i++) {
+        xData[i] = -0.05f * static_cast<float>(i % 7);
+    }
+    memcpy(x, xData.data(), inputByteSize);
+
+    SegsumTilingData* tilingDatafromBin = reinterpret_cast<SegsumTilingData*>(tiling);
+    tilingDatafromBin->dataType = 2;
+    tilingDatafromBin->needCoreNum = 2;
+    tilingDatafromBin->batches = batches;
+    tilingDatafromBin->tailDimSize = len;
+    tilingDatafromBin->slideSize = 80;
+    tilingDatafromBin->tileRows = 64;
+    tilingDatafromBin->tileCols = 128;
+    tilingDatafromBin->rowTiles = 2;
+    tilingDatafromBin->csLength = 128;
+    tilingDatafromBin->unitsPerCore = 2;
+    tilingDatafromBin->tailUnits = 0;
+
+    ICPU_SET_TILING_KEY(1001);
+    ICPU_RUN_KF(segsum, blockDim, x, y, workspace, (uint8_t*)(tilingDatafromBin));
+
+    std::vector<float> golden = SegsumGolden(xData, batches, len);
+    const float* out = reinterpret_cast<const float*>(y);
+    for (size_t i = 0; i < golden.size(); i++) {
+        EXPECT_NEAR(out[i], golden[i], 1e-4f) << "index " << i;
+    }
+
+    AscendC::GmFree((void*)(x));
+    AscendC::GmFree((void*)(y));
+    AscendC::GmFree((void*)workspace);
+    AscendC::GmFree((void*)tiling);
+}
+
+TEST_F(segsum_test, test_case_float_cumsum_only)
+{
+    int64_t batches = 3;
+    int64_t len = 37;
+    size_t inputByteSize = batches * len * sizeof(float);
+    size_t outputByteSize = batches * len * sizeof(float);
+    size_t tiling_data_size = sizeof(SegsumTilingData);
+    size_t workspaceSize = 32 * 1024 * 1024;
+    uint32_t blockDim = 2;
+
+    uint8_t* x = (uint8_t*)AscendC::GmAlloc(inputByteSize);
+    uint8_t* y = (uint8_t*)AscendC::GmAlloc(outputByteSize);
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(workspaceSize);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(tiling_data_size);
+
+    std::vector<float> xData(batches * len);
+    for (size_t i = 0; i < xData.size(); i++) {
+        xData[i] = 0.1f * static_cast<float>(i % 5) - 0.2f;
+    }
+    memcpy(x, xData.data(), inputByteSize);
+
+    SegsumTilingData* tilingDatafromBin = reinterpret_cast<SegsumTilingData*>(tiling);
+    tilingDatafromBin->dataType = 2;
+    tilingDatafromBin->needCoreNum = 2;
+    tilingDatafromBin->batches = batches;
+    tilingDatafromBin->tailDimSize = len;
+    tilingDatafromBin->slideSize = 16;
+    tilingDatafromBin->tileRows = 64;
+    tilingDatafromBin->tileCols = 64;
+    tilingDatafromBin->rowTiles = 1;
+    tilingDatafromBin->csLength = 64;
+    tilingDatafromBin->unitsPerCore = 1;
+    tilingDatafromBin->tailUnits = 1;
+
+    ICPU_SET_TILING_KEY(1002);
+    ICPU_RUN_KF(segsum, blockDim, x, y, workspace, (uint8_t*)(tilingDatafromBin));
+
+    const float* out = reinterpret_cast<const float*>(y);
+    for (int64_t b = 0; b < batches; b++) {
+        float sum = 0.0f;
+        for (int64_t i = 0; i < len; i++) {
+            sum += xData[b * len + i];
+            EXPECT_NEAR(out[b * len + i], sum, 1e-5f) << "batch " << b << " index " << i;
+        }
+    }
+
+    AscendC::GmFree((void*)(x));
+    AscendC::GmFree((void*)(y));
+    AscendC::GmFree((void*)workspace);
+    AscendC::GmFree((void*)tiling);
+}
+
+TEST_F(segsum_test, bench_shape_corpus)
+{
+    if (!KernelBenchEnabled()) {
+        GTEST_SKIP() << "set KERNEL_BENCH_FILE to run kernel benchmark";
+    }
+    optiling::SegsumCompileInfo compileInfo = {48, 196608};
+    // 覆盖单行块、多行块和只输出前缀和三种形态
+    std::vector<KernelBenchShape> shapes = {
+        {"float_2x64",
+         gert::TilingContextPara(
+             "Segsum", {{{{2, 64}, {2, 64}}, ge::DT_FLOAT, ge::FORMAT_ND}},
+             {{{{2, 64, 64}, {2, 64, 64}}, ge::DT_FLOAT, ge::FORMAT_ND}}, &compileInfo),
+         {2 * 64 * sizeof(float), 2 * 64 * 64 * sizeof(float)}},
+        {"float_8x256",
+         gert::TilingContextPara(
+             "Segsum", {{{{8, 256}, {8, 256}}, ge::DT_FLOAT, ge::FORMAT_ND}},
+             {{{{8, 256, 256}, {8, 256, 256}}, ge::DT_FLOAT, ge::FORMAT_ND}}, &compileInfo),
+         {8 * 256 * sizeof(float), 8 * 256 * 256 * sizeof(float)}},
+        {"float_cumsum_64x512",
+         gert::TilingContextPara(
+             "Segsum", {{{{64, 512}, {64, 512}}, ge::DT_FLOAT, ge::FORMAT_ND}},
+             {{{{64, 512}, {64, 512}}, ge::DT_FLOAT, ge::FORMAT_ND}}, &compileInfo),
+         {64 * 512 * sizeof(float), 64 * 512 * sizeof(float)}},
+    };
+    auto launcher = [](std::vector<uint8_t*>& gm, uint8_t* workspace, uint8_t* tiling, uint32_t blockDim) {
+        ICPU_RUN_KF(segsum, blockDim, gm[0], gm[1], workspace, tiling);
+    };
+    for (auto& shape : shapes) {
+        EXPECT_TRUE(RunKernelBench("segsum", shape, launcher));
+    }
+}
@@ -17,6 +17,7 @@
 #include "opdev/platform.h"
 #include "opdev/op_dfx.h"
 #include "opdev/op_executor.h"
+#include "opdev/tensor_view_utils.h"
 
 using namespace op;
 #ifdef __cplusplus
@@ -111,6 +112,22 @@ aclnnStatus aclnnSilentCheckGetWorkspaceSize(
         return ACLNN_SUCCESS;
     }
 
+    // AI Core路径(需显式开启)：inputGradRef、sfdaRef、stepRef作为输入输出引用原地绑定，result直接写出，
+    // 四者均连续时省去引用的Contiguous与ViewCopy
+    if (l0op::IsSilentCheckV2AiCoreSupport(val, inputGradRef) && IsContiguous(inputGradRef) &&
+        IsContiguous(sfdaRef) && IsContiguous(stepRef) && result != nullptr && IsContiguous(result) &&
+        result->GetDataType() == DataType::DT_INT32) {
+        auto valAiCore = l0op::Contiguous(val, uniqueExecutor.get());
+        CHECK_RET(valAiCore != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        auto aiCoreResult = l0op::SilentCheckV2(
+            valAiCore, inputGradRef, sfdaRef, stepRef, cMinSteps, cThreshL1, cCoeffL1, cThreshL2, cCoeffL2,
+            npuAsdDetect, result, uniqueExecutor.get());
+        CHECK_RET(aiCoreResult != nullptr, ACLNN_ERR_INNER_NULLPTR);
+        *workspaceSize = uniqueExecutor->GetWorkspaceSize();
+        uniqueExecutor.ReleaseTo(executor);
+        return ACLNN_SUCCESS;
+    }
+
     // 将输入val转换成连续的tensor
     auto valContiguous = l0op::Contiguous(val, uniqueExecutor.get());
     CHECK_RET(valContiguous != nullptr, ACLNN_ERR_INNER_NULLPTR);
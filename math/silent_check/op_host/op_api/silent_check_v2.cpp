@@ -9,15 +9,43 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 
+#include <cstdlib>
+#include <cstring>
 #include "silent_check_v2.h"
 #include "opdev/make_op_executor.h"
 #include "opdev/op_dfx.h"
 #include "opdev/aicpu/aicpu_task.h"
+#include "opdev/data_type_utils.h"
+#include "opdev/op_log.h"
+#include "opdev/platform.h"
 
 using namespace op;
 namespace l0op {
 OP_TYPE_REGISTER(SilentCheckV2);
 
+static const std::initializer_list<op::DataType> AICORE_DTYPE_SUPPORT_LIST = {
+    DataType::DT_FLOAT, DataType::DT_FLOAT16, DataType::DT_BF16};
+
+// AI Core实现的判定规则尚未与AiCpu实现逐项对齐，需显式设置ACLNN_SILENT_CHECK_AICORE=1才启用
+static bool IsSilentCheckV2AiCoreEnabled()
+{
+    const char* env = std::getenv("ACLNN_SILENT_CHECK_AICORE");
+    return env != nullptr && std::strcmp(env, "1") == 0;
+}
+
+bool IsSilentCheckV2AiCoreSupport(const aclTensor* val, const aclTensor* inputGradRef)
+{
+    if (!IsSilentCheckV2AiCoreEnabled()) {
+        return false;
+    }
+    SocVersion socVersion = GetCurrentPlatformInfo().GetSocVersion();
+    if (socVersion != SocVersion::ASCEND910B && socVersion != SocVersion::ASCEND910_93) {
+        return false;
+    }
+    return CheckType(inputGradRef->GetDataType(), AICORE_DTYPE_SUPPORT_LIST) &&
+           val->GetDataType() == inputGradRef->GetDataType();
+}
+
 const aclTensor* SilentCheckV2(
     const aclTensor* val, const aclTensor* inputGradRef, const aclTensor* sfdaRef, const aclTensor* stepRef,
     const int32_t cMinSteps, const float cThreshL1, const float cCoeffL1, const float cThreshL2, const float cCoeffL2,
@@ -37,4 +65,24 @@ const aclTensor* SilentCheckV2(
     CHECK_RET(ret == ACLNN_SUCCESS, nullptr);
     return result;
 }
+
+const aclTensor* SilentCheckV2(
+    const aclTensor* val, const aclTensor* inputGradRef, const aclTensor* sfdaRef, const aclTensor* stepRef,
+    const int32_t cMinSteps, const float cThreshL1, const float cCoeffL1, const float cThreshL2, const float cCoeffL2,
+    const int32_t npuAsdDetect, const aclTensor* result, aclOpExecutor* executor)
+{
+    L0_DFX(
+        SilentCheckV2, val, inputGradRef, sfdaRef, stepRef, cMinSteps, cThreshL1, cCoeffL1, cThreshL2, cCoeffL2,
+        npuAsdDetect, result);
+    int64_t minSteps = static_cast<int64_t>(cMinSteps);
+    int64_t asdDetect = static_cast<int64_t>(npuAsdDetect);
+    auto ret = ADD_TO_LAUNCHER_LIST_AICORE(
+        SilentCheckV2, OP_INPUT(val, inputGradRef, sfdaRef, stepRef), OP_OUTPUT(inputGradRef, sfdaRef, stepRef, result),
+        OP_ATTR(minSteps, cThreshL1, cCoeffL1, cThreshL2, cCoeffL2, asdDetect));
+    if (ret != ACLNN_SUCCESS) {
+        OP_LOGE(ACLNN_ERR_INNER_NULLPTR, "SilentCheckV2 ADD_TO_LAUNCHER_LIST_AICORE failed.");
+        return nullptr;
+    }
+    return result;
+}
 } // namespace l0op
@@ -18,6 +18,15 @@ const aclTensor* SilentCheckV2(
     const aclTensor* val, const aclTensor* inputGradRef, const aclTensor* sfdaRef, const aclTensor* stepRef,
     const int32_t cMinSteps, const float cThreshL1, const float cCoeffL1, const float cThreshL2, const float cCoeffL2,
     const int32_t npuAsdDetect, aclOpExecutor* executor);
+
+// 是否可走AI Core kernel：需设置环境变量ACLNN_SILENT_CHECK_AICORE=1，且芯片与dtype支持、val与inputGradRef数据类型一致
+bool IsSilentCheckV2AiCoreSupport(const aclTensor* val, const aclTensor* inputGradRef);
+
+// AI Core实现：inputGradRef、sfdaRef、stepRef均作为输出引用原地绑定，判定结果直接写入result，四者均需连续
+const aclTensor* SilentCheckV2(
+    const aclTensor* val, const aclTensor* inputGradRef, const aclTensor* sfdaRef, const aclTensor* stepRef,
+    const int32_t cMinSteps, const float cThreshL1, const float cCoeffL1, const float cThreshL2, const float cCoeffL2,
+    const int32_t npuAsdDetect, const aclTensor* result, aclOpExecutor* executor);
 } // namespace l0op
 
 #endif // OP_API_INC_LEVEL0_SILENT_CHECK_H_
@@ -0,0 +1,210 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file silent_check_v2_tiling.cpp
+ * \brief
+ */
+#include <algorithm>
+#include "silent_check_v2_tiling.h"
+#include "log/log.h"
+#include "register/op_def_registry.h"
+#include "tiling_base/tiling_templates_registry.h"
+#include "platform/platform_info.h"
+
+namespace optiling {
+constexpr int32_t VAL_INPUT_INDEX = 0;
+constexpr int32_t GRAD_INPUT_INDEX = 1;
+constexpr int32_t SFDA_INPUT_INDEX = 2;
+constexpr int32_t STEP_INPUT_INDEX = 3;
+constexpr size_t C_MIN_STEPS_ATTR_INDEX = 0;
+constexpr size_t C_THRESH_L1_ATTR_INDEX = 1;
+constexpr size_t C_COEFF_L1_ATTR_INDEX = 2;
+constexpr size_t C_THRESH_L2_ATTR_INDEX = 3;
+constexpr size_t C_COEFF_L2_ATTR_INDEX = 4;
+constexpr size_t NPU_ASD_DETECT_ATTR_INDEX = 5;
+constexpr int64_t SFDA_SIZE = 3;
+constexpr uint32_t FLOAT_BYTES = 4;
+constexpr uint32_t BUFFER_NUM = 2;
+constexpr uint32_t BYTE_BLOCK = 32;
+constexpr uint32_t RESERVED_UB = 1024;
+constexpr uint32_t REDUCE_WORK_BYTES = 1024;
+constexpr uint64_t ALIGN_ELEMS = 256;      // 各核起点按256元素对齐，任意dtype下都满足32B对齐
+constexpr uint64_t MIN_CORE_LEN = 4096;    // 小梯度少开核，减少多核同步开销
+constexpr uint64_t MAX_PIECE_LEN = 16384;  // 与REDUCE_WORK_BYTES匹配，ReduceSum的work不超过1KB
+
+struct SilentCheckV2DtypeKey {
+    ge::DataType dtype;
+    uint64_t tilingKey;
+};
+
+static const SilentCheckV2DtypeKey DTYPE_KEYS[] = {
+    {ge::DT_FLOAT, 1},
+    {ge::DT_FLOAT16, 2},
+    {ge::DT_BF16, 3},
+};
+
+static inline uint64_t CeilDiv(uint64_t a, uint64_t b)
+{
+    return b == 0 ? a : (a + b - 1) / b;
+}
+
+static inline uint64_t CeilAlign(uint64_t a, uint64_t b)
+{
+    return CeilDiv(a, b) * b;
+}
+
+static ge::graphStatus CheckShapes(gert::TilingContext* context, uint64_t& totalLen)
+{
+    auto valShape = context->GetInputShape(VAL_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, valShape);
+    auto gradShape = context->GetInputShape(GRAD_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, gradShape);
+    auto sfdaShape = context->GetInputShape(SFDA_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, sfdaShape);
+    auto stepShape = context->GetInputShape(STEP_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, stepShape);
+    OP_CHECK_IF(
+        valShape->GetStorageShape().GetShapeSize() != 1,
+        OP_LOGE(context->GetNodeName(), "val should have only one element."), return ge::GRAPH_FAILED);
+    OP_CHECK_IF(
+        sfdaShape->GetStorageShape().GetShapeSize() != SFDA_SIZE,
+        OP_LOGE(context->GetNodeName(), "sfda should have %ld elements.", SFDA_SIZE), return ge::GRAPH_FAILED);
+    OP_CHECK_IF(
+        stepShape->GetStorageShape().GetShapeSize() != 1,
+        OP_LOGE(context->GetNodeName(), "step should have only one element."), return ge::GRAPH_FAILED);
+    int64_t gradSize = gradShape->GetStorageShape().GetShapeSize();
+    OP_CHECK_IF(
+        gradSize < 0, OP_LOGE(context->GetNodeName(), "input_grad shape is invalid."), return ge::GRAPH_FAILED);
+    totalLen = static_cast<uint64_t>(gradSize);
+    return ge::GRAPH_SUCCESS;
+}
+
+static void GetAttrs(const gert::RuntimeAttrs* attrs, SilentCheckV2TilingData& tilingData)
+{
+    const int64_t* cMinSteps = attrs->GetAttrPointer<int64_t>(C_MIN_STEPS_ATTR_INDEX);
+    const float* cThreshL1 = attrs->GetAttrPointer<float>(C_THRESH_L1_ATTR_INDEX);
+    const float* cCoeffL1 = attrs->GetAttrPointer<float>(C_COEFF_L1_ATTR_INDEX);
+    const float* cThreshL2 = attrs->GetAttrPointer<float>(C_THRESH_L2_ATTR_INDEX);
+    const float* cCoeffL2 = attrs->GetAttrPointer<float>(C_COEFF_L2_ATTR_INDEX);
+    const int64_t* npuAsdDetect = attrs->GetAttrPointer<int64_t>(NPU_ASD_DETECT_ATTR_INDEX);
+    tilingData.set_cMinSteps(cMinSteps == nullptr ? 7 : *cMinSteps);
+    tilingData.set_cThreshL1(cThreshL1 == nullptr ? 1000000.0f : *cThreshL1);
+    tilingData.set_cCoeffL1(cCoeffL1 == nullptr ? 100000.0f : *cCoeffL1);
+    tilingData.set_cThreshL2(cThreshL2 == nullptr ? 10000.0f : *cThreshL2);
+    tilingData.set_cCoeffL2(cCoeffL2 == nullptr ? 5000.0f : *cCoeffL2);
+    tilingData.set_npuAsdDetect(npuAsdDetect == nullptr ? 1 : *npuAsdDetect);
+}
+
+static void CalcTilingData(uint32_t typeSize, uint32_t coreNum, uint32_t ubSize, SilentCheckV2TilingData& tilingData)
+{
+    uint64_t totalLen = tilingData.get_totalLen();
+    uint64_t perCoreLen = std::max(CeilAlign(CeilDiv(totalLen, coreNum), ALIGN_ELEMS), MIN_CORE_LEN);
+    uint64_t usedCoreNum = std::max<uint64_t>(1, CeilDiv(totalLen, perCoreLen));
+    // 搬入（double buffer）、fp32转换结果与nan累加区
+    uint64_t castBytes = typeSize == FLOAT_BYTES ? 0 : FLOAT_BYTES;
+    uint64_t perElem = BUFFER_NUM * typeSize + castBytes + FLOAT_BYTES;
+    uint64_t usableUb = ubSize > RESERVED_UB + REDUCE_WORK_BYTES ? ubSize - RESERVED_UB - REDUCE_WORK_BYTES : 0;
+    uint64_t pieceLen = std::min({usableUb / perElem / ALIGN_ELEMS * ALIGN_ELEMS, MAX_PIECE_LEN, perCoreLen});
+
+    tilingData.set_perCoreLen(perCoreLen);
+    tilingData.set_lastCoreLen(totalLen - (usedCoreNum - 1) * perCoreLen);
+    tilingData.set_pieceLen(static_cast<uint32_t>(pieceLen));
+    tilingData.set_usedCoreNum(static_cast<uint32_t>(usedCoreNum));
+}
+
+static void PrintTilingData(gert::TilingContext* context, SilentCheckV2TilingData& tilingData)
+{
+    const ge::char_t* nodeName = context->GetNodeName();
+    OP_LOGD(nodeName, "totalLen: %lu", tilingData.get_totalLen());
+    OP_LOGD(nodeName, "perCoreLen: %lu", tilingData.get_perCoreLen());
+    OP_LOGD(nodeName, "lastCoreLen: %lu", tilingData.get_lastCoreLen());
+    OP_LOGD(nodeName, "cMinSteps: %ld", tilingData.get_cMinSteps());
+    OP_LOGD(nodeName, "npuAsdDetect: %ld", tilingData.get_npuAsdDetect());
+    OP_LOGD(nodeName, "cThreshL1: %f, cCoeffL1: %f", tilingData.get_cThreshL1(), tilingData.get_cCoeffL1());
+    OP_LOGD(nodeName, "cThreshL2: %f, cCoeffL2: %f", tilingData.get_cThreshL2(), tilingData.get_cCoeffL2());
+    OP_LOGD(nodeName, "pieceLen: %u", tilingData.get_pieceLen());
+    OP_LOGD(nodeName, "usedCoreNum: %u", tilingData.get_usedCoreNum());
+}
+
+static ge::graphStatus Tiling4SilentCheckV2(gert::TilingContext* context)
+{
+    OP_LOGI(context->GetNodeName(), "SilentCheckV2 tiling starts running");
+    auto compileInfo = reinterpret_cast<const SilentCheckV2CompileInfo*>(context->GetCompileInfo());
+    OP_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    OP_CHECK_IF(
+        compileInfo->vectorCoreNum <= 0 || compileInfo->ubByteSize <= RESERVED_UB + REDUCE_WORK_BYTES,
+        OP_LOGE(context->GetNodeName(), "Failed to get core num or ub size."), return ge::GRAPH_FAILED);
+
+    auto valDesc = context->GetInputDesc(VAL_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, valDesc);
+    auto gradDesc = context->GetInputDesc(GRAD_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, gradDesc);
+    ge::DataType dtype = gradDesc->GetDataType();
+    OP_CHECK_IF(
+        valDesc->GetDataType() != dtype,
+        OP_LOGE(context->GetNodeName(), "val and input_grad should have the same dtype."), return ge::GRAPH_FAILED);
+    uint64_t tilingKey = 0;
+    for (const auto& item : DTYPE_KEYS) {
+        if (item.dtype == dtype) {
+            tilingKey = item.tilingKey;
+        }
+    }
+    OP_CHECK_IF(
+        tilingKey == 0, OP_LOGE(context->GetNodeName(), "dtype is not supported."), return ge::GRAPH_FAILED);
+
+    SilentCheckV2TilingData tilingData;
+    uint64_t totalLen = 0;
+    OP_CHECK_IF(
+        CheckShapes(context, totalLen) != ge::GRAPH_SUCCESS,
+        OP_LOGE(context->GetNodeName(), "check input shapes failed."), return ge::GRAPH_FAILED);
+    tilingData.set_totalLen(totalLen);
+    const gert::RuntimeAttrs* attrs = context->GetAttrs();
+    OP_CHECK_NULL_WITH_CONTEXT(context, attrs);
+    GetAttrs(attrs, tilingData);
+    CalcTilingData(ge::GetSizeByDataType(dtype), compileInfo->vectorCoreNum, compileInfo->ubByteSize, tilingData);
+
+    context->SetTilingKey(tilingKey);
+    context->SetBlockDim(tilingData.get_usedCoreNum());
+    // 每核一个32B的nan标记
+    size_t* workspaces = context->GetWorkspaceSizes(1);
+    workspaces[0] = compileInfo->sysWorkspaceByteSize + tilingData.get_usedCoreNum() * BYTE_BLOCK;
+    tilingData.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tilingData.GetDataSize());
+    PrintTilingData(context, tilingData);
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus TilingPrepare4SilentCheckV2(gert::TilingParseContext* context)
+{
+    auto compileInfo = context->GetCompiledInfo<SilentCheckV2CompileInfo>();
+    OP_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    auto platformInfo = context->GetPlatformInfo();
+    OP_CHECK_NULL_WITH_CONTEXT(context, platformInfo);
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(platformInfo);
+    compileInfo->vectorCoreNum = ascendcPlatform.GetCoreNumAiv();
+    OP_CHECK_IF(
+        (compileInfo->vectorCoreNum <= 0), OP_LOGE(context->GetNodeName(), "No vector core available."),
+        return ge::GRAPH_FAILED);
+    uint64_t ubByteSize;
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ubByteSize);
+    compileInfo->ubByteSize = ubByteSize;
+    OP_CHECK_IF(
+        (compileInfo->ubByteSize <= 0), OP_LOGE(context->GetNodeName(), "Failed to get ub size."),
+        return ge::GRAPH_FAILED);
+    compileInfo->sysWorkspaceByteSize = ascendcPlatform.GetLibApiWorkSpaceSize();
+    return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_OPTILING(SilentCheckV2)
+    .Tiling(Tiling4SilentCheckV2)
+    .TilingParse<SilentCheckV2CompileInfo>(TilingPrepare4SilentCheckV2);
+} // namespace optiling
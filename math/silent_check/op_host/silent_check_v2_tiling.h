@@ -0,0 +1,43 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file silent_check_v2_tiling.h
+ * \brief
+ */
+#ifndef OPS_BUILT_IN_OP_TILING_RUNTIME_SILENT_CHECK_V2_H_
+#define OPS_BUILT_IN_OP_TILING_RUNTIME_SILENT_CHECK_V2_H_
+
+#include "register/tilingdata_base.h"
+
+namespace optiling {
+BEGIN_TILING_DATA_DEF(SilentCheckV2TilingData)
+TILING_DATA_FIELD_DEF(uint64_t, totalLen);     // input_grad元素个数
+TILING_DATA_FIELD_DEF(uint64_t, perCoreLen);   // 每核扫描的元素数，按256元素对齐
+TILING_DATA_FIELD_DEF(uint64_t, lastCoreLen);  // 最后一个核扫描的元素数
+TILING_DATA_FIELD_DEF(int64_t, cMinSteps);
+TILING_DATA_FIELD_DEF(int64_t, npuAsdDetect);
+TILING_DATA_FIELD_DEF(float, cThreshL1);
+TILING_DATA_FIELD_DEF(float, cCoeffL1);
+TILING_DATA_FIELD_DEF(float, cThreshL2);
+TILING_DATA_FIELD_DEF(float, cCoeffL2);
+TILING_DATA_FIELD_DEF(uint32_t, pieceLen);     // 每次搬入的元素数
+TILING_DATA_FIELD_DEF(uint32_t, usedCoreNum);
+END_TILING_DATA_DEF;
+REGISTER_TILING_DATA_CLASS(SilentCheckV2, SilentCheckV2TilingData)
+
+struct SilentCheckV2CompileInfo {
+    uint32_t vectorCoreNum;
+    uint32_t sysWorkspaceByteSize;
+    uint32_t ubByteSize;
+};
+} // namespace optiling
+#endif // OPS_BUILT_IN_OP_TILING_RUNTIME_SILENT_CHECK_V2_H_
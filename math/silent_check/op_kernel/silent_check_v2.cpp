@@ -0,0 +1,41 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file silent_check_v2.cpp
+ * \brief
+ */
+
+#include "kernel_operator.h"
+#include "silent_check_v2.h"
+
+using namespace SilentCheckV2;
+
+extern "C" __global__ __aicore__ void silent_check_v2(
+    GM_ADDR val, GM_ADDR input_grad, GM_ADDR sfda, GM_ADDR step, GM_ADDR input_grad_out, GM_ADDR sfda_out,
+    GM_ADDR step_out, GM_ADDR result, GM_ADDR workspace, GM_ADDR tiling)
+{
+    GET_TILING_DATA(tilingData, tiling);
+    GM_ADDR usrWorkspace = GetUserWorkspace(workspace);
+    if (TILING_KEY_IS(1)) {
+        SilentCheckV2ND<float> op;
+        op.Init(val, input_grad, sfda, step, sfda_out, step_out, result, usrWorkspace, &tilingData);
+        op.Process();
+    } else if (TILING_KEY_IS(2)) {
+        SilentCheckV2ND<half> op;
+        op.Init(val, input_grad, sfda, step, sfda_out, step_out, result, usrWorkspace, &tilingData);
+        op.Process();
+    } else if (TILING_KEY_IS(3)) {
+        SilentCheckV2ND<bfloat16_t> op;
+        op.Init(val, input_grad, sfda, step, sfda_out, step_out, result, usrWorkspace, &tilingData);
+        op.Process();
+    }
+}
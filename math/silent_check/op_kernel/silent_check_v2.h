@@ -0,0 +1,309 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file silent_check_v2.h
+ * \brief 静默故障检测：梯度nan/inf扫描、sfda统计更新与异常判定融合为一个kernel
+ *
+ * 各核扫描input_grad的一段，利用x - x对有限值为0、对inf/nan为nan的性质把nan累加到fp32累加区，结束时规约得到本核
+ * 标记写入workspace。所有核同步后由0核汇总标记，读入val、sfda、step完成判定，原地更新sfda、step并写出result。
+ * input_grad作为输出引用与输入绑定同一块内存，kernel不改写其内容，输出即输入。
+ */
+#ifndef SILENT_CHECK_V2_H
+#define SILENT_CHECK_V2_H
+
+#include "kernel_operator.h"
+
+namespace SilentCheckV2 {
+using namespace AscendC;
+
+constexpr int32_t BUFFER_NUM = 2;
+constexpr uint32_t BYTE_BLOCK = 32;
+constexpr uint32_t FLAG_STRIDE = BYTE_BLOCK / sizeof(float);
+constexpr uint32_t REDUCE_WORK_BYTES = 1024;
+constexpr uint32_t SFDA_SIZE = 3;
+constexpr uint32_t PRE_VAL_INDEX = 0;
+constexpr uint32_t MIN_VAL_INDEX = 1;
+constexpr uint32_t MAX_VAL_INDEX = 2;
+constexpr int32_t RESULT_NORMAL = 0;
+constexpr int32_t RESULT_L1 = 1;
+constexpr int32_t RESULT_L2 = 2;
+constexpr float EMA_BETA = 0.99f;
+
+template <typename T>
+class SilentCheckV2ND {
+public:
+    __aicore__ inline SilentCheckV2ND(){};
+    __aicore__ inline void Init(
+        GM_ADDR val, GM_ADDR inputGrad, GM_ADDR sfda, GM_ADDR step, GM_ADDR sfdaOut, GM_ADDR stepOut, GM_ADDR result,
+        GM_ADDR workspace, const SilentCheckV2TilingData* __restrict tilingData);
+    __aicore__ inline void Process();
+
+private:
+    __aicore__ inline float ScanGrad();
+    __aicore__ inline void WriteCoreFlag(float flag);
+    __aicore__ inline bool ReadCoreFlags();
+    __aicore__ inline float LoadVal();
+    __aicore__ inline void UpdateStatistics(bool gradNonFinite);
+    __aicore__ inline bool IsNonFinite(float value);
+
+    template <typename T1>
+    __aicore__ inline T1 Min(T1 a, T1 b)
+    {
+        return a < b ? a : b;
+    }
+
+    template <typename T1>
+    __aicore__ inline T1 Max(T1 a, T1 b)
+    {
+        return a > b ? a : b;
+    }
+
+    template <HardEvent EVENT>
+    __aicore__ inline void SyncFlag()
+    {
+        event_t eventId = static_cast<event_t>(GetTPipePtr()->FetchEventID(EVENT));
+        SetFlag<EVENT>(eventId);
+        WaitFlag<EVENT>(eventId);
+    }
+
+private:
+    TPipe pipe;
+    TQue<QuePosition::VECIN, BUFFER_NUM> inQueue;
+    TBuf<QuePosition::VECCALC> castBuf;
+    TBuf<QuePosition::VECCALC> accBuf;
+    TBuf<QuePosition::VECCALC> workBuf;
+    TBuf<QuePosition::VECCALC> sumBuf;
+    TBuf<QuePosition::VECCALC> flagBuf;
+    TBuf<QuePosition::VECCALC> valBuf;
+    TBuf<QuePosition::VECCALC> sfdaBuf;
+    TBuf<QuePosition::VECCALC> stepBuf;
+    TBuf<QuePosition::VECCALC> resultBuf;
+    GlobalTensor<T> valGm;
+    GlobalTensor<T> gradGm;
+    GlobalTensor<float> sfdaGm;
+    GlobalTensor<int64_t> stepGm;
+    GlobalTensor<float> sfdaOutGm;
+    GlobalTensor<int64_t> stepOutGm;
+    GlobalTensor<int32_t> resultGm;
+    GlobalTensor<float> flagGm;
+
+    uint64_t coreStart = 0;
+    uint64_t coreLen = 0;
+    int64_t cMinSteps = 0;
+    int64_t npuAsdDetect = 0;
+    float cThreshL1 = 0.0f;
+    float cCoeffL1 = 0.0f;
+    float cThreshL2 = 0.0f;
+    float cCoeffL2 = 0.0f;
+    uint32_t pieceLen = 0;
+    uint32_t usedCoreNum = 0;
+};
+
+template <typename T>
+__aicore__ inline void SilentCheckV2ND<T>::Init(
+    GM_ADDR val, GM_ADDR inputGrad, GM_ADDR sfda, GM_ADDR step, GM_ADDR sfdaOut, GM_ADDR stepOut, GM_ADDR result,
+    GM_ADDR workspace, const SilentCheckV2TilingData* __restrict tilingData)
+{
+    uint64_t blockIdx = GetBlockIdx();
+    usedCoreNum = tilingData->usedCoreNum;
+    coreStart = blockIdx * tilingData->perCoreLen;
+    coreLen = blockIdx + 1 == usedCoreNum ? tilingData->lastCoreLen : tilingData->perCoreLen;
+    cMinSteps = tilingData->cMinSteps;
+    npuAsdDetect = tilingData->npuAsdDetect;
+    cThreshL1 = tilingData->cThreshL1;
+    cCoeffL1 = tilingData->cCoeffL1;
+    cThreshL2 = tilingData->cThreshL2;
+    cCoeffL2 = tilingData->cCoeffL2;
+    pieceLen = tilingData->pieceLen;
+
+    valGm.SetGlobalBuffer((__gm__ T*)val);
+    gradGm.SetGlobalBuffer((__gm__ T*)inputGrad);
+    sfdaGm.SetGlobalBuffer((__gm__ float*)sfda);
+    stepGm.SetGlobalBuffer((__gm__ int64_t*)step);
+    sfdaOutGm.SetGlobalBuffer((__gm__ float*)sfdaOut);
+    stepOutGm.SetGlobalBuffer((__gm__ int64_t*)stepOut);
+    resultGm.SetGlobalBuffer((__gm__ int32_t*)result);
+    flagGm.SetGlobalBuffer((__gm__ float*)workspace);
+
+    pipe.InitBuffer(inQueue, BUFFER_NUM, pieceLen * sizeof(T));
+    if constexpr (!IsSameType<T, float>::value) {
+        pipe.InitBuffer(castBuf, pieceLen * sizeof(float));
+    }
+    pipe.InitBuffer(accBuf, pieceLen * sizeof(float));
+    pipe.InitBuffer(workBuf, REDUCE_WORK_BYTES);
+    pipe.InitBuffer(sumBuf, BYTE_BLOCK);
+    pipe.InitBuffer(flagBuf, usedCoreNum * BYTE_BLOCK);
+    pipe.InitBuffer(valBuf, BYTE_BLOCK);
+    pipe.InitBuffer(sfdaBuf, BYTE_BLOCK);
+    pipe.InitBuffer(stepBuf, BYTE_BLOCK);
+    pipe.InitBuffer(resultBuf, BYTE_BLOCK);
+}
+
+template <typename T>
+__aicore__ inline void SilentCheckV2ND<T>::Process()
+{
+    WriteCoreFlag(ScanGrad());
+    SyncAll();
+    if (GetBlockIdx() != 0) {
+        return;
+    }
+    UpdateStatistics(ReadCoreFlags());
+}
+
+// 返回0或nan，nan表示本核负责的梯度中存在inf/nan
+template <typename T>
+__aicore__ inline float SilentCheckV2ND<T>::ScanGrad()
+{
+    LocalTensor<float> accLocal = accBuf.Get<float>();
+    Duplicate(accLocal, 0.0f, pieceLen);
+    PipeBarrier<PIPE_V>();
+    for (uint64_t offset = 0; offset < coreLen; offset += pieceLen) {
+        uint32_t len = static_cast<uint32_t>(Min(static_cast<uint64_t>(pieceLen), coreLen - offset));
+        LocalTensor<T> inLocal = inQueue.AllocTensor<T>();
+        DataCopyExtParams copyParams = {1, static_cast<uint32_t>(len * sizeof(T)), 0, 0, 0};
+        DataCopyPadExtParams<T> padParams = {false, 0, 0, static_cast<T>(0)};
+        DataCopyPad(inLocal, gradGm[coreStart + offset], copyParams, padParams);
+        inQueue.EnQue(inLocal);
+        inLocal = inQueue.DeQue<T>();
+
+        LocalTensor<float> xLocal;
+        if constexpr (IsSameType<T, float>::value) {
+            xLocal = inLocal;
+        } else {
+            xLocal = castBuf.Get<float>();
+            Cast(xLocal, inLocal, RoundMode::CAST_NONE, len);
+            PipeBarrier<PIPE_V>();
+        }
+        Sub(xLocal, xLocal, xLocal, len);
+        PipeBarrier<PIPE_V>();
+        Add(accLocal, accLocal, xLocal, len);
+        PipeBarrier<PIPE_V>();
+        inQueue.FreeTensor(inLocal);
+    }
+    LocalTensor<float> sumLocal = sumBuf.Get<float>();
+    LocalTensor<float> workLocal = workBuf.Get<float>();
+    ReduceSum<float>(sumLocal, accLocal, workLocal, pieceLen);
+    SyncFlag<HardEvent::V_S>();
+    return sumLocal.GetValue(0);
+}
+
+// 每核独占workspace中的一个32B块，避免多核写同一块
+template <typename T>
+__aicore__ inline void SilentCheckV2ND<T>::WriteCoreFlag(float flag)
+{
+    LocalTensor<float> flagLocal = flagBuf.Get<float>();
+    Duplicate(flagLocal, flag, FLAG_STRIDE);
+    SyncFlag<HardEvent::V_MTE3>();
+    DataCopyExtParams copyParams = {1, BYTE_BLOCK, 0, 0, 0};
+    DataCopyPad(flagGm[GetBlockIdx() * FLAG_STRIDE], flagLocal, copyParams);
+    SyncFlag<HardEvent::MTE3_MTE2>();
+}
+
+template <typename T>
+__aicore__ inline bool SilentCheckV2ND<T>::ReadCoreFlags()
+{
+    LocalTensor<float> flagLocal = flagBuf.Get<float>();
+    DataCopyExtParams copyParams = {1, usedCoreNum * BYTE_BLOCK, 0, 0, 0};
+    DataCopyPadExtParams<float> padParams = {false, 0, 0, 0.0f};
+    DataCopyPad(flagLocal, flagGm, copyParams, padParams);
+    SyncFlag<HardEvent::MTE2_S>();
+    for (uint32_t i = 0; i < usedCoreNum; i++) {
+        if (IsNonFinite(flagLocal.GetValue(i * FLAG_STRIDE))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename T>
+__aicore__ inline float SilentCheckV2ND<T>::LoadVal()
+{
+    LocalTensor<T> valLocal = valBuf.Get<T>();
+    DataCopyExtParams copyParams = {1, static_cast<uint32_t>(sizeof(T)), 0, 0, 0};
+    DataCopyPadExtParams<T> padParams = {false, 0, 0, static_cast<T>(0)};
+    DataCopyPad(valLocal, valGm, copyParams, padParams);
+    if constexpr (IsSameType<T, float>::value) {
+        SyncFlag<HardEvent::MTE2_S>();
+        return valLocal.GetValue(0);
+    } else {
+        LocalTensor<float> sumLocal = sumBuf.Get<float>();
+        SyncFlag<HardEvent::MTE2_V>();
+        Cast(sumLocal, valLocal, RoundMode::CAST_NONE, 1);
+        SyncFlag<HardEvent::V_S>();
+        return sumLocal.GetValue(0);
+    }
+}
+
+// sfda依次为[preVal, minVal, maxVal]；L1异常时不把异常值计入统计
+template <typename T>
+__aicore__ inline void SilentCheckV2ND<T>::UpdateStatistics(bool gradNonFinite)
+{
+    LocalTensor<float> sfdaLocal = sfdaBuf.Get<float>();
+    LocalTensor<int64_t> stepLocal = stepBuf.Get<int64_t>();
+    DataCopyExtParams sfdaParams = {1, static_cast<uint32_t>(SFDA_SIZE * sizeof(float)), 0, 0, 0};
+    DataCopyPadExtParams<float> sfdaPadParams = {false, 0, 0, 0.0f};
+    DataCopyPad(sfdaLocal, sfdaGm, sfdaParams, sfdaPadParams);
+    DataCopyExtParams stepParams = {1, static_cast<uint32_t>(sizeof(int64_t)), 0, 0, 0};
+    DataCopyPadExtParams<int64_t> stepPadParams = {false, 0, 0, 0};
+    DataCopyPad(stepLocal, stepGm, stepParams, stepPadParams);
+    float val = LoadVal();
+    SyncFlag<HardEvent::MTE2_S>();
+    float preVal = sfdaLocal.GetValue(PRE_VAL_INDEX);
+    float minVal = sfdaLocal.GetValue(MIN_VAL_INDEX);
+    float maxVal = sfdaLocal.GetValue(MAX_VAL_INDEX);
+    int64_t step = stepLocal.GetValue(0);
+
+    int32_t result = RESULT_NORMAL;
+    if (npuAsdDetect != 0) {
+        if (gradNonFinite || IsNonFinite(val)) {
+            result = RESULT_L1;
+        } else if (step >= cMinSteps) {
+            if (val > Max(cThreshL1, preVal * cCoeffL1)) {
+                result = RESULT_L1;
+            } else if (val > Max(cThreshL2, preVal * cCoeffL2)) {
+                result = RESULT_L2;
+            }
+        }
+    }
+    if (result != RESULT_L1 && !IsNonFinite(val)) {
+        if (step == 0) {
+            preVal = val;
+            minVal = val;
+            maxVal = val;
+        } else {
+            preVal = EMA_BETA * preVal + (1.0f - EMA_BETA) * val;
+            minVal = Min(minVal, val);
+            maxVal = Max(maxVal, val);
+        }
+    }
+    sfdaLocal.SetValue(PRE_VAL_INDEX, preVal);
+    sfdaLocal.SetValue(MIN_VAL_INDEX, minVal);
+    sfdaLocal.SetValue(MAX_VAL_INDEX, maxVal);
+    stepLocal.SetValue(0, step + 1);
+    LocalTensor<int32_t> resultLocal = resultBuf.Get<int32_t>();
+    resultLocal.SetValue(0, result);
+    SyncFlag<HardEvent::S_MTE3>();
+    DataCopyPad(sfdaOutGm, sfdaLocal, sfdaParams);
+    DataCopyPad(stepOutGm, stepLocal, stepParams);
+    DataCopyExtParams resultParams = {1, static_cast<uint32_t>(sizeof(int32_t)), 0, 0, 0};
+    DataCopyPad(resultGm, resultLocal, resultParams);
+}
+
+template <typename T>
+__aicore__ inline bool SilentCheckV2ND<T>::IsNonFinite(float value)
+{
+    uint32_t bits = *((uint32_t*)&value);
+    return ((bits & 0x7FFFFFFF) >> 23) == 0xFF;
+}
+} // namespace SilentCheckV2
+
+#endif // SILENT_CHECK_V2_H
@@ -10,6 +10,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <cstdlib>
 #include <iostream>
 
 #include "opdev/make_op_executor.h"
@@ -64,4 +65,44 @@ TEST_F(SilentCheckV2Test, SilentCheckV2_success)
     auto out = l0op::SilentCheckV2(
         val, inputGrad, sfda, step, cMinSteps, cThreshL1, cCoeffL1, cThreshL2, cCoeffL2, npuAsdDetect, exe);
     ASSERT_NE(out, nullptr);
-}
\ No newline at end of file
+}
+
+TEST_F(SilentCheckV2Test, SilentCheckV2_aicore_success)
+{
+    auto val = CreateAclTensor({1}, ACL_FLOAT);
+    auto inputGrad = CreateAclTensor({4}, ACL_FLOAT);
+    auto sfda = CreateAclTensor({3}, ACL_FLOAT);
+    auto step = CreateAclTensor({1}, ACL_INT64);
+    auto result = CreateAclTensor({1}, ACL_INT32);
+    int32_t cMinSteps = 7;
+    float cThreshL1 = 1000000;
+    float cCoeffL1 = 100000;
+    float cThreshL2 = 10000;
+    float cCoeffL2 = 5000;
+    int32_t npuAsdDetect = 1;
+    auto out = l0op::SilentCheckV2(
+        val, inputGrad, sfda, step, cMinSteps, cThreshL1, cCoeffL1, cThreshL2, cCoeffL2, npuAsdDetect, result, exe);
+    ASSERT_EQ(out, result);
+    EXPECT_EQ(out->GetDataType(), op::DataType::DT_INT32);
+    EXPECT_EQ(out->GetViewShape().GetShapeSize(), 1);
+    EXPECT_EQ(exe->kernelLaunchObjList_.size(), 1);
+    Clear();
+}
+
+TEST_F(SilentCheckV2Test, ascend910B2_SilentCheckV2_aicore_opt_in)
+{
+    auto val = CreateAclTensor({1}, ACL_FLOAT);
+    auto inputGrad = CreateAclTensor({4}, ACL_FLOAT);
+    auto fp16Grad = CreateAclTensor({4}, ACL_FLOAT16);
+
+    unsetenv("ACLNN_SILENT_CHECK_AICORE");
+    EXPECT_FALSE(l0op::IsSilentCheckV2AiCoreSupport(val, inputGrad));
+
+    setenv("ACLNN_SILENT_CHECK_AICORE", "1", 1);
+    EXPECT_TRUE(l0op::IsSilentCheckV2AiCoreSupport(val, inputGrad));
+    EXPECT_FALSE(l0op::IsSilentCheckV2AiCoreSupport(val, fp16Grad));
+
+    setenv("ACLNN_SILENT_CHECK_AICORE", "0", 1);
+    EXPECT_FALSE(l0op::IsSilentCheckV2AiCoreSupport(val, inputGrad));
+    unsetenv("ACLNN_SILENT_CHECK_AICORE");
+}
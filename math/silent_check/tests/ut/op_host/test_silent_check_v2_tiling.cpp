@@ -0,0 +1,162 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file test_silent_check_v2_tiling.cpp
+ * \brief
+ */
+
+#include <iostream>
+#include <vector>
+#include <gtest/gtest.h>
+#include "../../../op_host/silent_check_v2_tiling.h"
+#include "tiling_context_faker.h"
+#include "tiling_case_executor.h"
+
+class SilentCheckV2Tiling : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        std::cout << "SilentCheckV2Tiling SetUp" << std::endl;
+    }
+    static void TearDownTestCase()
+    {
+        std::cout << "SilentCheckV2Tiling TearDown" << std::endl;
+    }
+};
+
+static std::vector<gert::TilingContextPara::OpAttr> BuildAttrs(
+    int64_t cMinSteps, float cThreshL1, float cCoeffL1, float cThreshL2, float cCoeffL2, int64_t npuAsdDetect)
+{
+    return {
+        gert::TilingContextPara::OpAttr("c_min_steps", Ops::Math::AnyValue::CreateFrom<int64_t>(cMinSteps)),
+        gert::TilingContextPara::OpAttr("c_thresh_l1", Ops::Math::AnyValue::CreateFrom<float>(cThreshL1)),
+        gert::TilingContextPara::OpAttr("c_coeff_l1", Ops::Math::AnyValue::CreateFrom<float>(cCoeffL1)),
+        gert::TilingContextPara::OpAttr("c_thresh_l2", Ops::Math::AnyValue::CreateFrom<float>(cThreshL2)),
+        gert::TilingContextPara::OpAttr("c_coeff_l2", Ops::Math::AnyValue::CreateFrom<float>(cCoeffL2)),
+        gert::TilingContextPara::OpAttr("npu_asd_detect", Ops::Math::AnyValue::CreateFrom<int64_t>(npuAsdDetect))};
+}
+
+TEST_F(SilentCheckV2Tiling, silent_check_v2_tiling_large_float)
+{
+    optiling::SilentCheckV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "SilentCheckV2",
+        {
+            {{{}, {}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{4096, 4096}, {4096, 4096}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{3}, {3}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_INT64, ge::FORMAT_ND},
+        },
+        {
+            {{{4096, 4096}, {4096, 4096}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{3}, {3}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_INT64, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_INT32, ge::FORMAT_ND},
+        },
+        BuildAttrs(7, 1000000.0f, 100000.0f, 10000.0f, 5000.0f, 1), &compileInfo);
+    uint64_t expectTilingKey = 1;
+    std::string expectTilingData =
+        "16777216 262144 262144 7 1 5171064759314031616 5015954454904324096 274877923072 ";
+    std::vector<size_t> expectWorkspaces = {16779264};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(SilentCheckV2Tiling, silent_check_v2_tiling_small_float16)
+{
+    optiling::SilentCheckV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "SilentCheckV2",
+        {
+            {{{}, {}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{1000}, {1000}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{3}, {3}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_INT64, ge::FORMAT_ND},
+        },
+        {
+            {{{1000}, {1000}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{3}, {3}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_INT64, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_INT32, ge::FORMAT_ND},
+        },
+        BuildAttrs(2, 300.0f, 1.0f, 0.8f, 0.5f, 1), &compileInfo);
+    uint64_t expectTilingKey = 2;
+    std::string expectTilingData = "1000 4096 1000 2 1 4575657222542327808 4539628425451457741 4294971392 ";
+    std::vector<size_t> expectWorkspaces = {16777248};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(SilentCheckV2Tiling, silent_check_v2_tiling_bfloat16_tail_core)
+{
+    optiling::SilentCheckV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "SilentCheckV2",
+        {
+            {{{1}, {1}}, ge::DT_BF16, ge::FORMAT_ND},
+            {{{3, 100000}, {3, 100000}}, ge::DT_BF16, ge::FORMAT_ND},
+            {{{3}, {3}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_INT64, ge::FORMAT_ND},
+        },
+        {
+            {{{3, 100000}, {3, 100000}}, ge::DT_BF16, ge::FORMAT_ND},
+            {{{3}, {3}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_INT64, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_INT32, ge::FORMAT_ND},
+        },
+        BuildAttrs(7, 1000000.0f, 100000.0f, 10000.0f, 5000.0f, 0), &compileInfo);
+    uint64_t expectTilingKey = 3;
+    std::string expectTilingData =
+        "300000 4864 3296 7 0 5171064759314031616 5015954454904324096 266287977216 ";
+    std::vector<size_t> expectWorkspaces = {16779200};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(SilentCheckV2Tiling, silent_check_v2_tiling_dtype_mismatch)
+{
+    optiling::SilentCheckV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "SilentCheckV2",
+        {
+            {{{}, {}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{1000}, {1000}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{3}, {3}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_INT64, ge::FORMAT_ND},
+        },
+        {
+            {{{1000}, {1000}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{3}, {3}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_INT64, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_INT32, ge::FORMAT_ND},
+        },
+        BuildAttrs(7, 1000000.0f, 100000.0f, 10000.0f, 5000.0f, 1), &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
+
+TEST_F(SilentCheckV2Tiling, silent_check_v2_tiling_invalid_sfda)
+{
+    optiling::SilentCheckV2CompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "SilentCheckV2",
+        {
+            {{{}, {}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{1000}, {1000}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{2}, {2}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_INT64, ge::FORMAT_ND},
+        },
+        {
+            {{{1000}, {1000}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{2}, {2}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_INT64, ge::FORMAT_ND},
+            {{{1}, {1}}, ge::DT_INT32, ge::FORMAT_ND},
+        },
+        BuildAttrs(7, 1000000.0f, 100000.0f, 10000.0f, 5000.0f, 1), &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
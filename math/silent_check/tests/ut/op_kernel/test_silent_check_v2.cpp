@@ -0,0 +1,151 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+/*!
+ * \file test_silent_check_v2.cpp
+ * \brief
+ */
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "gtest/gtest.h"
+#include "tikicpulib.h"
+#include "data_utils.h"
+
+using namespace std;
+
+extern "C" __global__ __aicore__ void silent_check_v2(
+    GM_ADDR val, GM_ADDR input_grad, GM_ADDR sfda, GM_ADDR step, GM_ADDR input_grad_out, GM_ADDR sfda_out,
+    GM_ADDR step_out, GM_ADDR result, GM_ADDR workspace, GM_ADDR tiling);
+
+class silent_check_v2_test : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        cout << "silent_check_v2_test SetUp\n" << endl;
+    }
+    static void TearDownTestCase()
+    {
+        cout << "silent_check_v2_test TearDown\n" << endl;
+    }
+};
+
+struct SilentCheckState {
+    float sfda[3];
+    int64_t step;
+    int32_t result;
+};
+
+static void InitTilingData(SilentCheckV2TilingData* tilingData, uint64_t totalLen, uint32_t blockDim)
+{
+    uint64_t perCoreLen = 4096;
+    tilingData->totalLen = totalLen;
+    tilingData->perCoreLen = perCoreLen;
+    tilingData->lastCoreLen = totalLen - (blockDim - 1) * perCoreLen;
+    tilingData->cMinSteps = 2;
+    tilingData->npuAsdDetect = 1;
+    tilingData->cThreshL1 = 300.0f;
+    tilingData->cCoeffL1 = 1.0f;
+    tilingData->cThreshL2 = 0.8f;
+    tilingData->cCoeffL2 = 0.5f;
+    tilingData->pieceLen = 1024;
+    tilingData->usedCoreNum = blockDim;
+}
+
+// 原地执行一次检测，返回更新后的sfda、step与result
+static SilentCheckState RunFloatSilentCheck(
+    float valHost, const vector<float>& gradHost, const SilentCheckState& state, uint32_t blockDim)
+{
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(sizeof(SilentCheckV2TilingData));
+    SilentCheckV2TilingData* tilingData = reinterpret_cast<SilentCheckV2TilingData*>(tiling);
+    InitTilingData(tilingData, gradHost.size(), blockDim);
+    uint8_t* val = (uint8_t*)AscendC::GmAlloc(32);
+    uint8_t* grad = (uint8_t*)AscendC::GmAlloc(gradHost.size() * sizeof(float));
+    uint8_t* sfda = (uint8_t*)AscendC::GmAlloc(32);
+    uint8_t* step = (uint8_t*)AscendC::GmAlloc(32);
+    uint8_t* result = (uint8_t*)AscendC::GmAlloc(32);
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(16 * 1024 * 1024 + 64 * 32);
+    memcpy(val, &valHost, sizeof(float));
+    memcpy(grad, gradHost.data(), gradHost.size() * sizeof(float));
+    memcpy(sfda, state.sfda, sizeof(state.sfda));
+    memcpy(step, &state.step, sizeof(int64_t));
+
+    ICPU_SET_TILING_KEY(1);
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_RUN_KF(silent_check_v2, blockDim, val, grad, sfda, step, grad, sfda, step, result, workspace,
+                (uint8_t*)(tilingData));
+
+    SilentCheckState out;
+    memcpy(out.sfda, sfda, sizeof(out.sfda));
+    memcpy(&out.step, step, sizeof(int64_t));
+    memcpy(&out.result, result, sizeof(int32_t));
+    EXPECT_EQ(memcmp(grad, gradHost.data(), gradHost.size() * sizeof(float)), 0);
+
+    AscendC::GmFree(val);
+    AscendC::GmFree(grad);
+    AscendC::GmFree(sfda);
+    AscendC::GmFree(step);
+    AscendC::GmFree(result);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+    return out;
+}
+
+TEST_F(silent_check_v2_test, test_float_first_step)
+{
+    vector<float> grad(3000, 0.5f);
+    SilentCheckState state = {{0.0f, 0.0f, 0.0f}, 0, -1};
+    SilentCheckState out = RunFloatSilentCheck(5.0f, grad, state, 1);
+    EXPECT_EQ(out.result, 0);
+    EXPECT_EQ(out.step, 1);
+    EXPECT_FLOAT_EQ(out.sfda[0], 5.0f);
+    EXPECT_FLOAT_EQ(out.sfda[1], 5.0f);
+    EXPECT_FLOAT_EQ(out.sfda[2], 5.0f);
+}
+
+TEST_F(silent_check_v2_test, test_float_l1_keeps_statistics)
+{
+    vector<float> grad(3000, 0.5f);
+    SilentCheckState state = {{1.0f, 1.0f, 1.0f}, 10, -1};
+    SilentCheckState out = RunFloatSilentCheck(400.0f, grad, state, 1);
+    EXPECT_EQ(out.result, 1);
+    EXPECT_EQ(out.step, 11);
+    EXPECT_FLOAT_EQ(out.sfda[0], 1.0f);
+    EXPECT_FLOAT_EQ(out.sfda[1], 1.0f);
+    EXPECT_FLOAT_EQ(out.sfda[2], 1.0f);
+}
+
+TEST_F(silent_check_v2_test, test_float_l2_updates_statistics)
+{
+    vector<float> grad(3000, 0.5f);
+    SilentCheckState state = {{1.0f, 1.0f, 1.0f}, 10, -1};
+    SilentCheckState out = RunFloatSilentCheck(0.9f, grad, state, 1);
+    EXPECT_EQ(out.result, 2);
+    EXPECT_EQ(out.step, 11);
+    EXPECT_NEAR(out.sfda[0], 0.99f + 0.01f * 0.9f, 1e-6f);
+    EXPECT_FLOAT_EQ(out.sfda[1], 0.9f);
+    EXPECT_FLOAT_EQ(out.sfda[2], 1.0f);
+}
+
+TEST_F(silent_check_v2_test, test_float_inf_grad_on_tail_core)
+{
+    // 3核，inf位于最后一个核负责的区间，warm-up阶段也判定为L1
+    vector<float> grad(10000, 0.25f);
+    grad[9000] = std::numeric_limits<float>::infinity();
+    SilentCheckState state = {{1.0f, 1.0f, 1.0f}, 0, -1};
+    SilentCheckState out = RunFloatSilentCheck(1.0f, grad, state, 3);
+    EXPECT_EQ(out.result, 1);
+    EXPECT_EQ(out.step, 1);
+    EXPECT_FLOAT_EQ(out.sfda[0], 1.0f);
+}
@@ -0,0 +1,89 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file transform_bias_rescale_qkv_v2_def.cpp
+ * \brief
+ */
+
+#include "register/op_def_registry.h"
+
+namespace ops {
+
+static const std::vector<ge::DataType> QKV_DTYPES = {ge::DT_BF16, ge::DT_FLOAT16, ge::DT_FLOAT,
+                                                     ge::DT_BF16, ge::DT_FLOAT16, ge::DT_FLOAT};
+// 后三组为K/V的int8动态量化输出
+static const std::vector<ge::DataType> KV_DTYPES = {ge::DT_BF16, ge::DT_FLOAT16, ge::DT_FLOAT,
+                                                    ge::DT_INT8, ge::DT_INT8,    ge::DT_INT8};
+static const std::vector<ge::DataType> SCALE_DTYPES = {ge::DT_FLOAT, ge::DT_FLOAT, ge::DT_FLOAT,
+                                                       ge::DT_FLOAT, ge::DT_FLOAT, ge::DT_FLOAT};
+static const std::vector<ge::Format> ND_FORMATS = {ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND,
+                                                   ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND};
+
+class TransformBiasRescaleQkvV2 : public OpDef {
+public:
+    explicit TransformBiasRescaleQkvV2(const char* name) : OpDef(name)
+    {
+        this->Input("qkv")
+            .ParamType(REQUIRED)
+            .DataType(QKV_DTYPES)
+            .Format(ND_FORMATS)
+            .UnknownShapeFormat(ND_FORMATS)
+            .AutoContiguous();
+
+        this->Input("qkv_bias")
+            .ParamType(REQUIRED)
+            .DataType(QKV_DTYPES)
+            .Format(ND_FORMATS)
+            .UnknownShapeFormat(ND_FORMATS)
+            .AutoContiguous();
+
+        this->Attr("num_heads").AttrType(REQUIRED).Int();
+        this->Attr("layout").AttrType(OPTIONAL).String("BNSD");
+        this->Attr("kv_quant_mode").AttrType(OPTIONAL).Int(0);
+
+        this->Output("q")
+            .ParamType(REQUIRED)
+            .DataType(QKV_DTYPES)
+            .Format(ND_FORMATS)
+            .UnknownShapeFormat(ND_FORMATS);
+
+        this->Output("k")
+            .ParamType(REQUIRED)
+            .DataType(KV_DTYPES)
+            .Format(ND_FORMATS)
+            .UnknownShapeFormat(ND_FORMATS);
+
+        this->Output("v")
+            .ParamType(REQUIRED)
+            .DataType(KV_DTYPES)
+            .Format(ND_FORMATS)
+            .UnknownShapeFormat(ND_FORMATS);
+
+        this->Output("k_scale")
+            .ParamType(REQUIRED)
+            .DataType(SCALE_DTYPES)
+            .Format(ND_FORMATS)
+            .UnknownShapeFormat(ND_FORMATS);
+
+        this->Output("v_scale")
+            .ParamType(REQUIRED)
+            .DataType(SCALE_DTYPES)
+            .Format(ND_FORMATS)
+            .UnknownShapeFormat(ND_FORMATS);
+
+        this->AICore().AddConfig("ascend910b");
+        this->AICore().AddConfig("ascend910_93");
+    }
+};
+
+OP_ADD(TransformBiasRescaleQkvV2);
+} // namespace ops
@@ -0,0 +1,136 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file transform_bias_rescale_qkv_v2_infershape.cpp
+ * \brief
+ */
+
+#include <cstring>
+#include "log/log.h"
+#include "register/op_impl_registry.h"
+
+using namespace ge;
+
+namespace ops {
+
+static constexpr size_t IDX_QKV = 0;
+static constexpr size_t IDX_Q = 0;
+static constexpr size_t IDX_K = 1;
+static constexpr size_t IDX_V = 2;
+static constexpr size_t IDX_K_SCALE = 3;
+static constexpr size_t IDX_V_SCALE = 4;
+static constexpr size_t ATTR_NUM_HEADS = 0;
+static constexpr size_t ATTR_LAYOUT = 1;
+static constexpr size_t ATTR_KV_QUANT_MODE = 2;
+static constexpr size_t QKV_DIM_NUM = 3;
+static constexpr int64_t NUM_THREE = 3;
+static constexpr int64_t KV_QUANT_INT8 = 1;
+static constexpr int64_t UNKNOWN_DIM = -1;
+
+static int64_t GetKvQuantMode(const gert::RuntimeAttrs* attrs)
+{
+    const int64_t* quantMode = attrs->GetAttrPointer<int64_t>(ATTR_KV_QUANT_MODE);
+    return quantMode == nullptr ? 0 : *quantMode;
+}
+
+static int64_t MulDim(int64_t a, int64_t b)
+{
+    return (a < 0 || b < 0) ? UNKNOWN_DIM : a * b;
+}
+
+static ge::graphStatus InferShape4TransformBiasRescaleQkvV2(gert::InferShapeContext* context)
+{
+    OP_LOGD(context, "Begin to do InferShape4TransformBiasRescaleQkvV2");
+    auto qkvShape = context->GetInputShape(IDX_QKV);
+    OP_CHECK_NULL_WITH_CONTEXT(context, qkvShape);
+    auto attrs = context->GetAttrs();
+    OP_CHECK_NULL_WITH_CONTEXT(context, attrs);
+    const int64_t* numHeadsPtr = attrs->GetAttrPointer<int64_t>(ATTR_NUM_HEADS);
+    OP_CHECK_NULL_WITH_CONTEXT(context, numHeadsPtr);
+    int64_t numHeads = *numHeadsPtr;
+    OP_CHECK_IF(
+        numHeads <= 0, OP_LOGE(context->GetNodeName(), "num_heads should be positive."), return GRAPH_FAILED);
+    OP_CHECK_IF(
+        qkvShape->GetDimNum() != QKV_DIM_NUM, OP_LOGE(context->GetNodeName(), "qkv should be 3D."),
+        return GRAPH_FAILED);
+    const char* layout = attrs->GetAttrPointer<char>(ATTR_LAYOUT);
+    bool isTnd = layout != nullptr && std::strcmp(layout, "TND") == 0;
+    OP_CHECK_IF(
+        layout != nullptr && !isTnd && std::strcmp(layout, "BNSD") != 0,
+        OP_LOGE(context->GetNodeName(), "layout should be BNSD or TND."), return GRAPH_FAILED);
+
+    int64_t batch = qkvShape->GetDim(0);
+    int64_t token = qkvShape->GetDim(1);
+    int64_t tripleDim = qkvShape->GetDim(2);
+    int64_t dimPerHead = tripleDim < 0 ? UNKNOWN_DIM : tripleDim / NUM_THREE / numHeads;
+
+    gert::Shape outShape;
+    gert::Shape scaleShape;
+    if (isTnd) {
+        outShape.SetDimNum(3);
+        outShape.SetDim(0, MulDim(batch, token));
+        outShape.SetDim(1, numHeads);
+        outShape.SetDim(2, dimPerHead);
+        scaleShape.SetDimNum(2);
+        scaleShape.SetDim(0, MulDim(batch, token));
+        scaleShape.SetDim(1, numHeads);
+    } else {
+        outShape.SetDimNum(4);
+        outShape.SetDim(0, batch);
+        outShape.SetDim(1, numHeads);
+        outShape.SetDim(2, token);
+        outShape.SetDim(3, dimPerHead);
+        scaleShape.SetDimNum(3);
+        scaleShape.SetDim(0, batch);
+        scaleShape.SetDim(1, numHeads);
+        scaleShape.SetDim(2, token);
+    }
+    // 不量化时scale输出为空Tensor
+    if (GetKvQuantMode(attrs) != KV_QUANT_INT8) {
+        scaleShape.SetDimNum(1);
+        scaleShape.SetDim(0, 0);
+    }
+
+    for (size_t idx : {IDX_Q, IDX_K, IDX_V}) {
+        auto yShape = context->GetOutputShape(idx);
+        OP_CHECK_NULL_WITH_CONTEXT(context, yShape);
+        *yShape = outShape;
+    }
+    for (size_t idx : {IDX_K_SCALE, IDX_V_SCALE}) {
+        auto yShape = context->GetOutputShape(idx);
+        OP_CHECK_NULL_WITH_CONTEXT(context, yShape);
+        *yShape = scaleShape;
+    }
+    OP_LOGD(context, "End to do InferShape4TransformBiasRescaleQkvV2");
+    return GRAPH_SUCCESS;
+}
+
+static graphStatus InferDataType4TransformBiasRescaleQkvV2(gert::InferDataTypeContext* context)
+{
+    OP_LOGD(context, "Begin to do InferDataType4TransformBiasRescaleQkvV2");
+    auto attrs = context->GetAttrs();
+    OP_CHECK_NULL_WITH_CONTEXT(context, attrs);
+    auto inputDtype = context->GetInputDataType(IDX_QKV);
+    auto kvDtype = GetKvQuantMode(attrs) == KV_QUANT_INT8 ? ge::DT_INT8 : inputDtype;
+    context->SetOutputDataType(IDX_Q, inputDtype);
+    context->SetOutputDataType(IDX_K, kvDtype);
+    context->SetOutputDataType(IDX_V, kvDtype);
+    context->SetOutputDataType(IDX_K_SCALE, ge::DT_FLOAT);
+    context->SetOutputDataType(IDX_V_SCALE, ge::DT_FLOAT);
+    OP_LOGD(context, "End to do InferDataType4TransformBiasRescaleQkvV2");
+    return GRAPH_SUCCESS;
+}
+
+IMPL_OP_INFERSHAPE(TransformBiasRescaleQkvV2)
+    .InferShape(InferShape4TransformBiasRescaleQkvV2)
+    .InferDataType(InferDataType4TransformBiasRescaleQkvV2);
+} // namespace ops
@@ -0,0 +1,268 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file transform_bias_rescale_qkv_v2_tiling.cpp
+ * \brief transform_bias_rescale_qkv_v2_tiling source file
+ */
+#include <algorithm>
+#include <cstring>
+#include "register/op_impl_registry.h"
+#include "tiling/platform/platform_ascendc.h"
+#include "log/log.h"
+#include "transform_bias_rescale_qkv_v2_tiling.h"
+
+namespace optiling {
+constexpr int32_t QKV_INPUT_INDEX = 0;
+constexpr int32_t QKV_BIAS_INPUT_INDEX = 1;
+constexpr int32_t K_OUTPUT_INDEX = 1;
+constexpr size_t NUM_HEADS_ATTR_INDEX = 0;
+constexpr size_t LAYOUT_ATTR_INDEX = 1;
+constexpr size_t KV_QUANT_MODE_ATTR_INDEX = 2;
+constexpr size_t QKV_DIM_NUM = 3;
+constexpr int64_t NUM_THREE = 3;
+constexpr int64_t LAYOUT_BNSD = 0;
+constexpr int64_t LAYOUT_TND = 1;
+constexpr int64_t KV_QUANT_NONE = 0;
+constexpr int64_t KV_QUANT_INT8 = 1;
+constexpr uint64_t TILING_KEY_DEFAULT = 1;
+constexpr int64_t DIM_ALIGN = 32;        // int8/fp16/fp32下UB内每个头的行长都按32B对齐
+constexpr int64_t MAX_DIM_PAD = 2016;    // 行长按32B计的repeat stride不能超过255
+constexpr int64_t MAX_ROWS = 255;        // tokenBlock * headBlock作为repeat次数的上限
+constexpr int64_t FLOAT_BYTES = 4;
+constexpr int64_t REDUCE_ALIGN = 64;
+constexpr int64_t BRCB_ALIGN = 8;
+constexpr int64_t BYTE_BLOCK = 32;
+constexpr int64_t RESERVED_UB = 1024;
+
+static inline int64_t CeilDiv(int64_t a, int64_t b)
+{
+    return b == 0 ? a : (a + b - 1) / b;
+}
+
+static inline int64_t CeilAlign(int64_t a, int64_t b)
+{
+    return CeilDiv(a, b) * b;
+}
+
+// 与kernel内的InitBuffer一一对应：输入/输出双buffer、fp32中间结果、bias，量化时再加|x|、行最大值与scale的Brcb结果
+static int64_t CalcUbCost(int64_t tokenBlock, int64_t headBlock, int64_t dimPad, int64_t typeSize, bool quant)
+{
+    int64_t rows = tokenBlock * headBlock;
+    int64_t eleNum = rows * dimPad;
+    int64_t cost = eleNum * (typeSize * 4 + FLOAT_BYTES) + headBlock * dimPad * (FLOAT_BYTES + typeSize);
+    if (quant) {
+        int64_t rowsAlign = CeilAlign(rows, REDUCE_ALIGN);
+        cost += eleNum * FLOAT_BYTES + rowsAlign * FLOAT_BYTES * 6 + CeilAlign(rows, BRCB_ALIGN) * BYTE_BLOCK * 3;
+    }
+    return cost;
+}
+
+static int64_t ParseLayout(const char* layout)
+{
+    if (layout == nullptr || std::strcmp(layout, "BNSD") == 0) {
+        return LAYOUT_BNSD;
+    }
+    if (std::strcmp(layout, "TND") == 0) {
+        return LAYOUT_TND;
+    }
+    return -1;
+}
+
+struct BlockInfo {
+    int64_t tokenBlock = 0;
+    int64_t headBlock = 0;
+    int64_t dimBlock = 0;
+    int64_t dimPad = 0;
+};
+
+// 优先整行(全部头)驻留UB并一次处理多个token，其次整头，head_dim过大时才在头内切分
+static bool SelectBlocks(
+    int64_t token, int64_t numHeads, int64_t dimPerHead, int64_t typeSize, bool quant, int64_t tokenLimit,
+    int64_t ubBudget, BlockInfo& info)
+{
+    int64_t dimPad = CeilAlign(dimPerHead, DIM_ALIGN);
+    if (dimPad <= MAX_DIM_PAD) {
+        info.dimBlock = dimPerHead;
+        info.dimPad = dimPad;
+        int64_t tokenBlock = 0;
+        if (numHeads <= MAX_ROWS) {
+            tokenBlock = std::min({token, MAX_ROWS / numHeads, tokenLimit});
+            while (tokenBlock > 0 && CalcUbCost(tokenBlock, numHeads, dimPad, typeSize, quant) > ubBudget) {
+                tokenBlock--;
+            }
+        }
+        if (tokenBlock > 0) {
+            info.tokenBlock = tokenBlock;
+            info.headBlock = numHeads;
+            return true;
+        }
+        int64_t headBlock = std::min(numHeads, MAX_ROWS);
+        while (headBlock > 0 && CalcUbCost(1, headBlock, dimPad, typeSize, quant) > ubBudget) {
+            headBlock--;
+        }
+        info.tokenBlock = 1;
+        info.headBlock = headBlock;
+        return headBlock > 0;
+    }
+    // 量化需要整头求amax，不支持头内切分
+    if (quant) {
+        return false;
+    }
+    info.tokenBlock = 1;
+    info.headBlock = 1;
+    info.dimBlock = MAX_DIM_PAD;
+    info.dimPad = MAX_DIM_PAD;
+    return CalcUbCost(1, 1, MAX_DIM_PAD, typeSize, quant) <= ubBudget;
+}
+
+static void PrintTilingData(gert::TilingContext* context, TransformBiasRescaleQkvV2TilingData& tilingData)
+{
+    const ge::char_t* nodeName = context->GetNodeName();
+    OP_LOGD(
+        nodeName, "batch: %ld, token: %ld, numHeads: %ld, dimPerHead: %ld", tilingData.get_batch(),
+        tilingData.get_token(), tilingData.get_numHeads(), tilingData.get_dimPerHead());
+    OP_LOGD(nodeName, "layout: %ld, kvQuantMode: %ld", tilingData.get_layout(), tilingData.get_kvQuantMode());
+    OP_LOGD(
+        nodeName, "tokenBlock: %ld, headBlock: %ld, dimBlock: %ld, dimPad: %ld", tilingData.get_tokenBlock(),
+        tilingData.get_headBlock(), tilingData.get_dimBlock(), tilingData.get_dimPad());
+    OP_LOGD(
+        nodeName, "unitsPerCore: %ld, tailUnits: %ld, usedCoreNum: %ld", tilingData.get_unitsPerCore(),
+        tilingData.get_tailUnits(), tilingData.get_usedCoreNum());
+}
+
+static ge::graphStatus Tiling4TransformBiasRescaleQkvV2(gert::TilingContext* context)
+{
+    OP_LOGD(context->GetNodeName(), "TransformBiasRescaleQkvV2 tiling starts running");
+    auto compileInfo = reinterpret_cast<const TransformBiasRescaleQkvV2CompileInfo*>(context->GetCompileInfo());
+    OP_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    OP_CHECK_IF(
+        compileInfo->vectorCoreNum <= 0 || compileInfo->ubByteSize <= RESERVED_UB,
+        OP_LOGE(context->GetNodeName(), "Failed to get core num or ub size."), return ge::GRAPH_FAILED);
+
+    auto qkvDesc = context->GetInputDesc(QKV_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, qkvDesc);
+    ge::DataType dtype = qkvDesc->GetDataType();
+    OP_CHECK_IF(
+        dtype != ge::DT_FLOAT && dtype != ge::DT_FLOAT16 && dtype != ge::DT_BF16,
+        OP_LOGE(context->GetNodeName(), "qkv dtype is not supported."), return ge::GRAPH_FAILED);
+    auto kDesc = context->GetOutputDesc(K_OUTPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, kDesc);
+
+    const gert::RuntimeAttrs* attrs = context->GetAttrs();
+    OP_CHECK_NULL_WITH_CONTEXT(context, attrs);
+    const int64_t* numHeadsPtr = attrs->GetAttrPointer<int64_t>(NUM_HEADS_ATTR_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, numHeadsPtr);
+    int64_t numHeads = *numHeadsPtr;
+    int64_t layout = ParseLayout(attrs->GetAttrPointer<char>(LAYOUT_ATTR_INDEX));
+    OP_CHECK_IF(
+        layout < 0, OP_LOGE(context->GetNodeName(), "layout should be BNSD or TND."), return ge::GRAPH_FAILED);
+    const int64_t* quantModePtr = attrs->GetAttrPointer<int64_t>(KV_QUANT_MODE_ATTR_INDEX);
+    int64_t kvQuantMode = quantModePtr == nullptr ? KV_QUANT_NONE : *quantModePtr;
+    OP_CHECK_IF(
+        kvQuantMode != KV_QUANT_NONE && kvQuantMode != KV_QUANT_INT8,
+        OP_LOGE(context->GetNodeName(), "kv_quant_mode should be 0 or 1."), return ge::GRAPH_FAILED);
+    ge::DataType kvDtype = kvQuantMode == KV_QUANT_INT8 ? ge::DT_INT8 : dtype;
+    OP_CHECK_IF(
+        kDesc->GetDataType() != kvDtype,
+        OP_LOGE(context->GetNodeName(), "k/v dtype does not match kv_quant_mode."), return ge::GRAPH_FAILED);
+
+    auto qkvShape = context->GetInputShape(QKV_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, qkvShape);
+    const gert::Shape& shape = qkvShape->GetStorageShape();
+    OP_CHECK_IF(
+        shape.GetDimNum() != QKV_DIM_NUM, OP_LOGE(context->GetNodeName(), "qkv should be 3D."),
+        return ge::GRAPH_FAILED);
+    int64_t batch = shape.GetDim(0);
+    int64_t token = shape.GetDim(1);
+    int64_t tripleDim = shape.GetDim(2);
+    OP_CHECK_IF(
+        numHeads <= 0 || tripleDim <= 0 || tripleDim % (NUM_THREE * numHeads) != 0,
+        OP_LOGE(context->GetNodeName(), "qkv last dim should be a positive multiple of 3 * num_heads."),
+        return ge::GRAPH_FAILED);
+    auto biasShape = context->GetInputShape(QKV_BIAS_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, biasShape);
+    OP_CHECK_IF(
+        biasShape->GetStorageShape().GetDimNum() != 1 || biasShape->GetStorageShape().GetDim(0) != tripleDim,
+        OP_LOGE(context->GetNodeName(), "qkv_bias should be 1D with the same length as qkv last dim."),
+        return ge::GRAPH_FAILED);
+    int64_t dimPerHead = tripleDim / NUM_THREE / numHeads;
+
+    // token块不超过按核平均分到的token数，避免小shape下单元数少于核数
+    int64_t coreNum = static_cast<int64_t>(compileInfo->vectorCoreNum);
+    int64_t tokenLimit = std::max<int64_t>(CeilDiv(NUM_THREE * batch * token, coreNum), 1);
+    BlockInfo blockInfo;
+    bool quant = kvQuantMode == KV_QUANT_INT8;
+    OP_CHECK_IF(
+        !SelectBlocks(
+            token, numHeads, dimPerHead, ge::GetSizeByDataType(dtype), quant, tokenLimit,
+            static_cast<int64_t>(compileInfo->ubByteSize) - RESERVED_UB, blockInfo),
+        OP_LOGE(context->GetNodeName(), "head dim is too large for current kv_quant_mode or ub size."),
+        return ge::GRAPH_FAILED);
+
+    TransformBiasRescaleQkvV2TilingData tilingData;
+    int64_t tokenBlocks = CeilDiv(token, blockInfo.tokenBlock);
+    int64_t headBlocks = CeilDiv(numHeads, blockInfo.headBlock);
+    int64_t dimBlocks = CeilDiv(dimPerHead, blockInfo.dimBlock);
+    int64_t totalUnits = NUM_THREE * headBlocks * dimBlocks * batch * tokenBlocks;
+    int64_t usedCoreNum = std::max<int64_t>(std::min(totalUnits, coreNum), 1);
+    tilingData.set_batch(batch);
+    tilingData.set_token(token);
+    tilingData.set_numHeads(numHeads);
+    tilingData.set_dimPerHead(dimPerHead);
+    tilingData.set_layout(layout);
+    tilingData.set_kvQuantMode(kvQuantMode);
+    tilingData.set_tokenBlock(blockInfo.tokenBlock);
+    tilingData.set_headBlock(blockInfo.headBlock);
+    tilingData.set_dimBlock(blockInfo.dimBlock);
+    tilingData.set_dimPad(blockInfo.dimPad);
+    tilingData.set_tokenBlocks(tokenBlocks);
+    tilingData.set_headBlocks(headBlocks);
+    tilingData.set_dimBlocks(dimBlocks);
+    tilingData.set_unitsPerCore(totalUnits / usedCoreNum);
+    tilingData.set_tailUnits(totalUnits % usedCoreNum);
+    tilingData.set_usedCoreNum(usedCoreNum);
+
+    size_t* workspaces = context->GetWorkspaceSizes(1);
+    workspaces[0] = compileInfo->sysWorkspaceByteSize;
+    context->SetTilingKey(TILING_KEY_DEFAULT);
+    context->SetBlockDim(static_cast<uint32_t>(usedCoreNum));
+    tilingData.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tilingData.GetDataSize());
+    PrintTilingData(context, tilingData);
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus TilingPrepare4TransformBiasRescaleQkvV2(gert::TilingParseContext* context)
+{
+    auto compileInfo = context->GetCompiledInfo<TransformBiasRescaleQkvV2CompileInfo>();
+    OP_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    auto platformInfo = context->GetPlatformInfo();
+    OP_CHECK_NULL_WITH_CONTEXT(context, platformInfo);
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(platformInfo);
+    compileInfo->vectorCoreNum = ascendcPlatform.GetCoreNumAiv();
+    OP_CHECK_IF(
+        (compileInfo->vectorCoreNum <= 0), OP_LOGE(context->GetNodeName(), "No vector core available."),
+        return ge::GRAPH_FAILED);
+    uint64_t ubByteSize;
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ubByteSize);
+    compileInfo->ubByteSize = ubByteSize;
+    OP_CHECK_IF(
+        (compileInfo->ubByteSize <= 0), OP_LOGE(context->GetNodeName(), "Failed to get ub size."),
+        return ge::GRAPH_FAILED);
+    compileInfo->sysWorkspaceByteSize = ascendcPlatform.GetLibApiWorkSpaceSize();
+    return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_OPTILING(TransformBiasRescaleQkvV2)
+    .Tiling(Tiling4TransformBiasRescaleQkvV2)
+    .TilingParse<TransformBiasRescaleQkvV2CompileInfo>(TilingPrepare4TransformBiasRescaleQkvV2);
+} // namespace optiling
@@ -0,0 +1,50 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file transform_bias_rescale_qkv_v2_tiling.h
+ * \brief transform_bias_rescale_qkv_v2_tiling_def
+ */
+#ifndef TRANSFORM_BIAS_RESCALE_QKV_V2_TILING_DEF_H
+#define TRANSFORM_BIAS_RESCALE_QKV_V2_TILING_DEF_H
+
+#include "register/tilingdata_base.h"
+
+namespace optiling {
+struct TransformBiasRescaleQkvV2CompileInfo {
+    uint32_t vectorCoreNum;
+    uint32_t sysWorkspaceByteSize;
+    uint32_t ubByteSize;
+};
+
+BEGIN_TILING_DATA_DEF(TransformBiasRescaleQkvV2TilingData)
+TILING_DATA_FIELD_DEF(int64_t, batch);
+TILING_DATA_FIELD_DEF(int64_t, token);
+TILING_DATA_FIELD_DEF(int64_t, numHeads);
+TILING_DATA_FIELD_DEF(int64_t, dimPerHead);
+TILING_DATA_FIELD_DEF(int64_t, layout);       // 0:BNSD 1:TND
+TILING_DATA_FIELD_DEF(int64_t, kvQuantMode);  // 0:不量化 1:int8 per-token-per-head动态量化
+TILING_DATA_FIELD_DEF(int64_t, tokenBlock);   // 每次搬入的token数
+TILING_DATA_FIELD_DEF(int64_t, headBlock);    // 每次搬入的头数
+TILING_DATA_FIELD_DEF(int64_t, dimBlock);     // 每次搬入的头内元素数，等于dimPerHead时整头驻留UB
+TILING_DATA_FIELD_DEF(int64_t, dimPad);       // dimBlock按32个元素对齐后在UB内的行长
+TILING_DATA_FIELD_DEF(int64_t, tokenBlocks);
+TILING_DATA_FIELD_DEF(int64_t, headBlocks);
+TILING_DATA_FIELD_DEF(int64_t, dimBlocks);
+TILING_DATA_FIELD_DEF(int64_t, unitsPerCore); // 每核处理的(q/k/v, 头块, 维度块, batch, token块)单元数
+TILING_DATA_FIELD_DEF(int64_t, tailUnits);    // 前tailUnits个核多处理一个单元
+TILING_DATA_FIELD_DEF(int64_t, usedCoreNum);
+END_TILING_DATA_DEF;
+
+REGISTER_TILING_DATA_CLASS(TransformBiasRescaleQkvV2, TransformBiasRescaleQkvV2TilingData)
+} // namespace optiling
+
+#endif
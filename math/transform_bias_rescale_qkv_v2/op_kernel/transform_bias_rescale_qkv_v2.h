@@ -0,0 +1,456 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file transform_bias_rescale_qkv_v2.h
+ * \brief transform_bias_rescale_qkv_v2 head file
+ */
+#ifndef TRANSFORM_BIAS_RESCALE_QKV_V2_H
+#define TRANSFORM_BIAS_RESCALE_QKV_V2_H
+
+#include <type_traits>
+#include <cmath>
+#include "kernel_operator.h"
+
+namespace TransformBiasRescaleQkvV2 {
+
+using namespace AscendC;
+
+constexpr int32_t BUFFER_NUM = 2;
+constexpr int64_t NUM_THREE = 3;
+constexpr int64_t LAYOUT_TND = 1;
+constexpr int64_t BYTE_BLOCK = 32;
+constexpr int64_t FLOAT_PER_BLOCK = 8;
+constexpr int64_t FLOAT_PER_REPEAT = 64;
+constexpr int64_t REDUCE_ALIGN = 64;
+constexpr int64_t ROW_BUF_NUM = 4;
+constexpr float INT8_MAX_VALUE = 127.0f;
+constexpr float AMAX_EPS = 1e-12f;
+
+template <typename T, typename KV_T>
+class TransformBiasRescaleQkvV2ND {
+public:
+    __aicore__ inline TransformBiasRescaleQkvV2ND(){};
+    __aicore__ inline void Init(
+        GM_ADDR qkv, GM_ADDR qkvBias, GM_ADDR q, GM_ADDR k, GM_ADDR v, GM_ADDR kScale, GM_ADDR vScale,
+        const TransformBiasRescaleQkvV2TilingData* tilingData, TPipe* pipeIn);
+    __aicore__ inline void Process();
+
+private:
+    static constexpr bool QUANT_KV = std::is_same_v<KV_T, int8_t>;
+
+    __aicore__ inline void ParseUnit(int64_t unitIdx);
+    __aicore__ inline void LoadBias();
+    __aicore__ inline void CopyIn();
+    __aicore__ inline void Compute();
+    __aicore__ inline void CopyOut();
+    __aicore__ inline void AddBias(const LocalTensor<float>& dst, const LocalTensor<float>& src);
+    __aicore__ inline void QuantRows(const LocalTensor<float>& work, const LocalTensor<int8_t>& outLocal);
+    template <typename U>
+    __aicore__ inline void CopyOutData(const GlobalTensor<U>& dstGm, const LocalTensor<U>& outLocal);
+    __aicore__ inline void CopyOutScale(const GlobalTensor<float>& dstGm);
+
+    template <HardEvent EVENT>
+    __aicore__ inline void SyncFlag()
+    {
+        event_t eventId = static_cast<event_t>(GetTPipePtr()->FetchEventID(EVENT));
+        SetFlag<EVENT>(eventId);
+        WaitFlag<EVENT>(eventId);
+    }
+
+    // UB内非对齐行的搬运：blockLen为有效字节数，行间隔按32B块计
+    __aicore__ inline uint32_t RowGap(int64_t rowBytes, int64_t validBytes)
+    {
+        return static_cast<uint32_t>((rowBytes - (validBytes + BYTE_BLOCK - 1) / BYTE_BLOCK * BYTE_BLOCK) / BYTE_BLOCK);
+    }
+
+private:
+    TPipe* pipe = nullptr;
+    TQue<QuePosition::VECIN, BUFFER_NUM> inQue;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> outQue;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> scaleQue;
+    TBuf<QuePosition::VECCALC> workBuf;
+    TBuf<QuePosition::VECCALC> biasBuf;
+    TBuf<QuePosition::VECCALC> biasRawBuf;
+    TBuf<QuePosition::VECCALC> absBuf;
+    TBuf<QuePosition::VECCALC> reduceBuf;
+    TBuf<QuePosition::VECCALC> rowBuf;
+    TBuf<QuePosition::VECCALC> brcbBuf;
+
+    GlobalTensor<T> qkvGm;
+    GlobalTensor<T> qkvBiasGm;
+    GlobalTensor<T> qGm;
+    GlobalTensor<KV_T> kGm;
+    GlobalTensor<KV_T> vGm;
+    GlobalTensor<float> kScaleGm;
+    GlobalTensor<float> vScaleGm;
+
+    int64_t batch = 0;
+    int64_t token = 0;
+    int64_t numHeads = 0;
+    int64_t dimPerHead = 0;
+    int64_t layout = 0;
+    int64_t tokenBlock = 0;
+    int64_t headBlock = 0;
+    int64_t dimBlock = 0;
+    int64_t dimPad = 0;
+    int64_t tokenBlocks = 0;
+    int64_t headBlocks = 0;
+    int64_t dimBlocks = 0;
+    int64_t unitStart = 0;
+    int64_t unitNum = 0;
+    int64_t rowsAlign = 0;
+    float scale = 1.0f;
+
+    // 当前单元：q/k/v、batch以及token/头/头内维度的起点与长度
+    int64_t which = 0;
+    int64_t bIdx = 0;
+    int64_t t0 = 0;
+    int64_t tLen = 0;
+    int64_t h0 = 0;
+    int64_t hLen = 0;
+    int64_t d0 = 0;
+    int64_t dLen = 0;
+};
+
+template <typename T, typename KV_T>
+__aicore__ inline void TransformBiasRescaleQkvV2ND<T, KV_T>::Init(
+    GM_ADDR qkv, GM_ADDR qkvBias, GM_ADDR q, GM_ADDR k, GM_ADDR v, GM_ADDR kScale, GM_ADDR vScale,
+    const TransformBiasRescaleQkvV2TilingData* tilingData, TPipe* pipeIn)
+{
+    pipe = pipeIn;
+    qkvGm.SetGlobalBuffer((__gm__ T*)qkv);
+    qkvBiasGm.SetGlobalBuffer((__gm__ T*)qkvBias);
+    qGm.SetGlobalBuffer((__gm__ T*)q);
+    kGm.SetGlobalBuffer((__gm__ KV_T*)k);
+    vGm.SetGlobalBuffer((__gm__ KV_T*)v);
+    kScaleGm.SetGlobalBuffer((__gm__ float*)kScale);
+    vScaleGm.SetGlobalBuffer((__gm__ float*)vScale);
+
+    batch = tilingData->batch;
+    token = tilingData->token;
+    numHeads = tilingData->numHeads;
+    dimPerHead = tilingData->dimPerHead;
+    layout = tilingData->layout;
+    tokenBlock = tilingData->tokenBlock;
+    headBlock = tilingData->headBlock;
+    dimBlock = tilingData->dimBlock;
+    dimPad = tilingData->dimPad;
+    tokenBlocks = tilingData->tokenBlocks;
+    headBlocks = tilingData->headBlocks;
+    dimBlocks = tilingData->dimBlocks;
+
+    int64_t blockIdx = GetBlockIdx();
+    int64_t tailUnits = tilingData->tailUnits;
+    unitNum = tilingData->unitsPerCore + (blockIdx < tailUnits ? 1 : 0);
+    unitStart = blockIdx * tilingData->unitsPerCore + (blockIdx < tailUnits ? blockIdx : tailUnits);
+    if (blockIdx >= tilingData->usedCoreNum) {
+        unitNum = 0;
+    }
+    scale = static_cast<float>(1.0) / sqrt(static_cast<float>(dimPerHead));
+
+    int64_t rows = tokenBlock * headBlock;
+    int64_t eleNum = rows * dimPad;
+    pipe->InitBuffer(inQue, BUFFER_NUM, eleNum * sizeof(T));
+    pipe->InitBuffer(outQue, BUFFER_NUM, eleNum * sizeof(T));
+    pipe->InitBuffer(workBuf, eleNum * sizeof(float));
+    pipe->InitBuffer(biasBuf, headBlock * dimPad * sizeof(float));
+    if constexpr (!std::is_same_v<T, float>) {
+        pipe->InitBuffer(biasRawBuf, headBlock * dimPad * sizeof(T));
+    }
+    if constexpr (QUANT_KV) {
+        rowsAlign = (rows + REDUCE_ALIGN - 1) / REDUCE_ALIGN * REDUCE_ALIGN;
+        int64_t brcbBytes = (rows + FLOAT_PER_BLOCK - 1) / FLOAT_PER_BLOCK * FLOAT_PER_BLOCK * BYTE_BLOCK;
+        pipe->InitBuffer(absBuf, eleNum * sizeof(float));
+        // WholeReduceMax输出(值, 索引)对
+        pipe->InitBuffer(reduceBuf, 2 * rowsAlign * sizeof(float));
+        // amax、倒数、scale与常量127
+        pipe->InitBuffer(rowBuf, ROW_BUF_NUM * rowsAlign * sizeof(float));
+        pipe->InitBuffer(brcbBuf, brcbBytes);
+        pipe->InitBuffer(scaleQue, BUFFER_NUM, brcbBytes);
+        LocalTensor<float> rowLocal = rowBuf.Get<float>();
+        Duplicate(rowLocal[(ROW_BUF_NUM - 1) * rowsAlign], INT8_MAX_VALUE, static_cast<int32_t>(rowsAlign));
+    }
+}
+
+template <typename T, typename KV_T>
+__aicore__ inline void TransformBiasRescaleQkvV2ND<T, KV_T>::Process()
+{
+    // 单元按(q/k/v, 头块, 维度块, batch, token块)展开，token块在最内层，同一核上相邻单元共用bias
+    int64_t unitsPerBias = batch * tokenBlocks;
+    int64_t biasKey = -1;
+    for (int64_t unitIdx = unitStart; unitIdx < unitStart + unitNum; unitIdx++) {
+        ParseUnit(unitIdx);
+        if (unitIdx / unitsPerBias != biasKey) {
+            biasKey = unitIdx / unitsPerBias;
+            LoadBias();
+        }
+        CopyIn();
+        Compute();
+        CopyOut();
+    }
+}
+
+template <typename T, typename KV_T>
+__aicore__ inline void TransformBiasRescaleQkvV2ND<T, KV_T>::ParseUnit(int64_t unitIdx)
+{
+    int64_t rest = unitIdx;
+    int64_t tIdx = rest % tokenBlocks;
+    rest /= tokenBlocks;
+    bIdx = rest % batch;
+    rest /= batch;
+    int64_t dIdx = rest % dimBlocks;
+    rest /= dimBlocks;
+    int64_t hIdx = rest % headBlocks;
+    which = rest / headBlocks;
+
+    t0 = tIdx * tokenBlock;
+    tLen = token - t0 < tokenBlock ? token - t0 : tokenBlock;
+    h0 = hIdx * headBlock;
+    hLen = numHeads - h0 < headBlock ? numHeads - h0 : headBlock;
+    d0 = dIdx * dimBlock;
+    dLen = dimPerHead - d0 < dimBlock ? dimPerHead - d0 : dimBlock;
+}
+
+template <typename T, typename KV_T>
+__aicore__ inline void TransformBiasRescaleQkvV2ND<T, KV_T>::LoadBias()
+{
+    // 上一轮的Cast/Add仍可能在读bias
+    SyncFlag<HardEvent::V_MTE2>();
+    LocalTensor<float> biasLocal = biasBuf.Get<float>();
+    int64_t offset = (which * numHeads + h0) * dimPerHead + d0;
+    DataCopyExtParams copyParams{
+        static_cast<uint16_t>(hLen), static_cast<uint32_t>(dLen * sizeof(T)),
+        static_cast<uint32_t>((dimPerHead - dLen) * sizeof(T)), RowGap(dimPad * sizeof(T), dLen * sizeof(T)), 0};
+    DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+    if constexpr (std::is_same_v<T, float>) {
+        DataCopyPad(biasLocal, qkvBiasGm[offset], copyParams, padParams);
+        SyncFlag<HardEvent::MTE2_V>();
+    } else {
+        LocalTensor<T> biasRaw = biasRawBuf.Get<T>();
+        DataCopyPad(biasRaw, qkvBiasGm[offset], copyParams, padParams);
+        SyncFlag<HardEvent::MTE2_V>();
+        Cast(biasLocal, biasRaw, RoundMode::CAST_NONE, hLen * dimPad);
+        PipeBarrier<PIPE_V>();
+    }
+}
+
+template <typename T, typename KV_T>
+__aicore__ inline void TransformBiasRescaleQkvV2ND<T, KV_T>::CopyIn()
+{
+    LocalTensor<T> inLocal = inQue.AllocTensor<T>();
+    DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+    int64_t lineStride = NUM_THREE * numHeads * dimPerHead;
+    int64_t base = ((bIdx * token + t0) * NUM_THREE + which) * numHeads * dimPerHead + h0 * dimPerHead + d0;
+    if (dLen == dimPerHead && dimPad == dimPerHead) {
+        // 整头且行长已对齐：每个token的hLen个头在GM与UB内都连续
+        DataCopyExtParams copyParams{
+            static_cast<uint16_t>(tLen), static_cast<uint32_t>(hLen * dimPerHead * sizeof(T)),
+            static_cast<uint32_t>((lineStride - hLen * dimPerHead) * sizeof(T)), 0, 0};
+        DataCopyPad(inLocal, qkvGm[base], copyParams, padParams);
+    } else if (tLen <= hLen) {
+        DataCopyExtParams copyParams{
+            static_cast<uint16_t>(hLen), static_cast<uint32_t>(dLen * sizeof(T)),
+            static_cast<uint32_t>((dimPerHead - dLen) * sizeof(T)), RowGap(dimPad * sizeof(T), dLen * sizeof(T)), 0};
+        for (int64_t t = 0; t < tLen; t++) {
+            DataCopyPad(inLocal[t * hLen * dimPad], qkvGm[base + t * lineStride], copyParams, padParams);
+        }
+    } else {
+        DataCopyExtParams copyParams{
+            static_cast<uint16_t>(tLen), static_cast<uint32_t>(dLen * sizeof(T)),
+            static_cast<uint32_t>((lineStride - dLen) * sizeof(T)),
+            RowGap(hLen * dimPad * sizeof(T), dLen * sizeof(T)), 0};
+        for (int64_t h = 0; h < hLen; h++) {
+            DataCopyPad(inLocal[h * dimPad], qkvGm[base + h * dimPerHead], copyParams, padParams);
+        }
+    }
+    inQue.EnQue(inLocal);
+}
+
+template <typename T, typename KV_T>
+__aicore__ inline void TransformBiasRescaleQkvV2ND<T, KV_T>::AddBias(
+    const LocalTensor<float>& dst, const LocalTensor<float>& src)
+{
+    LocalTensor<float> biasLocal = biasBuf.Get<float>();
+    int64_t lineNum = hLen * dimPad;
+    for (int64_t t = 0; t < tLen; t++) {
+        Add(dst[t * lineNum], src[t * lineNum], biasLocal, static_cast<int32_t>(lineNum));
+    }
+    PipeBarrier<PIPE_V>();
+}
+
+template <typename T, typename KV_T>
+__aicore__ inline void TransformBiasRescaleQkvV2ND<T, KV_T>::Compute()
+{
+    LocalTensor<T> inLocal = inQue.DeQue<T>();
+    LocalTensor<T> outLocal = outQue.AllocTensor<T>();
+    int32_t count = static_cast<int32_t>(tLen * hLen * dimPad);
+    bool quantUnit = QUANT_KV && which != 0;
+    LocalTensor<float> work = workBuf.Get<float>();
+    if constexpr (std::is_same_v<T, float>) {
+        // fp32不量化时直接在输出buffer上计算
+        if (!quantUnit) {
+            work = outLocal;
+        }
+        AddBias(work, inLocal);
+    } else {
+        Cast(work, inLocal, RoundMode::CAST_NONE, count);
+        PipeBarrier<PIPE_V>();
+        AddBias(work, work);
+    }
+    inQue.FreeTensor(inLocal);
+    if (which == 0) {
+        Muls(work, work, scale, count);
+        PipeBarrier<PIPE_V>();
+    }
+    if constexpr (QUANT_KV) {
+        if (quantUnit) {
+            QuantRows(work, outLocal.template ReinterpretCast<int8_t>());
+            outQue.EnQue(outLocal);
+            return;
+        }
+    }
+    if constexpr (std::is_same_v<T, half>) {
+        Cast(outLocal, work, RoundMode::CAST_NONE, count);
+    } else if constexpr (std::is_same_v<T, bfloat16_t>) {
+        Cast(outLocal, work, RoundMode::CAST_RINT, count);
+    }
+    outQue.EnQue(outLocal);
+}
+
+template <typename T, typename KV_T>
+__aicore__ inline void TransformBiasRescaleQkvV2ND<T, KV_T>::QuantRows(
+    const LocalTensor<float>& work, const LocalTensor<int8_t>& outLocal)
+{
+    int32_t rows = static_cast<int32_t>(tLen * hLen);
+    int32_t count = rows * static_cast<int32_t>(dimPad);
+    uint8_t rowStride = static_cast<uint8_t>(dimPad / FLOAT_PER_BLOCK);
+    int32_t brcbRepeat = (rows + FLOAT_PER_BLOCK - 1) / FLOAT_PER_BLOCK;
+    LocalTensor<float> absLocal = absBuf.Get<float>();
+    LocalTensor<float> reduceLocal = reduceBuf.Get<float>();
+    LocalTensor<float> amaxLocal = rowBuf.Get<float>();
+    LocalTensor<float> recipLocal = amaxLocal[rowsAlign];
+    LocalTensor<float> scaleRowLocal = amaxLocal[2 * rowsAlign];
+    LocalTensor<float> maxValueLocal = amaxLocal[3 * rowsAlign];
+    LocalTensor<float> brcbLocal = brcbBuf.Get<float>();
+
+    // 每行(token, head)先按64列折叠求|x|最大值，再WholeReduceMax得到amax
+    Abs(absLocal, work, count);
+    PipeBarrier<PIPE_V>();
+    for (int64_t col = FLOAT_PER_REPEAT; col < dLen; col += FLOAT_PER_REPEAT) {
+        uint64_t mask = dLen - col < FLOAT_PER_REPEAT ? dLen - col : FLOAT_PER_REPEAT;
+        Max(absLocal, absLocal, absLocal[col], mask, static_cast<uint8_t>(rows),
+            {1, 1, 1, rowStride, rowStride, rowStride});
+        PipeBarrier<PIPE_V>();
+    }
+    int32_t reduceMask = dLen < FLOAT_PER_REPEAT ? static_cast<int32_t>(dLen) : FLOAT_PER_REPEAT;
+    WholeReduceMax<float>(reduceLocal, absLocal, reduceMask, rows, 1, 1, rowStride);
+    PipeBarrier<PIPE_V>();
+    uint64_t rsvdCnt = 0;
+    uint16_t gatherRepeat = static_cast<uint16_t>((2 * rows + FLOAT_PER_REPEAT - 1) / FLOAT_PER_REPEAT);
+    GatherMask(amaxLocal, reduceLocal, 1, false, 0, {1, gatherRepeat, 8, 0}, rsvdCnt);
+    PipeBarrier<PIPE_V>();
+
+    // scale = amax / 127，量化乘以 127 / max(amax, eps)
+    Muls(scaleRowLocal, amaxLocal, 1.0f / INT8_MAX_VALUE, rows);
+    Maxs(amaxLocal, amaxLocal, AMAX_EPS, rows);
+    PipeBarrier<PIPE_V>();
+    Div(recipLocal, maxValueLocal, amaxLocal, rows);
+    PipeBarrier<PIPE_V>();
+    Brcb(brcbLocal, recipLocal, static_cast<uint8_t>(brcbRepeat), {1, 8});
+    PipeBarrier<PIPE_V>();
+    for (int64_t col = 0; col < dLen; col += FLOAT_PER_REPEAT) {
+        uint64_t mask = dLen - col < FLOAT_PER_REPEAT ? dLen - col : FLOAT_PER_REPEAT;
+        Mul(work[col], work[col], brcbLocal, mask, static_cast<uint8_t>(rows), {1, 1, 0, rowStride, rowStride, 1});
+    }
+    PipeBarrier<PIPE_V>();
+    // fp32先round-to-odd到fp16再RINT到int8，|x|<=127时fp16仍余4位小数，两次舍入结果与直接RINT一致
+    LocalTensor<half> halfLocal = absLocal.template ReinterpretCast<half>();
+    Cast(halfLocal, work, RoundMode::CAST_ODD, count);
+    PipeBarrier<PIPE_V>();
+    Cast(outLocal, halfLocal, RoundMode::CAST_RINT, count);
+
+    LocalTensor<float> scaleLocal = scaleQue.AllocTensor<float>();
+    Brcb(scaleLocal, scaleRowLocal, static_cast<uint8_t>(brcbRepeat), {1, 8});
+    scaleQue.EnQue(scaleLocal);
+}
+
+template <typename T, typename KV_T>
+template <typename U>
+__aicore__ inline void TransformBiasRescaleQkvV2ND<T, KV_T>::CopyOutData(
+    const GlobalTensor<U>& dstGm, const LocalTensor<U>& outLocal)
+{
+    int64_t rowBytes = dimPad * sizeof(U);
+    int64_t validBytes = dLen * sizeof(U);
+    uint32_t gmGap = static_cast<uint32_t>((dimPerHead - dLen) * sizeof(U));
+    if (layout == LAYOUT_TND) {
+        int64_t base = ((bIdx * token + t0) * numHeads + h0) * dimPerHead + d0;
+        if (hLen == numHeads && dLen == dimPerHead && dimPad == dimPerHead) {
+            DataCopyExtParams copyParams{1, static_cast<uint32_t>(tLen * numHeads * validBytes), 0, 0, 0};
+            DataCopyPad(dstGm[base], outLocal, copyParams);
+            return;
+        }
+        DataCopyExtParams copyParams{
+            static_cast<uint16_t>(hLen), static_cast<uint32_t>(validBytes), RowGap(rowBytes, validBytes), gmGap, 0};
+        for (int64_t t = 0; t < tLen; t++) {
+            DataCopyPad(dstGm[base + t * numHeads * dimPerHead], outLocal[t * hLen * dimPad], copyParams);
+        }
+    } else {
+        // BNSD：每个头的tLen行在GM内连续，在UB内间隔hLen行
+        DataCopyExtParams copyParams{
+            static_cast<uint16_t>(tLen), static_cast<uint32_t>(validBytes), RowGap(hLen * rowBytes, validBytes),
+            gmGap, 0};
+        for (int64_t h = 0; h < hLen; h++) {
+            int64_t base = ((bIdx * numHeads + h0 + h) * token + t0) * dimPerHead + d0;
+            DataCopyPad(dstGm[base], outLocal[h * dimPad], copyParams);
+        }
+    }
+}
+
+template <typename T, typename KV_T>
+__aicore__ inline void TransformBiasRescaleQkvV2ND<T, KV_T>::CopyOutScale(const GlobalTensor<float>& dstGm)
+{
+    // Brcb后每行scale独占一个32B块，按4B搬出即可完成[t][h]到目标布局的转置
+    LocalTensor<float> scaleLocal = scaleQue.DeQue<float>();
+    if (layout == LAYOUT_TND) {
+        DataCopyExtParams copyParams{static_cast<uint16_t>(hLen), sizeof(float), 0, 0, 0};
+        for (int64_t t = 0; t < tLen; t++) {
+            DataCopyPad(
+                dstGm[(bIdx * token + t0 + t) * numHeads + h0], scaleLocal[t * hLen * FLOAT_PER_BLOCK], copyParams);
+        }
+    } else {
+        DataCopyExtParams copyParams{
+            static_cast<uint16_t>(tLen), sizeof(float), static_cast<uint32_t>(hLen - 1), 0, 0};
+        for (int64_t h = 0; h < hLen; h++) {
+            DataCopyPad(
+                dstGm[(bIdx * numHeads + h0 + h) * token + t0], scaleLocal[h * FLOAT_PER_BLOCK], copyParams);
+        }
+    }
+    scaleQue.FreeTensor(scaleLocal);
+}
+
+template <typename T, typename KV_T>
+__aicore__ inline void TransformBiasRescaleQkvV2ND<T, KV_T>::CopyOut()
+{
+    LocalTensor<T> outLocal = outQue.DeQue<T>();
+    if (which == 0) {
+        CopyOutData(qGm, outLocal);
+    } else if constexpr (QUANT_KV) {
+        CopyOutData(which == 1 ? kGm : vGm, outLocal.template ReinterpretCast<KV_T>());
+        CopyOutScale(which == 1 ? kScaleGm : vScaleGm);
+    } else {
+        CopyOutData(which == 1 ? kGm : vGm, outLocal);
+    }
+    outQue.FreeTensor(outLocal);
+}
+} // namespace TransformBiasRescaleQkvV2
+
+#endif // TRANSFORM_BIAS_RESCALE_QKV_V2_H
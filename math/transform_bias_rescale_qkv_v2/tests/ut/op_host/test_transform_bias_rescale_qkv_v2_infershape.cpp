@@ -0,0 +1,115 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file test_transform_bias_rescale_qkv_v2_infershape.cpp
+ * \brief
+ */
+
+#include <iostream>
+#include <gtest/gtest.h>
+#include "infershape_context_faker.h"
+#include "base/registry/op_impl_space_registry_v2.h"
+
+class TransformBiasRescaleQkvV2 : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        std::cout << "TransformBiasRescaleQkvV2 SetUp" << std::endl;
+    }
+
+    static void TearDownTestCase()
+    {
+        std::cout << "TransformBiasRescaleQkvV2 TearDown" << std::endl;
+    }
+};
+
+static std::vector<int64_t> ToVector(const gert::Shape& shape)
+{
+    size_t shapeSize = shape.GetDimNum();
+    std::vector<int64_t> shapeVec(shapeSize, 0);
+    for (size_t i = 0; i < shapeSize; i++) {
+        shapeVec[i] = shape.GetDim(i);
+    }
+    return shapeVec;
+}
+
+static void ExeTestCase(
+    const gert::StorageShape& qkvShape, int64_t numHeads, const std::string& layout, int64_t kvQuantMode,
+    gert::StorageShape& outShape, gert::StorageShape& scaleShape, ge::graphStatus testCaseResult = ge::GRAPH_SUCCESS)
+{
+    int64_t tripleDim = qkvShape.GetOriginShape().GetDim(2);
+    gert::StorageShape biasShape = {{tripleDim}, {tripleDim}};
+    gert::StorageShape kShape = {};
+    gert::StorageShape vShape = {};
+    gert::StorageShape vScaleShape = {};
+    ge::DataType kvDtype = kvQuantMode == 1 ? ge::DT_INT8 : ge::DT_FLOAT16;
+
+    /* make infershape context */
+    std::vector<gert::Tensor*> inputTensors = {(gert::Tensor*)&qkvShape, (gert::Tensor*)&biasShape};
+    std::vector<gert::StorageShape*> outputShapes = {&outShape, &kShape, &vShape, &scaleShape, &vScaleShape};
+    auto contextHolder = gert::InferShapeContextFaker()
+                             .SetOpType("TransformBiasRescaleQkvV2")
+                             .NodeIoNum(2, 5)
+                             .NodeInputTd(0, ge::DT_FLOAT16, ge::FORMAT_ND, ge::FORMAT_ND)
+                             .NodeInputTd(1, ge::DT_FLOAT16, ge::FORMAT_ND, ge::FORMAT_ND)
+                             .NodeOutputTd(0, ge::DT_FLOAT16, ge::FORMAT_ND, ge::FORMAT_ND)
+                             .NodeOutputTd(1, kvDtype, ge::FORMAT_ND, ge::FORMAT_ND)
+                             .NodeOutputTd(2, kvDtype, ge::FORMAT_ND, ge::FORMAT_ND)
+                             .NodeOutputTd(3, ge::DT_FLOAT, ge::FORMAT_ND, ge::FORMAT_ND)
+                             .NodeOutputTd(4, ge::DT_FLOAT, ge::FORMAT_ND, ge::FORMAT_ND)
+                             .InputTensors(inputTensors)
+                             .OutputShapes(outputShapes)
+                             .Attr("num_heads", numHeads)
+                             .Attr("layout", layout)
+                             .Attr("kv_quant_mode", kvQuantMode)
+                             .Build();
+
+    /* get infershape func */
+    auto spaceRegistry = gert::DefaultOpImplSpaceRegistryV2::GetInstance().GetSpaceRegistry();
+    auto inferShapeFunc = spaceRegistry->GetOpImpl("TransformBiasRescaleQkvV2")->infer_shape;
+    ASSERT_NE(inferShapeFunc, nullptr);
+
+    /* do infershape */
+    EXPECT_EQ(inferShapeFunc(contextHolder.GetContext()), testCaseResult);
+}
+
+TEST_F(TransformBiasRescaleQkvV2, TransformBiasRescaleQkvV2_infershape_bnsd)
+{
+    gert::StorageShape qkvShape = {{3, 4, 144}, {3, 4, 144}};
+    gert::StorageShape outShape = {};
+    gert::StorageShape scaleShape = {};
+    ExeTestCase(qkvShape, 3, "BNSD", 0, outShape, scaleShape);
+    std::vector<int64_t> expectOut = {3, 3, 4, 16};
+    std::vector<int64_t> expectScale = {0};
+    EXPECT_EQ(ToVector(outShape.GetOriginShape()), expectOut);
+    EXPECT_EQ(ToVector(scaleShape.GetOriginShape()), expectScale);
+}
+
+TEST_F(TransformBiasRescaleQkvV2, TransformBiasRescaleQkvV2_infershape_tnd_quant)
+{
+    gert::StorageShape qkvShape = {{3, 4, 144}, {3, 4, 144}};
+    gert::StorageShape outShape = {};
+    gert::StorageShape scaleShape = {};
+    ExeTestCase(qkvShape, 3, "TND", 1, outShape, scaleShape);
+    std::vector<int64_t> expectOut = {12, 3, 16};
+    std::vector<int64_t> expectScale = {12, 3};
+    EXPECT_EQ(ToVector(outShape.GetOriginShape()), expectOut);
+    EXPECT_EQ(ToVector(scaleShape.GetOriginShape()), expectScale);
+}
+
+TEST_F(TransformBiasRescaleQkvV2, TransformBiasRescaleQkvV2_infershape_invalid_layout)
+{
+    gert::StorageShape qkvShape = {{3, 4, 144}, {3, 4, 144}};
+    gert::StorageShape outShape = {};
+    gert::StorageShape scaleShape = {};
+    ExeTestCase(qkvShape, 3, "SBH", 0, outShape, scaleShape, ge::GRAPH_FAILED);
+}
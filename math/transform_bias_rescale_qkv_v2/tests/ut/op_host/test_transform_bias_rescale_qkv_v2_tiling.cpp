@@ -0,0 +1,116 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file test_transform_bias_rescale_qkv_v2_tiling.cpp
+ * \brief
+ */
+
+#include <iostream>
+#include <gtest/gtest.h>
+#include "../../../op_host/transform_bias_rescale_qkv_v2_tiling.h"
+#include "tiling_context_faker.h"
+#include "tiling_case_executor.h"
+
+class TransformBiasRescaleQkvV2Tiling : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        std::cout << "TransformBiasRescaleQkvV2Tiling SetUp" << std::endl;
+    }
+    static void TearDownTestCase()
+    {
+        std::cout << "TransformBiasRescaleQkvV2Tiling TearDown" << std::endl;
+    }
+};
+
+static gert::TilingContextPara MakeTilingPara(
+    int64_t batch, int64_t token, int64_t numHeads, int64_t dimPerHead, ge::DataType dtype, const std::string& layout,
+    int64_t kvQuantMode, optiling::TransformBiasRescaleQkvV2CompileInfo& compileInfo)
+{
+    int64_t tripleDim = 3 * numHeads * dimPerHead;
+    gert::StorageShape outShape = {{batch, numHeads, token, dimPerHead}, {batch, numHeads, token, dimPerHead}};
+    gert::StorageShape scaleShape = {{batch, numHeads, token}, {batch, numHeads, token}};
+    if (layout == "TND") {
+        outShape = {{batch * token, numHeads, dimPerHead}, {batch * token, numHeads, dimPerHead}};
+        scaleShape = {{batch * token, numHeads}, {batch * token, numHeads}};
+    }
+    if (kvQuantMode == 0) {
+        scaleShape = {{0}, {0}};
+    }
+    ge::DataType kvDtype = kvQuantMode == 1 ? ge::DT_INT8 : dtype;
+    return gert::TilingContextPara(
+        "TransformBiasRescaleQkvV2",
+        {{{{batch, token, tripleDim}, {batch, token, tripleDim}}, dtype, ge::FORMAT_ND},
+         {{{tripleDim}, {tripleDim}}, dtype, ge::FORMAT_ND}},
+        {{outShape, dtype, ge::FORMAT_ND},
+         {outShape, kvDtype, ge::FORMAT_ND},
+         {outShape, kvDtype, ge::FORMAT_ND},
+         {scaleShape, ge::DT_FLOAT, ge::FORMAT_ND},
+         {scaleShape, ge::DT_FLOAT, ge::FORMAT_ND}},
+        {gert::TilingContextPara::OpAttr("num_heads", Ops::Math::AnyValue::CreateFrom<int64_t>(numHeads)),
+         gert::TilingContextPara::OpAttr("layout", Ops::Math::AnyValue::CreateFrom<std::string>(layout)),
+         gert::TilingContextPara::OpAttr("kv_quant_mode", Ops::Math::AnyValue::CreateFrom<int64_t>(kvQuantMode))},
+        &compileInfo);
+}
+
+TEST_F(TransformBiasRescaleQkvV2Tiling, tiling_bnsd_float16_full_lines)
+{
+    // 整行驻留UB，token块受按核平均分到的token数限制
+    optiling::TransformBiasRescaleQkvV2CompileInfo compileInfo = {48, 16777216, 196608};
+    auto para = MakeTilingPara(2, 16, 4, 64, ge::DT_FLOAT16, "BNSD", 0, compileInfo);
+    std::string expectTilingData = "2 16 4 64 0 0 2 4 64 64 8 1 1 1 0 48 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(para, ge::GRAPH_SUCCESS, 1, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(TransformBiasRescaleQkvV2Tiling, tiling_tnd_bfloat16_int8_quant)
+{
+    optiling::TransformBiasRescaleQkvV2CompileInfo compileInfo = {48, 16777216, 196608};
+    auto para = MakeTilingPara(2, 128, 8, 128, ge::DT_BF16, "TND", 1, compileInfo);
+    std::string expectTilingData = "2 128 8 128 1 1 10 8 128 128 13 1 1 1 30 48 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(para, ge::GRAPH_SUCCESS, 1, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(TransformBiasRescaleQkvV2Tiling, tiling_bnsd_float_int8_quant_part_heads)
+{
+    // 一个token的全部头放不下时退化为每次一个token、部分头
+    optiling::TransformBiasRescaleQkvV2CompileInfo compileInfo = {48, 16777216, 196608};
+    auto para = MakeTilingPara(1, 2, 64, 96, ge::DT_FLOAT, "BNSD", 1, compileInfo);
+    std::string expectTilingData = "1 2 64 96 0 1 1 61 96 96 2 2 1 1 0 12 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(para, ge::GRAPH_SUCCESS, 1, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(TransformBiasRescaleQkvV2Tiling, tiling_bnsd_float_split_head)
+{
+    optiling::TransformBiasRescaleQkvV2CompileInfo compileInfo = {48, 16777216, 196608};
+    auto para = MakeTilingPara(1, 4, 2, 4096, ge::DT_FLOAT, "BNSD", 0, compileInfo);
+    std::string expectTilingData = "1 4 2 4096 0 0 1 1 2016 2016 4 2 3 1 24 48 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(para, ge::GRAPH_SUCCESS, 1, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(TransformBiasRescaleQkvV2Tiling, tiling_quant_split_head_failed)
+{
+    // 量化需要整头求amax，head_dim超出整头上限时报错
+    optiling::TransformBiasRescaleQkvV2CompileInfo compileInfo = {48, 16777216, 196608};
+    auto para = MakeTilingPara(1, 4, 2, 4096, ge::DT_FLOAT16, "BNSD", 1, compileInfo);
+    ExecuteTestCase(para, ge::GRAPH_FAILED);
+}
+
+TEST_F(TransformBiasRescaleQkvV2Tiling, tiling_invalid_layout_failed)
+{
+    optiling::TransformBiasRescaleQkvV2CompileInfo compileInfo = {48, 16777216, 196608};
+    auto para = MakeTilingPara(1, 4, 2, 64, ge::DT_FLOAT16, "BSND", 0, compileInfo);
+    ExecuteTestCase(para, ge::GRAPH_FAILED);
+}
@@ -0,0 +1,187 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file test_transform_bias_rescale_qkv_v2.cpp
+ * \brief
+ */
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "gtest/gtest.h"
+#include "tikicpulib.h"
+#include "../../../op_host/transform_bias_rescale_qkv_v2_tiling.h"
+#include "data_utils.h"
+
+using namespace std;
+
+extern "C" __global__ __aicore__ void transform_bias_rescale_qkv_v2(
+    GM_ADDR qkv, GM_ADDR qkv_bias, GM_ADDR q, GM_ADDR k, GM_ADDR v, GM_ADDR k_scale, GM_ADDR v_scale,
+    GM_ADDR workspace, GM_ADDR tiling);
+
+class transform_bias_rescale_qkv_v2_test : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        cout << "transform_bias_rescale_qkv_v2_test SetUp\n" << endl;
+    }
+    static void TearDownTestCase()
+    {
+        cout << "transform_bias_rescale_qkv_v2_test TearDown\n" << endl;
+    }
+};
+
+static constexpr size_t WORKSPACE_SIZE = 16 * 1024 * 1024;
+
+struct QkvCase {
+    int64_t batch;
+    int64_t token;
+    int64_t numHeads;
+    int64_t dimPerHead;
+    int64_t layout;
+    int64_t tokenBlock;
+    int64_t headBlock;
+    uint32_t blockDim;
+};
+
+// 输出按目标布局的偏移：BNSD为[B, N, T, D]，TND为[B * T, N, D]
+static size_t OutIndex(const QkvCase& c, int64_t b, int64_t t, int64_t h, int64_t d)
+{
+    if (c.layout == 1) {
+        return static_cast<size_t>(((b * c.token + t) * c.numHeads + h) * c.dimPerHead + d);
+    }
+    return static_cast<size_t>(((b * c.numHeads + h) * c.token + t) * c.dimPerHead + d);
+}
+
+static size_t ScaleIndex(const QkvCase& c, int64_t b, int64_t t, int64_t h)
+{
+    if (c.layout == 1) {
+        return static_cast<size_t>((b * c.token + t) * c.numHeads + h);
+    }
+    return static_cast<size_t>((b * c.numHeads + h) * c.token + t);
+}
+
+static void RunInt8QuantCase(const QkvCase& c)
+{
+    int64_t tripleDim = 3 * c.numHeads * c.dimPerHead;
+    size_t qkvNum = c.batch * c.token * tripleDim;
+    size_t outNum = c.batch * c.token * c.numHeads * c.dimPerHead;
+    size_t scaleNum = c.batch * c.token * c.numHeads;
+    uint8_t* qkv = (uint8_t*)AscendC::GmAlloc(qkvNum * sizeof(half));
+    uint8_t* bias = (uint8_t*)AscendC::GmAlloc(tripleDim * sizeof(half));
+    uint8_t* q = (uint8_t*)AscendC::GmAlloc(outNum * sizeof(half));
+    uint8_t* k = (uint8_t*)AscendC::GmAlloc(outNum);
+    uint8_t* v = (uint8_t*)AscendC::GmAlloc(outNum);
+    uint8_t* kScale = (uint8_t*)AscendC::GmAlloc(scaleNum * sizeof(float));
+    uint8_t* vScale = (uint8_t*)AscendC::GmAlloc(scaleNum * sizeof(float));
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(WORKSPACE_SIZE);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(sizeof(TransformBiasRescaleQkvV2TilingData));
+
+    half* qkvData = reinterpret_cast<half*>(qkv);
+    half* biasData = reinterpret_cast<half*>(bias);
+    for (size_t i = 0; i < qkvNum; i++) {
+        qkvData[i] = static_cast<half>(static_cast<float>((i * 37) % 97) * 0.05f - 2.4f);
+    }
+    for (int64_t i = 0; i < tripleDim; i++) {
+        biasData[i] = static_cast<half>(static_cast<float>((i * 13) % 17) * 0.1f - 0.8f);
+    }
+
+    int64_t tokenBlocks = (c.token + c.tokenBlock - 1) / c.tokenBlock;
+    int64_t headBlocks = (c.numHeads + c.headBlock - 1) / c.headBlock;
+    int64_t totalUnits = 3 * headBlocks * c.batch * tokenBlocks;
+    TransformBiasRescaleQkvV2TilingData* tilingData = reinterpret_cast<TransformBiasRescaleQkvV2TilingData*>(tiling);
+    tilingData->batch = c.batch;
+    tilingData->token = c.token;
+    tilingData->numHeads = c.numHeads;
+    tilingData->dimPerHead = c.dimPerHead;
+    tilingData->layout = c.layout;
+    tilingData->kvQuantMode = 1;
+    tilingData->tokenBlock = c.tokenBlock;
+    tilingData->headBlock = c.headBlock;
+    tilingData->dimBlock = c.dimPerHead;
+    tilingData->dimPad = (c.dimPerHead + 31) / 32 * 32;
+    tilingData->tokenBlocks = tokenBlocks;
+    tilingData->headBlocks = headBlocks;
+    tilingData->dimBlocks = 1;
+    tilingData->unitsPerCore = totalUnits / c.blockDim;
+    tilingData->tailUnits = totalUnits % c.blockDim;
+    tilingData->usedCoreNum = c.blockDim;
+
+    ICPU_SET_TILING_KEY(1);
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_RUN_KF(
+        transform_bias_rescale_qkv_v2, c.blockDim, qkv, bias, q, k, v, kScale, vScale, workspace,
+        (uint8_t*)(tilingData));
+
+    half* qData = reinterpret_cast<half*>(q);
+    int8_t* kvData[2] = {reinterpret_cast<int8_t*>(k), reinterpret_cast<int8_t*>(v)};
+    float* scaleData[2] = {reinterpret_cast<float*>(kScale), reinterpret_cast<float*>(vScale)};
+    float rescale = 1.0f / sqrt(static_cast<float>(c.dimPerHead));
+    int64_t dim = c.numHeads * c.dimPerHead;
+    for (int64_t b = 0; b < c.batch; b++) {
+        for (int64_t t = 0; t < c.token; t++) {
+            const half* line = qkvData + (b * c.token + t) * tripleDim;
+            for (int64_t h = 0; h < c.numHeads; h++) {
+                for (int64_t d = 0; d < c.dimPerHead; d++) {
+                    int64_t col = h * c.dimPerHead + d;
+                    float expect = (static_cast<float>(line[col]) + static_cast<float>(biasData[col])) * rescale;
+                    EXPECT_NEAR(static_cast<float>(qData[OutIndex(c, b, t, h, d)]), expect, 2e-3f);
+                }
+                for (int64_t which = 1; which < 3; which++) {
+                    vector<float> row(c.dimPerHead);
+                    float amax = 0.0f;
+                    for (int64_t d = 0; d < c.dimPerHead; d++) {
+                        int64_t col = which * dim + h * c.dimPerHead + d;
+                        row[d] = static_cast<float>(line[col]) + static_cast<float>(biasData[col]);
+                        amax = max(amax, fabs(row[d]));
+                    }
+                    EXPECT_NEAR(scaleData[which - 1][ScaleIndex(c, b, t, h)], amax / 127.0f, 1e-6f);
+                    for (int64_t d = 0; d < c.dimPerHead; d++) {
+                        float expect = nearbyint(row[d] * (127.0f / max(amax, 1e-12f)));
+                        EXPECT_NEAR(static_cast<float>(kvData[which - 1][OutIndex(c, b, t, h, d)]), expect, 1.0f);
+                    }
+                }
+            }
+        }
+    }
+
+    AscendC::GmFree(qkv);
+    AscendC::GmFree(bias);
+    AscendC::GmFree(q);
+    AscendC::GmFree(k);
+    AscendC::GmFree(v);
+    AscendC::GmFree(kScale);
+    AscendC::GmFree(vScale);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+}
+
+TEST_F(transform_bias_rescale_qkv_v2_test, test_float16_bnsd_int8_unaligned_head)
+{
+    // head_dim为40，UB内按64对齐；token块为2，最后一个token块不满
+    RunInt8QuantCase({2, 3, 2, 40, 0, 2, 2, 2});
+}
+
+TEST_F(transform_bias_rescale_qkv_v2_test, test_float16_tnd_int8_part_heads)
+{
+    // 每次一个头、4个token，TND下按token逐行搬出
+    RunInt8QuantCase({1, 4, 2, 64, 1, 4, 1, 3});
+}
+
+TEST_F(transform_bias_rescale_qkv_v2_test, test_float16_tnd_int8_full_lines)
+{
+    // 整行且行长对齐，搬入搬出都合并为连续块
+    RunInt8QuantCase({2, 5, 4, 96, 1, 3, 4, 4});
+}
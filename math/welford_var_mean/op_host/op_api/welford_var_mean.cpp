@@ -0,0 +1,127 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file welford_var_mean.cpp
+ * \brief
+ */
+
+#include "welford_var_mean.h"
+#include "opdev/data_type_utils.h"
+#include "opdev/format_utils.h"
+#include "opdev/make_op_executor.h"
+#include "opdev/op_def.h"
+#include "opdev/op_dfx.h"
+#include "opdev/op_executor.h"
+#include "opdev/op_log.h"
+#include "opdev/platform.h"
+#include "opdev/shape_utils.h"
+
+using namespace op;
+
+namespace l0op {
+OP_TYPE_REGISTER(WelfordVarMean);
+
+static const std::initializer_list<op::DataType> AICORE_DTYPE_SUPPORT_LIST = {
+    DataType::DT_FLOAT, DataType::DT_FLOAT16, DataType::DT_BF16};
+
+// 与tiling一致：外层保留维与规约维合并后各自最多4段
+static constexpr size_t MAX_OUTER_SEGMENT = 4;
+static constexpr size_t MAX_DIM_NUM = 8;
+
+static void GetReduceFlags(const aclIntArray* dim, bool* isReduce, size_t dimNum)
+{
+    for (size_t i = 0; i < dimNum; i++) {
+        isReduce[i] = false;
+    }
+    for (size_t i = 0; i < dim->Size(); i++) {
+        int64_t dimIndex = (*dim)[i] >= 0 ? (*dim)[i] : (*dim)[i] + static_cast<int64_t>(dimNum);
+        if (dimIndex >= 0 && dimIndex < static_cast<int64_t>(dimNum)) {
+            isReduce[dimIndex] = true;
+        }
+    }
+}
+
+bool IsWelfordVarMeanSupport(const aclTensor* self, const aclIntArray* dim)
+{
+    SocVersion socVersion = GetCurrentPlatformInfo().GetSocVersion();
+    if (socVersion != SocVersion::ASCEND910B && socVersion != SocVersion::ASCEND910_93) {
+        return false;
+    }
+    if (!CheckType(self->GetDataType(), AICORE_DTYPE_SUPPORT_LIST) || dim == nullptr) {
+        return false;
+    }
+    op::Shape selfShape = self->GetViewShape();
+    size_t dimNum = selfShape.GetDimNum();
+    if (dimNum > MAX_DIM_NUM) {
+        return false;
+    }
+    bool isReduce[MAX_DIM_NUM];
+    GetReduceFlags(dim, isReduce, dimNum);
+    // 跳过长度为1的维度，统计相邻同类维度合并后的段
+    bool segReduce[MAX_DIM_NUM];
+    size_t segNum = 0;
+    for (size_t i = 0; i < dimNum; i++) {
+        if (selfShape.GetDim(i) == 1) {
+            continue;
+        }
+        if (segNum == 0 || segReduce[segNum - 1] != isReduce[i]) {
+            segReduce[segNum++] = isReduce[i];
+        }
+    }
+    // 最内段（为保留维时连同其前一个规约段）由kernel直接处理，其余段放入外层
+    size_t innerSeg = (segNum > 0 && !segReduce[segNum - 1] && segNum > 1) ? 2 : 1;
+    size_t aSeg = 0;
+    size_t rSeg = 0;
+    for (size_t i = 0; i + innerSeg < segNum; i++) {
+        if (segReduce[i]) {
+            rSeg++;
+        } else {
+            aSeg++;
+        }
+    }
+    return aSeg <= MAX_OUTER_SEGMENT && rSeg <= MAX_OUTER_SEGMENT;
+}
+
+const std::tuple<const aclTensor*, const aclTensor*> WelfordVarMean(
+    const aclTensor* self, const aclIntArray* dim, int64_t correction, bool keepdim, bool isStd,
+    aclOpExecutor* executor)
+{
+    L0_DFX(WelfordVarMean, self, dim, correction, keepdim, isStd);
+
+    op::Shape selfShape = self->GetViewShape();
+    size_t dimNum = selfShape.GetDimNum();
+    CHECK_RET(dimNum <= MAX_DIM_NUM, std::tuple(nullptr, nullptr));
+    bool isReduce[MAX_DIM_NUM];
+    GetReduceFlags(dim, isReduce, dimNum);
+    op::Shape outShape;
+    for (size_t i = 0; i < dimNum; i++) {
+        if (!isReduce[i]) {
+            outShape.AppendDim(selfShape.GetDim(i));
+        } else if (keepdim) {
+            outShape.AppendDim(1);
+        }
+    }
+
+    aclTensor* varOut = executor->AllocTensor(outShape, self->GetDataType(), Format::FORMAT_ND);
+    CHECK_RET(varOut != nullptr, std::tuple(nullptr, nullptr));
+    aclTensor* meanOut = executor->AllocTensor(outShape, self->GetDataType(), Format::FORMAT_ND);
+    CHECK_RET(meanOut != nullptr, std::tuple(nullptr, nullptr));
+
+    auto ret = ADD_TO_LAUNCHER_LIST_AICORE(
+        WelfordVarMean, OP_INPUT(self), OP_OUTPUT(varOut, meanOut), OP_ATTR(dim, correction, keepdim, isStd));
+    if (ret != ACLNN_SUCCESS) {
+        OP_LOGE(ACLNN_ERR_INNER_NULLPTR, "WelfordVarMean ADD_TO_LAUNCHER_LIST_AICORE failed.");
+        return std::tuple(nullptr, nullptr);
+    }
+    return std::tuple(varOut, meanOut);
+}
+} // namespace l0op
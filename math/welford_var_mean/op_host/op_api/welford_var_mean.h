@@ -0,0 +1,31 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file welford_var_mean.h
+ * \brief
+ */
+
+#ifndef OP_API_INC_LEVEL0_WELFORD_VAR_MEAN_H
+#define OP_API_INC_LEVEL0_WELFORD_VAR_MEAN_H
+#include "opdev/op_executor.h"
+
+namespace l0op {
+// 芯片、dtype以及合并后的规约轴组合是否可走单遍Welford kernel
+bool IsWelfordVarMeanSupport(const aclTensor* self, const aclIntArray* dim);
+
+// 单遍计算方差（isStd为true时为标准差）与均值，输出dtype与self一致
+const std::tuple<const aclTensor*, const aclTensor*> WelfordVarMean(
+    const aclTensor* self, const aclIntArray* dim, int64_t correction, bool keepdim, bool isStd,
+    aclOpExecutor* executor);
+} // namespace l0op
+
+#endif // OP_API_INC_LEVEL0_WELFORD_VAR_MEAN_H
@@ -0,0 +1,409 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file welford_var_mean_tiling.cpp
+ * \brief
+ */
+#include <algorithm>
+#include <vector>
+#include "welford_var_mean_tiling.h"
+#include "log/log.h"
+#include "register/op_def_registry.h"
+#include "tiling_base/tiling_templates_registry.h"
+#include "platform/platform_info.h"
+
+namespace optiling {
+constexpr int32_t X_INPUT_INDEX = 0;
+constexpr size_t DIM_ATTR_INDEX = 0;
+constexpr size_t CORRECTION_ATTR_INDEX = 1;
+constexpr size_t IS_STD_ATTR_INDEX = 3;
+constexpr size_t MAX_DIM_NUM = 8;
+constexpr uint32_t BYTE_BLOCK = 32;
+constexpr uint32_t FLOAT_BYTES = 4;
+constexpr uint32_t BUFFER_NUM = 2;
+constexpr uint32_t RESERVED_UB = 1024;
+constexpr uint32_t LANE_FLOAT_BUF_NUM = 5;   // meanAcc/m2Acc/tileMean/tileM2/delta
+constexpr uint32_t LANE_OUT_BUF_NUM = 2;     // var/mean输出
+constexpr uint32_t FLOAT_PER_BLOCK = 8;
+constexpr uint32_t MAX_RA_COL_FACTOR = 1024;
+constexpr uint32_t MIN_RA_COL_FACTOR = 128;
+constexpr uint32_t MAX_ROW_FACTOR = 4095;    // DataCopyPad blockCount上限
+constexpr uint32_t MAX_GROUP_ROW_LEN = 64;   // 一个repeat内可完成整行规约的fp32元素数
+constexpr uint32_t MAX_GROUP_LANES = 248;    // WholeReduceSum repeat上限255，按8对齐
+constexpr uint32_t MAX_SEQ_LANES = 64;
+
+constexpr uint32_t MODE_RA = 0;       // 规约轴外还有保留维：按列向量化，逐行合并
+constexpr uint32_t MODE_AR_GROUP = 1; // 规约轴在最内且较短：一次搬入多个输出的整行
+constexpr uint32_t MODE_AR_SEQ = 2;   // 规约轴在最内且较长：逐输出分段规约
+
+constexpr uint64_t FLOAT_TILING_KEY = 1;
+constexpr uint64_t FLOAT16_TILING_KEY = 2;
+constexpr uint64_t BFLOAT16_TILING_KEY = 3;
+
+struct MergedDim {
+    int64_t len;
+    int64_t stride;
+    bool isReduce;
+};
+
+struct WelfordVarMeanParams {
+    ge::DataType dtype;
+    int64_t correction;
+    bool isStd;
+    std::vector<MergedDim> dims;
+};
+
+static inline uint64_t CeilDiv(uint64_t a, uint64_t b)
+{
+    return b == 0 ? a : (a + b - 1) / b;
+}
+
+static inline uint64_t CeilAlign(uint64_t a, uint64_t b)
+{
+    return CeilDiv(a, b) * b;
+}
+
+static ge::graphStatus GetInputInfo(gert::TilingContext* context, WelfordVarMeanParams& params)
+{
+    auto xShape = context->GetInputShape(X_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, xShape);
+    const gert::Shape& shape = xShape->GetStorageShape();
+    size_t dimNum = shape.GetDimNum();
+    OP_CHECK_IF(
+        dimNum > MAX_DIM_NUM, OP_LOGE(context->GetNodeName(), "x should be 0~%zu dims.", MAX_DIM_NUM),
+        return ge::GRAPH_FAILED);
+
+    const gert::RuntimeAttrs* attrs = context->GetAttrs();
+    OP_CHECK_NULL_WITH_CONTEXT(context, attrs);
+    bool reduceFlag[MAX_DIM_NUM] = {false};
+    const gert::TypedContinuousVector<int64_t>* dimList = attrs->GetListInt(DIM_ATTR_INDEX);
+    if (dimList == nullptr || dimList->GetSize() == 0) {
+        std::fill(reduceFlag, reduceFlag + MAX_DIM_NUM, true);
+    } else {
+        int64_t rank = static_cast<int64_t>(std::max<size_t>(dimNum, 1));
+        for (size_t i = 0; i < dimList->GetSize(); i++) {
+            int64_t axis = dimList->GetData()[i];
+            OP_CHECK_IF(
+                axis < -rank || axis >= rank,
+                OP_LOGE(context->GetNodeName(), "dim %ld should be in range [%ld, %ld).", axis, -rank, rank),
+                return ge::GRAPH_FAILED);
+            axis = axis < 0 ? axis + rank : axis;
+            OP_CHECK_IF(
+                reduceFlag[axis], OP_LOGE(context->GetNodeName(), "dim %ld appears multiple times.", axis),
+                return ge::GRAPH_FAILED);
+            reduceFlag[axis] = true;
+        }
+    }
+    const int64_t* correctionPtr = attrs->GetAttrPointer<int64_t>(CORRECTION_ATTR_INDEX);
+    params.correction = correctionPtr == nullptr ? 1 : *correctionPtr;
+    const bool* isStdPtr = attrs->GetAttrPointer<bool>(IS_STD_ATTR_INDEX);
+    params.isStd = isStdPtr == nullptr ? false : *isStdPtr;
+
+    // 去掉长度为1的维度后合并相邻同类维度，stride按连续排布计算
+    std::vector<MergedDim> dims;
+    int64_t stride = 1;
+    for (int64_t i = static_cast<int64_t>(dimNum) - 1; i >= 0; i--) {
+        int64_t len = shape.GetDim(i);
+        OP_CHECK_IF(
+            len <= 0, OP_LOGE(context->GetNodeName(), "x should not be empty, dim %ld is %ld.", i, len),
+            return ge::GRAPH_FAILED);
+        if (len != 1) {
+            if (!dims.empty() && dims.back().isReduce == reduceFlag[i]) {
+                dims.back().len *= len;
+            } else {
+                dims.push_back({len, stride, reduceFlag[i]});
+            }
+        }
+        stride *= len;
+    }
+    if (dims.empty()) {
+        dims.push_back({1, 1, true});
+    }
+    std::reverse(dims.begin(), dims.end());
+    params.dims = dims;
+    return ge::GRAPH_SUCCESS;
+}
+
+// 最内一到两维由rInner/innerNum描述，其余维度按保留/规约分别记录shape与stride
+static ge::graphStatus SplitLayout(
+    gert::TilingContext* context, const WelfordVarMeanParams& params, WelfordVarMeanTilingData& tilingData,
+    uint64_t& aOuterNum)
+{
+    const std::vector<MergedDim>& dims = params.dims;
+    size_t outerEnd = dims.size() - 1;
+    uint64_t rInner = 1;
+    uint64_t innerNum = 1;
+    uint32_t mode = MODE_RA;
+    if (dims.back().isReduce) {
+        rInner = static_cast<uint64_t>(dims.back().len);
+        mode = MODE_AR_SEQ;
+    } else {
+        innerNum = static_cast<uint64_t>(dims.back().len);
+        if (outerEnd > 0 && dims[outerEnd - 1].isReduce) {
+            outerEnd--;
+            rInner = static_cast<uint64_t>(dims[outerEnd].len);
+        }
+    }
+    int64_t aShape[WELFORD_MAX_OUTER_DIM] = {0};
+    int64_t aStride[WELFORD_MAX_OUTER_DIM] = {0};
+    int64_t rShape[WELFORD_MAX_OUTER_DIM] = {0};
+    int64_t rStride[WELFORD_MAX_OUTER_DIM] = {0};
+    uint32_t aDimNum = 0;
+    uint32_t rDimNum = 0;
+    uint64_t rOuterNum = 1;
+    aOuterNum = 1;
+    for (size_t i = 0; i < outerEnd; i++) {
+        uint32_t& num = dims[i].isReduce ? rDimNum : aDimNum;
+        OP_CHECK_IF(
+            num >= WELFORD_MAX_OUTER_DIM,
+            OP_LOGE(context->GetNodeName(), "too many discontinuous reduce dims."), return ge::GRAPH_FAILED);
+        if (dims[i].isReduce) {
+            rShape[num] = dims[i].len;
+            rStride[num] = dims[i].stride;
+            rOuterNum *= static_cast<uint64_t>(dims[i].len);
+        } else {
+            aShape[num] = dims[i].len;
+            aStride[num] = dims[i].stride;
+            aOuterNum *= static_cast<uint64_t>(dims[i].len);
+        }
+        num++;
+    }
+    tilingData.set_rOuterNum(rOuterNum);
+    tilingData.set_rInner(rInner);
+    tilingData.set_innerNum(innerNum);
+    tilingData.set_aShape(aShape);
+    tilingData.set_aStride(aStride);
+    tilingData.set_rShape(rShape);
+    tilingData.set_rStride(rStride);
+    tilingData.set_aDimNum(aDimNum);
+    tilingData.set_rDimNum(rDimNum);
+    tilingData.set_mode(mode);
+    return ge::GRAPH_SUCCESS;
+}
+
+static uint64_t CalcLaneBytes(uint64_t lanes, uint32_t typeSize, uint32_t mode)
+{
+    uint64_t laneAlloc = CeilAlign(lanes, FLOAT_PER_BLOCK);
+    uint64_t bytes = laneAlloc * (LANE_FLOAT_BUF_NUM * FLOAT_BYTES + LANE_OUT_BUF_NUM * typeSize);
+    if (mode == MODE_AR_GROUP) {
+        // Brcb把每个行均值扩成一个block
+        bytes += laneAlloc * FLOAT_PER_BLOCK * FLOAT_BYTES;
+    }
+    return bytes;
+}
+
+static uint32_t CalcRaRowFactor(uint64_t colFactor, uint64_t ubAvail, uint64_t perElem, uint32_t typeSize,
+                                uint64_t rInner)
+{
+    uint64_t laneBytes = CalcLaneBytes(colFactor, typeSize, MODE_RA);
+    if (ubAvail <= laneBytes) {
+        return 0;
+    }
+    uint64_t rowFactor = (ubAvail - laneBytes) / perElem / colFactor;
+    return static_cast<uint32_t>(std::min<uint64_t>({rowFactor, MAX_ROW_FACTOR, rInner}));
+}
+
+static void CalcTilingData(
+    const WelfordVarMeanParams& params, uint64_t aOuterNum, uint32_t coreNum, uint32_t ubSize,
+    WelfordVarMeanTilingData& tilingData)
+{
+    uint32_t typeSize = ge::GetSizeByDataType(params.dtype);
+    uint32_t alignNum = BYTE_BLOCK / typeSize;
+    // 输入double buffer，fp32计算buffer（fp16/bf16在其中完成转换），以及一份fp32临时buffer
+    uint64_t perElem = BUFFER_NUM * typeSize + FLOAT_BYTES + FLOAT_BYTES;
+    uint64_t ubAvail = ubSize - RESERVED_UB;
+    uint32_t mode = tilingData.get_mode();
+    uint64_t rInner = tilingData.get_rInner();
+    uint64_t innerNum = tilingData.get_innerNum();
+    uint64_t reduceLen = tilingData.get_rOuterNum() * rInner;
+    uint32_t aDimNum = tilingData.get_aDimNum();
+
+    uint64_t colFactor = 0;
+    uint64_t rowFactor = 0;
+    uint64_t lineLen = 0;
+    uint64_t lineNum = 0;
+    uint64_t blocksPerLine = 0;
+    if (mode == MODE_RA) {
+        lineLen = innerNum;
+        lineNum = aOuterNum;
+        colFactor = std::min<uint64_t>(CeilAlign(innerNum, alignNum), MAX_RA_COL_FACTOR);
+        blocksPerLine = CeilDiv(innerNum, colFactor);
+        if (lineNum * blocksPerLine < coreNum && innerNum > MIN_RA_COL_FACTOR) {
+            // 输出不足核数时沿列方向再切，让每个核都分到数据
+            uint64_t splitFactor = CeilAlign(CeilDiv(innerNum, CeilDiv(coreNum, lineNum)), alignNum);
+            colFactor = std::min(colFactor, std::max<uint64_t>(MIN_RA_COL_FACTOR, splitFactor));
+            blocksPerLine = CeilDiv(innerNum, colFactor);
+        }
+        rowFactor = CalcRaRowFactor(colFactor, ubAvail, perElem, typeSize, rInner);
+    } else {
+        // AR：单元为最内外层保留维上连续的若干输出
+        lineLen = aDimNum > 0 ? static_cast<uint64_t>(tilingData.get_aShape()[aDimNum - 1]) : 1;
+        lineNum = aOuterNum / lineLen;
+        uint64_t rowLen = CeilAlign(rInner, alignNum);
+        if (rowLen <= MAX_GROUP_ROW_LEN) {
+            mode = MODE_AR_GROUP;
+            colFactor = rowLen;
+            uint64_t perLane = rowLen * perElem + CalcLaneBytes(1, typeSize, MODE_AR_GROUP);
+            rowFactor = std::min<uint64_t>(ubAvail / perLane / FLOAT_PER_BLOCK * FLOAT_PER_BLOCK, MAX_GROUP_LANES);
+        } else {
+            rowFactor = MAX_SEQ_LANES;
+        }
+        rowFactor = std::min<uint64_t>(rowFactor, CeilAlign(lineLen, FLOAT_PER_BLOCK));
+        while (lineNum * CeilDiv(lineLen, rowFactor) < coreNum && rowFactor > FLOAT_PER_BLOCK) {
+            rowFactor = std::max<uint64_t>(FLOAT_PER_BLOCK, CeilAlign(rowFactor / BUFFER_NUM, FLOAT_PER_BLOCK));
+        }
+        if (mode == MODE_AR_SEQ) {
+            uint64_t laneBytes = CalcLaneBytes(rowFactor, typeSize, mode);
+            colFactor = (ubAvail - laneBytes) / perElem / MAX_GROUP_ROW_LEN * MAX_GROUP_ROW_LEN;
+            colFactor = std::min<uint64_t>(colFactor, CeilAlign(rInner, alignNum));
+        }
+        blocksPerLine = CeilDiv(lineLen, rowFactor);
+    }
+    uint64_t unitNum = lineNum * blocksPerLine;
+
+    // 输出单元不足一半核数时沿规约轴切分，各核的部分状态写入workspace后按Chan公式合并
+    uint32_t splitNum = 1;
+    uint64_t partLen = reduceLen;
+    if (mode != MODE_AR_GROUP && unitNum * BUFFER_NUM <= coreNum && rowFactor > 0 && colFactor > 0) {
+        uint64_t minPart = mode == MODE_RA ? rowFactor : colFactor;
+        uint64_t maxSplit = std::min<uint64_t>(coreNum / unitNum, CeilDiv(reduceLen, minPart));
+        if (maxSplit > 1) {
+            partLen = CeilDiv(reduceLen, maxSplit);
+            splitNum = static_cast<uint32_t>(CeilDiv(reduceLen, partLen));
+        }
+    }
+    uint64_t taskNum = unitNum * splitNum;
+    uint64_t usedCoreNum = std::min<uint64_t>(coreNum, taskNum);
+
+    tilingData.set_lineLen(lineLen);
+    tilingData.set_blocksPerLine(blocksPerLine);
+    tilingData.set_unitNum(unitNum);
+    tilingData.set_partLen(partLen);
+    tilingData.set_tasksPerCore(taskNum / usedCoreNum);
+    tilingData.set_tailTasks(taskNum % usedCoreNum);
+    tilingData.set_correction(params.correction);
+    tilingData.set_mode(mode);
+    tilingData.set_usedCoreNum(static_cast<uint32_t>(usedCoreNum));
+    tilingData.set_colFactor(static_cast<uint32_t>(colFactor));
+    tilingData.set_rowFactor(static_cast<uint32_t>(rowFactor));
+    tilingData.set_splitNum(splitNum);
+    tilingData.set_isStd(params.isStd ? 1 : 0);
+}
+
+static void PrintTilingData(gert::TilingContext* context, WelfordVarMeanTilingData& tilingData)
+{
+    const ge::char_t* nodeName = context->GetNodeName();
+    OP_LOGD(nodeName, "rOuterNum: %lu", tilingData.get_rOuterNum());
+    OP_LOGD(nodeName, "rInner: %lu", tilingData.get_rInner());
+    OP_LOGD(nodeName, "innerNum: %lu", tilingData.get_innerNum());
+    OP_LOGD(nodeName, "lineLen: %lu", tilingData.get_lineLen());
+    OP_LOGD(nodeName, "blocksPerLine: %lu", tilingData.get_blocksPerLine());
+    OP_LOGD(nodeName, "unitNum: %lu", tilingData.get_unitNum());
+    OP_LOGD(nodeName, "partLen: %lu", tilingData.get_partLen());
+    OP_LOGD(nodeName, "tasksPerCore: %lu", tilingData.get_tasksPerCore());
+    OP_LOGD(nodeName, "tailTasks: %lu", tilingData.get_tailTasks());
+    OP_LOGD(nodeName, "correction: %ld", tilingData.get_correction());
+    for (uint32_t i = 0; i < tilingData.get_aDimNum(); i++) {
+        OP_LOGD(nodeName, "a dim %u: shape %ld, stride %ld", i, tilingData.get_aShape()[i],
+                tilingData.get_aStride()[i]);
+    }
+    for (uint32_t i = 0; i < tilingData.get_rDimNum(); i++) {
+        OP_LOGD(nodeName, "r dim %u: shape %ld, stride %ld", i, tilingData.get_rShape()[i],
+                tilingData.get_rStride()[i]);
+    }
+    OP_LOGD(nodeName, "mode: %u", tilingData.get_mode());
+    OP_LOGD(nodeName, "usedCoreNum: %u", tilingData.get_usedCoreNum());
+    OP_LOGD(nodeName, "colFactor: %u", tilingData.get_colFactor());
+    OP_LOGD(nodeName, "rowFactor: %u", tilingData.get_rowFactor());
+    OP_LOGD(nodeName, "splitNum: %u", tilingData.get_splitNum());
+    OP_LOGD(nodeName, "isStd: %u", tilingData.get_isStd());
+}
+
+static ge::graphStatus Tiling4WelfordVarMean(gert::TilingContext* context)
+{
+    OP_LOGI(context->GetNodeName(), "WelfordVarMean tiling starts running");
+    auto compileInfo = reinterpret_cast<const WelfordVarMeanCompileInfo*>(context->GetCompileInfo());
+    OP_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    OP_CHECK_IF(
+        compileInfo->vectorCoreNum <= 0 || compileInfo->ubByteSize <= RESERVED_UB,
+        OP_LOGE(context->GetNodeName(), "Failed to get core num or ub size."), return ge::GRAPH_FAILED);
+
+    auto xDesc = context->GetInputDesc(X_INPUT_INDEX);
+    OP_CHECK_NULL_WITH_CONTEXT(context, xDesc);
+    WelfordVarMeanParams params;
+    params.dtype = xDesc->GetDataType();
+    uint64_t tilingKey = FLOAT_TILING_KEY;
+    if (params.dtype == ge::DT_FLOAT16) {
+        tilingKey = FLOAT16_TILING_KEY;
+    } else if (params.dtype == ge::DT_BF16) {
+        tilingKey = BFLOAT16_TILING_KEY;
+    } else if (params.dtype != ge::DT_FLOAT) {
+        OP_LOGE(context->GetNodeName(), "the current x dtype is not in dtype support list [bfloat16, float16, float].");
+        return ge::GRAPH_FAILED;
+    }
+    ge::graphStatus ret = GetInputInfo(context, params);
+    if (ret != ge::GRAPH_SUCCESS) {
+        return ret;
+    }
+
+    WelfordVarMeanTilingData tilingData;
+    uint64_t aOuterNum = 1;
+    ret = SplitLayout(context, params, tilingData, aOuterNum);
+    if (ret != ge::GRAPH_SUCCESS) {
+        return ret;
+    }
+    CalcTilingData(params, aOuterNum, compileInfo->vectorCoreNum, compileInfo->ubByteSize, tilingData);
+    OP_CHECK_IF(
+        tilingData.get_rowFactor() == 0 || tilingData.get_colFactor() == 0,
+        OP_LOGE(context->GetNodeName(), "ub space is not enough, please check input."), return ge::GRAPH_FAILED);
+
+    context->SetTilingKey(tilingKey);
+    context->SetBlockDim(tilingData.get_usedCoreNum());
+    size_t* workspaces = context->GetWorkspaceSizes(1);
+    workspaces[0] = compileInfo->sysWorkspaceByteSize;
+    if (tilingData.get_splitNum() > 1) {
+        uint64_t lanes = tilingData.get_mode() == MODE_RA ? tilingData.get_colFactor() : tilingData.get_rowFactor();
+        // 每个(单元, 份)保存mean与M2两组部分状态
+        workspaces[0] += tilingData.get_unitNum() * tilingData.get_splitNum() * BUFFER_NUM *
+                         CeilAlign(lanes, FLOAT_PER_BLOCK) * FLOAT_BYTES;
+    }
+    tilingData.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tilingData.GetDataSize());
+    PrintTilingData(context, tilingData);
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus TilingPrepare4WelfordVarMean(gert::TilingParseContext* context)
+{
+    auto compileInfo = context->GetCompiledInfo<WelfordVarMeanCompileInfo>();
+    OP_CHECK_NULL_WITH_CONTEXT(context, compileInfo);
+    auto platformInfo = context->GetPlatformInfo();
+    OP_CHECK_NULL_WITH_CONTEXT(context, platformInfo);
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(platformInfo);
+    compileInfo->vectorCoreNum = ascendcPlatform.GetCoreNumAiv();
+    OP_CHECK_IF(
+        (compileInfo->vectorCoreNum <= 0), OP_LOGE(context->GetNodeName(), "No vector core available."),
+        return ge::GRAPH_FAILED);
+    uint64_t ubByteSize;
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ubByteSize);
+    compileInfo->ubByteSize = ubByteSize;
+    OP_CHECK_IF(
+        (compileInfo->ubByteSize <= 0), OP_LOGE(context->GetNodeName(), "Failed to get ub size."),
+        return ge::GRAPH_FAILED);
+    compileInfo->sysWorkspaceByteSize = ascendcPlatform.GetLibApiWorkSpaceSize();
+    return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_OPTILING(WelfordVarMean)
+    .Tiling(Tiling4WelfordVarMean)
+    .TilingParse<WelfordVarMeanCompileInfo>(TilingPrepare4WelfordVarMean);
+} // namespace optiling
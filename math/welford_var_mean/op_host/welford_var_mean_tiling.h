@@ -0,0 +1,57 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file welford_var_mean_tiling.h
+ * \brief
+ */
+#ifndef OPS_BUILT_IN_OP_TILING_RUNTIME_WELFORD_VAR_MEAN_H_
+#define OPS_BUILT_IN_OP_TILING_RUNTIME_WELFORD_VAR_MEAN_H_
+
+#include "register/tilingdata_base.h"
+
+namespace optiling {
+// 合并相邻同类维度后最内两维单独描述，其余外层保留/规约维度交替出现，各自最多4个
+constexpr uint32_t WELFORD_MAX_OUTER_DIM = 4;
+
+BEGIN_TILING_DATA_DEF(WelfordVarMeanTilingData)
+TILING_DATA_FIELD_DEF(uint64_t, rOuterNum);   // 外层规约维度之积
+TILING_DATA_FIELD_DEF(uint64_t, rInner);      // 最内规约维长度
+TILING_DATA_FIELD_DEF(uint64_t, innerNum);    // 最内保留维长度，规约轴在最内时为1
+TILING_DATA_FIELD_DEF(uint64_t, lineLen);     // 每行单元覆盖的输出数，RA模式为innerNum，AR模式为最内外层保留维长度
+TILING_DATA_FIELD_DEF(uint64_t, blocksPerLine); // 每行切分的单元数
+TILING_DATA_FIELD_DEF(uint64_t, unitNum);     // 输出单元总数
+TILING_DATA_FIELD_DEF(uint64_t, partLen);     // 多核切分规约轴时每份的规约长度
+TILING_DATA_FIELD_DEF(uint64_t, tasksPerCore); // 每核处理的(单元, 份)任务数
+TILING_DATA_FIELD_DEF(uint64_t, tailTasks);   // 前tailTasks个核多处理一个任务
+TILING_DATA_FIELD_DEF(int64_t, correction);
+TILING_DATA_FIELD_DEF_ARR(int64_t, WELFORD_MAX_OUTER_DIM, aShape);
+TILING_DATA_FIELD_DEF_ARR(int64_t, WELFORD_MAX_OUTER_DIM, aStride);
+TILING_DATA_FIELD_DEF_ARR(int64_t, WELFORD_MAX_OUTER_DIM, rShape);
+TILING_DATA_FIELD_DEF_ARR(int64_t, WELFORD_MAX_OUTER_DIM, rStride);
+TILING_DATA_FIELD_DEF(uint32_t, aDimNum);
+TILING_DATA_FIELD_DEF(uint32_t, rDimNum);
+TILING_DATA_FIELD_DEF(uint32_t, mode);
+TILING_DATA_FIELD_DEF(uint32_t, usedCoreNum);
+TILING_DATA_FIELD_DEF(uint32_t, colFactor);   // RA: 每个单元的列数; AR: 每次搬入的规约元素数
+TILING_DATA_FIELD_DEF(uint32_t, rowFactor);   // RA: 每次搬入的行数; AR: 每个单元的输出数
+TILING_DATA_FIELD_DEF(uint32_t, splitNum);    // 规约轴切分份数，1表示不切分
+TILING_DATA_FIELD_DEF(uint32_t, isStd);
+END_TILING_DATA_DEF;
+REGISTER_TILING_DATA_CLASS(WelfordVarMean, WelfordVarMeanTilingData)
+
+struct WelfordVarMeanCompileInfo {
+    uint32_t vectorCoreNum;
+    uint32_t sysWorkspaceByteSize;
+    uint32_t ubByteSize;
+};
+} // namespace optiling
+#endif // OPS_BUILT_IN_OP_TILING_RUNTIME_WELFORD_VAR_MEAN_H_
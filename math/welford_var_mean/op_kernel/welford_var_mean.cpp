@@ -0,0 +1,40 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file welford_var_mean.cpp
+ * \brief
+ */
+
+#include "kernel_operator.h"
+#include "welford_var_mean.h"
+
+using namespace WelfordVarMean;
+
+extern "C" __global__ __aicore__ void welford_var_mean(
+    GM_ADDR x, GM_ADDR var, GM_ADDR mean, GM_ADDR workspace, GM_ADDR tiling)
+{
+    GET_TILING_DATA(tilingData, tiling);
+    GM_ADDR usrWorkspace = GetUserWorkspace(workspace);
+    if (TILING_KEY_IS(1)) {
+        WelfordVarMeanND<float> op;
+        op.Init(x, var, mean, usrWorkspace, &tilingData);
+        op.Process();
+    } else if (TILING_KEY_IS(2)) {
+        WelfordVarMeanND<half> op;
+        op.Init(x, var, mean, usrWorkspace, &tilingData);
+        op.Process();
+    } else if (TILING_KEY_IS(3)) {
+        WelfordVarMeanND<bfloat16_t> op;
+        op.Init(x, var, mean, usrWorkspace, &tilingData);
+        op.Process();
+    }
+}
@@ -0,0 +1,536 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file welford_var_mean.h
+ * \brief 单遍Welford方差/均值：输入只读一次，按块统计后用Chan公式合并
+ *
+ * 合并相邻同类维度后，最内两维描述为[rInner, innerNum]（规约轴在最内时innerNum为1），
+ * 其余外层保留/规约维度通过shape与stride寻址，因此任意规约轴组合都不需要转置。
+ *   RA模式：每个单元是一个输出行上的一段列，按[rows, cols]块搬入，沿行方向二分折叠求块内和与M2。
+ *   AR_GROUP模式：规约轴较短，一次搬入多个输出的整行，用WholeReduceSum对每行规约。
+ *   AR_SEQ模式：规约轴较长，逐个输出分段用ReduceSum规约，标量合并。
+ * 块内先求均值再求偏差平方和，块间按Chan公式合并(count, mean, M2)。输出单元不足时沿规约轴切分到多核，
+ * 部分状态写入workspace，全核同步后由各单元的首个核合并。
+ */
+#ifndef WELFORD_VAR_MEAN_H
+#define WELFORD_VAR_MEAN_H
+
+#include "kernel_operator.h"
+
+namespace WelfordVarMean {
+using namespace AscendC;
+
+constexpr int32_t BUFFER_NUM = 2;
+constexpr uint32_t BYTE_BLOCK = 32;
+constexpr uint32_t FLOAT_PER_BLOCK = 8;
+constexpr uint32_t MAX_OUTER_DIM = 4;
+
+constexpr uint32_t MODE_RA = 0;
+constexpr uint32_t MODE_AR_GROUP = 1;
+constexpr uint32_t MODE_AR_SEQ = 2;
+
+template <typename T>
+class WelfordVarMeanND {
+public:
+    __aicore__ inline WelfordVarMeanND(){};
+    __aicore__ inline void Init(
+        GM_ADDR x, GM_ADDR var, GM_ADDR mean, GM_ADDR workspace, const WelfordVarMeanTilingData* __restrict tilingData);
+    __aicore__ inline void Process();
+
+private:
+    __aicore__ inline void ProcessRange(uint64_t unit, uint64_t start, uint64_t end);
+    __aicore__ inline void ProcessRangeRA(uint64_t unit, uint64_t start, uint64_t end);
+    __aicore__ inline void ProcessRangeARGroup(uint64_t unit, uint64_t start, uint64_t end);
+    __aicore__ inline void ProcessRangeARSeq(uint64_t unit, uint64_t start, uint64_t end);
+    __aicore__ inline LocalTensor<float> LoadTile(
+        int64_t offset, uint32_t blockCount, uint32_t blockLen, uint32_t srcGap, uint32_t rowLen);
+    __aicore__ inline void FoldRows(const LocalTensor<float>& buf, uint32_t rows, uint32_t rowLen);
+    __aicore__ inline void TileStatsRA(const LocalTensor<float>& tile, uint32_t rows, uint32_t rowLen);
+    __aicore__ inline void TileStatsARGroup(
+        const LocalTensor<float>& tile, uint32_t lanes, uint32_t rowLen, uint32_t validLen);
+    __aicore__ inline void Merge(float countA, float countB, uint32_t lanes);
+    __aicore__ inline void ResetState();
+    __aicore__ inline void SaveState(uint64_t task);
+    __aicore__ inline void MergeParts(uint64_t unit);
+    __aicore__ inline void Finalize(uint64_t unit);
+    __aicore__ inline void CopyOut(const GlobalTensor<T>& dstGm, const LocalTensor<float>& src, int64_t offset,
+                                   uint32_t count);
+    __aicore__ inline int64_t AOffset(uint64_t index);
+    __aicore__ inline int64_t ROffset(uint64_t index);
+    __aicore__ inline uint32_t UnitLanes(uint64_t unit);
+
+    template <typename T1>
+    __aicore__ inline T1 CeilAlign(T1 a, T1 b)
+    {
+        return b == 0 ? a : (a + b - 1) / b * b;
+    }
+
+    template <typename T1>
+    __aicore__ inline T1 Min(T1 a, T1 b)
+    {
+        return a < b ? a : b;
+    }
+
+    template <HardEvent EVENT>
+    __aicore__ inline void SyncFlag()
+    {
+        event_t eventId = static_cast<event_t>(GetTPipePtr()->FetchEventID(EVENT));
+        SetFlag<EVENT>(eventId);
+        WaitFlag<EVENT>(eventId);
+    }
+
+private:
+    static constexpr bool IS_FLOAT = IsSameType<T, float>::value;
+
+    TPipe pipe;
+    TQue<QuePosition::VECIN, BUFFER_NUM> inQueue;
+    TQue<QuePosition::VECOUT, 1> outQueue;
+    TBuf<QuePosition::VECCALC> castBuf;
+    TBuf<QuePosition::VECCALC> tmpBuf;
+    TBuf<QuePosition::VECCALC> meanAccBuf;
+    TBuf<QuePosition::VECCALC> m2AccBuf;
+    TBuf<QuePosition::VECCALC> tileMeanBuf;
+    TBuf<QuePosition::VECCALC> tileM2Buf;
+    TBuf<QuePosition::VECCALC> deltaBuf;
+    TBuf<QuePosition::VECCALC> brcbBuf;
+    GlobalTensor<T> xGm;
+    GlobalTensor<T> varGm;
+    GlobalTensor<T> meanGm;
+    GlobalTensor<float> workspaceGm;
+
+    uint64_t taskStart = 0;
+    uint64_t taskNum = 0;
+    uint64_t rOuterNum = 0;
+    uint64_t rInner = 0;
+    uint64_t innerNum = 0;
+    uint64_t lineLen = 0;
+    uint64_t blocksPerLine = 0;
+    uint64_t unitNum = 0;
+    uint64_t partLen = 0;
+    uint64_t reduceLen = 0;
+    int64_t correction = 0;
+    int64_t aShape[MAX_OUTER_DIM] = {0};
+    int64_t aStride[MAX_OUTER_DIM] = {0};
+    int64_t rShape[MAX_OUTER_DIM] = {0};
+    int64_t rStride[MAX_OUTER_DIM] = {0};
+    uint32_t aDimNum = 0;
+    uint32_t rDimNum = 0;
+    uint32_t mode = 0;
+    uint32_t colFactor = 0;
+    uint32_t rowFactor = 0;
+    uint32_t splitNum = 0;
+    uint32_t isStd = 0;
+    uint32_t alignNum = 0;
+    uint32_t laneAlloc = 0;
+};
+
+template <typename T>
+__aicore__ inline void WelfordVarMeanND<T>::Init(
+    GM_ADDR x, GM_ADDR var, GM_ADDR mean, GM_ADDR workspace, const WelfordVarMeanTilingData* __restrict tilingData)
+{
+    uint64_t blockIdx = GetBlockIdx();
+    uint64_t tasksPerCore = tilingData->tasksPerCore;
+    uint64_t tailTasks = tilingData->tailTasks;
+    taskNum = tasksPerCore + (blockIdx < tailTasks ? 1 : 0);
+    taskStart = blockIdx * tasksPerCore + (blockIdx < tailTasks ? blockIdx : tailTasks);
+    rOuterNum = tilingData->rOuterNum;
+    rInner = tilingData->rInner;
+    innerNum = tilingData->innerNum;
+    lineLen = tilingData->lineLen;
+    blocksPerLine = tilingData->blocksPerLine;
+    unitNum = tilingData->unitNum;
+    partLen = tilingData->partLen;
+    reduceLen = rOuterNum * rInner;
+    correction = tilingData->correction;
+    aDimNum = tilingData->aDimNum;
+    rDimNum = tilingData->rDimNum;
+    for (uint32_t i = 0; i < MAX_OUTER_DIM; i++) {
+        aShape[i] = tilingData->aShape[i];
+        aStride[i] = tilingData->aStride[i];
+        rShape[i] = tilingData->rShape[i];
+        rStride[i] = tilingData->rStride[i];
+    }
+    mode = tilingData->mode;
+    colFactor = tilingData->colFactor;
+    rowFactor = tilingData->rowFactor;
+    splitNum = tilingData->splitNum;
+    isStd = tilingData->isStd;
+    alignNum = BYTE_BLOCK / sizeof(T);
+    laneAlloc = CeilAlign(mode == MODE_RA ? colFactor : rowFactor, FLOAT_PER_BLOCK);
+
+    xGm.SetGlobalBuffer((__gm__ T*)x);
+    varGm.SetGlobalBuffer((__gm__ T*)var);
+    meanGm.SetGlobalBuffer((__gm__ T*)mean);
+    workspaceGm.SetGlobalBuffer((__gm__ float*)workspace);
+
+    uint32_t tileElems = mode == MODE_AR_SEQ ? colFactor : rowFactor * colFactor;
+    pipe.InitBuffer(inQueue, BUFFER_NUM, tileElems * sizeof(T));
+    pipe.InitBuffer(outQueue, 1, laneAlloc * sizeof(T));
+    pipe.InitBuffer(castBuf, tileElems * sizeof(float));
+    pipe.InitBuffer(tmpBuf, tileElems * sizeof(float));
+    pipe.InitBuffer(meanAccBuf, laneAlloc * sizeof(float));
+    pipe.InitBuffer(m2AccBuf, laneAlloc * sizeof(float));
+    pipe.InitBuffer(tileMeanBuf, laneAlloc * sizeof(float));
+    pipe.InitBuffer(tileM2Buf, laneAlloc * sizeof(float));
+    pipe.InitBuffer(deltaBuf, laneAlloc * sizeof(float));
+    if (mode == MODE_AR_GROUP) {
+        pipe.InitBuffer(brcbBuf, laneAlloc * FLOAT_PER_BLOCK * sizeof(float));
+    }
+}
+
+template <typename T>
+__aicore__ inline void WelfordVarMeanND<T>::Process()
+{
+    if (splitNum == 1) {
+        for (uint64_t i = 0; i < taskNum; i++) {
+            ProcessRange(taskStart + i, 0, reduceLen);
+            Finalize(taskStart + i);
+        }
+        return;
+    }
+    for (uint64_t i = 0; i < taskNum; i++) {
+        uint64_t task = taskStart + i;
+        uint64_t start = (task % splitNum) * partLen;
+        ProcessRange(task / splitNum, start, Min(reduceLen, start + partLen));
+        SaveState(task);
+    }
+    SyncAll();
+    // 切分只在单元数不超过核数一半时发生，每个单元由同号核完成合并
+    uint64_t unit = GetBlockIdx();
+    if (unit < unitNum) {
+        MergeParts(unit);
+        Finalize(unit);
+    }
+}
+
+template <typename T>
+__aicore__ inline int64_t WelfordVarMeanND<T>::AOffset(uint64_t index)
+{
+    int64_t offset = 0;
+    for (int32_t i = static_cast<int32_t>(aDimNum) - 1; i >= 0; i--) {
+        offset += static_cast<int64_t>(index % aShape[i]) * aStride[i];
+        index /= aShape[i];
+    }
+    return offset;
+}
+
+template <typename T>
+__aicore__ inline int64_t WelfordVarMeanND<T>::ROffset(uint64_t index)
+{
+    int64_t offset = 0;
+    for (int32_t i = static_cast<int32_t>(rDimNum) - 1; i >= 0; i--) {
+        offset += static_cast<int64_t>(index % rShape[i]) * rStride[i];
+        index /= rShape[i];
+    }
+    return offset;
+}
+
+template <typename T>
+__aicore__ inline uint32_t WelfordVarMeanND<T>::UnitLanes(uint64_t unit)
+{
+    uint64_t factor = mode == MODE_RA ? colFactor : rowFactor;
+    uint64_t start = (unit % blocksPerLine) * factor;
+    return static_cast<uint32_t>(Min(factor, lineLen - start));
+}
+
+template <typename T>
+__aicore__ inline void WelfordVarMeanND<T>::ResetState()
+{
+    Duplicate(meanAccBuf.Get<float>(), 0.0f, laneAlloc);
+    Duplicate(m2AccBuf.Get<float>(), 0.0f, laneAlloc);
+    PipeBarrier<PIPE_V>();
+}
+
+template <typename T>
+__aicore__ inline void WelfordVarMeanND<T>::ProcessRange(uint64_t unit, uint64_t start, uint64_t end)
+{
+    ResetState();
+    if (mode == MODE_RA) {
+        ProcessRangeRA(unit, start, end);
+    } else if (mode == MODE_AR_GROUP) {
+        ProcessRangeARGroup(unit, start, end);
+    } else {
+        ProcessRangeARSeq(unit, start, end);
+    }
+}
+
+// 搬入blockCount行、每行blockLen个元素，行间在GM上间隔srcGap个元素，UB内每行补零到rowLen，返回fp32视图
+template <typename T>
+__aicore__ inline LocalTensor<float> WelfordVarMeanND<T>::LoadTile(
+    int64_t offset, uint32_t blockCount, uint32_t blockLen, uint32_t srcGap, uint32_t rowLen)
+{
+    LocalTensor<T> inLocal = inQueue.AllocTensor<T>();
+    DataCopyExtParams copyParams = {
+        static_cast<uint16_t>(blockCount), static_cast<uint32_t>(blockLen * sizeof(T)),
+        static_cast<uint32_t>(srcGap * sizeof(T)), 0, 0};
+    DataCopyPadExtParams<T> padParams = {true, 0, static_cast<uint8_t>(rowLen - blockLen), static_cast<T>(0)};
+    DataCopyPad(inLocal, xGm[offset], copyParams, padParams);
+    inQueue.EnQue(inLocal);
+    inLocal = inQueue.DeQue<T>();
+    LocalTensor<float> tile = castBuf.Get<float>();
+    PipeBarrier<PIPE_V>();
+    if constexpr (IS_FLOAT) {
+        Adds(tile, inLocal, 0.0f, blockCount * rowLen);
+    } else {
+        Cast(tile, inLocal, RoundMode::CAST_NONE, blockCount * rowLen);
+    }
+    PipeBarrier<PIPE_V>();
+    inQueue.FreeTensor(inLocal);
+    return tile;
+}
+
+// 行方向二分折叠，结果留在buf的第0行
+template <typename T>
+__aicore__ inline void WelfordVarMeanND<T>::FoldRows(const LocalTensor<float>& buf, uint32_t rows, uint32_t rowLen)
+{
+    while (rows > 1) {
+        uint32_t half = rows / 2;
+        Add(buf, buf, buf[(rows - half) * rowLen], half * rowLen);
+        PipeBarrier<PIPE_V>();
+        rows -= half;
+    }
+}
+
+// 块内按列统计：均值写入tileMean，偏差平方和写入tileM2
+template <typename T>
+__aicore__ inline void WelfordVarMeanND<T>::TileStatsRA(const LocalTensor<float>& tile, uint32_t rows, uint32_t rowLen)
+{
+    uint32_t total = rows * rowLen;
+    LocalTensor<float> tmp = tmpBuf.Get<float>();
+    LocalTensor<float> tileMean = tileMeanBuf.Get<float>();
+    LocalTensor<float> tileM2 = tileM2Buf.Get<float>();
+    Adds(tmp, tile, 0.0f, total);
+    PipeBarrier<PIPE_V>();
+    FoldRows(tmp, rows, rowLen);
+    Muls(tileMean, tmp, 1.0f / static_cast<float>(rows), rowLen);
+    PipeBarrier<PIPE_V>();
+    // 均值按倍增方式铺满整块，一条Sub完成去均值
+    Adds(tmp, tileMean, 0.0f, rowLen);
+    PipeBarrier<PIPE_V>();
+    for (uint32_t filled = 1; filled < rows;) {
+        uint32_t count = Min(filled, rows - filled);
+        Adds(tmp[filled * rowLen], tmp, 0.0f, count * rowLen);
+        PipeBarrier<PIPE_V>();
+        filled += count;
+    }
+    Sub(tile, tile, tmp, total);
+    PipeBarrier<PIPE_V>();
+    Mul(tile, tile, tile, total);
+    PipeBarrier<PIPE_V>();
+    FoldRows(tile, rows, rowLen);
+    Adds(tileM2, tile, 0.0f, rowLen);
+    PipeBarrier<PIPE_V>();
+}
+
+// 每行一个输出：validLen个有效元素，WholeReduceSum一次完成所有行的规约
+template <typename T>
+__aicore__ inline void WelfordVarMeanND<T>::TileStatsARGroup(
+    const LocalTensor<float>& tile, uint32_t lanes, uint32_t rowLen, uint32_t validLen)
+{
+    LocalTensor<float> tileMean = tileMeanBuf.Get<float>();
+    LocalTensor<float> tileM2 = tileM2Buf.Get<float>();
+    LocalTensor<float> brcb = brcbBuf.Get<float>();
+    uint32_t rowBlocks = rowLen / FLOAT_PER_BLOCK;
+    WholeReduceSum<float>(tileMean, tile, validLen, lanes, 1, 1, rowBlocks);
+    PipeBarrier<PIPE_V>();
+    Muls(tileMean, tileMean, 1.0f / static_cast<float>(validLen), lanes);
+    PipeBarrier<PIPE_V>();
+    Brcb(brcb, tileMean, static_cast<uint8_t>(CeilAlign(lanes, FLOAT_PER_BLOCK) / FLOAT_PER_BLOCK),
+         {1, static_cast<uint16_t>(FLOAT_PER_BLOCK)});
+    PipeBarrier<PIPE_V>();
+    // 每个repeat处理一行，src1固定取该行均值所在的block
+    BinaryRepeatParams repeatParams = {
+        1, 1, 0, static_cast<uint8_t>(rowBlocks), static_cast<uint8_t>(rowBlocks), 1};
+    Sub(tile, tile, brcb, static_cast<uint64_t>(rowLen), static_cast<uint8_t>(lanes), repeatParams);
+    PipeBarrier<PIPE_V>();
+    Mul(tile, tile, tile, lanes * rowLen);
+    PipeBarrier<PIPE_V>();
+    WholeReduceSum<float>(tileM2, tile, validLen, lanes, 1, 1, rowBlocks);
+    PipeBarrier<PIPE_V>();
+}
+
+// Chan公式：delta = meanB - meanA, mean += delta * nB / n, M2 += M2B + delta^2 * nA * nB / n
+template <typename T>
+__aicore__ inline void WelfordVarMeanND<T>::Merge(float countA, float countB, uint32_t lanes)
+{
+    LocalTensor<float> meanAcc = meanAccBuf.Get<float>();
+    LocalTensor<float> m2Acc = m2AccBuf.Get<float>();
+    LocalTensor<float> tileMean = tileMeanBuf.Get<float>();
+    LocalTensor<float> tileM2 = tileM2Buf.Get<float>();
+    LocalTensor<float> delta = deltaBuf.Get<float>();
+    float total = countA + countB;
+    Sub(delta, tileMean, meanAcc, lanes);
+    Add(m2Acc, m2Acc, tileM2, lanes);
+    PipeBarrier<PIPE_V>();
+    Muls(tileMean, delta, countB / total, lanes);
+    Mul(delta, delta, delta, lanes);
+    PipeBarrier<PIPE_V>();
+    Add(meanAcc, meanAcc, tileMean, lanes);
+    Muls(delta, delta, countA * countB / total, lanes);
+    PipeBarrier<PIPE_V>();
+    Add(m2Acc, m2Acc, delta, lanes);
+    PipeBarrier<PIPE_V>();
+}
+
+template <typename T>
+__aicore__ inline void WelfordVarMeanND<T>::ProcessRangeRA(uint64_t unit, uint64_t start, uint64_t end)
+{
+    uint64_t line = unit / blocksPerLine;
+    uint64_t colStart = (unit % blocksPerLine) * colFactor;
+    uint32_t colCount = UnitLanes(unit);
+    uint32_t rowLen = CeilAlign(colCount, alignNum);
+    int64_t base = AOffset(line) + static_cast<int64_t>(colStart);
+    uint64_t count = 0;
+    for (uint64_t pos = start; pos < end;) {
+        uint64_t rowIdx = pos % rInner;
+        uint32_t rows = static_cast<uint32_t>(Min(Min(end - pos, rInner - rowIdx), static_cast<uint64_t>(rowFactor)));
+        int64_t offset = base + ROffset(pos / rInner) + static_cast<int64_t>(rowIdx * innerNum);
+        LocalTensor<float> tile = LoadTile(offset, rows, colCount, static_cast<uint32_t>(innerNum - colCount), rowLen);
+        TileStatsRA(tile, rows, rowLen);
+        Merge(static_cast<float>(count), static_cast<float>(rows), rowLen);
+        count += rows;
+        pos += rows;
+    }
+}
+
+template <typename T>
+__aicore__ inline void WelfordVarMeanND<T>::ProcessRangeARGroup(uint64_t unit, uint64_t start, uint64_t end)
+{
+    uint64_t line = unit / blocksPerLine;
+    uint64_t firstOut = line * lineLen + (unit % blocksPerLine) * rowFactor;
+    uint32_t lanes = UnitLanes(unit);
+    int64_t laneStride = aDimNum > 0 ? aStride[aDimNum - 1] : 0;
+    int64_t base = AOffset(firstOut);
+    uint32_t srcGap = lanes > 1 ? static_cast<uint32_t>(laneStride - static_cast<int64_t>(rInner)) : 0;
+    uint64_t count = 0;
+    for (uint64_t pos = start; pos < end; pos += rInner) {
+        LocalTensor<float> tile =
+            LoadTile(base + ROffset(pos / rInner), lanes, static_cast<uint32_t>(rInner), srcGap, colFactor);
+        TileStatsARGroup(tile, lanes, colFactor, static_cast<uint32_t>(rInner));
+        Merge(static_cast<float>(count), static_cast<float>(rInner), lanes);
+        count += rInner;
+    }
+}
+
+template <typename T>
+__aicore__ inline void WelfordVarMeanND<T>::ProcessRangeARSeq(uint64_t unit, uint64_t start, uint64_t end)
+{
+    uint64_t line = unit / blocksPerLine;
+    uint64_t firstOut = line * lineLen + (unit % blocksPerLine) * rowFactor;
+    uint32_t lanes = UnitLanes(unit);
+    int64_t laneStride = aDimNum > 0 ? aStride[aDimNum - 1] : 0;
+    int64_t base = AOffset(firstOut);
+    LocalTensor<float> tmp = tmpBuf.Get<float>();
+    LocalTensor<float> meanAcc = meanAccBuf.Get<float>();
+    LocalTensor<float> m2Acc = m2AccBuf.Get<float>();
+    SyncFlag<HardEvent::V_S>();
+    for (uint32_t lane = 0; lane < lanes; lane++) {
+        float meanA = 0.0f;
+        float m2A = 0.0f;
+        uint64_t count = 0;
+        for (uint64_t pos = start; pos < end;) {
+            uint64_t elemIdx = pos % rInner;
+            uint32_t len = static_cast<uint32_t>(Min(Min(end - pos, rInner - elemIdx), static_cast<uint64_t>(colFactor)));
+            int64_t offset = base + lane * laneStride + ROffset(pos / rInner) + static_cast<int64_t>(elemIdx);
+            LocalTensor<float> tile = LoadTile(offset, 1, len, 0, CeilAlign(len, alignNum));
+            ReduceSum<float>(tmp, tile, tmp, len);
+            SyncFlag<HardEvent::V_S>();
+            float meanB = tmp.GetValue(0) / static_cast<float>(len);
+            Adds(tile, tile, -meanB, len);
+            PipeBarrier<PIPE_V>();
+            Mul(tile, tile, tile, len);
+            PipeBarrier<PIPE_V>();
+            ReduceSum<float>(tmp, tile, tmp, len);
+            SyncFlag<HardEvent::V_S>();
+            float m2B = tmp.GetValue(0);
+            float countA = static_cast<float>(count);
+            float total = countA + static_cast<float>(len);
+            float delta = meanB - meanA;
+            meanA += delta * static_cast<float>(len) / total;
+            m2A += m2B + delta * delta * countA * static_cast<float>(len) / total;
+            count += len;
+            pos += len;
+        }
+        meanAcc.SetValue(lane, meanA);
+        m2Acc.SetValue(lane, m2A);
+    }
+    SyncFlag<HardEvent::S_V>();
+}
+
+template <typename T>
+__aicore__ inline void WelfordVarMeanND<T>::SaveState(uint64_t task)
+{
+    int64_t offset = static_cast<int64_t>(task * BUFFER_NUM * laneAlloc);
+    SyncFlag<HardEvent::V_MTE3>();
+    DataCopy(workspaceGm[offset], meanAccBuf.Get<float>(), laneAlloc);
+    DataCopy(workspaceGm[offset + laneAlloc], m2AccBuf.Get<float>(), laneAlloc);
+    SyncFlag<HardEvent::MTE3_V>();
+}
+
+template <typename T>
+__aicore__ inline void WelfordVarMeanND<T>::MergeParts(uint64_t unit)
+{
+    ResetState();
+    uint32_t lanes = mode == MODE_RA ? CeilAlign(UnitLanes(unit), alignNum) : UnitLanes(unit);
+    uint64_t count = 0;
+    for (uint32_t part = 0; part < splitNum; part++) {
+        int64_t offset = static_cast<int64_t>((unit * splitNum + part) * BUFFER_NUM * laneAlloc);
+        SyncFlag<HardEvent::V_MTE2>();
+        DataCopy(tileMeanBuf.Get<float>(), workspaceGm[offset], laneAlloc);
+        DataCopy(tileM2Buf.Get<float>(), workspaceGm[offset + laneAlloc], laneAlloc);
+        SyncFlag<HardEvent::MTE2_V>();
+        uint64_t start = part * partLen;
+        uint64_t partCount = Min(reduceLen, start + partLen) - start;
+        Merge(static_cast<float>(count), static_cast<float>(partCount), lanes);
+        count += partCount;
+    }
+}
+
+template <typename T>
+__aicore__ inline void WelfordVarMeanND<T>::Finalize(uint64_t unit)
+{
+    uint32_t lanes = UnitLanes(unit);
+    uint64_t line = unit / blocksPerLine;
+    uint64_t factor = mode == MODE_RA ? colFactor : rowFactor;
+    int64_t outOffset = static_cast<int64_t>(line * lineLen + (unit % blocksPerLine) * factor);
+    LocalTensor<float> meanAcc = meanAccBuf.Get<float>();
+    LocalTensor<float> m2Acc = m2AccBuf.Get<float>();
+    CopyOut(meanGm, meanAcc, outOffset, lanes);
+    // 无偏修正由correction给出，count <= correction的场景由上层处理
+    Muls(m2Acc, m2Acc, 1.0f / static_cast<float>(static_cast<int64_t>(reduceLen) - correction), laneAlloc);
+    PipeBarrier<PIPE_V>();
+    if (isStd != 0) {
+        Sqrt(m2Acc, m2Acc, laneAlloc);
+        PipeBarrier<PIPE_V>();
+    }
+    CopyOut(varGm, m2Acc, outOffset, lanes);
+}
+
+template <typename T>
+__aicore__ inline void WelfordVarMeanND<T>::CopyOut(
+    const GlobalTensor<T>& dstGm, const LocalTensor<float>& src, int64_t offset, uint32_t count)
+{
+    LocalTensor<T> outLocal = outQueue.AllocTensor<T>();
+    if constexpr (IS_FLOAT) {
+        Adds(outLocal, src, 0.0f, laneAlloc);
+    } else {
+        Cast(outLocal, src, RoundMode::CAST_RINT, laneAlloc);
+    }
+    outQueue.EnQue(outLocal);
+    outLocal = outQueue.DeQue<T>();
+    DataCopyExtParams copyParams = {1, static_cast<uint32_t>(count * sizeof(T)), 0, 0, 0};
+    DataCopyPad(dstGm[offset], outLocal, copyParams);
+    outQueue.FreeTensor(outLocal);
+}
+} // namespace WelfordVarMean
+
+#endif // WELFORD_VAR_MEAN_H
@@ -0,0 +1,232 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file test_welford_var_mean_tiling.cpp
+ * \brief
+ */
+
+#include <iostream>
+#include <vector>
+#include <gtest/gtest.h>
+#include "../../../op_host/welford_var_mean_tiling.h"
+#include "tiling_context_faker.h"
+#include "tiling_case_executor.h"
+
+class WelfordVarMeanTiling : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        std::cout << "WelfordVarMeanTiling SetUp" << std::endl;
+    }
+    static void TearDownTestCase()
+    {
+        std::cout << "WelfordVarMeanTiling TearDown" << std::endl;
+    }
+};
+
+TEST_F(WelfordVarMeanTiling, welford_var_mean_tiling_ra_float)
+{
+    optiling::WelfordVarMeanCompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "WelfordVarMean",
+        {
+            {{{32, 1024, 256}, {32, 1024, 256}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{32, 256}, {32, 256}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{32, 256}, {32, 256}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("dim", Ops::Math::AnyValue::CreateFrom<std::vector<int64_t>>({1})),
+         gert::TilingContextPara::OpAttr("correction", Ops::Math::AnyValue::CreateFrom<int64_t>(1)),
+         gert::TilingContextPara::OpAttr("keepdim", Ops::Math::AnyValue::CreateFrom<bool>(false)),
+         gert::TilingContextPara::OpAttr("is_std", Ops::Math::AnyValue::CreateFrom<bool>(false))},
+        &compileInfo);
+    uint64_t expectTilingKey = 1;
+    std::string expectTilingData = "1 1024 256 256 2 64 1024 1 0 1 32 0 0 0 262144 0 0 0 0 0 0 0 0 0 0 0 1 274877906944 399431958656 1 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(WelfordVarMeanTiling, welford_var_mean_tiling_ra_split_float16_std)
+{
+    optiling::WelfordVarMeanCompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "WelfordVarMean",
+        {
+            {{{8, 4096, 64}, {8, 4096, 64}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+        },
+        {
+            {{{8, 64}, {8, 64}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{8, 64}, {8, 64}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("dim", Ops::Math::AnyValue::CreateFrom<std::vector<int64_t>>({1})),
+         gert::TilingContextPara::OpAttr("correction", Ops::Math::AnyValue::CreateFrom<int64_t>(1)),
+         gert::TilingContextPara::OpAttr("keepdim", Ops::Math::AnyValue::CreateFrom<bool>(false)),
+         gert::TilingContextPara::OpAttr("is_std", Ops::Math::AnyValue::CreateFrom<bool>(true))},
+        &compileInfo);
+    uint64_t expectTilingKey = 2;
+    std::string expectTilingData = "1 4096 64 64 1 8 512 1 0 1 8 0 0 0 262144 0 0 0 0 0 0 0 0 0 0 0 1 274877906944 1082331758656 4294967304 ";
+    std::vector<size_t> expectWorkspaces = {16809984};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(WelfordVarMeanTiling, welford_var_mean_tiling_ar_group_float)
+{
+    optiling::WelfordVarMeanCompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "WelfordVarMean",
+        {
+            {{{4096, 24}, {4096, 24}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{4096}, {4096}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{4096}, {4096}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("dim", Ops::Math::AnyValue::CreateFrom<std::vector<int64_t>>({1})),
+         gert::TilingContextPara::OpAttr("correction", Ops::Math::AnyValue::CreateFrom<int64_t>(1)),
+         gert::TilingContextPara::OpAttr("keepdim", Ops::Math::AnyValue::CreateFrom<bool>(false)),
+         gert::TilingContextPara::OpAttr("is_std", Ops::Math::AnyValue::CreateFrom<bool>(false))},
+        &compileInfo);
+    uint64_t expectTilingKey = 1;
+    std::string expectTilingData = "1 24 1 4096 74 74 24 1 10 1 4096 0 0 0 24 0 0 0 0 0 0 0 0 0 0 0 1 274877906945 240518168600 1 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(WelfordVarMeanTiling, welford_var_mean_tiling_ar_group_bfloat16)
+{
+    optiling::WelfordVarMeanCompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "WelfordVarMean",
+        {
+            {{{2, 77, 3}, {2, 77, 3}}, ge::DT_BF16, ge::FORMAT_ND},
+        },
+        {
+            {{{2, 77}, {2, 77}}, ge::DT_BF16, ge::FORMAT_ND},
+            {{{2, 77}, {2, 77}}, ge::DT_BF16, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("dim", Ops::Math::AnyValue::CreateFrom<std::vector<int64_t>>({2})),
+         gert::TilingContextPara::OpAttr("correction", Ops::Math::AnyValue::CreateFrom<int64_t>(1)),
+         gert::TilingContextPara::OpAttr("keepdim", Ops::Math::AnyValue::CreateFrom<bool>(false)),
+         gert::TilingContextPara::OpAttr("is_std", Ops::Math::AnyValue::CreateFrom<bool>(false))},
+        &compileInfo);
+    uint64_t expectTilingKey = 3;
+    std::string expectTilingData = "1 3 1 154 20 20 3 1 0 1 154 0 0 0 3 0 0 0 0 0 0 0 0 0 0 0 1 85899345921 34359738384 1 ";
+    std::vector<size_t> expectWorkspaces = {16777216};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(WelfordVarMeanTiling, welford_var_mean_tiling_ar_seq_split_float16)
+{
+    optiling::WelfordVarMeanCompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "WelfordVarMean",
+        {
+            {{{16, 200000}, {16, 200000}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+        },
+        {
+            {{{16}, {16}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+            {{{16}, {16}}, ge::DT_FLOAT16, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("dim", Ops::Math::AnyValue::CreateFrom<std::vector<int64_t>>({-1})),
+         gert::TilingContextPara::OpAttr("correction", Ops::Math::AnyValue::CreateFrom<int64_t>(1)),
+         gert::TilingContextPara::OpAttr("keepdim", Ops::Math::AnyValue::CreateFrom<bool>(false)),
+         gert::TilingContextPara::OpAttr("is_std", Ops::Math::AnyValue::CreateFrom<bool>(false))},
+        &compileInfo);
+    uint64_t expectTilingKey = 2;
+    std::string expectTilingData = "1 200000 1 16 2 2 15385 1 0 1 16 0 0 0 200000 0 0 0 0 0 0 0 0 0 0 0 1 111669149698 34359754624 13 ";
+    std::vector<size_t> expectWorkspaces = {16778880};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(WelfordVarMeanTiling, welford_var_mean_tiling_discontinuous_dims_float)
+{
+    optiling::WelfordVarMeanCompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "WelfordVarMean",
+        {
+            {{{3, 5, 7, 9}, {3, 5, 7, 9}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{5, 9}, {5, 9}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{5, 9}, {5, 9}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("dim", Ops::Math::AnyValue::CreateFrom<std::vector<int64_t>>({0, 2})),
+         gert::TilingContextPara::OpAttr("correction", Ops::Math::AnyValue::CreateFrom<int64_t>(0)),
+         gert::TilingContextPara::OpAttr("keepdim", Ops::Math::AnyValue::CreateFrom<bool>(false)),
+         gert::TilingContextPara::OpAttr("is_std", Ops::Math::AnyValue::CreateFrom<bool>(false))},
+        &compileInfo);
+    uint64_t expectTilingKey = 1;
+    std::string expectTilingData = "3 7 9 9 1 5 7 1 0 0 5 0 0 0 63 0 0 0 3 0 0 0 315 0 0 0 4294967297 64424509440 30064771088 3 ";
+    std::vector<size_t> expectWorkspaces = {16779136};
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_SUCCESS, expectTilingKey, expectTilingData, expectWorkspaces);
+}
+
+TEST_F(WelfordVarMeanTiling, welford_var_mean_tiling_dim_out_of_range)
+{
+    optiling::WelfordVarMeanCompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "WelfordVarMean",
+        {
+            {{{6, 16}, {6, 16}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{6}, {6}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{6}, {6}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("dim", Ops::Math::AnyValue::CreateFrom<std::vector<int64_t>>({2})),
+         gert::TilingContextPara::OpAttr("correction", Ops::Math::AnyValue::CreateFrom<int64_t>(1)),
+         gert::TilingContextPara::OpAttr("keepdim", Ops::Math::AnyValue::CreateFrom<bool>(false)),
+         gert::TilingContextPara::OpAttr("is_std", Ops::Math::AnyValue::CreateFrom<bool>(false))},
+        &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
+
+TEST_F(WelfordVarMeanTiling, welford_var_mean_tiling_duplicate_dim)
+{
+    optiling::WelfordVarMeanCompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "WelfordVarMean",
+        {
+            {{{6, 16}, {6, 16}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {
+            {{{6}, {6}}, ge::DT_FLOAT, ge::FORMAT_ND},
+            {{{6}, {6}}, ge::DT_FLOAT, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("dim", Ops::Math::AnyValue::CreateFrom<std::vector<int64_t>>({1, -1})),
+         gert::TilingContextPara::OpAttr("correction", Ops::Math::AnyValue::CreateFrom<int64_t>(1)),
+         gert::TilingContextPara::OpAttr("keepdim", Ops::Math::AnyValue::CreateFrom<bool>(false)),
+         gert::TilingContextPara::OpAttr("is_std", Ops::Math::AnyValue::CreateFrom<bool>(false))},
+        &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
+
+TEST_F(WelfordVarMeanTiling, welford_var_mean_tiling_int32_not_support)
+{
+    optiling::WelfordVarMeanCompileInfo compileInfo = {64, 16777216, 196608};
+    gert::TilingContextPara tilingContextPara(
+        "WelfordVarMean",
+        {
+            {{{6, 16}, {6, 16}}, ge::DT_INT32, ge::FORMAT_ND},
+        },
+        {
+            {{{6}, {6}}, ge::DT_INT32, ge::FORMAT_ND},
+            {{{6}, {6}}, ge::DT_INT32, ge::FORMAT_ND},
+        },
+        {gert::TilingContextPara::OpAttr("dim", Ops::Math::AnyValue::CreateFrom<std::vector<int64_t>>({1})),
+         gert::TilingContextPara::OpAttr("correction", Ops::Math::AnyValue::CreateFrom<int64_t>(1)),
+         gert::TilingContextPara::OpAttr("keepdim", Ops::Math::AnyValue::CreateFrom<bool>(false)),
+         gert::TilingContextPara::OpAttr("is_std", Ops::Math::AnyValue::CreateFrom<bool>(false))},
+        &compileInfo);
+    ExecuteTestCase(tilingContextPara, ge::GRAPH_FAILED);
+}
@@ -0,0 +1,227 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+/*!
+ * \file test_welford_var_mean.cpp
+ * \brief
+ */
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <cmath>
+#include <vector>
+#include "gtest/gtest.h"
+#include "tikicpulib.h"
+#include "data_utils.h"
+
+using namespace std;
+
+extern "C" __global__ __aicore__ void welford_var_mean(
+    GM_ADDR x, GM_ADDR var, GM_ADDR mean, GM_ADDR workspace, GM_ADDR tiling);
+
+class welford_var_mean_test : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        cout << "welford_var_mean_test SetUp\n" << endl;
+    }
+    static void TearDownTestCase()
+    {
+        cout << "welford_var_mean_test TearDown\n" << endl;
+    }
+};
+
+static void InitTilingData(WelfordVarMeanTilingData* tilingData)
+{
+    tilingData->rOuterNum = 1;
+    tilingData->tasksPerCore = 1;
+    tilingData->tailTasks = 0;
+    tilingData->correction = 1;
+    for (int32_t i = 0; i < 4; i++) {
+        tilingData->aShape[i] = 0;
+        tilingData->aStride[i] = 0;
+        tilingData->rShape[i] = 0;
+        tilingData->rStride[i] = 0;
+    }
+    tilingData->rDimNum = 0;
+    tilingData->isStd = 0;
+}
+
+TEST_F(welford_var_mean_test, test_ra_float)
+{
+    // x: [2, 64, 40], dim = 1 -> var/mean: [2, 40]
+    size_t inputNum = 2 * 64 * 40;
+    size_t outputNum = 2 * 40;
+    uint32_t blockDim = 2;
+    uint8_t* x = (uint8_t*)AscendC::GmAlloc(inputNum * sizeof(float));
+    uint8_t* var = (uint8_t*)AscendC::GmAlloc(outputNum * sizeof(float));
+    uint8_t* mean = (uint8_t*)AscendC::GmAlloc(outputNum * sizeof(float));
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(16 * 1024 * 1024);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(sizeof(WelfordVarMeanTilingData));
+
+    // x[a, r, c] = r，每个输出的均值为31.5，无偏方差为64*65/12
+    float* xData = reinterpret_cast<float*>(x);
+    for (size_t i = 0; i < inputNum; i++) {
+        xData[i] = static_cast<float>((i / 40) % 64);
+    }
+
+    WelfordVarMeanTilingData* tilingData = reinterpret_cast<WelfordVarMeanTilingData*>(tiling);
+    InitTilingData(tilingData);
+    tilingData->rInner = 64;
+    tilingData->innerNum = 40;
+    tilingData->lineLen = 40;
+    tilingData->blocksPerLine = 1;
+    tilingData->unitNum = 2;
+    tilingData->partLen = 64;
+    tilingData->aShape[0] = 2;
+    tilingData->aStride[0] = 2560;
+    tilingData->aDimNum = 1;
+    tilingData->mode = 0;
+    tilingData->usedCoreNum = blockDim;
+    tilingData->colFactor = 40;
+    tilingData->rowFactor = 64;
+    tilingData->splitNum = 1;
+
+    ICPU_SET_TILING_KEY(1);
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_RUN_KF(welford_var_mean, blockDim, x, var, mean, workspace, (uint8_t*)(tilingData));
+
+    float* varData = reinterpret_cast<float*>(var);
+    float* meanData = reinterpret_cast<float*>(mean);
+    for (size_t i = 0; i < outputNum; i++) {
+        EXPECT_NEAR(meanData[i], 31.5f, 1e-4f);
+        EXPECT_NEAR(varData[i], 64.0f * 65.0f / 12.0f, 1e-2f);
+    }
+
+    AscendC::GmFree(x);
+    AscendC::GmFree(var);
+    AscendC::GmFree(mean);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+}
+
+TEST_F(welford_var_mean_test, test_ar_group_float_std)
+{
+    // x: [96, 24], dim = 1 -> std/mean: [96]，每8个输出为一个单元
+    size_t inputNum = 96 * 24;
+    size_t outputNum = 96;
+    uint32_t blockDim = 12;
+    uint8_t* x = (uint8_t*)AscendC::GmAlloc(inputNum * sizeof(float));
+    uint8_t* var = (uint8_t*)AscendC::GmAlloc(outputNum * sizeof(float));
+    uint8_t* mean = (uint8_t*)AscendC::GmAlloc(outputNum * sizeof(float));
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(16 * 1024 * 1024);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(sizeof(WelfordVarMeanTilingData));
+
+    // 第a行为a + [0, 23]，均值为a + 11.5，标准差与a无关
+    float* xData = reinterpret_cast<float*>(x);
+    for (size_t i = 0; i < inputNum; i++) {
+        xData[i] = static_cast<float>(i / 24 + i % 24);
+    }
+
+    WelfordVarMeanTilingData* tilingData = reinterpret_cast<WelfordVarMeanTilingData*>(tiling);
+    InitTilingData(tilingData);
+    tilingData->rInner = 24;
+    tilingData->innerNum = 1;
+    tilingData->lineLen = 96;
+    tilingData->blocksPerLine = 12;
+    tilingData->unitNum = 12;
+    tilingData->partLen = 24;
+    tilingData->aShape[0] = 96;
+    tilingData->aStride[0] = 24;
+    tilingData->aDimNum = 1;
+    tilingData->mode = 1;
+    tilingData->usedCoreNum = blockDim;
+    tilingData->colFactor = 24;
+    tilingData->rowFactor = 8;
+    tilingData->splitNum = 1;
+    tilingData->isStd = 1;
+
+    ICPU_SET_TILING_KEY(1);
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_RUN_KF(welford_var_mean, blockDim, x, var, mean, workspace, (uint8_t*)(tilingData));
+
+    float* stdData = reinterpret_cast<float*>(var);
+    float* meanData = reinterpret_cast<float*>(mean);
+    float expectStd = std::sqrt(24.0f * 25.0f / 12.0f);
+    for (size_t i = 0; i < outputNum; i++) {
+        EXPECT_NEAR(meanData[i], static_cast<float>(i) + 11.5f, 1e-4f);
+        EXPECT_NEAR(stdData[i], expectStd, 1e-4f);
+    }
+
+    AscendC::GmFree(x);
+    AscendC::GmFree(var);
+    AscendC::GmFree(mean);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+}
+
+TEST_F(welford_var_mean_test, test_ar_seq_split_float)
+{
+    // x: [2, 20000], dim = 1 -> var/mean: [2]，规约轴切成两份由两个核计算后合并
+    size_t inputNum = 2 * 20000;
+    size_t outputNum = 2;
+    uint32_t blockDim = 2;
+    uint8_t* x = (uint8_t*)AscendC::GmAlloc(inputNum * sizeof(float));
+    uint8_t* var = (uint8_t*)AscendC::GmAlloc(outputNum * sizeof(float));
+    uint8_t* mean = (uint8_t*)AscendC::GmAlloc(outputNum * sizeof(float));
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(16 * 1024 * 1024 + 1024);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(sizeof(WelfordVarMeanTilingData));
+
+    // 带较大偏置的数据，两遍公式与单遍Welford结果应一致
+    float* xData = reinterpret_cast<float*>(x);
+    std::vector<double> expectMean(outputNum, 0.0);
+    std::vector<double> expectVar(outputNum, 0.0);
+    for (size_t a = 0; a < outputNum; a++) {
+        for (size_t r = 0; r < 20000; r++) {
+            xData[a * 20000 + r] = 1000.0f + static_cast<float>(a) + static_cast<float>(r % 13) * 0.25f;
+            expectMean[a] += xData[a * 20000 + r];
+        }
+        expectMean[a] /= 20000.0;
+        for (size_t r = 0; r < 20000; r++) {
+            double diff = xData[a * 20000 + r] - expectMean[a];
+            expectVar[a] += diff * diff;
+        }
+        expectVar[a] /= 19999.0;
+    }
+
+    WelfordVarMeanTilingData* tilingData = reinterpret_cast<WelfordVarMeanTilingData*>(tiling);
+    InitTilingData(tilingData);
+    tilingData->rInner = 20000;
+    tilingData->innerNum = 1;
+    tilingData->lineLen = 2;
+    tilingData->blocksPerLine = 1;
+    tilingData->unitNum = 1;
+    tilingData->partLen = 10000;
+    tilingData->aShape[0] = 2;
+    tilingData->aStride[0] = 20000;
+    tilingData->aDimNum = 1;
+    tilingData->mode = 2;
+    tilingData->usedCoreNum = blockDim;
+    tilingData->colFactor = 12160;
+    tilingData->rowFactor = 8;
+    tilingData->splitNum = 2;
+
+    ICPU_SET_TILING_KEY(1);
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_RUN_KF(welford_var_mean, blockDim, x, var, mean, workspace, (uint8_t*)(tilingData));
+
+    float* varData = reinterpret_cast<float*>(var);
+    float* meanData = reinterpret_cast<float*>(mean);
+    for (size_t i = 0; i < outputNum; i++) {
+        EXPECT_NEAR(meanData[i], expectMean[i], 1e-3);
+        EXPECT_NEAR(varData[i], expectVar[i], 1e-3);
+    }
+
+    AscendC::GmFree(x);
+    AscendC::GmFree(var);
+    AscendC::GmFree(mean);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+}
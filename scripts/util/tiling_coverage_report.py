@@ -0,0 +1,254 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# ----------------------------------------------------------------------------
+# This program is free software, you can redistribute it and/or modify it.
+# Copyright (c) 2025 Huawei Technologies Co., Ltd.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+# BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ----------------------------------------------------------------------------
+
+"""
+Tiling-key coverage report.
+
+Joins the records written by the tiling UT (run with TILING_COVERAGE_FILE=<file>, see
+tests/ut/common/tiling_case_executor.cpp) with what every op compiles:
+  * tiling keys dispatched by the kernel (TILING_KEY_IS(n) in op_kernel sources)
+  * binary variants listed in op_host/config/<soc>/<op>_binary.json
+and reports compiled keys/binaries never selected, and shapes whose tiling only uses a small
+part of the cores.
+
+usage:
+  TILING_COVERAGE_FILE=/tmp/tiling_cov.jsonl ./math_op_host_ut
+  python3 scripts/util/tiling_coverage_report.py /tmp/tiling_cov.jsonl --soc ascend910b
+"""
+
+import os
+import re
+import glob
+import json
+import argparse
+from collections import defaultdict
+
+
+OP_CATEGORIES = ['math', 'conversion', 'random', 'experimental']
+DTYPE_ALIAS = {'float': 'float32', 'half': 'float16', 'bf16': 'bfloat16'}
+OP_ADD_PATTERN = re.compile(r'OP_ADD\((\w+)')
+TILING_KEY_PATTERN = re.compile(r'TILING_KEY_IS\(\s*(\d+|[A-Za-z_]\w*)[uUlL]*\s*\)')
+# named keys such as "#define KEY_DTYPE_FP32 2" or "constexpr uint64_t KEY_DTYPE_FP32 = 2;"
+KEY_CONSTANT_PATTERN = re.compile(
+    r'^\s*(?:#define\s+(\w+)\s+\(?\s*(\d+)[uUlL]*\s*\)?'
+    r'|(?:static\s+)?(?:const|constexpr)\s+[\w:]+\s+(\w+)\s*=\s*(\d+)[uUlL]*\s*;)',
+    re.MULTILINE)
+TPL_PATTERN = re.compile(r'ASCENDC_TPL_ARGS_DECL|ASCENDC_TPL_SEL')
+
+
+def normalize_dtype(dtype):
+    return DTYPE_ALIAS.get(dtype, dtype)
+
+
+def find_op_dirs(src_root):
+    """map op type (OP_ADD name) to its op directory"""
+    op_dirs = {}
+    for category in OP_CATEGORIES:
+        pattern = os.path.join(src_root, category, '**', 'op_host', '*_def.cpp')
+        for def_file in glob.glob(pattern, recursive=True):
+            with open(def_file, 'r', encoding='utf-8', errors='ignore') as fd:
+                for op_type in OP_ADD_PATTERN.findall(fd.read()):
+                    op_dirs.setdefault(op_type, os.path.dirname(os.path.dirname(def_file)))
+    return op_dirs
+
+
+def collect_kernel_keys(op_dir):
+    """
+    tiling keys dispatched by the kernel and the key names that could not be resolved to a number.
+    Keys are None when they come from the tiling template.
+    """
+    raw_keys = set()
+    constants = {}
+    templated = False
+    for ext in ('*.cpp', '*.h'):
+        for src in glob.glob(os.path.join(op_dir, 'op_kernel', '**', ext), recursive=True):
+            with open(src, 'r', encoding='utf-8', errors='ignore') as fd:
+                content = fd.read()
+            raw_keys.update(TILING_KEY_PATTERN.findall(content))
+            for define_name, define_value, const_name, const_value in KEY_CONSTANT_PATTERN.findall(content):
+                constants[define_name or const_name] = int(define_value or const_value)
+            templated = templated or TPL_PATTERN.search(content) is not None
+    if templated and not raw_keys:
+        return None, []
+    keys = set()
+    unresolved = []
+    for key in raw_keys:
+        if key.isdigit():
+            keys.add(int(key))
+        elif key in constants:
+            keys.add(constants[key])
+        else:
+            unresolved.append(key)
+    return keys, sorted(unresolved)
+
+
+def collect_binary_variants(op_dir, soc):
+    """dtype combinations of every compiled binary, one tuple per op_list entry"""
+    variants = []
+    socs = [soc] if soc else sorted(os.listdir(os.path.join(op_dir, 'op_host', 'config')))
+    for soc_name in socs:
+        for bin_json in glob.glob(os.path.join(op_dir, 'op_host', 'config', soc_name, '*_binary.json')):
+            with open(bin_json, 'r', encoding='utf-8') as fd:
+                op_list = json.load(fd).get('op_list', [])
+            for item in op_list:
+                dtypes = {}
+                for tensor in item.get('inputs', []):
+                    if tensor and 'dtype' in tensor:
+                        dtypes[tensor.get('index', len(dtypes))] = normalize_dtype(tensor['dtype'])
+                variants.append({'soc': soc_name, 'bin_filename': item.get('bin_filename', ''), 'inputs': dtypes})
+    return variants
+
+
+def read_simplified_key_mode(op_dir, op_type, soc):
+    """simplified_key_mode of the op, decides whether dtype/format take part in binary matching"""
+    modes = {}
+    for ini in glob.glob(os.path.join(op_dir, 'op_host', 'config', soc or '*', '*_simplified_key.ini')):
+        section = None
+        with open(ini, 'r', encoding='utf-8') as fd:
+            for line in fd:
+                line = line.strip()
+                if not line or line.startswith(';'):
+                    continue
+                if line.startswith('['):
+                    section = line.strip('[]')
+                elif section == op_type and '=' in line:
+                    key, value = line.split('=', 1)
+                    modes[os.path.basename(os.path.dirname(ini)) + ':' + key.strip()] = value.strip()
+    return modes
+
+
+def load_records(record_files):
+    records = defaultdict(list)
+    for record_file in record_files:
+        with open(record_file, 'r', encoding='utf-8') as fd:
+            for line in fd:
+                line = line.strip()
+                if line:
+                    record = json.loads(line)
+                    records[record['op']].append(record)
+    return records
+
+
+def variant_hit(variant, record):
+    ir_dtypes = record.get('ir_input_dtypes', [])
+    for index, dtype in variant['inputs'].items():
+        if index < len(ir_dtypes) and ir_dtypes[index] is not None and ir_dtypes[index] != dtype:
+            return False
+    return True
+
+
+def numel(shape):
+    count = 1
+    for dim in shape:
+        count *= max(dim, 1)
+    return count
+
+
+def analyze_op(op_type, op_records, op_dir, args):
+    report = {'op': op_type, 'records': len(op_records)}
+    success = [record for record in op_records if record['status'] == 'success']
+    report['failed_records'] = len(op_records) - len(success)
+
+    key_hits = defaultdict(int)
+    for record in success:
+        key_hits[record['tiling_key']] += 1
+    report['selected_keys'] = {str(key): count for key, count in sorted(key_hits.items())}
+
+    if op_dir is not None:
+        kernel_keys, unresolved_keys = collect_kernel_keys(op_dir)
+        if kernel_keys is None:
+            report['kernel_keys'] = 'template'
+        elif unresolved_keys:
+            # keys defined outside op_kernel or by expressions, the kernel key set is incomplete
+            report['kernel_keys'] = 'unsupported'
+            report['unresolved_kernel_keys'] = unresolved_keys
+        else:
+            report['kernel_keys'] = sorted(kernel_keys)
+            report['unused_kernel_keys'] = sorted(kernel_keys - set(key_hits))
+            report['unknown_selected_keys'] = sorted(set(key_hits) - kernel_keys) if kernel_keys else []
+        variants = collect_binary_variants(op_dir, args.soc) if os.path.isdir(
+            os.path.join(op_dir, 'op_host', 'config')) else []
+        report['binary_variants'] = len(variants)
+        report['unused_binary_variants'] = [
+            {'soc': variant['soc'], 'bin_filename': variant['bin_filename'], 'inputs': variant['inputs']}
+            for variant in variants if not any(variant_hit(variant, record) for record in success)]
+        report['simplified_key_mode'] = read_simplified_key_mode(op_dir, op_type, args.soc)
+
+    low_core = []
+    for record in success:
+        core_num = record.get('core_num', 0)
+        block_dim = record.get('block_dim', 0)
+        if core_num <= 0 or block_dim >= core_num * args.low_core_ratio:
+            continue
+        max_numel = max((numel(tensor['shape']) for tensor in record.get('inputs', [])), default=0)
+        if max_numel < args.min_numel:
+            continue
+        low_core.append({'case': record.get('case', ''), 'tiling_key': record['tiling_key'],
+                         'block_dim': block_dim, 'core_num': core_num,
+                         'inputs': [tensor['shape'] for tensor in record.get('inputs', [])]})
+    report['low_core_utilization'] = low_core
+    return report
+
+
+def print_report(reports):
+    for report in reports:
+        print('==== {} ({} records, {} failed)'.format(report['op'], report['records'], report['failed_records']))
+        print('  selected keys        : {}'.format(report['selected_keys']))
+        if 'kernel_keys' in report:
+            print('  kernel keys          : {}'.format(report['kernel_keys']))
+        if report.get('unresolved_kernel_keys'):
+            print('  unresolved key names : {}'.format(report['unresolved_kernel_keys']))
+        if report.get('unused_kernel_keys'):
+            print('  unused kernel keys   : {}'.format(report['unused_kernel_keys']))
+        if report.get('unknown_selected_keys'):
+            print('  keys not in kernel   : {}'.format(report['unknown_selected_keys']))
+        if 'binary_variants' in report:
+            print('  binary variants      : {} ({} unused)'.format(
+                report['binary_variants'], len(report['unused_binary_variants'])))
+            for variant in report['unused_binary_variants']:
+                print('    unused {}/{} inputs={}'.format(variant['soc'], variant['bin_filename'], variant['inputs']))
+        for item in report['low_core_utilization']:
+            print('  low core utilization : key={} blockDim={}/{} inputs={} {}'.format(
+                item['tiling_key'], item['block_dim'], item['core_num'], item['inputs'], item['case']))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='tiling key coverage and dead variant report')
+    parser.add_argument('records', nargs='+', help='files written by the tiling UT through TILING_COVERAGE_FILE')
+    parser.add_argument('--src-root', default=os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..'),
+                        help='root of the ops source tree')
+    parser.add_argument('--soc', default='', help='only check binary configs of this soc, e.g. ascend910b')
+    parser.add_argument('--ops', nargs='*', default=[], help='only report these op types')
+    parser.add_argument('--low-core-ratio', type=float, default=0.5,
+                        help='report shapes whose blockDim is below core_num * ratio')
+    parser.add_argument('--min-numel', type=int, default=65536,
+                        help='ignore shapes too small to fill the cores')
+    parser.add_argument('--output', default='', help='also dump the report as json')
+    args = parser.parse_args()
+
+    records = load_records(args.records)
+    op_dirs = find_op_dirs(os.path.abspath(args.src_root))
+    reports = []
+    for op_type in sorted(records):
+        if args.ops and op_type not in args.ops:
+            continue
+        reports.append(analyze_op(op_type, records[op_type], op_dirs.get(op_type), args))
+
+    print_report(reports)
+    if args.output:
+        with open(args.output, 'w', encoding='utf-8') as fd:
+            json.dump(reports, fd, indent=2)
+
+
+if __name__ == '__main__':
+    main()
@@ -10,6 +10,8 @@
  */
 
 #include "tiling_case_executor.h"
+#include <cstdlib>
+#include <fstream>
 #include <gtest/gtest.h>
 #include <nlohmann/json.hpp>
 #include "platform/platform_infos_def.h"
@@ -224,11 +226,194 @@ static void GetPlatFormInfos(
     }
 }
 
+namespace {
+// when set, every tiling executed by the UT is appended to this file as one JSON line
+const char* const TILING_COVERAGE_ENV = "TILING_COVERAGE_FILE";
+
+const std::map<ge::DataType, string> DTYPE_NAMES = {
+    {ge::DT_FLOAT, "float32"},     {ge::DT_FLOAT16, "float16"},     {ge::DT_BF16, "bfloat16"},
+    {ge::DT_INT8, "int8"},         {ge::DT_UINT8, "uint8"},         {ge::DT_INT16, "int16"},
+    {ge::DT_UINT16, "uint16"},     {ge::DT_INT32, "int32"},         {ge::DT_UINT32, "uint32"},
+    {ge::DT_INT64, "int64"},       {ge::DT_UINT64, "uint64"},       {ge::DT_BOOL, "bool"},
+    {ge::DT_DOUBLE, "double"},     {ge::DT_COMPLEX64, "complex64"}, {ge::DT_COMPLEX128, "complex128"}};
+
+const std::map<string, ge::Format> FORMAT_NAMES = {
+    {"ND", ge::FORMAT_ND},       {"NCHW", ge::FORMAT_NCHW},   {"NHWC", ge::FORMAT_NHWC},
+    {"NCDHW", ge::FORMAT_NCDHW}, {"NDHWC", ge::FORMAT_NDHWC}, {"FRACTAL_NZ", ge::FORMAT_FRACTAL_NZ}};
+
+string DataTypeName(ge::DataType dtype)
+{
+    auto iter = DTYPE_NAMES.find(dtype);
+    return iter != DTYPE_NAMES.end() ? iter->second : std::to_string(static_cast<int32_t>(dtype));
+}
+
+bool ParseDataType(const string& name, ge::DataType& dtype)
+{
+    const string& dtypeName = (name == "float") ? DTYPE_NAMES.at(ge::DT_FLOAT) : name;
+    for (auto& item : DTYPE_NAMES) {
+        if (item.second == dtypeName) {
+            dtype = item.first;
+            return true;
+        }
+    }
+    return false;
+}
+
+nlohmann::json ShapeToJson(const gert::Shape& shape)
+{
+    nlohmann::json dims = nlohmann::json::array();
+    for (size_t i = 0; i < shape.GetDimNum(); i++) {
+        dims.push_back(shape.GetDim(i));
+    }
+    return dims;
+}
+
+// dtype of the first instance of every IR input, null for an IR input without instance
+nlohmann::json IrInputDtypes(const gert::TilingContextPara& tilingContextPara)
+{
+    nlohmann::json dtypes = nlohmann::json::array();
+    const auto& inputs = tilingContextPara.inputTensorDesc_;
+    if (tilingContextPara.inputInstanceNum_.empty()) {
+        for (auto& desc : inputs) {
+            dtypes.push_back(DataTypeName(desc.dtype_));
+        }
+        return dtypes;
+    }
+    size_t offset = 0;
+    for (auto instanceNum : tilingContextPara.inputInstanceNum_) {
+        if (instanceNum == 0 || offset >= inputs.size()) {
+            dtypes.push_back(nullptr);
+        } else {
+            dtypes.push_back(DataTypeName(inputs[offset].dtype_));
+        }
+        offset += instanceNum;
+    }
+    return dtypes;
+}
+
+void RecordTilingCoverage(
+    const gert::TilingContextPara& tilingContextPara, gert::TilingContext* tilingContext, ge::graphStatus tilingRet)
+{
+    const char* recordFile = std::getenv(TILING_COVERAGE_ENV);
+    if (recordFile == nullptr || recordFile[0] == '\0') {
+        return;
+    }
+
+    nlohmann::json record;
+    record["op"] = tilingContextPara.opName_;
+    auto testInfo = ::testing::UnitTest::GetInstance()->current_test_info();
+    if (testInfo != nullptr) {
+        record["case"] = string(testInfo->test_case_name()) + "." + testInfo->name();
+    }
+    nlohmann::json inputs = nlohmann::json::array();
+    for (auto& desc : tilingContextPara.inputTensorDesc_) {
+        inputs.push_back({{"shape", ShapeToJson(desc.shape_.GetStorageShape())}, {"dtype", DataTypeName(desc.dtype_)}});
+    }
+    record["inputs"] = inputs;
+    record["ir_input_dtypes"] = IrInputDtypes(tilingContextPara);
+    record["core_num"] = tilingContextPara.coreNum_;
+    record["ub_size"] = tilingContextPara.ubSize_;
+    record["status"] = (tilingRet == ge::GRAPH_SUCCESS) ? "success" : "failed";
+    if (tilingRet == ge::GRAPH_SUCCESS) {
+        record["tiling_key"] = tilingContext->GetTilingKey();
+        record["block_dim"] = tilingContext->GetBlockDim();
+        record["tiling_data_size"] = tilingContext->GetRawTilingData()->GetDataSize();
+        nlohmann::json workspaces = nlohmann::json::array();
+        size_t workspaceCount = tilingContext->GetWorkspaceNum();
+        if (workspaceCount > 0) {
+            auto workspaceSizes = tilingContext->GetWorkspaceSizes(workspaceCount);
+            for (size_t i = 0; i < workspaceCount; i++) {
+                workspaces.push_back(workspaceSizes[i]);
+            }
+        }
+        record["workspaces"] = workspaces;
+    }
+
+    std::ofstream out(recordFile, std::ios::app);
+    out << record.dump() << std::endl;
+}
+
+template <typename T>
+std::unique_ptr<uint8_t[]> MakeConstBuffer(const nlohmann::json& values)
+{
+    auto buffer = std::make_unique<uint8_t[]>(values.size() * sizeof(T) + 1);
+    T* data = reinterpret_cast<T*>(buffer.get());
+    for (size_t i = 0; i < values.size(); i++) {
+        data[i] = values[i].get<T>();
+    }
+    return buffer;
+}
+
+bool ParseTensorDesc(
+    const nlohmann::json& item, std::vector<gert::TilingContextPara::TensorDescription>& descs,
+    std::vector<std::unique_ptr<uint8_t[]>>& constBuffers)
+{
+    gert::StorageShape shape;
+    for (auto& dim : item.at("shape")) {
+        shape.MutableOriginShape().AppendDim(dim.get<int64_t>());
+        shape.MutableStorageShape().AppendDim(dim.get<int64_t>());
+    }
+    ge::DataType dtype = ge::DT_FLOAT;
+    if (!ParseDataType(item.value("dtype", string("float32")), dtype)) {
+        return false;
+    }
+    auto formatIter = FORMAT_NAMES.find(item.value("format", string("ND")));
+    if (formatIter == FORMAT_NAMES.end()) {
+        return false;
+    }
+    if (!item.contains("value")) {
+        descs.emplace_back(shape, dtype, formatIter->second);
+        return true;
+    }
+
+    // const input such as perm/axes, the value is used by tiling directly
+    const auto& values = item.at("value");
+    if (dtype == ge::DT_INT32) {
+        constBuffers.push_back(MakeConstBuffer<int32_t>(values));
+    } else if (dtype == ge::DT_INT64) {
+        constBuffers.push_back(MakeConstBuffer<int64_t>(values));
+    } else if (dtype == ge::DT_FLOAT) {
+        constBuffers.push_back(MakeConstBuffer<float>(values));
+    } else {
+        return false;
+    }
+    descs.emplace_back(shape, dtype, formatIter->second, true, constBuffers.back().get());
+    return true;
+}
+
+bool ParseOpAttr(const nlohmann::json& item, std::vector<gert::TilingContextPara::OpAttr>& attrs)
+{
+    const string name = item.at("name").get<string>();
+    const string type = item.at("type").get<string>();
+    const auto& value = item.at("value");
+    if (type == "int") {
+        attrs.emplace_back(name, Ops::Math::AnyValue::CreateFrom<int64_t>(value.get<int64_t>()));
+    } else if (type == "float") {
+        attrs.emplace_back(name, Ops::Math::AnyValue::CreateFrom<float>(value.get<float>()));
+    } else if (type == "bool") {
+        attrs.emplace_back(name, Ops::Math::AnyValue::CreateFrom<bool>(value.get<bool>()));
+    } else if (type == "string") {
+        attrs.emplace_back(name, Ops::Math::AnyValue::CreateFrom<string>(value.get<string>()));
+    } else if (type == "list_int") {
+        attrs.emplace_back(
+            name, Ops::Math::AnyValue::CreateFrom<std::vector<int64_t>>(value.get<std::vector<int64_t>>()));
+    } else if (type == "list_float") {
+        attrs.emplace_back(name, Ops::Math::AnyValue::CreateFrom<std::vector<float>>(value.get<std::vector<float>>()));
+    } else if (type == "list_bool") {
+        attrs.emplace_back(name, Ops::Math::AnyValue::CreateFrom<std::vector<bool>>(value.get<std::vector<bool>>()));
+    } else {
+        return false;
+    }
+    return true;
+}
+} // namespace
+
 void ExecuteTestCase(
     const gert::TilingContextPara& tilingContextPara, ge::graphStatus expectResult, uint64_t expectTilingKey,
     const string& expectTilingData, const std::vector<size_t>& expectWorkspaces)
 {
     DO_TILING(tilingContextPara);
+    RecordTilingCoverage(tilingContextPara, tilingContext, tilingRet);
 
     // check tiling func
     EXPECT_EQ(tilingRet, expectResult);
@@ -258,6 +443,7 @@ void ExecuteTestCase(
 bool ExecuteTiling(const gert::TilingContextPara& tilingContextPara, TilingInfo& tilingInfo)
 {
     DO_TILING(tilingContextPara);
+    RecordTilingCoverage(tilingContextPara, tilingContext, tilingRet);
 
     if (tilingRet != ge::GRAPH_SUCCESS) {
         return false;
@@ -279,3 +465,60 @@ bool ExecuteTiling(const gert::TilingContextPara& tilingContextPara, TilingInfo&
 
     return true;
 }
+
+size_t ReplayTilingCorpus(
+    const string& corpusFile, const string& opName, void* compileInfo, uint64_t coreNum, uint64_t ubSize)
+{
+    std::ifstream in(corpusFile);
+    if (!in.is_open()) {
+        std::cout << "[ERROR] open tiling corpus " << corpusFile << " failed!" << std::endl;
+        return 0;
+    }
+
+    size_t successCount = 0;
+    size_t lineNo = 0;
+    string line;
+    while (std::getline(in, line)) {
+        lineNo++;
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        nlohmann::json item = nlohmann::json::parse(line, nullptr, false);
+        if (item.is_discarded() || !item.is_object()) {
+            std::cout << "[ERROR] " << corpusFile << ":" << lineNo << " is not a json object." << std::endl;
+            continue;
+        }
+        if (item.value("op", string()) != opName) {
+            continue;
+        }
+
+        std::vector<gert::TilingContextPara::TensorDescription> inputs;
+        std::vector<gert::TilingContextPara::TensorDescription> outputs;
+        std::vector<gert::TilingContextPara::OpAttr> attrs;
+        std::vector<std::unique_ptr<uint8_t[]>> constBuffers;
+        bool valid = true;
+        for (auto& input : item.value("inputs", nlohmann::json::array())) {
+            valid = valid && ParseTensorDesc(input, inputs, constBuffers);
+        }
+        for (auto& output : item.value("outputs", nlohmann::json::array())) {
+            valid = valid && ParseTensorDesc(output, outputs, constBuffers);
+        }
+        for (auto& attr : item.value("attrs", nlohmann::json::array())) {
+            valid = valid && ParseOpAttr(attr, attrs);
+        }
+        if (!valid) {
+            std::cout << "[ERROR] " << corpusFile << ":" << lineNo << " has unsupported dtype/format/attr." << std::endl;
+            continue;
+        }
+
+        gert::TilingContextPara tilingContextPara(
+            opName, inputs, outputs, attrs, item.value("input_instance_num", std::vector<uint32_t>()),
+            item.value("output_instance_num", std::vector<uint32_t>()), compileInfo, item.value("core_num", coreNum),
+            item.value("ub_size", ubSize));
+        TilingInfo tilingInfo;
+        if (ExecuteTiling(tilingContextPara, tilingInfo)) {
+            successCount++;
+        }
+    }
+    return successCount;
+}
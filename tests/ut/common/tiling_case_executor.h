@@ -31,4 +31,13 @@ void ExecuteTestCase(
 
 bool ExecuteTiling(const gert::TilingContextPara& tilingContextPara, TilingInfo& tilingInfo);
 
+/*
+ * Replay a JSON Lines shape corpus through the tiling func of opName. Lines whose "op" differs from opName are
+ * skipped, so one corpus may hold several ops. Every replayed case goes through ExecuteTiling, and is therefore
+ * recorded when TILING_COVERAGE_FILE is set. Returns the number of cases whose tiling succeeded.
+ */
+size_t ReplayTilingCorpus(
+    const string& corpusFile, const string& opName, void* compileInfo, uint64_t coreNum = 64,
+    uint64_t ubSize = 262144);
+
 #endif // OPS_MATH_DEV_TESTS_UT_COMMON_TILING_CASE_EXECUTOR_H
\ No newline at end of file
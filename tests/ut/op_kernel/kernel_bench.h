@@ -0,0 +1,124 @@
+/**
+ * This program is free software, you can redistribute it and/or modify it.
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file kernel_bench.h
+ * \brief CPU-simulation benchmark mode of the op kernel UT.
+ *
+ * Benchmark cases run the kernel over a shape corpus: the tiling comes from the registered tiling func
+ * (ExecuteTiling), the kernel runs through ICPU_RUN_KF in the launcher, and one JSON line per shape is
+ * appended to $KERNEL_BENCH_FILE. Without KERNEL_BENCH_FILE the cases are skipped, so the normal UT run
+ * is not slowed down. tests/ut/op_kernel/scripts/kernel_bench_report.py joins the records with a static
+ * per-pipe census of the kernel sources.
+ */
+
+#ifndef KERNEL_BENCH_H
+#define KERNEL_BENCH_H
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+#include "tikicpulib.h"
+#include "data_utils.h"
+#include "tiling_case_executor.h"
+
+// GM buffers in kernel parameter order (inputs then outputs), then workspace, tiling and block dim
+using KernelBenchLauncher =
+    std::function<void(std::vector<uint8_t*>& gmAddrs, uint8_t* workspace, uint8_t* tiling, uint32_t blockDim)>;
+
+struct KernelBenchShape {
+    std::string name;
+    gert::TilingContextPara tilingContextPara;
+    std::vector<size_t> gmBytes;
+};
+
+inline const char* KernelBenchFile()
+{
+    const char* benchFile = std::getenv("KERNEL_BENCH_FILE");
+    return (benchFile == nullptr || benchFile[0] == '\0') ? nullptr : benchFile;
+}
+
+inline bool KernelBenchEnabled()
+{
+    return KernelBenchFile() != nullptr;
+}
+
+inline uint32_t KernelBenchRepeat()
+{
+    const char* repeat = std::getenv("KERNEL_BENCH_REPEAT");
+    int64_t value = (repeat == nullptr) ? 0 : std::atoll(repeat);
+    return value > 0 ? static_cast<uint32_t>(value) : 3;
+}
+
+inline bool RunKernelBench(
+    const std::string& kernelName, const KernelBenchShape& shape, const KernelBenchLauncher& launcher)
+{
+    constexpr size_t GM_ALIGN = 32;
+    TilingInfo tilingInfo;
+    if (!ExecuteTiling(shape.tilingContextPara, tilingInfo)) {
+        ERROR_LOG("kernel bench %s/%s: tiling failed", kernelName.c_str(), shape.name.c_str());
+        return false;
+    }
+
+    size_t totalGmBytes = 0;
+    std::vector<uint8_t*> gmAddrs;
+    for (size_t bytes : shape.gmBytes) {
+        size_t alignedBytes = (bytes + GM_ALIGN - 1) / GM_ALIGN * GM_ALIGN;
+        uint8_t* addr = static_cast<uint8_t*>(AscendC::GmAlloc(alignedBytes));
+        std::memset(addr, 0, alignedBytes);
+        gmAddrs.push_back(addr);
+        totalGmBytes += bytes;
+    }
+    size_t workspaceSize = GM_ALIGN;
+    for (auto size : tilingInfo.workspaceSizes) {
+        workspaceSize += static_cast<size_t>(size);
+    }
+    uint8_t* workspace = static_cast<uint8_t*>(AscendC::GmAlloc(workspaceSize));
+    uint8_t* tiling = static_cast<uint8_t*>(AscendC::GmAlloc(tilingInfo.tilingDataSize));
+    std::memcpy(tiling, tilingInfo.tilingData.get(), tilingInfo.tilingDataSize);
+    uint32_t blockDim = static_cast<uint32_t>(tilingInfo.blockNum);
+
+    // first run is warm up, it pays for the simulator start up
+    ICPU_SET_TILING_KEY(tilingInfo.tilingKey);
+    launcher(gmAddrs, workspace, tiling, blockDim);
+    uint32_t repeat = KernelBenchRepeat();
+    double totalUs = 0.0;
+    double minUs = 0.0;
+    for (uint32_t i = 0; i < repeat; i++) {
+        auto start = std::chrono::steady_clock::now();
+        launcher(gmAddrs, workspace, tiling, blockDim);
+        double costUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        totalUs += costUs;
+        minUs = (i == 0 || costUs < minUs) ? costUs : minUs;
+    }
+
+    for (auto addr : gmAddrs) {
+        AscendC::GmFree(static_cast<void*>(addr));
+    }
+    AscendC::GmFree(static_cast<void*>(workspace));
+    AscendC::GmFree(static_cast<void*>(tiling));
+
+    std::ofstream out(KernelBenchFile(), std::ios::app);
+    out << "{\"kernel\": \"" << kernelName << "\", \"shape\": \"" << shape.name
+        << "\", \"tiling_key\": " << tilingInfo.tilingKey << ", \"block_dim\": " << blockDim
+        << ", \"gm_bytes\": " << totalGmBytes << ", \"repeat\": " << repeat << ", \"sim_us_avg\": " << totalUs / repeat
+        << ", \"sim_us_min\": " << minUs << "}" << std::endl;
+    INFO_LOG(
+        "kernel bench %s/%s: key %ld, blockDim %u, avg %.1f us", kernelName.c_str(), shape.name.c_str(),
+        static_cast<long>(tilingInfo.tilingKey), blockDim, totalUs / repeat);
+    return true;
+}
+
+#endif // KERNEL_BENCH_H
@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# ----------------------------------------------------------------------------
+# This program is free software, you can redistribute it and/or modify it.
+# Copyright (c) 2025 Huawei Technologies Co., Ltd.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+# BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. See LICENSE in the root of
+# the software repository for the full text of the License.
+# ----------------------------------------------------------------------------
+
+"""
+kernel benchmark report
+
+The CPU simulation runs the kernel functionally and has no pipe timing model, so the pipe accounting is a
+static census of the kernel sources: every MTE2/MTE3/vector/scalar API call and every PipeBarrier<PIPE_ALL>
+is counted, and weighted by loop_weight ** (loop depth inside its function). The census is joined with the
+CPU simulation records written by the op kernel UT (KERNEL_BENCH_FILE, see tests/ut/op_kernel/kernel_bench.h).
+
+usage:
+  KERNEL_BENCH_FILE=/tmp/kernel_bench.jsonl ./math_op_kernel_ut_ascend910b --gtest_filter=*bench*
+  python3 kernel_bench_report.py --bench /tmp/kernel_bench.jsonl --baseline last_bench.jsonl --ops segsum
+"""
+
+import os
+import re
+import glob
+import json
+import argparse
+from collections import defaultdict
+
+
+OP_CATEGORIES = ['math', 'conversion', 'random', 'experimental']
+PIPES = ['MTE2', 'MTE3', 'V', 'S']
+VECTOR_APIS = [
+    'Abs', 'Add', 'Adds', 'And', 'Axpy', 'Brcb', 'Cast', 'Compare', 'CompareScalar', 'Copy', 'CumSum', 'Div',
+    'Duplicate', 'Exp', 'Gather', 'GatherMask', 'LeakyRelu', 'Ln', 'Max', 'Maxs', 'Min', 'Mins', 'Mul', 'Muls',
+    'Not', 'Or', 'PairReduceSum', 'ReduceMax', 'ReduceMin', 'ReduceSum', 'Reciprocal', 'Relu', 'Rsqrt', 'Select',
+    'ShiftLeft', 'ShiftRight', 'Sqrt', 'Sub', 'Transpose', 'WholeReduceMax', 'WholeReduceMin', 'WholeReduceSum']
+COMMENT_PATTERN = re.compile(r'//[^\n]*|/\*.*?\*/', re.S)
+STRING_PATTERN = re.compile(r'"(?:\\.|[^"\\])*"')
+LOOP_PATTERN = re.compile(r'\b(?:for|while)\s*\(')
+DO_PATTERN = re.compile(r'\bdo\s*\{')
+DATA_COPY_PATTERN = re.compile(r'\bDataCopy(?:Pad)?\s*(?:<[^;{}()]*>)?\s*\(\s*([^,;]+),')
+VECTOR_PATTERN = re.compile(r'(?<![\w.:])(?:AscendC::)?(' + '|'.join(VECTOR_APIS) + r')\s*(?:<[^;{}()]*>)?\s*\(')
+SCALAR_PATTERN = re.compile(r'\.(?:GetValue|SetValue)\s*\(')
+PIPE_ALL_PATTERN = re.compile(r'\bPipeBarrier\s*<\s*PIPE_ALL\s*>')
+GM_NAME_PATTERN = re.compile(r'gm|GM|Gm')
+
+
+def strip_source(content):
+    """drop comments and string literals, keep offsets stable enough for brace matching"""
+    content = COMMENT_PATTERN.sub(lambda match: ' ' * len(match.group(0)), content)
+    return STRING_PATTERN.sub(lambda match: '""', content)
+
+
+def find_loop_braces(content):
+    """offsets of the opening braces of loop bodies"""
+    loop_braces = set()
+    for match in LOOP_PATTERN.finditer(content):
+        depth = 1
+        pos = match.end()
+        while pos < len(content) and depth > 0:
+            depth += {'(': 1, ')': -1}.get(content[pos], 0)
+            pos += 1
+        while pos < len(content) and content[pos].isspace():
+            pos += 1
+        if pos < len(content) and content[pos] == '{':
+            loop_braces.add(pos)
+    for match in DO_PATTERN.finditer(content):
+        loop_braces.add(match.end() - 1)
+    return loop_braces
+
+
+def collect_events(content):
+    events = []
+    for match in DATA_COPY_PATTERN.finditer(content):
+        pipe = 'MTE3' if GM_NAME_PATTERN.search(match.group(1)) else 'MTE2'
+        events.append((match.start(), pipe))
+    events.extend((match.start(), 'V') for match in VECTOR_PATTERN.finditer(content))
+    events.extend((match.start(), 'S') for match in SCALAR_PATTERN.finditer(content))
+    events.extend((match.start(), 'PIPE_ALL') for match in PIPE_ALL_PATTERN.finditer(content))
+    return sorted(events)
+
+
+def census_source(content, loop_weight):
+    content = strip_source(content)
+    loop_braces = find_loop_braces(content)
+    counts = defaultdict(int)
+    weighted = defaultdict(float)
+    pipe_all_in_loop = 0
+    events = collect_events(content)
+    event_index = 0
+    brace_stack = []
+    for pos, char in enumerate(content):
+        while event_index < len(events) and events[event_index][0] == pos:
+            kind = events[event_index][1]
+            loop_depth = sum(brace_stack)
+            counts[kind] += 1
+            weighted[kind] += loop_weight ** loop_depth
+            if kind == 'PIPE_ALL' and loop_depth > 0:
+                pipe_all_in_loop += 1
+            event_index += 1
+        if char == '{':
+            brace_stack.append(1 if pos in loop_braces else 0)
+        elif char == '}' and brace_stack:
+            brace_stack.pop()
+    return counts, weighted, pipe_all_in_loop
+
+
+def find_kernel_dirs(src_root, ops):
+    kernel_dirs = {}
+    for category in OP_CATEGORIES:
+        for kernel_dir in glob.glob(os.path.join(src_root, category, '*', 'op_kernel')):
+            op_name = os.path.basename(os.path.dirname(kernel_dir))
+            if not ops or op_name in ops:
+                kernel_dirs[op_name] = kernel_dir
+    return kernel_dirs
+
+
+def census_kernel(kernel_dir, loop_weight):
+    report = {'counts': defaultdict(int), 'weighted': defaultdict(float), 'pipe_all_in_loop': 0}
+    for ext in ('*.cpp', '*.h'):
+        for src in glob.glob(os.path.join(kernel_dir, '**', ext), recursive=True):
+            with open(src, 'r', encoding='utf-8', errors='ignore') as fd:
+                counts, weighted, pipe_all_in_loop = census_source(fd.read(), loop_weight)
+            for kind, count in counts.items():
+                report['counts'][kind] += count
+            for kind, load in weighted.items():
+                report['weighted'][kind] += load
+            report['pipe_all_in_loop'] += pipe_all_in_loop
+    flags = []
+    if report['weighted']['S'] > report['weighted']['V']:
+        flags.append('scalar-bound')
+    if report['pipe_all_in_loop'] > 0:
+        flags.append('PIPE_ALL in loop')
+    report['flags'] = flags
+    return report
+
+
+def load_bench(bench_file):
+    records = defaultdict(dict)
+    if not bench_file:
+        return records
+    with open(bench_file, 'r', encoding='utf-8') as fd:
+        for line in fd:
+            line = line.strip()
+            if line:
+                record = json.loads(line)
+                records[record['kernel']][record['shape']] = record
+    return records
+
+
+def main():
+    parser = argparse.ArgumentParser(description='op kernel CPU simulation benchmark report')
+    parser.add_argument('--bench', default='', help='records written through KERNEL_BENCH_FILE')
+    parser.add_argument('--baseline', default='', help='records of a previous run, used for regression check')
+    parser.add_argument('--threshold', type=float, default=0.2, help='report shapes slower than baseline by ratio')
+    parser.add_argument('--loop-weight', type=float, default=16.0, help='weight of one loop level in the census')
+    parser.add_argument('--ops', nargs='*', default=[], help='only report these ops, e.g. segsum histogram_v2')
+    parser.add_argument('--flagged-only', action='store_true', help='only print kernels with census flags')
+    parser.add_argument('--src-root', default=os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                                            '..', '..', '..', '..'))
+    args = parser.parse_args()
+
+    bench = load_bench(args.bench)
+    baseline = load_bench(args.baseline)
+    kernel_dirs = find_kernel_dirs(os.path.abspath(args.src_root), args.ops)
+    regressions = []
+    for op_name in sorted(kernel_dirs):
+        census = census_kernel(kernel_dirs[op_name], args.loop_weight)
+        if args.flagged_only and not census['flags']:
+            continue
+        print('==== {} {}'.format(op_name, ' '.join('[{}]'.format(flag) for flag in census['flags'])))
+        print('  {:<10}{:>8}{:>14}'.format('pipe', 'calls', 'weighted'))
+        for kind in PIPES + ['PIPE_ALL']:
+            print('  {:<10}{:>8}{:>14.0f}'.format(kind, census['counts'][kind], census['weighted'][kind]))
+        for shape, record in sorted(bench.get(op_name, {}).items()):
+            bandwidth = record['gm_bytes'] / record['sim_us_min'] if record['sim_us_min'] > 0 else 0.0
+            print('  bench {:<24} key={:<6} blockDim={:<4} min {:>10.1f} us  {:>8.2f} MB/s(sim)'.format(
+                shape, record['tiling_key'], record['block_dim'], record['sim_us_min'], bandwidth))
+            base = baseline.get(op_name, {}).get(shape)
+            if base and base['sim_us_min'] > 0 and \
+                    record['sim_us_min'] > base['sim_us_min'] * (1.0 + args.threshold):
+                regressions.append((op_name, shape, base['sim_us_min'], record['sim_us_min']))
+
+    for op_name, shape, base_us, cur_us in regressions:
+        print('[REGRESSION] {}/{}: {:.1f} us -> {:.1f} us'.format(op_name, shape, base_us, cur_us))
+    return 1 if regressions else 0
+
+
+if __name__ == '__main__':
+    exit(main())